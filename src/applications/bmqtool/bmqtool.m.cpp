@@ -21,6 +21,7 @@
 #include <m_bmqtool_parameters.h>
 
 // BMQ
+#include <bmqt_compressionalgorithmtype.h>
 #include <bmqt_queueflags.h>
 #include <bmqt_sessionoptions.h>
 #include <bmqt_uri.h>
@@ -192,6 +193,8 @@ static bool parseArgs(Parameters* parameters, int argc, const char* argv[])
     bool        dumpProfile  = false;
     bsl::string jsonMessageProperties;
     bsl::string jsonSubscriptions;
+    bsl::string compressionAlgorithm("NONE");
+    int         compressionLevel = 0;
 
     balcl::OptionInfo specTable[] = {
         {"mode",
@@ -345,6 +348,19 @@ static bool parseArgs(Parameters* parameters, int argc, const char* argv[])
          "timeout",
          "The timeout to use for session operations with the broker",
          balcl::TypeInfo(&params.timeoutSec()),
+         balcl::OccurrenceInfo::e_OPTIONAL},
+        {"compression-algorithm",
+         "compressionAlgorithm",
+         "compression algorithm of posted messages "
+         "([NONE, ZLIB, ZSTD, LZ4])",
+         balcl::TypeInfo(&compressionAlgorithm,
+                         &bmqt::CompressionAlgorithmType::isValid),
+         balcl::OccurrenceInfo(compressionAlgorithm)},
+        {"compression-level",
+         "compressionLevel",
+         "compression level of posted messages (algorithm specific, "
+         "algorithm default if unspecified)",
+         balcl::TypeInfo(&compressionLevel),
          balcl::OccurrenceInfo::e_OPTIONAL}};
 
     balcl::CommandLine commandLine(specTable);
@@ -380,6 +396,14 @@ static bool parseArgs(Parameters* parameters, int argc, const char* argv[])
         return false;  // RETURN
     }
 
+    bmqt::CompressionAlgorithmType::Enum compressionAlgorithmType;
+    bmqt::CompressionAlgorithmType::fromAscii(&compressionAlgorithmType,
+                                              compressionAlgorithm);
+    parameters->setCompressionAlgorithmType(compressionAlgorithmType);
+    if (commandLine.isSpecified("compressionLevel")) {
+        parameters->setCompressionLevel(compressionLevel);
+    }
+
     // Post parsing validation
     if (!parameters->validate(&error)) {
         bsl::cerr << "Invalid parameters:\n" << error << "\n";
@@ -263,6 +263,8 @@ Parameters::Parameters(bslma::Allocator* allocator)
 , d_messageProperties(allocator)
 , d_subscriptions(allocator)
 , d_autoIncrementedField(allocator)
+, d_compressionAlgorithmType(bmqt::CompressionAlgorithmType::e_NONE)
+, d_compressionLevel()
 {
     CommandLineParameters params(allocator);
     const bool            rc = from(bsl::cerr, params);
@@ -309,6 +311,10 @@ Parameters::print(bsl::ostream& stream, int level, int spacesPerLevel) const
     printer.printAttribute("messageProperties", d_messageProperties);
     printer.printAttribute("subscriptions", d_subscriptions);
     printer.printAttribute("timeout", d_timeout);
+    printer.printForeign(d_compressionAlgorithmType,
+                         &bmqt::CompressionAlgorithmType::print,
+                         "compressionAlgorithmType");
+    printer.printAttribute("compressionLevel", d_compressionLevel);
     printer.end();
 
     return stream;
@@ -32,6 +32,7 @@
 #include <m_bmqtool_messages.h>
 
 // BDE
+#include <bdlb_nullablevalue.h>
 #include <bsl_iosfwd.h>
 #include <bsl_string.h>
 #include <bslma_allocator.h>
@@ -42,6 +43,7 @@
 #include <mqbs_filestoreprotocol.h>
 
 // BMQ
+#include <bmqt_compressionalgorithmtype.h>
 #include <bmqu_stringutil.h>
 #include <bsl_vector.h>
 
@@ -276,6 +278,13 @@ class Parameters {
 
     int d_autoPubSubModulo;
 
+    bmqt::CompressionAlgorithmType::Enum d_compressionAlgorithmType;
+    // Compression algorithm applied to the posted messages.
+
+    bdlb::NullableValue<int> d_compressionLevel;
+    // Compression level applied to the posted messages, or null to use
+    // the algorithm's default level.
+
     bsls::TimeInterval d_timeout;
     // Timeout for session operations.  This timeout is used for all timeouts
     // in the `bmqt::SessionOptions` used by the session.
@@ -317,6 +326,9 @@ class Parameters {
     Parameters& setAutoIncrementedField(const bsl::string& value);
     Parameters& setAutoPubSubModulo(int autoPubSubModulo);
     Parameters& setTimeout(const bsls::TimeInterval& value);
+    Parameters&
+    setCompressionAlgorithmType(bmqt::CompressionAlgorithmType::Enum value);
+    Parameters& setCompressionLevel(int value);
 
     // Set the corresponding member to the specified 'value' and return a
     // reference offering modifiable access to this object.
@@ -377,6 +389,8 @@ class Parameters {
     const bsl::string&                  autoIncrementedField() const;
     int                                 autoPubSubModulo() const;
     const bsls::TimeInterval&           timeout() const;
+    bmqt::CompressionAlgorithmType::Enum compressionAlgorithmType() const;
+    const bdlb::NullableValue<int>&      compressionLevel() const;
 
     const char* autoPubSubPropertyName() const;
 };
@@ -602,6 +616,19 @@ inline Parameters& Parameters::setTimeout(const bsls::TimeInterval& value)
     return *this;
 }
 
+inline Parameters& Parameters::setCompressionAlgorithmType(
+    bmqt::CompressionAlgorithmType::Enum value)
+{
+    d_compressionAlgorithmType = value;
+    return *this;
+}
+
+inline Parameters& Parameters::setCompressionLevel(int value)
+{
+    d_compressionLevel.makeValue(value);
+    return *this;
+}
+
 // ACCESSORS
 inline ParametersMode::Value Parameters::mode() const
 {
@@ -759,6 +786,17 @@ inline const bsls::TimeInterval& Parameters::timeout() const
     return d_timeout;
 }
 
+inline bmqt::CompressionAlgorithmType::Enum
+Parameters::compressionAlgorithmType() const
+{
+    return d_compressionAlgorithmType;
+}
+
+inline const bdlb::NullableValue<int>& Parameters::compressionLevel() const
+{
+    return d_compressionLevel;
+}
+
 }  // close package namespace
 
 // --------------------------
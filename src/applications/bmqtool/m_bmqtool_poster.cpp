@@ -193,6 +193,13 @@ void PostingContext::postNext()
                     autoIncrementedValue % d_parameters.autoPubSubModulo());
             }
 
+            msg.setCompressionAlgorithmType(
+                d_parameters.compressionAlgorithmType());
+            if (!d_parameters.compressionLevel().isNull()) {
+                msg.setCompressionLevel(
+                    d_parameters.compressionLevel().value());
+            }
+
             bmqt::EventBuilderResult::Enum rc = eventBuilder.packMessage(
                 d_queueId);
             if (rc != 0) {
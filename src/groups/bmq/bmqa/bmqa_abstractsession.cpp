@@ -263,6 +263,15 @@ Event AbstractSession::nextEvent(BSLA_UNUSED const bsls::TimeInterval& timeout)
     return Event();
 }
 
+void AbstractSession::nextEvents(
+    BSLA_UNUSED bsl::vector<Event>*       events,
+    BSLA_UNUSED int                       maxNumEvents,
+    BSLA_UNUSED const bsls::TimeInterval& timeout)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_OPT(false && "Method is undefined in base protocol");
+}
+
 int AbstractSession::post(BSLA_UNUSED const MessageEvent& event)
 {
     // PRECONDITIONS
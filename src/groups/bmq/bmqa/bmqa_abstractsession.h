@@ -36,6 +36,7 @@
 
 // BDE
 #include <bsl_functional.h>
+#include <bsl_vector.h>
 #include <bsls_timeinterval.h>
 #include <bsls_types.h>
 
@@ -362,6 +363,24 @@ class AbstractSession {
     virtual Event
     nextEvent(const bsls::TimeInterval& timeout = bsls::TimeInterval());
 
+    /// Load into the specified `events` up to the specified `maxNumEvents`
+    /// next available events received for this session, in the order they
+    /// were received.  If there is no event available, this method blocks
+    /// for up to the optionally specified `timeout` time interval for an
+    /// event to arrive, exactly like `nextEvent` does; once an event is
+    /// available, the events readily available after it are loaded without
+    /// waiting any further.  Any previous content of `events` is removed.
+    /// Load a single `bmqa::SessionEvent` of type
+    /// `bmqt::SessionEventType::e_TIMEOUT` if a timeout was specified and
+    /// that timeout expired before any event was received.  Note that this
+    /// method can only be used if the session is in synchronous mode (ie
+    /// not using the EventHandler).  The behavior is undefined unless the
+    /// session was started and `0 < maxNumEvents`.
+    virtual void
+    nextEvents(bsl::vector<Event>*       events,
+               int                       maxNumEvents,
+               const bsls::TimeInterval& timeout = bsls::TimeInterval());
+
     /// Asynchronously post the specified `event` that must contain one or
     /// more `Messages`.  The return value is one of the values defined in
     /// the `bmqt::PostResult::Enum` enum.  Return zero on success and a
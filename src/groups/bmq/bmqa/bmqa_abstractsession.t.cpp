@@ -17,6 +17,7 @@
 #include <bmqa_abstractsession.h>
 
 // BDE
+#include <bsl_vector.h>
 #include <bsls_platform.h>
 #include <bsls_protocoltest.h>
 
@@ -209,6 +210,14 @@ struct AbstractSessionTestImp : bsls::ProtocolTestImp<bmqa::AbstractSession> {
         return markDone();
     }
 
+    void nextEvents(bsl::vector<bmqa::Event>* events,
+                    int                       maxNumEvents,
+                    const bsls::TimeInterval& timeout = bsls::TimeInterval())
+        BSLS_KEYWORD_OVERRIDE
+    {
+        markDone();
+    }
+
     int post(const bmqa::MessageEvent& event) BSLS_KEYWORD_OVERRIDE
     {
         return markDone();
@@ -327,6 +336,7 @@ static void test1_breathingTest()
     bmqt::QueueOptions              dummyQueueOptions;
     bmqt::Uri                       dummyUri;
     bsls::TimeInterval              dummyTimeInterval(0);
+    bsl::vector<bmqa::Event> dummyEvents(bmqtst::TestHelperUtil::allocator());
 
     bmqa::OpenQueueStatus openQueueResult(bmqtst::TestHelperUtil::allocator());
     bmqa::ConfigureQueueStatus configureQueueResult(
@@ -408,6 +418,8 @@ static void test1_breathingTest()
                                              closeQueueCallback,
                                              dummyTimeInterval));
     BSLS_PROTOCOLTEST_ASSERT(testObj, nextEvent(dummyTimeInterval));
+    BSLS_PROTOCOLTEST_ASSERT(testObj,
+                             nextEvents(&dummyEvents, 1, dummyTimeInterval));
     BSLS_PROTOCOLTEST_ASSERT(testObj, post(dummyMessageEvent));
     BSLS_PROTOCOLTEST_ASSERT(testObj, confirmMessage(dummyMessage));
     BSLS_PROTOCOLTEST_ASSERT(testObj,
@@ -469,6 +481,7 @@ static void test2_instanceInvariants()
     bmqt::QueueOptions              dummyQueueOptions;
     bmqt::Uri dummyUri(bmqtst::TestHelperUtil::allocator());
     bsls::TimeInterval              dummyTimeInterval(0);
+    bsl::vector<bmqa::Event> dummyEvents(bmqtst::TestHelperUtil::allocator());
 
     bmqa::OpenQueueStatus openQueueResult(bmqtst::TestHelperUtil::allocator());
     bmqa::ConfigureQueueStatus configureQueueResult(
@@ -540,6 +553,8 @@ static void test2_instanceInvariants()
                                                        closeQueueCallback,
                                                        dummyTimeInterval));
     BMQTST_ASSERT_OPT_FAIL(concreteObj.nextEvent(dummyTimeInterval));
+    BMQTST_ASSERT_OPT_FAIL(
+        concreteObj.nextEvents(&dummyEvents, 1, dummyTimeInterval));
     BMQTST_ASSERT_OPT_FAIL(concreteObj.post(dummyMessageEvent));
     BMQTST_ASSERT_OPT_FAIL(concreteObj.confirmMessage(dummyMessage));
     BMQTST_ASSERT_OPT_FAIL(
@@ -607,6 +622,8 @@ static void test2_instanceInvariants()
                                                    closeQueueCallback,
                                                    dummyTimeInterval));
     BMQTST_ASSERT_OPT_FAIL(testObj.nextEvent(dummyTimeInterval));
+    BMQTST_ASSERT_OPT_FAIL(
+        testObj.nextEvents(&dummyEvents, 1, dummyTimeInterval));
     BMQTST_ASSERT_OPT_FAIL(testObj.post(dummyMessageEvent));
     BMQTST_ASSERT_OPT_FAIL(testObj.confirmMessage(dummyMessage));
     BMQTST_ASSERT_OPT_FAIL(
@@ -178,6 +178,21 @@ Message& Message::setCompressionAlgorithmType(
     return *this;
 }
 
+Message& Message::setCompressionLevel(int value)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(isInitialized() &&
+                     "message is invalid: use "
+                     "'MessageEventBuilder::startMessage' to get one");
+    BSLS_ASSERT_SAFE(d_impl.d_event_p->putEventBuilder() &&
+                     "message not editable");
+
+    bmqp::PutEventBuilder* builder = d_impl.d_event_p->putEventBuilder();
+    builder->setCompressionLevel(value);
+
+    return *this;
+}
+
 #ifdef BMQ_ENABLE_MSG_GROUPID
 Message& Message::setGroupId(const bsl::string& groupId)
 {
@@ -433,6 +448,45 @@ int Message::getData(bdlbb::Blob* blob) const
     }
 }
 
+int Message::loadDataView(MessageDataView* view) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(isInitialized());
+    BSLS_ASSERT_SAFE(view);
+
+    const bmqp::Event& rawEvent = d_impl.d_event_p->rawEvent();
+    const bdlbb::Blob* blob     = 0;
+    bmqu::BlobPosition position;
+    int                rc       = 0;
+    int                length   = 0;
+
+    if (rawEvent.isPushEvent()) {
+        const bmqp::PushMessageIterator* it =
+            d_impl.d_event_p->pushMessageIterator();
+        rc     = it->loadMessagePayloadView(&blob, &position);
+        length = it->messagePayloadSize();
+    }
+    else if (rawEvent.isPutEvent()) {
+        const bmqp::PutMessageIterator* it =
+            d_impl.d_event_p->putMessageIterator();
+        rc     = it->loadMessagePayloadView(&blob, &position);
+        length = it->messagePayloadSize();
+    }
+    else {
+        BSLS_ASSERT_OPT(false && "Invalid raw event type");
+        return -1;  // Compiler Happiness                              //
+                    // RETURN
+    }
+
+    if (rc != 0) {
+        view->reset();
+        return rc;  // RETURN
+    }
+
+    view->reset(blob, position.buffer(), position.byte(), length);
+    return 0;
+}
+
 int Message::dataSize() const
 {
     // PRECONDITIONS
@@ -59,6 +59,7 @@
 
 // BMQ
 
+#include <bmqa_messagedataview.h>
 #include <bmqa_queueid.h>
 #include <bmqt_compressionalgorithmtype.h>
 #include <bmqt_correlationid.h>
@@ -270,6 +271,14 @@ class Message {
     Message&
     setCompressionAlgorithmType(bmqt::CompressionAlgorithmType::Enum value);
 
+    /// Set the compression level of the current message to the specified
+    /// `value` and return a reference offering modifiable access to this
+    /// object.  The meaning of `value` is specific to the compression
+    /// algorithm (e.g., 1-9 for ZLIB, 1-22 for ZSTD, 0-12 for LZ4); if this
+    /// method is not invoked, the algorithm's default level is used.  The
+    /// behavior is undefined unless this message is editable.
+    Message& setCompressionLevel(int value);
+
 #ifdef BMQ_ENABLE_MSG_GROUPID
     /// Set Group Id of this message to the specified `groupId`.  The
     /// `groupId` must be a null-terminated string with up to
@@ -364,6 +373,16 @@ class Message {
     /// of invoking this method multiple times on a message.
     int getData(bdlbb::Blob* blob) const;
 
+    /// Load into the specified `view` a read-only view of the payload of
+    /// the message, if any.  Return zero if the message has a payload and
+    /// non-zero value otherwise.  The behaviour is undefined unless this
+    /// instance represents a `PUT` or `PUSH` message.  Unlike `getData`,
+    /// this method neither copies nor allocates, which makes it suitable for
+    /// consuming large payloads; note however that `view` is valid only as
+    /// long as this message does not change (see
+    /// @bbref{bmqa::MessageDataView}).
+    int loadDataView(MessageDataView* view) const;
+
     /// Return the number of bytes in the payload.  The behaviour is
     /// undefined unless this instance represents a `PUT` or a `PUSH`
     /// message.  Note that for efficiency, application should fetch payload
@@ -19,6 +19,11 @@
 // TEST DRIVER
 #include <bmqtst_testhelper.h>
 
+// BENCHMARKING LIBRARY
+#ifdef BMQTST_BENCHMARK_ENABLED
+#include <benchmark/benchmark.h>
+#endif
+
 // BDE
 #include <bdlbb_blob.h>
 #include <bdlbb_blobutil.h>
@@ -41,6 +46,7 @@
 #include <bmqt_subscription.h>
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
+#include <bsl_string.h>
 
 // CONVENIENCE
 using namespace BloombergLP;
@@ -77,6 +83,87 @@ void generateSubQueueInfos(bmqp::Protocol::SubQueueInfosArray* subQueueInfos,
         subQueueInfos->push_back(bmqp::SubQueueInfo(subQueueId));
     }
 }
+
+/// Return a payload of the specified `size` bytes.
+bsl::string generatePayload(int size)
+{
+    bsl::string payload(bmqtst::TestHelperUtil::allocator());
+    payload.reserve(size);
+
+    for (int i = 0; i < size; ++i) {
+        payload.push_back(static_cast<char>('a' + i % 26));
+    }
+
+    return payload;
+}
+
+/// Mechanism holding a `bmqa::Event` of a single PUSH message having a
+/// specified payload.
+class PushEventHolder {
+  private:
+    // PRIVATE TYPES
+    typedef bsl::shared_ptr<bmqimp::Event> EventImplSp;
+
+    // DATA
+    bdlbb::PooledBlobBufferFactory   d_bufferFactory;
+    bmqp::BlobPoolUtil::BlobSpPoolSp d_blobSpPool;
+    bsl::shared_ptr<bdlbb::Blob>     d_blob_sp;
+    bmqa::Event                      d_event;
+
+  public:
+    // CREATORS
+
+    /// Create a PUSH event having a single message with the specified
+    /// `payload`, using blob buffers of the specified `bufferSize`.
+    PushEventHolder(const bsl::string& payload, int bufferSize)
+    : d_bufferFactory(bufferSize, bmqtst::TestHelperUtil::allocator())
+    , d_blobSpPool(bmqp::BlobPoolUtil::createBlobPool(
+          &d_bufferFactory,
+          bmqtst::TestHelperUtil::allocator()))
+    , d_blob_sp()
+    , d_event()
+    {
+        bdlbb::Blob payloadBlob(&d_bufferFactory,
+                                bmqtst::TestHelperUtil::allocator());
+        bdlbb::BlobUtil::append(&payloadBlob,
+                                payload.data(),
+                                static_cast<int>(payload.length()));
+
+        bmqp::PushEventBuilder peb(d_blobSpPool.get(),
+                                   bmqtst::TestHelperUtil::allocator());
+        BSLA_MAYBE_UNUSED const bmqt::EventBuilderResult::Enum rc =
+            peb.packMessage(payloadBlob,
+                            1,  // queueId
+                            bmqt::MessageGUID(),
+                            0,  // flags
+                            bmqt::CompressionAlgorithmType::e_NONE);
+        BSLS_ASSERT_OPT(rc == bmqt::EventBuilderResult::e_SUCCESS);
+        d_blob_sp = peb.blob();
+
+        EventImplSp& implPtr = reinterpret_cast<EventImplSp&>(d_event);
+        implPtr              = bsl::make_shared<bmqimp::Event>(
+            &d_bufferFactory,
+            bmqtst::TestHelperUtil::allocator());
+
+        bmqp::Event bmqpEvent(d_blob_sp.get(),
+                              bmqtst::TestHelperUtil::allocator());
+        implPtr->configureAsMessageEvent(bmqpEvent);
+        implPtr->addContext(bmqt::CorrelationId());
+    }
+
+    // MANIPULATORS
+
+    /// Return the message of the event, iterating the event from its start.
+    bmqa::Message message()
+    {
+        bmqa::MessageIterator mIter = d_event.messageEvent().messageIterator();
+        BSLA_MAYBE_UNUSED const bool hasMessage = mIter.nextMessage();
+        BSLS_ASSERT_OPT(hasMessage);
+
+        return mIter.message();
+    }
+};
+
 }
 
 // ============================================================================
@@ -638,6 +725,133 @@ static void test4_subscriptionHandle()
     }
 }
 
+static void test5_loadDataView()
+// ------------------------------------------------------------------------
+// LOAD DATA VIEW
+//
+// Concerns:
+//   1. The view of the payload of a PUSH message references the same
+//      bytes as the blob loaded by 'getData'.
+//   2. A small payload is viewed as a single contiguous segment, and a
+//      payload larger than a buffer as multiple segments.
+//
+// Testing:
+//   int loadDataView(MessageDataView* view) const;
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+    // Can't ensure no default memory is allocated because a default
+    // QueueId is instantiated and that uses the default allocator to
+    // allocate memory for an automatically generated CorrelationId.
+
+    bmqtst::TestHelper::printTestName("LOAD DATA VIEW");
+
+    const int k_BUFFER_SIZE = 4 * 1024;
+
+    const int k_PAYLOAD_SIZES[] = {26, 10 * k_BUFFER_SIZE + 3};
+
+    for (size_t i = 0; i < sizeof(k_PAYLOAD_SIZES) / sizeof(*k_PAYLOAD_SIZES);
+         ++i) {
+        const bsl::string payload = generatePayload(k_PAYLOAD_SIZES[i]);
+
+        PV("Payload size: " << payload.length());
+
+        PushEventHolder holder(payload, k_BUFFER_SIZE);
+        bmqa::Message   message = holder.message();
+
+        bmqa::MessageDataView view;
+        BMQTST_ASSERT_EQ_D(i, message.loadDataView(&view), 0);
+        BMQTST_ASSERT_EQ_D(i, view.length(), message.dataSize());
+        BMQTST_ASSERT_EQ_D(i,
+                           view.isContiguous(),
+                           payload.length() < k_BUFFER_SIZE);
+
+        bsl::string viewed(bmqtst::TestHelperUtil::allocator());
+        for (int j = 0; j < view.numSegments(); ++j) {
+            const bsl::string_view segment = view.segment(j);
+            viewed.append(segment.data(), segment.length());
+        }
+        BMQTST_ASSERT_EQ_D(i, viewed, payload);
+
+        bdlbb::Blob data(bmqtst::TestHelperUtil::allocator());
+        BMQTST_ASSERT_EQ_D(i, message.getData(&data), 0);
+        BMQTST_ASSERT_EQ_D(i, view.length(), data.length());
+    }
+}
+
+// ============================================================================
+//                              PERFORMANCE TESTS
+// ----------------------------------------------------------------------------
+
+#ifdef BMQTST_BENCHMARK_ENABLED
+static void testN1_getData_GoogleBenchmark(benchmark::State& state)
+{
+    // Access the whole payload of 'state.range(0)' bytes of a PUSH message
+    // loading it with 'getData'.
+
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+
+    const int         payloadSize = static_cast<int>(state.range(0));
+    const bsl::string payload     = generatePayload(payloadSize);
+
+    PushEventHolder holder(payload, 4 * 1024);
+    bdlbb::Blob     data(bmqtst::TestHelperUtil::allocator());
+
+    // <time>
+    for (auto _ : state) {
+        bmqa::Message message = holder.message();
+
+        data.removeAll();
+        message.getData(&data);
+        for (int i = 0; i < data.numDataBuffers(); ++i) {
+            benchmark::DoNotOptimize(data.buffer(i).data());
+        }
+    }
+    // </time>
+
+    state.SetBytesProcessed(state.iterations() * payloadSize);
+}
+
+static void testN2_loadDataView_GoogleBenchmark(benchmark::State& state)
+{
+    // The same as 'testN1_getData' accessing the payload with
+    // 'loadDataView'.
+
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+
+    const int         payloadSize = static_cast<int>(state.range(0));
+    const bsl::string payload     = generatePayload(payloadSize);
+
+    PushEventHolder       holder(payload, 4 * 1024);
+    bmqa::MessageDataView view;
+
+    // <time>
+    for (auto _ : state) {
+        bmqa::Message message = holder.message();
+
+        message.loadDataView(&view);
+        for (int i = 0; i < view.numSegments(); ++i) {
+            benchmark::DoNotOptimize(view.segment(i).data());
+        }
+    }
+    // </time>
+
+    state.SetBytesProcessed(state.iterations() * payloadSize);
+}
+#else
+static void testN1_getData()
+{
+    bmqtst::TestHelper::printTestName("GOOGLE BENCHMARK: getData");
+    PV("GoogleBenchmark is not supported on this platform, skipping...")
+}
+
+static void testN2_loadDataView()
+{
+    bmqtst::TestHelper::printTestName("GOOGLE BENCHMARK: loadDataView");
+    PV("GoogleBenchmark is not supported on this platform, skipping...")
+}
+#endif
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -652,11 +866,32 @@ int main(int argc, char* argv[])
     case 2: test2_validPushMessagePrint(); break;
     case 3: test3_messageProperties(); break;
     case 4: test4_subscriptionHandle(); break;
+    case 5: test5_loadDataView(); break;
+    case -1:
+        BMQTST_BENCHMARK_WITH_ARGS(testN1_getData,
+                                   Arg(1024 * 1024)
+                                       ->Arg(10 * 1024 * 1024)
+                                       ->Unit(benchmark::kMicrosecond));
+        break;
+    case -2:
+        BMQTST_BENCHMARK_WITH_ARGS(testN2_loadDataView,
+                                   Arg(1024 * 1024)
+                                       ->Arg(10 * 1024 * 1024)
+                                       ->Unit(benchmark::kMicrosecond));
+        break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         bmqtst::TestHelperUtil::testStatus() = -1;
     } break;
     }
+
+#ifdef BMQTST_BENCHMARK_ENABLED
+    if (_testCase < 0) {
+        benchmark::Initialize(&argc, argv);
+        benchmark::RunSpecifiedBenchmarks();
+    }
+#endif
+
     bmqp::ProtocolUtil::shutdown();
 
     TEST_EPILOG(bmqtst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
@@ -0,0 +1,81 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// bmqa_messagedataview.cpp                                           -*-C++-*-
+#include <bmqa_messagedataview.h>
+
+#include <bmqscm_version.h>
+
+// BMQ
+#include <bmqu_blob.h>
+
+// BDE
+#include <bsl_algorithm.h>
+
+namespace BloombergLP {
+namespace bmqa {
+
+// ---------------------
+// class MessageDataView
+// ---------------------
+
+// MANIPULATORS
+void MessageDataView::reset(const bdlbb::Blob* blob,
+                            int                bufferIndex,
+                            int                byte,
+                            int                length)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(blob);
+    BSLS_ASSERT_SAFE(0 <= bufferIndex);
+    BSLS_ASSERT_SAFE(0 <= byte);
+    BSLS_ASSERT_SAFE(0 <= length);
+
+    d_blob_p            = blob;
+    d_bufferIndex       = bufferIndex;
+    d_byte              = byte;
+    d_length            = length;
+    d_numSegments       = 0;
+    d_lastSegmentLength = 0;
+
+    if (length == 0) {
+        return;  // RETURN
+    }
+
+    // Skip the buffers ending before the first byte, so that the first
+    // segment is not empty.
+    while (d_byte >= bmqu::BlobUtil::bufferSize(*blob, d_bufferIndex)) {
+        d_byte -= bmqu::BlobUtil::bufferSize(*blob, d_bufferIndex);
+        ++d_bufferIndex;
+
+        BSLS_ASSERT_SAFE(d_bufferIndex < blob->numDataBuffers());
+    }
+
+    int remaining = length;
+    int start     = d_byte;
+    for (int index = d_bufferIndex; remaining > 0; ++index) {
+        BSLS_ASSERT_SAFE(index < blob->numDataBuffers());
+
+        d_lastSegmentLength = bsl::min(
+            bmqu::BlobUtil::bufferSize(*blob, index) - start,
+            remaining);
+        remaining -= d_lastSegmentLength;
+        start = 0;
+        ++d_numSegments;
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
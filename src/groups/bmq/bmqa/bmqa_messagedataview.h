@@ -0,0 +1,205 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// bmqa_messagedataview.h                                             -*-C++-*-
+#ifndef INCLUDED_BMQA_MESSAGEDATAVIEW
+#define INCLUDED_BMQA_MESSAGEDATAVIEW
+
+/// @file bmqa_messagedataview.h
+///
+/// @brief Provide a read-only view over the payload of a message.
+///
+/// @bbref{bmqa::MessageDataView} references the payload of a
+/// @bbref{bmqa::Message} in place, in the buffers of the event it belongs to,
+/// without copying it and without allocating memory.  The payload is exposed
+/// as a sequence of contiguous segments, one per underlying buffer.  A payload
+/// held by a single buffer (see `isContiguous`) can be accessed at once using
+/// `data`.
+///
+/// A view is loaded by @bbref{bmqa::Message::loadDataView}, and remains valid
+/// only as long as the message it was loaded from does not change: that is,
+/// until the next call to `nextMessage` on the iterator the message was
+/// obtained from, or until the event holding the message is destroyed.
+/// Applications needing the payload longer than that should use
+/// @bbref{bmqa::Message::getData} instead.
+///
+/// Usage                                        {#bmqa_messagedataview_usage}
+/// =====
+///
+/// ```
+/// bmqa::MessageDataView view;
+/// if (message.loadDataView(&view) == 0) {
+///     for (int i = 0; i < view.numSegments(); ++i) {
+///         const bsl::string_view segment = view.segment(i);
+///         process(segment.data(), segment.length());
+///     }
+/// }
+/// ```
+
+// BDE
+#include <bdlbb_blob.h>
+#include <bsl_string_view.h>
+#include <bsls_assert.h>
+
+namespace BloombergLP {
+namespace bmqa {
+
+// =====================
+// class MessageDataView
+// =====================
+
+/// Read-only view over a section of a blob holding the payload of a message.
+class MessageDataView {
+  private:
+    // DATA
+
+    /// Blob holding the payload, or 0 if this view is empty.
+    const bdlbb::Blob* d_blob_p;
+
+    /// Index in `d_blob_p` of the buffer holding the first byte.
+    int d_bufferIndex;
+
+    /// Offset of the first byte in the buffer at `d_bufferIndex`.
+    int d_byte;
+
+    /// Number of bytes in the view.
+    int d_length;
+
+    /// Number of buffers spanned by the view.
+    int d_numSegments;
+
+    /// Number of bytes of the view in its last buffer.
+    int d_lastSegmentLength;
+
+  public:
+    // CREATORS
+
+    /// Create an empty view.
+    MessageDataView();
+
+    // MANIPULATORS
+
+    /// Make this view reference the specified `length` bytes of the
+    /// specified `blob` starting at the specified `byte` of the buffer at
+    /// the specified `bufferIndex`.  The behavior is undefined unless the
+    /// referenced section lies within the data of `blob`, and `blob`
+    /// outlives the use of this view.
+    void reset(const bdlbb::Blob* blob, int bufferIndex, int byte, int length);
+
+    /// Make this view empty.
+    void reset();
+
+    // ACCESSORS
+
+    /// Return the number of bytes in this view.
+    int length() const;
+
+    /// Return the number of contiguous segments of this view, which is zero
+    /// if this view is empty.
+    int numSegments() const;
+
+    /// Return `true` if the bytes of this view are contiguous in memory,
+    /// that is if this view has at most one segment, and `false` otherwise.
+    bool isContiguous() const;
+
+    /// Return the bytes of this view.  The behavior is undefined unless
+    /// `isContiguous()` returns `true`.
+    bsl::string_view data() const;
+
+    /// Return the bytes of the segment at the specified `index` of this
+    /// view.  The behavior is undefined unless `0 <= index` and
+    /// `index < numSegments()`.
+    bsl::string_view segment(int index) const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// ---------------------
+// class MessageDataView
+// ---------------------
+
+// CREATORS
+inline MessageDataView::MessageDataView()
+: d_blob_p(0)
+, d_bufferIndex(0)
+, d_byte(0)
+, d_length(0)
+, d_numSegments(0)
+, d_lastSegmentLength(0)
+{
+    // NOTHING
+}
+
+// MANIPULATORS
+inline void MessageDataView::reset()
+{
+    d_blob_p            = 0;
+    d_bufferIndex       = 0;
+    d_byte              = 0;
+    d_length            = 0;
+    d_numSegments       = 0;
+    d_lastSegmentLength = 0;
+}
+
+// ACCESSORS
+inline int MessageDataView::length() const
+{
+    return d_length;
+}
+
+inline int MessageDataView::numSegments() const
+{
+    return d_numSegments;
+}
+
+inline bool MessageDataView::isContiguous() const
+{
+    return d_numSegments <= 1;
+}
+
+inline bsl::string_view MessageDataView::data() const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(isContiguous());
+
+    if (d_numSegments == 0) {
+        return bsl::string_view();  // RETURN
+    }
+
+    return segment(0);
+}
+
+inline bsl::string_view MessageDataView::segment(int index) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 <= index && index < d_numSegments);
+
+    const bdlbb::BlobBuffer& buffer = d_blob_p->buffer(d_bufferIndex +
+                                                       index);
+    const int                start  = index == 0 ? d_byte : 0;
+
+    // All segments but the last one span their buffer up to its end.
+    const int length = index == d_numSegments - 1 ? d_lastSegmentLength
+                                                  : buffer.size() - start;
+
+    return bsl::string_view(buffer.data() + start, length);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
@@ -0,0 +1,180 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// bmqa_messagedataview.t.cpp                                         -*-C++-*-
+#include <bmqa_messagedataview.h>
+
+// BDE
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+#include <bdlbb_pooledblobbufferfactory.h>
+#include <bsl_cstring.h>
+#include <bsl_string.h>
+
+// TEST DRIVER
+#include <bmqtst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+namespace {
+
+/// Return the concatenation of all the segments of the specified `view`.
+bsl::string concatenate(const bmqa::MessageDataView& view)
+{
+    bsl::string result(bmqtst::TestHelperUtil::allocator());
+
+    for (int i = 0; i < view.numSegments(); ++i) {
+        const bsl::string_view segment = view.segment(i);
+        result.append(segment.data(), segment.length());
+    }
+
+    return result;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   Exercise basic functionality before beginning testing in earnest.
+//
+// Testing:
+//   MessageDataView();
+//   reset(const bdlbb::Blob*, int, int, int);
+//   reset();
+//   length();
+//   numSegments();
+//   isContiguous();
+//   data();
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("BREATHING TEST");
+
+    const char* k_DATA = "abcdefghijklmnopqrstuvwxyz";
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(
+        1024,
+        bmqtst::TestHelperUtil::allocator());
+    bdlbb::Blob blob(&bufferFactory, bmqtst::TestHelperUtil::allocator());
+    bdlbb::BlobUtil::append(&blob, k_DATA, bsl::strlen(k_DATA));
+
+    bmqa::MessageDataView view;
+    BMQTST_ASSERT_EQ(view.length(), 0);
+    BMQTST_ASSERT_EQ(view.numSegments(), 0);
+    BMQTST_ASSERT(view.isContiguous());
+    BMQTST_ASSERT(view.data().empty());
+
+    view.reset(&blob, 0, 3, 5);
+    BMQTST_ASSERT_EQ(view.length(), 5);
+    BMQTST_ASSERT_EQ(view.numSegments(), 1);
+    BMQTST_ASSERT(view.isContiguous());
+    BMQTST_ASSERT_EQ(view.data(), "defgh");
+    BMQTST_ASSERT_EQ(view.data().data(), blob.buffer(0).data() + 3);
+
+    view.reset();
+    BMQTST_ASSERT_EQ(view.length(), 0);
+    BMQTST_ASSERT_EQ(view.numSegments(), 0);
+}
+
+static void test2_segments()
+// ------------------------------------------------------------------------
+// SEGMENTS
+//
+// Concerns:
+//   1. A view spanning several buffers exposes one segment per buffer,
+//      referencing the bytes of the buffers in place.
+//   2. A view starting at the end of a buffer does not have an empty
+//      first segment.
+//   3. A view ending in the middle of the last data buffer ends at the
+//      end of the view, and not at the end of the buffer.
+//
+// Testing:
+//   segment(int);
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("SEGMENTS");
+
+    const char* k_DATA = "abcdefghijklmnopqrstuvwxyz";
+
+    // Buffers of 8 bytes: "abcdefgh", "ijklmnop", "qrstuvwx", "yz"
+    bdlbb::PooledBlobBufferFactory bufferFactory(
+        8,
+        bmqtst::TestHelperUtil::allocator());
+    bdlbb::Blob blob(&bufferFactory, bmqtst::TestHelperUtil::allocator());
+    bdlbb::BlobUtil::append(&blob, k_DATA, bsl::strlen(k_DATA));
+    BMQTST_ASSERT_EQ(blob.numDataBuffers(), 4);
+
+    bmqa::MessageDataView view;
+
+    PV("Spanning several buffers");
+    view.reset(&blob, 0, 3, 14);
+    BMQTST_ASSERT_EQ(view.length(), 14);
+    BMQTST_ASSERT_EQ(view.numSegments(), 3);
+    BMQTST_ASSERT(!view.isContiguous());
+    BMQTST_ASSERT_EQ(view.segment(0), "defgh");
+    BMQTST_ASSERT_EQ(view.segment(1), "ijklmnop");
+    BMQTST_ASSERT_EQ(view.segment(2), "q");
+    BMQTST_ASSERT_EQ(view.segment(1).data(), blob.buffer(1).data());
+    BMQTST_ASSERT_EQ(concatenate(view), "defghijklmnopq");
+
+    PV("Starting at the end of a buffer");
+    view.reset(&blob, 0, 8, 8);
+    BMQTST_ASSERT_EQ(view.numSegments(), 1);
+    BMQTST_ASSERT(view.isContiguous());
+    BMQTST_ASSERT_EQ(view.data(), "ijklmnop");
+
+    PV("Ending in the last data buffer");
+    view.reset(&blob, 2, 4, 6);
+    BMQTST_ASSERT_EQ(view.numSegments(), 2);
+    BMQTST_ASSERT_EQ(view.segment(0), "uvwx");
+    BMQTST_ASSERT_EQ(view.segment(1), "yz");
+
+    PV("Whole blob");
+    view.reset(&blob, 0, 0, blob.length());
+    BMQTST_ASSERT_EQ(view.numSegments(), 4);
+    BMQTST_ASSERT_EQ(concatenate(view), k_DATA);
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(bmqtst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 2: test2_segments(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        bmqtst::TestHelperUtil::testStatus() = -1;
+    } break;
+    }
+
+    TEST_EPILOG(bmqtst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
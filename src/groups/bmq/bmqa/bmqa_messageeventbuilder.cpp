@@ -144,6 +144,10 @@ MessageEventBuilder::packMessage(const bmqa::QueueId& queueId)
     d_impl.d_guidGenerator_sp->generateGUID(&guid);
     builder->setMessageGUID(guid);
 
+    // Compress with the dictionary of the domain, if the broker advertised
+    // one.  Only used with 'bmqt::CompressionAlgorithmType::e_ZSTD'.
+    builder->setCompressionDictionary(queueSpRef->compressionDictionary());
+
     if (queueSpRef->isOldStyle()) {
         // Temporary; shall remove after 2nd roll out of "new style" brokers.
         rc = builder->packMessageInOldStyle(queueSpRef->id());
@@ -427,6 +427,7 @@ MockSession::Call::Call(Method method, bslma::Allocator* allocator)
 , d_flags(0)
 , d_queueOptions(allocator)
 , d_timeout()
+, d_maxNumEvents(0)
 , d_openQueueCallback(bsl::allocator_arg, allocator)
 , d_configureQueueCallback(bsl::allocator_arg, allocator)
 , d_closeQueueCallback(bsl::allocator_arg, allocator)
@@ -435,6 +436,7 @@ MockSession::Call::Call(Method method, bslma::Allocator* allocator)
 , d_closeQueueResult(allocator)
 , d_emittedEvents(allocator)
 , d_returnEvent()
+, d_returnEvents(allocator)
 , d_messageEvent()
 , d_cookie()
 , d_allocator_p(allocator)
@@ -451,6 +453,7 @@ MockSession::Call::Call(const Call& other, bslma::Allocator* allocator)
 , d_flags(other.d_flags)
 , d_queueOptions(other.d_queueOptions, allocator)
 , d_timeout(other.d_timeout)
+, d_maxNumEvents(other.d_maxNumEvents)
 , d_openQueueCallback(bsl::allocator_arg, allocator, other.d_openQueueCallback)
 , d_configureQueueCallback(bsl::allocator_arg,
                            allocator,
@@ -463,6 +466,7 @@ MockSession::Call::Call(const Call& other, bslma::Allocator* allocator)
 , d_closeQueueResult(other.d_closeQueueResult, allocator)
 , d_emittedEvents(other.d_emittedEvents, allocator)
 , d_returnEvent(other.d_returnEvent)
+, d_returnEvents(other.d_returnEvents, allocator)
 , d_messageEvent(other.d_messageEvent)
 , d_cookie(other.d_cookie)
 , d_allocator_p(allocator)
@@ -519,6 +523,15 @@ MockSession::Call& MockSession::Call::returning(const Event& event)
     return *this;
 }
 
+MockSession::Call&
+MockSession::Call::returning(const bsl::vector<Event>& events)
+{
+    BSLS_ASSERT_SAFE(d_method == e_NEXT_EVENTS);
+
+    d_returnEvents = events;
+    return *this;
+}
+
 MockSession::Call& MockSession::Call::emitting(const Event& event)
 {
     EventOrJob eventOrJob(event, d_allocator_p);
@@ -726,6 +739,10 @@ const char* MockSession::toAscii(const Method method)
                "const bsls::TimeInterval&  timeout)";
     case e_NEXT_EVENT:
         return "Event nextEvent(const bsls::TimeInterval& timeout)";
+    case e_NEXT_EVENTS:
+        return "void nextEvents(bsl::vector<Event>        *events,"
+               "int                        maxNumEvents,"
+               "const bsls::TimeInterval&  timeout)";
     case e_POST: return "int post(const MessageEvent& messageEvent)";
     case e_CONFIRM_MESSAGE:
         return "int confirmMessage(const MessageConfirmationCookie& cookie)";
@@ -1319,6 +1336,20 @@ MockSession::expect_nextEvent(const bsls::TimeInterval& timeout)
     return call;
 }
 
+MockSession::Call&
+MockSession::expect_nextEvents(int                       maxNumEvents,
+                               const bsls::TimeInterval& timeout)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCKED
+
+    d_calls.emplace_back(e_NEXT_EVENTS);
+    Call& call          = d_calls.back();
+    call.d_maxNumEvents = maxNumEvents;
+    call.d_timeout      = timeout;
+
+    return call;
+}
+
 MockSession::Call& MockSession::expect_post(const MessageEvent& messageEvent)
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCKED
@@ -2056,6 +2087,47 @@ Event MockSession::nextEvent(const bsls::TimeInterval& timeout)
     return event;
 }
 
+void MockSession::nextEvents(bsl::vector<Event>*       events,
+                             int                       maxNumEvents,
+                             const bsls::TimeInterval& timeout)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCKED
+
+    // PRECONDITIONS
+    BSLS_ASSERT_OPT(events);
+    BSLS_ASSERT_OPT(0 < maxNumEvents);
+
+    events->clear();
+
+    BMQA_CHECK_CALL(e_NEXT_EVENTS, { return; });
+    BSLS_ASSERT_OPT(call.d_emittedEvents.empty() &&
+                    "'nextEvents' cannot emit events");
+
+    BMQA_CHECK_ARG(e_NEXT_EVENTS,
+                   "maxNumEvents",
+                   call.d_maxNumEvents,
+                   maxNumEvents,
+                   call);
+    BMQA_CHECK_ARG(e_NEXT_EVENTS, "timeout", call.d_timeout, timeout, call);
+    BSLS_ASSERT_OPT(static_cast<int>(call.d_returnEvents.size()) <=
+                        maxNumEvents &&
+                    "'nextEvents' cannot return more than 'maxNumEvents'");
+
+    events->assign(call.d_returnEvents.begin(), call.d_returnEvents.end());
+    for (bsl::vector<Event>::iterator it = events->begin();
+         it != events->end();
+         ++it) {
+        if (it->isSessionEvent()) {
+            processIfQueueEvent(&(*it));
+        }
+        else if (it->isMessageEvent()) {
+            processIfPushEvent(*it);
+        }
+    }
+
+    BMQA_ASSERT_AND_POP_FRONT();
+}
+
 int MockSession::post(const MessageEvent& messageEvent)
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCKED
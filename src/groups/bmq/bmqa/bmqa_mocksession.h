@@ -888,6 +888,7 @@ class MockSession : public AbstractSession {
         e_CONFIGURE_QUEUE_ASYNC,
         e_CONFIGURE_QUEUE_ASYNC_CALLBACK,
         e_NEXT_EVENT,
+        e_NEXT_EVENTS,
         e_POST,
         e_CONFIRM_MESSAGE,
         e_CONFIRM_MESSAGES
@@ -925,6 +926,9 @@ class MockSession : public AbstractSession {
         /// Timeout interval associated with this call
         bsls::TimeInterval d_timeout;
 
+        /// Maximum number of events associated with this call
+        int d_maxNumEvents;
+
         /// Callback to be invoked upon emission of an async openQueue (if
         /// callback was provided)
         OpenQueueCallback d_openQueueCallback;
@@ -952,6 +956,9 @@ class MockSession : public AbstractSession {
         /// Event to be returned on this call
         Event d_returnEvent;
 
+        /// Events to be returned on this call, if it retrieves several
+        bsl::vector<Event> d_returnEvents;
+
         /// MessageEvent associated with this call
         MessageEvent d_messageEvent;
 
@@ -1003,6 +1010,11 @@ class MockSession : public AbstractSession {
         /// specified `event`.
         Call& returning(const Event& event);
 
+        /// Specify the events loaded by this function call to be the
+        /// specified `events`.  The behavior is undefined unless this call
+        /// corresponds to `nextEvents`.
+        Call& returning(const bsl::vector<Event>& events);
+
         /// Specify the specified `event` to be emitted on this function
         /// call.
         Call& emitting(const Event& event);
@@ -1256,6 +1268,9 @@ class MockSession : public AbstractSession {
 
     Call&
     expect_nextEvent(const bsls::TimeInterval& timeout = bsls::TimeInterval());
+    Call& expect_nextEvents(
+        int                       maxNumEvents,
+        const bsls::TimeInterval& timeout = bsls::TimeInterval());
     Call& expect_post(const MessageEvent& messageEvent);
     Call& expect_confirmMessage(const Message& message);
     Call& expect_confirmMessage(const MessageConfirmationCookie& cookie);
@@ -1467,6 +1482,18 @@ class MockSession : public AbstractSession {
     Event nextEvent(const bsls::TimeInterval& timeout = bsls::TimeInterval())
         BSLS_KEYWORD_OVERRIDE;
 
+    /// Load into the specified `events` the events to be returned by the
+    /// expected call, which are at most the specified `maxNumEvents`.
+    ///
+    /// NOTE: This method should only be used when the `MockSession` has
+    ///       been created in synchronous mode.  It is invalid if used in
+    ///       asynchronous mode and your test case is likely to be faulty
+    ///       if used with such a set up.
+    void nextEvents(bsl::vector<Event>*       events,
+                    int                       maxNumEvents,
+                    const bsls::TimeInterval& timeout = bsls::TimeInterval())
+        BSLS_KEYWORD_OVERRIDE;
+
     /// Post the specified `messageEvent`.  Return values are defined as per
     /// `bmqt::PostResult`.  In general a call to `post` emits a
     /// `MessageEvent` of type `e_ACK` or no response if acks are not
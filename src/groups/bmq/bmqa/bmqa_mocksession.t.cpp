@@ -1425,6 +1425,95 @@ static void test8_postBlockedToSuspendedQueue()
     builder.reset();
 }
 
+static void test9_nextEvents()
+{
+    bmqtst::TestHelper::printTestName("NEXT EVENTS");
+
+    bmqa::MockSession mockSession(
+        bmqt::SessionOptions(bmqtst::TestHelperUtil::allocator()),
+        bmqtst::TestHelperUtil::allocator());
+
+    bsl::string input = "bmq://my.domain/queue";
+    bmqt::Uri   uri(bmqtst::TestHelperUtil::allocator());
+    bsl::string error;
+
+    bmqt::UriParser::parse(&uri, &error, input);
+
+    bmqt::CorrelationId corrId(1);
+    bmqa::QueueId       queueId(corrId);
+
+    bsl::vector<bmqa::Event> events(bmqtst::TestHelperUtil::allocator());
+
+    {
+        PVV("Events are returned in order and queue events are processed");
+
+        bsl::vector<bmqa::Event> expected(
+            bmqtst::TestHelperUtil::allocator());
+        expected.push_back(bmqa::MockSessionUtil::createSessionEvent(
+            bmqt::SessionEventType::e_CONNECTED,
+            bmqt::CorrelationId(),
+            0,
+            "",
+            bmqtst::TestHelperUtil::allocator()));
+        expected.push_back(bmqa::MockSessionUtil::createQueueSessionEvent(
+            bmqt::SessionEventType::e_QUEUE_OPEN_RESULT,
+            &queueId,
+            queueId.correlationId(),
+            0,
+            "",
+            bmqtst::TestHelperUtil::allocator()));
+
+        BMQA_EXPECT_CALL(mockSession, openQueueAsync(&queueId, uri, 10))
+            .returning(0);
+        BMQA_EXPECT_CALL(mockSession, nextEvents(2)).returning(expected);
+
+        BMQTST_ASSERT_EQ(mockSession.openQueueAsync(&queueId, uri, 10), 0);
+        typedef bsl::shared_ptr<bmqimp::Queue>& QueueImplPtr;
+        QueueImplPtr implPtr = reinterpret_cast<QueueImplPtr>(queueId);
+        BMQTST_ASSERT_EQ(implPtr->state(), bmqimp::QueueState::e_OPENING_OPN);
+
+        mockSession.nextEvents(&events, 2);
+
+        BMQTST_ASSERT_EQ(events.size(), 2u);
+        BMQTST_ASSERT_EQ(events[0].sessionEvent().type(),
+                         bmqt::SessionEventType::e_CONNECTED);
+        BMQTST_ASSERT_EQ(events[1].sessionEvent().type(),
+                         bmqt::SessionEventType::e_QUEUE_OPEN_RESULT);
+        BMQTST_ASSERT_EQ(events[1].sessionEvent().correlationId(), corrId);
+        BMQTST_ASSERT_EQ(implPtr->state(), bmqimp::QueueState::e_OPENED);
+    }
+
+    {
+        PVV("Arguments are checked and previous content is cleared");
+
+        bsl::vector<bmqa::Event> expected(
+            bmqtst::TestHelperUtil::allocator());
+        expected.push_back(bmqa::MockSessionUtil::createSessionEvent(
+            bmqt::SessionEventType::e_TIMEOUT,
+            bmqt::CorrelationId(),
+            0,
+            "",
+            bmqtst::TestHelperUtil::allocator()));
+
+        BMQA_EXPECT_CALL(mockSession, nextEvents(5, bsls::TimeInterval(1)))
+            .returning(expected);
+
+        BMQTST_ASSERT_FAIL(mockSession.nextEvents(&events, 4));
+        BMQTST_ASSERT_EQ(events.size(), 0u);
+
+        mockSession.nextEvents(&events, 5, bsls::TimeInterval(1));
+
+        BMQTST_ASSERT_EQ(events.size(), 1u);
+        BMQTST_ASSERT_EQ(events[0].sessionEvent().type(),
+                         bmqt::SessionEventType::e_TIMEOUT);
+    }
+
+    {
+        PVV("Empty expected call queue");
+        BMQTST_ASSERT_FAIL(mockSession.nextEvents(&events, 1));
+    }
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -1435,6 +1524,7 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 9: test9_nextEvents(); break;
     case 8: test8_postBlockedToSuspendedQueue(); break;
     case 7: test7_postAndAccess(); break;
     case 6: test6_runThrough(); break;
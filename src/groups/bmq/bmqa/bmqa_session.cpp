@@ -1493,6 +1493,36 @@ Event Session::nextEvent(const bsls::TimeInterval& timeout)
     return event;
 }
 
+void Session::nextEvents(bsl::vector<Event>*       events,
+                         int                       maxNumEvents,
+                         const bsls::TimeInterval& timeout)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(d_impl.d_application_mp && "The session was not started");
+    BSLS_ASSERT(events);
+    BSLS_ASSERT(maxNumEvents > 0);
+
+    // If no timeout was specified, use a long timeout to simulate a 'no
+    // timeout' behavior
+    bsls::TimeInterval time = timeout;
+    if (time == bsls::TimeInterval()) {
+        time.addDays(365);
+    }
+
+    bsl::vector<bsl::shared_ptr<bmqimp::Event> > eventImpls(
+        d_impl.d_allocator_p);
+    d_impl.d_application_mp->brokerSession().nextEvents(&eventImpls,
+                                                        maxNumEvents,
+                                                        time);
+
+    events->clear();
+    events->resize(eventImpls.size());
+    for (size_t i = 0; i < eventImpls.size(); ++i) {
+        reinterpret_cast<bsl::shared_ptr<bmqimp::Event>&>((*events)[i])
+            .swap(eventImpls[i]);
+    }
+}
+
 int Session::post(const MessageEvent& event)
 {
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
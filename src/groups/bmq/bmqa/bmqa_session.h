@@ -216,7 +216,9 @@
 /// timeout expires.  It is safe to call the `nextEvent` method from different
 /// threads simultaneously: the @bbref{bmqa::Session} class provides proper
 /// synchronization logic to protect the internal event queue from corruption
-/// in this scenario.
+/// in this scenario.  Applications processing a high rate of events can
+/// instead call the `nextEvents` method, which retrieves up to a specified
+/// number of available events at once.
 ///
 /// Example 2                                               {#bmqa_session_ex2}
 /// ---------
@@ -567,6 +569,7 @@
 #include <ball_log.h>
 #include <bsl_memory.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 #include <bslma_allocator.h>
 #include <bslma_managedptr.h>
 #include <bslma_usesbslmaallocator.h>
@@ -1082,6 +1085,27 @@ class Session : public AbstractSession {
     Event nextEvent(const bsls::TimeInterval& timeout = bsls::TimeInterval())
         BSLS_KEYWORD_OVERRIDE;
 
+    /// Load into the specified `events` up to the specified `maxNumEvents`
+    /// next available events received for this session, in the order they
+    /// were received.  If there is no event available, this method blocks
+    /// for up to the optionally specified `timeout` time interval for an
+    /// event to arrive, exactly like `nextEvent` does; once an event is
+    /// available, the events readily available after it are loaded without
+    /// waiting any further.  Any previous content of `events` is removed.
+    /// Load a single `bmqa::SessionEvent` of type
+    /// `bmqt::SessionEventType::e_TIMEOUT` if a timeout was specified and
+    /// that timeout expired before any event was received.  Note that
+    /// draining the events in batches amortizes the synchronization of the
+    /// internal event queue, which helps applications having many threads
+    /// processing events.  Note also that this method can only be used if
+    /// the session is in synchronous mode (ie not using the EventHandler).
+    /// The behavior is undefined unless the session was started and
+    /// `0 < maxNumEvents`.
+    void nextEvents(bsl::vector<Event>*       events,
+                    int                       maxNumEvents,
+                    const bsls::TimeInterval& timeout = bsls::TimeInterval())
+        BSLS_KEYWORD_OVERRIDE;
+
     /// Asynchronously post the specified `event` that must contain one or
     /// more `Messages`.  The return value is one of the values defined in
     /// the `bmqt::PostResult::Enum` enum.  Return zero on success and a
@@ -0,0 +1,143 @@
+// Copyright 2014-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// bmqa_session.t.cpp                                                 -*-C++-*-
+#include <bmqa_session.h>
+
+// BMQ
+#include <bmqa_event.h>
+#include <bmqa_sessionevent.h>
+#include <bmqt_resultcode.h>
+#include <bmqt_sessioneventtype.h>
+#include <bmqt_sessionoptions.h>
+
+// BDE
+#include <bsl_vector.h>
+#include <bslmt_threadutil.h>
+#include <bsls_timeinterval.h>
+
+// TEST DRIVER
+#include <bmqtst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+{
+    bmqtst::TestHelper::printTestName("BREATHING TEST");
+
+    // Create a session in synchronous mode
+    bmqt::SessionOptions options(bmqtst::TestHelperUtil::allocator());
+    bmqa::Session        obj(options, bmqtst::TestHelperUtil::allocator());
+
+    // Stop without previous start
+    obj.stop();
+}
+
+static void test2_nextEvents()
+// ------------------------------------------------------------------------
+// NEXT EVENTS
+//
+// Concerns:
+//   Exercise 'nextEvents' without network connection
+//
+// Plan:
+//   1. Create a session in synchronous mode and start it asynchronously
+//   2. Verify 'nextEvents' loads a single TIMEOUT event if no event is
+//      available before the timeout
+//   3. Verify 'nextEvents' loads the CONNECTION_TIMEOUT event once the
+//      start times out, and that any previous content is removed
+//   4. Let two starts time out and verify 'nextEvents' loads no more than
+//      'maxNumEvents' of the two CONNECTION_TIMEOUT events
+//
+// Testing:
+//   nextEvents()
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("NEXT EVENTS");
+
+    bmqt::SessionOptions options(bmqtst::TestHelperUtil::allocator());
+    bmqa::Session        obj(options, bmqtst::TestHelperUtil::allocator());
+
+    bsl::vector<bmqa::Event> events(bmqtst::TestHelperUtil::allocator());
+
+    int rc = obj.startAsync(bsls::TimeInterval(0.5));
+    BMQTST_ASSERT_EQ(rc, bmqt::GenericResult::e_SUCCESS);
+
+    PVV("No event before the timeout");
+    obj.nextEvents(&events, 5, bsls::TimeInterval(0.1));
+
+    BMQTST_ASSERT_EQ(events.size(), 1u);
+    BMQTST_ASSERT(events[0].isSessionEvent());
+    BMQTST_ASSERT_EQ(events[0].sessionEvent().type(),
+                     bmqt::SessionEventType::e_TIMEOUT);
+
+    PVV("CONNECTION_TIMEOUT event");
+    obj.nextEvents(&events, 5, bsls::TimeInterval(5));
+
+    BMQTST_ASSERT_EQ(events.size(), 1u);
+    BMQTST_ASSERT(events[0].isSessionEvent());
+    BMQTST_ASSERT_EQ(events[0].sessionEvent().type(),
+                     bmqt::SessionEventType::e_CONNECTION_TIMEOUT);
+
+    PVV("Up to 'maxNumEvents' events");
+    for (int i = 0; i < 2; ++i) {
+        rc = obj.startAsync(bsls::TimeInterval(0.1));
+        BMQTST_ASSERT_EQ(rc, bmqt::GenericResult::e_SUCCESS);
+
+        // Let the start time out
+        bslmt::ThreadUtil::microSleep(0, 1);
+    }
+
+    obj.nextEvents(&events, 1, bsls::TimeInterval(5));
+
+    BMQTST_ASSERT_EQ(events.size(), 1u);
+    BMQTST_ASSERT_EQ(events[0].sessionEvent().type(),
+                     bmqt::SessionEventType::e_CONNECTION_TIMEOUT);
+
+    obj.nextEvents(&events, 5, bsls::TimeInterval(5));
+
+    BMQTST_ASSERT_EQ(events.size(), 1u);
+    BMQTST_ASSERT_EQ(events[0].sessionEvent().type(),
+                     bmqt::SessionEventType::e_CONNECTION_TIMEOUT);
+
+    obj.stop();
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(bmqtst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 2: test2_nextEvents(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        bmqtst::TestHelperUtil::testStatus() = -1;
+    } break;
+    }
+
+    TEST_EPILOG(bmqtst::TestHelper::e_DEFAULT);
+}
@@ -0,0 +1,1148 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// bmqc_flatorderedhashmap.h                                          -*-C++-*-
+#ifndef INCLUDED_BMQC_FLATORDEREDHASHMAP
+#define INCLUDED_BMQC_FLATORDEREDHASHMAP
+
+//@PURPOSE: Provide an open addressing hash table with insertion order.
+//
+//@CLASSES:
+//  bmqc::FlatOrderedHashMap : Open addressing hash table with insertion order.
+//
+//@SEE_ALSO: bmqc_orderedhashmap
+//
+//@DESCRIPTION: 'bmqc::FlatOrderedHashMap' provides an associative container
+// with constant time performance for basic operations (insertion, deletion and
+// lookup), along with predictive iteration order, which is the order in which
+// keys are inserted in the container.  It offers the subset of the
+// 'bmqc::OrderedHashMap' interface needed to replace the latter on hot paths
+// which insert elements at the end, look them up by key, iterate them in
+// order, and erase them mostly in the order of insertion (e.g., a queue of
+// messages).
+//
+// Unlike 'bmqc::OrderedHashMap', which allocates a node linked in both a
+// bucket list and the sequential list per element, this container stores the
+// elements inline, in the order of insertion, in fixed size chunks of
+// contiguous slots.  Each element is identified by its *sequence* number, the
+// number of elements inserted before it, which also locates its slot.  The
+// hash table is an open addressing (linear probing) array of the sequence
+// numbers, with a maximum load factor of 0.5.
+//
+// Erasing an element destroys it and marks its slot as free in the bit set of
+// its chunk, and leaves a tombstone in the hash table.  The iteration skips
+// free slots a word of the bit set at a time.  A chunk is released as soon as
+// all of its elements are erased, and tombstones are discarded (compacted)
+// when the hash table is rehashed, which happens when live elements and
+// tombstones exceed the maximum load factor.  Note that since the elements
+// are never moved, compaction does not invalidate iterators.
+//
+/// Exception Safety
+///----------------
+// At this time, this component provides *no* exception safety guarantee.
+//
+/// Behavior of insert() routine
+///----------------------------
+// Like 'bmqc::OrderedHashMap', the newly inserted element is always
+// constructed such that 'container.end()' before the 'insert()' operation
+// becomes the iterator of the newly inserted element.
+//
+/// Iterator, pointer and reference invalidation
+///--------------------------------------------
+// No method of 'FlatOrderedHashMap' invalidates an iterator, a pointer or a
+// reference to an element in the container, unless it also erases that
+// element.  Incrementing an iterator to an erased element is supported and
+// advances it to the next element following the erased one.
+//
+/// Thread Safety
+///-------------
+// Not thread safe.
+
+// BDE
+#include <bdlb_bitutil.h>
+#include <bdlma_pool.h>
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
+#include <bsl_deque.h>
+#include <bsl_functional.h>
+#include <bsl_iterator.h>
+#include <bsl_type_traits.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+#include <bslalg_hasstliterators.h>
+#include <bslalg_scalarprimitives.h>
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_destructionutil.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bsls_assert.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+
+namespace bmqc {
+
+// FORWARD DECLARATION
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+class FlatOrderedHashMap;
+
+// =================================
+// class FlatOrderedHashMap_Sequence
+// =================================
+
+/// PRIVATE CLASS TEMPLATE.  For use only by `bmqc::FlatOrderedHashMap`
+/// implementation.  Elements in the order of insertion, stored inline in
+/// chunks of `k_CHUNK_SIZE` slots and located by their sequence number.
+template <class VALUE>
+class FlatOrderedHashMap_Sequence {
+  public:
+    // TYPES
+    typedef bsls::Types::Uint64 Sequence;
+
+    enum {
+        /// The number of slots in a chunk, one bit of `Chunk::d_live` per
+        /// slot.
+        k_CHUNK_SIZE = 64
+    };
+
+  private:
+    // PRIVATE TYPES
+    struct Chunk {
+        /// Bit set of the slots holding not erased elements.
+        bsls::Types::Uint64 d_live;
+
+        unsigned int d_numLive;
+
+        bsls::ObjectBuffer<VALUE> d_values[k_CHUNK_SIZE];
+
+        Chunk();
+    };
+
+    /// Chunks from `d_firstChunk` up to the chunk of the last inserted
+    /// element.  A released chunk is null unless it is the first one, in
+    /// which case it is removed.
+    typedef bsl::deque<Chunk*> Chunks;
+
+    // DATA
+    bslma::Allocator* d_allocator_p;
+
+    bdlma::Pool d_chunkPool;
+
+    Chunks d_chunks;
+
+    /// The number of the chunk at the front of `d_chunks`.
+    Sequence d_firstChunk;
+
+    /// The sequence number of the next inserted element.  Never reset, so
+    /// the `end` iterator keeps referencing the next inserted element.
+    Sequence d_end;
+
+    size_t d_size;
+
+  private:
+    // NOT IMPLEMENTED
+    FlatOrderedHashMap_Sequence(const FlatOrderedHashMap_Sequence&);
+    FlatOrderedHashMap_Sequence&
+    operator=(const FlatOrderedHashMap_Sequence&);
+
+    // PRIVATE ACCESSORS
+
+    /// Return the address of the chunk holding the specified `sequence`
+    /// or 0 if there is no such chunk.
+    Chunk* findChunk(Sequence sequence) const;
+
+  public:
+    // CREATORS
+
+    /// Create an empty sequence using the specified `allocator` to supply
+    /// memory for the chunks and the elements.
+    explicit FlatOrderedHashMap_Sequence(bslma::Allocator* allocator);
+
+    /// Destroy this object and each of its elements.
+    ~FlatOrderedHashMap_Sequence();
+
+    // MANIPULATORS
+
+    /// Append a copy of the specified `value` and return its sequence
+    /// number.
+    Sequence append(const VALUE& value);
+
+    /// Destroy the element having the specified `sequence` and release its
+    /// chunk if no other elements remain there.  The behavior is undefined
+    /// unless `sequence` refers to a not erased element.
+    void remove(Sequence sequence);
+
+    /// Destroy all elements and release all chunks.
+    void clear();
+
+    // ACCESSORS
+
+    /// Return the sequence number of the first not erased element starting
+    /// from the specified `sequence`, or `end()` if there is no such
+    /// element.
+    Sequence next(Sequence sequence) const;
+
+    /// Return the sequence number of the next inserted element.
+    Sequence end() const;
+
+    /// Return the address of the element having the specified `sequence`.
+    /// The behavior is undefined unless `sequence` refers to a not erased
+    /// element.
+    VALUE* value(Sequence sequence) const;
+
+    /// Return the number of not erased elements.
+    size_t size() const;
+};
+
+// =================================
+// class FlatOrderedHashMap_Iterator
+// =================================
+
+/// PRIVATE CLASS TEMPLATE.  For use only by `bmqc::FlatOrderedHashMap`
+/// implementation.
+template <class VALUE>
+class FlatOrderedHashMap_Iterator {
+  private:
+    // PRIVATE TYPES
+    typedef typename bsl::remove_cv<VALUE>::type NcType;
+
+    typedef FlatOrderedHashMap_Iterator<NcType> NcIter;
+
+    typedef FlatOrderedHashMap_Sequence<NcType> Sequence;
+
+    // FRIENDS
+    template <class LHM_KEY,
+              class LHM_VALUE,
+              class LHM_HASH,
+              typename LHM_VALUE_TYPE>
+    friend class FlatOrderedHashMap;
+
+    friend class FlatOrderedHashMap_Iterator<const VALUE>;
+
+    template <class VALUE1, class VALUE2>
+    friend bool operator==(const FlatOrderedHashMap_Iterator<VALUE1>&,
+                           const FlatOrderedHashMap_Iterator<VALUE2>&);
+
+    // DATA
+    const Sequence* d_sequence_p;
+
+    bsls::Types::Uint64 d_position;
+
+  private:
+    // PRIVATE CREATORS
+
+    /// Create an iterator referencing the element at the specified
+    /// `position` in the specified `sequence`.
+    FlatOrderedHashMap_Iterator(const Sequence*     sequence,
+                                bsls::Types::Uint64 position);
+
+  public:
+    // TYPES
+    typedef bsl::forward_iterator_tag iterator_category;
+    typedef NcType                    value_type;
+    typedef bsl::ptrdiff_t            difference_type;
+    typedef VALUE*                    pointer;
+    typedef VALUE&                    reference;
+
+    // CREATORS
+
+    /// Create a singular iterator (i.e., one that cannot be incremented or
+    /// dereferenced.
+    FlatOrderedHashMap_Iterator();
+
+    /// Create an iterator to `VALUE` from the corresponding iterator to
+    /// non-const `VALUE`.  If `VALUE` is not const-qualified, then this
+    /// constructor becomes the copy constructor.  Otherwise, the copy
+    /// constructor is implicitly generated.
+    FlatOrderedHashMap_Iterator(const NcIter& other);
+
+    // MANIPULATORS
+
+    /// Assign to this object the value of the specified `rhs` object.
+    FlatOrderedHashMap_Iterator& operator=(const NcIter& rhs);
+
+    /// Advance this iterator to the next element in the order of insertion
+    /// and return its new value.  The behavior is undefined unless this
+    /// iterator is not singular and is not `end()`.
+    FlatOrderedHashMap_Iterator& operator++();
+
+    /// Advance this iterator to the next element in the order of insertion
+    /// and return its previous value.  The behavior is undefined unless
+    /// this iterator is not singular and is not `end()`.
+    FlatOrderedHashMap_Iterator operator++(int);
+
+    // ACCESSORS
+
+    /// Return a reference to the element referenced by this iterator.  The
+    /// behavior is undefined unless this iterator is in the range
+    /// `[begin() .. end())` and the element has not been erased.
+    VALUE& operator*() const;
+
+    /// Return a pointer to the element referenced by this iterator.  The
+    /// behavior is undefined unless this iterator is in the range
+    /// `[begin() .. end())` and the element has not been erased.
+    VALUE* operator->() const;
+};
+
+// FREE OPERATORS
+
+/// Return `true` if the specified iterators `lhs` and `rhs` have the same
+/// value and `false` otherwise.  Two iterators have the same value if both
+/// refer to the same element of the same container or both are the end()
+/// iterator of the same container.  The return value is undefined unless
+/// both `lhs` and `rhs` are non-singular.
+template <class VALUE1, class VALUE2>
+bool operator==(const FlatOrderedHashMap_Iterator<VALUE1>& lhs,
+                const FlatOrderedHashMap_Iterator<VALUE2>& rhs);
+
+/// Return `true` if the specified iterators `lhs` and `rhs` do not have the
+/// same value and `false` otherwise.
+template <class VALUE1, class VALUE2>
+bool operator!=(const FlatOrderedHashMap_Iterator<VALUE1>& lhs,
+                const FlatOrderedHashMap_Iterator<VALUE2>& rhs);
+
+// ========================
+// class FlatOrderedHashMap
+// ========================
+
+/// Open addressing hash table with the iteration in the order of insertion.
+template <class KEY,
+          class VALUE,
+          class HASH       = bsl::hash<KEY>,
+          class VALUE_TYPE = bsl::pair<const KEY, VALUE> >
+class FlatOrderedHashMap {
+  private:
+    // PRIVATE TYPES
+    typedef typename bsl::remove_cv<VALUE_TYPE>::type NcValueType;
+
+    typedef FlatOrderedHashMap_Sequence<NcValueType> Sequence;
+
+    /// Open addressing table of sequence numbers shifted by `k_SLOT_OFFSET`
+    /// to reserve values for empty and erased slots.
+    typedef bsl::vector<bsls::Types::Uint64> Index;
+
+    enum {
+        k_EMPTY_SLOT  = 0,
+        k_ERASED_SLOT = 1,
+        k_SLOT_OFFSET = 2,
+
+        /// The minimal number of slots in `Index`.
+        k_MIN_INDEX_SIZE = 16
+    };
+
+  public:
+    // TYPES
+    typedef KEY key_type;
+
+    typedef VALUE_TYPE value_type;
+
+    typedef bslma::Allocator* allocator_type;
+
+    typedef HASH hasher;
+
+    typedef FlatOrderedHashMap_Iterator<value_type> iterator;
+
+    typedef FlatOrderedHashMap_Iterator<const value_type> const_iterator;
+
+  private:
+    // DATA
+    Sequence d_sequence;
+
+    Index d_index;
+
+    /// The number of not empty (occupied or erased) slots in `d_index`.
+    size_t d_numUsedSlots;
+
+    /// `64 - log2(d_index.size())`, to map hash values to slots.
+    int d_indexShift;
+
+    HASH d_hasher;
+
+  private:
+    // NOT IMPLEMENTED
+    FlatOrderedHashMap(const FlatOrderedHashMap&);             // = delete
+    FlatOrderedHashMap& operator=(const FlatOrderedHashMap&);  // = delete
+
+    // PRIVATE MANIPULATORS
+
+    /// Store the specified `sequence` of the element having the specified
+    /// `key` in a free slot of `d_index`.  The behavior is undefined unless
+    /// `d_index` has an empty slot.
+    void insertSlot(const key_type& key, bsls::Types::Uint64 sequence);
+
+    /// Rebuild `d_index` so that it has enough slots for the specified
+    /// `numElements` and no erased slots.
+    void rehash(size_t numElements);
+
+    // PRIVATE ACCESSORS
+
+    /// Return the slot in `d_index` where the lookup of the specified `key`
+    /// starts.
+    size_t homeSlot(const key_type& key) const;
+
+    /// Return the slot in `d_index` of the element having the specified
+    /// `key`, or `d_index.size()` if there is no such element.
+    size_t findSlot(const key_type& key) const;
+
+    // PRIVATE CLASS METHODS
+    static const key_type& get_key(const bsl::pair<const KEY, VALUE>& value)
+    {
+        return value.first;
+    }
+
+    static const key_type& get_key(const KEY& value) { return value; }
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(FlatOrderedHashMap,
+                                   bslma::UsesBslmaAllocator)
+    BSLMF_NESTED_TRAIT_DECLARATION(FlatOrderedHashMap,
+                                   bslalg::HasStlIterators)
+
+    // CREATORS
+
+    /// Create an empty `FlatOrderedHashMap` object.  Optionally specify a
+    /// `basicAllocator` used to supply memory.
+    explicit FlatOrderedHashMap(bslma::Allocator* basicAllocator = 0);
+
+    /// Create an empty `FlatOrderedHashMap` having enough slots in the hash
+    /// table for the specified `initialNumElements` without rehashing.
+    /// Optionally specify a `basicAllocator` used to supply memory.
+    explicit FlatOrderedHashMap(size_t            initialNumElements,
+                                bslma::Allocator* basicAllocator = 0);
+
+    /// Destroy this object and each of its elements.
+    ~FlatOrderedHashMap();
+
+    // MANIPULATORS
+
+    /// Return a mutating iterator referring to the first element in the
+    /// container, if any, or one past the end of this container if there
+    /// are no elements.
+    iterator begin();
+
+    /// Return a mutating iterator referring to one past the end of this
+    /// container.
+    iterator end();
+
+    /// Remove all entries from this container.  Note that this container
+    /// will be empty after calling this method, but the hash table is
+    /// retained for future use.
+    void clear();
+
+    /// Remove from this container the `value_type` object at the specified
+    /// `position`, and return an iterator referring to the element
+    /// immediately following the removed element, or to the past-the-end
+    /// position if the removed element was the last element in the
+    /// sequence of elements maintained by this container.  The behavior is
+    /// undefined unless `position` refers to a `value_type` object in this
+    /// container.
+    iterator erase(const_iterator position);
+
+    /// Remove from this container the `value_type` object having the
+    /// specified `key`, if it exists, and return 1; otherwise (there is no
+    /// `value_type` object having `key` in this container) return 0 with
+    /// no other effect.
+    size_t erase(const key_type& key);
+
+    /// Return an iterator providing modifiable access to the `value_type`
+    /// object in this container having the specified `key`, if such an
+    /// entry exists, and the past-the-end iterator (`end`) otherwise.
+    iterator find(const key_type& key);
+
+    /// Insert the specified `value` at the end of this container if the
+    /// key of `value` does not already exist in this container; otherwise,
+    /// this method has no effect.  Return a `pair` whose `first` member is
+    /// an iterator referring to the (possibly newly inserted) `value_type`
+    /// object in this container whose key is the same as that of `value`,
+    /// and whose `second` member is `true` if a new value was inserted, and
+    /// `false` if the value was already present.
+    bsl::pair<iterator, bool> insert(const value_type& value);
+
+    // ACCESSORS
+
+    /// Return an iterator providing non-modifiable access to the first
+    /// `value_type` object in this container, or the `end` iterator if this
+    /// container is empty.
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+
+    /// Return an iterator providing non-modifiable access to the
+    /// past-the-end element in this container.
+    const_iterator end() const;
+    const_iterator cend() const;
+
+    /// Return the number of `value_type` objects contained within this
+    /// container having the specified `key` (either 0 or 1).
+    size_t count(const key_type& key) const;
+
+    /// Return `true` if this container contains no elements, and `false`
+    /// otherwise.
+    bool empty() const;
+
+    /// Return an iterator providing non-modifiable access to the
+    /// `value_type` object in this container having the specified `key`,
+    /// if such an entry exists, and the past-the-end iterator (`end`)
+    /// otherwise.
+    const_iterator find(const key_type& key) const;
+
+    /// Return the number of elements in this container.
+    size_t size() const;
+
+    /// Return the ratio between the `size` of this container and the
+    /// number of slots in the hash table.
+    double load_factor() const;
+
+    /// Return the allocator associated with this object.
+    allocator_type get_allocator() const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// ----------------------------------------
+// class FlatOrderedHashMap_Sequence::Chunk
+// ----------------------------------------
+
+template <class VALUE>
+inline FlatOrderedHashMap_Sequence<VALUE>::Chunk::Chunk()
+: d_live(0)
+, d_numLive(0)
+{
+    // NOTHING
+}
+
+// ---------------------------------
+// class FlatOrderedHashMap_Sequence
+// ---------------------------------
+
+// PRIVATE ACCESSORS
+template <class VALUE>
+inline typename FlatOrderedHashMap_Sequence<VALUE>::Chunk*
+FlatOrderedHashMap_Sequence<VALUE>::findChunk(Sequence sequence) const
+{
+    const Sequence chunkNum = sequence / k_CHUNK_SIZE;
+
+    if (chunkNum < d_firstChunk ||
+        chunkNum - d_firstChunk >= d_chunks.size()) {
+        return 0;  // RETURN
+    }
+
+    return d_chunks[static_cast<size_t>(chunkNum - d_firstChunk)];
+}
+
+// CREATORS
+template <class VALUE>
+inline FlatOrderedHashMap_Sequence<VALUE>::FlatOrderedHashMap_Sequence(
+    bslma::Allocator* allocator)
+: d_allocator_p(allocator)
+, d_chunkPool(sizeof(Chunk), allocator)
+, d_chunks(allocator)
+, d_firstChunk(0)
+, d_end(0)
+, d_size(0)
+{
+    // NOTHING
+}
+
+template <class VALUE>
+inline FlatOrderedHashMap_Sequence<VALUE>::~FlatOrderedHashMap_Sequence()
+{
+    clear();
+}
+
+// MANIPULATORS
+template <class VALUE>
+inline typename FlatOrderedHashMap_Sequence<VALUE>::Sequence
+FlatOrderedHashMap_Sequence<VALUE>::append(const VALUE& value)
+{
+    const Sequence chunkNum = d_end / k_CHUNK_SIZE;
+    const unsigned offset   = static_cast<unsigned>(d_end % k_CHUNK_SIZE);
+
+    if (d_chunks.empty()) {
+        d_firstChunk = chunkNum;
+    }
+
+    BSLS_ASSERT_SAFE(chunkNum - d_firstChunk <= d_chunks.size());
+
+    if (chunkNum - d_firstChunk == d_chunks.size()) {
+        d_chunks.push_back(0);
+    }
+
+    Chunk*& chunk = d_chunks.back();
+
+    if (chunk == 0) {
+        // New chunk or the last chunk has been released when all elements
+        // inserted so far got erased.
+        chunk = new (d_chunkPool) Chunk();
+    }
+
+    bslalg::ScalarPrimitives::copyConstruct(chunk->d_values[offset].address(),
+                                            value,
+                                            d_allocator_p);
+
+    chunk->d_live |= bsls::Types::Uint64(1) << offset;
+    ++chunk->d_numLive;
+    ++d_size;
+
+    return d_end++;
+}
+
+template <class VALUE>
+inline void FlatOrderedHashMap_Sequence<VALUE>::remove(Sequence sequence)
+{
+    const Sequence chunkNum = sequence / k_CHUNK_SIZE;
+    const unsigned offset   = static_cast<unsigned>(sequence % k_CHUNK_SIZE);
+    const bsls::Types::Uint64 bit = bsls::Types::Uint64(1) << offset;
+
+    BSLS_ASSERT_SAFE(chunkNum >= d_firstChunk);
+    BSLS_ASSERT_SAFE(chunkNum - d_firstChunk < d_chunks.size());
+
+    Chunk*& chunk = d_chunks[static_cast<size_t>(chunkNum - d_firstChunk)];
+
+    BSLS_ASSERT_SAFE(chunk);
+    BSLS_ASSERT_SAFE(chunk->d_live & bit);
+
+    bslma::DestructionUtil::destroy(chunk->d_values[offset].address());
+
+    chunk->d_live &= ~bit;
+    --d_size;
+
+    if (--chunk->d_numLive) {
+        return;  // RETURN
+    }
+
+    // Release the chunk.  If it is the last one, 'append' allocates it again
+    // when needed.
+    d_chunkPool.deallocate(chunk);
+    chunk = 0;
+
+    while (!d_chunks.empty() && d_chunks.front() == 0) {
+        d_chunks.pop_front();
+        ++d_firstChunk;
+    }
+}
+
+template <class VALUE>
+inline void FlatOrderedHashMap_Sequence<VALUE>::clear()
+{
+    for (typename Chunks::iterator it = d_chunks.begin();
+         it != d_chunks.end();
+         ++it) {
+        Chunk* chunk = *it;
+
+        if (chunk == 0) {
+            continue;  // CONTINUE
+        }
+
+        for (bsls::Types::Uint64 live = chunk->d_live; live;
+             live &= live - 1) {
+            const int offset = bdlb::BitUtil::numTrailingUnsetBits(live);
+            bslma::DestructionUtil::destroy(
+                chunk->d_values[offset].address());
+        }
+
+        d_chunkPool.deallocate(chunk);
+    }
+
+    d_chunks.clear();
+    d_size = 0;
+}
+
+// ACCESSORS
+template <class VALUE>
+inline typename FlatOrderedHashMap_Sequence<VALUE>::Sequence
+FlatOrderedHashMap_Sequence<VALUE>::next(Sequence sequence) const
+{
+    const Sequence firstSequence = d_firstChunk * k_CHUNK_SIZE;
+
+    if (sequence < firstSequence) {
+        sequence = firstSequence;
+    }
+
+    while (sequence < d_end) {
+        const Sequence chunkNum = sequence / k_CHUNK_SIZE;
+        const size_t   index    = static_cast<size_t>(chunkNum - d_firstChunk);
+
+        if (index >= d_chunks.size()) {
+            break;  // BREAK
+        }
+
+        if (const Chunk* chunk = d_chunks[index]) {
+            const unsigned offset = static_cast<unsigned>(sequence %
+                                                          k_CHUNK_SIZE);
+            const bsls::Types::Uint64 live = chunk->d_live &
+                                             (~bsls::Types::Uint64(0)
+                                              << offset);
+            if (live) {
+                return chunkNum * k_CHUNK_SIZE +
+                       bdlb::BitUtil::numTrailingUnsetBits(live);  // RETURN
+            }
+        }
+
+        sequence = (chunkNum + 1) * k_CHUNK_SIZE;
+    }
+
+    return d_end;
+}
+
+template <class VALUE>
+inline typename FlatOrderedHashMap_Sequence<VALUE>::Sequence
+FlatOrderedHashMap_Sequence<VALUE>::end() const
+{
+    return d_end;
+}
+
+template <class VALUE>
+inline VALUE*
+FlatOrderedHashMap_Sequence<VALUE>::value(Sequence sequence) const
+{
+    Chunk* chunk = findChunk(sequence);
+
+    BSLS_ASSERT_SAFE(chunk);
+    BSLS_ASSERT_SAFE(chunk->d_live &
+                     (bsls::Types::Uint64(1) << (sequence % k_CHUNK_SIZE)));
+
+    return chunk->d_values[sequence % k_CHUNK_SIZE].address();
+}
+
+template <class VALUE>
+inline size_t FlatOrderedHashMap_Sequence<VALUE>::size() const
+{
+    return d_size;
+}
+
+// ---------------------------------
+// class FlatOrderedHashMap_Iterator
+// ---------------------------------
+
+// PRIVATE CREATORS
+template <class VALUE>
+inline FlatOrderedHashMap_Iterator<VALUE>::FlatOrderedHashMap_Iterator(
+    const Sequence*     sequence,
+    bsls::Types::Uint64 position)
+: d_sequence_p(sequence)
+, d_position(position)
+{
+    // NOTHING
+}
+
+// CREATORS
+template <class VALUE>
+inline FlatOrderedHashMap_Iterator<VALUE>::FlatOrderedHashMap_Iterator()
+: d_sequence_p(0)
+, d_position(0)
+{
+    // NOTHING
+}
+
+template <class VALUE>
+inline FlatOrderedHashMap_Iterator<VALUE>::FlatOrderedHashMap_Iterator(
+    const NcIter& other)
+: d_sequence_p(other.d_sequence_p)
+, d_position(other.d_position)
+{
+    // NOTHING
+}
+
+// MANIPULATORS
+template <class VALUE>
+inline FlatOrderedHashMap_Iterator<VALUE>&
+FlatOrderedHashMap_Iterator<VALUE>::operator=(const NcIter& rhs)
+{
+    d_sequence_p = rhs.d_sequence_p;
+    d_position   = rhs.d_position;
+    return *this;
+}
+
+template <class VALUE>
+inline FlatOrderedHashMap_Iterator<VALUE>&
+FlatOrderedHashMap_Iterator<VALUE>::operator++()
+{
+    BSLS_ASSERT_SAFE(d_sequence_p);
+    BSLS_ASSERT_SAFE(d_position < d_sequence_p->end());
+
+    d_position = d_sequence_p->next(d_position + 1);
+    return *this;
+}
+
+template <class VALUE>
+inline FlatOrderedHashMap_Iterator<VALUE>
+FlatOrderedHashMap_Iterator<VALUE>::operator++(int)
+{
+    FlatOrderedHashMap_Iterator temp(*this);
+    ++*this;
+    return temp;
+}
+
+// ACCESSORS
+template <class VALUE>
+inline VALUE& FlatOrderedHashMap_Iterator<VALUE>::operator*() const
+{
+    BSLS_ASSERT_SAFE(d_sequence_p);
+
+    return *d_sequence_p->value(d_position);
+}
+
+template <class VALUE>
+inline VALUE* FlatOrderedHashMap_Iterator<VALUE>::operator->() const
+{
+    BSLS_ASSERT_SAFE(d_sequence_p);
+
+    return d_sequence_p->value(d_position);
+}
+
+// ------------------------
+// class FlatOrderedHashMap
+// ------------------------
+
+// PRIVATE MANIPULATORS
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline void FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::insertSlot(
+    const key_type&     key,
+    bsls::Types::Uint64 sequence)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(!d_index.empty());
+
+    const size_t mask = d_index.size() - 1;
+    size_t       slot = homeSlot(key);
+
+    // Reuse erased slots.
+    while (d_index[slot] != k_EMPTY_SLOT && d_index[slot] != k_ERASED_SLOT) {
+        slot = (slot + 1) & mask;
+    }
+
+    if (d_index[slot] == k_EMPTY_SLOT) {
+        ++d_numUsedSlots;
+    }
+
+    d_index[slot] = sequence + k_SLOT_OFFSET;
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+void FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::rehash(
+    size_t numElements)
+{
+    // Keep the load factor at most 0.25 after rehashing, so that growing to
+    // the maximum of 0.5 doubles the number of elements.
+    size_t size  = k_MIN_INDEX_SIZE;
+    int    shift = 64 - 4;
+
+    while (size < numElements * 4) {
+        size *= 2;
+        --shift;
+    }
+
+    Index index(size, k_EMPTY_SLOT, d_index.get_allocator());
+    index.swap(d_index);
+
+    d_numUsedSlots = 0;
+    d_indexShift   = shift;
+
+    for (Index::const_iterator it = index.begin(); it != index.end(); ++it) {
+        if (*it == k_EMPTY_SLOT || *it == k_ERASED_SLOT) {
+            continue;  // CONTINUE
+        }
+
+        const bsls::Types::Uint64 sequence = *it - k_SLOT_OFFSET;
+
+        insertSlot(get_key(*d_sequence.value(sequence)), sequence);
+    }
+}
+
+// PRIVATE ACCESSORS
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline size_t FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::homeSlot(
+    const key_type& key) const
+{
+    // Fibonacci hashing: use the high bits of the product, which depend on
+    // all bits of the hash value.
+    const bsls::Types::Uint64 hash = static_cast<bsls::Types::Uint64>(
+        d_hasher(key));
+
+    return static_cast<size_t>((hash * 0x9E3779B97F4A7C15ULL) >>
+                               d_indexShift);
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline size_t FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::findSlot(
+    const key_type& key) const
+{
+    if (d_index.empty()) {
+        return 0;  // RETURN
+    }
+
+    const size_t mask = d_index.size() - 1;
+
+    // The load factor is at most 0.5; there are always empty slots.
+    for (size_t slot = homeSlot(key);; slot = (slot + 1) & mask) {
+        const bsls::Types::Uint64 value = d_index[slot];
+
+        if (value == k_EMPTY_SLOT) {
+            return d_index.size();  // RETURN
+        }
+        if (value != k_ERASED_SLOT &&
+            get_key(*d_sequence.value(value - k_SLOT_OFFSET)) == key) {
+            return slot;  // RETURN
+        }
+    }
+}
+
+// CREATORS
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::FlatOrderedHashMap(
+    bslma::Allocator* basicAllocator)
+: d_sequence(bslma::Default::allocator(basicAllocator))
+, d_index(basicAllocator)
+, d_numUsedSlots(0)
+, d_indexShift(64)
+, d_hasher()
+{
+    // NOTHING
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::FlatOrderedHashMap(
+    size_t            initialNumElements,
+    bslma::Allocator* basicAllocator)
+: d_sequence(bslma::Default::allocator(basicAllocator))
+, d_index(basicAllocator)
+, d_numUsedSlots(0)
+, d_indexShift(64)
+, d_hasher()
+{
+    rehash(initialNumElements);
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::~FlatOrderedHashMap()
+{
+    // NOTHING
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline typename FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::iterator
+FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::begin()
+{
+    return iterator(&d_sequence, d_sequence.next(0));
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline typename FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::iterator
+FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::end()
+{
+    return iterator(&d_sequence, d_sequence.end());
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline void FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::clear()
+{
+    d_sequence.clear();
+
+    bsl::fill(d_index.begin(),
+              d_index.end(),
+              static_cast<bsls::Types::Uint64>(k_EMPTY_SLOT));
+    d_numUsedSlots = 0;
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline typename FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::iterator
+FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::erase(
+    const_iterator position)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(position.d_sequence_p == &d_sequence);
+    BSLS_ASSERT_SAFE(position != end());
+
+    const size_t slot = findSlot(get_key(*position));
+
+    BSLS_ASSERT_SAFE(slot < d_index.size());
+
+    d_index[slot] = k_ERASED_SLOT;
+    d_sequence.remove(position.d_position);
+
+    return iterator(&d_sequence, d_sequence.next(position.d_position + 1));
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline size_t
+FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::erase(const key_type& key)
+{
+    const size_t slot = findSlot(key);
+
+    if (slot == d_index.size()) {
+        return 0;  // RETURN
+    }
+
+    const bsls::Types::Uint64 sequence = d_index[slot] - k_SLOT_OFFSET;
+
+    d_index[slot] = k_ERASED_SLOT;
+    d_sequence.remove(sequence);
+
+    return 1;
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline typename FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::iterator
+FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::find(const key_type& key)
+{
+    const size_t slot = findSlot(key);
+
+    if (slot == d_index.size()) {
+        return end();  // RETURN
+    }
+
+    return iterator(&d_sequence, d_index[slot] - k_SLOT_OFFSET);
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline bsl::pair<
+    typename FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::iterator,
+    bool>
+FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::insert(
+    const value_type& value)
+{
+    const key_type& key  = get_key(value);
+    const size_t    slot = findSlot(key);
+
+    if (slot != d_index.size()) {
+        return bsl::make_pair(iterator(&d_sequence,
+                                       d_index[slot] - k_SLOT_OFFSET),
+                              false);  // RETURN
+    }
+
+    if ((d_numUsedSlots + 1) * 2 > d_index.size()) {
+        // Also discards erased slots.
+        rehash(d_sequence.size() + 1);
+    }
+
+    const bsls::Types::Uint64 sequence = d_sequence.append(value);
+
+    insertSlot(get_key(*d_sequence.value(sequence)), sequence);
+
+    return bsl::make_pair(iterator(&d_sequence, sequence), true);
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline
+    typename FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::const_iterator
+    FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::begin() const
+{
+    return const_iterator(&d_sequence, d_sequence.next(0));
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline
+    typename FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::const_iterator
+    FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::cbegin() const
+{
+    return begin();
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline
+    typename FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::const_iterator
+    FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::end() const
+{
+    return const_iterator(&d_sequence, d_sequence.end());
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline
+    typename FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::const_iterator
+    FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::cend() const
+{
+    return end();
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline size_t FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::count(
+    const key_type& key) const
+{
+    return findSlot(key) == d_index.size() ? 0 : 1;
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline bool FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::empty() const
+{
+    return d_sequence.size() == 0;
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline
+    typename FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::const_iterator
+    FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::find(
+        const key_type& key) const
+{
+    const size_t slot = findSlot(key);
+
+    if (slot == d_index.size()) {
+        return end();  // RETURN
+    }
+
+    return const_iterator(&d_sequence, d_index[slot] - k_SLOT_OFFSET);
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline size_t FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::size() const
+{
+    return d_sequence.size();
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline double
+FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::load_factor() const
+{
+    if (d_index.empty()) {
+        return 0.0;  // RETURN
+    }
+
+    return static_cast<double>(size()) / static_cast<double>(d_index.size());
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline
+    typename FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::allocator_type
+    FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::get_allocator() const
+{
+    return d_index.get_allocator().mechanism();
+}
+
+// FREE OPERATORS
+template <class VALUE1, class VALUE2>
+inline bool operator==(const FlatOrderedHashMap_Iterator<VALUE1>& lhs,
+                       const FlatOrderedHashMap_Iterator<VALUE2>& rhs)
+{
+    return lhs.d_sequence_p == rhs.d_sequence_p &&
+           lhs.d_position == rhs.d_position;
+}
+
+template <class VALUE1, class VALUE2>
+inline bool operator!=(const FlatOrderedHashMap_Iterator<VALUE1>& lhs,
+                       const FlatOrderedHashMap_Iterator<VALUE2>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
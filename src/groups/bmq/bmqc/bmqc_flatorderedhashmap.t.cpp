@@ -0,0 +1,539 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// bmqc_flatorderedhashmap.t.cpp                                      -*-C++-*-
+#include <bmqc_flatorderedhashmap.h>
+
+// BMQ
+#include <bmqc_orderedhashmap.h>
+
+// BDE
+#include <bsl_cstring.h>
+#include <bsl_string.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+#include <bslh_hash.h>
+#include <bslma_testallocator.h>
+#include <bsls_types.h>
+
+// TEST DRIVER
+#include <bmqtst_testhelper.h>
+
+// BENCHMARKING LIBRARY
+#ifdef BMQTST_BENCHMARK_ENABLED
+#include <benchmark/benchmark.h>
+#endif
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   Exercise basic functionality before beginning testing in earnest.
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("BREATHING TEST");
+
+    typedef bmqc::FlatOrderedHashMap<int, bsl::string> MyMapType;
+    typedef MyMapType::iterator                         IterType;
+    typedef MyMapType::const_iterator                   ConstIterType;
+    typedef bsl::pair<IterType, bool>                   RcType;
+
+    MyMapType map(bmqtst::TestHelperUtil::allocator());
+
+    BMQTST_ASSERT(map.empty());
+    BMQTST_ASSERT_EQ(size_t(0), map.size());
+    BMQTST_ASSERT(map.begin() == map.end());
+    BMQTST_ASSERT(map.find(1) == map.end());
+    BMQTST_ASSERT_EQ(size_t(0), map.erase(1));
+
+    const int k_NUM_ELEMENTS = 100;
+
+    for (int i = 0; i < k_NUM_ELEMENTS; ++i) {
+        RcType rc = map.insert(bsl::make_pair(i, bsl::string(i, 'x')));
+        BMQTST_ASSERT_EQ_D(i, true, rc.second);
+        BMQTST_ASSERT_EQ_D(i, i, rc.first->first);
+    }
+
+    // Duplicate keys are not inserted
+    RcType rc = map.insert(bsl::make_pair(1, bsl::string("y")));
+    BMQTST_ASSERT_EQ(false, rc.second);
+    BMQTST_ASSERT_EQ(bsl::string(1, 'x'), rc.first->second);
+
+    BMQTST_ASSERT_EQ(size_t(k_NUM_ELEMENTS), map.size());
+    BMQTST_ASSERT_EQ(size_t(1), map.count(k_NUM_ELEMENTS - 1));
+    BMQTST_ASSERT_EQ(size_t(0), map.count(k_NUM_ELEMENTS));
+    BMQTST_ASSERT_LE(map.load_factor(), 0.5);
+
+    // Iteration in the order of insertion
+    int i = 0;
+    for (ConstIterType cit = map.begin(); cit != map.end(); ++cit, ++i) {
+        BMQTST_ASSERT_EQ_D(i, i, cit->first);
+        BMQTST_ASSERT_EQ_D(i, bsl::string(i, 'x'), cit->second);
+        BMQTST_ASSERT_D(i, map.find(i) == cit);
+    }
+    BMQTST_ASSERT_EQ(k_NUM_ELEMENTS, i);
+
+    // Erase odd keys while iterating, and even ones by key
+    IterType it = map.begin();
+    while (it != map.end()) {
+        if (it->first % 2) {
+            it = map.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+    BMQTST_ASSERT_EQ(size_t(k_NUM_ELEMENTS / 2), map.size());
+
+    for (i = 0; i < k_NUM_ELEMENTS; ++i) {
+        BMQTST_ASSERT_EQ_D(i, size_t(i % 2 ? 0 : 1), map.erase(i));
+    }
+    BMQTST_ASSERT(map.empty());
+    BMQTST_ASSERT(map.begin() == map.end());
+
+    // Erased keys can be inserted again, at the end
+    map.insert(bsl::make_pair(3, bsl::string("c")));
+    map.insert(bsl::make_pair(1, bsl::string("a")));
+
+    it = map.begin();
+    BMQTST_ASSERT_EQ(3, it->first);
+    ++it;
+    BMQTST_ASSERT_EQ(1, it->first);
+    ++it;
+    BMQTST_ASSERT(it == map.end());
+}
+
+static void test2_previousEndIterator()
+// ------------------------------------------------------------------------
+// PREVIOUS END ITERATOR
+//
+// Concerns:
+//   The 'end()' iterator before 'insert()' becomes the iterator of the
+//   newly inserted element, including after erasing all elements and after
+//   'clear()'.
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("PREVIOUS END ITERATOR");
+
+    typedef bmqc::FlatOrderedHashMap<int, int> MyMapType;
+    typedef MyMapType::iterator                IterType;
+
+    MyMapType map(bmqtst::TestHelperUtil::allocator());
+
+    IterType endIt = map.end();
+    map.insert(bsl::make_pair(1, 10));
+    BMQTST_ASSERT(endIt == map.begin());
+    BMQTST_ASSERT_EQ(1, endIt->first);
+    BMQTST_ASSERT_EQ(10, endIt->second);
+
+    // Reach the end of the container and insert more elements
+    for (int i = 2; i < 200; ++i) {
+        endIt = map.end();
+        map.insert(bsl::make_pair(i, i * 10));
+        BMQTST_ASSERT_EQ_D(i, i, endIt->first);
+        BMQTST_ASSERT_D(i, ++endIt == map.end());
+    }
+
+    // Erase all elements, the end iterator remains valid
+    endIt = map.end();
+    for (int i = 1; i < 200; ++i) {
+        map.erase(i);
+    }
+    BMQTST_ASSERT(endIt == map.end());
+    map.insert(bsl::make_pair(5, 50));
+    BMQTST_ASSERT_EQ(5, endIt->first);
+
+    endIt = map.end();
+    map.clear();
+    BMQTST_ASSERT(endIt == map.end());
+    map.insert(bsl::make_pair(6, 60));
+    BMQTST_ASSERT_EQ(6, endIt->first);
+    BMQTST_ASSERT(endIt == map.begin());
+}
+
+static void test3_iteratorStability()
+// ------------------------------------------------------------------------
+// ITERATOR STABILITY
+//
+// Concerns:
+//   Iterators and references to elements are stable across inserts,
+//   erasure of other elements and rehashing, and an iterator to an erased
+//   element can be advanced to the following element.
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("ITERATOR STABILITY");
+
+    typedef bmqc::FlatOrderedHashMap<int, int> MyMapType;
+    typedef MyMapType::iterator                IterType;
+
+    const int k_NUM_ELEMENTS = 10000;
+
+    MyMapType map(bmqtst::TestHelperUtil::allocator());
+
+    map.insert(bsl::make_pair(0, 0));
+
+    const IterType first   = map.begin();
+    const int*     address = &first->second;
+
+    IterType middle;
+    for (int i = 1; i < k_NUM_ELEMENTS; ++i) {
+        IterType it = map.insert(bsl::make_pair(i, i)).first;
+        if (i == k_NUM_ELEMENTS / 2) {
+            middle = it;
+        }
+    }
+
+    BMQTST_ASSERT(first == map.begin());
+    BMQTST_ASSERT_EQ(address, &map.find(0)->second);
+    BMQTST_ASSERT_EQ(k_NUM_ELEMENTS / 2, middle->first);
+
+    // Erase everything in between, releasing chunks
+    for (int i = 1; i < k_NUM_ELEMENTS - 1; ++i) {
+        if (i != k_NUM_ELEMENTS / 2) {
+            map.erase(i);
+        }
+    }
+    BMQTST_ASSERT_EQ(size_t(3), map.size());
+    BMQTST_ASSERT_EQ(address, &map.find(0)->second);
+
+    IterType it = first;
+    ++it;
+    BMQTST_ASSERT(it == middle);
+    ++it;
+    BMQTST_ASSERT_EQ(k_NUM_ELEMENTS - 1, it->first);
+
+    // Advance an iterator to an erased element
+    it = middle;
+    map.erase(middle->first);
+    ++it;
+    BMQTST_ASSERT_EQ(k_NUM_ELEMENTS - 1, it->first);
+
+    // Erase the first elements, releasing the leading chunks
+    IterType last = it;
+    map.erase(0);
+    BMQTST_ASSERT(map.begin() == last);
+    BMQTST_ASSERT(map.erase(last) == map.end());
+    BMQTST_ASSERT(map.empty());
+}
+
+static void test4_allocation()
+// ------------------------------------------------------------------------
+// ALLOCATION
+//
+// Concerns:
+//   - Elements are constructed using the allocator of the container.
+//   - Erasing elements releases their memory.
+//   - Erasing and inserting elements at the same pace does not grow the
+//     memory in use, i.e., tombstones are compacted.
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("ALLOCATION");
+
+    typedef bmqc::FlatOrderedHashMap<int, bsl::string> MyMapType;
+
+    bslma::TestAllocator ta("testAlloc");
+
+    const bsl::string k_LONG_STRING(100, 'x');
+    const int         k_WINDOW = 1000;
+
+    {
+        MyMapType map(&ta);
+
+        for (int i = 0; i < k_WINDOW; ++i) {
+            map.insert(bsl::make_pair(i, k_LONG_STRING));
+        }
+        BMQTST_ASSERT_EQ(static_cast<bslma::Allocator*>(&ta),
+                         map.find(0)->second.get_allocator().mechanism());
+
+        const bsls::Types::Int64 numBytesInUse = ta.numBytesInUse();
+
+        // Slide the window of elements
+        for (int i = k_WINDOW; i < 100 * k_WINDOW; ++i) {
+            map.erase(i - k_WINDOW);
+            map.insert(bsl::make_pair(i, k_LONG_STRING));
+        }
+        BMQTST_ASSERT_EQ(size_t(k_WINDOW), map.size());
+        BMQTST_ASSERT_LE(ta.numBytesInUse(), 2 * numBytesInUse);
+
+        map.clear();
+        BMQTST_ASSERT(map.empty());
+        BMQTST_ASSERT_LT(ta.numBytesInUse(), numBytesInUse);
+    }
+
+    BMQTST_ASSERT_EQ(0, ta.numBytesInUse());
+}
+
+// ============================================================================
+//                              PERFORMANCE TESTS
+// ----------------------------------------------------------------------------
+
+#ifdef BMQTST_BENCHMARK_ENABLED
+namespace {
+
+/// A key having the size and the distribution of `bmqt::MessageGUID`, which
+/// is not available at this level.
+struct GuidKey {
+    // DATA
+    unsigned char d_buffer[16];
+};
+
+// FREE FUNCTIONS
+bool operator==(const GuidKey& lhs, const GuidKey& rhs)
+{
+    return 0 == bsl::memcmp(lhs.d_buffer, rhs.d_buffer, sizeof(lhs.d_buffer));
+}
+
+template <class HASH_ALGORITHM>
+void hashAppend(HASH_ALGORITHM& hashAlgo, const GuidKey& key)
+{
+    hashAlgo(key.d_buffer, sizeof(key.d_buffer));
+}
+
+/// Load into the specified `keys` the specified `numKeys` distinct keys
+/// made of a sequence number and a constant part, like GUIDs generated by
+/// the same broker.
+void generateKeys(bsl::vector<GuidKey>* keys, size_t numKeys)
+{
+    keys->resize(numKeys);
+
+    for (size_t i = 0; i < numKeys; ++i) {
+        GuidKey&                  key     = (*keys)[i];
+        const bsls::Types::Uint64 counter = i;
+
+        bsl::memset(key.d_buffer, 0xab, sizeof(key.d_buffer));
+        bsl::memcpy(key.d_buffer, &counter, sizeof(counter));
+    }
+}
+
+typedef bmqc::FlatOrderedHashMap<GuidKey, size_t, bslh::Hash<> > FlatMap;
+typedef bmqc::OrderedHashMap<GuidKey, size_t, bslh::Hash<> >     OrderedMap;
+
+}  // close unnamed namespace
+
+template <class MAP>
+static void insertKeys(MAP* map, const bsl::vector<GuidKey>& keys)
+{
+    for (size_t i = 0; i < keys.size(); ++i) {
+        map->insert(bsl::make_pair(keys[i], i));
+    }
+}
+
+template <class MAP>
+static void benchmarkInsert(benchmark::State& state)
+{
+    // Insert 'state.range(0)' keys and report the memory in use per entry.
+
+    bsl::vector<GuidKey> keys(bmqtst::TestHelperUtil::allocator());
+    generateKeys(&keys, static_cast<size_t>(state.range(0)));
+
+    bsls::Types::Int64 bytesPerEntry = 0;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        bslma::TestAllocator ta("bench");
+        {
+            MAP map(&ta);
+            state.ResumeTiming();
+            insertKeys(&map, keys);
+            state.PauseTiming();
+            bytesPerEntry = ta.numBytesInUse() / state.range(0);
+        }
+        state.ResumeTiming();
+    }
+
+    state.counters["BytesPerEntry"] = static_cast<double>(bytesPerEntry);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class MAP>
+static void benchmarkErase(benchmark::State& state)
+{
+    // Erase 'state.range(0)' keys in the order of insertion, by key.
+
+    bsl::vector<GuidKey> keys(bmqtst::TestHelperUtil::allocator());
+    generateKeys(&keys, static_cast<size_t>(state.range(0)));
+
+    MAP map(bmqtst::TestHelperUtil::allocator());
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        insertKeys(&map, keys);
+        state.ResumeTiming();
+        for (size_t i = 0; i < keys.size(); ++i) {
+            map.erase(keys[i]);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class MAP>
+static void benchmarkIterate(benchmark::State& state)
+{
+    // Iterate 'state.range(0)' keys, every other one of which is erased.
+
+    bsl::vector<GuidKey> keys(bmqtst::TestHelperUtil::allocator());
+    generateKeys(&keys, static_cast<size_t>(state.range(0)));
+
+    MAP map(bmqtst::TestHelperUtil::allocator());
+    insertKeys(&map, keys);
+    for (size_t i = 0; i < keys.size(); i += 2) {
+        map.erase(keys[i]);
+    }
+
+    for (auto _ : state) {
+        size_t sum = 0;
+        for (typename MAP::const_iterator cit = map.begin(); cit != map.end();
+             ++cit) {
+            sum += cit->second;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * map.size());
+}
+
+static void testN1_insertFlat_GoogleBenchmark(benchmark::State& state)
+{
+    benchmarkInsert<FlatMap>(state);
+}
+
+static void testN1_insertOrdered_GoogleBenchmark(benchmark::State& state)
+{
+    benchmarkInsert<OrderedMap>(state);
+}
+
+static void testN2_eraseFlat_GoogleBenchmark(benchmark::State& state)
+{
+    benchmarkErase<FlatMap>(state);
+}
+
+static void testN2_eraseOrdered_GoogleBenchmark(benchmark::State& state)
+{
+    benchmarkErase<OrderedMap>(state);
+}
+
+static void testN3_iterateFlat_GoogleBenchmark(benchmark::State& state)
+{
+    benchmarkIterate<FlatMap>(state);
+}
+
+static void testN3_iterateOrdered_GoogleBenchmark(benchmark::State& state)
+{
+    benchmarkIterate<OrderedMap>(state);
+}
+#else
+static void testN1_insertFlat()
+{
+    bmqtst::TestHelper::printTestName("GOOGLE BENCHMARK: Insert");
+    PV("GoogleBenchmark is not supported on this platform, skipping...")
+}
+
+static void testN1_insertOrdered()
+{
+    bmqtst::TestHelper::printTestName(
+        "GOOGLE BENCHMARK: Insert with OrderedHashMap");
+    PV("GoogleBenchmark is not supported on this platform, skipping...")
+}
+
+static void testN2_eraseFlat()
+{
+    bmqtst::TestHelper::printTestName("GOOGLE BENCHMARK: Erase");
+    PV("GoogleBenchmark is not supported on this platform, skipping...")
+}
+
+static void testN2_eraseOrdered()
+{
+    bmqtst::TestHelper::printTestName(
+        "GOOGLE BENCHMARK: Erase with OrderedHashMap");
+    PV("GoogleBenchmark is not supported on this platform, skipping...")
+}
+
+static void testN3_iterateFlat()
+{
+    bmqtst::TestHelper::printTestName("GOOGLE BENCHMARK: Iterate");
+    PV("GoogleBenchmark is not supported on this platform, skipping...")
+}
+
+static void testN3_iterateOrdered()
+{
+    bmqtst::TestHelper::printTestName(
+        "GOOGLE BENCHMARK: Iterate with OrderedHashMap");
+    PV("GoogleBenchmark is not supported on this platform, skipping...")
+}
+#endif
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(bmqtst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 4: test4_allocation(); break;
+    case 3: test3_iteratorStability(); break;
+    case 2: test2_previousEndIterator(); break;
+    case 1: test1_breathingTest(); break;
+    case -1:
+        BMQTST_BENCHMARK_WITH_ARGS(testN1_insertFlat,
+                                   Arg(1000000)
+                                       ->Unit(benchmark::kMillisecond));
+        BMQTST_BENCHMARK_WITH_ARGS(testN1_insertOrdered,
+                                   Arg(1000000)
+                                       ->Unit(benchmark::kMillisecond));
+        break;
+    case -2:
+        BMQTST_BENCHMARK_WITH_ARGS(testN2_eraseFlat,
+                                   Arg(1000000)
+                                       ->Unit(benchmark::kMillisecond));
+        BMQTST_BENCHMARK_WITH_ARGS(testN2_eraseOrdered,
+                                   Arg(1000000)
+                                       ->Unit(benchmark::kMillisecond));
+        break;
+    case -3:
+        BMQTST_BENCHMARK_WITH_ARGS(testN3_iterateFlat,
+                                   Arg(1000000)
+                                       ->Unit(benchmark::kMillisecond));
+        BMQTST_BENCHMARK_WITH_ARGS(testN3_iterateOrdered,
+                                   Arg(1000000)
+                                       ->Unit(benchmark::kMillisecond));
+        break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        bmqtst::TestHelperUtil::testStatus() = -1;
+    } break;
+    }
+
+#ifdef BMQTST_BENCHMARK_ENABLED
+    if (_testCase < 0) {
+        benchmark::Initialize(&argc, argv);
+        benchmark::RunSpecifiedBenchmarks();
+    }
+#endif
+
+    TEST_EPILOG(bmqtst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
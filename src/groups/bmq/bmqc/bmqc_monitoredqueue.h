@@ -72,6 +72,7 @@
 #include <bsl_limits.h>
 #include <bsl_sstream.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 #include <bsla_annotations.h>
 #include <bslma_allocator.h>
 #include <bslma_usesbslmaallocator.h>
@@ -207,11 +208,13 @@ class MonitoredQueue {
     /// it or the `newState` denotes a "less full" state.
     bool setState(int newState);
 
-    /// Increment `d_queueLength` and report if necessary
-    void incrementLength();
+    /// Increment `d_queueLength` by the optionally specified `count` and
+    /// report if necessary
+    void incrementLength(bsls::Types::Int64 count = 1);
 
-    /// Decrement `d_queueLength` and report if necessary
-    void decrementLength();
+    /// Decrement `d_queueLength` by the optionally specified `count` and
+    /// report if necessary
+    void decrementLength(bsls::Types::Int64 count = 1);
 
   private:
     // NOT IMPLEMENTED
@@ -271,6 +274,14 @@ class MonitoredQueue {
     /// the queue is disabled.
     int pushBack(bslmf::MovableRef<ElementType> value);
 
+    /// Move all the elements of the specified `values` to the back of this
+    /// queue, in order, and clear `values`.  Return 0 on success, and a
+    /// nonzero value if the queue does not have room for all the elements
+    /// or is disabled.  The behavior is undefined unless the underlying
+    /// `QUEUE` provides a `pushBackBatch(bsl::vector<ElementType>*)` method
+    /// having the same contract.
+    int pushBackBatch(bsl::vector<ElementType>* values);
+
     /// Attempt to append the specified `value` to the back of this queue
     /// without blocking.  Return 0 on success, and a non-zero value if the
     /// queue is full or disabled.
@@ -294,6 +305,14 @@ class MonitoredQueue {
     /// was empty.  On failure, `value` is not changed.
     int tryPopFront(ElementType* value);
 
+    /// Attempt to remove up to the specified `maxNumItems` elements from
+    /// the front of this queue without blocking, and append them in order
+    /// to the specified `buffer`.  Return the number of elements removed.
+    /// The behavior is undefined unless the underlying `QUEUE` provides a
+    /// `tryPopFront(int, bsl::vector<ElementType>*)` method having the same
+    /// contract.
+    int tryPopFront(int maxNumItems, bsl::vector<ElementType>* buffer);
+
     /// Pop an element from the front of the queue into the specified
     /// `buffer`.  Block if there are no elements in the queue, up to the
     /// specified `timeout` *absolute* time.  Return 0 if an item was
@@ -392,9 +411,10 @@ inline bool MonitoredQueue<QUEUE, QUEUE_TRAITS>::setState(int newState)
 }
 
 template <class QUEUE, class QUEUE_TRAITS>
-inline void MonitoredQueue<QUEUE, QUEUE_TRAITS>::incrementLength()
+inline void
+MonitoredQueue<QUEUE, QUEUE_TRAITS>::incrementLength(bsls::Types::Int64 count)
 {
-    const bsls::Types::Int64 newLength = ++d_queueLength;
+    const bsls::Types::Int64 newLength = d_queueLength.add(count);
 
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
             newLength >= d_highWatermark2 &&
@@ -419,9 +439,10 @@ inline void MonitoredQueue<QUEUE, QUEUE_TRAITS>::incrementLength()
 }
 
 template <class QUEUE, class QUEUE_TRAITS>
-inline void MonitoredQueue<QUEUE, QUEUE_TRAITS>::decrementLength()
+inline void
+MonitoredQueue<QUEUE, QUEUE_TRAITS>::decrementLength(bsls::Types::Int64 count)
 {
-    const bsls::Types::Int64 newLength = --d_queueLength;
+    const bsls::Types::Int64 newLength = d_queueLength.subtract(count);
 
     if (d_state > MonitoredQueueState::e_NORMAL &&
         newLength <= d_lowWatermark) {
@@ -609,6 +630,39 @@ inline int MonitoredQueue<QUEUE, QUEUE_TRAITS>::pushBack(
     return 0;
 }
 
+template <class QUEUE, class QUEUE_TRAITS>
+inline int MonitoredQueue<QUEUE, QUEUE_TRAITS>::pushBackBatch(
+    bsl::vector<ElementType>* values)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(values);
+
+    const bsls::Types::Int64 numValues = values->size();
+    if (numElements() + numValues >= capacity()) {
+        // We've filled the queue.  Alarm
+        if (!Traits::isPushBackDisabled(d_queue) &&
+            setState(MonitoredQueueState::e_QUEUE_FILLED) &&
+            d_stateChangedCb) {
+            d_stateChangedCb(MonitoredQueueState::e_QUEUE_FILLED);
+        }
+
+        return -1;  // RETURN
+    }
+
+    if (d_queue.pushBackBatch(values) != 0) {
+        return -1;  // RETURN
+    }
+
+    incrementLength(numValues);
+
+    if (d_supportTimedOperations) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_timedOperationsMutex);
+        d_timedOperationsCondition.signal();
+    }
+
+    return 0;
+}
+
 template <class QUEUE, class QUEUE_TRAITS>
 inline int
 MonitoredQueue<QUEUE, QUEUE_TRAITS>::tryPopFront(ElementType* buffer)
@@ -627,6 +681,22 @@ MonitoredQueue<QUEUE, QUEUE_TRAITS>::tryPopFront(ElementType* buffer)
     return 0;
 }
 
+template <class QUEUE, class QUEUE_TRAITS>
+inline int MonitoredQueue<QUEUE, QUEUE_TRAITS>::tryPopFront(
+    int                       maxNumItems,
+    bsl::vector<ElementType>* buffer)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(buffer);
+
+    const int numItems = d_queue.tryPopFront(maxNumItems, buffer);
+    if (numItems != 0) {
+        decrementLength(numItems);
+    }
+
+    return numItems;
+}
+
 template <class QUEUE, class QUEUE_TRAITS>
 inline int MonitoredQueue<QUEUE, QUEUE_TRAITS>::popFront(ElementType* value)
 {
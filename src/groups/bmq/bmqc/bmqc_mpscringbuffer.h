@@ -0,0 +1,756 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// bmqc_mpscringbuffer.h                                              -*-C++-*-
+#ifndef INCLUDED_BMQC_MPSCRINGBUFFER
+#define INCLUDED_BMQC_MPSCRINGBUFFER
+
+//@PURPOSE: Provide a lock-free multi-producer single-consumer queue.
+//
+//@CLASSES:
+//  bmqc::MpscRingBuffer: lock-free MPSC queue backed by a ring buffer
+//
+//@SEE_ALSO: bdlcc_singleconsumerqueue, bmqc_monitoredqueue
+//
+//@DESCRIPTION: This component defines a mechanism, 'bmqc::MpscRingBuffer',
+// which is a queue supporting any number of concurrent producers and a single
+// consumer.  Elements are stored in a power-of-two sized array of cells, each
+// tagged with a sequence number, so that a producer claims a cell with a
+// single compare-and-swap on the shared tail and the consumer never performs
+// any atomic read-modify-write operation.
+//
+// The ring buffer is bounded, but the queue is not: when the ring buffer is
+// full, a producer appends to an overflow list protected by a mutex instead
+// of blocking.  This preserves the semantics of 'bdlcc::SingleConsumerQueue'
+// (which never blocks on push), and in particular allows the consumer thread
+// to enqueue into its own queue without risking a deadlock.  Elements pushed
+// by a given producer are always popped in the order they were pushed,
+// regardless of whether they transited through the overflow list.
+//
+// The consumer can pop several elements at once with
+// 'tryPopFront(maxNumItems, buffer)', amortizing the cost of the cache line
+// transfers over the whole batch.  Symmetrically, a producer can push several
+// elements at once with 'pushBackBatch', which claims all the needed cells
+// with a single compare-and-swap and wakes up the consumer at most once.  The
+// blocking 'popFront' first spins, then yields, and only parks the consumer on
+// a semaphore once the queue has remained empty for a while; producers only
+// pay for a wake up when the consumer is actually parked.
+//
+/// Thread Safety
+///-------------
+// 'pushBack', 'pushBackBatch', 'tryPushBack', 'disablePushBack',
+// 'enablePushBack', 'isPushBackDisabled' and 'isEmpty' may be called
+// concurrently from any thread.  'popFront', 'tryPopFront' and 'removeAll'
+// must only be called from a single consumer thread at a time.
+
+// BDE
+#include <bsl_deque.h>
+#include <bsl_vector.h>
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_default.h>
+#include <bslma_destructionutil.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_semaphore.h>
+#include <bslmt_threadutil.h>
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_keyword.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_performancehint.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace bmqc {
+
+// ====================
+// class MpscRingBuffer
+// ====================
+
+/// Lock-free multi-producer single-consumer queue of `ELEMENT`, backed by a
+/// ring buffer and spilling over to a mutex-protected list when full.
+template <class ELEMENT>
+class MpscRingBuffer {
+  public:
+    // PUBLIC TYPES
+    typedef ELEMENT value_type;
+
+  private:
+    // PRIVATE TYPES
+
+    /// A slot of the ring buffer.  `d_sequence` is equal to the position
+    /// the slot can next be written at when the slot is free, and to that
+    /// position plus one once an element has been published in the slot.
+    struct Cell {
+        bsls::AtomicUint64 d_sequence;
+
+        bsls::ObjectBuffer<ELEMENT> d_value;
+    };
+
+    // PRIVATE CLASS DATA
+
+    /// Size, in bytes, of a cache line, used to keep data written by the
+    /// producers and the consumer on separate cache lines.
+    static const int k_CACHE_LINE_SIZE = 64;
+
+    /// Number of attempts to pop an element while busy-spinning in
+    /// `popFront`, before starting to yield.
+    static const int k_NUM_SPINS = 512;
+
+    /// Number of attempts to pop an element while yielding in `popFront`,
+    /// before parking the consumer.
+    static const int k_NUM_YIELDS = 16;
+
+    // DATA
+
+    /// Position at which the next element will be pushed to the ring
+    /// buffer.  Written by the producers.
+    bsls::AtomicUint64 d_tail;
+
+    char d_tailPadding[k_CACHE_LINE_SIZE - sizeof(bsls::AtomicUint64)];
+
+    /// Position of the next element to pop from the ring buffer.  Only
+    /// written by the consumer.
+    bsls::AtomicUint64 d_head;
+
+    char d_headPadding[k_CACHE_LINE_SIZE - sizeof(bsls::AtomicUint64)];
+
+    /// Set to 1 by the consumer before it parks on `d_wakeUp`, and reset to
+    /// 0 by the first producer which pushes an element afterwards.
+    bsls::AtomicInt d_consumerParked;
+
+    /// Number of elements in `d_overflow`.  While non-zero, producers push
+    /// to the overflow list, so that the elements of each producer are
+    /// popped in order.
+    bsls::AtomicInt d_overflowSize;
+
+    /// Whether pushing to this queue is disabled.
+    bsls::AtomicBool d_pushBackDisabled;
+
+    /// Semaphore the consumer is parked on while the queue is empty.
+    bslmt::Semaphore d_wakeUp;
+
+    /// Mutex protecting `d_overflow`.
+    bslmt::Mutex d_overflowMutex;
+
+    /// Elements pushed while the ring buffer was full.
+    bsl::deque<ELEMENT> d_overflow;
+
+    /// Ring buffer of `d_mask + 1` cells.
+    Cell* d_cells_p;
+
+    /// Number of cells in the ring buffer minus one.
+    bsls::Types::Uint64 d_mask;
+
+    /// Allocator to use.
+    bslma::Allocator* d_allocator_p;
+
+  private:
+    // PRIVATE MANIPULATORS
+
+    /// Claim a cell of the ring buffer and load its position into the
+    /// specified `position`.  Return the claimed cell, or 0 if the ring
+    /// buffer is full.
+    Cell* claimCell(bsls::Types::Uint64* position);
+
+    /// Claim the specified `numCells` consecutive cells of the ring buffer
+    /// and load the position of the first one into the specified
+    /// `position`.  Return `true` on success, and `false` if the ring
+    /// buffer does not have `numCells` free cells.  The behavior is
+    /// undefined unless `0 < numCells <= capacity()`.
+    bool claimCells(bsls::Types::Uint64* position,
+                    bsls::Types::Uint64  numCells);
+
+    /// Publish the specified `cell`, claimed at the specified `position`,
+    /// and wake up the consumer if it is parked.
+    void publishCell(Cell* cell, bsls::Types::Uint64 position);
+
+    /// Append the specified `value` to the overflow list.  Return 0 on
+    /// success and a non-zero value if pushing is disabled.
+    int pushOverflow(const ELEMENT& value);
+    int pushOverflow(bslmf::MovableRef<ELEMENT> value);
+
+    /// Move all the elements of the specified `values` to the overflow
+    /// list.  Return 0 on success and a non-zero value if pushing is
+    /// disabled, in which case `values` is not modified.
+    int pushOverflow(bsl::vector<ELEMENT>* values);
+
+    /// Pop the element at the front of the ring buffer into the specified
+    /// `value`.  Return 0 on success, and a non-zero value if the ring
+    /// buffer is empty.
+    int popRing(ELEMENT* value);
+
+    /// Pop the element at the front of the overflow list into the specified
+    /// `value`.  Return 0 on success, and a non-zero value if both the
+    /// ring buffer and the overflow list are empty, or if a cell of the
+    /// ring buffer has been claimed but not published yet.  Note that any
+    /// element which made it to the ring buffer before the front element of
+    /// the overflow list was pushed is popped first.
+    int popOverflow(ELEMENT* value);
+
+    /// Wake up the consumer if it is parked.
+    void wakeUpConsumer();
+
+  private:
+    // NOT IMPLEMENTED
+    MpscRingBuffer(const MpscRingBuffer&) BSLS_KEYWORD_DELETED;
+    MpscRingBuffer& operator=(const MpscRingBuffer&) BSLS_KEYWORD_DELETED;
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(MpscRingBuffer, bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create a `MpscRingBuffer` whose ring buffer holds at least the
+    /// specified `capacity` elements, rounded up to a power of two.  Use
+    /// the optionally specified `basicAllocator` to supply memory.  The
+    /// behavior is undefined unless `0 < capacity`.
+    explicit MpscRingBuffer(int               capacity,
+                            bslma::Allocator* basicAllocator = 0);
+
+    /// Destroy this object and any element it still contains.
+    ~MpscRingBuffer();
+
+    // MANIPULATORS
+
+    /// Append the specified `value` to the back of this queue.  This method
+    /// never blocks: if the ring buffer is full, `value` is appended to the
+    /// overflow list.  Return 0 on success, and a non-zero value if pushing
+    /// is disabled.
+    int pushBack(const ELEMENT& value);
+
+    /// Append the specified move-insertable `value` to the back of this
+    /// queue.  This method never blocks: if the ring buffer is full,
+    /// `value` is appended to the overflow list.  Return 0 on success, and
+    /// a non-zero value if pushing is disabled.
+    int pushBack(bslmf::MovableRef<ELEMENT> value);
+
+    /// Move all the elements of the specified `values` to the back of this
+    /// queue, in order, and clear `values`.  The elements are published
+    /// with a single claim of the ring buffer and the consumer is woken up
+    /// at most once.  This method never blocks: if the ring buffer cannot
+    /// hold all the elements, they are appended to the overflow list.
+    /// Return 0 on success, and a non-zero value if pushing is disabled, in
+    /// which case `values` is not modified.
+    int pushBackBatch(bsl::vector<ELEMENT>* values);
+
+    /// Equivalent to `pushBack(value)`; provided for interface
+    /// compatibility with `bdlcc::SingleConsumerQueue`.
+    int tryPushBack(const ELEMENT& value);
+    int tryPushBack(bslmf::MovableRef<ELEMENT> value);
+
+    /// Remove the element from the front of this queue and load it into the
+    /// specified `value`, spinning, yielding and finally blocking until
+    /// this queue is not empty.  Return 0.
+    int popFront(ELEMENT* value);
+
+    /// Attempt to remove the element from the front of this queue without
+    /// blocking and, if successful, load it into the specified `value`.
+    /// Return 0 on success, and a non-zero value if this queue is empty or
+    /// if the element at its front is still being pushed by a producer.
+    int tryPopFront(ELEMENT* value);
+
+    /// Remove up to the specified `maxNumItems` elements from the front of
+    /// this queue without blocking and append them, in order, to the
+    /// specified `buffer`, stopping at the first element still being pushed
+    /// by a producer.  Return the number of elements appended.
+    int tryPopFront(int maxNumItems, bsl::vector<ELEMENT>* buffer);
+
+    /// Remove and destroy all elements of this queue.
+    void removeAll();
+
+    /// Disable pushing to this queue: all subsequent calls to `pushBack`
+    /// and `tryPushBack` fail until `enablePushBack` is called.
+    void disablePushBack();
+
+    /// Enable pushing to this queue.
+    void enablePushBack();
+
+    // ACCESSORS
+
+    /// Return the number of cells of the ring buffer.  Note that the queue
+    /// itself is unbounded.
+    int capacity() const;
+
+    /// Return `true` if this queue is empty, and `false` otherwise.
+    bool isEmpty() const;
+
+    /// Return `true` if pushing to this queue is disabled, and `false`
+    /// otherwise.
+    bool isPushBackDisabled() const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// --------------------
+// class MpscRingBuffer
+// --------------------
+
+// PRIVATE MANIPULATORS
+template <class ELEMENT>
+inline typename MpscRingBuffer<ELEMENT>::Cell*
+MpscRingBuffer<ELEMENT>::claimCell(bsls::Types::Uint64* position)
+{
+    if (!claimCells(position, 1)) {
+        return 0;  // RETURN
+    }
+
+    return &d_cells_p[*position & d_mask];
+}
+
+template <class ELEMENT>
+inline bool
+MpscRingBuffer<ELEMENT>::claimCells(bsls::Types::Uint64* position,
+                                    bsls::Types::Uint64  numCells)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 < numCells && numCells <= d_mask + 1);
+
+    bsls::Types::Uint64 pos = d_tail.loadRelaxed();
+    while (true) {
+        // The consumer frees the cells in order, so if the last cell of the
+        // range is free, so are all the cells before it.
+        const bsls::Types::Uint64 last = pos + numCells - 1;
+        const bsls::Types::Uint64 seq =
+            d_cells_p[last & d_mask].d_sequence.loadAcquire();
+        const bsls::Types::Int64 diff = static_cast<bsls::Types::Int64>(seq -
+                                                                       last);
+        if (diff == 0) {
+            const bsls::Types::Uint64 next = pos + numCells;
+            const bsls::Types::Uint64 prev = d_tail.testAndSwap(pos, next);
+            if (prev == pos) {
+                *position = pos;
+                return true;  // RETURN
+            }
+            pos = prev;
+        }
+        else if (diff < 0) {
+            // The cell still holds the element pushed one lap ago: the ring
+            // buffer is full.
+            return false;  // RETURN
+        }
+        else {
+            pos = d_tail.loadRelaxed();
+        }
+    }
+}
+
+template <class ELEMENT>
+inline void MpscRingBuffer<ELEMENT>::publishCell(Cell*               cell,
+                                                 bsls::Types::Uint64 position)
+{
+    // Sequentially consistent store, so that it is ordered before the load
+    // of 'd_consumerParked' in 'wakeUpConsumer'.
+    cell->d_sequence.store(position + 1);
+    wakeUpConsumer();
+}
+
+template <class ELEMENT>
+int MpscRingBuffer<ELEMENT>::pushOverflow(const ELEMENT& value)
+{
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_overflowMutex);  // LOCK
+        if (d_pushBackDisabled.load()) {
+            return -1;  // RETURN
+        }
+        d_overflow.push_back(value);
+        d_overflowSize.add(1);
+    }  // UNLOCK
+
+    wakeUpConsumer();
+    return 0;
+}
+
+template <class ELEMENT>
+int MpscRingBuffer<ELEMENT>::pushOverflow(bslmf::MovableRef<ELEMENT> value)
+{
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_overflowMutex);  // LOCK
+        if (d_pushBackDisabled.load()) {
+            return -1;  // RETURN
+        }
+        d_overflow.push_back(bslmf::MovableRefUtil::move(value));
+        d_overflowSize.add(1);
+    }  // UNLOCK
+
+    wakeUpConsumer();
+    return 0;
+}
+
+template <class ELEMENT>
+int MpscRingBuffer<ELEMENT>::pushOverflow(bsl::vector<ELEMENT>* values)
+{
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_overflowMutex);  // LOCK
+        if (d_pushBackDisabled.load()) {
+            return -1;  // RETURN
+        }
+        for (size_t i = 0; i < values->size(); ++i) {
+            d_overflow.push_back(bslmf::MovableRefUtil::move((*values)[i]));
+        }
+        d_overflowSize.add(static_cast<int>(values->size()));
+    }  // UNLOCK
+
+    values->clear();
+    wakeUpConsumer();
+    return 0;
+}
+
+template <class ELEMENT>
+inline int MpscRingBuffer<ELEMENT>::popRing(ELEMENT* value)
+{
+    const bsls::Types::Uint64 pos  = d_head.loadRelaxed();
+    Cell&                     cell = d_cells_p[pos & d_mask];
+    if (cell.d_sequence.loadAcquire() != pos + 1) {
+        // Either empty, or the producer which claimed this cell has not
+        // published it yet.
+        return -1;  // RETURN
+    }
+
+    *value = bslmf::MovableRefUtil::move(cell.d_value.object());
+    bslma::DestructionUtil::destroy(cell.d_value.address());
+
+    cell.d_sequence.storeRelease(pos + d_mask + 1);
+    d_head.storeRelaxed(pos + 1);
+
+    return 0;
+}
+
+template <class ELEMENT>
+int MpscRingBuffer<ELEMENT>::popOverflow(ELEMENT* value)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_overflowMutex);  // LOCK
+
+    // A producer only pushes to the overflow list after having published
+    // its previous elements, if any, to the ring buffer.  Locking the mutex
+    // makes those publications visible, so drain them first to preserve
+    // the order of elements of each producer.
+    if (popRing(value) == 0) {
+        return 0;  // RETURN
+    }
+
+    // The cell at the head of the ring buffer may have been claimed by a
+    // producer which has not published it yet, while the cells after it
+    // have already been published by other producers, who then pushed to
+    // the overflow list.  Wait for the ring buffer to be fully drained, so
+    // that none of these cells is popped after the overflow list.
+    if (d_tail.loadAcquire() != d_head.loadRelaxed()) {
+        return -1;  // RETURN
+    }
+
+    if (d_overflow.empty()) {
+        return -1;  // RETURN
+    }
+
+    *value = bslmf::MovableRefUtil::move(d_overflow.front());
+    d_overflow.pop_front();
+    d_overflowSize.addRelaxed(-1);
+
+    return 0;
+}
+
+template <class ELEMENT>
+inline void MpscRingBuffer<ELEMENT>::wakeUpConsumer()
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_consumerParked.load() != 0)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        if (d_consumerParked.testAndSwap(1, 0) == 1) {
+            d_wakeUp.post();
+        }
+    }
+}
+
+// CREATORS
+template <class ELEMENT>
+MpscRingBuffer<ELEMENT>::MpscRingBuffer(int               capacity,
+                                        bslma::Allocator* basicAllocator)
+: d_tail(0)
+, d_head(0)
+, d_consumerParked(0)
+, d_overflowSize(0)
+, d_pushBackDisabled(false)
+, d_wakeUp()
+, d_overflowMutex()
+, d_overflow(basicAllocator)
+, d_cells_p(0)
+, d_mask(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(0 < capacity);
+
+    bsls::Types::Uint64 numCells = 1;
+    while (numCells < static_cast<bsls::Types::Uint64>(capacity)) {
+        numCells <<= 1;
+    }
+    d_mask = numCells - 1;
+
+    d_cells_p = static_cast<Cell*>(
+        d_allocator_p->allocate(numCells * sizeof(Cell)));
+    for (bsls::Types::Uint64 i = 0; i < numCells; ++i) {
+        new (&d_cells_p[i]) Cell();
+        d_cells_p[i].d_sequence.storeRelaxed(i);
+    }
+}
+
+template <class ELEMENT>
+MpscRingBuffer<ELEMENT>::~MpscRingBuffer()
+{
+    removeAll();
+
+    for (bsls::Types::Uint64 i = 0; i <= d_mask; ++i) {
+        d_cells_p[i].~Cell();
+    }
+    d_allocator_p->deallocate(d_cells_p);
+}
+
+// MANIPULATORS
+template <class ELEMENT>
+inline int MpscRingBuffer<ELEMENT>::pushBack(const ELEMENT& value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_pushBackDisabled.load())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return -1;  // RETURN
+    }
+
+    bsls::Types::Uint64 position;
+    Cell*               cell = 0;
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_overflowSize.loadAcquire() ==
+                                            0)) {
+        cell = claimCell(&position);
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(cell == 0)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return pushOverflow(value);  // RETURN
+    }
+
+    bslma::ConstructionUtil::construct(cell->d_value.address(),
+                                       d_allocator_p,
+                                       value);
+    publishCell(cell, position);
+
+    return 0;
+}
+
+template <class ELEMENT>
+inline int
+MpscRingBuffer<ELEMENT>::pushBack(bslmf::MovableRef<ELEMENT> value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_pushBackDisabled.load())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return -1;  // RETURN
+    }
+
+    bsls::Types::Uint64 position;
+    Cell*               cell = 0;
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_overflowSize.loadAcquire() ==
+                                            0)) {
+        cell = claimCell(&position);
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(cell == 0)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return pushOverflow(bslmf::MovableRefUtil::move(value));  // RETURN
+    }
+
+    bslma::ConstructionUtil::construct(cell->d_value.address(),
+                                       d_allocator_p,
+                                       bslmf::MovableRefUtil::move(value));
+    publishCell(cell, position);
+
+    return 0;
+}
+
+template <class ELEMENT>
+int MpscRingBuffer<ELEMENT>::pushBackBatch(bsl::vector<ELEMENT>* values)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(values);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_pushBackDisabled.load())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return -1;  // RETURN
+    }
+
+    const bsls::Types::Uint64 numValues = values->size();
+    if (numValues == 0) {
+        return 0;  // RETURN
+    }
+
+    bsls::Types::Uint64 position;
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+            numValues > d_mask + 1 || d_overflowSize.loadAcquire() != 0 ||
+            !claimCells(&position, numValues))) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return pushOverflow(values);  // RETURN
+    }
+
+    for (bsls::Types::Uint64 i = 0; i < numValues; ++i) {
+        Cell& cell = d_cells_p[(position + i) & d_mask];
+        bslma::ConstructionUtil::construct(
+            cell.d_value.address(),
+            d_allocator_p,
+            bslmf::MovableRefUtil::move((*values)[i]));
+
+        // Sequentially consistent store, as in 'publishCell'.
+        cell.d_sequence.store(position + i + 1);
+    }
+    wakeUpConsumer();
+
+    values->clear();
+    return 0;
+}
+
+template <class ELEMENT>
+inline int MpscRingBuffer<ELEMENT>::tryPushBack(const ELEMENT& value)
+{
+    return pushBack(value);
+}
+
+template <class ELEMENT>
+inline int
+MpscRingBuffer<ELEMENT>::tryPushBack(bslmf::MovableRef<ELEMENT> value)
+{
+    return pushBack(bslmf::MovableRefUtil::move(value));
+}
+
+template <class ELEMENT>
+int MpscRingBuffer<ELEMENT>::popFront(ELEMENT* value)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(value);
+
+    for (int i = 0; i < k_NUM_SPINS; ++i) {
+        if (tryPopFront(value) == 0) {
+            return 0;  // RETURN
+        }
+    }
+
+    for (int i = 0; i < k_NUM_YIELDS; ++i) {
+        bslmt::ThreadUtil::yield();
+        if (tryPopFront(value) == 0) {
+            return 0;  // RETURN
+        }
+    }
+
+    while (true) {
+        // Sequentially consistent store, so that it is ordered before the
+        // loads in 'tryPopFront': either a producer sees the consumer as
+        // parked and posts 'd_wakeUp', or the consumer sees its element.
+        d_consumerParked.store(1);
+        if (tryPopFront(value) == 0) {
+            d_consumerParked.store(0);
+            return 0;  // RETURN
+        }
+
+        // Note that a spurious wake up (a post from a producer which raced
+        // with a successful 'tryPopFront' above) only costs one more
+        // iteration.
+        d_wakeUp.wait();
+    }
+}
+
+template <class ELEMENT>
+inline int MpscRingBuffer<ELEMENT>::tryPopFront(ELEMENT* value)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(value);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(popRing(value) == 0)) {
+        return 0;  // RETURN
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_overflowSize.loadAcquire() ==
+                                            0)) {
+        return -1;  // RETURN
+    }
+
+    return popOverflow(value);
+}
+
+template <class ELEMENT>
+int MpscRingBuffer<ELEMENT>::tryPopFront(int                    maxNumItems,
+                                         bsl::vector<ELEMENT>* buffer)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(buffer);
+
+    int     numItems = 0;
+    ELEMENT value;
+    while (numItems < maxNumItems && tryPopFront(&value) == 0) {
+        buffer->push_back(bslmf::MovableRefUtil::move(value));
+        ++numItems;
+    }
+
+    return numItems;
+}
+
+template <class ELEMENT>
+void MpscRingBuffer<ELEMENT>::removeAll()
+{
+    ELEMENT value;
+    while (tryPopFront(&value) == 0) {
+        // NOTHING
+    }
+}
+
+template <class ELEMENT>
+inline void MpscRingBuffer<ELEMENT>::disablePushBack()
+{
+    // Lock so that no element is pushed to the overflow list once this
+    // method returns.
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_overflowMutex);  // LOCK
+    d_pushBackDisabled.store(true);
+}
+
+template <class ELEMENT>
+inline void MpscRingBuffer<ELEMENT>::enablePushBack()
+{
+    d_pushBackDisabled.store(false);
+}
+
+// ACCESSORS
+template <class ELEMENT>
+inline int MpscRingBuffer<ELEMENT>::capacity() const
+{
+    return static_cast<int>(d_mask + 1);
+}
+
+template <class ELEMENT>
+inline bool MpscRingBuffer<ELEMENT>::isEmpty() const
+{
+    const bsls::Types::Uint64 pos = d_head.loadRelaxed();
+    return d_cells_p[pos & d_mask].d_sequence.loadAcquire() != pos + 1 &&
+           d_overflowSize.loadAcquire() == 0;
+}
+
+template <class ELEMENT>
+inline bool MpscRingBuffer<ELEMENT>::isPushBackDisabled() const
+{
+    return d_pushBackDisabled.load();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
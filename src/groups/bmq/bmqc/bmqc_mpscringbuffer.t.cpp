@@ -0,0 +1,514 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// bmqc_mpscringbuffer.t.cpp                                          -*-C++-*-
+#include <bmqc_mpscringbuffer.h>
+
+// BDE
+#include <bdlf_bind.h>
+#include <bsl_memory.h>
+#include <bsl_vector.h>
+#include <bslmt_semaphore.h>
+#include <bslmt_threadutil.h>
+#include <bsls_assert.h>
+
+// TEST DRIVER
+#include <bmqtst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+namespace {
+
+typedef bmqc::MpscRingBuffer<int> IntRingBuffer;
+
+/// Number of bits of a pushed value holding the sequence number of the
+/// value for its producer; the remaining upper bits hold the producer id.
+const int k_SEQUENCE_BITS = 20;
+
+/// Push the specified `numItems` values to the specified `queue`, each
+/// encoding the specified `producerId` and its sequence number.
+void producerThread(IntRingBuffer* queue, int producerId, int numItems)
+{
+    for (int i = 0; i < numItems; ++i) {
+        BSLS_ASSERT_OPT(queue->pushBack((producerId << k_SEQUENCE_BITS) |
+                                        i) == 0);
+    }
+}
+
+/// Pop values from the specified `queue` with `tryPopFront`, without ever
+/// blocking, until the specified `numItems` values have been popped, and
+/// verify that the values of each of the specified `numProducers` producers
+/// are popped in order.
+void consumeAndVerify(IntRingBuffer* queue, int numProducers, int numItems)
+{
+    bsl::vector<int> nextSequence(numProducers,
+                                  0,
+                                  bmqtst::TestHelperUtil::allocator());
+    bsl::vector<int> batch(bmqtst::TestHelperUtil::allocator());
+
+    int numPopped = 0;
+    while (numPopped < numItems) {
+        batch.clear();
+        queue->tryPopFront(16, &batch);
+        for (size_t i = 0; i < batch.size(); ++i) {
+            const int producerId = batch[i] >> k_SEQUENCE_BITS;
+            const int sequence   = batch[i] & ((1 << k_SEQUENCE_BITS) - 1);
+            BMQTST_ASSERT_LT(producerId, numProducers);
+            BMQTST_ASSERT_EQ_D(producerId,
+                               sequence,
+                               nextSequence[producerId]);
+            nextSequence[producerId] = sequence + 1;
+        }
+        numPopped += static_cast<int>(batch.size());
+    }
+}
+
+// ==========
+// class Item
+// ==========
+
+/// Element whose copy from an item holding a gate blocks until the gate is
+/// opened, allowing to suspend a producer between the claim of a cell of
+/// the ring buffer and its publication.
+class Item {
+  private:
+    // DATA
+
+    /// Value of this item.
+    int d_value;
+
+    /// Semaphore posted when starting to copy this item, if any.
+    bslmt::Semaphore* d_entered_p;
+
+    /// Semaphore to wait on when copying this item, if any.
+    bslmt::Semaphore* d_gate_p;
+
+  public:
+    // CREATORS
+    explicit Item(int               value   = -1,
+                  bslmt::Semaphore* entered = 0,
+                  bslmt::Semaphore* gate    = 0)
+    : d_value(value)
+    , d_entered_p(entered)
+    , d_gate_p(gate)
+    {
+    }
+
+    Item(const Item& original)
+    : d_value(original.d_value)
+    , d_entered_p(0)
+    , d_gate_p(0)
+    {
+        if (original.d_gate_p) {
+            original.d_entered_p->post();
+            original.d_gate_p->wait();
+        }
+    }
+
+    // MANIPULATORS
+    Item& operator=(const Item& rhs)
+    {
+        d_value     = rhs.d_value;
+        d_entered_p = 0;
+        d_gate_p    = 0;
+        return *this;
+    }
+
+    // ACCESSORS
+    int value() const { return d_value; }
+};
+
+/// Push to the specified `queue` an item having the specified `value`,
+/// whose copy posts the specified `entered` semaphore and waits on the
+/// specified `gate` one.
+void pushGatedItem(bmqc::MpscRingBuffer<Item>* queue,
+                   int                         value,
+                   bslmt::Semaphore*           entered,
+                   bslmt::Semaphore*           gate)
+{
+    const Item item(value, entered, gate);
+    BSLS_ASSERT_OPT(queue->pushBack(item) == 0);
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   Exercise the basic functionality of the component.
+//
+// Testing:
+//   MpscRingBuffer(int, bslma::Allocator*)
+//   pushBack(const ELEMENT&)
+//   tryPopFront(ELEMENT*)
+//   popFront(ELEMENT*)
+//   disablePushBack()
+//   enablePushBack()
+//   capacity()
+//   isEmpty()
+//   isPushBackDisabled()
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("BREATHING TEST");
+
+    IntRingBuffer obj(5, bmqtst::TestHelperUtil::allocator());
+
+    // Capacity is rounded up to a power of two
+    BMQTST_ASSERT_EQ(obj.capacity(), 8);
+    BMQTST_ASSERT(obj.isEmpty());
+    BMQTST_ASSERT(!obj.isPushBackDisabled());
+
+    int value = -1;
+    BMQTST_ASSERT_NE(obj.tryPopFront(&value), 0);
+    BMQTST_ASSERT_EQ(value, -1);
+
+    BMQTST_ASSERT_EQ(obj.pushBack(1), 0);
+    BMQTST_ASSERT_EQ(obj.tryPushBack(2), 0);
+    BMQTST_ASSERT(!obj.isEmpty());
+
+    BMQTST_ASSERT_EQ(obj.tryPopFront(&value), 0);
+    BMQTST_ASSERT_EQ(value, 1);
+    BMQTST_ASSERT_EQ(obj.popFront(&value), 0);
+    BMQTST_ASSERT_EQ(value, 2);
+    BMQTST_ASSERT(obj.isEmpty());
+
+    obj.disablePushBack();
+    BMQTST_ASSERT(obj.isPushBackDisabled());
+    BMQTST_ASSERT_NE(obj.pushBack(3), 0);
+    BMQTST_ASSERT(obj.isEmpty());
+
+    obj.enablePushBack();
+    BMQTST_ASSERT(!obj.isPushBackDisabled());
+    BMQTST_ASSERT_EQ(obj.pushBack(4), 0);
+    BMQTST_ASSERT_EQ(obj.tryPopFront(&value), 0);
+    BMQTST_ASSERT_EQ(value, 4);
+}
+
+static void test2_overflow()
+// ------------------------------------------------------------------------
+// OVERFLOW
+//
+// Concerns:
+//   1. Pushing to a full ring buffer does not block nor fail, and the
+//      elements are spilled to the overflow list.
+//   2. Elements are popped in order, whether they transited through the
+//      ring buffer or the overflow list.
+//   3. Batch popping returns at most the requested number of elements.
+//   4. Remaining elements are destroyed by 'removeAll' and on destruction.
+//
+// Testing:
+//   tryPopFront(int, bsl::vector<ELEMENT>*)
+//   removeAll()
+//   ~MpscRingBuffer()
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("OVERFLOW");
+
+    bslma::Allocator* alloc = bmqtst::TestHelperUtil::allocator();
+
+    {
+        // 1. & 2. & 3.
+        IntRingBuffer obj(4, alloc);
+
+        const int k_NUM_ITEMS = 100;
+        for (int i = 0; i < k_NUM_ITEMS; ++i) {
+            BMQTST_ASSERT_EQ(obj.pushBack(i), 0);
+        }
+
+        bsl::vector<int> batch(alloc);
+        int              expected = 0;
+        while (expected < k_NUM_ITEMS) {
+            batch.clear();
+            const int numItems = obj.tryPopFront(16, &batch);
+            BMQTST_ASSERT_EQ(numItems, static_cast<int>(batch.size()));
+            BMQTST_ASSERT_LE(numItems, 16);
+            BMQTST_ASSERT_GT(numItems, 0);
+
+            for (size_t i = 0; i < batch.size(); ++i) {
+                BMQTST_ASSERT_EQ(batch[i], expected++);
+            }
+
+            // Interleave pushes while the overflow list is being drained
+            if (expected == 32) {
+                BMQTST_ASSERT_EQ(obj.pushBack(k_NUM_ITEMS), 0);
+            }
+        }
+
+        batch.clear();
+        BMQTST_ASSERT_EQ(obj.tryPopFront(16, &batch), 1);
+        BMQTST_ASSERT_EQ(batch[0], k_NUM_ITEMS);
+        BMQTST_ASSERT(obj.isEmpty());
+        BMQTST_ASSERT_EQ(obj.tryPopFront(16, &batch), 0);
+    }
+
+    {
+        // 4.
+        bmqc::MpscRingBuffer<bsl::shared_ptr<int> > obj(2, alloc);
+
+        for (int i = 0; i < 10; ++i) {
+            BMQTST_ASSERT_EQ(obj.pushBack(bsl::allocate_shared<int>(alloc, i)),
+                             0);
+        }
+
+        obj.removeAll();
+        BMQTST_ASSERT(obj.isEmpty());
+
+        for (int i = 0; i < 10; ++i) {
+            BMQTST_ASSERT_EQ(obj.pushBack(bsl::allocate_shared<int>(alloc, i)),
+                             0);
+        }
+
+        // The remaining elements are destroyed with 'obj', which is verified
+        // by the allocator checks of the test driver.
+    }
+}
+
+static void test3_multipleProducers()
+// ------------------------------------------------------------------------
+// MULTIPLE PRODUCERS
+//
+// Concerns:
+//   Concurrent producers pushing to a small ring buffer, such that the
+//   overflow list is frequently used, with a consumer blocked in
+//   'popFront':
+//   1. No element is lost or duplicated.
+//   2. The elements of each producer are popped in the order they were
+//      pushed.
+//
+// Testing:
+//   pushBack(const ELEMENT&)
+//   popFront(ELEMENT*)
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("MULTIPLE PRODUCERS");
+
+    bslma::Allocator* alloc = bmqtst::TestHelperUtil::allocator();
+
+    const int k_NUM_PRODUCERS = 4;
+    const int k_NUM_ITEMS     = 100000;
+
+    IntRingBuffer obj(64, alloc);
+
+    bsl::vector<bslmt::ThreadUtil::Handle> handles(k_NUM_PRODUCERS, alloc);
+    for (int i = 0; i < k_NUM_PRODUCERS; ++i) {
+        const int rc = bslmt::ThreadUtil::createWithAllocator(
+            &handles[i],
+            bdlf::BindUtil::bind(&producerThread, &obj, i, k_NUM_ITEMS),
+            alloc);
+        BSLS_ASSERT_OPT(rc == 0);
+    }
+
+    bsl::vector<int> nextSequence(k_NUM_PRODUCERS, 0, alloc);
+    for (int i = 0; i < k_NUM_PRODUCERS * k_NUM_ITEMS; ++i) {
+        int value = -1;
+        BMQTST_ASSERT_EQ(obj.popFront(&value), 0);
+
+        const int producerId = value >> k_SEQUENCE_BITS;
+        const int sequence   = value & ((1 << k_SEQUENCE_BITS) - 1);
+        BMQTST_ASSERT_LT(producerId, k_NUM_PRODUCERS);
+        BMQTST_ASSERT_EQ_D(producerId, sequence, nextSequence[producerId]);
+        nextSequence[producerId] = sequence + 1;
+    }
+
+    for (int i = 0; i < k_NUM_PRODUCERS; ++i) {
+        bslmt::ThreadUtil::join(handles[i]);
+        BMQTST_ASSERT_EQ(nextSequence[i], k_NUM_ITEMS);
+    }
+    BMQTST_ASSERT(obj.isEmpty());
+}
+
+static void test4_pushBackBatch()
+// ------------------------------------------------------------------------
+// PUSH BACK BATCH
+//
+// Concerns:
+//   1. A batch fitting in the ring buffer is pushed to it, and the input
+//      vector is cleared.
+//   2. A batch not fitting in the ring buffer, or larger than the ring
+//      buffer, is pushed to the overflow list without being split.
+//   3. Elements are popped in order, whether they were pushed one by one
+//      or in batches.
+//   4. Pushing a batch to a disabled queue fails and leaves the batch
+//      untouched.
+//
+// Testing:
+//   pushBackBatch(bsl::vector<ELEMENT>*)
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("PUSH BACK BATCH");
+
+    bslma::Allocator* alloc = bmqtst::TestHelperUtil::allocator();
+
+    IntRingBuffer    obj(8, alloc);
+    bsl::vector<int> batch(alloc);
+    bsl::vector<int> popped(alloc);
+    int              next = 0;
+
+    // 1.
+    for (int i = 0; i < 5; ++i) {
+        batch.push_back(next++);
+    }
+    BMQTST_ASSERT_EQ(obj.pushBackBatch(&batch), 0);
+    BMQTST_ASSERT(batch.empty());
+    BMQTST_ASSERT_EQ(obj.pushBack(next++), 0);
+
+    // 2.
+    for (int i = 0; i < 5; ++i) {
+        batch.push_back(next++);
+    }
+    BMQTST_ASSERT_EQ(obj.pushBackBatch(&batch), 0);
+    BMQTST_ASSERT(batch.empty());
+
+    for (int i = 0; i < 20; ++i) {
+        batch.push_back(next++);
+    }
+    BMQTST_ASSERT_EQ(obj.pushBackBatch(&batch), 0);
+    BMQTST_ASSERT(batch.empty());
+
+    // Empty batches are no-ops
+    BMQTST_ASSERT_EQ(obj.pushBackBatch(&batch), 0);
+
+    // 3.
+    BMQTST_ASSERT_EQ(obj.tryPopFront(100, &popped), next);
+    for (int i = 0; i < next; ++i) {
+        BMQTST_ASSERT_EQ_D(i, popped[i], i);
+    }
+    BMQTST_ASSERT(obj.isEmpty());
+
+    // 4.
+    obj.disablePushBack();
+    batch.push_back(next);
+    BMQTST_ASSERT_NE(obj.pushBackBatch(&batch), 0);
+    BMQTST_ASSERT_EQ(batch.size(), 1u);
+    BMQTST_ASSERT_EQ(batch[0], next);
+    BMQTST_ASSERT(obj.isEmpty());
+}
+
+static void test5_unpublishedCell()
+// ------------------------------------------------------------------------
+// UNPUBLISHED CELL
+//
+// Concerns:
+//   1. While a producer has claimed the cell at the head of the ring
+//      buffer but not published it yet, the elements pushed to the
+//      overflow list are not popped, so that they do not overtake the
+//      elements published in the following cells by other producers.
+//   2. Concurrent producers pushing to a tiny ring buffer, with a consumer
+//      which never blocks, see the elements of each producer popped in
+//      the order they were pushed.
+//
+// Testing:
+//   tryPopFront(ELEMENT*)
+//   tryPopFront(int, bsl::vector<ELEMENT>*)
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("UNPUBLISHED CELL");
+
+    bslma::Allocator* alloc = bmqtst::TestHelperUtil::allocator();
+
+    {
+        // 1.
+        bmqc::MpscRingBuffer<Item> obj(2, alloc);
+
+        // Suspend a producer after it has claimed the first cell.
+        bslmt::Semaphore entered;
+        bslmt::Semaphore gate;
+
+        bslmt::ThreadUtil::Handle handle;
+        const int                 rc = bslmt::ThreadUtil::createWithAllocator(
+            &handle,
+            bdlf::BindUtil::bind(&pushGatedItem, &obj, 0, &entered, &gate),
+            alloc);
+        BSLS_ASSERT_OPT(rc == 0);
+        entered.wait();
+
+        // Fill the second cell, and spill to the overflow list.
+        BMQTST_ASSERT_EQ(obj.pushBack(Item(1)), 0);
+        BMQTST_ASSERT_EQ(obj.pushBack(Item(2)), 0);
+
+        Item item;
+        BMQTST_ASSERT_NE(obj.tryPopFront(&item), 0);
+        BMQTST_ASSERT_EQ(item.value(), -1);
+
+        gate.post();
+        bslmt::ThreadUtil::join(handle);
+
+        for (int i = 0; i < 3; ++i) {
+            BMQTST_ASSERT_EQ_D(i, obj.tryPopFront(&item), 0);
+            BMQTST_ASSERT_EQ_D(i, item.value(), i);
+        }
+        BMQTST_ASSERT(obj.isEmpty());
+    }
+
+    {
+        // 2.
+        const int k_NUM_PRODUCERS = 8;
+        const int k_NUM_ITEMS     = 50000;
+
+        IntRingBuffer obj(2, alloc);
+
+        bsl::vector<bslmt::ThreadUtil::Handle> handles(k_NUM_PRODUCERS,
+                                                       alloc);
+        for (int i = 0; i < k_NUM_PRODUCERS; ++i) {
+            const int rc = bslmt::ThreadUtil::createWithAllocator(
+                &handles[i],
+                bdlf::BindUtil::bind(&producerThread, &obj, i, k_NUM_ITEMS),
+                alloc);
+            BSLS_ASSERT_OPT(rc == 0);
+        }
+
+        consumeAndVerify(&obj, k_NUM_PRODUCERS, k_NUM_PRODUCERS * k_NUM_ITEMS);
+
+        for (int i = 0; i < k_NUM_PRODUCERS; ++i) {
+            bslmt::ThreadUtil::join(handles[i]);
+        }
+        BMQTST_ASSERT(obj.isEmpty());
+    }
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(bmqtst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 5: test5_unpublishedCell(); break;
+    case 4: test4_pushBackBatch(); break;
+    case 3: test3_multipleProducers(); break;
+    case 2: test2_overflow(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        bmqtst::TestHelperUtil::testStatus() = -1;
+    } break;
+    }
+
+    TEST_EPILOG(bmqtst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
@@ -23,6 +23,7 @@
 //@CLASSES:
 //  bmqc::MultiQueueThreadPool: Queues processed by a thread pool
 //  bmqc::MultiQueueThreadPoolConfig: Configuration for a MQTP
+//  bmqc::MultiQueueThreadPoolQueueOptions: Options for a queue of a MQTP
 //
 //@DESCRIPTION: This component defines a mechanism,
 // 'bmqc::MultiQueueThreadPool', which encapsulates the common pattern of
@@ -36,6 +37,21 @@
 //   'bmqc::MultiQueueThreadPool' to enqueue items on the appropriate queue at
 //   the requested time.
 //
+/// Queue Implementations
+///---------------------
+// Each queue of a 'bmqc::MultiQueueThreadPool' is backed either by an
+// unbounded 'bdlcc::SingleConsumerQueue' (the default), or by a lock-free
+// 'bmqc::MpscRingBuffer', as selected by the
+// 'bmqc::MultiQueueThreadPoolQueueOptions' the queue is created with.  The
+// latter avoids any lock on the push path as long as the ring buffer is not
+// full, and lets the processing thread spin for a short while before parking
+// when its queue becomes empty, which lowers the latency of waking it up at
+// the cost of some CPU.  In both cases, events are popped in batches of up to
+// 'k_MAX_BATCH_SIZE' events.  Symmetrically, 'enqueueEvents' pushes a batch
+// of events to a queue with a single operation, which, with the lock-free
+// queue, claims all the slots at once and wakes up the processing thread at
+// most once.
+//
 /// Usage
 ///-----
 // Consider using a 'MultiQueueThreadPool' (MQTP) to process a number of
@@ -144,6 +160,7 @@
 //..
 
 #include <bmqc_monitoredqueue_bdlccsingleconsumerqueue.h>
+#include <bmqc_mpscringbuffer.h>
 #include <bmqu_printutil.h>
 
 // BDE
@@ -152,12 +169,15 @@
 #include <bdlmt_eventscheduler.h>
 #include <bdlmt_threadpool.h>
 #include <bsl_functional.h>
+#include <bsl_limits.h>
 #include <bsl_memory.h>
 #include <bsl_string.h>
 #include <bsl_vector.h>
 #include <bsla_annotations.h>
 #include <bslma_default.h>
+#include <bslma_managedptr.h>
 #include <bslma_usesbslmaallocator.h>
+#include <bslmf_movableref.h>
 #include <bslmf_nestedtraitdeclaration.h>
 #include <bslmt_threadutil.h>
 #include <bslmt_timedsemaphore.h>
@@ -169,6 +189,150 @@
 namespace BloombergLP {
 namespace bmqc {
 
+// ======================================
+// class MultiQueueThreadPoolQueueOptions
+// ======================================
+
+/// Options for the creation of a queue of a `MultiQueueThreadPool`,
+/// selecting the implementation backing the queue.
+class MultiQueueThreadPoolQueueOptions {
+  private:
+    // DATA
+
+    /// Initial capacity of the `bdlcc::SingleConsumerQueue`, or capacity of
+    /// the ring buffer of the `bmqc::MpscRingBuffer`, backing the queue.
+    int d_capacity;
+
+    /// Whether the queue is backed by a `bmqc::MpscRingBuffer`.
+    bool d_isLockFree;
+
+  public:
+    // CREATORS
+
+    /// Create options for a queue backed by a `bdlcc::SingleConsumerQueue`
+    /// having the specified `initialCapacity`.
+    MultiQueueThreadPoolQueueOptions(int initialCapacity);  // IMPLICIT
+
+    /// Create options for a queue backed by a `bmqc::MpscRingBuffer` whose
+    /// ring buffer has the specified `capacity` if the specified
+    /// `isLockFree` is `true`, or by a `bdlcc::SingleConsumerQueue` having
+    /// `capacity` as initial capacity otherwise.
+    MultiQueueThreadPoolQueueOptions(int capacity, bool isLockFree);
+
+    // ACCESSORS
+
+    /// Return the capacity of the queue.
+    int capacity() const;
+
+    /// Return `true` if the queue is backed by a `bmqc::MpscRingBuffer`,
+    /// and `false` otherwise.
+    bool isLockFree() const;
+};
+
+// ================================
+// class MultiQueueThreadPool_Queue
+// ================================
+
+/// Component-private queue of a `MultiQueueThreadPool`, forwarding to
+/// either a `bdlcc::SingleConsumerQueue` or a `bmqc::MpscRingBuffer` as
+/// selected at construction.
+template <class ELEMENT>
+class MultiQueueThreadPool_Queue {
+  private:
+    // DATA
+
+    /// Queue used unless lock-free mode was requested.
+    bslma::ManagedPtr<bdlcc::SingleConsumerQueue<ELEMENT> > d_queue_mp;
+
+    /// Queue used if lock-free mode was requested.
+    bslma::ManagedPtr<MpscRingBuffer<ELEMENT> > d_ringBuffer_mp;
+
+  private:
+    // NOT IMPLEMENTED
+    MultiQueueThreadPool_Queue(const MultiQueueThreadPool_Queue&)
+        BSLS_KEYWORD_DELETED;
+    MultiQueueThreadPool_Queue&
+    operator=(const MultiQueueThreadPool_Queue&) BSLS_KEYWORD_DELETED;
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(MultiQueueThreadPool_Queue,
+                                   bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create a queue as described by the specified `options`, using the
+    /// optionally specified `basicAllocator` to supply memory.
+    explicit MultiQueueThreadPool_Queue(
+        const MultiQueueThreadPoolQueueOptions& options,
+        bslma::Allocator*                       basicAllocator = 0);
+
+    // MANIPULATORS
+
+    /// Forward to the corresponding method of the underlying queue.
+    int  pushBack(const ELEMENT& value);
+    int  pushBack(bslmf::MovableRef<ELEMENT> value);
+    int  tryPushBack(const ELEMENT& value);
+    int  tryPushBack(bslmf::MovableRef<ELEMENT> value);
+    int  popFront(ELEMENT* value);
+    int  tryPopFront(ELEMENT* value);
+    void removeAll();
+    void disablePushBack();
+    void enablePushBack();
+
+    /// Move all the elements of the specified `values` to the back of this
+    /// queue, in order, and clear `values`.  Return 0 on success, and a
+    /// non-zero value if pushing is disabled, in which case `values` is
+    /// left in a valid but unspecified state.
+    int pushBackBatch(bsl::vector<ELEMENT>* values);
+
+    /// Remove up to the specified `maxNumItems` elements from the front of
+    /// this queue without blocking and append them, in order, to the
+    /// specified `buffer`.  Return the number of elements appended.
+    int tryPopFront(int maxNumItems, bsl::vector<ELEMENT>* buffer);
+
+    // ACCESSORS
+
+    /// Forward to the corresponding method of the underlying queue.
+    bool isEmpty() const;
+    bool isPushBackDisabled() const;
+};
+
+// =================================================================
+// struct MonitoredQueueTraits< MultiQueueThreadPool_Queue<ELEMENT> >
+// =================================================================
+
+/// This specialization provides the types and functions necessary to
+/// interface a `bmqc::MonitoredQueue` with a `MultiQueueThreadPool_Queue`.
+template <typename ELEMENT>
+struct MonitoredQueueTraits<MultiQueueThreadPool_Queue<ELEMENT> > {
+    // PUBLIC TYPES
+    typedef ELEMENT                             ElementType;
+    typedef MultiQueueThreadPoolQueueOptions    InitialCapacityType;
+    typedef MultiQueueThreadPool_Queue<ELEMENT> QueueType;
+
+    // CLASS METHODS
+
+    /// Return the maximum number of elements that may be stored in the
+    /// specified `queue`, which is unbounded whatever its implementation.
+    static int capacity(const QueueType& queue);
+
+    /// Return `true` if the specified `queue` is enqueue disabled, and
+    /// `false` otherwise.
+    static bool isPushBackDisabled(const QueueType& queue);
+
+    /// Disable enqueuing into the specified `queue`.
+    static void disablePushBack(QueueType* queue);
+
+    /// Enable enqueuing into the specified `queue`.
+    static void enablePushBack(QueueType* queue);
+
+    /// Remove the element from the front of the specified `queue` and load
+    /// that element into the specified `buffer`, blocking until the queue
+    /// is not empty.  Return 0 on success, and a non-zero value otherwise.
+    static int popFront(QueueType* queue, ElementType* buffer);
+};
+
 // ================================
 // class MultiQueueThreadPoolConfig
 // ================================
@@ -181,7 +345,7 @@ class MultiQueueThreadPoolConfig {
     typedef TYPE                   Event;
     typedef bsl::shared_ptr<Event> EventSp;
 
-    typedef MonitoredQueue<bdlcc::SingleConsumerQueue<EventSp> > Queue;
+    typedef MonitoredQueue<MultiQueueThreadPool_Queue<EventSp> > Queue;
 
     /// Create the queue for the specified `queueId` using the specified
     /// `allocator`.
@@ -380,6 +544,9 @@ class MultiQueueThreadPool BSLS_KEYWORD_FINAL {
     /// The timeout for `timedWait` when stopping the queues
     static const int k_MAX_WAIT_SECONDS_AT_SHUTDOWN = 300;
 
+    /// Maximum number of events popped at once from a queue
+    static const int k_MAX_BATCH_SIZE = 32;
+
     // DATA
     Config d_config;
 
@@ -400,8 +567,9 @@ class MultiQueueThreadPool BSLS_KEYWORD_FINAL {
     void processMonitorEvents();
 
     /// Thread pool worker function.
-    /// Pop and process events from the queue with the specified `queue`
-    /// until a `0` event is popped off.
+    /// Pop, in batches of up to `k_MAX_BATCH_SIZE`, and process events from
+    /// the queue with the specified `queue` until the last monitor event is
+    /// popped off.
     void processQueue(int queue);
 
   private:
@@ -452,6 +620,14 @@ class MultiQueueThreadPool BSLS_KEYWORD_FINAL {
     /// NOTE: if the requested queue is full, this will block.
     int enqueueEvent(bslmf::MovableRef<EventSp> event, int queueId);
 
+    /// @brief Enqueue a batch of events to the specified queue.
+    /// @param events Events to enqueue, in order.  Cleared on success.
+    /// @param queueId Queue id of the destination queue for the events.
+    /// @return 0 on success, non-zero on failure.
+    /// NOTE: the events are pushed to the queue with a single operation,
+    ///       and the thread of the queue is woken up at most once.
+    int enqueueEvents(bsl::vector<EventSp>* events, int queueId);
+
     /// @brief Enqueue an event to all queues.
     /// @param event Event to enqueue.
     /// @return 0 on success, non-zero on failure.
@@ -482,6 +658,248 @@ class MultiQueueThreadPool BSLS_KEYWORD_FINAL {
 //                             INLINE DEFINITIONS
 // ============================================================================
 
+// --------------------------------------
+// class MultiQueueThreadPoolQueueOptions
+// --------------------------------------
+
+// CREATORS
+inline MultiQueueThreadPoolQueueOptions::MultiQueueThreadPoolQueueOptions(
+    int initialCapacity)
+: d_capacity(initialCapacity)
+, d_isLockFree(false)
+{
+    // NOTHING
+}
+
+inline MultiQueueThreadPoolQueueOptions::MultiQueueThreadPoolQueueOptions(
+    int  capacity,
+    bool isLockFree)
+: d_capacity(capacity)
+, d_isLockFree(isLockFree)
+{
+    // NOTHING
+}
+
+// ACCESSORS
+inline int MultiQueueThreadPoolQueueOptions::capacity() const
+{
+    return d_capacity;
+}
+
+inline bool MultiQueueThreadPoolQueueOptions::isLockFree() const
+{
+    return d_isLockFree;
+}
+
+// --------------------------------
+// class MultiQueueThreadPool_Queue
+// --------------------------------
+
+// CREATORS
+template <class ELEMENT>
+inline MultiQueueThreadPool_Queue<ELEMENT>::MultiQueueThreadPool_Queue(
+    const MultiQueueThreadPoolQueueOptions& options,
+    bslma::Allocator*                       basicAllocator)
+: d_queue_mp()
+, d_ringBuffer_mp()
+{
+    bslma::Allocator* alloc = bslma::Default::allocator(basicAllocator);
+
+    if (options.isLockFree()) {
+        d_ringBuffer_mp.load(new (*alloc)
+                                 MpscRingBuffer<ELEMENT>(options.capacity(),
+                                                         alloc),
+                             alloc);
+    }
+    else {
+        d_queue_mp.load(new (*alloc) bdlcc::SingleConsumerQueue<ELEMENT>(
+                            options.capacity(),
+                            alloc),
+                        alloc);
+    }
+}
+
+// MANIPULATORS
+template <class ELEMENT>
+inline int MultiQueueThreadPool_Queue<ELEMENT>::pushBack(const ELEMENT& value)
+{
+    return d_ringBuffer_mp ? d_ringBuffer_mp->pushBack(value)
+                           : d_queue_mp->pushBack(value);
+}
+
+template <class ELEMENT>
+inline int MultiQueueThreadPool_Queue<ELEMENT>::pushBack(
+    bslmf::MovableRef<ELEMENT> value)
+{
+    return d_ringBuffer_mp
+               ? d_ringBuffer_mp->pushBack(bslmf::MovableRefUtil::move(value))
+               : d_queue_mp->pushBack(bslmf::MovableRefUtil::move(value));
+}
+
+template <class ELEMENT>
+inline int
+MultiQueueThreadPool_Queue<ELEMENT>::tryPushBack(const ELEMENT& value)
+{
+    return d_ringBuffer_mp ? d_ringBuffer_mp->tryPushBack(value)
+                           : d_queue_mp->tryPushBack(value);
+}
+
+template <class ELEMENT>
+inline int MultiQueueThreadPool_Queue<ELEMENT>::tryPushBack(
+    bslmf::MovableRef<ELEMENT> value)
+{
+    return d_ringBuffer_mp ? d_ringBuffer_mp->tryPushBack(
+                                 bslmf::MovableRefUtil::move(value))
+                           : d_queue_mp->tryPushBack(
+                                 bslmf::MovableRefUtil::move(value));
+}
+
+template <class ELEMENT>
+inline int MultiQueueThreadPool_Queue<ELEMENT>::pushBackBatch(
+    bsl::vector<ELEMENT>* values)
+{
+    if (d_ringBuffer_mp) {
+        return d_ringBuffer_mp->pushBackBatch(values);  // RETURN
+    }
+
+    for (size_t i = 0; i < values->size(); ++i) {
+        const int rc = d_queue_mp->pushBack(
+            bslmf::MovableRefUtil::move((*values)[i]));
+        if (rc != 0) {
+            return rc;  // RETURN
+        }
+    }
+    values->clear();
+
+    return 0;
+}
+
+template <class ELEMENT>
+inline int MultiQueueThreadPool_Queue<ELEMENT>::popFront(ELEMENT* value)
+{
+    return d_ringBuffer_mp ? d_ringBuffer_mp->popFront(value)
+                           : d_queue_mp->popFront(value);
+}
+
+template <class ELEMENT>
+inline int MultiQueueThreadPool_Queue<ELEMENT>::tryPopFront(ELEMENT* value)
+{
+    return d_ringBuffer_mp ? d_ringBuffer_mp->tryPopFront(value)
+                           : d_queue_mp->tryPopFront(value);
+}
+
+template <class ELEMENT>
+inline int
+MultiQueueThreadPool_Queue<ELEMENT>::tryPopFront(int maxNumItems,
+                                                 bsl::vector<ELEMENT>* buffer)
+{
+    if (d_ringBuffer_mp) {
+        return d_ringBuffer_mp->tryPopFront(maxNumItems, buffer);  // RETURN
+    }
+
+    int     numItems = 0;
+    ELEMENT value;
+    while (numItems < maxNumItems && d_queue_mp->tryPopFront(&value) == 0) {
+        buffer->push_back(bslmf::MovableRefUtil::move(value));
+        ++numItems;
+    }
+
+    return numItems;
+}
+
+template <class ELEMENT>
+inline void MultiQueueThreadPool_Queue<ELEMENT>::removeAll()
+{
+    if (d_ringBuffer_mp) {
+        d_ringBuffer_mp->removeAll();
+    }
+    else {
+        d_queue_mp->removeAll();
+    }
+}
+
+template <class ELEMENT>
+inline void MultiQueueThreadPool_Queue<ELEMENT>::disablePushBack()
+{
+    if (d_ringBuffer_mp) {
+        d_ringBuffer_mp->disablePushBack();
+    }
+    else {
+        d_queue_mp->disablePushBack();
+    }
+}
+
+template <class ELEMENT>
+inline void MultiQueueThreadPool_Queue<ELEMENT>::enablePushBack()
+{
+    if (d_ringBuffer_mp) {
+        d_ringBuffer_mp->enablePushBack();
+    }
+    else {
+        d_queue_mp->enablePushBack();
+    }
+}
+
+// ACCESSORS
+template <class ELEMENT>
+inline bool MultiQueueThreadPool_Queue<ELEMENT>::isEmpty() const
+{
+    return d_ringBuffer_mp ? d_ringBuffer_mp->isEmpty()
+                           : d_queue_mp->isEmpty();
+}
+
+template <class ELEMENT>
+inline bool MultiQueueThreadPool_Queue<ELEMENT>::isPushBackDisabled() const
+{
+    return d_ringBuffer_mp ? d_ringBuffer_mp->isPushBackDisabled()
+                           : d_queue_mp->isPushBackDisabled();
+}
+
+// -----------------------------------------------------------------
+// struct MonitoredQueueTraits< MultiQueueThreadPool_Queue<ELEMENT> >
+// -----------------------------------------------------------------
+
+template <typename ELEMENT>
+inline int
+MonitoredQueueTraits<MultiQueueThreadPool_Queue<ELEMENT> >::capacity(
+    BSLA_UNUSED const QueueType& queue)
+{
+    return bsl::numeric_limits<int>::max();
+}
+
+template <typename ELEMENT>
+inline bool
+MonitoredQueueTraits<MultiQueueThreadPool_Queue<ELEMENT> >::isPushBackDisabled(
+    const QueueType& queue)
+{
+    return queue.isPushBackDisabled();
+}
+
+template <typename ELEMENT>
+inline void
+MonitoredQueueTraits<MultiQueueThreadPool_Queue<ELEMENT> >::disablePushBack(
+    QueueType* queue)
+{
+    queue->disablePushBack();
+}
+
+template <typename ELEMENT>
+inline void
+MonitoredQueueTraits<MultiQueueThreadPool_Queue<ELEMENT> >::enablePushBack(
+    QueueType* queue)
+{
+    queue->enablePushBack();
+}
+
+template <typename ELEMENT>
+inline int
+MonitoredQueueTraits<MultiQueueThreadPool_Queue<ELEMENT> >::popFront(
+    QueueType*   queue,
+    ElementType* buffer)
+{
+    return queue->popFront(buffer);
+}
+
 // --------------------------------
 // class MultiQueueThreadPoolConfig
 // --------------------------------
@@ -623,43 +1041,58 @@ inline void MultiQueueThreadPool<TYPE>::processQueue(int queue)
     // Store the thread id of the thread being exclusively used
     info.d_threadId = bslmt::ThreadUtil::selfId();
 
+    bsl::vector<EventSp> events(d_allocator_p);
+    events.reserve(k_MAX_BATCH_SIZE);
+
     while (true) {
-        EventSp   event;
-        const int popRet = info.d_queue_p->tryPopFront(&event);
-        if (popRet != 0) {
+        events.clear();
+        if (0 == info.d_queue_p->tryPopFront(k_MAX_BATCH_SIZE, &events)) {
             // Queue is empty
             d_config.d_eventCallbackFn(queue, d_queueEmptyEvent_sp);
 
-            info.d_queue_p->popFront(&event);
+            events.resize(1);
+            info.d_queue_p->popFront(&events[0]);
         }
 
-        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == event)) {
-            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-
-            // Process monitor event
-            if (0 == info.d_processQueueRefCount.subtractRelaxed(1)) {
-                // 0 ref count means that:
-                // - `stop()` was called: it released the initial reference.
-                // - It is the last monitor event enqueued to the queue.
-                // No need to process this event, it is time to return.
-                // Note: it is possible that another monitor event will be
-                //       enqueued right after the check is done, but it's okay.
-                //       We will skip it with any remainder events on `stop()`.
-                info.d_finished_sp->post();
-                return;  // RETURN
+        for (size_t i = 0; i < events.size(); ++i) {
+            EventSp& event = events[i];
+
+            if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == event)) {
+                BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+                // Process monitor event
+                if (0 == info.d_processQueueRefCount.subtractRelaxed(1)) {
+                    // 0 ref count means that:
+                    // - `stop()` was called: it released the initial
+                    //   reference.
+                    // - It is the last monitor event enqueued to the queue.
+                    // No need to process this event, it is time to return.
+                    // Note: it is possible that another monitor event will
+                    //       be enqueued right after the check is done, but
+                    //       it's okay.  We will skip it, along with the
+                    //       remainder of this batch, as any remainder events
+                    //       are skipped on `stop()`.
+                    info.d_finished_sp->post();
+                    return;  // RETURN
+                }
+
+                const MonitorEventState prevState =
+                    static_cast<MonitorEventState>(
+                        info.d_monitorState.swap(e_MONITOR_PROCESSED));
+                if (prevState == e_MONITOR_STUCK) {
+                    // The queue was stuck, but is now back to normal
+                    BALL_LOG_INFO << "Queue '" << info.d_name
+                                  << "' is back to work";
+                }
+                continue;  // CONTINUE
             }
 
-            const MonitorEventState prevState = static_cast<MonitorEventState>(
-                info.d_monitorState.swap(e_MONITOR_PROCESSED));
-            if (prevState == e_MONITOR_STUCK) {
-                // The queue was stuck, but is now back to normal
-                BALL_LOG_INFO << "Queue '" << info.d_name << "' is back to "
-                              << "work";
-            }
-            continue;  // CONTINUE
-        }
+            d_config.d_eventCallbackFn(queue, event);
 
-        d_config.d_eventCallbackFn(queue, event);
+            // Release the event right away rather than at the end of the
+            // batch, so that it can be reused by its source.
+            event.reset();
+        }
     }
 }
 
@@ -853,6 +1286,20 @@ MultiQueueThreadPool<TYPE>::enqueueEvent(bslmf::MovableRef<EventSp> event,
         bslmf::MovableRefUtil::move(event));
 }
 
+template <typename TYPE>
+inline int
+MultiQueueThreadPool<TYPE>::enqueueEvents(bsl::vector<EventSp>* events,
+                                          int                   queueId)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(events);
+    BSLS_ASSERT(0 <= queueId && queueId < numQueues());
+    BSLS_ASSERT_SAFE(isStarted() && "MQTP has not been started");
+
+    // [try to] Push back items
+    return d_queues[queueId].d_queue_p->pushBackBatch(events);
+}
+
 template <typename TYPE>
 inline int MultiQueueThreadPool<TYPE>::enqueueEventOnAllQueues(
     bslmf::MovableRef<EventSp> event)
@@ -27,6 +27,7 @@
 #include <bdlf_placeholder.h>
 #include <bdlmt_threadpool.h>
 #include <bdlt_timeunitratio.h>
+#include <bsl_algorithm.h>
 #include <bsl_iostream.h>
 #include <bsl_limits.h>
 #include <bsl_map.h>
@@ -92,6 +93,20 @@ queueCreator(int                               queueId,
     return new (*allocator) MQTP::Queue(fixedQueueSize, allocator);
 }
 
+static MQTP::Queue*
+lockFreeQueueCreator(int                               queueId,
+                     bslma::Allocator*                 allocator,
+                     int                               ringBufferSize,
+                     bsl::map<int, bsl::vector<int> >* queueContextMap)
+{
+    queueContextMap->insert(
+        bsl::make_pair(queueId, bsl::vector<int>(allocator)));
+
+    return new (*allocator) MQTP::Queue(
+        bmqc::MultiQueueThreadPoolQueueOptions(ringBufferSize, true),
+        allocator);
+}
+
 static void eventCb(bsl::map<int, bsl::vector<int> >* queueContextMap,
                     int                               queueId,
                     const MQTP::EventSp&              event)
@@ -257,6 +272,121 @@ static void test1_breathingTest()
     threadPool.stop();
 }
 
+static void test2_lockFreeQueues()
+// ------------------------------------------------------------------------
+// LOCK-FREE QUEUES
+//
+// Concerns:
+//   A MQTP whose queues are backed by 'bmqc::MpscRingBuffer' delivers all
+//   events, in order, including when more events are enqueued than fit in
+//   the ring buffers, when events are enqueued in batches and when the
+//   processing threads are parked.
+//
+// Testing:
+//   MultiQueueThreadPoolQueueOptions
+//   enqueueEvent
+//   enqueueEvents
+//   enqueueEventOnAllQueues
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+    // See 'test1_breathingTest'.
+
+    bmqtst::TestHelper::printTestName("LOCK-FREE QUEUES");
+
+    bslma::Allocator* allocator = bmqtst::TestHelperUtil::allocator();
+
+    // CONSTANTS
+    const int k_NUM_QUEUES       = 2;
+    const int k_RING_BUFFER_SIZE = 8;
+    const int k_NUM_EVENTS       = 1000;
+
+    bsl::map<int, bsl::vector<int> > queueContextMap(allocator);
+
+    bdlmt::ThreadPool threadPool(
+        bslmt::ThreadAttributes(),        // default
+        k_NUM_QUEUES,                     // minThreads
+        k_NUM_QUEUES,                     // maxThreads
+        bsl::numeric_limits<int>::max(),  // maxIdleTime
+        allocator);
+    BSLS_ASSERT_OPT(threadPool.start() == 0);
+
+    MQTP::Config config(
+        k_NUM_QUEUES,
+        &threadPool,
+        bdlf::BindUtil::bindS(allocator,
+                              &eventCb,
+                              &queueContextMap,
+                              bdlf::PlaceHolders::_1,   // queueId
+                              bdlf::PlaceHolders::_2),  // event
+        bdlf::BindUtil::bindS(allocator,
+                              &lockFreeQueueCreator,
+                              bdlf::PlaceHolders::_1,  // queueId
+                              bdlf::PlaceHolders::_2,  // allocator
+                              k_RING_BUFFER_SIZE,
+                              &queueContextMap),
+        allocator);
+
+    MQTP mfqtp(config, allocator);
+    BMQTST_ASSERT_EQ(mfqtp.start(), 0);
+
+    // Enqueue the first half of the events one by one ...
+    for (int i = 0; i < k_NUM_EVENTS / 2; ++i) {
+        MQTP::EventSp event;
+        event.createInplace(allocator);
+        event->value() = i;
+        mfqtp.enqueueEvent(bslmf::MovableRefUtil::move(event), i % 2);
+    }
+
+    // ... and the second half in batches, some of which do not fit in the
+    // ring buffers.
+    bsl::vector<MQTP::EventSp> batch(allocator);
+    int                        batchSize = 1;
+    int                        i         = k_NUM_EVENTS / 2;
+    while (i < k_NUM_EVENTS) {
+        const int end = bsl::min(i + k_NUM_QUEUES * batchSize, k_NUM_EVENTS);
+        for (int queueId = 0; queueId < k_NUM_QUEUES; ++queueId) {
+            for (int j = i + queueId; j < end; j += k_NUM_QUEUES) {
+                MQTP::EventSp event;
+                event.createInplace(allocator);
+                event->value() = j;
+                batch.push_back(event);
+            }
+            BMQTST_ASSERT_EQ(mfqtp.enqueueEvents(&batch, queueId), 0);
+            BMQTST_ASSERT(batch.empty());
+        }
+        i         = end;
+        batchSize = batchSize % (2 * k_RING_BUFFER_SIZE) + 1;
+    }
+
+    // Let the processing threads park before enqueuing the last event
+    mfqtp.waitUntilEmpty();
+    bslmt::ThreadUtil::microSleep(0, 1);  // 1s
+    {
+        MQTP::EventSp event;
+        event.createInplace(allocator);
+        event->value() = k_NUM_EVENTS;
+        mfqtp.enqueueEventOnAllQueues(bslmf::MovableRefUtil::move(event));
+    }
+
+    mfqtp.stop();
+
+    for (int queueId = 0; queueId < k_NUM_QUEUES; ++queueId) {
+        const bsl::vector<int>& values = queueContextMap[queueId];
+        BMQTST_ASSERT_EQ_D(queueId,
+                           values.size(),
+                           static_cast<size_t>(k_NUM_EVENTS / 2 + 1));
+        for (size_t i = 0; i + 1 < values.size(); ++i) {
+            BMQTST_ASSERT_EQ_D(i,
+                               values[i],
+                               static_cast<int>(2 * i) + queueId);
+        }
+        BMQTST_ASSERT_EQ(values.back(), k_NUM_EVENTS);
+    }
+
+    threadPool.stop();
+}
+
 BSLA_MAYBE_UNUSED
 static void testN1_performance()
 // ------------------------------------------------------------------------
@@ -551,6 +681,7 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 2: test2_lockFreeQueues(); break;
     case 1: test1_breathingTest(); break;
     case -1:
 #ifdef BMQTST_BENCHMARK_ENABLED
@@ -20,12 +20,104 @@
 #include <bmqeval_simpleevaluatorscanner.h>
 
 // BDE
+#include <bdlb_bitutil.h>
+#include <bsl_cstdint.h>
+#include <bsl_functional.h>
+#include <bsl_limits.h>
 #include <bsl_utility.h>
 #include <bsla_annotations.h>
 
 namespace BloombergLP {
 namespace bmqeval {
 
+namespace {
+
+// CONSTANTS
+
+/// The maximum number of values on the stack of a program.  Each binary
+/// operator pops one more value than it pushes, and every operator counts
+/// against `k_MAX_OPERATORS`, hence this bound.
+const int k_MAX_STACK_DEPTH = SimpleEvaluator::k_MAX_OPERATORS + 1;
+
+/// The maximum number of jumps in a program.  Jumps are emitted for `And`
+/// and `Or` operators only, which count against `k_MAX_OPERATORS`.
+const int k_MAX_JUMPS = SimpleEvaluator::k_MAX_OPERATORS;
+
+// TYPES
+
+/// The type of a value on the stack of a program.
+struct ValueType {
+    enum Enum { e_BOOLEAN, e_INTEGER, e_STRING, e_OTHER };
+};
+
+/// A value on the stack of a program.  Booleans are stored in `d_integer`.
+/// Strings refer to either the string table of the program or to a datum
+/// returned by the `PropertiesReader`, in which case `d_slot` is the slot of
+/// the property, and -1 otherwise.
+struct Value {
+    ValueType::Enum    d_type;
+    bsls::Types::Int64 d_integer;
+    const char*        d_string_p;
+    bsl::size_t        d_length;
+    int                d_slot;
+};
+
+/// Lanes of a batch (see `EvaluationBatch`) which jumped forward, and which
+/// resume execution with the boolean `d_value` on top of the stack once the
+/// program reaches the instruction at `d_target`.
+struct ParkedLanes {
+    bsl::size_t           d_target;
+    EvaluationBatch::Mask d_lanes;
+    bool                  d_value;
+};
+
+/// A column of integers all equal to `d_value`.
+struct Broadcast {
+    bsls::Types::Int64 d_value;
+
+    bsls::Types::Int64 operator[](int) const { return d_value; }
+};
+
+// FUNCTIONS
+
+/// Return a mask with the bit `i` set if `OP` yields `true` for `left[i]`
+/// and `right[i]`, where the specified `right` is either a column of
+/// integers or a `Broadcast`.  The loop does not branch, so that compilers
+/// can vectorize it.
+template <template <typename> class OP, typename RIGHT>
+EvaluationBatch::Mask compareLanes(const bsls::Types::Int64* left,
+                                   const RIGHT&              right)
+{
+    const OP<bsls::Types::Int64> op   = OP<bsls::Types::Int64>();
+    EvaluationBatch::Mask        mask = 0;
+
+    for (int i = 0; i < EvaluationBatch::k_MAX_SIZE; ++i) {
+        mask |= static_cast<EvaluationBatch::Mask>(op(left[i], right[i]))
+                << i;
+    }
+
+    return mask;
+}
+
+/// Set the error in the specified `context` corresponding to the specified
+/// error `value`, returned by a `PropertiesReader`.
+void setPropertyError(EvaluationContext& context, const bdld::Datum& value)
+{
+    const int rc = value.theError().code();
+
+    // ErrorType::e_EVALUATION_LAST and ErrorType::e_EVALUATION_FIRST are
+    // negative, hence the flipped conditional.
+    if (ErrorType::e_EVALUATION_LAST <= rc &&
+        rc <= ErrorType::e_EVALUATION_FIRST) {
+        context.setError(static_cast<ErrorType::Enum>(rc));
+    }
+    else {
+        context.setError(ErrorType::e_UNDEFINED);
+    }
+}
+
+}  // close unnamed namespace
+
 // ----------------------
 // class PropertiesReader
 // ----------------------
@@ -36,12 +128,120 @@ PropertiesReader::~PropertiesReader()
     // NOTHING
 }
 
+bdld::Datum PropertiesReader::getBySlot(BSLA_UNUSED int    slot,
+                                        const bsl::string& name,
+                                        bslma::Allocator*  allocator)
+{
+    return get(name, allocator);
+}
+
+bsls::Types::Uint64 PropertiesReader::generation() const
+{
+    return 0;
+}
+
+// ---------------------
+// class InternedStrings
+// ---------------------
+
+// MANIPULATORS
+const bsl::string* InternedStrings::intern(const bslstl::StringRef& value)
+{
+    Index::iterator it = d_index.find(value);
+    if (it != d_index.end()) {
+        ++it->second.d_numReferences;
+        return &*it->second.d_string;  // RETURN
+    }
+
+    d_strings.push_back(bsl::string());
+    Entry entry;
+    entry.d_string        = --d_strings.end();
+    entry.d_numReferences = 1;
+    entry.d_string->assign(value.data(), value.length());
+    d_index.insert(bsl::make_pair(bslstl::StringRef(*entry.d_string), entry));
+    ++d_version;
+
+    return &*entry.d_string;
+}
+
+void InternedStrings::release(const bsl::string* value)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(value);
+
+    Index::iterator it = d_index.find(*value);
+    BSLS_ASSERT_SAFE(it != d_index.end());
+    BSLS_ASSERT_SAFE(&*it->second.d_string == value);
+    BSLS_ASSERT_SAFE(it->second.d_numReferences > 0);
+
+    if (--it->second.d_numReferences != 0) {
+        return;  // RETURN
+    }
+
+    // Remove the key before the string it refers to.
+    const Strings::iterator copy = it->second.d_string;
+    d_index.erase(it);
+    d_strings.erase(copy);
+    ++d_version;
+}
+
+// ACCESSORS
+const bsl::string* InternedStrings::find(const bslstl::StringRef& value) const
+{
+    Index::const_iterator cit = d_index.find(value);
+
+    return cit == d_index.end() ? 0 : &*cit->second.d_string;
+}
+
+// -------------------
+// class PropertySlots
+// -------------------
+
+// MANIPULATORS
+int PropertySlots::acquire(const bsl::string& name)
+{
+    Slots::iterator it = d_slots.find(name);
+    if (it != d_slots.end()) {
+        ++it->second.d_numReferences;
+        return it->second.d_slot;  // RETURN
+    }
+
+    Entry entry;
+    entry.d_numReferences = 1;
+    if (d_freeSlots.empty()) {
+        entry.d_slot = static_cast<int>(d_slots.size());
+    }
+    else {
+        entry.d_slot = d_freeSlots.back();
+        d_freeSlots.pop_back();
+    }
+    d_slots.insert(bsl::make_pair(name, entry));
+    ++d_version;
+
+    return entry.d_slot;
+}
+
+void PropertySlots::release(const bsl::string& name)
+{
+    Slots::iterator it = d_slots.find(name);
+    BSLS_ASSERT_SAFE(it != d_slots.end());
+    BSLS_ASSERT_SAFE(it->second.d_numReferences > 0);
+
+    if (--it->second.d_numReferences != 0) {
+        return;  // RETURN
+    }
+
+    d_freeSlots.push_back(it->second.d_slot);
+    d_slots.erase(it);
+}
+
 // ---------------------
 // class SimpleEvaluator
 // ---------------------
 
 SimpleEvaluator::SimpleEvaluator()
 : d_expression(0)
+, d_program(0)
 , d_isCompiled(false)
 {
     // NOTHING
@@ -58,11 +258,26 @@ int SimpleEvaluator::compile(const bsl::string&  expression,
     context.d_validationOnly = false;
     parse(expression, context);
 
+    d_program.reset();
+
     if (context.hasError()) {
         d_expression.reset();
     }
     else {
         d_expression = context.d_expression;
+
+        bsl::shared_ptr<Program> program;
+        program.createInplace(context.d_allocator, context.d_allocator);
+        d_expression->emit(program.get());
+        program->resolveSlots(&context);
+        program->internStrings(&context);
+
+        // The operator limit enforced by 'parse' bounds the stack depth;
+        // should it not, keep evaluating the expression tree.
+        BSLS_ASSERT_SAFE(program->maxDepth() <= k_MAX_STACK_DEPTH);
+        if (program->maxDepth() <= k_MAX_STACK_DEPTH) {
+            d_program = program;
+        }
     }
     d_isCompiled = true;
 
@@ -133,6 +348,10 @@ bool SimpleEvaluator::evaluate(EvaluationContext& context) const
 
     context.reset();
 
+    if (d_program) {
+        return d_program->evaluate(context);  // RETURN
+    }
+
     bdld::Datum value = d_expression->evaluate(context);
 
     if (context.hasError()) {
@@ -147,6 +366,84 @@ bool SimpleEvaluator::evaluate(EvaluationContext& context) const
     return value.theBoolean();
 }
 
+int SimpleEvaluator::evaluate(bsls::Types::Uint64* result,
+                              EvaluationBatch&     batch) const
+{
+    BSLS_ASSERT_SAFE(result);
+    BSLS_ASSERT_SAFE(d_expression.get());
+
+    if (!d_program) {
+        // Only the program can evaluate batches.
+        return -1;  // RETURN
+    }
+
+    *result = d_program->evaluate(batch);
+
+    return 0;
+}
+
+bool SimpleEvaluator::loadGuard(Guard* guard) const
+{
+    BSLS_ASSERT_SAFE(guard);
+
+    if (!d_program || d_program->size() < 2) {
+        return false;  // RETURN
+    }
+
+    const Program::Instruction& load    = d_program->instruction(0);
+    const Program::Instruction& compare = d_program->instruction(1);
+
+    if (load.d_opcode != Program::Opcode::e_LOAD_PROPERTY ||
+        (compare.d_opcode != Program::Opcode::e_COMPARE_INTEGER &&
+         compare.d_opcode != Program::Opcode::e_COMPARE_STRING)) {
+        return false;  // RETURN
+    }
+
+    // Follow the jumps taken when the comparison yields 'false'.  The
+    // comparison is a guard if they all lead to the end of the program, so
+    // that the expression then yields 'false' as well.  Note that failing to
+    // evaluate the comparison fails the whole evaluation, which also yields
+    // 'false'.
+
+    bsl::size_t position = 2;
+    while (position < d_program->size() &&
+           d_program->instruction(position).d_opcode ==
+               Program::Opcode::e_JUMP_IF_FALSE) {
+        position = d_program->instruction(position).d_operand;
+    }
+
+    if (position != d_program->size()) {
+        return false;  // RETURN
+    }
+
+    guard->d_property = d_program->stringAt(load.d_operand);
+    guard->d_slot     = static_cast<int>(load.d_immediate);
+    guard->d_isExact  = d_program->size() == 2;
+
+    switch (static_cast<Program::Comparator::Enum>(compare.d_operand)) {
+    case Program::Comparator::e_EQ: guard->d_operator = Guard::e_EQ; break;
+    case Program::Comparator::e_NE: guard->d_operator = Guard::e_NE; break;
+    case Program::Comparator::e_LT: guard->d_operator = Guard::e_LT; break;
+    case Program::Comparator::e_LE: guard->d_operator = Guard::e_LE; break;
+    case Program::Comparator::e_GT: guard->d_operator = Guard::e_GT; break;
+    case Program::Comparator::e_GE: guard->d_operator = Guard::e_GE; break;
+    }
+
+    if (compare.d_opcode == Program::Opcode::e_COMPARE_INTEGER) {
+        guard->d_isString = false;
+        guard->d_integer  = compare.d_immediate;
+        guard->d_string.reset();
+    }
+    else {
+        guard->d_isString = true;
+        guard->d_integer  = 0;
+        guard->d_string   = d_program->stringAt(
+            static_cast<bsl::size_t>(compare.d_immediate));
+    }
+
+    return true;
+}
+
 // ---------------------------------
 // class SimpleEvaluator::Expression
 // ---------------------------------
@@ -180,22 +477,18 @@ SimpleEvaluator::Property::evaluate(EvaluationContext& context) const
                                                         context.d_allocator);
 
     if (value.isError()) {
-        const int rc = value.theError().code();
-
-        // ErrorType::e_EVALUATION_LAST and ErrorType::e_EVALUATION_FIRST are
-        // negative, hence the flipped conditional.
-        if (ErrorType::e_EVALUATION_LAST <= rc &&
-            rc <= ErrorType::e_EVALUATION_FIRST) {
-            context.setError(static_cast<ErrorType::Enum>(rc));
-        }
-        else {
-            context.setError(ErrorType::e_UNDEFINED);
-        }
+        setPropertyError(context, value);
     }
 
     return value;
 }
 
+void SimpleEvaluator::Property::emit(Program* program) const
+{
+    program->append(Program::Opcode::e_LOAD_PROPERTY,
+                    program->addString(d_name));
+}
+
 // -------------------------------------
 // class SimpleEvaluator::IntegerLiteral
 // -------------------------------------
@@ -209,6 +502,11 @@ SimpleEvaluator::IntegerLiteral::evaluate(EvaluationContext& context) const
     return bdld::Datum::createInteger64(d_value, context.d_allocator);
 }
 
+void SimpleEvaluator::IntegerLiteral::emit(Program* program) const
+{
+    program->append(Program::Opcode::e_PUSH_INTEGER, 0, d_value);
+}
+
 // -------------------------------------
 // class SimpleEvaluator::BooleanLiteral
 // -------------------------------------
@@ -219,6 +517,11 @@ bdld::Datum SimpleEvaluator::BooleanLiteral::evaluate(
     return bdld::Datum::createBoolean(d_value);
 }
 
+void SimpleEvaluator::BooleanLiteral::emit(Program* program) const
+{
+    program->append(Program::Opcode::e_PUSH_BOOLEAN, 0, d_value);
+}
+
 // ---------------------------------
 // class SimpleEvaluator::UnaryMinus
 // ---------------------------------
@@ -247,6 +550,14 @@ SimpleEvaluator::UnaryMinus::evaluate(EvaluationContext& context) const
     return bdld::Datum::createInteger64(-value, context.d_allocator);
 }
 
+void SimpleEvaluator::UnaryMinus::emit(Program* program) const
+{
+    const bsl::size_t operand = program->size();
+    d_expression->emit(program);
+
+    program->appendUnary(Program::Opcode::e_NEGATE, operand);
+}
+
 // ------------------------------------
 // class SimpleEvaluator::StringLiteral
 // ------------------------------------
@@ -274,6 +585,12 @@ SimpleEvaluator::StringLiteral::evaluate(EvaluationContext& context) const
                                         context.d_allocator);
 }
 
+void SimpleEvaluator::StringLiteral::emit(Program* program) const
+{
+    program->append(Program::Opcode::e_PUSH_STRING,
+                    program->addString(d_value));
+}
+
 // -------------------------
 // class SimpleEvaluator::Or
 // -------------------------
@@ -307,6 +624,18 @@ bdld::Datum SimpleEvaluator::Or::evaluate(EvaluationContext& context) const
     return right;
 }
 
+void SimpleEvaluator::Or::emit(Program* program) const
+{
+    d_left->emit(program);
+
+    const bsl::size_t jump = program->append(
+        Program::Opcode::e_JUMP_IF_TRUE);
+
+    d_right->emit(program);
+    program->appendCheckBoolean();
+    program->patchJump(jump);
+}
+
 // --------------------------
 // class SimpleEvaluator::And
 // --------------------------
@@ -340,6 +669,18 @@ bdld::Datum SimpleEvaluator::And::evaluate(EvaluationContext& context) const
     return right;
 }
 
+void SimpleEvaluator::And::emit(Program* program) const
+{
+    d_left->emit(program);
+
+    const bsl::size_t jump = program->append(
+        Program::Opcode::e_JUMP_IF_FALSE);
+
+    d_right->emit(program);
+    program->appendCheckBoolean();
+    program->patchJump(jump);
+}
+
 // --------------------------
 // class SimpleEvaluator::Not
 // --------------------------
@@ -359,6 +700,14 @@ bdld::Datum SimpleEvaluator::Not::evaluate(EvaluationContext& context) const
     return bdld::Datum::createBoolean(!value.theBoolean());
 }
 
+void SimpleEvaluator::Not::emit(Program* program) const
+{
+    const bsl::size_t operand = program->size();
+    d_expression->emit(program);
+
+    program->appendUnary(Program::Opcode::e_NOT, operand);
+}
+
 // -----------------------------
 // class SimpleEvaluator::Exists
 // -----------------------------
@@ -384,5 +733,1119 @@ bdld::Datum SimpleEvaluator::Exists::evaluate(EvaluationContext& context) const
     return bdld::Datum::createBoolean(!value.isError());
 }
 
+void SimpleEvaluator::Exists::emit(Program* program) const
+{
+    program->append(Program::Opcode::e_EXISTS, program->addString(d_name));
+}
+
+// ------------------------------
+// class SimpleEvaluator::Program
+// ------------------------------
+
+// PRIVATE MANIPULATORS
+void SimpleEvaluator::Program::truncate(bsl::size_t position)
+{
+    BSLS_ASSERT_SAFE(position <= d_instructions.size());
+
+    d_depth -= static_cast<int>(d_instructions.size() - position);
+    d_instructions.resize(position);
+}
+
+// PRIVATE ACCESSORS
+bool SimpleEvaluator::Program::isLiteral(bsl::size_t begin,
+                                         bsl::size_t end) const
+{
+    if (end != begin + 1) {
+        return false;  // RETURN
+    }
+
+    const Opcode::Enum opcode = d_instructions[begin].d_opcode;
+
+    return opcode == Opcode::e_PUSH_BOOLEAN ||
+           opcode == Opcode::e_PUSH_INTEGER ||
+           opcode == Opcode::e_PUSH_STRING;
+}
+
+// PRIVATE CLASS METHODS
+template <typename TYPE>
+inline bool SimpleEvaluator::Program::compare(Comparator::Enum comparator,
+                                              const TYPE&      left,
+                                              const TYPE&      right)
+{
+    switch (comparator) {
+    case Comparator::e_EQ: return left == right;  // RETURN
+    case Comparator::e_NE: return left != right;  // RETURN
+    case Comparator::e_LT: return left < right;   // RETURN
+    case Comparator::e_LE: return left <= right;  // RETURN
+    case Comparator::e_GT: return left > right;   // RETURN
+    case Comparator::e_GE: return left >= right;  // RETURN
+    }
+
+    BSLS_ASSERT_SAFE(false && "Unreachable by design");
+    return false;
+}
+
+bsls::Types::Uint64
+SimpleEvaluator::Program::compareIntegers(Comparator::Enum          comparator,
+                                          const bsls::Types::Int64* left,
+                                          const bsls::Types::Int64* right)
+{
+    switch (comparator) {
+    case Comparator::e_EQ:
+        return compareLanes<bsl::equal_to>(left, right);  // RETURN
+    case Comparator::e_NE:
+        return compareLanes<bsl::not_equal_to>(left, right);  // RETURN
+    case Comparator::e_LT:
+        return compareLanes<bsl::less>(left, right);  // RETURN
+    case Comparator::e_LE:
+        return compareLanes<bsl::less_equal>(left, right);  // RETURN
+    case Comparator::e_GT:
+        return compareLanes<bsl::greater>(left, right);  // RETURN
+    case Comparator::e_GE:
+        return compareLanes<bsl::greater_equal>(left, right);  // RETURN
+    }
+
+    BSLS_ASSERT_SAFE(false && "Unreachable by design");
+    return 0;
+}
+
+bsls::Types::Uint64
+SimpleEvaluator::Program::compareIntegers(Comparator::Enum          comparator,
+                                          const bsls::Types::Int64* left,
+                                          bsls::Types::Int64        right)
+{
+    const Broadcast broadcast = {right};
+
+    switch (comparator) {
+    case Comparator::e_EQ:
+        return compareLanes<bsl::equal_to>(left, broadcast);  // RETURN
+    case Comparator::e_NE:
+        return compareLanes<bsl::not_equal_to>(left, broadcast);  // RETURN
+    case Comparator::e_LT:
+        return compareLanes<bsl::less>(left, broadcast);  // RETURN
+    case Comparator::e_LE:
+        return compareLanes<bsl::less_equal>(left, broadcast);  // RETURN
+    case Comparator::e_GT:
+        return compareLanes<bsl::greater>(left, broadcast);  // RETURN
+    case Comparator::e_GE:
+        return compareLanes<bsl::greater_equal>(left, broadcast);  // RETURN
+    }
+
+    BSLS_ASSERT_SAFE(false && "Unreachable by design");
+    return 0;
+}
+
+// CREATORS
+SimpleEvaluator::Program::Program(bslma::Allocator* allocator)
+: d_instructions(allocator)
+, d_strings(allocator)
+, d_internedStrings(allocator)
+, d_internedStrings_sp()
+, d_propertySlots_sp()
+, d_depth(0)
+, d_maxDepth(0)
+{
+    // NOTHING
+}
+
+SimpleEvaluator::Program::~Program()
+{
+    if (d_propertySlots_sp) {
+        for (bsl::size_t i = 0; i < d_instructions.size(); ++i) {
+            const Instruction& instruction = d_instructions[i];
+
+            if (instruction.d_opcode == Opcode::e_LOAD_PROPERTY ||
+                instruction.d_opcode == Opcode::e_EXISTS) {
+                d_propertySlots_sp->release(d_strings[instruction.d_operand]);
+            }
+        }
+    }
+
+    for (bsl::size_t i = 0; i < d_internedStrings.size(); ++i) {
+        d_internedStrings_sp->release(d_internedStrings[i]);
+    }
+}
+
+// MANIPULATORS
+bsl::size_t SimpleEvaluator::Program::append(Opcode::Enum       opcode,
+                                             int                operand,
+                                             bsls::Types::Int64 immediate)
+{
+    switch (opcode) {
+    case Opcode::e_PUSH_BOOLEAN:
+    case Opcode::e_PUSH_INTEGER:
+    case Opcode::e_PUSH_STRING:
+    case Opcode::e_LOAD_PROPERTY:
+    case Opcode::e_EXISTS: {
+        ++d_depth;
+    } break;
+    case Opcode::e_ADD:
+    case Opcode::e_SUBTRACT:
+    case Opcode::e_MULTIPLY:
+    case Opcode::e_DIVIDE:
+    case Opcode::e_MODULO:
+    case Opcode::e_COMPARE:
+    case Opcode::e_JUMP_IF_TRUE:
+    case Opcode::e_JUMP_IF_FALSE: {
+        // Jumps pop the value only when falling through; when they jump,
+        // the value they leave stands for the result of the right operand.
+        --d_depth;
+    } break;
+    case Opcode::e_NOT:
+    case Opcode::e_NEGATE:
+    case Opcode::e_COMPARE_INTEGER:
+    case Opcode::e_COMPARE_STRING:
+    case Opcode::e_CHECK_BOOLEAN: {
+        // NOTHING
+    } break;
+    }
+
+    BSLS_ASSERT_SAFE(d_depth >= 0);
+    if (d_depth > d_maxDepth) {
+        d_maxDepth = d_depth;
+    }
+
+    const Instruction instruction = {opcode, operand, immediate};
+    d_instructions.push_back(instruction);
+
+    return d_instructions.size() - 1;
+}
+
+int SimpleEvaluator::Program::addString(const bsl::string& value)
+{
+    for (bsl::size_t i = 0; i < d_strings.size(); ++i) {
+        if (d_strings[i] == value) {
+            return static_cast<int>(i);  // RETURN
+        }
+    }
+
+    d_strings.push_back(value);
+
+    return static_cast<int>(d_strings.size() - 1);
+}
+
+void SimpleEvaluator::Program::appendUnary(Opcode::Enum opcode,
+                                           bsl::size_t  operand)
+{
+    BSLS_ASSERT_SAFE(opcode == Opcode::e_NOT || opcode == Opcode::e_NEGATE);
+
+    if (isLiteral(operand, size())) {
+        const Instruction literal = d_instructions[operand];
+
+        if (opcode == Opcode::e_NOT &&
+            literal.d_opcode == Opcode::e_PUSH_BOOLEAN) {
+            truncate(operand);
+            append(Opcode::e_PUSH_BOOLEAN, 0, !literal.d_immediate);
+            return;  // RETURN
+        }
+
+        if (opcode == Opcode::e_NEGATE &&
+            literal.d_opcode == Opcode::e_PUSH_INTEGER) {
+            truncate(operand);
+            append(Opcode::e_PUSH_INTEGER, 0, -literal.d_immediate);
+            return;  // RETURN
+        }
+
+        // Type mismatch: leave it to the evaluation to report the error.
+    }
+
+    append(opcode);
+}
+
+void SimpleEvaluator::Program::appendArithmetic(Opcode::Enum opcode,
+                                                bsl::size_t  left,
+                                                bsl::size_t  right)
+{
+    if (isLiteral(left, right) && isLiteral(right, size()) &&
+        d_instructions[left].d_opcode == Opcode::e_PUSH_INTEGER &&
+        d_instructions[right].d_opcode == Opcode::e_PUSH_INTEGER) {
+        const bsls::Types::Int64 a = d_instructions[left].d_immediate;
+        const bsls::Types::Int64 b = d_instructions[right].d_immediate;
+
+        // Do not fold divisions that would trap at compile time; they fail
+        // with 'ErrorType::e_ARITHMETIC' when evaluated.
+        const bool isDivision = opcode == Opcode::e_DIVIDE ||
+                                opcode == Opcode::e_MODULO;
+
+        if (!isDivision || (b != 0 && b != -1)) {
+            bsls::Types::Int64 result = 0;
+
+            switch (opcode) {
+            case Opcode::e_ADD: result = a + b; break;
+            case Opcode::e_SUBTRACT: result = a - b; break;
+            case Opcode::e_MULTIPLY: result = a * b; break;
+            case Opcode::e_DIVIDE: result = a / b; break;
+            case Opcode::e_MODULO: result = a % b; break;
+            default: BSLS_ASSERT_SAFE(false && "Not an arithmetic opcode");
+            }
+
+            truncate(left);
+            append(Opcode::e_PUSH_INTEGER, 0, result);
+            return;  // RETURN
+        }
+    }
+
+    append(opcode);
+}
+
+void SimpleEvaluator::Program::appendComparison(Comparator::Enum comparator,
+                                                bsl::size_t      left,
+                                                bsl::size_t      right)
+{
+    const bool isLeftLiteral  = isLiteral(left, right);
+    const bool isRightLiteral = isLiteral(right, size());
+
+    if (isLeftLiteral && isRightLiteral) {
+        const Instruction a = d_instructions[left];
+        const Instruction b = d_instructions[right];
+
+        if (a.d_opcode == Opcode::e_PUSH_INTEGER &&
+            b.d_opcode == Opcode::e_PUSH_INTEGER) {
+            truncate(left);
+            append(Opcode::e_PUSH_BOOLEAN,
+                   0,
+                   compare(comparator, a.d_immediate, b.d_immediate));
+            return;  // RETURN
+        }
+
+        if (a.d_opcode == Opcode::e_PUSH_STRING &&
+            b.d_opcode == Opcode::e_PUSH_STRING) {
+            const bslstl::StringRef aString(d_strings[a.d_operand]);
+            const bslstl::StringRef bString(d_strings[b.d_operand]);
+
+            truncate(left);
+            append(Opcode::e_PUSH_BOOLEAN,
+                   0,
+                   compare(comparator, aString, bString));
+            return;  // RETURN
+        }
+
+        // Type mismatch: leave it to the evaluation to report the error.
+        append(Opcode::e_COMPARE, comparator);
+        return;  // RETURN
+    }
+
+    if (isRightLiteral) {
+        const Instruction literal = d_instructions[right];
+
+        if (literal.d_opcode == Opcode::e_PUSH_INTEGER) {
+            truncate(right);
+            append(Opcode::e_COMPARE_INTEGER,
+                   comparator,
+                   literal.d_immediate);
+            return;  // RETURN
+        }
+
+        if (literal.d_opcode == Opcode::e_PUSH_STRING) {
+            truncate(right);
+            append(Opcode::e_COMPARE_STRING, comparator, literal.d_operand);
+            return;  // RETURN
+        }
+    }
+    else if (isLeftLiteral) {
+        const Instruction literal = d_instructions[left];
+
+        if (literal.d_opcode == Opcode::e_PUSH_INTEGER ||
+            literal.d_opcode == Opcode::e_PUSH_STRING) {
+            // Swap the operands.  Literals cannot fail, so evaluating the
+            // right operand first does not change the reported error, if
+            // any.
+
+            d_instructions.erase(d_instructions.begin() + left);
+            --d_depth;
+
+            // Retarget the jumps of the right operand.
+            for (bsl::size_t i = left; i < d_instructions.size(); ++i) {
+                Instruction& instruction = d_instructions[i];
+                if (instruction.d_opcode == Opcode::e_JUMP_IF_TRUE ||
+                    instruction.d_opcode == Opcode::e_JUMP_IF_FALSE) {
+                    --instruction.d_operand;
+                }
+            }
+
+            switch (comparator) {
+            case Comparator::e_LT: comparator = Comparator::e_GT; break;
+            case Comparator::e_LE: comparator = Comparator::e_GE; break;
+            case Comparator::e_GT: comparator = Comparator::e_LT; break;
+            case Comparator::e_GE: comparator = Comparator::e_LE; break;
+            default: break;
+            }
+
+            if (literal.d_opcode == Opcode::e_PUSH_INTEGER) {
+                append(Opcode::e_COMPARE_INTEGER,
+                       comparator,
+                       literal.d_immediate);
+            }
+            else {
+                append(Opcode::e_COMPARE_STRING,
+                       comparator,
+                       literal.d_operand);
+            }
+            return;  // RETURN
+        }
+    }
+
+    append(Opcode::e_COMPARE, comparator);
+}
+
+void SimpleEvaluator::Program::appendCheckBoolean()
+{
+    BSLS_ASSERT_SAFE(!d_instructions.empty());
+
+    switch (d_instructions.back().d_opcode) {
+    case Opcode::e_PUSH_BOOLEAN:
+    case Opcode::e_EXISTS:
+    case Opcode::e_NOT:
+    case Opcode::e_COMPARE:
+    case Opcode::e_COMPARE_INTEGER:
+    case Opcode::e_COMPARE_STRING:
+    case Opcode::e_CHECK_BOOLEAN: {
+        // The value is a boolean whenever the evaluation gets here.
+        return;  // RETURN
+    }
+    default: {
+        append(Opcode::e_CHECK_BOOLEAN);
+    }
+    }
+}
+
+void SimpleEvaluator::Program::patchJump(bsl::size_t position)
+{
+    BSLS_ASSERT_SAFE(d_instructions[position].d_opcode ==
+                         Opcode::e_JUMP_IF_TRUE ||
+                     d_instructions[position].d_opcode ==
+                         Opcode::e_JUMP_IF_FALSE);
+
+    d_instructions[position].d_operand = static_cast<int>(size());
+}
+
+void SimpleEvaluator::Program::resolveSlots(CompilationContext* context)
+{
+    BSLS_ASSERT_SAFE(context);
+
+    for (bsl::size_t i = 0; i < d_instructions.size(); ++i) {
+        Instruction& instruction = d_instructions[i];
+
+        if (instruction.d_opcode == Opcode::e_LOAD_PROPERTY ||
+            instruction.d_opcode == Opcode::e_EXISTS) {
+            instruction.d_immediate = context->propertySlot(
+                d_strings[instruction.d_operand]);
+        }
+    }
+
+    d_propertySlots_sp = context->d_propertySlots_sp;
+}
+
+void SimpleEvaluator::Program::internStrings(CompilationContext* context)
+{
+    BSLS_ASSERT_SAFE(context);
+
+    InternedStrings& strings = *context->d_internedStrings_sp;
+
+    d_internedStrings.resize(d_strings.size());
+    for (bsl::size_t i = 0; i < d_strings.size(); ++i) {
+        d_internedStrings[i] = strings.intern(d_strings[i]);
+    }
+
+    d_internedStrings_sp = context->d_internedStrings_sp;
+}
+
+// ACCESSORS
+bool SimpleEvaluator::Program::evaluate(EvaluationContext& context) const
+{
+    Value  stack[k_MAX_STACK_DEPTH];
+    Value* top = stack;  // one past the topmost value
+
+    const Instruction* const begin = d_instructions.data();
+    const Instruction* const end   = begin + d_instructions.size();
+
+    for (const Instruction* ip = begin; ip != end; ++ip) {
+        switch (ip->d_opcode) {
+        case Opcode::e_PUSH_BOOLEAN:
+        case Opcode::e_PUSH_INTEGER: {
+            top->d_type    = ip->d_opcode == Opcode::e_PUSH_BOOLEAN
+                                 ? ValueType::e_BOOLEAN
+                                 : ValueType::e_INTEGER;
+            top->d_integer = ip->d_immediate;
+            ++top;
+        } break;
+        case Opcode::e_PUSH_STRING: {
+            const bsl::string& literal = d_strings[ip->d_operand];
+            top->d_type                = ValueType::e_STRING;
+            top->d_string_p            = literal.data();
+            top->d_length              = literal.length();
+            top->d_slot                = -1;
+            ++top;
+        } break;
+        case Opcode::e_LOAD_PROPERTY: {
+            const bdld::Datum value = context.d_propertiesReader->getBySlot(
+                static_cast<int>(ip->d_immediate),
+                d_strings[ip->d_operand],
+                context.d_allocator);
+
+            if (value.isInteger64()) {
+                top->d_type    = ValueType::e_INTEGER;
+                top->d_integer = value.theInteger64();
+            }
+            else if (value.isInteger()) {
+                top->d_type    = ValueType::e_INTEGER;
+                top->d_integer = value.theInteger();
+            }
+            else if (value.isString()) {
+                const bslstl::StringRef property = value.theString();
+                top->d_type                      = ValueType::e_STRING;
+                top->d_string_p                  = property.data();
+                top->d_length                    = property.length();
+                top->d_slot = static_cast<int>(ip->d_immediate);
+            }
+            else if (value.isBoolean()) {
+                top->d_type    = ValueType::e_BOOLEAN;
+                top->d_integer = value.theBoolean();
+            }
+            else if (value.isError()) {
+                setPropertyError(context, value);
+                return false;  // RETURN
+            }
+            else {
+                top->d_type = ValueType::e_OTHER;
+            }
+            ++top;
+        } break;
+        case Opcode::e_EXISTS: {
+            const bdld::Datum value = context.d_propertiesReader->getBySlot(
+                static_cast<int>(ip->d_immediate),
+                d_strings[ip->d_operand],
+                context.d_allocator);
+
+            top->d_type    = ValueType::e_BOOLEAN;
+            top->d_integer = !value.isError();
+            ++top;
+        } break;
+        case Opcode::e_NOT: {
+            Value& value = top[-1];
+            if (value.d_type != ValueType::e_BOOLEAN) {
+                context.setError(ErrorType::e_TYPE);
+                return false;  // RETURN
+            }
+            value.d_integer = !value.d_integer;
+        } break;
+        case Opcode::e_NEGATE: {
+            Value& value = top[-1];
+            if (value.d_type != ValueType::e_INTEGER) {
+                context.setError(ErrorType::e_TYPE);
+                return false;  // RETURN
+            }
+            value.d_integer = -value.d_integer;
+        } break;
+        case Opcode::e_ADD:
+        case Opcode::e_SUBTRACT:
+        case Opcode::e_MULTIPLY:
+        case Opcode::e_DIVIDE:
+        case Opcode::e_MODULO: {
+            --top;
+            Value&       left  = top[-1];
+            const Value& right = top[0];
+            if (left.d_type != ValueType::e_INTEGER ||
+                right.d_type != ValueType::e_INTEGER) {
+                context.setError(ErrorType::e_TYPE);
+                return false;  // RETURN
+            }
+
+            if ((ip->d_opcode == Opcode::e_DIVIDE ||
+                 ip->d_opcode == Opcode::e_MODULO) &&
+                (right.d_integer == 0 ||
+                 (right.d_integer == -1 &&
+                  left.d_integer ==
+                      bsl::numeric_limits<bsls::Types::Int64>::min()))) {
+                // Fail rather than trap, as the batch evaluation does.
+                context.setError(ErrorType::e_ARITHMETIC);
+                return false;  // RETURN
+            }
+
+            switch (ip->d_opcode) {
+            case Opcode::e_ADD: left.d_integer += right.d_integer; break;
+            case Opcode::e_SUBTRACT: left.d_integer -= right.d_integer; break;
+            case Opcode::e_MULTIPLY: left.d_integer *= right.d_integer; break;
+            case Opcode::e_DIVIDE: left.d_integer /= right.d_integer; break;
+            default: left.d_integer %= right.d_integer; break;
+            }
+        } break;
+        case Opcode::e_COMPARE: {
+            --top;
+            Value&       left       = top[-1];
+            const Value& right      = top[0];
+            const Comparator::Enum comparator =
+                static_cast<Comparator::Enum>(ip->d_operand);
+
+            if (left.d_type == ValueType::e_STRING &&
+                right.d_type == ValueType::e_STRING) {
+                left.d_integer = compare(
+                    comparator,
+                    bslstl::StringRef(left.d_string_p, left.d_length),
+                    bslstl::StringRef(right.d_string_p, right.d_length));
+            }
+            else if (left.d_type == ValueType::e_INTEGER &&
+                     right.d_type == ValueType::e_INTEGER) {
+                left.d_integer = compare(comparator,
+                                         left.d_integer,
+                                         right.d_integer);
+            }
+            else {
+                context.setError(ErrorType::e_TYPE);
+                return false;  // RETURN
+            }
+            left.d_type = ValueType::e_BOOLEAN;
+        } break;
+        case Opcode::e_COMPARE_INTEGER: {
+            Value& value = top[-1];
+            if (value.d_type != ValueType::e_INTEGER) {
+                context.setError(ErrorType::e_TYPE);
+                return false;  // RETURN
+            }
+            value.d_type    = ValueType::e_BOOLEAN;
+            value.d_integer = compare(
+                static_cast<Comparator::Enum>(ip->d_operand),
+                value.d_integer,
+                ip->d_immediate);
+        } break;
+        case Opcode::e_COMPARE_STRING: {
+            Value& value = top[-1];
+            if (value.d_type != ValueType::e_STRING) {
+                context.setError(ErrorType::e_TYPE);
+                return false;  // RETURN
+            }
+
+            const Comparator::Enum comparator = static_cast<Comparator::Enum>(
+                ip->d_operand);
+            const bsl::size_t literal = static_cast<bsl::size_t>(
+                ip->d_immediate);
+            const bslstl::StringRef property(value.d_string_p,
+                                             value.d_length);
+
+            value.d_type = ValueType::e_BOOLEAN;
+
+            if (value.d_slot >= 0 && d_internedStrings_sp &&
+                (comparator == Comparator::e_EQ ||
+                 comparator == Comparator::e_NE)) {
+                // Equal strings have the same interned copy, and the
+                // literal has one.
+                const bsl::string* interned = context.findInterned(
+                    value.d_slot,
+                    property,
+                    *d_propertySlots_sp,
+                    *d_internedStrings_sp);
+                value.d_integer = (interned == d_internedStrings[literal]) ==
+                                  (comparator == Comparator::e_EQ);
+            }
+            else {
+                value.d_integer = compare(
+                    comparator,
+                    property,
+                    bslstl::StringRef(d_strings[literal]));
+            }
+        } break;
+        case Opcode::e_JUMP_IF_TRUE:
+        case Opcode::e_JUMP_IF_FALSE: {
+            const Value& value = top[-1];
+            if (value.d_type != ValueType::e_BOOLEAN) {
+                context.setError(ErrorType::e_TYPE);
+                return false;  // RETURN
+            }
+
+            const bool jumpIf = ip->d_opcode == Opcode::e_JUMP_IF_TRUE;
+            if (static_cast<bool>(value.d_integer) == jumpIf) {
+                // The loop increments 'ip' past the jump target minus one.
+                ip = begin + ip->d_operand - 1;
+            }
+            else {
+                --top;
+            }
+        } break;
+        case Opcode::e_CHECK_BOOLEAN: {
+            if (top[-1].d_type != ValueType::e_BOOLEAN) {
+                context.setError(ErrorType::e_TYPE);
+                return false;  // RETURN
+            }
+        } break;
+        }
+    }
+
+    BSLS_ASSERT_SAFE(top == stack + 1);
+
+    if (stack[0].d_type != ValueType::e_BOOLEAN) {
+        context.setError(ErrorType::e_TYPE);
+        return false;  // RETURN
+    }
+
+    return stack[0].d_integer != 0;
+}
+
+bsls::Types::Uint64
+SimpleEvaluator::Program::evaluate(EvaluationBatch& batch) const
+{
+    // Each instruction processes all the lanes, i.e. the messages of the
+    // batch, at once.  The lanes which fail have their bit set in 'failed'
+    // and yield 'false'.  Jumps cannot be taken by some lanes only, hence
+    // the lanes which would jump are parked until the program reaches the
+    // jump target, while the others execute the instructions in between.
+
+    typedef EvaluationBatch::Column Column;
+    typedef EvaluationBatch::Mask   Mask;
+    typedef bsls::Types::Int64      Int64;
+    typedef bsls::Types::Uint64     Uint64;
+
+    const int k_SIZE = EvaluationBatch::k_MAX_SIZE;
+
+    if (batch.d_size == 0) {
+        return 0;  // RETURN
+    }
+
+    if (batch.d_stack.size() < static_cast<bsl::size_t>(d_maxDepth)) {
+        batch.d_stack.resize(d_maxDepth);
+    }
+
+    const Mask all = batch.d_size == k_SIZE
+                         ? ~static_cast<Mask>(0)
+                         : (static_cast<Mask>(1) << batch.d_size) - 1;
+
+    Column* const stack  = batch.d_stack.data();
+    Column*       top    = stack;  // one past the topmost column
+    Mask          active = all;    // the lanes which are not parked
+    Mask          failed = 0;
+
+    ParkedLanes parked[k_MAX_JUMPS];
+    int         numParked = 0;
+
+    const Instruction* const begin = d_instructions.data();
+    const Instruction* const end   = begin + d_instructions.size();
+
+    for (const Instruction* ip = begin;; ++ip) {
+        // Resume the lanes which jumped here.
+        const bsl::size_t position = ip - begin;
+        for (int i = 0; i < numParked;) {
+            const ParkedLanes& lanes = parked[i];
+            if (lanes.d_target != position) {
+                ++i;
+                continue;  // CONTINUE
+            }
+
+            Column& value = top[-1];
+            value.d_isBoolean |= lanes.d_lanes;
+            value.d_isInteger &= ~lanes.d_lanes;
+            value.d_isString &= ~lanes.d_lanes;
+            value.d_isOther &= ~lanes.d_lanes;
+            value.d_true = lanes.d_value ? value.d_true | lanes.d_lanes
+                                         : value.d_true & ~lanes.d_lanes;
+            active |= lanes.d_lanes;
+
+            parked[i] = parked[--numParked];
+        }
+
+        if (ip == end) {
+            break;  // BREAK
+        }
+
+        switch (ip->d_opcode) {
+        case Opcode::e_PUSH_BOOLEAN: {
+            top->d_isBoolean = ~static_cast<Mask>(0);
+            top->d_isInteger = 0;
+            top->d_isString  = 0;
+            top->d_isOther   = 0;
+            top->d_true      = ip->d_immediate ? ~static_cast<Mask>(0) : 0;
+            ++top;
+        } break;
+        case Opcode::e_PUSH_INTEGER: {
+            top->d_isBoolean = 0;
+            top->d_isInteger = ~static_cast<Mask>(0);
+            top->d_isString  = 0;
+            top->d_isOther   = 0;
+            for (int i = 0; i < k_SIZE; ++i) {
+                top->d_integers[i] = ip->d_immediate;
+            }
+            ++top;
+        } break;
+        case Opcode::e_PUSH_STRING: {
+            const bslstl::StringRef literal(d_strings[ip->d_operand]);
+            top->d_isBoolean = 0;
+            top->d_isInteger = 0;
+            top->d_isString  = ~static_cast<Mask>(0);
+            top->d_isOther   = 0;
+            for (int i = 0; i < k_SIZE; ++i) {
+                top->d_strings[i] = literal;
+            }
+            ++top;
+        } break;
+        case Opcode::e_LOAD_PROPERTY:
+        case Opcode::e_EXISTS: {
+            const bsl::size_t slot = static_cast<bsl::size_t>(
+                ip->d_immediate);
+            Mask present = 0;
+
+            if (slot < batch.d_columns.size()) {
+                const Column& column = batch.d_columns[slot];
+                present = column.d_isBoolean | column.d_isInteger |
+                          column.d_isString | column.d_isOther;
+                if (ip->d_opcode == Opcode::e_LOAD_PROPERTY) {
+                    *top = column;
+                }
+            }
+            else if (ip->d_opcode == Opcode::e_LOAD_PROPERTY) {
+                top->d_isBoolean = 0;
+                top->d_isInteger = 0;
+                top->d_isString  = 0;
+                top->d_isOther   = 0;
+            }
+
+            if (ip->d_opcode == Opcode::e_LOAD_PROPERTY) {
+                failed |= active & ~present;
+            }
+            else {
+                top->d_isBoolean = ~static_cast<Mask>(0);
+                top->d_isInteger = 0;
+                top->d_isString  = 0;
+                top->d_isOther   = 0;
+                top->d_true      = present;
+            }
+            ++top;
+        } break;
+        case Opcode::e_NOT: {
+            Column& value = top[-1];
+            failed |= active & ~value.d_isBoolean;
+            value.d_true = ~value.d_true;
+        } break;
+        case Opcode::e_NEGATE: {
+            Column& value = top[-1];
+            failed |= active & ~value.d_isInteger;
+            for (int i = 0; i < k_SIZE; ++i) {
+                value.d_integers[i] = static_cast<Int64>(
+                    0 - static_cast<Uint64>(value.d_integers[i]));
+            }
+        } break;
+        case Opcode::e_ADD:
+        case Opcode::e_SUBTRACT:
+        case Opcode::e_MULTIPLY:
+        case Opcode::e_DIVIDE:
+        case Opcode::e_MODULO: {
+            --top;
+            Column&       left  = top[-1];
+            const Column& right = top[0];
+            const Mask    ok    = left.d_isInteger & right.d_isInteger;
+            failed |= active & ~ok;
+
+            Int64*       l = left.d_integers;
+            const Int64* r = right.d_integers;
+
+            // Wrap around rather than overflow, as lanes which are failed
+            // or parked hold arbitrary values.
+            switch (ip->d_opcode) {
+            case Opcode::e_ADD: {
+                for (int i = 0; i < k_SIZE; ++i) {
+                    l[i] = static_cast<Int64>(static_cast<Uint64>(l[i]) +
+                                              static_cast<Uint64>(r[i]));
+                }
+            } break;
+            case Opcode::e_SUBTRACT: {
+                for (int i = 0; i < k_SIZE; ++i) {
+                    l[i] = static_cast<Int64>(static_cast<Uint64>(l[i]) -
+                                              static_cast<Uint64>(r[i]));
+                }
+            } break;
+            case Opcode::e_MULTIPLY: {
+                for (int i = 0; i < k_SIZE; ++i) {
+                    l[i] = static_cast<Int64>(static_cast<Uint64>(l[i]) *
+                                              static_cast<Uint64>(r[i]));
+                }
+            } break;
+            default: {
+                // Fail the lanes which cannot be divided.
+                const bool isDivide   = ip->d_opcode == Opcode::e_DIVIDE;
+                Mask       undefined  = 0;
+                for (int i = 0; i < k_SIZE; ++i) {
+                    if (r[i] == 0 ||
+                        (r[i] == -1 &&
+                         l[i] == bsl::numeric_limits<Int64>::min())) {
+                        undefined |= static_cast<Mask>(1) << i;
+                        l[i] = 0;
+                    }
+                    else {
+                        l[i] = isDivide ? l[i] / r[i] : l[i] % r[i];
+                    }
+                }
+                failed |= active & ok & undefined;
+            } break;
+            }
+
+            left.d_isBoolean = 0;
+            left.d_isInteger = ok;
+            left.d_isString  = 0;
+            left.d_isOther   = 0;
+        } break;
+        case Opcode::e_COMPARE: {
+            --top;
+            Column&                left       = top[-1];
+            const Column&          right      = top[0];
+            const Comparator::Enum comparator = static_cast<Comparator::Enum>(
+                ip->d_operand);
+
+            const Mask integers = left.d_isInteger & right.d_isInteger;
+            const Mask strings  = left.d_isString & right.d_isString;
+            failed |= active & ~(integers | strings);
+
+            Mask result = 0;
+            if (integers) {
+                result = integers & compareIntegers(comparator,
+                                                    left.d_integers,
+                                                    right.d_integers);
+            }
+            for (Mask lanes = strings & active & ~failed; lanes;
+                 lanes &= lanes - 1) {
+                const int i = bdlb::BitUtil::numTrailingUnsetBits(
+                    static_cast<bsl::uint64_t>(lanes));
+                if (compare(comparator,
+                            left.d_strings[i],
+                            right.d_strings[i])) {
+                    result |= static_cast<Mask>(1) << i;
+                }
+            }
+
+            left.d_isBoolean = integers | strings;
+            left.d_isInteger = 0;
+            left.d_isString  = 0;
+            left.d_isOther   = 0;
+            left.d_true      = result;
+        } break;
+        case Opcode::e_COMPARE_INTEGER: {
+            Column& value = top[-1];
+            failed |= active & ~value.d_isInteger;
+
+            value.d_true = value.d_isInteger &
+                           compareIntegers(
+                               static_cast<Comparator::Enum>(ip->d_operand),
+                               value.d_integers,
+                               ip->d_immediate);
+            value.d_isBoolean = value.d_isInteger;
+            value.d_isInteger = 0;
+            value.d_isString  = 0;
+            value.d_isOther   = 0;
+        } break;
+        case Opcode::e_COMPARE_STRING: {
+            Column& value = top[-1];
+            failed |= active & ~value.d_isString;
+
+            const Comparator::Enum comparator = static_cast<Comparator::Enum>(
+                ip->d_operand);
+            const bslstl::StringRef literal(
+                d_strings[static_cast<bsl::size_t>(ip->d_immediate)]);
+
+            Mask result = 0;
+            for (Mask lanes = value.d_isString & active & ~failed; lanes;
+                 lanes &= lanes - 1) {
+                const int i = bdlb::BitUtil::numTrailingUnsetBits(
+                    static_cast<bsl::uint64_t>(lanes));
+                if (compare(comparator, value.d_strings[i], literal)) {
+                    result |= static_cast<Mask>(1) << i;
+                }
+            }
+
+            value.d_isBoolean = value.d_isString;
+            value.d_isInteger = 0;
+            value.d_isString  = 0;
+            value.d_isOther   = 0;
+            value.d_true      = result;
+        } break;
+        case Opcode::e_JUMP_IF_TRUE:
+        case Opcode::e_JUMP_IF_FALSE: {
+            const Column& value = top[-1];
+            failed |= active & ~value.d_isBoolean;
+
+            const bool jumpIf = ip->d_opcode == Opcode::e_JUMP_IF_TRUE;
+            const Mask jumping = active & value.d_isBoolean &
+                                 (jumpIf ? value.d_true : ~value.d_true);
+            --top;
+
+            if (jumping == 0) {
+                break;  // BREAK
+            }
+
+            BSLS_ASSERT_SAFE(numParked < k_MAX_JUMPS);
+            const ParkedLanes lanes = {static_cast<bsl::size_t>(
+                                           ip->d_operand),
+                                       jumping,
+                                       jumpIf};
+            parked[numParked++] = lanes;
+            active &= ~jumping;
+
+            if (active == 0) {
+                // All the lanes jump.  The value on top is intact.
+                ++top;
+                // The loop increments 'ip' past the jump target minus one.
+                ip = begin + ip->d_operand - 1;
+            }
+        } break;
+        case Opcode::e_CHECK_BOOLEAN: {
+            failed |= active & ~top[-1].d_isBoolean;
+        } break;
+        }
+    }
+
+    BSLS_ASSERT_SAFE(top == stack + 1);
+    BSLS_ASSERT_SAFE(numParked == 0);
+
+    return stack[0].d_isBoolean & stack[0].d_true & ~failed & all;
+}
+
+// -----------------------
+// class EvaluationContext
+// -----------------------
+
+// PRIVATE MANIPULATORS
+const bsl::string*
+EvaluationContext::findInterned(int                      slot,
+                                const bslstl::StringRef& value,
+                                const PropertySlots&     slots,
+                                const InternedStrings&   strings)
+{
+    BSLS_ASSERT_SAFE(0 <= slot);
+    BSLS_ASSERT_SAFE(d_propertiesReader);
+
+    const bsls::Types::Uint64 generation = d_propertiesReader->generation();
+    if (generation == 0) {
+        // No way to tell whether the message is the same.
+        return strings.find(value);  // RETURN
+    }
+
+    if (d_internedValues.size() <= static_cast<bsl::size_t>(slot)) {
+        const InternedValue none = {0, 0, 0, 0, 0};
+        d_internedValues.resize(slot + 1, none);
+    }
+
+    // Strings interned since the last lookup may include 'value', the one
+    // found may have been released since, and 'slot' may have been assigned
+    // to another property since.
+    InternedValue& cached = d_internedValues[slot];
+    if (cached.d_generation != generation || cached.d_strings_p != &strings ||
+        cached.d_stringsVersion != strings.version() ||
+        cached.d_slotsVersion != slots.version()) {
+        cached.d_generation     = generation;
+        cached.d_strings_p      = &strings;
+        cached.d_stringsVersion = strings.version();
+        cached.d_slotsVersion   = slots.version();
+        cached.d_value_p        = strings.find(value);
+    }
+
+    return cached.d_value_p;
+}
+
+// ---------------------
+// class EvaluationBatch
+// ---------------------
+
+// CREATORS
+EvaluationBatch::EvaluationBatch(bslma::Allocator* allocator)
+: d_allocator(allocator)
+, d_size(0)
+, d_columns(allocator)
+, d_buffers(allocator)
+, d_stack(allocator)
+{
+    // NOTHING
+}
+
+// MANIPULATORS
+void EvaluationBatch::reset()
+{
+    d_size = 0;
+
+    for (bsl::size_t i = 0; i < d_columns.size(); ++i) {
+        Column& column     = d_columns[i];
+        column.d_isBoolean = 0;
+        column.d_isInteger = 0;
+        column.d_isString  = 0;
+        column.d_isOther   = 0;
+    }
+}
+
+int EvaluationBatch::add()
+{
+    BSLS_ASSERT_SAFE(d_size < k_MAX_SIZE);
+
+    // The values of the new message are already missing, see 'reset'.
+    return d_size++;
+}
+
+void EvaluationBatch::setValue(int slot, int index, const bdld::Datum& value)
+{
+    BSLS_ASSERT_SAFE(0 <= slot);
+    BSLS_ASSERT_SAFE(0 <= index && index < d_size);
+
+    if (d_columns.size() <= static_cast<bsl::size_t>(slot)) {
+        d_columns.resize(slot + 1);
+        d_buffers.resize(d_columns.size() * k_MAX_SIZE);
+
+        // Strings in the columns refer to the buffers which may have moved.
+        for (bsl::size_t i = 0; i < d_columns.size(); ++i) {
+            Column& column = d_columns[i];
+            for (Mask lanes = column.d_isString; lanes; lanes &= lanes - 1) {
+                const int lane = bdlb::BitUtil::numTrailingUnsetBits(
+                    static_cast<bsl::uint64_t>(lanes));
+                column.d_strings[lane] = d_buffers[i * k_MAX_SIZE + lane];
+            }
+        }
+    }
+
+    Column&    column = d_columns[slot];
+    const Mask bit    = static_cast<Mask>(1) << index;
+
+    column.d_isBoolean &= ~bit;
+    column.d_isInteger &= ~bit;
+    column.d_isString &= ~bit;
+    column.d_isOther &= ~bit;
+
+    if (value.isInteger64()) {
+        column.d_isInteger |= bit;
+        column.d_integers[index] = value.theInteger64();
+    }
+    else if (value.isInteger()) {
+        column.d_isInteger |= bit;
+        column.d_integers[index] = value.theInteger();
+    }
+    else if (value.isString()) {
+        bsl::string& buffer = d_buffers[slot * k_MAX_SIZE + index];
+        buffer.assign(value.theString().data(), value.theString().length());
+
+        column.d_isString |= bit;
+        column.d_strings[index] = buffer;
+    }
+    else if (value.isBoolean()) {
+        column.d_isBoolean |= bit;
+        if (value.theBoolean()) {
+            column.d_true |= bit;
+        }
+        else {
+            column.d_true &= ~bit;
+        }
+    }
+    else if (!value.isError()) {
+        column.d_isOther |= bit;
+    }
+    // else the property is missing
+}
+
+void EvaluationBatch::load(int                       index,
+                           PropertiesReader&         reader,
+                           const CompilationContext& context)
+{
+    const PropertySlots::Slots& slots = context.d_propertySlots_sp->d_slots;
+    for (PropertySlots::Slots::const_iterator cit = slots.begin();
+         cit != slots.end();
+         ++cit) {
+        setValue(cit->second.d_slot,
+                 index,
+                 reader.getBySlot(cit->second.d_slot,
+                                  cit->first,
+                                  d_allocator));
+    }
+}
+
 }  // close package namespace
 }  // close enterprise namespace
@@ -26,15 +26,43 @@
 //  names.
 //  CompilationContext: Contains data used during parsing.
 //  EvaluationContext: Contains data used during evaluation.
+//  EvaluationBatch: Contains the property values of a batch of messages.
+//  InternedStrings: Set of distinct strings identified by address.
+//  PropertySlots: Slots of the properties used by compiled expressions.
 //
 //@DESCRIPTION: 'SimpleEvaluator' handles expression evaluation.
 //
+// An expression can also be evaluated against up to
+// 'EvaluationBatch::k_MAX_SIZE' messages at once, given their property
+// values loaded, one column per property, in an 'EvaluationBatch'.  Each
+// instruction of the compiled program then processes the whole column in a
+// loop the compiler can vectorize, and the results of comparisons and of
+// logical operators are combined as bit masks with one bit per message.
+//
+// The string literals of all the expressions compiled by the same
+// 'CompilationContext' are interned in its 'InternedStrings'.  When the
+// 'PropertiesReader' tells messages apart (see
+// 'PropertiesReader::generation'), equality and inequality between a string
+// property and a literal look the value of the property up in the interned
+// strings once per message, and then compare addresses for every expression
+// rather than comparing bytes.
+//
+// The property slots and the interned strings of a 'CompilationContext' are
+// referenced by the programs it compiles, and released when they are
+// destroyed, so that they are bounded by the expressions which are alive
+// rather than by all the expressions ever compiled.  Hence, like compiling,
+// destroying the last copy of an evaluator is not thread safe with respect
+// to other uses of the 'CompilationContext' which compiled it.
+//
 /// Thread Safety
 ///-------------
 //: o SimpleEvaluator is thread safe
 //: o PropertiesReader is NOT thread safe
 //: o CompilationContext is NOT thread safe
 //: o EvaluationContext is NOT thread safe
+//: o EvaluationBatch is NOT thread safe
+//: o InternedStrings is NOT thread safe
+//: o PropertySlots is NOT thread safe
 //
 /// Basic Usage Example
 ///-------------------
@@ -55,17 +83,40 @@
 // EvaluationContext    evaluationContext(&reader, allocator);
 // bool                 result = evaluator.evaluate(evaluationContext);
 //..
+//
+/// Batch Evaluation Example
+///------------------------
+//
+//..
+// EvaluationBatch batch(allocator);
+//
+// for (int i = 0; i < numMessages; ++i) {
+//     // Position 'reader' on the message 'i'.
+//     batch.load(batch.add(), reader, compilationContext);
+// }
+//
+// EvaluationBatch::Mask result;
+// if (0 == evaluator.evaluate(&result, batch)) {
+//     // Bit 'i' of 'result' is the result for the message 'i'.
+// }
+//..
 
 // BDE
 #include <bdld_datum.h>
 #include <bsl_functional.h>
+#include <bsl_list.h>
 #include <bsl_memory.h>
 #include <bsl_string.h>
 #include <bsl_unordered_map.h>
+#include <bsl_vector.h>
 #include <bslma_allocator.h>
 #include <bslma_managedptr.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_issame.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bslstl_stringref.h>
+#include <bsls_assert.h>
+#include <bsls_keyword.h>
 #include <bsls_types.h>
 
 #include <bmqu_memoutstream.h>
@@ -77,6 +128,7 @@ namespace bmqeval {
 
 // FORWARD DECLARATIONS
 class CompilationContext;
+class EvaluationBatch;
 class EvaluationContext;
 
 struct ErrorType {
@@ -105,7 +157,8 @@ struct ErrorType {
         e_TYPE             = -2,
         e_BINARY           = -3,
         e_UNDEFINED        = -4,
-        e_EVALUATION_LAST  = -4
+        e_ARITHMETIC       = -5,
+        e_EVALUATION_LAST  = -5
     };
 
     /// Return the non-modifiable string error description corresponding to
@@ -131,6 +184,174 @@ class PropertiesReader {
     /// Use the specified `allocator` for any memory allocation.
     virtual bdld::Datum get(const bsl::string& name,
                             bslma::Allocator*  allocator) = 0;
+
+    /// Return a `bdld::Datum` object with value for the property with the
+    /// specified `name` and the specified `slot`, as assigned by the
+    /// `CompilationContext` which compiled the expression (see
+    /// `CompilationContext::propertySlot`).  Use the specified `allocator`
+    /// for any memory allocation.  A reader used only with expressions
+    /// compiled by the same `CompilationContext` can use `slot` to remember
+    /// where the property is, rather than looking `name` up each time.  The
+    /// default implementation returns `get(name, allocator)`.
+    virtual bdld::Datum getBySlot(int                slot,
+                                  const bsl::string& name,
+                                  bslma::Allocator*  allocator);
+
+    // ACCESSORS
+
+    /// Return a non-zero value identifying the message which properties
+    /// this reader currently returns, and which changes whenever they may
+    /// change, or 0 if this reader does not keep track of messages.  An
+    /// evaluation may reuse what it derived from the value of a property
+    /// for as long as the generation is the same non-zero value.  The
+    /// default implementation returns 0.
+    virtual bsls::Types::Uint64 generation() const;
+};
+
+// =====================
+// class InternedStrings
+// =====================
+
+/// A set of distinct strings, each kept as a single copy which address
+/// identifies it: two strings in the set are equal if and only if their
+/// addresses are.  Each string is kept for as long as it is referenced:
+/// `intern` adds a reference, and `release` removes one.
+class InternedStrings {
+  private:
+    // PRIVATE TYPES
+    typedef bsl::list<bsl::string> Strings;
+
+    /// A string of the set, and the number of references to it.
+    struct Entry {
+        Strings::iterator d_string;
+        int               d_numReferences;
+    };
+
+    typedef bsl::unordered_map<bslstl::StringRef, Entry> Index;
+
+    // DATA
+
+    // The strings, never moved once added.
+    Strings d_strings;
+
+    // The strings by value, keys referring to `d_strings`.
+    Index d_index;
+
+    // Changes every time a string is added to or removed from the set.
+    bsls::Types::Uint64 d_version;
+
+  private:
+    // NOT IMPLEMENTED
+    InternedStrings(const InternedStrings&) BSLS_KEYWORD_DELETED;
+    InternedStrings& operator=(const InternedStrings&) BSLS_KEYWORD_DELETED;
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(InternedStrings,
+                                   bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create an empty set, using the specified `allocator` to supply
+    /// memory.
+    explicit InternedStrings(bslma::Allocator* allocator);
+
+    // MANIPULATORS
+
+    /// Return the address of the copy of the specified `value` in this
+    /// set, adding it if needed, and add a reference to it.  The address is
+    /// valid until the reference is released.
+    const bsl::string* intern(const bslstl::StringRef& value);
+
+    /// Remove a reference to the specified `value`, and remove `value` from
+    /// this set if it was the last one.  The behavior is undefined unless
+    /// `value` is returned by `intern` and not yet released as many times.
+    void release(const bsl::string* value);
+
+    // ACCESSORS
+
+    /// Return the address of the copy of the specified `value` in this
+    /// set, or 0 if `value` is not in this set.
+    const bsl::string* find(const bslstl::StringRef& value) const;
+
+    /// Return the number of strings in this set.
+    bsl::size_t size() const;
+
+    /// Return a value which changes every time a string is added to or
+    /// removed from this set.
+    bsls::Types::Uint64 version() const;
+};
+
+// ===================
+// class PropertySlots
+// ===================
+
+/// The slots of the properties used by a set of compiled expressions: small
+/// integers, from 0, each identifying one property.  A property keeps its
+/// slot for as long as it is referenced: `acquire` adds a reference, and
+/// `release` removes one.  The slot of a property which is no longer
+/// referenced is reused for the next new property.
+class PropertySlots {
+  private:
+    // PRIVATE TYPES
+
+    /// The slot of a property, and the number of references to it.
+    struct Entry {
+        int d_slot;
+        int d_numReferences;
+    };
+
+    typedef bsl::unordered_map<bsl::string, Entry> Slots;
+
+    // DATA
+
+    // The slots by property name.
+    Slots d_slots;
+
+    // The slots no longer assigned to any property.
+    bsl::vector<int> d_freeSlots;
+
+    // Changes every time a slot is assigned to a property.
+    bsls::Types::Uint64 d_version;
+
+  private:
+    // NOT IMPLEMENTED
+    PropertySlots(const PropertySlots&) BSLS_KEYWORD_DELETED;
+    PropertySlots& operator=(const PropertySlots&) BSLS_KEYWORD_DELETED;
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(PropertySlots, bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create an object assigning no slot, using the specified `allocator`
+    /// to supply memory.
+    explicit PropertySlots(bslma::Allocator* allocator);
+
+    // MANIPULATORS
+
+    /// Return the slot of the property with the specified `name`, assigning
+    /// one if `name` is not referenced, and add a reference to it.
+    int acquire(const bsl::string& name);
+
+    /// Remove a reference to the property with the specified `name`, and
+    /// make its slot available to another property if it was the last one.
+    /// The behavior is undefined unless `name` is acquired and not yet
+    /// released as many times.
+    void release(const bsl::string& name);
+
+    // ACCESSORS
+
+    /// Return the number of slots, assigned or not.  All the slots are less
+    /// than this number.
+    int numSlots() const;
+
+    /// Return a value which changes every time a slot is assigned to a
+    /// property.
+    bsls::Types::Uint64 version() const;
+
+    friend class EvaluationBatch;
 };
 
 // =====================
@@ -142,6 +363,9 @@ class SimpleEvaluator {
   private:
     // PRIVATE TYPES
 
+    // FORWARD DECLARATIONS
+    class Program;
+
     // ----------
     // Expression
     // ----------
@@ -154,6 +378,10 @@ class SimpleEvaluator {
 
         /// Evaluate an Expression.
         virtual bdld::Datum evaluate(EvaluationContext& context) const = 0;
+
+        /// Append the instructions computing this expression to the
+        /// specified `program`.
+        virtual void emit(Program* program) const = 0;
     };
 
     // Bison generates different code for different available standards:
@@ -201,6 +429,10 @@ class SimpleEvaluator {
         /// `false`;
         bdld::Datum
         evaluate(EvaluationContext& context) const BSLS_KEYWORD_OVERRIDE;
+
+        /// Append the instructions computing this expression to the
+        /// specified `program`.
+        void emit(Program* program) const BSLS_KEYWORD_OVERRIDE;
     };
 
     // --------------
@@ -226,6 +458,10 @@ class SimpleEvaluator {
         /// Return the integer passed to the constructor, as an Int64 Datum.
         bdld::Datum
         evaluate(EvaluationContext& context) const BSLS_KEYWORD_OVERRIDE;
+
+        /// Append the instructions computing this expression to the
+        /// specified `program`.
+        void emit(Program* program) const BSLS_KEYWORD_OVERRIDE;
     };
 
     // -------------
@@ -257,6 +493,10 @@ class SimpleEvaluator {
         /// Return the string passed to the constructor, as StringRef Datum.
         bdld::Datum
         evaluate(EvaluationContext& context) const BSLS_KEYWORD_OVERRIDE;
+
+        /// Append the instructions computing this expression to the
+        /// specified `program`.
+        void emit(Program* program) const BSLS_KEYWORD_OVERRIDE;
     };
 
     // --------------
@@ -284,6 +524,10 @@ class SimpleEvaluator {
         bdld::Datum
         evaluate(EvaluationContext& context) const BSLS_KEYWORD_OVERRIDE;
 
+        /// Append the instructions computing this expression to the
+        /// specified `program`.
+        void emit(Program* program) const BSLS_KEYWORD_OVERRIDE;
+
         /// Return `d_value`.
         bool value() const;
     };
@@ -319,6 +563,10 @@ class SimpleEvaluator {
         /// return a null datum.
         bdld::Datum
         evaluate(EvaluationContext& context) const BSLS_KEYWORD_OVERRIDE;
+
+        /// Append the instructions computing this expression to the
+        /// specified `program`.
+        void emit(Program* program) const BSLS_KEYWORD_OVERRIDE;
     };
 
     // --
@@ -354,6 +602,10 @@ class SimpleEvaluator {
         /// its type is not checked.
         bdld::Datum
         evaluate(EvaluationContext& context) const BSLS_KEYWORD_OVERRIDE;
+
+        /// Append the instructions computing this expression to the
+        /// specified `program`.
+        void emit(Program* program) const BSLS_KEYWORD_OVERRIDE;
     };
 
     // ---
@@ -389,6 +641,10 @@ class SimpleEvaluator {
         /// its type is not checked.
         bdld::Datum
         evaluate(EvaluationContext& context) const BSLS_KEYWORD_OVERRIDE;
+
+        /// Append the instructions computing this expression to the
+        /// specified `program`.
+        void emit(Program* program) const BSLS_KEYWORD_OVERRIDE;
     };
 
     // ------------------
@@ -423,6 +679,10 @@ class SimpleEvaluator {
         /// datum.
         bdld::Datum
         evaluate(EvaluationContext& context) const BSLS_KEYWORD_OVERRIDE;
+
+        /// Append the instructions computing this expression to the
+        /// specified `program`.
+        void emit(Program* program) const BSLS_KEYWORD_OVERRIDE;
     };
 
     // ----------
@@ -450,6 +710,10 @@ class SimpleEvaluator {
         /// and return a null datum.
         bdld::Datum
         evaluate(EvaluationContext& context) const BSLS_KEYWORD_OVERRIDE;
+
+        /// Append the instructions computing this expression to the
+        /// specified `program`.
+        void emit(Program* program) const BSLS_KEYWORD_OVERRIDE;
     };
 
     // ---
@@ -477,6 +741,10 @@ class SimpleEvaluator {
         /// evaluation, and return a null datum.
         bdld::Datum
         evaluate(EvaluationContext& context) const BSLS_KEYWORD_OVERRIDE;
+
+        /// Append the instructions computing this expression to the
+        /// specified `program`.
+        void emit(Program* program) const BSLS_KEYWORD_OVERRIDE;
     };
 
     // ------
@@ -512,6 +780,236 @@ class SimpleEvaluator {
         /// evaluation, and return a null datum.
         bdld::Datum
         evaluate(EvaluationContext& context) const BSLS_KEYWORD_OVERRIDE;
+
+        /// Append the instructions computing this expression to the
+        /// specified `program`.
+        void emit(Program* program) const BSLS_KEYWORD_OVERRIDE;
+    };
+
+    // -------
+    // Program
+    // -------
+
+    /// Flat, stack based form of an expression, emitted from the AST once
+    /// compilation succeeds.  Evaluating a program is a single loop over an
+    /// array of instructions operating on a small, fixed size stack of
+    /// untyped values: it makes no virtual calls other than reading
+    /// properties, and does not create a `bdld::Datum` for literals or
+    /// intermediate results.  Sub-expressions involving only literals are
+    /// folded while emitting, and comparisons against a literal are emitted
+    /// as a single instruction carrying the literal.
+    class Program {
+      public:
+        // PUBLIC TYPES
+        struct Opcode {
+            enum Enum {
+                e_PUSH_BOOLEAN,     // push 'd_immediate' as a boolean
+                e_PUSH_INTEGER,     // push 'd_immediate' as an integer
+                e_PUSH_STRING,      // push string number 'd_operand'
+                e_LOAD_PROPERTY,    // push property named 'd_operand',
+                                    // in slot 'd_immediate'
+                e_EXISTS,           // push whether 'd_operand', in slot
+                                    // 'd_immediate', exists
+                e_NOT,              // negate the boolean on top
+                e_NEGATE,           // negate the integer on top
+                e_ADD,              // replace top two integers with result
+                e_SUBTRACT,         // ditto
+                e_MULTIPLY,         // ditto
+                e_DIVIDE,           // ditto
+                e_MODULO,           // ditto
+                e_COMPARE,          // compare top two values
+                e_COMPARE_INTEGER,  // compare top with 'd_immediate'
+                e_COMPARE_STRING,   // compare top with string 'd_immediate'
+                e_JUMP_IF_TRUE,     // jump to 'd_operand' if top is true,
+                                    // pop otherwise
+                e_JUMP_IF_FALSE,    // jump to 'd_operand' if top is false,
+                                    // pop otherwise
+                e_CHECK_BOOLEAN     // fail unless top is a boolean
+            };
+        };
+
+        struct Comparator {
+            enum Enum { e_EQ, e_NE, e_LT, e_LE, e_GT, e_GE };
+        };
+
+        /// A single instruction.  For comparisons, `d_operand` holds the
+        /// `Comparator`.
+        struct Instruction {
+            Opcode::Enum       d_opcode;
+            int                d_operand;
+            bsls::Types::Int64 d_immediate;
+        };
+
+      private:
+        // DATA
+
+        // The instructions, in execution order.
+        bsl::vector<Instruction> d_instructions;
+
+        // The property names and string literals used by the instructions.
+        bsl::vector<bsl::string> d_strings;
+
+        // The interned copies of `d_strings`, by the same index, once
+        // `internStrings` is called.
+        bsl::vector<const bsl::string*> d_internedStrings;
+
+        // The set `d_internedStrings` refer to, shared with the
+        // `CompilationContext` which compiled this program.
+        bsl::shared_ptr<InternedStrings> d_internedStrings_sp;
+
+        // The slots of the properties loaded by the instructions, once
+        // `resolveSlots` is called, shared with the `CompilationContext`
+        // which compiled this program.
+        bsl::shared_ptr<PropertySlots> d_propertySlots_sp;
+
+        // The number of values on the stack after executing all the
+        // instructions emitted so far, and the maximum over the program.
+        int d_depth;
+        int d_maxDepth;
+
+        // PRIVATE MANIPULATORS
+
+        /// Remove the instructions from the specified `position` onward.
+        /// The behavior is undefined unless all of them push a literal.
+        void truncate(bsl::size_t position);
+
+        // PRIVATE ACCESSORS
+
+        /// Return `true` if the instructions in the range [`begin`, `end`)
+        /// consist of a single instruction pushing a literal.
+        bool isLiteral(bsl::size_t begin, bsl::size_t end) const;
+
+        // PRIVATE CLASS METHODS
+
+        /// Return the result of comparing the specified `left` and `right`
+        /// using the specified `comparator`.
+        template <typename TYPE>
+        static bool compare(Comparator::Enum comparator,
+                            const TYPE&      left,
+                            const TYPE&      right);
+
+        /// Return a mask with the bit `i` set if comparing `left[i]` and
+        /// `right[i]`, for the specified `left` and `right` columns of
+        /// `EvaluationBatch::k_MAX_SIZE` integers, using the specified
+        /// `comparator` yields `true`.
+        static bsls::Types::Uint64
+        compareIntegers(Comparator::Enum          comparator,
+                        const bsls::Types::Int64* left,
+                        const bsls::Types::Int64* right);
+
+        /// Return a mask with the bit `i` set if comparing `left[i]` and
+        /// the specified `right`, for the specified `left` column of
+        /// `EvaluationBatch::k_MAX_SIZE` integers, using the specified
+        /// `comparator` yields `true`.
+        static bsls::Types::Uint64
+        compareIntegers(Comparator::Enum          comparator,
+                        const bsls::Types::Int64* left,
+                        bsls::Types::Int64        right);
+
+        // NOT IMPLEMENTED
+        Program(const Program&) BSLS_KEYWORD_DELETED;
+        Program& operator=(const Program&) BSLS_KEYWORD_DELETED;
+
+      public:
+        // CREATORS
+
+        /// Create an empty program, using the specified `allocator` to
+        /// supply memory.
+        explicit Program(bslma::Allocator* allocator);
+
+        /// Destroy this program, releasing its property slots and its
+        /// interned strings.
+        ~Program();
+
+        // MANIPULATORS
+
+        /// Append an instruction with the specified `opcode`, and optionally
+        /// specified `operand` and `immediate`.  Return its position.
+        bsl::size_t append(Opcode::Enum       opcode,
+                           int                operand   = 0,
+                           bsls::Types::Int64 immediate = 0);
+
+        /// Return the number of the specified `value` in the string table,
+        /// adding it if needed.
+        int addString(const bsl::string& value);
+
+        /// Append the instructions applying the specified `opcode`, one of
+        /// `e_NOT` or `e_NEGATE`, to the operand emitted from the specified
+        /// `operand` position onward, folding it if it is a literal.
+        void appendUnary(Opcode::Enum opcode, bsl::size_t operand);
+
+        /// Append the instructions applying the specified arithmetic
+        /// `opcode` to the operands emitted from the specified `left` and
+        /// `right` positions onward, folding them if both are literals.
+        void appendArithmetic(Opcode::Enum opcode,
+                              bsl::size_t  left,
+                              bsl::size_t  right);
+
+        /// Append the instructions comparing, using the specified
+        /// `comparator`, the operands emitted from the specified `left` and
+        /// `right` positions onward.  Fold the comparison if both are
+        /// literals, and compare against an immediate value if one of them
+        /// is an integer or string literal.
+        void appendComparison(Comparator::Enum comparator,
+                              bsl::size_t      left,
+                              bsl::size_t      right);
+
+        /// Append an `e_CHECK_BOOLEAN` instruction, unless the last
+        /// instruction always yields a boolean.
+        void appendCheckBoolean();
+
+        /// Make the jump at the specified `position` target the end of the
+        /// program.
+        void patchJump(bsl::size_t position);
+
+        /// Assign to each property loaded by this program its slot in the
+        /// specified `context`.  The slots are released when this program
+        /// is destroyed.
+        void resolveSlots(CompilationContext* context);
+
+        /// Intern all the strings of this program in the interned strings
+        /// of the specified `context`.  The strings are released when this
+        /// program is destroyed.
+        void internStrings(CompilationContext* context);
+
+        // ACCESSORS
+
+        /// Return the number of instructions in this program.
+        bsl::size_t size() const;
+
+        /// Return the maximum number of values on the stack during an
+        /// evaluation of this program.
+        int maxDepth() const;
+
+        /// Return the instruction at the specified `position`.
+        const Instruction& instruction(bsl::size_t position) const;
+
+        /// Return the string number `index` in the string table.
+        const bsl::string& stringAt(bsl::size_t index) const;
+
+        /// Run this program, reading properties via the specified
+        /// `context`.  Return the boolean result, or `false` after setting
+        /// the error in `context` if the evaluation fails.
+        bool evaluate(EvaluationContext& context) const;
+
+        /// Run this program against all the messages of the specified
+        /// `batch` at once, using `batch` as the workspace.  Return a mask
+        /// with the bit `i` set if the program yields `true` for the
+        /// message `i`.  A message for which the evaluation fails, e.g.
+        /// because of a division by zero, yields `false`.
+        bsls::Types::Uint64 evaluate(EvaluationBatch& batch) const;
+
+        // CLASS METHODS
+
+        /// Return the comparator corresponding to the specified `Op`, one
+        /// of the standard comparison functors.
+        template <template <typename> class Op>
+        static Comparator::Enum toComparator();
+
+        /// Return the opcode corresponding to the specified `Op`, one of
+        /// the standard binary arithmetic operation functors.
+        template <template <typename> class Op>
+        static Opcode::Enum toArithmeticOpcode();
     };
 
   private:
@@ -524,6 +1022,9 @@ class SimpleEvaluator {
     // The expression to evaluate.
     bsl::shared_ptr<Expression> d_expression;
 
+    // The program emitted from `d_expression`, used for evaluation.
+    bsl::shared_ptr<const Program> d_program;
+
     // The flag indicating that `compile` was called for this expression.
     bool d_isCompiled;
 
@@ -535,6 +1036,43 @@ class SimpleEvaluator {
                       CompilationContext& context);
 
   public:
+    // PUBLIC TYPES
+
+    /// A comparison of a property with a literal which must hold for an
+    /// expression to evaluate to `true`, allowing to rule out the
+    /// expression, for a given message, from the value of that property
+    /// alone.  For example, the guard of `region == "X" && tier > 3` is
+    /// `region == "X"`.  Note that the string references remain valid for
+    /// as long as the evaluator the guard is loaded from, or any copy of
+    /// it, is neither destroyed nor recompiled.
+    struct Guard {
+        // TYPES
+        enum Operator { e_EQ, e_NE, e_LT, e_LE, e_GT, e_GE };
+
+        // DATA
+
+        /// The name of the property.
+        bslstl::StringRef d_property;
+
+        /// The slot of the property (see `PropertiesReader::getBySlot`).
+        int d_slot;
+
+        /// How the value of the property compares to the literal.
+        Operator d_operator;
+
+        /// `true` if the literal is `d_string`, and `false` if it is
+        /// `d_integer`.
+        bool d_isString;
+
+        bsls::Types::Int64 d_integer;
+
+        bslstl::StringRef d_string;
+
+        /// `true` if the guard is the whole expression, i.e. the expression
+        /// evaluates to `true` if and only if the guard holds.
+        bool d_isExact;
+    };
+
     // PUBLIC CONSTANTS
     enum {
         /// The maximum length of an expression string.
@@ -562,9 +1100,20 @@ class SimpleEvaluator {
     int compile(const bsl::string& expression, CompilationContext& context);
 
     /// Evaluate the expression, compiled from the `expression` passed to
-    /// the constructor.
+    /// the constructor.  Note that evaluation runs the flat program emitted
+    /// by `compile` rather than walking the expression tree.
     bool evaluate(EvaluationContext& context) const;
 
+    /// Evaluate the expression against all the messages of the specified
+    /// `batch`, and load into the specified `result` a mask with the bit
+    /// `i` set if it yields `true` for the message `i`, which is what
+    /// `evaluate(context)` returns for that message.  Return 0 on success,
+    /// and non-zero if the expression cannot be evaluated in batches, in
+    /// which case `result` is unchanged.  The behavior is undefined unless
+    /// `isValid()` returns `true` and the expression is compiled by the
+    /// `CompilationContext` used to load `batch`.
+    int evaluate(bsls::Types::Uint64* result, EvaluationBatch& batch) const;
+
     /// Return `true` if the `compile` was called for this object.
     bool isCompiled() const;
 
@@ -573,6 +1122,13 @@ class SimpleEvaluator {
     /// only if `isValid()` returns `true`.
     bool isValid() const;
 
+    /// Load into the specified `guard` the comparison of a property with
+    /// an integer or string literal that must hold for the compiled
+    /// expression to evaluate to `true`, and return `true`.  Return `false`
+    /// if there is no such comparison at the beginning of the expression
+    /// or if the object does not contain a valid expression.
+    bool loadGuard(Guard* guard) const;
+
     // PUBLIC STATIC FUNCTIONS
 
     /// Check `expression`. Return true if it is syntactically correct, and
@@ -638,6 +1194,13 @@ class CompilationContext {
     // The resulting AST, if `d_validationOnly` is set to `false`.
     ExpressionPtr d_expression;
 
+    // The slots of the properties used by the compiled programs, shared
+    // with them.
+    bsl::shared_ptr<PropertySlots> d_propertySlots_sp;
+
+    // The strings interned by the compiled programs, shared with them.
+    bsl::shared_ptr<InternedStrings> d_internedStrings_sp;
+
     // PRIVATE MEMBER FUNCTIONS
 
     /// Return the index of the property, i.e. he position of the property
@@ -700,6 +1263,27 @@ class CompilationContext {
     /// Return the last message.
     bsl::string lastErrorMessage() const;
 
+    /// Return the number of slots.  Slots are numbered from 0.
+    int numPropertySlots() const;
+
+    /// Return the strings interned by the compilations so far.
+    const InternedStrings& internedStrings() const;
+
+    // MANIPULATORS
+
+    /// Return the slot of the property with the specified `name`, assigning
+    /// one if `name` is not referenced, and add a reference to it.  A
+    /// property keeps its slot for as long as it is referenced, so that all
+    /// the expressions compiled by this object agree on the slot of each
+    /// property.  Each expression compiled by this object references the
+    /// properties it loads until it is destroyed.
+    int propertySlot(const bsl::string& name);
+
+    /// Remove a reference to the property with the specified `name`, added
+    /// by `propertySlot`.
+    void releasePropertySlot(const bsl::string& name);
+
+    friend class EvaluationBatch;
     friend class SimpleEvaluator;
     friend class SimpleEvaluatorParser;
 };
@@ -711,6 +1295,22 @@ class CompilationContext {
 /// Contain the inputs of an evaluation.
 class EvaluationContext {
   private:
+    // PRIVATE TYPES
+
+    /// The interned copy of the string value of a property, found for the
+    /// message of generation `d_generation` in `d_strings_p` at version
+    /// `d_stringsVersion`, when the slots of the properties were at version
+    /// `d_slotsVersion`.
+    struct InternedValue {
+        bsls::Types::Uint64    d_generation;
+        const InternedStrings* d_strings_p;
+        bsls::Types::Uint64    d_stringsVersion;
+        bsls::Types::Uint64    d_slotsVersion;
+        const bsl::string*     d_value_p;
+    };
+
+    // DATA
+
     /// The allocator to use during evaluation.
     bslma::Allocator* d_allocator;
 
@@ -722,6 +1322,22 @@ class EvaluationContext {
     ///        an error occurred
     ErrorType::Enum d_lastError;
 
+    /// The interned copies of string property values, by slot.
+    bsl::vector<InternedValue> d_internedValues;
+
+    // PRIVATE MANIPULATORS
+
+    /// Return the address of the copy of the specified `value` of the
+    /// property in the specified `slot` of the specified `slots` in the
+    /// specified `strings`, or 0 if `value` is not in `strings`.  Look
+    /// `value` up only once per message, if the properties reader keeps
+    /// track of messages.  The behavior is undefined unless `slots` and
+    /// `strings` belong to the same `CompilationContext`.
+    const bsl::string* findInterned(int                      slot,
+                                    const bslstl::StringRef& value,
+                                    const PropertySlots&     slots,
+                                    const InternedStrings&   strings);
+
   public:
     // CREATORS
     explicit EvaluationContext(PropertiesReader* propertiesReader,
@@ -742,6 +1358,109 @@ class EvaluationContext {
     friend class SimpleEvaluator;
 };
 
+// =====================
+// class EvaluationBatch
+// =====================
+
+/// Contain the property values of a batch of up to `k_MAX_SIZE` messages,
+/// one column per property slot (see `CompilationContext::propertySlot`),
+/// and the workspace to evaluate expressions against all of them at once.
+class EvaluationBatch {
+  public:
+    // PUBLIC TYPES
+
+    /// A set of messages in the batch, bit `i` standing for the message
+    /// `i`.
+    typedef bsls::Types::Uint64 Mask;
+
+    // PUBLIC CONSTANTS
+    enum {
+        /// The maximum number of messages in a batch.
+        k_MAX_SIZE = 64
+    };
+
+  private:
+    // PRIVATE TYPES
+
+    /// The values of a property, or of an intermediate result, for all the
+    /// messages of the batch.  The type of the value for the message `i` is
+    /// given by the mask having bit `i` set, and the value is missing if
+    /// none has.  Booleans are stored in `d_true`.
+    struct Column {
+        Mask               d_isBoolean;
+        Mask               d_isInteger;
+        Mask               d_isString;
+        Mask               d_isOther;
+        Mask               d_true;
+        bsls::Types::Int64 d_integers[k_MAX_SIZE];
+        bslstl::StringRef  d_strings[k_MAX_SIZE];
+    };
+
+    // DATA
+
+    // The allocator to use during evaluation.
+    bslma::Allocator* d_allocator;
+
+    // The number of messages in the batch.
+    int d_size;
+
+    // The property values, by slot.
+    bsl::vector<Column> d_columns;
+
+    // The copies of string values, by slot and by message.
+    bsl::vector<bsl::string> d_buffers;
+
+    // The stack of the program being evaluated.
+    bsl::vector<Column> d_stack;
+
+  private:
+    // NOT IMPLEMENTED
+    EvaluationBatch(const EvaluationBatch&) BSLS_KEYWORD_DELETED;
+    EvaluationBatch& operator=(const EvaluationBatch&) BSLS_KEYWORD_DELETED;
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(EvaluationBatch,
+                                   bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create an empty batch, using the specified `allocator` to supply
+    /// memory.
+    explicit EvaluationBatch(bslma::Allocator* allocator);
+
+    // MANIPULATORS
+
+    /// Empty the batch.
+    void reset();
+
+    /// Add a message with all the property values missing to the batch, and
+    /// return its index.  The behavior is undefined unless
+    /// `size() < k_MAX_SIZE`.
+    int add();
+
+    /// Set the value of the property in the specified `slot` for the
+    /// message at the specified `index` to the specified `value`.  An
+    /// error `value` denotes a missing property.  Copy string values.  The
+    /// behavior is undefined unless `0 <= index < size()`.
+    void setValue(int slot, int index, const bdld::Datum& value);
+
+    /// Set the values of all the properties which the specified `context`
+    /// assigned a slot to for the message at the specified `index`, reading
+    /// them from the specified `reader`.  The behavior is undefined unless
+    /// `0 <= index < size()`.
+    void load(int                       index,
+              PropertiesReader&         reader,
+              const CompilationContext& context);
+
+    // ACCESSORS
+
+    /// Return the number of messages in the batch.
+    int size() const;
+
+    friend class SimpleEvaluator;
+};
+
 // ============================================================================
 //                             INLINE DEFINITIONS
 // ============================================================================
@@ -780,12 +1499,63 @@ inline const char* ErrorType::toString(ErrorType::Enum value)
     case bmqeval::ErrorType::e_UNDEFINED: {
         return "undefined error";  // RETURN
     }
+    case bmqeval::ErrorType::e_ARITHMETIC: {
+        return "division by zero or overflow in expression";  // RETURN
+    }
     default: {
         return "unknown error";  // RETURN
     }
     }
 }
 
+// ---------------------
+// class InternedStrings
+// ---------------------
+
+// CREATORS
+inline InternedStrings::InternedStrings(bslma::Allocator* allocator)
+: d_strings(allocator)
+, d_index(allocator)
+, d_version(0)
+{
+    // NOTHING
+}
+
+// ACCESSORS
+inline bsl::size_t InternedStrings::size() const
+{
+    return d_index.size();
+}
+
+inline bsls::Types::Uint64 InternedStrings::version() const
+{
+    return d_version;
+}
+
+// -------------------
+// class PropertySlots
+// -------------------
+
+// CREATORS
+inline PropertySlots::PropertySlots(bslma::Allocator* allocator)
+: d_slots(allocator)
+, d_freeSlots(allocator)
+, d_version(0)
+{
+    // NOTHING
+}
+
+// ACCESSORS
+inline int PropertySlots::numSlots() const
+{
+    return static_cast<int>(d_slots.size() + d_freeSlots.size());
+}
+
+inline bsls::Types::Uint64 PropertySlots::version() const
+{
+    return d_version;
+}
+
 // ---------------------
 // class SimpleEvaluator
 // ---------------------
@@ -889,6 +1659,18 @@ SimpleEvaluator::Comparison<Op>::evaluate(EvaluationContext& context) const
     return bdld::Datum::createBoolean(Op<bsls::Types::Int64>()(a, b));
 }
 
+template <template <typename> class Op>
+void SimpleEvaluator::Comparison<Op>::emit(Program* program) const
+{
+    const bsl::size_t left = program->size();
+    d_left->emit(program);
+
+    const bsl::size_t right = program->size();
+    d_right->emit(program);
+
+    program->appendComparison(Program::toComparator<Op>(), left, right);
+}
+
 // ----------------------------------
 // template class SimpleEvaluator::Or
 // ----------------------------------
@@ -966,6 +1748,18 @@ bdld::Datum SimpleEvaluator::NumBinaryOperation<Op>::evaluate(
     return bdld::Datum::createInteger64(result, context.d_allocator);
 }
 
+template <template <typename> class Op>
+void SimpleEvaluator::NumBinaryOperation<Op>::emit(Program* program) const
+{
+    const bsl::size_t left = program->size();
+    d_left->emit(program);
+
+    const bsl::size_t right = program->size();
+    d_right->emit(program);
+
+    program->appendArithmetic(Program::toArithmeticOpcode<Op>(), left, right);
+}
+
 // ------------------------------------------
 // template class SimpleEvaluator::UnaryMinus
 // ------------------------------------------
@@ -984,6 +1778,82 @@ inline SimpleEvaluator::Not::Not(ExpressionPtr expression)
 {
 }
 
+// ------------------------------
+// class SimpleEvaluator::Program
+// ------------------------------
+
+inline bsl::size_t SimpleEvaluator::Program::size() const
+{
+    return d_instructions.size();
+}
+
+inline int SimpleEvaluator::Program::maxDepth() const
+{
+    return d_maxDepth;
+}
+
+inline const SimpleEvaluator::Program::Instruction&
+SimpleEvaluator::Program::instruction(bsl::size_t position) const
+{
+    BSLS_ASSERT_SAFE(position < d_instructions.size());
+
+    return d_instructions[position];
+}
+
+inline const bsl::string&
+SimpleEvaluator::Program::stringAt(bsl::size_t index) const
+{
+    BSLS_ASSERT_SAFE(index < d_strings.size());
+
+    return d_strings[index];
+}
+
+template <template <typename> class Op>
+inline SimpleEvaluator::Program::Comparator::Enum
+SimpleEvaluator::Program::toComparator()
+{
+    if (bsl::is_same<Op<int>, bsl::equal_to<int> >::value) {
+        return Comparator::e_EQ;  // RETURN
+    }
+    if (bsl::is_same<Op<int>, bsl::not_equal_to<int> >::value) {
+        return Comparator::e_NE;  // RETURN
+    }
+    if (bsl::is_same<Op<int>, bsl::less<int> >::value) {
+        return Comparator::e_LT;  // RETURN
+    }
+    if (bsl::is_same<Op<int>, bsl::less_equal<int> >::value) {
+        return Comparator::e_LE;  // RETURN
+    }
+    if (bsl::is_same<Op<int>, bsl::greater<int> >::value) {
+        return Comparator::e_GT;  // RETURN
+    }
+
+    BSLS_ASSERT_SAFE(
+        (bsl::is_same<Op<int>, bsl::greater_equal<int> >::value));
+    return Comparator::e_GE;
+}
+
+template <template <typename> class Op>
+inline SimpleEvaluator::Program::Opcode::Enum
+SimpleEvaluator::Program::toArithmeticOpcode()
+{
+    if (bsl::is_same<Op<int>, bsl::plus<int> >::value) {
+        return Opcode::e_ADD;  // RETURN
+    }
+    if (bsl::is_same<Op<int>, bsl::minus<int> >::value) {
+        return Opcode::e_SUBTRACT;  // RETURN
+    }
+    if (bsl::is_same<Op<int>, bsl::multiplies<int> >::value) {
+        return Opcode::e_MULTIPLY;  // RETURN
+    }
+    if (bsl::is_same<Op<int>, bsl::divides<int> >::value) {
+        return Opcode::e_DIVIDE;  // RETURN
+    }
+
+    BSLS_ASSERT_SAFE((bsl::is_same<Op<int>, bsl::modulus<int> >::value));
+    return Opcode::e_MODULO;
+}
+
 // ------------------------
 // class CompilationContext
 // ------------------------
@@ -996,6 +1866,10 @@ inline CompilationContext::CompilationContext(bslma::Allocator* allocator)
 , d_numProperties(0)
 , d_lastError(ErrorType::e_OK)
 , d_os(allocator)
+, d_propertySlots_sp(
+      bsl::allocate_shared<PropertySlots>(allocator, allocator))
+, d_internedStrings_sp(
+      bsl::allocate_shared<InternedStrings>(allocator, allocator))
 {
 }
 
@@ -1014,6 +1888,26 @@ inline bsl::string CompilationContext::lastErrorMessage() const
     return d_os.str();
 }
 
+inline int CompilationContext::numPropertySlots() const
+{
+    return d_propertySlots_sp->numSlots();
+}
+
+inline const InternedStrings& CompilationContext::internedStrings() const
+{
+    return *d_internedStrings_sp;
+}
+
+inline int CompilationContext::propertySlot(const bsl::string& name)
+{
+    return d_propertySlots_sp->acquire(name);
+}
+
+inline void CompilationContext::releasePropertySlot(const bsl::string& name)
+{
+    d_propertySlots_sp->release(name);
+}
+
 inline int CompilationContext::getPropertyIndex(const bsl::string& property,
                                                 Type               type)
 {
@@ -1161,6 +2055,7 @@ inline EvaluationContext::EvaluationContext(PropertiesReader* propertiesReader,
 : d_allocator(allocator)
 , d_propertiesReader(propertiesReader)
 , d_lastError(ErrorType::e_OK)
+, d_internedValues(allocator)
 {
 }
 
@@ -1191,6 +2086,15 @@ inline ErrorType::Enum EvaluationContext::lastError() const
     return d_lastError;
 }
 
+// ---------------------
+// class EvaluationBatch
+// ---------------------
+
+inline int EvaluationBatch::size() const
+{
+    return d_size;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -24,7 +24,11 @@
 #include <bmqtst_testhelper.h>
 
 #include <bdlma_localsequentialallocator.h>
+#include <bsl_memory.h>
+#include <bsl_iomanip.h>
+#include <bsl_limits.h>
 #include <bsl_sstream.h>
+#include <bsl_vector.h>
 
 // BENCHMARKING LIBRARY
 #ifdef BMQTST_BENCHMARK_ENABLED
@@ -81,6 +85,77 @@ bdld::Datum MockPropertiesReader::get(const bsl::string& name,
     return iter->second;
 }
 
+/// A `MockPropertiesReader` which records the slot of each property read by
+/// slot.
+class SlotPropertiesReader : public MockPropertiesReader {
+  public:
+    // PUBLIC DATA
+    bsl::unordered_map<bsl::string, int> d_slots;
+
+    // CREATORS
+    SlotPropertiesReader(bslma::Allocator* allocator);
+
+    // MANIPULATORS
+
+    /// Record the specified `slot` for the specified `name`, asserting it
+    /// is the same as previously recorded, and return `get(name,
+    /// allocator)`.
+    bdld::Datum getBySlot(int                slot,
+                          const bsl::string& name,
+                          bslma::Allocator*  allocator) BSLS_KEYWORD_OVERRIDE;
+};
+
+SlotPropertiesReader::SlotPropertiesReader(bslma::Allocator* allocator)
+: MockPropertiesReader(allocator)
+, d_slots(allocator)
+{
+}
+
+bdld::Datum SlotPropertiesReader::getBySlot(int                slot,
+                                            const bsl::string& name,
+                                            bslma::Allocator*  allocator)
+{
+    bsl::unordered_map<bsl::string, int>::const_iterator iter = d_slots.find(
+        name);
+
+    if (iter == d_slots.end()) {
+        d_slots[name] = slot;
+    }
+    else {
+        BMQTST_ASSERT_EQ_D(name, iter->second, slot);
+    }
+
+    return get(name, allocator);
+}
+
+/// A `MockPropertiesReader` which tells messages apart by the generation
+/// set in `d_generation`.
+class GenerationPropertiesReader : public MockPropertiesReader {
+  public:
+    // PUBLIC DATA
+    bsls::Types::Uint64 d_generation;
+
+    // CREATORS
+    GenerationPropertiesReader(bslma::Allocator* allocator);
+
+    // ACCESSORS
+
+    /// Return `d_generation`.
+    bsls::Types::Uint64 generation() const BSLS_KEYWORD_OVERRIDE;
+};
+
+GenerationPropertiesReader::GenerationPropertiesReader(
+    bslma::Allocator* allocator)
+: MockPropertiesReader(allocator)
+, d_generation(1)
+{
+}
+
+bsls::Types::Uint64 GenerationPropertiesReader::generation() const
+{
+    return d_generation;
+}
+
 #ifdef BMQTST_BENCHMARK_ENABLED
 static void testN1_SimpleEvaluator_GoogleBenchmark(benchmark::State& state)
 {
@@ -104,12 +179,123 @@ static void testN1_SimpleEvaluator_GoogleBenchmark(benchmark::State& state)
     }
     // </time>
 }
+
+/// Expressions evaluated by `testN2_SimpleEvaluatorPerMessage`, from the
+/// cheapest to the most expensive.
+static const char* const k_BENCHMARK_EXPRESSIONS[] = {
+    "b_true",
+    "i64_42 == 42",
+    "s_foo == \"foo\"",
+    "i_2 * 20 + 2 == 42",
+    "false || (i64_42==42 && s_foo==\"foo\")",
+    "exists(i_42) && i_42 > 41 && i_1 + 2 == 3",
+    "b_false || i_0 == 1 || i_1 == 2 || i_3 == 3",
+};
+
+static void
+testN2_SimpleEvaluatorPerMessage_GoogleBenchmark(benchmark::State& state)
+{
+    const char* expression = k_BENCHMARK_EXPRESSIONS[state.range(0)];
+
+    bdlma::LocalSequentialAllocator<2048> localAllocator;
+    MockPropertiesReader                  reader(&localAllocator);
+    EvaluationContext evaluationContext(&reader, &localAllocator);
+
+    CompilationContext compilationContext(&localAllocator);
+    SimpleEvaluator    evaluator;
+
+    BMQTST_ASSERT_EQ_D(expression,
+                       evaluator.compile(expression, compilationContext),
+                       0);
+    BMQTST_ASSERT_EQ_D(expression,
+                       evaluator.evaluate(evaluationContext),
+                       true);
+
+    // <time>
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(evaluator.evaluate(evaluationContext));
+    }
+    // </time>
+
+    state.SetLabel(expression);
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void
+testN3_SimpleEvaluatorStringEquality_GoogleBenchmark(benchmark::State& state)
+{
+    // Evaluate 1000 subscriptions comparing the same string property with
+    // distinct literals of 'state.range(0)' bytes sharing a long prefix, as
+    // for each new message.
+
+    const int k_NUM_SUBSCRIPTIONS = 1000;
+    const int length              = static_cast<int>(state.range(0));
+
+    bslma::Allocator* allocator = bmqtst::TestHelperUtil::allocator();
+
+    GenerationPropertiesReader reader(allocator);
+    EvaluationContext          evaluationContext(&reader, allocator);
+    CompilationContext         compilationContext(allocator);
+
+    bsl::vector<bsl::shared_ptr<SimpleEvaluator> > evaluators(allocator);
+    bsl::string                                     value(allocator);
+
+    for (int i = 0; i < k_NUM_SUBSCRIPTIONS; ++i) {
+        bmqu::MemOutStream literal(allocator);
+        literal << bsl::setfill('x') << bsl::setw(length) << i;
+
+        bmqu::MemOutStream expression(allocator);
+        expression << "s_x " << (i % 2 ? "!=" : "==") << " \""
+                   << literal.str() << "\"";
+
+        bsl::shared_ptr<SimpleEvaluator> evaluator;
+        evaluator.createInplace(allocator);
+        BMQTST_ASSERT_EQ(evaluator->compile(expression.str(),
+                                            compilationContext),
+                         0);
+        evaluators.push_back(evaluator);
+
+        if (i == k_NUM_SUBSCRIPTIONS / 2) {
+            value = literal.str();
+        }
+    }
+
+    reader.d_map["s_x"] = bdld::Datum::createStringRef(value.data(),
+                                                       value.length(),
+                                                       allocator);
+
+    // <time>
+    for (auto _ : state) {
+        ++reader.d_generation;
+        for (int i = 0; i < k_NUM_SUBSCRIPTIONS; ++i) {
+            benchmark::DoNotOptimize(
+                evaluators[i]->evaluate(evaluationContext));
+        }
+    }
+    // </time>
+
+    state.SetItemsProcessed(state.iterations() * k_NUM_SUBSCRIPTIONS);
+}
 #else
 static void testN1_SimpleEvaluator()
 {
     bmqtst::TestHelper::printTestName("GOOGLE BENCHMARK: SimpleEvaluator");
     PV("GoogleBenchmark is not supported on this platform, skipping...")
 }
+
+static void testN2_SimpleEvaluatorPerMessage()
+{
+    bmqtst::TestHelper::printTestName(
+        "GOOGLE BENCHMARK: SimpleEvaluator per message");
+    PV("GoogleBenchmark is not supported on this platform, skipping...")
+}
+
+static void testN3_SimpleEvaluatorStringEquality()
+{
+    bmqtst::TestHelper::printTestName(
+        "GOOGLE BENCHMARK: SimpleEvaluator string equality");
+    PV("GoogleBenchmark is not supported on this platform, skipping...")
+}
 #endif
 
 // ============================================================================
@@ -599,6 +785,527 @@ static void test3_evaluation()
     }
 }
 
+static void test4_evaluationErrors()
+{
+    // Literal operands are folded or carried by the comparison instruction
+    // when compiling; check that this reports the same results and errors as
+    // evaluating the expression tree.
+
+    MockPropertiesReader reader(bmqtst::TestHelperUtil::allocator());
+    reader.d_map["i_minus1"] = bdld::Datum::createInteger(-1);
+    reader.d_map["e_binary"] = bdld::Datum::createError(ErrorType::e_BINARY);
+    reader.d_map["e_other"]  = bdld::Datum::createError(-42);
+    reader.d_map["d_1"]      = bdld::Datum::createDouble(1.0);
+    reader.d_map["i_min"]    = bdld::Datum::createInteger64(
+        bsl::numeric_limits<bsls::Types::Int64>::min(),
+        bmqtst::TestHelperUtil::allocator());
+
+    EvaluationContext evaluationContext(&reader,
+                                        bmqtst::TestHelperUtil::allocator());
+
+    struct TestParameters {
+        const char*     expression;
+        bool            expected;
+        ErrorType::Enum error;
+    } testParameters[] = {
+        // folded literals
+        {"i_3 == 1 + 2", true, ErrorType::e_OK},
+        {"1 + 2 == i_3", true, ErrorType::e_OK},
+        {"i_42 == 2 * (20 + 1)", true, ErrorType::e_OK},
+        {"i_2 == 5 / 2", true, ErrorType::e_OK},
+        {"i_1 == 7 % 3", true, ErrorType::e_OK},
+        {"i_minus1 == -(3 - 2)", true, ErrorType::e_OK},
+        {"(1 < 2) && b_true", true, ErrorType::e_OK},
+        {"(\"a\" > \"b\") || b_false", false, ErrorType::e_OK},
+        {"!true || b_true", true, ErrorType::e_OK},
+
+        // literals on the left with an operator in the right operand
+        {"42 == i_2 * 21", true, ErrorType::e_OK},
+        {"41 < i_42 + 0", true, ErrorType::e_OK},
+        {"1 < (b_true || b_false)", false, ErrorType::e_TYPE},
+        {"\"foo\" == s_foo", true, ErrorType::e_OK},
+
+        // type errors are not folded away
+        {"b_true && 1 == \"one\"", false, ErrorType::e_TYPE},
+        {"b_true && -true", false, ErrorType::e_TYPE},
+        {"b_true && !1", false, ErrorType::e_TYPE},
+        {"s_foo == 42", false, ErrorType::e_TYPE},
+        {"42 == s_foo", false, ErrorType::e_TYPE},
+        {"i_42 == \"foo\"", false, ErrorType::e_TYPE},
+        {"i_42 == s_foo", false, ErrorType::e_TYPE},
+        {"s_foo + 1 == 2", false, ErrorType::e_TYPE},
+        {"-s_foo == 1", false, ErrorType::e_TYPE},
+        {"!i_1", false, ErrorType::e_TYPE},
+        {"i_1", false, ErrorType::e_TYPE},
+        {"i_1 || b_true", false, ErrorType::e_TYPE},
+        {"b_false || i_1", false, ErrorType::e_TYPE},
+        {"b_true && i_1", false, ErrorType::e_TYPE},
+        {"d_1 == 1", false, ErrorType::e_TYPE},
+
+        // divisions which are undefined fail rather than trap
+        {"i_42 / i_0 == 1", false, ErrorType::e_ARITHMETIC},
+        {"i_42 % i_0 == 1", false, ErrorType::e_ARITHMETIC},
+        {"i_1 == 1 / 0", false, ErrorType::e_ARITHMETIC},
+        {"i_min / i_minus1 == 1", false, ErrorType::e_ARITHMETIC},
+        {"i_min % -1 == 0", false, ErrorType::e_ARITHMETIC},
+        {"b_true || i_1 / i_0 == 1", true, ErrorType::e_OK},
+
+        // short-circuited operands are neither evaluated nor checked
+        {"b_true || i_1", true, ErrorType::e_OK},
+        {"b_false && i_1", false, ErrorType::e_OK},
+        {"b_true || non_existing_property", true, ErrorType::e_OK},
+        {"(b_false && i_1) || b_true", true, ErrorType::e_OK},
+
+        // errors returned by the properties reader
+        {"non_existing_property == 1", false, ErrorType::e_NAME},
+        {"b_true && e_binary == 1", false, ErrorType::e_BINARY},
+        {"e_other == 1", false, ErrorType::e_UNDEFINED},
+        {"exists(e_binary) || b_true", true, ErrorType::e_OK},
+    };
+    const TestParameters* testParametersEnd = testParameters +
+                                              sizeof(testParameters) /
+                                                  sizeof(*testParameters);
+
+    for (const TestParameters* parameters = testParameters;
+         parameters < testParametersEnd;
+         ++parameters) {
+        PV(bsl::string("TESTING ") + parameters->expression);
+
+        CompilationContext compilationContext(
+            bmqtst::TestHelperUtil::allocator());
+        SimpleEvaluator evaluator;
+
+        BMQTST_ASSERT_EQ_D(parameters->expression,
+                           evaluator.compile(parameters->expression,
+                                             compilationContext),
+                           0);
+        BMQTST_ASSERT_EQ_D(parameters->expression,
+                           evaluator.evaluate(evaluationContext),
+                           parameters->expected);
+        BMQTST_ASSERT_EQ_D(parameters->expression,
+                           evaluationContext.lastError(),
+                           parameters->error);
+
+        // The same evaluator can be evaluated repeatedly.
+        BMQTST_ASSERT_EQ_D(parameters->expression,
+                           evaluator.evaluate(evaluationContext),
+                           parameters->expected);
+    }
+}
+
+static void test5_guard()
+{
+    typedef SimpleEvaluator::Guard Guard;
+
+    struct TestParameters {
+        const char*     expression;
+        const char*     property;
+        Guard::Operator op;
+        bool            isString;
+        int             integer;
+        const char*     string;
+        bool            isExact;
+    } testParameters[] = {
+        {"i_42 == 42", "i_42", Guard::e_EQ, false, 42, "", true},
+        {"i_42 != 42", "i_42", Guard::e_NE, false, 42, "", true},
+        {"s_foo < \"bar\"", "s_foo", Guard::e_LT, true, 0, "bar", true},
+        {"3 < i_42", "i_42", Guard::e_GT, false, 3, "", true},
+        {"3 >= i_42", "i_42", Guard::e_LE, false, 3, "", true},
+        {"i_42 == 40 + 2", "i_42", Guard::e_EQ, false, 42, "", true},
+        {"region == \"X\" && tier > 3",
+         "region",
+         Guard::e_EQ,
+         true,
+         0,
+         "X",
+         false},
+        {"region == \"X\" && tier > 3 && b_true",
+         "region",
+         Guard::e_EQ,
+         true,
+         0,
+         "X",
+         false},
+        {"region == \"X\" && (tier > 3 && b_true)",
+         "region",
+         Guard::e_EQ,
+         true,
+         0,
+         "X",
+         false},
+    };
+    const TestParameters* testParametersEnd = testParameters +
+                                              sizeof(testParameters) /
+                                                  sizeof(*testParameters);
+
+    for (const TestParameters* parameters = testParameters;
+         parameters < testParametersEnd;
+         ++parameters) {
+        PV(bsl::string("TESTING ") + parameters->expression);
+
+        CompilationContext compilationContext(
+            bmqtst::TestHelperUtil::allocator());
+        SimpleEvaluator evaluator;
+        Guard           guard;
+
+        BMQTST_ASSERT(!evaluator.loadGuard(&guard));
+
+        BMQTST_ASSERT_EQ_D(parameters->expression,
+                           evaluator.compile(parameters->expression,
+                                             compilationContext),
+                           0);
+        BMQTST_ASSERT_D(parameters->expression, evaluator.loadGuard(&guard));
+
+        BMQTST_ASSERT_EQ_D(parameters->expression,
+                           guard.d_property,
+                           parameters->property);
+        BMQTST_ASSERT_EQ_D(parameters->expression,
+                           guard.d_operator,
+                           parameters->op);
+        BMQTST_ASSERT_EQ_D(parameters->expression,
+                           guard.d_isString,
+                           parameters->isString);
+        if (parameters->isString) {
+            BMQTST_ASSERT_EQ_D(parameters->expression,
+                               guard.d_string,
+                               parameters->string);
+        }
+        else {
+            BMQTST_ASSERT_EQ_D(parameters->expression,
+                               guard.d_integer,
+                               parameters->integer);
+        }
+        BMQTST_ASSERT_EQ_D(parameters->expression,
+                           guard.d_isExact,
+                           parameters->isExact);
+    }
+
+    const char* noGuardExpressions[] = {
+        // the first comparison is not required to hold
+        "region == \"X\" || tier > 3",
+        "region == \"X\" && tier > 3 || b_true",
+        "!(region == \"X\") && tier > 3",
+
+        // no comparison with a literal first
+        "b_true",
+        "b_true && region == \"X\"",
+        "i_1 == i_2",
+        "i_1 + 1 == 2",
+        "exists(region) && region == \"X\"",
+    };
+    const size_t numNoGuardExpressions = sizeof(noGuardExpressions) /
+                                         sizeof(*noGuardExpressions);
+
+    for (size_t i = 0; i < numNoGuardExpressions; ++i) {
+        PV(bsl::string("TESTING ") + noGuardExpressions[i]);
+
+        CompilationContext compilationContext(
+            bmqtst::TestHelperUtil::allocator());
+        SimpleEvaluator evaluator;
+        Guard           guard;
+
+        BMQTST_ASSERT_EQ_D(noGuardExpressions[i],
+                           evaluator.compile(noGuardExpressions[i],
+                                             compilationContext),
+                           0);
+        BMQTST_ASSERT_D(noGuardExpressions[i], !evaluator.loadGuard(&guard));
+    }
+}
+
+static void test6_propertySlots()
+{
+    // Properties get stable slots across all the expressions compiled by the
+    // same 'CompilationContext', and programs read them by slot.  The slot
+    // of a property no longer loaded by any program is reused.
+
+    SlotPropertiesReader reader(bmqtst::TestHelperUtil::allocator());
+    CompilationContext   compilationContext(
+        bmqtst::TestHelperUtil::allocator());
+    EvaluationContext evaluationContext(&reader,
+                                        bmqtst::TestHelperUtil::allocator());
+
+    const char* expressions[] = {
+        "i_1 == 1 && s_foo == \"foo\"",
+        "i_42 > 2 && s_foo == \"foo\"",
+        "exists(i_2) && i_1 < 2",
+        "b_true",
+    };
+
+    const size_t k_NUM_EXPRESSIONS = sizeof(expressions) /
+                                     sizeof(*expressions);
+
+    SimpleEvaluator evaluators[k_NUM_EXPRESSIONS];
+
+    for (size_t i = 0; i < k_NUM_EXPRESSIONS; ++i) {
+        BMQTST_ASSERT_EQ_D(expressions[i],
+                           evaluators[i].compile(expressions[i],
+                                                 compilationContext),
+                           0);
+        BMQTST_ASSERT_D(expressions[i],
+                        evaluators[i].evaluate(evaluationContext));
+    }
+
+    BMQTST_ASSERT_EQ(compilationContext.numPropertySlots(), 5);
+    BMQTST_ASSERT_EQ(reader.d_slots.size(), 5u);
+
+    BMQTST_ASSERT_EQ(reader.d_slots["i_1"], 0);
+    BMQTST_ASSERT_EQ(reader.d_slots["s_foo"], 1);
+    BMQTST_ASSERT_EQ(reader.d_slots["i_42"], 2);
+    BMQTST_ASSERT_EQ(reader.d_slots["i_2"], 3);
+    BMQTST_ASSERT_EQ(reader.d_slots["b_true"], 4);
+
+    BMQTST_ASSERT_EQ(compilationContext.propertySlot("s_foo"), 1);
+    BMQTST_ASSERT_EQ(compilationContext.propertySlot("new"), 5);
+    compilationContext.releasePropertySlot("s_foo");
+    compilationContext.releasePropertySlot("new");
+
+    // 'i_42' is only loaded by the second expression.
+    evaluators[1] = SimpleEvaluator();
+    BMQTST_ASSERT_EQ(compilationContext.numPropertySlots(), 6);
+
+    reader.d_slots.clear();
+    BMQTST_ASSERT_EQ(evaluators[1].compile("i_3 == 3 && s_foo == \"foo\"",
+                                           compilationContext),
+                     0);
+    BMQTST_ASSERT(evaluators[1].evaluate(evaluationContext));
+    BMQTST_ASSERT_EQ(compilationContext.numPropertySlots(), 6);
+    BMQTST_ASSERT_EQ(reader.d_slots["s_foo"], 1);
+    BMQTST_ASSERT_EQ(reader.d_slots["i_3"], 2);
+
+    // Slots are not assigned past the number of properties loaded at once.
+    for (int i = 0; i < 100; ++i) {
+        bmqu::MemOutStream expression(bmqtst::TestHelperUtil::allocator());
+        expression << "i_" << i << " > 0";
+
+        SimpleEvaluator evaluator;
+        BMQTST_ASSERT_EQ_D(i,
+                           evaluator.compile(expression.str(),
+                                             compilationContext),
+                           0);
+    }
+    BMQTST_ASSERT_EQ(compilationContext.numPropertySlots(), 6);
+}
+
+static void test7_batchEvaluation()
+{
+    // Evaluating a batch of messages yields, for each message, the same
+    // result as evaluating the message alone, including when properties are
+    // missing, have the wrong type, or when 'And' and 'Or' short-circuit
+    // differently across messages.
+
+    const int k_NUM_MESSAGES = EvaluationBatch::k_MAX_SIZE - 3;
+
+    bsl::vector<bsl::shared_ptr<MockPropertiesReader> > readers(
+        bmqtst::TestHelperUtil::allocator());
+
+    for (int i = 0; i < k_NUM_MESSAGES; ++i) {
+        bsl::shared_ptr<MockPropertiesReader> reader;
+        reader.createInplace(bmqtst::TestHelperUtil::allocator(),
+                             bmqtst::TestHelperUtil::allocator());
+
+        reader->d_map["i_x"] = bdld::Datum::createInteger(i % 7 - 3);
+        reader->d_map["b_x"] = bdld::Datum::createBoolean(i % 3 == 0);
+        reader->d_map["s_x"] = bdld::Datum::createStringRef(
+            i % 2 ? "foo" : "a string value which is longer than 16 bytes",
+            bmqtst::TestHelperUtil::allocator());
+        if (i % 5 == 0) {
+            reader->d_map.erase("i_x");
+        }
+        if (i % 11 == 0) {
+            reader->d_map["s_x"] = bdld::Datum::createInteger(i);
+        }
+        readers.push_back(reader);
+    }
+
+    const char* expressions[] = {
+        "i_x > 0",
+        "i_x == 1 || b_x",
+        "b_x && i_x < 0",
+        "!b_x && s_x == \"foo\"",
+        "s_x < \"b\" || i_x % 2 == 1",
+        "exists(i_x) && i_x * 2 - 1 >= i_1",
+        "b_x || i_x / 2 == 1",
+        "b_x || 6 / i_x == 2",
+        "i_3 % i_x == 0",
+        "(i_x > 0 && s_x == \"foo\") || (b_x && !exists(i_x))",
+        "-i_x > i_3 - 5 || s_x != s_foo",
+        "i_x",
+        "b_true",
+        "i_0 > 0",
+    };
+
+    CompilationContext compilationContext(
+        bmqtst::TestHelperUtil::allocator());
+    EvaluationBatch    batch(bmqtst::TestHelperUtil::allocator());
+
+    bsl::vector<bsl::shared_ptr<SimpleEvaluator> > evaluators(
+        bmqtst::TestHelperUtil::allocator());
+
+    for (size_t i = 0; i < sizeof(expressions) / sizeof(*expressions); ++i) {
+        bsl::shared_ptr<SimpleEvaluator> evaluator;
+        evaluator.createInplace(bmqtst::TestHelperUtil::allocator());
+
+        BMQTST_ASSERT_EQ_D(expressions[i],
+                           evaluator->compile(expressions[i],
+                                              compilationContext),
+                           0);
+        evaluators.push_back(evaluator);
+    }
+
+    // Load the batch once all the expressions are compiled, so that all
+    // the properties have a slot.
+
+    for (int i = 0; i < k_NUM_MESSAGES; ++i) {
+        BMQTST_ASSERT_EQ(batch.add(), i);
+        batch.load(i, *readers[i], compilationContext);
+    }
+    BMQTST_ASSERT_EQ(batch.size(), k_NUM_MESSAGES);
+
+    for (size_t i = 0; i < evaluators.size(); ++i) {
+        EvaluationBatch::Mask result = ~static_cast<EvaluationBatch::Mask>(0);
+
+        BMQTST_ASSERT_EQ_D(expressions[i],
+                           evaluators[i]->evaluate(&result, batch),
+                           0);
+
+        for (int j = 0; j < k_NUM_MESSAGES; ++j) {
+            EvaluationContext evaluationContext(
+                readers[j].get(),
+                bmqtst::TestHelperUtil::allocator());
+
+            const bool expected = evaluators[i]->evaluate(evaluationContext);
+
+            BMQTST_ASSERT_EQ_D(expressions[i] << ", message " << j,
+                               static_cast<bool>((result >> j) & 1),
+                               expected);
+        }
+
+        // Messages past the size of the batch never match.
+        BMQTST_ASSERT_EQ_D(expressions[i], result >> k_NUM_MESSAGES, 0u);
+    }
+
+    // An empty batch matches nothing.
+    batch.reset();
+    BMQTST_ASSERT_EQ(batch.size(), 0);
+
+    EvaluationBatch::Mask result = 1;
+    BMQTST_ASSERT_EQ(evaluators[0]->evaluate(&result, batch), 0);
+    BMQTST_ASSERT_EQ(result, 0u);
+}
+
+static void test8_internedStrings()
+{
+    // String literals are interned by the 'CompilationContext', and
+    // equality with a string property compares interned copies, looked up
+    // once per message when the reader tells messages apart.
+
+    {
+        PV("InternedStrings");
+
+        InternedStrings strings(bmqtst::TestHelperUtil::allocator());
+
+        const bsl::string* foo = strings.intern("foo");
+        BMQTST_ASSERT(foo);
+        BMQTST_ASSERT_EQ(*foo, "foo");
+        BMQTST_ASSERT_EQ(strings.intern(bsl::string("foo")), foo);
+        BMQTST_ASSERT_EQ(strings.find("foo"), foo);
+        BMQTST_ASSERT_EQ(strings.find("bar"), static_cast<bsl::string*>(0));
+
+        const bsl::string* bar = strings.intern("bar");
+        BMQTST_ASSERT_NE(bar, foo);
+        BMQTST_ASSERT_EQ(strings.find("foo"), foo);
+        BMQTST_ASSERT_EQ(strings.size(), 2u);
+
+        // "foo" is interned twice.
+        const bsls::Types::Uint64 version = strings.version();
+        strings.release(foo);
+        BMQTST_ASSERT_EQ(strings.find("foo"), foo);
+        BMQTST_ASSERT_EQ(strings.version(), version);
+
+        strings.release(foo);
+        BMQTST_ASSERT_EQ(strings.find("foo"), static_cast<bsl::string*>(0));
+        BMQTST_ASSERT_EQ(strings.find("bar"), bar);
+        BMQTST_ASSERT_EQ(strings.size(), 1u);
+        BMQTST_ASSERT_NE(strings.version(), version);
+
+        strings.release(bar);
+        BMQTST_ASSERT_EQ(strings.size(), 0u);
+    }
+
+    PV("Evaluation");
+
+    GenerationPropertiesReader reader(bmqtst::TestHelperUtil::allocator());
+    CompilationContext         compilationContext(
+        bmqtst::TestHelperUtil::allocator());
+    EvaluationContext evaluationContext(&reader,
+                                        bmqtst::TestHelperUtil::allocator());
+
+    SimpleEvaluator isFoo;
+    SimpleEvaluator isNotBar;
+    SimpleEvaluator isLess;
+
+    BMQTST_ASSERT_EQ(isFoo.compile("s_x == \"foo\"", compilationContext), 0);
+    BMQTST_ASSERT_EQ(isNotBar.compile("s_x != \"bar\"", compilationContext),
+                     0);
+    BMQTST_ASSERT_EQ(isLess.compile("s_x < \"foo\"", compilationContext), 0);
+
+    BMQTST_ASSERT(compilationContext.internedStrings().find("foo"));
+    BMQTST_ASSERT(compilationContext.internedStrings().find("bar"));
+
+    const char* values[] = {"foo", "bar", "baz", "", "fo"};
+
+    for (size_t i = 0; i < sizeof(values) / sizeof(*values); ++i) {
+        const bsl::string value(values[i],
+                                bmqtst::TestHelperUtil::allocator());
+
+        ++reader.d_generation;
+        reader.d_map["s_x"] = bdld::Datum::createStringRef(
+            values[i],
+            bmqtst::TestHelperUtil::allocator());
+
+        for (int j = 0; j < 2; ++j) {
+            // Once looked up, then cached.
+            BMQTST_ASSERT_EQ_D(value,
+                               isFoo.evaluate(evaluationContext),
+                               value == "foo");
+            BMQTST_ASSERT_EQ_D(value,
+                               isNotBar.evaluate(evaluationContext),
+                               value != "bar");
+            BMQTST_ASSERT_EQ_D(value,
+                               isLess.evaluate(evaluationContext),
+                               value < "foo");
+        }
+    }
+
+    // A literal interned while the message is the same.
+    ++reader.d_generation;
+    reader.d_map["s_x"] = bdld::Datum::createStringRef(
+        "qux",
+        bmqtst::TestHelperUtil::allocator());
+    BMQTST_ASSERT(!isFoo.evaluate(evaluationContext));
+
+    SimpleEvaluator isQux;
+    BMQTST_ASSERT_EQ(isQux.compile("s_x == \"qux\"", compilationContext), 0);
+    BMQTST_ASSERT(isQux.evaluate(evaluationContext));
+
+    // A literal released, and interned again, while the message is the
+    // same.
+    isQux = SimpleEvaluator();
+    BMQTST_ASSERT(!compilationContext.internedStrings().find("qux"));
+
+    BMQTST_ASSERT_EQ(isQux.compile("s_x == \"qux\"", compilationContext), 0);
+    BMQTST_ASSERT(isQux.evaluate(evaluationContext));
+
+    // A reader which does not tell messages apart.
+    MockPropertiesReader mockReader(bmqtst::TestHelperUtil::allocator());
+    evaluationContext.setPropertiesReader(&mockReader);
+
+    BMQTST_ASSERT_EQ(isFoo.compile("s_foo == \"foo\"", compilationContext),
+                     0);
+    BMQTST_ASSERT(isFoo.evaluate(evaluationContext));
+    BMQTST_ASSERT(!isQux.evaluate(evaluationContext));
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -609,10 +1316,27 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 8: test8_internedStrings(); break;
+    case 7: test7_batchEvaluation(); break;
+    case 6: test6_propertySlots(); break;
+    case 5: test5_guard(); break;
+    case 4: test4_evaluationErrors(); break;
     case 3: test3_evaluation(); break;
     case 2: test2_propertyNames(); break;
     case 1: test1_compilationErrors(); break;
     case -1: BMQTST_BENCHMARK(testN1_SimpleEvaluator); break;
+    case -2:
+        BMQTST_BENCHMARK_WITH_ARGS(
+            testN2_SimpleEvaluatorPerMessage,
+            DenseRange(0,
+                       sizeof(k_BENCHMARK_EXPRESSIONS) /
+                               sizeof(*k_BENCHMARK_EXPRESSIONS) -
+                           1));
+        break;
+    case -3:
+        BMQTST_BENCHMARK_WITH_ARGS(testN3_SimpleEvaluatorStringEquality,
+                                   RangeMultiplier(2)->Range(32, 128));
+        break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         bmqtst::TestHelperUtil::testStatus() = -1;
@@ -22,6 +22,7 @@
 #include <bmqimp_queue.h>
 #include <bmqp_ackeventbuilder.h>
 #include <bmqp_ackmessageiterator.h>
+#include <bmqp_compressiondictionary.h>
 #include <bmqp_confirmeventbuilder.h>
 #include <bmqp_confirmmessageiterator.h>
 #include <bmqp_controlmessageutil.h>
@@ -41,10 +42,12 @@
 #include <bmqsys_threadutil.h>
 #include <bmqsys_time.h>
 #include <bmqu_blob.h>
+#include <bmqu_blobobjectproxy.h>
 #include <bmqu_memoutstream.h>
 #include <bmqu_printutil.h>
 
 // BDE
+#include <bdlbb_blobutil.h>
 #include <bdld_datum.h>
 #include <bdlf_bind.h>
 #include <bdlf_placeholder.h>
@@ -520,6 +523,10 @@ void BrokerSession::SessionFsm::setStopped(FsmEvent::Enum event,
     d_session.d_scheduler_p->cancelEvent(
         &d_session.d_messageExpirationTimeoutHandle);
 
+    // Cancel PUT batch timer
+    d_session.d_scheduler_p->cancelEvent(&d_session.d_putBatchTimeoutHandle);
+    d_session.d_isPutBatchTimerScheduled = false;
+
     // The session is fully stopped, we can now reset its state to release any
     // references to objects (queues, ...) it may still hold.
     d_session.resetState();
@@ -1234,6 +1241,26 @@ void BrokerSession::QueueFsm::actionInitQueue(
             resp.deduplicationTimeMs();
     }
 
+    // Register the compression dictionary advertised by the broker, if any,
+    // whatever the mode of the queue: readers need it to decompress messages
+    // compressed with it by any producer of the domain, and writers to
+    // compress their messages with it.
+    const bmqp::CompressionDictionary* dictionary = 0;
+    if (!resp.compressionDictionary().isNull()) {
+        const bsl::vector<char>& data = resp.compressionDictionary().value();
+        bmqu::MemOutStream       errorStream;
+        dictionary = bmqp::CompressionDictionaryRegistry::defaultRegistry()
+                         .registerDictionary(data.data(),
+                                             data.size(),
+                                             &errorStream);
+        if (!dictionary) {
+            BALL_LOG_ERROR << id() << "Ignoring compression dictionary for "
+                           << "queue " << queue->uri() << ": "
+                           << errorStream.str();
+        }
+    }
+    queue->setCompressionDictionary(dictionary);
+
     // Do not register queue stats if stats are disabled or queue is reopening
     if (!isReopenRequest && d_session.d_queuesStats.d_statContext_mp) {
         queue->registerStatContext(
@@ -3386,9 +3413,16 @@ void BrokerSession::processPutEvent(const bmqp::Event& event)
 
     BSLS_ASSERT_SAFE(d_fsmThreadChecker.inSameThread());
 
-    bool readyToSend = isStarted() && (d_numPendingReopenQueues == 0);
+    bool       readyToSend = isStarted() && (d_numPendingReopenQueues == 0);
+    const bool isBatched   = d_sessionOptions.putBatchingMaxDelay() > 0 &&
+                           readyToSend;
 
-    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(readyToSend)) {
+    if (isBatched) {
+        // The messages are written to the channel with the batch, which takes
+        // care of their retransmission if writing the batch fails.
+        batchPutEvent(event);
+    }
+    else if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(readyToSend)) {
         // Post the event.
         bmqt::GenericResult::Enum res = writeOrBuffer(
             *event.blob(),
@@ -3416,7 +3450,10 @@ void BrokerSession::processPutEvent(const bmqp::Event& event)
 
     BSLS_ASSERT_SAFE(putIter.isValid());
 
+    int numMessages = 0;
     while (BSLS_PERFORMANCEHINT_PREDICT_LIKELY((putIter.next()) == 1)) {
+        ++numMessages;
+
         const bool ackRequested = bmqp::PutHeaderFlagUtil::isSet(
             putIter.header().flags(),
             bmqp::PutHeaderFlags::e_ACK_REQUESTED);
@@ -3437,6 +3474,137 @@ void BrokerSession::processPutEvent(const bmqp::Event& event)
         // down.
         enableMessageRetransmission(putIter, sentTime);
     }
+
+    if (isBatched) {
+        // The messages are counted above, so that the event is iterated only
+        // once.
+        onPutEventBatched(numMessages);
+    }
+}
+
+void BrokerSession::batchPutEvent(const bmqp::Event& event)
+{
+    // executed by the FSM thread
+
+    BSLS_ASSERT_SAFE(d_fsmThreadChecker.inSameThread());
+    BSLS_ASSERT_SAFE(d_sessionOptions.putBatchingMaxDelay() > 0);
+
+    const bdlbb::Blob& eventBlob = *event.blob();
+
+    // Read the header of the event, so that only its messages are batched.
+    bmqu::BlobObjectProxy<bmqp::EventHeader> eventHeader(
+        &eventBlob,
+        -bmqp::EventHeader::k_MIN_HEADER_SIZE,
+        true,    // read
+        false);  // write
+    BSLS_ASSERT_SAFE(eventHeader.isSet());
+
+    const int headerLength   = eventHeader->headerWords() *
+                             bmqp::Protocol::k_WORD_SIZE;
+    const int messagesLength = eventBlob.length() - headerLength;
+
+    // Do not let the batch grow past the configured size, nor past the
+    // maximum size of an event.
+    const int maxBytes = bsl::min(d_sessionOptions.putBatchingMaxBytes(),
+                                  bmqp::EventHeader::k_MAX_SIZE_SOFT);
+
+    if (d_putBatch_sp && d_putBatch_sp->length() + messagesLength > maxBytes) {
+        flushPutBatch();
+    }
+
+    if (!d_putBatch_sp) {
+        // Start a new batch.  Note that, similarly to 'PutEventBuilder', the
+        // first buffer of a blob from the pool can hold the entire header.
+        d_putBatch_sp = d_blobSpPool_p->getObject();
+        d_putBatch_sp->setLength(sizeof(bmqp::EventHeader));
+        new (d_putBatch_sp->buffer(0).data())
+            bmqp::EventHeader(bmqp::EventType::e_PUT);
+
+        if (!d_isPutBatchTimerScheduled) {
+            // A timer scheduled for a previous batch fires before the
+            // deadline of this one, so it is enough to bound its latency.
+            d_scheduler_p->scheduleEvent(
+                &d_putBatchTimeoutHandle,
+                bmqsys::Time::nowMonotonicClock() +
+                    d_sessionOptions.putBatchingMaxDelay(),
+                bdlf::BindUtil::bind(&BrokerSession::onPutBatchTimeout,
+                                     this));
+            d_isPutBatchTimerScheduled = true;
+        }
+    }
+
+    // Append the messages, sharing the buffers of the posted event.
+    bdlbb::BlobUtil::append(d_putBatch_sp.get(), eventBlob, headerLength);
+}
+
+void BrokerSession::onPutEventBatched(int numMessages)
+{
+    // executed by the FSM thread
+
+    BSLS_ASSERT_SAFE(d_fsmThreadChecker.inSameThread());
+    BSLS_ASSERT_SAFE(d_putBatch_sp);
+
+    d_putBatchMessageCount += numMessages;
+
+    const int maxBytes = bsl::min(d_sessionOptions.putBatchingMaxBytes(),
+                                  bmqp::EventHeader::k_MAX_SIZE_SOFT);
+
+    if (d_putBatchMessageCount >= d_sessionOptions.putBatchingMaxMessages() ||
+        d_putBatch_sp->length() >= maxBytes) {
+        flushPutBatch();
+    }
+}
+
+void BrokerSession::flushPutBatch(bool isChannelDown)
+{
+    // executed by the FSM thread
+
+    BSLS_ASSERT_SAFE(d_fsmThreadChecker.inSameThread());
+
+    if (!d_putBatch_sp) {
+        return;  // RETURN
+    }
+
+    // Take the batch first, so that 'writeOrBuffer' does not flush it again.
+    bsl::shared_ptr<bdlbb::Blob> batch_sp;
+    batch_sp.swap(d_putBatch_sp);
+    d_putBatchMessageCount = 0;
+
+    bmqp::EventHeader& eh = *reinterpret_cast<bmqp::EventHeader*>(
+        batch_sp->buffer(0).data());
+    eh.setLength(batch_sp->length());
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(!isChannelDown && d_channel_sp)) {
+        bmqt::GenericResult::Enum res = writeOrBuffer(
+            *batch_sp,
+            d_sessionOptions.channelHighWatermark());
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                res == bmqt::GenericResult::e_SUCCESS)) {
+            return;  // RETURN
+        }
+
+        BALL_LOG_ERROR << id() << "Unable to write batch of PUT messages "
+                       << "[reason: 'NOT_CONNECTED']";
+    }
+
+    BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+    // Messages with the ACK_REQUESTED flag were retained for retransmission
+    // when batched; retain the others now so that they are sent once the
+    // session is reconnected, as in 'processPutEvent'.
+    const bsls::TimeInterval sentTime = bmqsys::Time::nowMonotonicClock();
+    bmqp::Event              event(batch_sp.get(), d_allocator_p);
+    bmqp::PutMessageIterator putIter(d_bufferFactory_p, d_allocator_p);
+    event.loadPutMessageIterator(&putIter);
+
+    while (putIter.next() == 1) {
+        if (!bmqp::PutHeaderFlagUtil::isSet(
+                putIter.header().flags(),
+                bmqp::PutHeaderFlags::e_ACK_REQUESTED)) {
+            enableMessageRetransmission(putIter, sentTime);
+        }
+    }
 }
 
 void BrokerSession::processConfirmEvent(const bmqp::Event& event)
@@ -4171,6 +4339,18 @@ void BrokerSession::doHandlePendingPutExpirationTimeout(
     }
 }
 
+void BrokerSession::doHandlePutBatchTimeout(
+    BSLA_UNUSED const bsl::shared_ptr<Event>& eventSp)
+{
+    // executed by the FSM thread
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_fsmThreadChecker.inSameThread());
+
+    d_isPutBatchTimerScheduled = false;
+
+    flushPutBatch();
+}
+
 void BrokerSession::doHandleChannelWatermark(
     bmqio::ChannelWatermarkType::Enum type,
     BSLA_UNUSED const bsl::shared_ptr<Event>& eventSp)
@@ -5071,6 +5251,10 @@ void BrokerSession::doSetChannel(
         BALL_LOG_INFO << id()
                       << "Channel is RESET, state: " << d_sessionFsm.state();
 
+        // The batched PUT messages, if any, can no longer be written: retain
+        // them for retransmission before the channel down is processed.
+        flushPutBatch(true);
+
         // Cancel pending requests before notifying the queues about channel
         // down.  This is needed to move all in-progress queues into EXPIRED
         // state and then close them, see 'QueueFsm::handleChannelDown'.  The
@@ -5112,6 +5296,8 @@ void BrokerSession::resetState()
     d_queueManager.resetState();
     d_numPendingReopenQueues = 0;
     d_messageDumper.reset();
+    d_putBatch_sp.reset();
+    d_putBatchMessageCount = 0;
 
     // Setting state back to e_HEALTHY ensures that if the session is reopened,
     // newly opened queues do not initiate into suspended state.
@@ -5543,6 +5729,14 @@ BrokerSession::writeOrBuffer(const bdlbb::Blob& eventBlob,
     BSLS_ASSERT_SAFE(d_fsmThreadChecker.inSameThread());
     BSLS_ASSERT_SAFE(d_channel_sp);
 
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_putBatch_sp)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        // Write the batched PUT messages first, so that they are not
+        // reordered with respect to this blob.
+        flushPutBatch();
+    }
+
     bmqio::Status             status(d_allocator_p);
     bmqt::GenericResult::Enum res = bmqt::GenericResult::e_SUCCESS;
 
@@ -5656,6 +5850,10 @@ BrokerSession::BrokerSession(
 , d_inProgressEventHandlerCount(0)
 , d_isStopping(false)
 , d_messageExpirationTimeoutHandle()
+, d_putBatch_sp()
+, d_putBatchMessageCount(0)
+, d_putBatchTimeoutHandle()
+, d_isPutBatchTimerScheduled(false)
 , d_nextRequestGroupId(k_NON_BUFFERED_REQUEST_GROUP_ID)
 , d_queueRetransmissionTimeoutMap(allocator)
 , d_nextInternalSubscriptionId(bmqp::Protocol::k_DEFAULT_SUBSCRIPTION_ID)
@@ -6537,32 +6735,10 @@ BrokerSession::nextEvent(const bsls::TimeInterval& timeout)
     const bsls::TimeInterval beginTime = bmqsys::Time::nowMonotonicClock();
     bsl::shared_ptr<Event>   event     = d_eventQueue.timedPopFront(timeout);
 
-    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
-            event->type() == Event::EventType::e_SESSION &&
-            event->sessionEventType() ==
-                bmqt::SessionEventType::e_DISCONNECTED)) {
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!afterNextEvent(event))) {
         BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-        // By contract with the user, the 'DISCONNECTED' event is the event
-        // that their event loop should use to exit.  We have no control over
-        // how many threads the user have which are calling 'nextEvent',
-        // therefore we automatically immediately re-enqueue a DISCONNECTED
-        // event once we popped one out.
-        bsl::shared_ptr<Event> disconnectEvent = createEvent();
-        disconnectEvent->configureAsSessionEvent(
-            bmqt::SessionEventType::e_DISCONNECTED,
-            0,
-            bmqt::CorrelationId(),
-            "");
-        // Dispatch event to the user event queue
-        d_eventQueue.pushBack(disconnectEvent);
-    }
-
-    if (event->eventCallback()) {
-        // This is a serialized SESSION event with a user-specified callback.
-        // Such events are invoked inplace for serialization, and after that we
-        // will try to pop the next event for the user if timeout has not
-        // expired.
-        event->eventCallback()(event);
+        // The event was consumed by its callback, we will try to pop the next
+        // event for the user if timeout has not expired.
 
         // Continue waiting for next event for the duration of the remaining
         // timeout (if any)
@@ -6587,6 +6763,58 @@ BrokerSession::nextEvent(const bsls::TimeInterval& timeout)
     return event;
 }
 
+void BrokerSession::nextEvents(bsl::vector<bsl::shared_ptr<Event> >* events,
+                               int                       maxNumEvents,
+                               const bsls::TimeInterval& timeout)
+{
+    // executed by one of the *APPLICATION* threads
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(!d_usingSessionEventHandler &&
+                     "nextEvents() should be used without EventHandler");
+    BSLS_ASSERT_SAFE(events);
+    BSLS_ASSERT_SAFE(maxNumEvents > 0);
+
+    const bsls::TimeInterval beginTime = bmqsys::Time::nowMonotonicClock();
+    d_eventQueue.timedPopFront(events, maxNumEvents, timeout);
+
+    // Remove, preserving the order, the events consumed by their callback.
+    size_t numEvents = 0;
+    for (size_t i = 0; i < events->size(); ++i) {
+        if (!afterNextEvent((*events)[i])) {
+            continue;  // CONTINUE
+        }
+        if (numEvents != i) {
+            (*events)[numEvents].swap((*events)[i]);
+        }
+        ++numEvents;
+    }
+    events->resize(numEvents);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(numEvents != 0)) {
+        return;  // RETURN
+    }
+
+    // All the events were consumed by their callback.  Continue waiting for
+    // next events for the duration of the remaining timeout (if any)
+    const bsls::TimeInterval now = bmqsys::Time::nowMonotonicClock();
+    const bsls::TimeInterval remainingTimeout = timeout - (now - beginTime);
+    if (remainingTimeout > bsls::TimeInterval(0, 0)) {
+        nextEvents(events, maxNumEvents, remainingTimeout);
+        return;  // RETURN
+    }
+
+    // We timed out.. create and return a timeout event
+    bsl::shared_ptr<Event> timeoutEvent = createEvent();
+    timeoutEvent->configureAsSessionEvent(
+        bmqt::SessionEventType::e_TIMEOUT,
+        -1,  // rc
+        bmqt::CorrelationId(),
+        "No events to pop from queue during"
+        "the specified timeInterval");
+    events->push_back(timeoutEvent);
+}
+
 int BrokerSession::openQueue(const bsl::shared_ptr<Queue>& queue,
                              bsls::TimeInterval            timeout)
 {
@@ -7025,6 +7253,40 @@ bool BrokerSession::acceptUserEvent(const bdlbb::Blob& eventBlob)
     return res == bmqt::GenericResult::e_SUCCESS;
 }
 
+bool BrokerSession::afterNextEvent(const bsl::shared_ptr<Event>& event)
+{
+    // executed by one of the *APPLICATION* threads
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+            event->type() == Event::EventType::e_SESSION &&
+            event->sessionEventType() ==
+                bmqt::SessionEventType::e_DISCONNECTED)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        // By contract with the user, the 'DISCONNECTED' event is the event
+        // that their event loop should use to exit.  We have no control over
+        // how many threads the user have which are calling 'nextEvent',
+        // therefore we automatically immediately re-enqueue a DISCONNECTED
+        // event once we popped one out.
+        bsl::shared_ptr<Event> disconnectEvent = createEvent();
+        disconnectEvent->configureAsSessionEvent(
+            bmqt::SessionEventType::e_DISCONNECTED,
+            0,
+            bmqt::CorrelationId(),
+            "");
+        // Dispatch event to the user event queue
+        d_eventQueue.pushBack(disconnectEvent);
+    }
+
+    if (event->eventCallback()) {
+        // This is a serialized SESSION event with a user-specified callback.
+        // Such events are invoked inplace for serialization.
+        event->eventCallback()(event);
+        return false;  // RETURN
+    }
+
+    return true;
+}
+
 void BrokerSession::setupPutExpirationTimer(const bsls::TimeInterval& timeout)
 {
     // executed by the FSM thread
@@ -7366,6 +7628,18 @@ void BrokerSession::onPendingPutExpirationTimeout()
     enqueueFsmEvent(event);
 }
 
+void BrokerSession::onPutBatchTimeout()
+{
+    // executed by the *SCHEDULER* thread
+
+    bsl::shared_ptr<Event> event = createEvent();
+    event->configureAsRequestEvent(
+        bdlf::BindUtil::bind(&BrokerSession::doHandlePutBatchTimeout,
+                             this,
+                             bdlf::PlaceHolders::_1));  // eventImpl
+    enqueueFsmEvent(event);
+}
+
 void BrokerSession::handleChannelWatermark(
     bmqio::ChannelWatermarkType::Enum type)
 {
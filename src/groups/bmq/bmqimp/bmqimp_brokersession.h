@@ -876,6 +876,24 @@ class BrokerSession BSLS_CPP11_FINAL {
     // Timer Event handle for pending PUT
     // messages' expiration timeout
 
+    bsl::shared_ptr<bdlbb::Blob> d_putBatch_sp;
+    // PUT event coalescing the PUT
+    // messages posted by the user when
+    // PUT batching is enabled, or null if
+    // no message is batched
+
+    int d_putBatchMessageCount;
+    // Number of PUT messages in
+    // 'd_putBatch_sp'
+
+    bdlmt::EventScheduler::EventHandle d_putBatchTimeoutHandle;
+    // Timer Event handle for writing the
+    // batch of PUT messages
+
+    bool d_isPutBatchTimerScheduled;
+    // Whether the PUT batch timer is
+    // scheduled and not yet handled
+
     int d_nextRequestGroupId;
     // Id of the next request group to
     // use
@@ -982,6 +1000,24 @@ class BrokerSession BSLS_CPP11_FINAL {
     /// method gets called each time a new put event is poseted by the user.
     void processPutEvent(const bmqp::Event& event);
 
+    /// Append the PUT messages of the specified `event` to the batch of PUT
+    /// messages, first writing the batch to the channel if the messages do
+    /// not fit in it, and starting a new batch and its timer if needed.
+    /// The behavior is undefined unless PUT batching is enabled.
+    void batchPutEvent(const bmqp::Event& event);
+
+    /// Account for the specified `numMessages` PUT messages appended to the
+    /// batch by `batchPutEvent`, and write the batch to the channel if it
+    /// reached the thresholds configured in the session options.  The
+    /// behavior is undefined unless a batch is in progress.
+    void onPutEventBatched(int numMessages);
+
+    /// Write the batch of PUT messages, if any, to the channel, unless the
+    /// optionally specified `isChannelDown` is `true`.  If the batch is not
+    /// written, enable the retransmission of the batched messages which
+    /// were not already retained for it.
+    void flushPutBatch(bool isChannelDown = false);
+
     /// Process the confirm event represented by the specified `event`.
     /// This method gets called each time a new confirm event is poseted by
     /// the user.
@@ -1358,6 +1394,10 @@ class BrokerSession BSLS_CPP11_FINAL {
     void
     doHandlePendingPutExpirationTimeout(const bsl::shared_ptr<Event>& eventSp);
 
+    /// Invoked from the FSM thread as a handler to the PUT batch timeout
+    /// event specified as `eventSp` and sent by the scheduler thread.
+    void doHandlePutBatchTimeout(const bsl::shared_ptr<Event>& eventSp);
+
     /// Invoked from the FSM thread as a handler to the channel watermark
     /// event specified as `eventSp` with the specified watermark `type`
     /// sent by the IO thread.
@@ -1453,15 +1493,24 @@ class BrokerSession BSLS_CPP11_FINAL {
                     bsls::Types::Int64                   highWatermark);
 
     /// Write the specified `blob` into the channel providing the specified
-    /// channel `highWaterMark` value.  If the write operation fails with
-    /// the e_LIMIT error put the `blob` into the extention buffer.  Return
-    /// success status or error code in case of write failure due to any
-    /// error other than e_LIMIT.
+    /// channel `highWaterMark` value, after the batched PUT messages if
+    /// any.  If the write operation fails with the e_LIMIT error put the
+    /// `blob` into the extention buffer.  Return success status or error
+    /// code in case of write failure due to any error other than e_LIMIT.
     bmqt::GenericResult::Enum writeOrBuffer(const bdlbb::Blob& eventBlob,
                                             bsls::Types::Int64 highWaterMark);
 
     bool acceptUserEvent(const bdlbb::Blob& eventBlob);
 
+    /// Process the specified `event` popped out from the event queue by
+    /// `nextEvent` or `nextEvents`: re-enqueue a DISCONNECTED event, and
+    /// invoke the callback of an event having one.  Return `true` if the
+    /// `event` should be delivered to the user, and `false` if it was
+    /// consumed by its callback.
+    ///
+    /// THREAD: This method is called from one of the APPLICATION threads.
+    bool afterNextEvent(const bsl::shared_ptr<Event>& event);
+
     void setupPutExpirationTimer(const bsls::TimeInterval& timeout);
 
     void
@@ -1559,6 +1608,19 @@ class BrokerSession BSLS_CPP11_FINAL {
     bsl::shared_ptr<bmqimp::Event>
     nextEvent(const bsls::TimeInterval& timeout);
 
+    /// Load into the specified `events` up to the specified `maxNumEvents`
+    /// next events.  If the event queue is empty, block until an event is
+    /// available or until the specified `timeout` (relative) expires, in
+    /// which case load a single session event of type `TIMEOUT`.  Once one
+    /// event is available, load without blocking the events readily
+    /// available after it.  Any previous content of `events` is removed.
+    /// The behavior is undefined unless `0 < maxNumEvents`.
+    ///
+    /// THREAD: This method is called from one of the APPLICATION threads.
+    void nextEvents(bsl::vector<bsl::shared_ptr<bmqimp::Event> >* events,
+                    int                                           maxNumEvents,
+                    const bsls::TimeInterval&                     timeout);
+
     int openQueue(const bsl::shared_ptr<Queue>& queue,
                   bsls::TimeInterval            timeout);
 
@@ -1629,6 +1691,9 @@ class BrokerSession BSLS_CPP11_FINAL {
     /// Invoked when pending PUT expiration timeout fires.
     void onPendingPutExpirationTimeout();
 
+    /// Invoked when the PUT batch timeout fires.
+    void onPutBatchTimeout();
+
     /// Process the specified dump `command`.
     void processDumpCommand(const bmqp_ctrlmsg::DumpMessages& command);
 
@@ -22,6 +22,7 @@
 #include <bmqimp_queue.h>
 #include <bmqp_ackeventbuilder.h>
 #include <bmqp_blobpoolutil.h>
+#include <bmqp_compressiondictionary.h>
 #include <bmqp_confirmeventbuilder.h>
 #include <bmqp_crc32c.h>
 #include <bmqp_ctrlmsg_messages.h>
@@ -63,8 +64,12 @@
 #include <bsls_systemclocktype.h>
 #include <bsls_systemtime.h>
 
+// ZSTD
+#include <zdict.h>
+
 // TEST DRIVER
 #include <bmqtst_testhelper.h>
+#include <bsl_cstdio.h>
 #include <bsl_cstring.h>
 
 // CONVENIENCE
@@ -10232,6 +10237,359 @@ static void test70_queueLateAsyncCanceledHybrid5()
                            bmqimp::QueueState::e_CLOSED);
 }
 
+static void test71_putBatching()
+// ------------------------------------------------------------------------
+// PUT BATCHING
+//
+// Concerns:
+//   1. When PUT batching is enabled, the messages of the PUT events posted
+//      by the user are written to the channel in a single PUT event.
+//   2. The batch is written once it holds the configured number of
+//      messages.
+//   3. The batch is written at the latest after the configured delay.
+//
+// Plan:
+//   1. Create bmqimp::BrokerSession test wrapper object with PUT batching
+//      enabled, start the session and open a queue for writing.
+//   2. Post as many single message PUT events as the maximum number of
+//      messages in a batch, and ensure a single PUT event holding all of
+//      them is written to the channel.
+//   3. Post a single message PUT event, ensure nothing is written to the
+//      channel right away, and that a PUT event holding the message is
+//      written once the batching delay expires.
+//   4. Stop the session.
+//
+// Testing manipulators:
+//   - post
+//-------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("PUT BATCHING");
+
+    const bsls::TimeInterval timeout       = bsls::TimeInterval(15);
+    const bsls::TimeInterval maxDelay      = bsls::TimeInterval(0.5);
+    const int                k_MAX_MSGS    = 3;
+    const char*              k_PAYLOAD     = "abcdefghijklmnopqrstuvwxyz";
+    const int                k_PAYLOAD_LEN = bsl::strlen(k_PAYLOAD);
+
+    bmqt::SessionOptions           sessionOptions;
+    bmqt::QueueOptions             queueOptions;
+    bdlbb::PooledBlobBufferFactory bufferFactory(
+        1024,
+        bmqtst::TestHelperUtil::allocator());
+    bdlmt::EventScheduler scheduler(bsls::SystemClockType::e_MONOTONIC,
+                                    bmqtst::TestHelperUtil::allocator());
+
+    sessionOptions.setNumProcessingThreads(1);
+    sessionOptions.configurePutBatching(maxDelay, k_MAX_MSGS);
+
+    // Create test session with the system time source
+    TestSession obj(sessionOptions,
+                    scheduler,
+                    bmqtst::TestHelperUtil::allocator());
+
+    bsl::shared_ptr<bmqimp::Queue> pQueue =
+        obj.createQueue(k_URI, bmqt::QueueFlags::e_WRITE, queueOptions);
+
+    PVV_SAFE("Step 1. Starting session and opening the queue...");
+    obj.startAndConnect();
+    obj.openQueue(pQueue, timeout);
+
+    bmqp::PutEventBuilder builder(&obj.blobSpPool(), obj.allocator());
+
+    PVV_SAFE("Step 2. Post enough PUT events to fill a batch");
+    for (int i = 0; i < k_MAX_MSGS; ++i) {
+        builder.reset();
+        builder.startMessage();
+        builder.setMessagePayload(k_PAYLOAD, k_PAYLOAD_LEN)
+            .setMessageGUID(bmqp::MessageGUIDGenerator::testGUID());
+        BMQTST_ASSERT_EQ(bmqt::EventBuilderResult::e_SUCCESS,
+                         builder.packMessage(pQueue->id()));
+
+        BMQTST_ASSERT_EQ(obj.session().post(*builder.blob()),
+                         bmqt::PostResult::e_SUCCESS);
+    }
+
+    bmqp::Event rawEvent(bmqtst::TestHelperUtil::allocator());
+    obj.getOutboundEvent(&rawEvent);
+    BMQTST_ASSERT(rawEvent.isPutEvent());
+
+    bmqp::PutMessageIterator putIter(&bufferFactory,
+                                     bmqtst::TestHelperUtil::allocator());
+    rawEvent.loadPutMessageIterator(&putIter);
+    BMQTST_ASSERT(putIter.isValid());
+
+    int numMessages = 0;
+    while (putIter.next() == 1) {
+        BMQTST_ASSERT_EQ(putIter.header().queueId(), pQueue->id());
+        ++numMessages;
+    }
+    BMQTST_ASSERT_EQ(numMessages, k_MAX_MSGS);
+
+    PVV_SAFE("Step 3. Post a single PUT event and wait for the delay");
+    builder.reset();
+    builder.startMessage();
+    builder.setMessagePayload(k_PAYLOAD, k_PAYLOAD_LEN)
+        .setMessageGUID(bmqp::MessageGUIDGenerator::testGUID());
+    BMQTST_ASSERT_EQ(bmqt::EventBuilderResult::e_SUCCESS,
+                     builder.packMessage(pQueue->id()));
+
+    BMQTST_ASSERT_EQ(obj.session().post(*builder.blob()),
+                     bmqt::PostResult::e_SUCCESS);
+
+    // Drain the FSM queue
+    BMQTST_ASSERT_EQ(obj.session().start(bsls::TimeInterval(1)), 0);
+
+    BMQTST_ASSERT(obj.isChannelEmpty());
+
+    rawEvent.clear();
+    obj.getOutboundEvent(&rawEvent);
+    BMQTST_ASSERT(rawEvent.isPutEvent());
+
+    rawEvent.loadPutMessageIterator(&putIter);
+    BMQTST_ASSERT(putIter.isValid());
+    BMQTST_ASSERT_EQ(putIter.next(), 1);
+    BMQTST_ASSERT_EQ(putIter.next(), 0);
+
+    PV_SAFE("Step 4. Stop the session");
+    obj.stopGracefully();
+}
+
+static void openQueueWithDictionary(bsls::Types::Uint64      queueFlags,
+                                    const bsl::vector<char>& dictionary)
+{
+    const bsls::TimeInterval timeout = bsls::TimeInterval(15);
+    bmqt::SessionOptions     sessionOptions;
+    bmqt::QueueOptions       queueOptions;
+    bdlmt::EventScheduler    scheduler(bsls::SystemClockType::e_MONOTONIC,
+                                    bmqtst::TestHelperUtil::allocator());
+
+    sessionOptions.setNumProcessingThreads(1);
+
+    TestSession obj(sessionOptions,
+                    scheduler,
+                    bmqtst::TestHelperUtil::allocator());
+
+    bsl::shared_ptr<bmqimp::Queue> pQueue = obj.createQueue(k_URI,
+                                                            queueFlags,
+                                                            queueOptions);
+
+    obj.startAndConnect();
+
+    int rc = obj.session().openQueueAsync(pQueue, timeout);
+    BMQTST_ASSERT_EQ(rc, bmqt::OpenQueueResult::e_SUCCESS);
+
+    const int openId = obj.verifyRequestSent(TestSession::e_REQ_OPEN_QUEUE);
+
+    PVV_SAFE("Send back open queue response with a compression dictionary");
+    bmqp_ctrlmsg::ControlMessage openQueueResponse(
+        bmqtst::TestHelperUtil::allocator());
+    openQueueResponse.rId().makeValue(openId);
+    openQueueResponse.choice()
+        .makeOpenQueueResponse()
+        .compressionDictionary()
+        .makeValue(dictionary);
+
+    obj.sendControlMessage(openQueueResponse);
+
+    if (bmqt::QueueFlagsUtil::isReader(queueFlags)) {
+        bmqp_ctrlmsg::ControlMessage configureQueueMessage(
+            bmqtst::TestHelperUtil::allocator());
+        bmqp_ctrlmsg::ControlMessage configureQueueResponse(
+            bmqtst::TestHelperUtil::allocator());
+
+        obj.getOutboundControlMessage(&configureQueueMessage);
+        BMQTST_ASSERT(isConfigure(configureQueueMessage));
+
+        makeResponse(&configureQueueResponse, configureQueueMessage);
+        obj.sendControlMessage(configureQueueResponse);
+    }
+
+    BMQTST_ASSERT(
+        obj.verifyOperationResult(bmqt::SessionEventType::e_QUEUE_OPEN_RESULT,
+                                  bmqp_ctrlmsg::StatusCategory::E_SUCCESS));
+    BMQTST_ASSERT_EQ(pQueue->state(), bmqimp::QueueState::e_OPENED);
+
+    const unsigned int id = bmqp::CompressionDictionary::dictionaryId(
+        dictionary.data(),
+        dictionary.size());
+    const bmqp::CompressionDictionary* registered =
+        bmqp::CompressionDictionaryRegistry::defaultRegistry().lookup(id);
+    BMQTST_ASSERT(registered != 0);
+    BMQTST_ASSERT_EQ(pQueue->compressionDictionary(), registered);
+
+    obj.stopGracefully();
+}
+
+static void test72_compressionDictionary()
+// ------------------------------------------------------------------------
+// COMPRESSION DICTIONARY
+//
+// Concerns:
+//   1. The compression dictionary advertised by the broker in the open
+//      queue response is registered in the default dictionary registry
+//      and set on the queue, whatever the mode of the queue, so that
+//      readers can decompress messages compressed with it.
+//
+// Plan:
+//   1. Train a zstd dictionary.
+//   2. For a reader, a writer, and a reader and writer queue, open the
+//      queue with an open queue response carrying the dictionary, and
+//      ensure the dictionary is registered and set on the queue.
+//
+// Testing manipulators:
+//   - openQueueAsync
+//-------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("COMPRESSION DICTIONARY");
+
+    // The default dictionary registry allocates from the global allocator.
+    bmqtst::TestHelperUtil::ignoreCheckGblAlloc() = true;
+
+    bsl::string              samples(bmqtst::TestHelperUtil::allocator());
+    bsl::vector<bsl::size_t> sizes(bmqtst::TestHelperUtil::allocator());
+    for (int i = 0; i < 1000; ++i) {
+        char buffer[128];
+        const int length = bsl::snprintf(buffer,
+                                         sizeof(buffer),
+                                         "{\"orderId\":%d,\"account\":"
+                                         "\"ACC%04d\",\"quantity\":%d}",
+                                         100000 + i,
+                                         (i * 7919) % 10000,
+                                         (i % 100 + 1) * 100);
+        samples.append(buffer, length);
+        sizes.push_back(length);
+    }
+
+    bsl::vector<char> dictionary(bmqtst::TestHelperUtil::allocator());
+    dictionary.resize(4 * 1024);
+    const bsl::size_t size = ZDICT_trainFromBuffer(
+        dictionary.data(),
+        dictionary.size(),
+        samples.data(),
+        sizes.data(),
+        static_cast<unsigned int>(sizes.size()));
+    BSLS_ASSERT_OPT(!ZDICT_isError(size));
+    dictionary.resize(size);
+
+    PVV_SAFE("Check READER");
+    openQueueWithDictionary(bmqt::QueueFlags::e_READ, dictionary);
+
+    PVV_SAFE("Check WRITER");
+    openQueueWithDictionary(bmqt::QueueFlags::e_WRITE, dictionary);
+
+    bsls::Types::Uint64 flags = 0;
+    bmqt::QueueFlagsUtil::setReader(&flags);
+    bmqt::QueueFlagsUtil::setWriter(&flags);
+
+    PVV_SAFE("Check READER and WRITER");
+    openQueueWithDictionary(flags, dictionary);
+}
+
+static void test73_nextEvents()
+// ------------------------------------------------------------------------
+// NEXT EVENTS
+//
+// Concerns:
+//   1. 'nextEvents' returns the available events in the order they were
+//      enqueued, and no more than 'maxNumEvents' of them.
+//   2. Events carrying a callback are consumed by the callback and are
+//      not returned, without altering the order of the other events.
+//   3. If no event is available within the timeout, a single TIMEOUT
+//      session event is returned.
+//
+// Plan:
+//   1. Create bmqimp::BrokerSession test wrapper object without Event
+//      Handler and start the session.
+//   2. Enqueue session events, some with a callback, and pop them with
+//      'nextEvents' using a 'maxNumEvents' lower than their number.
+//   3. Call 'nextEvents' on an empty queue, and on a queue with events
+//      all carrying a callback, and verify a TIMEOUT event is returned.
+//   4. Stop the session
+//
+// Testing manipulators:
+//   - nextEvents
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("NEXT EVENTS");
+
+    bmqt::SessionOptions  sessionOptions;
+    bdlmt::EventScheduler scheduler(bsls::SystemClockType::e_MONOTONIC,
+                                    bmqtst::TestHelperUtil::allocator());
+
+    TestSession obj(sessionOptions,
+                    scheduler,
+                    false,  // useEventHandler
+                    bmqtst::TestHelperUtil::allocator());
+
+    PVV_SAFE("Test step: Start the session");
+    obj.startAndConnect();
+
+    bsl::shared_ptr<bmqimp::Event>             callbackEvent;
+    int                                        callbackCount = 0;
+    const bmqimp::BrokerSession::EventCallback eventCallback =
+        bdlf::BindUtil::bind(&eventCallbackMockup,
+                             &callbackEvent,
+                             &callbackCount,
+                             static_cast<bmqimp::BrokerSession*>(0),
+                             bdlf::PlaceHolders::_1);  // event
+    bsl::vector<bsl::shared_ptr<bmqimp::Event> > events(
+        bmqtst::TestHelperUtil::allocator());
+
+    PVV_SAFE("Test step: Pop events in order, up to 'maxNumEvents'");
+    for (int i = 1; i <= 5; ++i) {
+        obj.session().enqueueSessionEvent(
+            bmqt::SessionEventType::e_UNDEFINED,
+            i,  // statusCode
+            "",
+            bmqt::CorrelationId(),
+            bsl::shared_ptr<bmqimp::Queue>(),
+            i == 2 ? eventCallback : bmqimp::BrokerSession::EventCallback());
+    }
+
+    obj.session().nextEvents(&events, 3, bsls::TimeInterval(5));
+
+    // The second event is consumed by its callback.
+    BMQTST_ASSERT_EQ(callbackCount, 1);
+    BMQTST_ASSERT(callbackEvent);
+    BMQTST_ASSERT_EQ(callbackEvent->statusCode(), 2);
+
+    BMQTST_ASSERT_EQ(events.size(), 2u);
+    BMQTST_ASSERT_EQ(events[0]->statusCode(), 1);
+    BMQTST_ASSERT_EQ(events[1]->statusCode(), 3);
+
+    obj.session().nextEvents(&events, 3, bsls::TimeInterval(5));
+
+    BMQTST_ASSERT_EQ(events.size(), 2u);
+    BMQTST_ASSERT_EQ(events[0]->statusCode(), 4);
+    BMQTST_ASSERT_EQ(events[1]->statusCode(), 5);
+
+    PVV_SAFE("Test step: Timeout on an empty queue");
+    obj.session().nextEvents(&events, 3, bsls::TimeInterval(0.1));
+
+    BMQTST_ASSERT_EQ(events.size(), 1u);
+    BMQTST_ASSERT_EQ(events[0]->sessionEventType(),
+                     bmqt::SessionEventType::e_TIMEOUT);
+
+    PVV_SAFE("Test step: Timeout when all the events have a callback");
+    obj.session().enqueueSessionEvent(bmqt::SessionEventType::e_UNDEFINED,
+                                      6,  // statusCode
+                                      "",
+                                      bmqt::CorrelationId(),
+                                      bsl::shared_ptr<bmqimp::Queue>(),
+                                      eventCallback);
+
+    obj.session().nextEvents(&events, 3, bsls::TimeInterval(0.1));
+
+    BMQTST_ASSERT_EQ(callbackCount, 2);
+    BMQTST_ASSERT_EQ(callbackEvent->statusCode(), 6);
+    BMQTST_ASSERT_EQ(events.size(), 1u);
+    BMQTST_ASSERT_EQ(events[0]->sessionEventType(),
+                     bmqt::SessionEventType::e_TIMEOUT);
+
+    PVV_SAFE("Test step: Stop the session");
+    obj.stopGracefully();
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -10245,6 +10603,9 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 73: test73_nextEvents(); break;
+    case 72: test72_compressionDictionary(); break;
+    case 71: test71_putBatching(); break;
     case 70: break;
     case 69: break;
     case 68: test68_queueLateAsyncCanceledHybrid3(); break;
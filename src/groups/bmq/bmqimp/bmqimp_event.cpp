@@ -189,6 +189,16 @@ Event& Event::operator=(const Event& rhs)
     return *this;
 }
 
+void Event::updateCompressionDictionary(const Queue& queue)
+{
+    if (d_msgEventMode != MessageEventMode::e_READ ||
+        !d_rawEvent.isPushEvent() || d_pushMsgIter.compressionDictionary()) {
+        return;  // RETURN
+    }
+
+    d_pushMsgIter.setCompressionDictionary(queue.compressionDictionary());
+}
+
 void Event::resetIterators()
 {
     if (d_rawEvent.isPushEvent()) {
@@ -224,6 +234,7 @@ void Event::reset()
     d_msgEventMode = MessageEventMode::e_UNINITIALIZED;
     d_rawEvent.clear();
     d_pushMsgIter.clear();
+    d_pushMsgIter.setCompressionDictionary(0);
     d_ackMsgIter.clear();
     d_putMsgIter.clear();
     d_contexts.clear();
@@ -371,6 +382,7 @@ Event& Event::insertQueue(const bsl::shared_ptr<Queue>& queue)
     const bmqp::QueueId queueId(queue->id(), queue->subQueueId());
 
     d_queues.insert(bsl::make_pair(queueId, queue));
+    updateCompressionDictionary(*queue);
 
     return *this;
 }
@@ -383,6 +395,7 @@ Event& Event::insertQueue(unsigned int                  subscriptionId,
 
     d_queuesBySubscriptionId.insert(
         bsl::make_pair(SubscriptionId(queue->id(), subscriptionId), queue));
+    updateCompressionDictionary(*queue);
 
     return *this;
 }
@@ -272,6 +272,14 @@ class Event {
     // For PUSH messages optional corresponding
     // subscription Ids and Schemas may be provided.
 
+  private:
+    // PRIVATE MANIPULATORS
+
+    /// If this object is a PUSH message event in read mode whose iterator
+    /// has no compression dictionary yet, set it to the one of the
+    /// specified `queue`.
+    void updateCompressionDictionary(const Queue& queue);
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(Event, bslma::UsesBslmaAllocator)
@@ -398,6 +406,9 @@ class Event {
     /// Insert the specified `queue` to the queues associated with this
     /// event.  Return a reference offering modifiable access to this
     /// object.  The behavior is undefined unless `queue` is a valid object.
+    /// Note that the compression dictionary of the first queue inserted in
+    /// a PUSH message event is used to decompress its messages without
+    /// looking up the process-wide dictionary registry.
     Event& insertQueue(const bsl::shared_ptr<Queue>& queue);
     Event& insertQueue(unsigned int                  subscriptionId,
                        const bsl::shared_ptr<Queue>& queue);
@@ -40,6 +40,7 @@
 #include <bsl_string.h>
 #include <bsla_annotations.h>
 #include <bslma_allocator.h>
+#include <bslmf_movableref.h>
 #include <bslmt_threadutil.h>
 #include <bsls_assert.h>
 #include <bsls_performancehint.h>
@@ -187,16 +188,20 @@ bool EventQueue::hasPriorityEvents(bsl::shared_ptr<Event>* event)
     return false;
 }
 
+void EventQueue::recordLastPoppedOut(bsls::Types::Int64 popOutTime,
+                                     bsls::Types::Int64 queuedTime)
+{
+    bsls::SpinLockGuard guard(&d_lastPoppedOutSpinLock);  // LOCK
+    d_lastPoppedOutTime = popOutTime;
+    d_lastInQueueTime   = queuedTime;
+}
+
 void EventQueue::afterEventPopped(const QueueItem& item)
 {
     const bsls::Types::Int64 popOutTime = bmqsys::Time::highResolutionTimer();
     const bsls::Types::Int64 queuedTime = popOutTime - item.d_enqueueTime;
 
-    {  // d_lasPoppedOutSpinLock   LOCKED
-        bsls::SpinLockGuard guard(&d_lastPoppedOutSpinLock);
-        d_lastPoppedOutTime = popOutTime;
-        d_lastInQueueTime   = queuedTime;
-    }  // d_lasPoppedOutSpinLock UNLOCKED
+    recordLastPoppedOut(popOutTime, queuedTime);
 
     BALL_LOG_TRACE_BLOCK
     {
@@ -219,6 +224,66 @@ void EventQueue::afterEventPopped(const QueueItem& item)
     }
 }
 
+int EventQueue::timedPopFrontImpl(bsl::shared_ptr<Event>*   event,
+                                  const bsls::TimeInterval& timeout,
+                                  const bsls::TimeInterval& now)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(event);
+
+    // Check for priority events first
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(hasPriorityEvents(event))) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        afterEventPopped(
+            QueueItem(*event, bmqsys::Time::highResolutionTimer()));
+        return 0;  // RETURN
+    }
+
+    const bsls::TimeInterval absTimeOut = timeout + now;
+    // Look in the queue
+    QueueItem item;
+    const int rc = d_queue.timedPopFront(&item, absTimeOut);
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(rc != 0)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        bmqt::SessionEventType::Enum type;
+        bslstl::StringRef            errorDescription;
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(rc == -1)) {
+            // We timed out.. create a timeout event
+            type             = bmqt::SessionEventType::e_TIMEOUT;
+            errorDescription = "No events to pop from queue during the "
+                               "specified timeInterval";
+        }
+        else {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            // Error occurred
+            type             = bmqt::SessionEventType::e_ERROR;
+            errorDescription = "An error occurred while attempting to pop from"
+                               " the queue during the specified timeInterval";
+        }
+
+        *event = getEvent();
+        (*event)->configureAsSessionEvent(type,
+                                          rc,
+                                          bmqt::CorrelationId(),
+                                          errorDescription);
+        item.d_enqueueTime = bmqsys::Time::highResolutionTimer();
+        item.d_event_sp    = *event;
+        // Update stats ('afterEventPopped()' will decrement the counter, so we
+        // need to manually increment it here since we artificially created an
+        // event).
+        if (d_stats_mp) {
+            d_stats_mp->adjustValue(k_STAT_QUEUE, 1);
+        }
+    }
+    else {
+        *event = item.d_event_sp;
+    }
+
+    afterEventPopped(item);
+    return rc;
+}
+
 void EventQueue::printLastEventTime(bsl::ostream& stream)
 {
     bsls::Types::Int64 poppedOutTime = 0;
@@ -562,58 +627,78 @@ EventQueue::timedPopFront(const bsls::TimeInterval& timeout,
                           const bsls::TimeInterval& now)
 {
     bsl::shared_ptr<Event> event;
+    timedPopFrontImpl(&event, timeout, now);
+    return event;
+}
 
-    // Check for priority events first
-    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(hasPriorityEvents(&event))) {
-        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-        afterEventPopped(
-            QueueItem(event, bmqsys::Time::highResolutionTimer()));
-        return event;  // RETURN
+void EventQueue::timedPopFront(bsl::vector<bsl::shared_ptr<Event> >* events,
+                               int                       maxNumEvents,
+                               const bsls::TimeInterval& timeout,
+                               const bsls::TimeInterval& now)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(events);
+    BSLS_ASSERT_SAFE(maxNumEvents > 0);
+    BSLS_ASSERT_SAFE(!d_eventHandler && "Queue has processing threads");
+
+    events->clear();
+    events->resize(1);
+
+    // Wait for the first event exactly as the single event version does.
+    if (timedPopFrontImpl(&events->front(), timeout, now) != 0) {
+        // Timeout or error event
+        return;  // RETURN
     }
 
-    const bsls::TimeInterval absTimeOut = timeout + now;
-    // Look in the queue
-    QueueItem item;
-    const int rc = d_queue.timedPopFront(&item, absTimeOut);
-    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(rc != 0)) {
-        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+    // Drain what is readily available, without blocking, and do the
+    // bookkeeping once for all drained events.
+    QueueItem          item;
+    bool               isPriority = false;
+    int                numPopped  = 0;
+    bsls::Types::Int64 popOutTime = 0;
+    bsls::Types::Int64 queuedTime = 0;
+
+    while (!isPriority && static_cast<int>(events->size()) < maxNumEvents) {
+        // A prioritized event scheduled meanwhile is delivered ahead of the
+        // events still in the queue, and ends the batch.
+        isPriority = hasPriorityEvents(&item.d_event_sp);
+        if (!isPriority && d_queue.tryPopFront(&item) != 0) {
+            break;  // BREAK
+        }
 
-        bmqt::SessionEventType::Enum type;
-        bslstl::StringRef            errorDescription;
-        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(rc == -1)) {
-            // We timed out.. create a timeout event
-            type             = bmqt::SessionEventType::e_TIMEOUT;
-            errorDescription = "No events to pop from queue during the "
-                               "specified timeInterval";
+        // There are no poison pills without processing threads.
+        BSLS_ASSERT_SAFE(item.d_event_sp);
+
+        if (numPopped++ == 0) {
+            popOutTime = bmqsys::Time::highResolutionTimer();
         }
-        else {
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(isPriority)) {
             BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-            // Error occurred
-            type             = bmqt::SessionEventType::e_ERROR;
-            errorDescription = "An error occurred while attempting to pop from"
-                               " the queue during the specified timeInterval";
+            item.d_enqueueTime = popOutTime;
         }
+        queuedTime = popOutTime - item.d_enqueueTime;
+
+        BALL_LOG_TRACE << "Popped out: " << *item.d_event_sp
+                       << " (queuedTime: "
+                       << bmqu::PrintUtil::prettyTimeInterval(queuedTime)
+                       << ")";
 
-        event = getEvent();
-        event->configureAsSessionEvent(type,
-                                       rc,
-                                       bmqt::CorrelationId(),
-                                       errorDescription);
-        item.d_enqueueTime = bmqsys::Time::highResolutionTimer();
-        item.d_event_sp    = event;
-        // Update stats ('afterEventPopped()' will decrement the counter, so we
-        // need to manually increment it here since we artificially created an
-        // event).
         if (d_stats_mp) {
-            d_stats_mp->adjustValue(k_STAT_QUEUE, 1);
+            d_stats_mp->reportValue(k_STAT_TIME, queuedTime);
         }
+
+        events->push_back(bslmf::MovableRefUtil::move(item.d_event_sp));
     }
-    else {
-        event = item.d_event_sp;
+
+    if (numPopped == 0) {
+        return;  // RETURN
     }
 
-    afterEventPopped(item);
-    return event;
+    recordLastPoppedOut(popOutTime, queuedTime);
+
+    if (d_stats_mp) {
+        d_stats_mp->adjustValue(k_STAT_QUEUE, -numPopped);
+    }
 }
 
 void EventQueue::enqueuePoisonPill()
@@ -152,6 +152,7 @@
 #include <bsl_functional.h>
 #include <bsl_memory.h>
 #include <bsl_ostream.h>
+#include <bsl_vector.h>
 #include <bslma_allocator.h>
 #include <bslma_managedptr.h>
 #include <bslma_usesbslmaallocator.h>
@@ -307,10 +308,24 @@ class EventQueue {
     /// prioritized events was scheduled.
     bool hasPriorityEvents(bsl::shared_ptr<Event>* event);
 
+    /// Record the specified `popOutTime` and `queuedTime` of the latest
+    /// event popped out from the queue.
+    void recordLastPoppedOut(bsls::Types::Int64 popOutTime,
+                             bsls::Types::Int64 queuedTime);
+
     /// Called after the specified `item` was successfully popped out from
     /// the queue, just before it being delivered to the caller.
     void afterEventPopped(const QueueItem& item);
 
+    /// Pop the front item of the queue into the specified `event` waiting
+    /// for up to the specified `timeout` in respect to the specified `now`
+    /// as documented in `timedPopFront`.  Return 0 if `event` was popped
+    /// out from the queue (or is a prioritized event), and a non-zero value
+    /// if `event` is a timeout or error event created by this method.
+    int timedPopFrontImpl(bsl::shared_ptr<Event>*   event,
+                          const bsls::TimeInterval& timeout,
+                          const bsls::TimeInterval& now);
+
     /// Print to the specified `stream` a message describing timings of the
     /// latest event that was successfully popped out from the queue.
     void printLastEventTime(bsl::ostream& stream);
@@ -387,6 +402,23 @@ class EventQueue {
         const bsls::TimeInterval& timeout,
         const bsls::TimeInterval& now = bsls::SystemTime::nowMonotonicClock());
 
+    /// Load into the specified `events` up to the specified `maxNumEvents`
+    /// items from the front of the queue.  Wait for the first item exactly
+    /// like `timedPopFront` with the specified `timeout` and `now` does
+    /// (loading a single timeout or error event if none is available), and
+    /// then load, without blocking, the items readily available after it.
+    /// A prioritized event (such as a slow consumer high watermark event)
+    /// scheduled meanwhile is loaded ahead of the remaining items and ends
+    /// the batch.  The bookkeeping of the popped items is done once for the
+    /// batch.  Any previous content of `events` is removed.  The behavior
+    /// is undefined unless `0 < maxNumEvents` and this queue was created
+    /// without processing threads.
+    void timedPopFront(
+        bsl::vector<bsl::shared_ptr<Event> >* events,
+        int                                   maxNumEvents,
+        const bsls::TimeInterval&             timeout,
+        const bsls::TimeInterval& now = bsls::SystemTime::nowMonotonicClock());
+
     /// Enqueue a PoisonPill event; this event represents the termination
     /// condition for the thread reading items from the queue.
     void enqueuePoisonPill();
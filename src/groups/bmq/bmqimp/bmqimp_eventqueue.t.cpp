@@ -41,6 +41,7 @@
 #include <bsl_limits.h>
 #include <bsl_memory.h>
 #include <bsl_ostream.h>
+#include <bsl_vector.h>
 
 // CONVENIENCE
 using namespace BloombergLP;
@@ -119,6 +120,30 @@ void performanceTestQueuePopper(bmqimp::EventQueue* queue, int numIter)
     PRINT_SAFE("Finished popping " << i << " items.");
 }
 
+/// Pop events from the specified `queue` in batches of up to the specified
+/// `batchSize` events until the specified `numRemaining` events to pop for
+/// all poppers is reached.
+void performanceTestQueueBatchPopper(bmqimp::EventQueue* queue,
+                                     int                 batchSize,
+                                     bsls::AtomicInt*    numRemaining)
+{
+    bsl::vector<bsl::shared_ptr<bmqimp::Event> > events(
+        bmqtst::TestHelperUtil::allocator());
+    const bsls::TimeInterval timeout(0, 10000000);  // 10 ms
+    int                      numPopped = 0;
+
+    while (numRemaining->loadRelaxed() > 0) {
+        queue->timedPopFront(&events, batchSize, timeout);
+        if (events.front()->sessionEventType() ==
+            bmqt::SessionEventType::e_TIMEOUT) {
+            continue;  // CONTINUE
+        }
+        numPopped += static_cast<int>(events.size());
+        numRemaining->addRelaxed(-static_cast<int>(events.size()));
+    }
+    PRINT_SAFE("Finished popping " << numPopped << " items.");
+}
+
 void printProcessedItems(int numItems, bsls::Types::Int64 elapsedTime)
 {
     const double numSeconds = static_cast<double>(elapsedTime) / 1000000000LL;
@@ -130,11 +155,16 @@ void printProcessedItems(int numItems, bsls::Types::Int64 elapsedTime)
               << bsl::endl;
 }
 
+/// Push the specified `numIter` events from the specified `numWriters`
+/// threads to an `EventQueue` of the specified `queueSize` and pop them from
+/// the specified `numReaders` threads, one by one if the optionally specified
+/// `batchSize` is 0, or in batches of up to `batchSize` events otherwise.
 void queuePerformance(int                       numReaders,
                       int                       numWriters,
                       int                       numIter,
                       int                       queueSize,
-                      bdlbb::BlobBufferFactory* bufferFactory)
+                      bdlbb::BlobBufferFactory* bufferFactory,
+                      int                       batchSize = 0)
 {
     bdlmt::ThreadPool threadPool(
         bslmt::ThreadAttributes(),        // default
@@ -145,8 +175,9 @@ void queuePerformance(int                       numReaders,
     BSLS_ASSERT_OPT(threadPool.start() == 0);
 
     PRINT_SAFE("===================");
-    PRINT_SAFE("Queue numReaders: " << numReaders
-                                    << " numWriters: " << numWriters);
+    PRINT_SAFE("Queue numReaders: " << numReaders << " numWriters: "
+                                    << numWriters
+                                    << " batchSize: " << batchSize);
     PRINT_SAFE("===================");
     bmqimp::EventQueue::EventPool eventPool(
         bdlf::BindUtil::bind(&poolCreateEvent,
@@ -167,12 +198,23 @@ void queuePerformance(int                       numReaders,
         bmqimp::SessionId(bmqp_ctrlmsg::NegotiationMessage()),
         bmqtst::TestHelperUtil::allocator());
 
+    bsls::AtomicInt numRemaining(numIter);
     for (int i = 0; i < numReaders; i++) {
-        threadPool.enqueueJob(
-            bdlf::BindUtil::bindS(bmqtst::TestHelperUtil::allocator(),
-                                  &performanceTestQueuePopper,
-                                  &obj,
-                                  numIter / numReaders));
+        if (batchSize == 0) {
+            threadPool.enqueueJob(
+                bdlf::BindUtil::bindS(bmqtst::TestHelperUtil::allocator(),
+                                      &performanceTestQueuePopper,
+                                      &obj,
+                                      numIter / numReaders));
+        }
+        else {
+            threadPool.enqueueJob(
+                bdlf::BindUtil::bindS(bmqtst::TestHelperUtil::allocator(),
+                                      &performanceTestQueueBatchPopper,
+                                      &obj,
+                                      batchSize,
+                                      &numRemaining));
+        }
     }
 
     bsls::Types::Int64 startTime = bsls::TimeUtil::getTimer();
@@ -695,6 +737,82 @@ static void test6_workingStatsTest()
                      k_INITIAL_CAPACITY * k_MILL_SEC + k_QUEUE_WAIT);
 }
 
+static void test7_batchPopFront()
+// ------------------------------------------------------------------------
+// BATCH POP FRONT
+//
+// Concerns:
+//   1. Popping a batch of events loads the available events, in order, up
+//      to the requested number of events.
+//   2. Popping a batch from an empty queue loads a single timeout event.
+//   3. The queue stats account for all popped events.
+//
+// Plan:
+//   1. Enqueue 5 events and pop them in batches of up to 3 events.
+//   2. Pop a batch from the empty queue.
+//
+// Testing manipulators:
+//   - timedPopFront (batch)
+//   ----------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("BATCH POP FRONT");
+
+    const int k_NUM_EVENTS = 5;
+
+    bmqimp::EventQueue::EventHandlerCallback emptyEventHandler;
+    bdlbb::PooledBlobBufferFactory           bufferFactory(
+        1024,
+        bmqtst::TestHelperUtil::allocator());
+    bmqimp::EventQueue::EventPool eventPool(
+        bdlf::BindUtil::bind(&poolCreateEvent,
+                             bdlf::PlaceHolders::_1,  // address
+                             &bufferFactory,
+                             bdlf::PlaceHolders::_2),  // allocator
+        -1,
+        bmqtst::TestHelperUtil::allocator());
+
+    bmqimp::EventQueue obj(&eventPool,
+                           k_NUM_EVENTS,      // initialCapacity
+                           k_NUM_EVENTS,      // lowWatermark
+                           k_NUM_EVENTS * 2,  // highWatermark
+                           emptyEventHandler,
+                           0,  // numProcessingThreads
+                           bmqimp::SessionId(),
+                           bmqtst::TestHelperUtil::allocator());
+
+    for (int i = 0; i < k_NUM_EVENTS; ++i) {
+        bsl::shared_ptr<bmqimp::Event> event = eventPool.getObject();
+        event->configureAsSessionEvent(bmqt::SessionEventType::e_UNDEFINED,
+                                       i,  // statusCode
+                                       bmqt::CorrelationId(),
+                                       "");
+        BMQTST_ASSERT_EQ_D(i, obj.pushBack(event), 0);
+    }
+
+    bsl::vector<bsl::shared_ptr<bmqimp::Event> > events(
+        bmqtst::TestHelperUtil::allocator());
+    const bsls::TimeInterval timeout(0, 2000000);  // 2 ms
+
+    // Pop a full batch
+    obj.timedPopFront(&events, 3, timeout);
+    BMQTST_ASSERT_EQ(events.size(), size_t(3));
+    for (size_t i = 0; i < events.size(); ++i) {
+        BMQTST_ASSERT_EQ_D(i, events[i]->statusCode(), static_cast<int>(i));
+    }
+
+    // Pop the remaining events
+    obj.timedPopFront(&events, 3, timeout);
+    BMQTST_ASSERT_EQ(events.size(), size_t(2));
+    BMQTST_ASSERT_EQ(events[0]->statusCode(), 3);
+    BMQTST_ASSERT_EQ(events[1]->statusCode(), 4);
+
+    // No more events
+    obj.timedPopFront(&events, 3, timeout);
+    BMQTST_ASSERT_EQ(events.size(), size_t(1));
+    BMQTST_ASSERT_EQ(events[0]->sessionEventType(),
+                     bmqt::SessionEventType::e_TIMEOUT);
+}
+
 static void testN1_performance()
 // ------------------------------------------------------------------------
 // QUEUE - PERFORMANCE TEST
@@ -746,6 +864,50 @@ static void testN1_performance()
                      &bufferFactory);
 }
 
+static void testN2_batchPerformance()
+// ------------------------------------------------------------------------
+// QUEUE - BATCH PERFORMANCE TEST
+//
+// Concerns:
+//  a) Check the throughput of bmqimp::EventQueue, in events per second,
+//     when multiple readers drain it in batches, as a function of the
+//     number of readers.
+//
+// Plan:
+//  1) Create a bmqimp::EventQueue and enqueue events as quickly as
+//     possible on it, while popping them in batches of various sizes from
+//     an increasing number of threads.
+//  2) Compare with the 'testN1_performance' popping one event at a time.
+//
+// Testing:
+//  Performance
+// ------------------------------------------------------------------------
+{
+    // CONSTANTS
+    const int k_NUM_ITERATIONS   = 10 * 1000 * 1000;  // 10 M
+    const int k_FIXED_QUEUE_SIZE = 10 * 1000 * 1000;  // 10 M
+    const int k_BATCH_SIZES[]    = {16, 256};
+    const int k_NUM_READERS[]    = {1, 2, 4, 8, 16};
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(
+        1024,
+        bmqtst::TestHelperUtil::allocator());
+
+    for (size_t i = 0; i < sizeof(k_BATCH_SIZES) / sizeof(*k_BATCH_SIZES);
+         ++i) {
+        for (size_t j = 0;
+             j < sizeof(k_NUM_READERS) / sizeof(*k_NUM_READERS);
+             ++j) {
+            queuePerformance(k_NUM_READERS[j],
+                             1,
+                             k_NUM_ITERATIONS,
+                             k_FIXED_QUEUE_SIZE,
+                             &bufferFactory,
+                             k_BATCH_SIZES[i]);
+        }
+    }
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -758,6 +920,7 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 7: test7_batchPopFront(); break;
     case 6: test6_workingStatsTest(); break;
     case 5: test5_emptyStatsTest(); break;
     case 4: test4_basicEventHandlerTest(); break;
@@ -765,6 +928,7 @@ int main(int argc, char* argv[])
     case 2: test2_capacityTest(); break;
     case 1: test1_breathingTest(); break;
     case -1: testN1_performance(); break;
+    case -2: testN2_batchPerformance(); break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         bmqtst::TestHelperUtil::testStatus() = -1;
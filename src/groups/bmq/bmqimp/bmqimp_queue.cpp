@@ -326,6 +326,7 @@ Queue::Queue(bslma::Allocator* allocator)
 , d_stats_mp(0)
 , d_isSuspended(false)
 , d_isOldStyle(true)
+, d_compressionDictionary_p(0)
 , d_isSuspendedWithBroker(false)
 , d_schemaGenerator(allocator)
 , d_config(allocator)
@@ -31,6 +31,7 @@
 // BMQ
 #include <bmqimp_stat.h>
 
+#include <bmqp_compressiondictionary.h>
 #include <bmqp_ctrlmsg_messages.h>
 #include <bmqp_queueid.h>
 #include <bmqp_schemagenerator.h>
@@ -241,6 +242,16 @@ class Queue {
     // Temporary; shall remove after 2nd
     // roll out of "new style" brokers.
 
+    bsls::AtomicPointer<const bmqp::CompressionDictionary>
+        d_compressionDictionary_p;
+    // Dictionary advertised by the broker
+    // for the domain of this queue, or 0 if
+    // none (held, not owned; it lives in
+    // the default dictionary registry).
+    // Used to compress messages posted to
+    // the queue if it is a writer, and to
+    // decompress messages pushed from it.
+
     bool d_isSuspendedWithBroker;
     // Whether the queue is suspended from
     // the perspective of the broker.
@@ -305,6 +316,12 @@ class Queue {
     /// Temporary; shall remove after 2nd roll out of "new style" brokers.
     Queue& setOldStyle(bool value);
 
+    /// Set the compression dictionary of this queue to the specified
+    /// `value` and return a reference offering modifiable access to this
+    /// object.  Note that this method can be called while other threads
+    /// are posting messages to this queue.
+    Queue& setCompressionDictionary(const bmqp::CompressionDictionary* value);
+
     /// Create a new subcontext for this queue, out of the specified
     /// `parentStatContext`.  The behavior is undefined unless this method
     /// is called on valid queue in opened state.  The behavior is also
@@ -371,6 +388,10 @@ class Queue {
     bool                                  isOldStyle() const;
     const bmqp_ctrlmsg::StreamParameters& config() const;
 
+    /// Return the compression dictionary the broker advertised for the
+    /// domain of this queue, or 0 if the broker did not advertise any.
+    const bmqp::CompressionDictionary* compressionDictionary() const;
+
     bmqp::SchemaGenerator& schemaGenerator();
 
     /// @brief Return whether this Queue is valid, i.e., is associated to an
@@ -531,6 +552,13 @@ inline Queue& Queue::setOldStyle(bool value)
     return *this;
 }
 
+inline Queue&
+Queue::setCompressionDictionary(const bmqp::CompressionDictionary* value)
+{
+    d_compressionDictionary_p = value;
+    return *this;
+}
+
 inline Queue& Queue::setIsSuspendedWithBroker(bool value)
 {
     d_isSuspendedWithBroker = value;
@@ -657,6 +685,11 @@ inline bool Queue::isOldStyle() const
     return d_isOldStyle;
 }
 
+inline const bmqp::CompressionDictionary* Queue::compressionDictionary() const
+{
+    return d_compressionDictionary_p;
+}
+
 inline bool Queue::isSuspendedWithBroker() const
 {
     return d_isSuspendedWithBroker;
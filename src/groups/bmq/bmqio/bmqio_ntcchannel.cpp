@@ -30,16 +30,24 @@
 #include <bdlf_bind.h>
 #include <bdlf_memfn.h>
 #include <bdlf_placeholder.h>
+#include <bsl_algorithm.h>
+#include <bsl_climits.h>
 #include <bsl_cstddef.h>
 #include <bsl_iomanip.h>
 #include <bsl_ios.h>
 #include <bsl_iostream.h>
 #include <bslma_allocator.h>
 #include <bslma_default.h>
+#include <bslmt_condition.h>
 #include <bslmt_lockguard.h>
 #include <bsls_assert.h>
 #include <bsls_platform.h>
 
+// SYSTEM
+#if defined(BSLS_PLATFORM_OS_UNIX)
+#include <sys/uio.h>
+#endif
+
 namespace BloombergLP {
 namespace bmqio {
 
@@ -50,6 +58,14 @@ BALL_LOG_SET_NAMESPACE_CATEGORY("BMQIO.NTCCHANNEL");
 /// Maximum number of bytes to dump when in read/write.
 const int k_MAX_BYTES_DUMP = 512;
 
+/// Maximum number of buffers of the blobs coalesced in a single send, so
+/// that they can be transmitted by a single vectored system call.
+#if defined(IOV_MAX)
+const int k_MAX_WRITE_SEGMENTS = IOV_MAX;
+#else
+const int k_MAX_WRITE_SEGMENTS = 1024;
+#endif
+
 #if defined(BSLS_PLATFORM_CPU_64_BIT)
 #define BMQIO_ADDRESS_WIDTH 16
 #else
@@ -519,6 +535,55 @@ bool NtcReadQueue::empty() const
     return d_list.empty();
 }
 
+// -----------------------
+// struct NtcChannel::Write
+// -----------------------
+
+/// Write operation pending on the channel, waiting to be sent.
+struct NtcChannel::Write {
+    // DATA
+
+    /// Status to populate with the result of the operation, if any.
+    Status* d_status_p;
+
+    /// Blob to write.
+    const bdlbb::Blob* d_blob_p;
+
+    /// Watermark the blob is written with.
+    bsls::Types::Int64 d_watermark;
+
+    /// Next operation in the write queue, if any.
+    Write* d_next_p;
+
+    /// Flag indicating whether the thread having enqueued this operation is
+    /// the one sending pending write operations.
+    bool d_isSending;
+
+    /// Flag indicating whether this operation has been sent.
+    bool d_isComplete;
+
+    /// Condition signaled when this operation has been sent, or when the
+    /// thread having enqueued it must send pending write operations.
+    bslmt::Condition d_condition;
+
+    // CREATORS
+
+    /// Create a write operation of the specified `blob` with the specified
+    /// `watermark`, populating the specified `status`, if defined.
+    Write(Status*            status,
+          const bdlbb::Blob& blob,
+          bsls::Types::Int64 watermark)
+    : d_status_p(status)
+    , d_blob_p(&blob)
+    , d_watermark(watermark)
+    , d_next_p(0)
+    , d_isSending(false)
+    , d_isComplete(false)
+    , d_condition()
+    {
+    }
+};
+
 // ----------------
 // class NtcChannel
 // ----------------
@@ -936,6 +1001,142 @@ void NtcChannel::drainReaders(const bmqio::Status& status)
     }
 }
 
+void NtcChannel::send(Status*            status,
+                      const bdlbb::Blob& blob,
+                      bsls::Types::Int64 watermark)
+{
+    BMQIO_NTCCHANNEL_LOG_WRITE(this, d_streamSocket_sp, blob);
+
+    ntca::SendOptions sendOptions;
+    if (watermark != bsl::numeric_limits<int>::max()) {
+        sendOptions.setHighWatermark(watermark);
+    }
+
+    ++d_numSends;
+
+    ntsa::Error error = d_streamSocket_sp->send(blob, sendOptions);
+    if (error) {
+        if (error == ntsa::Error::e_WOULD_BLOCK) {
+            BMQIO_NTCCHANNEL_LOG_WRITE_WOULD_BLOCK(this,
+                                                   d_streamSocket_sp,
+                                                   blob);
+            NtcChannelUtil::fail(status,
+                                 bmqio::StatusCategory::e_LIMIT,
+                                 "send",
+                                 error);
+        }
+        else {
+            BMQIO_NTCCHANNEL_LOG_WRITE_FAILED(this,
+                                              d_streamSocket_sp,
+                                              blob,
+                                              error);
+            NtcChannelUtil::fail(status,
+                                 bmqio::StatusCategory::e_CONNECTION,
+                                 "send",
+                                 error);
+        }
+    }
+}
+
+void NtcChannel::sendWrites(Write* operation)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(operation);
+    BSLS_ASSERT_SAFE(operation->d_isSending);
+
+    // Dequeue the operations to send along with 'operation': the ones
+    // directly following it with the same watermark, as long as the number of
+    // buffers to send fits in a single vectored system call.
+    int numWrites = 1;
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_writeMutex);
+
+        BSLS_ASSERT_SAFE(d_writeQueueHead_p == operation);
+
+        Write* last        = operation;
+        int    numSegments = bsl::max(last->d_blob_p->numDataBuffers(), 1);
+        while (last->d_next_p &&
+               last->d_next_p->d_watermark == operation->d_watermark) {
+            numSegments += bsl::max(last->d_next_p->d_blob_p->numDataBuffers(),
+                                    1);
+            if (numSegments > k_MAX_WRITE_SEGMENTS) {
+                break;  // BREAK
+            }
+
+            last = last->d_next_p;
+            ++numWrites;
+        }
+
+        d_writeQueueHead_p = last->d_next_p;
+        if (d_writeQueueHead_p == 0) {
+            d_writeQueueTail_p = 0;
+        }
+        last->d_next_p = 0;
+    }
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        if (d_state != e_STATE_OPEN) {
+            for (Write* current = operation; current;
+                 current        = current->d_next_p) {
+                bmqio::NtcChannelUtil::fail(
+                    current->d_status_p,
+                    bmqio::StatusCategory::e_GENERIC_ERROR,
+                    "state",
+                    ntsa::Error(ntsa::Error::e_INVALID));
+            }
+        }
+        else if (numWrites == 1) {
+            send(operation->d_status_p,
+                 *operation->d_blob_p,
+                 operation->d_watermark);
+        }
+        else {
+            for (Write* current = operation; current;
+                 current        = current->d_next_p) {
+                bdlbb::BlobUtil::append(&d_writeBlob, *current->d_blob_p);
+            }
+
+            bmqio::Status status(d_allocator_p);
+            send(&status, d_writeBlob, operation->d_watermark);
+
+            d_writeBlob.removeAll();
+
+            if (!status) {
+                for (Write* current = operation; current;
+                     current        = current->d_next_p) {
+                    if (current->d_status_p) {
+                        *current->d_status_p = status;
+                    }
+                }
+            }
+        }
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_writeMutex);
+
+    // Notify the threads having enqueued the operations just sent.  Note that
+    // an operation may be destroyed as soon as it is notified and the write
+    // mutex is released.
+    Write* current = operation->d_next_p;
+    while (current) {
+        Write* next           = current->d_next_p;
+        current->d_isComplete = true;
+        current->d_condition.signal();
+        current = next;
+    }
+
+    // Hand off the sending of the operations enqueued in the meantime.
+    if (d_writeQueueHead_p) {
+        d_writeQueueHead_p->d_isSending = true;
+        d_writeQueueHead_p->d_condition.signal();
+    }
+    else {
+        d_isWriting = false;
+    }
+}
+
 // CREATORS
 NtcChannel::NtcChannel(
     const bsl::shared_ptr<ntci::Interface>&      interface,
@@ -954,6 +1155,14 @@ NtcChannel::NtcChannel(
 , d_watermarkSignaler(basicAllocator)
 , d_closeSignaler(basicAllocator)
 , d_resultCallback(bsl::allocator_arg, basicAllocator, resultCallback)
+, d_writeMutex()
+, d_writeQueueHead_p(0)
+, d_writeQueueTail_p(0)
+, d_isWriting(false)
+, d_isWriteCoalescingEnabled(true)
+, d_writeBlob(basicAllocator)
+, d_numWrites(0)
+, d_numSends(0)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
 }
@@ -1191,53 +1400,60 @@ void NtcChannel::write(Status*            status,
                        const bdlbb::Blob& blob,
                        bsls::Types::Int64 watermark)
 {
-    ntsa::Error error;
-
     if (status) {
         status->reset();
     }
 
     bsl::shared_ptr<NtcChannel> self = this->shared_from_this();
 
-    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    ++d_numWrites;
 
-    if (d_state != e_STATE_OPEN) {
-        bmqio::NtcChannelUtil::fail(status,
-                                    bmqio::StatusCategory::e_GENERIC_ERROR,
-                                    "state",
-                                    ntsa::Error(ntsa::Error::e_INVALID));
+    if (!d_isWriteCoalescingEnabled) {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        if (d_state != e_STATE_OPEN) {
+            bmqio::NtcChannelUtil::fail(
+                status,
+                bmqio::StatusCategory::e_GENERIC_ERROR,
+                "state",
+                ntsa::Error(ntsa::Error::e_INVALID));
+            return;
+        }
+
+        send(status, blob, watermark);
         return;
     }
 
-    BMQIO_NTCCHANNEL_LOG_WRITE(this, d_streamSocket_sp, blob);
+    Write operation(status, blob, watermark);
 
-    ntca::SendOptions sendOptions;
-    if (watermark != bsl::numeric_limits<int>::max()) {
-        sendOptions.setHighWatermark(watermark);
-    }
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_writeMutex);
 
-    error = d_streamSocket_sp->send(blob, sendOptions);
-    if (error) {
-        if (error == ntsa::Error::e_WOULD_BLOCK) {
-            BMQIO_NTCCHANNEL_LOG_WRITE_WOULD_BLOCK(this,
-                                                   d_streamSocket_sp,
-                                                   blob);
-            NtcChannelUtil::fail(status,
-                                 bmqio::StatusCategory::e_LIMIT,
-                                 "send",
-                                 error);
+        if (d_writeQueueTail_p) {
+            d_writeQueueTail_p->d_next_p = &operation;
         }
         else {
-            BMQIO_NTCCHANNEL_LOG_WRITE_FAILED(this,
-                                              d_streamSocket_sp,
-                                              blob,
-                                              error);
-            NtcChannelUtil::fail(status,
-                                 bmqio::StatusCategory::e_CONNECTION,
-                                 "send",
-                                 error);
+            d_writeQueueHead_p = &operation;
+        }
+        d_writeQueueTail_p = &operation;
+
+        if (!d_isWriting) {
+            d_isWriting           = true;
+            operation.d_isSending = true;
+        }
+
+        // Wait for either another thread to send this operation, or for
+        // this thread to be in charge of sending the pending operations.
+        while (!operation.d_isSending && !operation.d_isComplete) {
+            operation.d_condition.wait(&d_writeMutex);
+        }
+
+        if (operation.d_isComplete) {
+            return;
         }
     }
+
+    sendWrites(&operation);
 }
 
 void NtcChannel::cancel()
@@ -1362,6 +1578,11 @@ void NtcChannel::setWriteQueueHighWatermark(int highWatermark)
     }
 }
 
+void NtcChannel::setWriteCoalescing(bool value)
+{
+    d_isWriteCoalescingEnabled = value;
+}
+
 // ACCESSORS
 int NtcChannel::channelId() const
 {
@@ -1395,6 +1616,16 @@ bslma::Allocator* NtcChannel::allocator() const
     return d_allocator_p;
 }
 
+bsls::Types::Int64 NtcChannel::numWrites() const
+{
+    return d_numWrites;
+}
+
+bsls::Types::Int64 NtcChannel::numSends() const
+{
+    return d_numSends;
+}
+
 const ntci::StreamSocket& NtcChannel::streamSocket() const
 {
     BSLS_ASSERT(d_streamSocket_sp);
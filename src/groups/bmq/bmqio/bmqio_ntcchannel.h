@@ -25,6 +25,20 @@
 //@DESCRIPTION: This component provides a mechanism, 'bmqio::NtcChannel',
 // implemented by NTC to asynchronously send and receive arbitrary blobs of
 // data.
+//
+/// Write Coalescing
+///----------------
+// Blobs written concurrently to a 'bmqio::NtcChannel' are coalesced: while a
+// thread is sending data to the socket, the blobs written by the other threads
+// are queued, and the next of these threads sends all of them at once, up to
+// 'IOV_MAX' buffers, so that they are transmitted by a single vectored system
+// call instead of one system call per blob.  Each 'write' still returns only
+// once its blob has been submitted to the socket, and reports the status of
+// that submission.  Blobs written with different watermarks are never
+// coalesced together.  The 'numWrites' and 'numSends' accessors report the
+// number of blobs written to the channel and the number of send operations
+// they were submitted in, respectively.  Write coalescing can be disabled
+// using 'setWriteCoalescing'.
 
 #include <bmqio_channel.h>
 #include <bmqio_channelfactory.h>
@@ -49,6 +63,8 @@
 #include <bsl_string.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
+#include <bslmt_mutex.h>
+#include <bsls_atomic.h>
 #include <bsls_keyword.h>
 #include <bsls_timeinterval.h>
 #include <bsls_types.h>
@@ -197,6 +213,9 @@ class NtcChannel : public bmqio::Channel,
         e_STATE_CLOSED
     };
 
+    /// Write operation pending on the channel, waiting to be sent.
+    struct Write;
+
     // INSTANCE DATA
     bslmt::Mutex                          d_mutex;
     bsl::shared_ptr<ntci::Interface>      d_interface_sp;
@@ -211,6 +230,14 @@ class NtcChannel : public bmqio::Channel,
     bdlmt::Signaler<WatermarkFnType>      d_watermarkSignaler;
     bdlmt::Signaler<CloseFnType>          d_closeSignaler;
     bmqio::ChannelFactory::ResultCallback d_resultCallback;
+    bslmt::Mutex                          d_writeMutex;
+    Write*                                d_writeQueueHead_p;
+    Write*                                d_writeQueueTail_p;
+    bool                                  d_isWriting;
+    bool                                  d_isWriteCoalescingEnabled;
+    bdlbb::Blob                           d_writeBlob;
+    bsls::AtomicInt64                     d_numWrites;
+    bsls::AtomicInt64                     d_numSends;
     bslma::Allocator*                     d_allocator_p;
 
   private:
@@ -287,6 +314,22 @@ class NtcChannel : public bmqio::Channel,
     /// Notify using the specified `status` and remove each existing reader.
     void drainReaders(const bmqio::Status& status);
 
+    /// Send the specified `blob` to the socket, as allowed by the specified
+    /// `watermark`, and populate the specified `status`, if defined, with
+    /// the result of the operation.  The behavior is undefined unless
+    /// `d_mutex` is locked and the channel is open.
+    void send(Status*            status,
+              const bdlbb::Blob& blob,
+              bsls::Types::Int64 watermark);
+
+    /// Send in a single operation the write operations at the front of the
+    /// write queue, starting with the specified `operation`, and hand off
+    /// the sending of the remaining write operations, if any, to the thread
+    /// having enqueued the first of them.  The behavior is undefined unless
+    /// `operation` is at the front of the write queue and the calling thread
+    /// is the one sending pending write operations.
+    void sendWrites(Write* operation);
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(NtcChannel, bslma::UsesBslmaAllocator)
@@ -411,6 +454,12 @@ class NtcChannel : public bmqio::Channel,
     /// Set the write queue high watermark to the specified `highWatermark`.
     void setWriteQueueHighWatermark(int highWatermark);
 
+    /// Enable the coalescing of concurrent write operations if the
+    /// specified `value` is `true`, and disable it otherwise.  Write
+    /// coalescing is enabled by default.  The behavior is undefined unless
+    /// no write operation is in progress.
+    void setWriteCoalescing(bool value);
+
     // ACCESSORS
 
     /// Return the channel ID.
@@ -433,6 +482,15 @@ class NtcChannel : public bmqio::Channel,
     /// Return the allocator this object was created with.
     bslma::Allocator* allocator() const;
 
+    /// Return the number of blobs written to this channel.
+    bsls::Types::Int64 numWrites() const;
+
+    /// Return the number of send operations the blobs written to this
+    /// channel were submitted to the socket in.  Note that the ratio of
+    /// `numWrites()` over this value is the average number of blobs sent by
+    /// a single system call.
+    bsls::Types::Int64 numSends() const;
+
     /// Return the socket interface for this channel. This function is
     /// undefined unless the channel has succesfully established a connection.
     const ntci::StreamSocket& streamSocket() const;
@@ -25,14 +25,25 @@
 #include <ntsf_system.h>
 
 // BDE
+#include <bdlbb_blobutil.h>
 #include <bdlbb_pooledblobbufferfactory.h>
 #include <bdlf_bind.h>
+#include <bsl_algorithm.h>
 #include <bsla_annotations.h>
+#include <bslmt_barrier.h>
+#include <bslmt_semaphore.h>
+#include <bslmt_threadgroup.h>
+#include <bsls_atomic.h>
 #include <bsls_types.h>
 
 #include <bmqtst_testhelper.h>
 #include <bsl_vector.h>
 
+// BENCHMARKING LIBRARY
+#ifdef BMQTST_BENCHMARK_ENABLED
+#include <benchmark/benchmark.h>
+#endif
+
 // CONVENIENCE
 using namespace BloombergLP;
 using namespace bsl;
@@ -105,6 +116,54 @@ void executeOnClosedChannelFunc(bmqio::NtcChannel*        channel,
     channel->close();
 }
 
+/// Write from the current thread, after waiting on the specified `barrier`,
+/// the specified `numBlobs` blobs of the specified `blobSize` bytes equal to
+/// the specified `value` to the specified `channel`, allocating the blobs
+/// from the specified `bufferFactory`.  Increment the specified
+/// `numFailures` for each write that fails.
+void writeBlobs(bmqio::Channel*           channel,
+                bdlbb::BlobBufferFactory* bufferFactory,
+                bslmt::Barrier*           barrier,
+                char                      value,
+                int                       numBlobs,
+                int                       blobSize,
+                bsls::AtomicInt*          numFailures)
+{
+    const bsl::string data(blobSize,
+                           value,
+                           bmqtst::TestHelperUtil::allocator());
+
+    barrier->wait();
+
+    for (int i = 0; i < numBlobs; ++i) {
+        bdlbb::Blob blob(bufferFactory, bmqtst::TestHelperUtil::allocator());
+        bdlbb::BlobUtil::append(&blob, data.data(), blobSize);
+
+        bmqio::Status status(bmqtst::TestHelperUtil::allocator());
+        channel->write(&status, blob);
+        if (!status) {
+            ++(*numFailures);
+        }
+    }
+}
+
+/// Append the data read in the specified `blob` to the specified `data`,
+/// and post on the specified `semaphore`.
+void onRead(bslmt::Semaphore*    semaphore,
+            bdlbb::Blob*         data,
+            const bmqio::Status& status,
+            int*                 numNeeded,
+            bdlbb::Blob*         blob)
+{
+    if (status) {
+        bdlbb::BlobUtil::append(data, *blob);
+        bdlbb::BlobUtil::erase(blob, 0, blob->length());
+        *numNeeded = 0;
+    }
+
+    semaphore->post();
+}
+
 // ============
 // class Tester
 // ============
@@ -159,6 +218,10 @@ class Tester {
     void init();
 
     bsl::shared_ptr<bmqio::NtcChannel> connect();
+
+    /// Return the channel accepted by the listener for the connection
+    /// established by the last call to `connect`.
+    bsl::shared_ptr<bmqio::Channel> lastAcceptedChannel();
 };
 
 // ------------
@@ -336,6 +399,14 @@ bsl::shared_ptr<bmqio::NtcChannel> Tester::connect()
     return channel;
 }
 
+bsl::shared_ptr<bmqio::Channel> Tester::lastAcceptedChannel()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    BSLS_ASSERT_OPT(!d_listenChannels.empty());
+    return d_listenChannels.back();
+}
+
 }  // close unnamed namespace
 
 // ============================================================================
@@ -385,6 +456,200 @@ static void test1_breathingTest()
     channel->close();
 }
 
+static void test2_writeCoalescing()
+// ------------------------------------------------------------------------
+// WRITE COALESCING
+//
+// Concerns:
+//   a) Blobs written concurrently from several threads are all received
+//      intact by the peer, whether write coalescing is enabled or not.
+//   b) When write coalescing is enabled, concurrent writes may be sent in
+//      a single operation: the number of sends does not exceed the number
+//      of writes.
+//   c) When write coalescing is disabled, each write is sent on its own.
+//
+// Testing:
+//   write(Status*, const bdlbb::Blob&, bsls::Types::Int64);
+//   setWriteCoalescing(bool);
+//   numWrites();
+//   numSends();
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("Write Coalescing");
+
+    const int k_NUM_THREADS = 4;
+    const int k_NUM_BLOBS   = 256;
+    const int k_BLOB_SIZE   = 32;
+    const int k_NUM_BYTES   = k_NUM_THREADS * k_NUM_BLOBS * k_BLOB_SIZE;
+
+    Tester tester(bmqtst::TestHelperUtil::allocator());
+    tester.init();
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(
+        4096,
+        bmqtst::TestHelperUtil::allocator());
+
+    for (int isCoalescing = 0; isCoalescing < 2; ++isCoalescing) {
+        PVV("Write coalescing: " << (isCoalescing ? "enabled" : "disabled"));
+
+        bsl::shared_ptr<bmqio::NtcChannel> channel = tester.connect();
+        bsl::shared_ptr<bmqio::Channel>    peer = tester.lastAcceptedChannel();
+        channel->setWriteCoalescing(isCoalescing);
+
+        bslmt::Semaphore readSemaphore;
+        bdlbb::Blob      data(bmqtst::TestHelperUtil::allocator());
+        bmqio::Status    status(bmqtst::TestHelperUtil::allocator());
+        peer->read(&status,
+                   k_NUM_BYTES,
+                   bdlf::BindUtil::bindS(bmqtst::TestHelperUtil::allocator(),
+                                         &onRead,
+                                         &readSemaphore,
+                                         &data,
+                                         bdlf::PlaceHolders::_1,
+                                         bdlf::PlaceHolders::_2,
+                                         bdlf::PlaceHolders::_3),
+                   bsls::TimeInterval(30));
+        BMQTST_ASSERT_EQ(status.category(), bmqio::StatusCategory::e_SUCCESS);
+
+        bslmt::Barrier     barrier(k_NUM_THREADS);
+        bsls::AtomicInt    numFailures(0);
+        bslmt::ThreadGroup threadGroup(bmqtst::TestHelperUtil::allocator());
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            threadGroup.addThread(
+                bdlf::BindUtil::bindS(bmqtst::TestHelperUtil::allocator(),
+                                      &writeBlobs,
+                                      channel.get(),
+                                      &bufferFactory,
+                                      &barrier,
+                                      static_cast<char>('a' + i),
+                                      k_NUM_BLOBS,
+                                      k_BLOB_SIZE,
+                                      &numFailures));
+        }
+        threadGroup.joinAll();
+
+        readSemaphore.wait();
+
+        BMQTST_ASSERT_EQ(numFailures.load(), 0);
+        BMQTST_ASSERT_EQ(data.length(), k_NUM_BYTES);
+
+        bsl::vector<char> bytes(k_NUM_BYTES,
+                                '\0',
+                                bmqtst::TestHelperUtil::allocator());
+        bdlbb::BlobUtil::copy(bytes.data(), data, 0, data.length());
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            const int numBytes = static_cast<int>(
+                bsl::count(bytes.begin(),
+                           bytes.end(),
+                           static_cast<char>('a' + i)));
+            BMQTST_ASSERT_EQ_D(i, numBytes, k_NUM_BLOBS * k_BLOB_SIZE);
+        }
+
+        BMQTST_ASSERT_EQ(channel->numWrites(), k_NUM_THREADS * k_NUM_BLOBS);
+        if (isCoalescing) {
+            BMQTST_ASSERT_GT(channel->numSends(), 0);
+            BMQTST_ASSERT_LE(channel->numSends(), channel->numWrites());
+        }
+        else {
+            BMQTST_ASSERT_EQ(channel->numSends(), channel->numWrites());
+        }
+
+        PVV("Writes per send: "
+            << static_cast<double>(channel->numWrites()) /
+                   static_cast<double>(channel->numSends()));
+
+        channel->close();
+    }
+}
+
+// ============================================================================
+//                              PERFORMANCE TESTS
+// ----------------------------------------------------------------------------
+
+#ifdef BMQTST_BENCHMARK_ENABLED
+static void testN1_writeThroughput_GoogleBenchmark(benchmark::State& state)
+{
+    // Write, from 'k_NUM_THREADS' threads concurrently, 'k_NUM_BLOBS' small
+    // blobs each over a loopback connection, and wait for the peer to have
+    // received all of them, with write coalescing enabled if 'state.range(0)'
+    // is not zero.  Each iteration includes the creation of the writing
+    // threads.
+
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+
+    const int k_NUM_THREADS = 4;
+    const int k_NUM_BLOBS   = 1024;
+    const int k_BLOB_SIZE   = 64;
+    const int k_NUM_BYTES   = k_NUM_THREADS * k_NUM_BLOBS * k_BLOB_SIZE;
+
+    Tester tester(bmqtst::TestHelperUtil::allocator());
+    tester.init();
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(
+        4096,
+        bmqtst::TestHelperUtil::allocator());
+
+    bsl::shared_ptr<bmqio::NtcChannel> channel = tester.connect();
+    bsl::shared_ptr<bmqio::Channel>    peer    = tester.lastAcceptedChannel();
+    channel->setWriteCoalescing(state.range(0) != 0);
+
+    bsls::AtomicInt numFailures(0);
+
+    // <time>
+    for (auto _ : state) {
+        bslmt::Semaphore readSemaphore;
+        bdlbb::Blob      data(bmqtst::TestHelperUtil::allocator());
+        bmqio::Status    status(bmqtst::TestHelperUtil::allocator());
+        peer->read(&status,
+                   k_NUM_BYTES,
+                   bdlf::BindUtil::bindS(bmqtst::TestHelperUtil::allocator(),
+                                         &onRead,
+                                         &readSemaphore,
+                                         &data,
+                                         bdlf::PlaceHolders::_1,
+                                         bdlf::PlaceHolders::_2,
+                                         bdlf::PlaceHolders::_3),
+                   bsls::TimeInterval(30));
+
+        bslmt::Barrier     barrier(k_NUM_THREADS);
+        bslmt::ThreadGroup threadGroup(bmqtst::TestHelperUtil::allocator());
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            threadGroup.addThread(
+                bdlf::BindUtil::bindS(bmqtst::TestHelperUtil::allocator(),
+                                      &writeBlobs,
+                                      channel.get(),
+                                      &bufferFactory,
+                                      &barrier,
+                                      static_cast<char>('a' + i),
+                                      k_NUM_BLOBS,
+                                      k_BLOB_SIZE,
+                                      &numFailures));
+        }
+        threadGroup.joinAll();
+
+        readSemaphore.wait();
+    }
+    // </time>
+
+    BMQTST_ASSERT_EQ(numFailures.load(), 0);
+
+    state.counters["writesPerSend"] = static_cast<double>(
+                                          channel->numWrites()) /
+                                      static_cast<double>(channel->numSends());
+    state.SetItemsProcessed(state.iterations() * k_NUM_THREADS *
+                            k_NUM_BLOBS);
+    state.SetBytesProcessed(state.iterations() * k_NUM_BYTES);
+
+    channel->close();
+}
+#else
+static void testN1_writeThroughput()
+{
+    bmqtst::TestHelper::printTestName("GOOGLE BENCHMARK: writeThroughput");
+    PV("GoogleBenchmark is not supported on this platform, skipping...")
+}
+#endif
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -395,14 +660,31 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 2: {
+        test2_writeCoalescing();
+    } break;
     case 1: {
         test1_breathingTest();
     } break;
+    case -1:
+        BMQTST_BENCHMARK_WITH_ARGS(testN1_writeThroughput,
+                                   Arg(0)
+                                       ->Arg(1)
+                                       ->UseRealTime()
+                                       ->Unit(benchmark::kMillisecond));
+        break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         bmqtst::TestHelperUtil::testStatus() = -1;
     } break;
     }
 
+#ifdef BMQTST_BENCHMARK_ENABLED
+    if (_testCase < 0) {
+        benchmark::Initialize(&argc, argv);
+        benchmark::RunSpecifiedBenchmarks();
+    }
+#endif
+
     TEST_EPILOG(0);
 }
@@ -18,16 +18,28 @@
 
 #include <bmqscm_version.h>
 
+#include <bmqp_compressiondictionary.h>
 #include <bmqu_blob.h>
 
 // BDE
 #include <bdlbb_blobutil.h>
 #include <bdlma_sequentialallocator.h>
+#include <bsl_algorithm.h>
+#include <bsl_cstring.h>
+#include <bsl_limits.h>
 #include <bslma_allocator.h>
+#include <bslma_deallocatorguard.h>
+#include <bslma_default.h>
 
 // ZLIB
 #include <zlib.h>
 
+// ZSTD
+#include <zstd.h>
+
+// LZ4
+#include <lz4frame.h>
+
 // MemorySanitizer
 #if defined(__has_feature)
 #if __has_feature(memory_sanitizer)
@@ -299,15 +311,217 @@ int ZLib::writeOutput(bdlbb::Blob*              output,
     return rc_SUCCESS;
 }
 
+// ================
+// class BlobOutput
+// ================
+
+/// Mechanism to write the output of a streaming (de)compressor directly
+/// into the buffers of a blob, allocating them on demand.
+class BlobOutput {
+  private:
+    // DATA
+    bdlbb::Blob*              d_output_p;
+    bdlbb::BlobBufferFactory* d_factory_p;
+    bdlbb::BlobBuffer         d_buffer;
+    int                       d_used;
+
+  private:
+    // NOT IMPLEMENTED
+    BlobOutput(const BlobOutput&) BSLS_KEYWORD_DELETED;
+    BlobOutput& operator=(const BlobOutput&) BSLS_KEYWORD_DELETED;
+
+  public:
+    // CREATORS
+
+    /// Create an object appending data buffers to the specified `output`,
+    /// allocated from the specified `factory`.
+    BlobOutput(bdlbb::Blob* output, bdlbb::BlobBufferFactory* factory)
+    : d_output_p(output)
+    , d_factory_p(factory)
+    , d_buffer()
+    , d_used(0)
+    {
+        // NOTHING
+    }
+
+    // MANIPULATORS
+
+    /// Ensure the current buffer has free space, appending it to the output
+    /// and allocating a new one if it is full.
+    void reserve()
+    {
+        if (d_used == d_buffer.size()) {
+            if (d_used) {
+                d_output_p->appendDataBuffer(d_buffer);
+            }
+            d_factory_p->allocate(&d_buffer);
+            d_used = 0;
+        }
+    }
+
+    /// Return the address of the free space of the current buffer.
+    char* data() { return d_buffer.data() + d_used; }
+
+    /// Mark the specified `numBytes` of free space as written.
+    void advance(size_t numBytes) { d_used += static_cast<int>(numBytes); }
+
+    /// Append the written part of the current buffer, if any, to the
+    /// output.
+    void finish()
+    {
+        if (d_used) {
+            d_buffer.setSize(d_used);
+            d_output_p->appendDataBuffer(d_buffer);
+            d_buffer.reset();
+            d_used = 0;
+        }
+    }
+
+    // ACCESSORS
+
+    /// Return the number of bytes of free space in the current buffer.
+    size_t available() const { return d_buffer.size() - d_used; }
+};
+
+// ===================
+// struct ContextGuard
+// ===================
+
+/// Guard releasing a (de)compression context of the parameterized `TYPE`
+/// with the parameterized `FREE` function upon destruction.
+template <class TYPE, size_t (*FREE)(TYPE*)>
+struct ContextGuard {
+    // DATA
+    TYPE* d_context_p;
+
+    // CREATORS
+    explicit ContextGuard(TYPE* context)
+    : d_context_p(context)
+    {
+        // NOTHING
+    }
+
+    ~ContextGuard()
+    {
+        if (d_context_p) {
+            FREE(d_context_p);
+        }
+    }
+};
+
+// ===========
+// struct Zstd
+// ===========
+
+/// This struct provides the utility functions for enabling compression
+/// using the Zstandard algorithm.
+struct Zstd {
+    // CONSTANTS
+
+    /// Default compression level, as recommended by the library.
+    static const int k_DEFAULT_LEVEL = 3;
+
+    /// Maximum size of a frame header, as per the Zstandard format
+    /// specification (`ZSTD_FRAMEHEADERSIZE_MAX` is not part of the stable
+    /// API).
+    static const int k_MAX_FRAME_HEADER_SIZE = 18;
+
+    // CLASS METHODS
+
+    /// If the specified `stream` is non-zero, output the specified
+    /// `baseMessage`, followed by the name of the specified error `code`.
+    static void setError(bsl::ostream*            stream,
+                         const bslstl::StringRef& baseMessage,
+                         size_t                   code);
+};
+
+void Zstd::setError(bsl::ostream*            stream,
+                    const bslstl::StringRef& baseMessage,
+                    size_t                   code)
+{
+    if (stream) {
+        (*stream) << baseMessage << ", Message: " << ZSTD_getErrorName(code);
+    }
+}
+
+// ==========
+// struct Lz4
+// ==========
+
+/// This struct provides the utility functions for enabling compression
+/// using the LZ4 frame format.
+struct Lz4 {
+    // CONSTANTS
+
+    /// Default compression level (fast mode).
+    static const int k_DEFAULT_LEVEL = 0;
+
+    // CLASS METHODS
+
+    /// If the specified `stream` is non-zero, output the specified
+    /// `baseMessage`, followed by the name of the specified error `code`.
+    static void setError(bsl::ostream*            stream,
+                         const bslstl::StringRef& baseMessage,
+                         size_t                   code);
+};
+
+void Lz4::setError(bsl::ostream*            stream,
+                   const bslstl::StringRef& baseMessage,
+                   size_t                   code)
+{
+    if (stream) {
+        (*stream) << baseMessage << ", Message: " << LZ4F_getErrorName(code);
+    }
+}
+
 }  // close unnamed namespace
 
 // ==================
 // struct Compression
 // ==================
 
+const int Compression::k_DEFAULT_LEVEL = bsl::numeric_limits<int>::min();
+
+int Compression::compress(bdlbb::Blob*                         output,
+                          bdlbb::BlobBufferFactory*            factory,
+                          bmqt::CompressionAlgorithmType::Enum algorithm,
+                          const bdlbb::Blob&                   input,
+                          bsl::ostream*                        errorStream,
+                          bslma::Allocator*                    allocator)
+{
+    return compress(output,
+                    factory,
+                    algorithm,
+                    k_DEFAULT_LEVEL,
+                    0,
+                    input,
+                    errorStream,
+                    allocator);
+}
+
 int Compression::compress(bdlbb::Blob*                         output,
                           bdlbb::BlobBufferFactory*            factory,
                           bmqt::CompressionAlgorithmType::Enum algorithm,
+                          int                                  level,
+                          const bdlbb::Blob&                   input,
+                          bsl::ostream*                        errorStream,
+                          bslma::Allocator*                    allocator)
+{
+    return compress(output,
+                    factory,
+                    algorithm,
+                    level,
+                    0,
+                    input,
+                    errorStream,
+                    allocator);
+}
+
+int Compression::compress(bdlbb::Blob*                         output,
+                          bdlbb::BlobBufferFactory*            factory,
+                          bmqt::CompressionAlgorithmType::Enum algorithm,
+                          int                                  level,
+                          const CompressionDictionary*         dictionary,
                           const bdlbb::Blob&                   input,
                           bsl::ostream*                        errorStream,
                           bslma::Allocator*                    allocator)
@@ -320,12 +534,30 @@ int Compression::compress(bdlbb::Blob*                         output,
 
     switch (algorithm) {
     case bmqt::CompressionAlgorithmType::e_ZLIB:
-        return Compression_Impl::compressZlib(output,
-                                              factory,
-                                              input,
-                                              Z_DEFAULT_COMPRESSION,
-                                              errorStream,
-                                              allocator);  // RETURN
+        return Compression_Impl::compressZlib(
+            output,
+            factory,
+            input,
+            level == k_DEFAULT_LEVEL ? Z_DEFAULT_COMPRESSION : level,
+            errorStream,
+            allocator);  // RETURN
+    case bmqt::CompressionAlgorithmType::e_ZSTD:
+        return Compression_Impl::compressZstd(
+            output,
+            factory,
+            input,
+            level == k_DEFAULT_LEVEL ? Zstd::k_DEFAULT_LEVEL : level,
+            dictionary,
+            errorStream,
+            allocator);  // RETURN
+    case bmqt::CompressionAlgorithmType::e_LZ4:
+        return Compression_Impl::compressLz4(
+            output,
+            factory,
+            input,
+            level == k_DEFAULT_LEVEL ? Lz4::k_DEFAULT_LEVEL : level,
+            errorStream,
+            allocator);  // RETURN
     case bmqt::CompressionAlgorithmType::e_NONE:
         if (output->length() == 0) {
             *output = input;
@@ -373,6 +605,25 @@ int Compression::compress(bdlbb::Blob*                         output,
                                               errorStream,
                                               allocator);  // RETURN
     }
+    case bmqt::CompressionAlgorithmType::e_ZSTD:
+    case bmqt::CompressionAlgorithmType::e_LZ4: {
+        bsl::shared_ptr<char> inputBufferSp(const_cast<char*>(input),
+                                            bslstl::SharedPtrNilDeleter(),
+                                            allocator);
+        bdlbb::BlobBuffer     inputBlobBuffer(inputBufferSp, inputLength);
+
+        if (inputBlobBuffer.size() > 0) {
+            inputBlob.appendDataBuffer(inputBlobBuffer);
+        }
+
+        return compress(output,
+                        factory,
+                        algorithm,
+                        k_DEFAULT_LEVEL,
+                        inputBlob,
+                        errorStream,
+                        allocator);  // RETURN
+    }
     case bmqt::CompressionAlgorithmType::e_NONE:
         // deep copy of input character array to output Blob
         bdlbb::BlobUtil::append(output, input, inputLength);
@@ -388,6 +639,23 @@ int Compression::decompress(bdlbb::Blob*                         output,
                             const bdlbb::Blob&                   input,
                             bsl::ostream*                        errorStream,
                             bslma::Allocator*                    allocator)
+{
+    return decompress(output,
+                      factory,
+                      algorithm,
+                      0,
+                      input,
+                      errorStream,
+                      allocator);
+}
+
+int Compression::decompress(bdlbb::Blob*                         output,
+                            bdlbb::BlobBufferFactory*            factory,
+                            bmqt::CompressionAlgorithmType::Enum algorithm,
+                            const CompressionDictionary*         dictionary,
+                            const bdlbb::Blob&                   input,
+                            bsl::ostream*                        errorStream,
+                            bslma::Allocator*                    allocator)
 {
     enum RcEnum { rc_SUCCESS = 0, rc_UNKNOWN_ALGORITHM = -1 };
 
@@ -398,6 +666,19 @@ int Compression::decompress(bdlbb::Blob*                         output,
                                                 input,
                                                 errorStream,
                                                 allocator);  // RETURN
+    case bmqt::CompressionAlgorithmType::e_ZSTD:
+        return Compression_Impl::decompressZstd(output,
+                                                factory,
+                                                input,
+                                                dictionary,
+                                                errorStream,
+                                                allocator);  // RETURN
+    case bmqt::CompressionAlgorithmType::e_LZ4:
+        return Compression_Impl::decompressLz4(output,
+                                               factory,
+                                               input,
+                                               errorStream,
+                                               allocator);  // RETURN
     case bmqt::CompressionAlgorithmType::e_NONE:
         if (output->length() == 0) {
             *output = input;
@@ -484,5 +765,398 @@ int Compression_Impl::decompressZlib(bdlbb::Blob*              output,
                              &::inflateEnd);
 }
 
+int Compression_Impl::compressZstd(bdlbb::Blob*                 output,
+                                   bdlbb::BlobBufferFactory*    factory,
+                                   const bdlbb::Blob&           input,
+                                   int                          level,
+                                   const CompressionDictionary* dictionary,
+                                   bsl::ostream*                errorStream,
+                                   bslma::Allocator* /* allocator */)
+{
+    enum RcEnum {
+        rc_SUCCESS                = 0,
+        rc_STREAM_INIT_FAILURE    = -1,
+        rc_STREAM_PROCESS_FAILURE = -2,
+        rc_STREAM_END_FAILURE     = -3
+    };
+
+    ContextGuard<ZSTD_CCtx, &ZSTD_freeCCtx> context(ZSTD_createCCtx());
+    if (!context.d_context_p) {
+        if (errorStream) {
+            (*errorStream) << "Error creating zstd compression context";
+        }
+        return rc_STREAM_INIT_FAILURE;  // RETURN
+    }
+
+    // A digested dictionary carries its own compression parameters, which
+    // take precedence over the compression level.
+    size_t result;
+    if (dictionary) {
+        result = ZSTD_CCtx_refCDict(context.d_context_p,
+                                    dictionary->compressionDictionary());
+    }
+    else {
+        result = ZSTD_CCtx_setParameter(context.d_context_p,
+                                        ZSTD_c_compressionLevel,
+                                        level);
+    }
+    if (!ZSTD_isError(result)) {
+        // Record the content size in the frame header, allowing the
+        // decompressor to size its window optimally.
+        result = ZSTD_CCtx_setPledgedSrcSize(context.d_context_p,
+                                             input.length());
+    }
+    if (ZSTD_isError(result)) {
+        Zstd::setError(errorStream,
+                       "Error initializing zstd compression stream",
+                       result);
+        return rc_STREAM_INIT_FAILURE;  // RETURN
+    }
+
+    BlobOutput out(output, factory);
+
+    for (int i = 0; i < input.numDataBuffers(); ++i) {
+        ZSTD_inBuffer in = {input.buffer(i).data(),
+                            static_cast<size_t>(
+                                bmqu::BlobUtil::bufferSize(input, i)),
+                            0};
+        while (in.pos < in.size) {
+            out.reserve();
+            ZSTD_outBuffer outBuffer = {out.data(), out.available(), 0};
+
+            result = ZSTD_compressStream2(context.d_context_p,
+                                          &outBuffer,
+                                          &in,
+                                          ZSTD_e_continue);
+            if (ZSTD_isError(result)) {
+                Zstd::setError(errorStream,
+                               "Error processing zstd stream",
+                               result);
+                return rc_STREAM_PROCESS_FAILURE;  // RETURN
+            }
+            out.advance(outBuffer.pos);
+        }
+    }
+
+    // Flush the frame epilogue; a non-zero result is the number of bytes
+    // still to be flushed.
+    ZSTD_inBuffer empty = {0, 0, 0};
+    do {
+        out.reserve();
+        ZSTD_outBuffer outBuffer = {out.data(), out.available(), 0};
+
+        result = ZSTD_compressStream2(context.d_context_p,
+                                      &outBuffer,
+                                      &empty,
+                                      ZSTD_e_end);
+        if (ZSTD_isError(result)) {
+            Zstd::setError(errorStream, "Error finishing zstd stream", result);
+            return rc_STREAM_END_FAILURE;  // RETURN
+        }
+        out.advance(outBuffer.pos);
+    } while (result != 0);
+
+    out.finish();
+
+    return rc_SUCCESS;
+}
+
+int Compression_Impl::decompressZstd(bdlbb::Blob*                 output,
+                                     bdlbb::BlobBufferFactory*    factory,
+                                     const bdlbb::Blob&           input,
+                                     const CompressionDictionary* dictionary,
+                                     bsl::ostream*                errorStream,
+                                     bslma::Allocator* /* allocator */)
+{
+    enum RcEnum {
+        rc_SUCCESS                = 0,
+        rc_STREAM_INIT_FAILURE    = -1,
+        rc_STREAM_PROCESS_FAILURE = -2,
+        rc_STREAM_END_FAILURE     = -3,
+        rc_UNKNOWN_DICTIONARY     = -4
+    };
+
+    ContextGuard<ZSTD_DCtx, &ZSTD_freeDCtx> context(ZSTD_createDCtx());
+    if (!context.d_context_p) {
+        if (errorStream) {
+            (*errorStream) << "Error creating zstd decompression context";
+        }
+        return rc_STREAM_INIT_FAILURE;  // RETURN
+    }
+
+    // The id of the dictionary, if any, is recorded in the frame header,
+    // which is at most 'Zstd::k_MAX_FRAME_HEADER_SIZE' bytes long.
+    char      header[Zstd::k_MAX_FRAME_HEADER_SIZE];
+    const int headerSize = bsl::min(input.length(),
+                                    static_cast<int>(sizeof(header)));
+    bdlbb::BlobUtil::copy(header, input, 0, headerSize);
+
+    const unsigned int dictionaryId = ZSTD_getDictID_fromFrame(header,
+                                                               headerSize);
+    if (dictionaryId != 0) {
+        // Only consult the registry, which is shared by the whole process, if
+        // the dictionary provided by the caller is not the right one.
+        if (!dictionary || dictionary->id() != dictionaryId) {
+            dictionary = CompressionDictionaryRegistry::defaultRegistry()
+                             .lookup(dictionaryId);
+        }
+        if (!dictionary) {
+            if (errorStream) {
+                (*errorStream) << "Error initializing zstd decompression "
+                               << "stream, Message: unknown dictionary "
+                               << dictionaryId;
+            }
+            return rc_UNKNOWN_DICTIONARY;  // RETURN
+        }
+
+        const size_t result = ZSTD_DCtx_refDDict(
+            context.d_context_p,
+            dictionary->decompressionDictionary());
+        if (ZSTD_isError(result)) {
+            Zstd::setError(errorStream,
+                           "Error initializing zstd decompression stream",
+                           result);
+            return rc_STREAM_INIT_FAILURE;  // RETURN
+        }
+    }
+
+    BlobOutput out(output, factory);
+
+    // Non-zero until a complete frame has been decoded and flushed.
+    size_t result = 1;
+
+    for (int i = 0; i < input.numDataBuffers(); ++i) {
+        ZSTD_inBuffer in = {input.buffer(i).data(),
+                            static_cast<size_t>(
+                                bmqu::BlobUtil::bufferSize(input, i)),
+                            0};
+        while (in.pos < in.size) {
+            out.reserve();
+            ZSTD_outBuffer outBuffer = {out.data(), out.available(), 0};
+
+            result = ZSTD_decompressStream(context.d_context_p,
+                                           &outBuffer,
+                                           &in);
+            if (ZSTD_isError(result)) {
+                Zstd::setError(errorStream,
+                               "Error processing zstd stream",
+                               result);
+                return rc_STREAM_PROCESS_FAILURE;  // RETURN
+            }
+            out.advance(outBuffer.pos);
+        }
+    }
+
+    // Flush data still buffered by the decompressor, if any.
+    while (result != 0) {
+        out.reserve();
+        ZSTD_outBuffer outBuffer = {out.data(), out.available(), 0};
+        ZSTD_inBuffer  empty     = {0, 0, 0};
+
+        result = ZSTD_decompressStream(context.d_context_p,
+                                       &outBuffer,
+                                       &empty);
+        if (ZSTD_isError(result)) {
+            Zstd::setError(errorStream, "Error finishing zstd stream", result);
+            return rc_STREAM_END_FAILURE;  // RETURN
+        }
+        if (outBuffer.pos == 0 && result != 0) {
+            if (errorStream) {
+                (*errorStream) << "Error finishing zstd stream, Message: "
+                               << "truncated input";
+            }
+            return rc_STREAM_END_FAILURE;  // RETURN
+        }
+        out.advance(outBuffer.pos);
+    }
+
+    out.finish();
+
+    return rc_SUCCESS;
+}
+
+int Compression_Impl::compressLz4(bdlbb::Blob*              output,
+                                  bdlbb::BlobBufferFactory* factory,
+                                  const bdlbb::Blob&        input,
+                                  int                       level,
+                                  bsl::ostream*             errorStream,
+                                  bslma::Allocator*         allocator)
+{
+    enum RcEnum {
+        rc_SUCCESS                = 0,
+        rc_STREAM_INIT_FAILURE    = -1,
+        rc_STREAM_PROCESS_FAILURE = -2,
+        rc_STREAM_END_FAILURE     = -3
+    };
+
+    LZ4F_cctx* rawContext = 0;
+    size_t     result     = LZ4F_createCompressionContext(&rawContext,
+                                                    LZ4F_VERSION);
+    if (LZ4F_isError(result)) {
+        Lz4::setError(errorStream,
+                      "Error creating lz4 compression context",
+                      result);
+        return rc_STREAM_INIT_FAILURE;  // RETURN
+    }
+    ContextGuard<LZ4F_cctx, &LZ4F_freeCompressionContext> context(
+        rawContext);
+
+    LZ4F_preferences_t preferences;
+    bsl::memset(&preferences, 0, sizeof(preferences));
+    preferences.frameInfo.contentSize = input.length();
+    preferences.compressionLevel      = level;
+
+    // The LZ4 frame API requires the destination of each call to be large
+    // enough for its worst case, which the blob buffers from 'factory' are
+    // not guaranteed to be: compress into a contiguous scratch area sized
+    // for the worst case of the whole blob, and copy it to 'output'.
+    size_t capacity = LZ4F_HEADER_SIZE_MAX +
+                      LZ4F_compressBound(0, &preferences);
+    for (int i = 0; i < input.numDataBuffers(); ++i) {
+        capacity += LZ4F_compressBound(bmqu::BlobUtil::bufferSize(input, i),
+                                       &preferences);
+    }
+
+    bslma::Allocator* alloc   = bslma::Default::allocator(allocator);
+    char*             scratch = static_cast<char*>(alloc->allocate(capacity));
+    bslma::DeallocatorGuard<bslma::Allocator> guard(scratch, alloc);
+
+    size_t size = LZ4F_compressBegin(context.d_context_p,
+                                     scratch,
+                                     capacity,
+                                     &preferences);
+    if (LZ4F_isError(size)) {
+        Lz4::setError(errorStream, "Error initializing lz4 stream", size);
+        return rc_STREAM_INIT_FAILURE;  // RETURN
+    }
+
+    for (int i = 0; i < input.numDataBuffers(); ++i) {
+        result = LZ4F_compressUpdate(context.d_context_p,
+                                     scratch + size,
+                                     capacity - size,
+                                     input.buffer(i).data(),
+                                     bmqu::BlobUtil::bufferSize(input, i),
+                                     0);
+        if (LZ4F_isError(result)) {
+            Lz4::setError(errorStream, "Error processing lz4 stream", result);
+            return rc_STREAM_PROCESS_FAILURE;  // RETURN
+        }
+        size += result;
+    }
+
+    result = LZ4F_compressEnd(context.d_context_p,
+                              scratch + size,
+                              capacity - size,
+                              0);
+    if (LZ4F_isError(result)) {
+        Lz4::setError(errorStream, "Error finishing lz4 stream", result);
+        return rc_STREAM_END_FAILURE;  // RETURN
+    }
+    size += result;
+
+    BlobOutput  out(output, factory);
+    const char* src = scratch;
+    while (size) {
+        out.reserve();
+        const size_t chunk = bsl::min(size, out.available());
+        bsl::memcpy(out.data(), src, chunk);
+        out.advance(chunk);
+        src += chunk;
+        size -= chunk;
+    }
+    out.finish();
+
+    return rc_SUCCESS;
+}
+
+int Compression_Impl::decompressLz4(bdlbb::Blob*              output,
+                                    bdlbb::BlobBufferFactory* factory,
+                                    const bdlbb::Blob&        input,
+                                    bsl::ostream*             errorStream,
+                                    bslma::Allocator* /* allocator */)
+{
+    enum RcEnum {
+        rc_SUCCESS                = 0,
+        rc_STREAM_INIT_FAILURE    = -1,
+        rc_STREAM_PROCESS_FAILURE = -2,
+        rc_STREAM_END_FAILURE     = -3
+    };
+
+    LZ4F_dctx* rawContext = 0;
+    size_t     result     = LZ4F_createDecompressionContext(&rawContext,
+                                                      LZ4F_VERSION);
+    if (LZ4F_isError(result)) {
+        Lz4::setError(errorStream,
+                      "Error creating lz4 decompression context",
+                      result);
+        return rc_STREAM_INIT_FAILURE;  // RETURN
+    }
+    ContextGuard<LZ4F_dctx, &LZ4F_freeDecompressionContext> context(
+        rawContext);
+
+    BlobOutput out(output, factory);
+
+    // Hint of the number of input bytes expected next; 0 once a complete
+    // frame has been decoded and flushed.
+    result = 1;
+
+    for (int i = 0; i < input.numDataBuffers(); ++i) {
+        const char* src       = input.buffer(i).data();
+        size_t      remaining = bmqu::BlobUtil::bufferSize(input, i);
+
+        while (remaining) {
+            out.reserve();
+            size_t dstSize = out.available();
+            size_t srcSize = remaining;
+
+            result = LZ4F_decompress(context.d_context_p,
+                                     out.data(),
+                                     &dstSize,
+                                     src,
+                                     &srcSize,
+                                     0);
+            if (LZ4F_isError(result)) {
+                Lz4::setError(errorStream,
+                              "Error processing lz4 stream",
+                              result);
+                return rc_STREAM_PROCESS_FAILURE;  // RETURN
+            }
+            src += srcSize;
+            remaining -= srcSize;
+            out.advance(dstSize);
+        }
+    }
+
+    // Flush data still buffered by the decompressor, if any.
+    while (result != 0) {
+        out.reserve();
+        size_t dstSize = out.available();
+        size_t srcSize = 0;
+
+        result = LZ4F_decompress(context.d_context_p,
+                                 out.data(),
+                                 &dstSize,
+                                 0,
+                                 &srcSize,
+                                 0);
+        if (LZ4F_isError(result)) {
+            Lz4::setError(errorStream, "Error finishing lz4 stream", result);
+            return rc_STREAM_END_FAILURE;  // RETURN
+        }
+        if (dstSize == 0 && result != 0) {
+            if (errorStream) {
+                (*errorStream) << "Error finishing lz4 stream, Message: "
+                               << "truncated input";
+            }
+            return rc_STREAM_END_FAILURE;  // RETURN
+        }
+        out.advance(dstSize);
+    }
+
+    out.finish();
+
+    return rc_SUCCESS;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
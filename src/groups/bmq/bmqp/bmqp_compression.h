@@ -29,6 +29,15 @@
 // provides implementation for compression and decompression for all supported
 // types of compression algorithms.
 //
+/// Supported Algorithms
+///--------------------
+//: o ZLIB: deflate stream (RFC 1950), default level 'Z_DEFAULT_COMPRESSION'.
+//: o ZSTD: Zstandard frame, default level 3.  Levels range from negative
+//:   values (fastest) up to 22 (best ratio), and out-of-range levels are
+//:   clamped.  Suited for bulk, cross-datacenter traffic.
+//: o LZ4:  LZ4 frame, default level 0 (fast mode).  Levels above 2 select
+//:   the high compression mode.  Suited for latency sensitive traffic.
+//
 
 // BMQ
 
@@ -43,12 +52,21 @@ namespace BloombergLP {
 
 namespace bmqp {
 
+// FORWARD DECLARATION
+class CompressionDictionary;
+
 // ==================
 // struct Compression
 // ==================
 
 /// This struct provides the ability for compression functionality.
 struct Compression {
+    // CONSTANTS
+
+    /// Value of the compression `level` selecting the default level of the
+    /// specified algorithm.
+    static const int k_DEFAULT_LEVEL;
+
     // CLASS METHODS
 
     /// Compress the data within the specified `input` as per the specified
@@ -66,6 +84,49 @@ struct Compression {
                         bsl::ostream*                        errorStream = 0,
                         bslma::Allocator*                    allocator   = 0);
 
+    /// Compress the data within the specified `input` as per the specified
+    /// `algorithm` using the specified compression `level`, and load the
+    /// compressed data into the specified `output`, using the specified
+    /// `factory` to supply data buffers.  Return 0 on success, and non-zero
+    /// otherwise.  Specify `k_DEFAULT_LEVEL` as `level` to use the default
+    /// level of `algorithm`; `level` is ignored for
+    /// `bmqt::CompressionAlgorithmType::e_NONE`.  Also, optionally specify
+    /// an `errorStream` to record details on any errors that may occur
+    /// during this operation. Finally, as an option specify `allocator`
+    /// which will be used to supply memory.  Note, that any existing data
+    /// in the specified `output` will be preserved.
+    static int compress(bdlbb::Blob*                         output,
+                        bdlbb::BlobBufferFactory*            factory,
+                        bmqt::CompressionAlgorithmType::Enum algorithm,
+                        int                                  level,
+                        const bdlbb::Blob&                   input,
+                        bsl::ostream*                        errorStream = 0,
+                        bslma::Allocator*                    allocator   = 0);
+
+    /// Compress the data within the specified `input` as per the specified
+    /// `algorithm` using the specified compression `level` and the
+    /// specified trained `dictionary`, and load the compressed data into
+    /// the specified `output`, using the specified `factory` to supply data
+    /// buffers.  Return 0 on success, and non-zero otherwise.  If
+    /// `dictionary` is 0 or `algorithm` is not
+    /// `bmqt::CompressionAlgorithmType::e_ZSTD`, `dictionary` is ignored;
+    /// otherwise, `level` is ignored in favor of the level `dictionary` was
+    /// digested with.  Also, optionally specify an `errorStream` to record
+    /// details on any errors that may occur during this operation.
+    /// Finally, as an option specify `allocator` which will be used to
+    /// supply memory.  Note, that any existing data in the specified
+    /// `output` will be preserved.  Also note that the output can only be
+    /// decompressed if `dictionary` is registered in
+    /// `CompressionDictionaryRegistry::defaultRegistry()`.
+    static int compress(bdlbb::Blob*                         output,
+                        bdlbb::BlobBufferFactory*            factory,
+                        bmqt::CompressionAlgorithmType::Enum algorithm,
+                        int                                  level,
+                        const CompressionDictionary*         dictionary,
+                        const bdlbb::Blob&                   input,
+                        bsl::ostream*                        errorStream = 0,
+                        bslma::Allocator*                    allocator   = 0);
+
     /// Compress the data within the specified `input` as per the specified
     /// `algorithm`, and load the compressed data into the specified
     /// `output`, using the specified `factory` to supply data buffers.
@@ -92,13 +153,37 @@ struct Compression {
     /// specify an `errorStream` to record details on any errors that may
     /// occur during this operation. Also, optionally specify `allocator`
     /// which will be used to supply memory.  Also note, that any existing
-    /// data in the specified `output` will be preserved.
+    /// data in the specified `output` will be preserved.  Note that data
+    /// compressed with a dictionary is decompressed using the dictionary
+    /// registered under the same id in
+    /// `CompressionDictionaryRegistry::defaultRegistry()`, and that
+    /// decompression fails if there is no such dictionary.
     static int decompress(bdlbb::Blob*                         output,
                           bdlbb::BlobBufferFactory*            factory,
                           bmqt::CompressionAlgorithmType::Enum algorithm,
                           const bdlbb::Blob&                   input,
                           bsl::ostream*                        errorStream = 0,
                           bslma::Allocator*                    allocator = 0);
+
+    /// Decompress the data within the specified `input` as per the
+    /// specified `algorithm`, and load the uncompressed data into specified
+    /// `output`, using the specified `factory` to supply the needed data
+    /// buffers.  If the data was compressed with a dictionary having the
+    /// same id as the specified `dictionary`, use `dictionary` without
+    /// consulting `CompressionDictionaryRegistry::defaultRegistry()`;
+    /// otherwise, behave as the overload without `dictionary`.  Return 0 on
+    /// success, and non-zero otherwise.  Optionally specify an
+    /// `errorStream` to record details on any errors that may occur during
+    /// this operation.  Also, optionally specify `allocator` which will be
+    /// used to supply memory.  Note that any existing data in the specified
+    /// `output` will be preserved.
+    static int decompress(bdlbb::Blob*                         output,
+                          bdlbb::BlobBufferFactory*            factory,
+                          bmqt::CompressionAlgorithmType::Enum algorithm,
+                          const CompressionDictionary*         dictionary,
+                          const bdlbb::Blob&                   input,
+                          bsl::ostream*                        errorStream = 0,
+                          bslma::Allocator*                    allocator = 0);
 };
 
 // ======================
@@ -141,6 +226,70 @@ struct Compression_Impl {
                               const bdlbb::Blob&        input,
                               bsl::ostream*             errorStream,
                               bslma::Allocator*         allocator);
+
+    /// Compress the data within the specified `input` into a single
+    /// Zstandard frame, and load the compressed data into the specified
+    /// `output`, using the specified `factory` to supply data buffers.
+    /// Use the specified compression `level`, which is clamped to the range
+    /// supported by the library, unless the specified `dictionary` is not
+    /// 0, in which case the frame is compressed with `dictionary` at the
+    /// level it was digested with.  Specify an `errorStream` to record
+    /// details on any errors that may occur during this operation.  Return
+    /// 0 on success, and non-zero otherwise.  Note that the Zstandard
+    /// library manages its own working memory, so the specified `allocator`
+    /// is unused.
+    static int compressZstd(bdlbb::Blob*                 output,
+                            bdlbb::BlobBufferFactory*    factory,
+                            const bdlbb::Blob&           input,
+                            int                          level,
+                            const CompressionDictionary* dictionary,
+                            bsl::ostream*                errorStream,
+                            bslma::Allocator*            allocator);
+
+    /// Decompress the Zstandard frame within the specified `input`, and
+    /// load the uncompressed data into the specified `output` blob, using
+    /// the specified `factory` to supply needed data buffers.  If the frame
+    /// was compressed with a dictionary, use the specified `dictionary` if
+    /// it has the same id, or else the dictionary having that id in
+    /// `CompressionDictionaryRegistry::defaultRegistry()`, and fail if there
+    /// is no such dictionary.  Specify an `errorStream` to record details
+    /// on any errors that may occur during this operation.  Return 0 on
+    /// success, and non-zero otherwise.  Note that the specified
+    /// `allocator` is unused.
+    static int decompressZstd(bdlbb::Blob*                 output,
+                              bdlbb::BlobBufferFactory*    factory,
+                              const bdlbb::Blob&           input,
+                              const CompressionDictionary* dictionary,
+                              bsl::ostream*                errorStream,
+                              bslma::Allocator*            allocator);
+
+    /// Compress the data within the specified `input` into a single LZ4
+    /// frame, and load the compressed data into the specified `output`,
+    /// using the specified `factory` to supply data buffers.  Use the
+    /// specified compression `level`, with values less than 3 selecting
+    /// the fast mode and higher values the high compression mode.  Specify
+    /// an `errorStream` to record details on any errors that may occur
+    /// during this operation.  Finally, specify `allocator` which will be
+    /// used to supply the temporary output memory.  Return 0 on success,
+    /// and non-zero otherwise.
+    static int compressLz4(bdlbb::Blob*              output,
+                           bdlbb::BlobBufferFactory* factory,
+                           const bdlbb::Blob&        input,
+                           int                       level,
+                           bsl::ostream*             errorStream,
+                           bslma::Allocator*         allocator);
+
+    /// Decompress the LZ4 frame within the specified `input`, and load the
+    /// uncompressed data into the specified `output` blob, using the
+    /// specified `factory` to supply needed data buffers.  Specify an
+    /// `errorStream` to record details on any errors that may occur during
+    /// this operation.  Return 0 on success, and non-zero otherwise.  Note
+    /// that the specified `allocator` is unused.
+    static int decompressLz4(bdlbb::Blob*              output,
+                             bdlbb::BlobBufferFactory* factory,
+                             const bdlbb::Blob&        input,
+                             bsl::ostream*             errorStream,
+                             bslma::Allocator*         allocator);
 };
 
 }  // close package namespace
@@ -40,6 +40,7 @@
 #include <benchmark/benchmark.h>
 #endif
 #include <bsl_algorithm.h>
+#include <bsl_cstdio.h>
 #include <bsl_cstring.h>
 #include <bsl_iomanip.h>
 #include <bsl_ios.h>
@@ -384,6 +385,96 @@ static void eZlibCompressionRatioHelper(bsls::Types::Int64* inputSize,
     BMQTST_ASSERT_EQ(bdlbb::BlobUtil::compare(decompressed, input), 0);
 }
 
+/// Load into the specified `str` `len` bytes of JSON-like records, a
+/// representative sample of structured application payloads.
+static void generateJsonRecords(bsl::string* str, size_t len)
+{
+    static const char* k_STATUSES[] = {"NEW", "FILLED", "CANCELLED"};
+
+    char record[160];
+    for (unsigned int i = 0; str->length() < len; ++i) {
+        const int recordLength = bsl::snprintf(
+            record,
+            sizeof(record),
+            "{\"id\":%u,\"ticker\":\"TCK%03u\",\"price\":%u.%02u,"
+            "\"qty\":%u,\"status\":\"%s\"}\n",
+            i,
+            i % 500,
+            100 + rand() % 900,
+            rand() % 100,
+            rand() % 10000,
+            k_STATUSES[rand() % 3]);
+        str->append(record, recordLength);
+    }
+    str->resize(len);
+}
+
+/// Load into the specified `str` `len` bytes of repeated English text.
+static void generateRepetitiveText(bsl::string* str, size_t len)
+{
+    static const char k_TEXT[] = "The quick brown fox jumps over the lazy "
+                                 "dog while the message broker routes "
+                                 "messages to every subscribed consumer. ";
+
+    while (str->length() < len) {
+        str->append(k_TEXT, sizeof(k_TEXT) - 1);
+    }
+    str->resize(len);
+}
+
+/// Compress and then decompress the specified `data` using the specified
+/// `algorithm` and `level`, splitting the input blob into buffers of the
+/// specified `bufferSize`, and verify the roundtrip.  Load the compressed
+/// size into the specified `compressedSize`, and the time spent into the
+/// specified `compressionTime` and `decompressionTime`.
+static void compressDecompressHelper(
+    bsls::Types::Int64*                  compressedSize,
+    bsls::Types::Int64*                  compressionTime,
+    bsls::Types::Int64*                  decompressionTime,
+    const bsl::string&                   data,
+    bmqt::CompressionAlgorithmType::Enum algorithm,
+    int                                  level,
+    int                                  bufferSize)
+{
+    bmqu::MemOutStream             error(bmqtst::TestHelperUtil::allocator());
+    bdlbb::PooledBlobBufferFactory bufferFactory(
+        bufferSize,
+        bmqtst::TestHelperUtil::allocator());
+    bdlbb::Blob input(&bufferFactory, bmqtst::TestHelperUtil::allocator());
+    bdlbb::Blob compressed(&bufferFactory,
+                           bmqtst::TestHelperUtil::allocator());
+    bdlbb::Blob decompressed(&bufferFactory,
+                             bmqtst::TestHelperUtil::allocator());
+
+    bdlbb::BlobUtil::append(&input, data.data(), data.length());
+
+    bsls::Types::Int64 startTime = bsls::TimeUtil::getTimer();
+    int                rc        = bmqp::Compression::compress(
+        &compressed,
+        &bufferFactory,
+        algorithm,
+        level,
+        input,
+        &error,
+        bmqtst::TestHelperUtil::allocator());
+    *compressionTime = bsls::TimeUtil::getTimer() - startTime;
+    *compressedSize  = compressed.length();
+
+    BMQTST_ASSERT_EQ_D(error.str(), rc, 0);
+
+    startTime = bsls::TimeUtil::getTimer();
+    rc        = bmqp::Compression::decompress(&decompressed,
+                                       &bufferFactory,
+                                       algorithm,
+                                       compressed,
+                                       &error,
+                                       bmqtst::TestHelperUtil::allocator());
+    *decompressionTime = bsls::TimeUtil::getTimer() - startTime;
+
+    BMQTST_ASSERT_EQ_D(error.str(), rc, 0);
+    BMQTST_ASSERT_EQ(bdlbb::BlobUtil::compare(decompressed, input), 0);
+}
+
 }  // close unnamed namespace
 
 // ============================================================================
@@ -753,6 +844,121 @@ static void test3_compression_decompression_none()
     }
 }
 
+
+static void test4_compression_decompression_zstdLz4()
+// ------------------------------------------------------------------------
+// TEST USING ZSTD AND LZ4 ALGORITHM TYPES
+//
+// Concerns:
+//   - Data compressed with e_ZSTD or e_LZ4 decompresses to the original
+//     data, for empty, small and large inputs, at various levels.
+//   - Input and output blobs spanning many buffers are handled.
+//   - A truncated compressed blob is reported as an error.
+//
+// Plan:
+//   - Roundtrip various corpora through each algorithm and level, using
+//     a small blob buffer size to exercise multi-buffer blobs.
+//   - Drop the last bytes of a compressed blob and verify decompression
+//     fails.
+//
+// Testing:
+//   Compression::compress(..., level, ...)
+//   Compression::decompress
+//   Compression_Impl::compressZstd
+//   Compression_Impl::decompressZstd
+//   Compression_Impl::compressLz4
+//   Compression_Impl::decompressLz4
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("ZSTD AND LZ4 ALGORITHM TEST");
+
+    const bmqt::CompressionAlgorithmType::Enum k_ALGORITHMS[] = {
+        bmqt::CompressionAlgorithmType::e_ZLIB,
+        bmqt::CompressionAlgorithmType::e_ZSTD,
+        bmqt::CompressionAlgorithmType::e_LZ4};
+    const int k_LEVELS[]       = {bmqp::Compression::k_DEFAULT_LEVEL, 1, 9};
+    const int k_BUFFER_SIZES[] = {7, 1024, 64 * 1024};
+
+    bsl::vector<bsl::string> corpora(bmqtst::TestHelperUtil::allocator());
+    corpora.resize(5);
+    generateRandomString(&corpora[1], 11);
+    generateJsonRecords(&corpora[2], 4 * 1024);
+    generateRepetitiveText(&corpora[3], 100 * 1024);
+    generateRandomString(&corpora[4], 300 * 1024);
+
+    {
+        PV("ROUNDTRIP");
+
+        for (size_t a = 0; a < sizeof(k_ALGORITHMS) / sizeof(*k_ALGORITHMS);
+             ++a) {
+            for (size_t l = 0; l < sizeof(k_LEVELS) / sizeof(*k_LEVELS);
+                 ++l) {
+                for (size_t b = 0;
+                     b < sizeof(k_BUFFER_SIZES) / sizeof(*k_BUFFER_SIZES);
+                     ++b) {
+                    for (size_t c = 0; c < corpora.size(); ++c) {
+                        PVV(k_ALGORITHMS[a] << ", level " << k_LEVELS[l]
+                                            << ", buffer " << k_BUFFER_SIZES[b]
+                                            << ", size "
+                                            << corpora[c].length());
+
+                        bsls::Types::Int64 compressedSize    = 0;
+                        bsls::Types::Int64 compressionTime   = 0;
+                        bsls::Types::Int64 decompressionTime = 0;
+                        compressDecompressHelper(&compressedSize,
+                                                 &compressionTime,
+                                                 &decompressionTime,
+                                                 corpora[c],
+                                                 k_ALGORITHMS[a],
+                                                 k_LEVELS[l],
+                                                 k_BUFFER_SIZES[b]);
+                    }
+                }
+            }
+        }
+    }
+
+    {
+        PV("TRUNCATED INPUT");
+
+        bdlbb::PooledBlobBufferFactory bufferFactory(
+            1024,
+            bmqtst::TestHelperUtil::allocator());
+
+        for (size_t a = 1; a < sizeof(k_ALGORITHMS) / sizeof(*k_ALGORITHMS);
+             ++a) {
+            PVV(k_ALGORITHMS[a]);
+
+            bmqu::MemOutStream error(bmqtst::TestHelperUtil::allocator());
+            bdlbb::Blob compressed(&bufferFactory,
+                                   bmqtst::TestHelperUtil::allocator());
+            bdlbb::Blob decompressed(&bufferFactory,
+                                     bmqtst::TestHelperUtil::allocator());
+
+            int rc = bmqp::Compression::compress(
+                &compressed,
+                &bufferFactory,
+                k_ALGORITHMS[a],
+                corpora[3].data(),
+                static_cast<int>(corpora[3].length()),
+                &error,
+                bmqtst::TestHelperUtil::allocator());
+            BMQTST_ASSERT_EQ_D(error.str(), rc, 0);
+
+            compressed.setLength(compressed.length() - 4);
+
+            rc = bmqp::Compression::decompress(
+                &decompressed,
+                &bufferFactory,
+                k_ALGORITHMS[a],
+                compressed,
+                &error,
+                bmqtst::TestHelperUtil::allocator());
+            BMQTST_ASSERT_NE(rc, 0);
+        }
+    }
+}
+
 // ============================================================================
 //                              PERFORMANCE TESTS
 // ----------------------------------------------------------------------------
@@ -1020,6 +1226,95 @@ static void testN3_performanceCompressionRatio()
     }
 }
 
+static void testN4_compareAlgorithms()
+// ------------------------------------------------------------------------
+// BENCHMARK: COMPARE COMPRESSION ALGORITHMS
+//
+// Concerns:
+//   Compare the compression ratio and the compression and decompression
+//   throughput of the supported algorithms at their default level on
+//   representative payloads.
+//
+// Plan:
+//   - For JSON-like records, repetitive text and random alphanumeric
+//     data of a few sizes, time a number of roundtrips with each
+//     algorithm and report the ratio and throughput.
+//
+// Testing:
+//   Compression ratio and throughput of the ZLIB, ZSTD and LZ4
+//   implementations in a single thread environment.
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+    // The default allocator check fails in this test case because the
+    // output formatting utilizes the global allocator.
+
+    bmqtst::TestHelper::printTestName("BENCHMARK: COMPARE ALGORITHMS");
+
+    const bmqt::CompressionAlgorithmType::Enum k_ALGORITHMS[] = {
+        bmqt::CompressionAlgorithmType::e_ZLIB,
+        bmqt::CompressionAlgorithmType::e_ZSTD,
+        bmqt::CompressionAlgorithmType::e_LZ4};
+    const char*  k_CORPORA[] = {"json", "text", "random"};
+    const size_t k_SIZES[]   = {1024, 64 * 1024, 1024 * 1024};
+    const int    k_NUM_ITERS = 100;
+
+    bsl::cout << bsl::left << bsl::setw(8) << "Corpus" << bsl::setw(10)
+              << "Size" << bsl::setw(8) << "Algo" << bsl::setw(10)
+              << "Ratio" << bsl::setw(16) << "Compress/s" << "Decompress/s"
+              << '\n';
+
+    for (size_t c = 0; c < sizeof(k_CORPORA) / sizeof(*k_CORPORA); ++c) {
+        for (size_t s = 0; s < sizeof(k_SIZES) / sizeof(*k_SIZES); ++s) {
+            bsl::string data(bmqtst::TestHelperUtil::allocator());
+            switch (c) {
+            case 0: generateJsonRecords(&data, k_SIZES[s]); break;
+            case 1: generateRepetitiveText(&data, k_SIZES[s]); break;
+            default: generateRandomString(&data, k_SIZES[s]); break;
+            }
+
+            for (size_t a = 0;
+                 a < sizeof(k_ALGORITHMS) / sizeof(*k_ALGORITHMS);
+                 ++a) {
+                bsls::Types::Int64 compressedSize         = 0;
+                bsls::Types::Int64 compressionTotalTime   = 0;
+                bsls::Types::Int64 decompressionTotalTime = 0;
+                for (int i = 0; i < k_NUM_ITERS; ++i) {
+                    bsls::Types::Int64 compressionTime   = 0;
+                    bsls::Types::Int64 decompressionTime = 0;
+                    compressDecompressHelper(
+                        &compressedSize,
+                        &compressionTime,
+                        &decompressionTime,
+                        data,
+                        k_ALGORITHMS[a],
+                        bmqp::Compression::k_DEFAULT_LEVEL,
+                        4096);
+                    compressionTotalTime += compressionTime;
+                    decompressionTotalTime += decompressionTime;
+                }
+
+                const bsls::Types::Int64 totalBytes =
+                    static_cast<bsls::Types::Int64>(k_SIZES[s]) *
+                    k_NUM_ITERS * bdlt::TimeUnitRatio::k_NS_PER_S;
+
+                bsl::cout
+                    << bsl::left << bsl::setw(8) << k_CORPORA[c]
+                    << bsl::setw(10)
+                    << bmqu::PrintUtil::prettyBytes(k_SIZES[s])
+                    << bsl::setw(8) << k_ALGORITHMS[a] << bsl::setw(10)
+                    << static_cast<double>(k_SIZES[s]) / compressedSize
+                    << bsl::setw(16)
+                    << bmqu::PrintUtil::prettyBytes(totalBytes /
+                                                    compressionTotalTime)
+                    << bmqu::PrintUtil::prettyBytes(totalBytes /
+                                                    decompressionTotalTime)
+                    << '\n';
+            }
+        }
+    }
+}
+
 // Begin Benchmarking Tests
 #ifdef BMQTST_BENCHMARK_ENABLED
 static void testN1_performanceCompressionDecompressionDefault_GoogleBenchmark(
@@ -1114,6 +1409,7 @@ int main(int argc, char* argv[])
     case 1: test1_breathingTest(); break;
     case 2: test2_compression_cluster_message(); break;
     case 3: test3_compression_decompression_none(); break;
+    case 4: test4_compression_decompression_zstdLz4(); break;
     case -1:
         BMQTST_BENCHMARK_WITH_ARGS(
             testN1_performanceCompressionDecompressionDefault,
@@ -1128,6 +1424,7 @@ int main(int argc, char* argv[])
                                        ->Unit(benchmark::kMillisecond));
         break;
     case -3: testN3_performanceCompressionRatio(); break;
+    case -4: testN4_compareAlgorithms(); break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         bmqtst::TestHelperUtil::testStatus() = -1;
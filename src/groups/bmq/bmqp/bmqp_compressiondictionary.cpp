@@ -0,0 +1,246 @@
+// Copyright 2025 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// bmqp_compressiondictionary.cpp                                     -*-C++-*-
+#include <bmqp_compressiondictionary.h>
+
+#include <bmqscm_version.h>
+
+// BDE
+#include <bsl_algorithm.h>
+#include <bsl_utility.h>
+#include <bslma_default.h>
+#include <bslmt_lockguard.h>
+#include <bsls_assert.h>
+
+// ZSTD
+#include <zstd.h>
+
+namespace BloombergLP {
+namespace bmqp {
+
+namespace {
+
+/// Return the specified `dictionary` if it has the specified `data` of the
+/// specified `length` as content, and otherwise return 0 and record details
+/// in the specified `errorStream`, if any.
+const CompressionDictionary*
+checkContent(const CompressionDictionary* dictionary,
+             const char*                  data,
+             bsl::size_t                  length,
+             bsl::ostream*                errorStream)
+{
+    const bsl::vector<char>& content = dictionary->data();
+    if (content.size() == length &&
+        bsl::equal(content.begin(), content.end(), data)) {
+        return dictionary;  // RETURN
+    }
+
+    if (errorStream) {
+        (*errorStream) << "A different zstd dictionary with id "
+                       << dictionary->id() << " is already registered";
+    }
+    return 0;
+}
+
+}  // close unnamed namespace
+
+// ---------------------------
+// class CompressionDictionary
+// ---------------------------
+
+// CLASS METHODS
+unsigned int CompressionDictionary::dictionaryId(const char* data,
+                                                 bsl::size_t length)
+{
+    if (data == 0 || length == 0) {
+        return 0;  // RETURN
+    }
+
+    return ZSTD_getDictID_fromDict(data, length);
+}
+
+// CREATORS
+CompressionDictionary::CompressionDictionary(bslma::Allocator* allocator)
+: d_data(allocator)
+, d_id(0)
+, d_compressionDictionary_p(0)
+, d_decompressionDictionary_p(0)
+{
+    // NOTHING
+}
+
+CompressionDictionary::~CompressionDictionary()
+{
+    ZSTD_freeCDict(d_compressionDictionary_p);
+    ZSTD_freeDDict(d_decompressionDictionary_p);
+}
+
+// MANIPULATORS
+int CompressionDictionary::load(const char*   data,
+                                bsl::size_t   length,
+                                int           level,
+                                bsl::ostream* errorStream)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(!isValid());
+
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS                    = 0,
+        rc_NOT_A_DICTIONARY           = -1,
+        rc_COMPRESSION_DICT_FAILURE   = -2,
+        rc_DECOMPRESSION_DICT_FAILURE = -3
+    };
+
+    const unsigned int id = dictionaryId(data, length);
+    if (id == 0) {
+        if (errorStream) {
+            (*errorStream) << "Not a trained zstd dictionary [length: "
+                           << length << "]";
+        }
+        return rc_NOT_A_DICTIONARY;  // RETURN
+    }
+
+    d_data.assign(data, data + length);
+
+    // Note that referencing 'd_data' instead of copying it requires the
+    // experimental zstd API, which is not available in all distributions.
+    d_compressionDictionary_p = ZSTD_createCDict(d_data.data(),
+                                                 d_data.size(),
+                                                 level);
+    if (d_compressionDictionary_p == 0) {
+        if (errorStream) {
+            (*errorStream) << "Failed to digest zstd dictionary " << id
+                           << " for compression";
+        }
+        d_data.clear();
+        return rc_COMPRESSION_DICT_FAILURE;  // RETURN
+    }
+
+    d_decompressionDictionary_p = ZSTD_createDDict(d_data.data(),
+                                                   d_data.size());
+    if (d_decompressionDictionary_p == 0) {
+        if (errorStream) {
+            (*errorStream) << "Failed to digest zstd dictionary " << id
+                           << " for decompression";
+        }
+        ZSTD_freeCDict(d_compressionDictionary_p);
+        d_compressionDictionary_p = 0;
+        d_data.clear();
+        return rc_DECOMPRESSION_DICT_FAILURE;  // RETURN
+    }
+
+    d_id = id;
+
+    return rc_SUCCESS;
+}
+
+// -----------------------------------
+// class CompressionDictionaryRegistry
+// -----------------------------------
+
+// CLASS METHODS
+CompressionDictionaryRegistry& CompressionDictionaryRegistry::defaultRegistry()
+{
+    // Dictionaries are registered from the SDK and the broker at runtime, and
+    // must outlive any of their users: use the global allocator.
+    static CompressionDictionaryRegistry s_registry(
+        bslma::Default::globalAllocator());
+
+    return s_registry;
+}
+
+// CREATORS
+CompressionDictionaryRegistry::CompressionDictionaryRegistry(
+    bslma::Allocator* allocator)
+: d_allocator_p(bslma::Default::allocator(allocator))
+, d_mutex()
+, d_dictionaries(d_allocator_p)
+, d_retired(d_allocator_p)
+{
+    // NOTHING
+}
+
+// MANIPULATORS
+const CompressionDictionary* CompressionDictionaryRegistry::registerDictionary(
+    const char*   data,
+    bsl::size_t   length,
+    bsl::ostream* errorStream)
+{
+    const unsigned int id = CompressionDictionary::dictionaryId(data, length);
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+
+        DictionaryMap::const_iterator it = d_dictionaries.find(id);
+        if (it != d_dictionaries.end()) {
+            return checkContent(it->second.get(),
+                                data,
+                                length,
+                                errorStream);  // RETURN
+        }
+    }  // UNLOCK
+
+    // Digesting the dictionary is expensive, so do it outside of the lock.
+    bsl::shared_ptr<CompressionDictionary> dictionary =
+        bsl::allocate_shared<CompressionDictionary>(d_allocator_p);
+    if (dictionary->load(data,
+                         length,
+                         CompressionDictionary::k_DEFAULT_LEVEL,
+                         errorStream) != 0) {
+        return 0;  // RETURN
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+
+    // If another thread concurrently registered a dictionary with the same
+    // id, keep the one which was inserted first.
+    bsl::pair<DictionaryMap::iterator, bool> result = d_dictionaries.insert(
+        bsl::make_pair(id, dictionary));
+    if (!result.second) {
+        return checkContent(result.first->second.get(),
+                            data,
+                            length,
+                            errorStream);  // RETURN
+    }
+
+    return dictionary.get();
+}
+
+void CompressionDictionaryRegistry::clear()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+
+    for (DictionaryMap::const_iterator it = d_dictionaries.begin();
+         it != d_dictionaries.end();
+         ++it) {
+        d_retired.push_back(it->second);
+    }
+    d_dictionaries.clear();
+}
+
+// ACCESSORS
+const CompressionDictionary*
+CompressionDictionaryRegistry::lookup(unsigned int id) const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+
+    DictionaryMap::const_iterator it = d_dictionaries.find(id);
+    return it == d_dictionaries.end() ? 0 : it->second.get();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
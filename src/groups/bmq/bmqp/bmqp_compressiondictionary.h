@@ -0,0 +1,290 @@
+// Copyright 2025 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// bmqp_compressiondictionary.h                                       -*-C++-*-
+#ifndef INCLUDED_BMQP_COMPRESSIONDICTIONARY
+#define INCLUDED_BMQP_COMPRESSIONDICTIONARY
+
+//@PURPOSE: Provide trained compression dictionaries and their registry.
+//
+//@CLASSES:
+//  bmqp::CompressionDictionary        : digested zstd dictionary
+//  bmqp::CompressionDictionaryRegistry: registry of dictionaries by id
+//
+//@SEE_ALSO: bmqp::Compression
+//
+//@DESCRIPTION: This component defines a mechanism,
+// 'bmqp::CompressionDictionary', holding a trained zstd dictionary (as
+// produced by 'zstd --train') digested once for both compression and
+// decompression, and a mechanism, 'bmqp::CompressionDictionaryRegistry',
+// mapping dictionary ids to dictionaries.
+//
+// Small messages of a given domain typically share most of their structure,
+// so that compressing them individually yields little to no gain.  A
+// dictionary trained on a sample of such messages primes the compressor with
+// that shared structure, which lets messages of a few hundred bytes compress
+// several times.  The dictionary of a domain is distributed by the broker in
+// the 'OpenQueueResponse', and the SDK registers it in the default registry.
+//
+/// Dictionary Identification
+///-------------------------
+// Messages compressed with a dictionary keep the 'e_ZSTD' compression
+// algorithm type in their header: the id of the dictionary is recorded by
+// zstd in the header of each compressed frame, and
+// 'bmqp::Compression::decompress' uses it to look up the dictionary in the
+// default registry.  Therefore, only dictionaries in the zstd dictionary
+// format, which carry a non-zero id, are accepted; raw content dictionaries
+// are rejected.  As the id alone identifies a dictionary, a registry rejects
+// a dictionary whose id is already registered with a different content, so
+// that two domains configured with conflicting dictionaries never decompress
+// each other's messages with the wrong dictionary.
+//
+/// Lifetime
+///--------
+// Pointers to the dictionaries of a registry are held by queues and event
+// builders for as long as they are in use, so dictionaries are never freed
+// before their registry is destroyed, even when the registry is cleared.
+//
+/// Thread Safety
+///-------------
+// 'bmqp::CompressionDictionary' is immutable once loaded, and can be used
+// concurrently from multiple threads.  'bmqp::CompressionDictionaryRegistry'
+// is fully thread-safe.
+
+// BDE
+#include <bsl_cstddef.h>
+#include <bsl_memory.h>
+#include <bsl_ostream.h>
+#include <bsl_unordered_map.h>
+#include <bsl_vector.h>
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bslmt_mutex.h>
+
+struct ZSTD_CDict_s;
+struct ZSTD_DDict_s;
+
+namespace BloombergLP {
+
+namespace bmqp {
+
+// ===========================
+// class CompressionDictionary
+// ===========================
+
+/// Mechanism holding a trained zstd dictionary, digested for compression and
+/// decompression.
+class CompressionDictionary {
+  private:
+    // DATA
+
+    /// Content of the dictionary.
+    bsl::vector<char> d_data;
+
+    /// Id of the dictionary, or 0 if no dictionary is loaded.
+    unsigned int d_id;
+
+    /// Dictionary digested for compression, owned.
+    ZSTD_CDict_s* d_compressionDictionary_p;
+
+    /// Dictionary digested for decompression, owned.
+    ZSTD_DDict_s* d_decompressionDictionary_p;
+
+  private:
+    // NOT IMPLEMENTED
+    CompressionDictionary(const CompressionDictionary&);
+    CompressionDictionary& operator=(const CompressionDictionary&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(CompressionDictionary,
+                                   bslma::UsesBslmaAllocator)
+
+    // CONSTANTS
+
+    /// Compression level the dictionary is digested with by default.
+    static const int k_DEFAULT_LEVEL = 3;
+
+    // CLASS METHODS
+
+    /// Return the id of the zstd dictionary in the specified `data` of the
+    /// specified `length`, or 0 if `data` is not in the zstd dictionary
+    /// format.
+    static unsigned int dictionaryId(const char* data, bsl::size_t length);
+
+    // CREATORS
+
+    /// Create an empty dictionary.  Optionally specify an `allocator` used
+    /// to supply memory.  If `allocator` is 0, the default memory allocator
+    /// is used.  Note that the digested dictionaries are allocated by zstd.
+    explicit CompressionDictionary(bslma::Allocator* allocator = 0);
+
+    /// Destroy this object.
+    ~CompressionDictionary();
+
+    // MANIPULATORS
+
+    /// Load into this object the zstd dictionary in the specified `data` of
+    /// the specified `length`, digested for compression at the optionally
+    /// specified `level`.  Return 0 on success, and a non-zero value
+    /// otherwise, in which case this object is left empty.  Optionally
+    /// specify an `errorStream` to record details on any errors.  The
+    /// behavior is undefined unless this object is empty.
+    int load(const char*   data,
+             bsl::size_t   length,
+             int           level       = k_DEFAULT_LEVEL,
+             bsl::ostream* errorStream = 0);
+
+    // ACCESSORS
+
+    /// Return true if a dictionary is loaded into this object, and false
+    /// otherwise.
+    bool isValid() const;
+
+    /// Return the id of the dictionary, or 0 if this object is empty.
+    unsigned int id() const;
+
+    /// Return the content of the dictionary.
+    const bsl::vector<char>& data() const;
+
+    /// Return the dictionary digested for compression, or 0 if this object
+    /// is empty.
+    const ZSTD_CDict_s* compressionDictionary() const;
+
+    /// Return the dictionary digested for decompression, or 0 if this
+    /// object is empty.
+    const ZSTD_DDict_s* decompressionDictionary() const;
+};
+
+// ===================================
+// class CompressionDictionaryRegistry
+// ===================================
+
+/// Thread-safe registry of compression dictionaries, keyed by their id.
+/// Pointers returned by `registerDictionary` and `lookup` remain valid for
+/// the lifetime of the registry.
+class CompressionDictionaryRegistry {
+  private:
+    // PRIVATE TYPES
+    typedef bsl::unordered_map<unsigned int,
+                               bsl::shared_ptr<CompressionDictionary> >
+        DictionaryMap;
+
+    // DATA
+
+    /// Allocator used to supply memory.
+    bslma::Allocator* d_allocator_p;
+
+    /// Mutex protecting `d_dictionaries`.
+    mutable bslmt::Mutex d_mutex;
+
+    /// Registered dictionaries, by id.
+    DictionaryMap d_dictionaries;
+
+    /// Dictionaries removed from `d_dictionaries` by `clear`, kept alive
+    /// for the users still holding them.
+    bsl::vector<bsl::shared_ptr<CompressionDictionary> > d_retired;
+
+  private:
+    // NOT IMPLEMENTED
+    CompressionDictionaryRegistry(const CompressionDictionaryRegistry&);
+    CompressionDictionaryRegistry&
+    operator=(const CompressionDictionaryRegistry&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(CompressionDictionaryRegistry,
+                                   bslma::UsesBslmaAllocator)
+
+    // CLASS METHODS
+
+    /// Return a reference to the process-wide registry consulted by
+    /// `bmqp::Compression::decompress`.
+    static CompressionDictionaryRegistry& defaultRegistry();
+
+    // CREATORS
+
+    /// Create an empty registry.  Optionally specify an `allocator` used to
+    /// supply memory.  If `allocator` is 0, the default memory allocator is
+    /// used.
+    explicit CompressionDictionaryRegistry(bslma::Allocator* allocator = 0);
+
+    // MANIPULATORS
+
+    /// Register the zstd dictionary in the specified `data` of the specified
+    /// `length` and return a pointer to it, or return 0 and record details
+    /// in the optionally specified `errorStream` if `data` is not a valid
+    /// zstd dictionary.  If a dictionary with the same id is already
+    /// registered, return that dictionary if it has the same content, and
+    /// return 0 and record details in `errorStream` otherwise.
+    const CompressionDictionary* registerDictionary(
+        const char*   data,
+        bsl::size_t   length,
+        bsl::ostream* errorStream = 0);
+
+    /// Remove all dictionaries from this registry, so that they can no
+    /// longer be looked up.  Note that the removed dictionaries are not
+    /// freed, and that pointers previously returned by this object remain
+    /// valid.
+    void clear();
+
+    // ACCESSORS
+
+    /// Return a pointer to the dictionary having the specified `id`, or 0
+    /// if no such dictionary is registered.
+    const CompressionDictionary* lookup(unsigned int id) const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// ---------------------------
+// class CompressionDictionary
+// ---------------------------
+
+// ACCESSORS
+inline bool CompressionDictionary::isValid() const
+{
+    return d_id != 0;
+}
+
+inline unsigned int CompressionDictionary::id() const
+{
+    return d_id;
+}
+
+inline const bsl::vector<char>& CompressionDictionary::data() const
+{
+    return d_data;
+}
+
+inline const ZSTD_CDict_s*
+CompressionDictionary::compressionDictionary() const
+{
+    return d_compressionDictionary_p;
+}
+
+inline const ZSTD_DDict_s*
+CompressionDictionary::decompressionDictionary() const
+{
+    return d_decompressionDictionary_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
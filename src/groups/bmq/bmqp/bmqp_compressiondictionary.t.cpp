@@ -0,0 +1,437 @@
+// Copyright 2025 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// bmqp_compressiondictionary.t.cpp                                   -*-C++-*-
+#include <bmqp_compressiondictionary.h>
+
+// BMQ
+#include <bmqp_compression.h>
+#include <bmqt_compressionalgorithmtype.h>
+
+#include <bmqu_memoutstream.h>
+
+// BDE
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+#include <bdlbb_pooledblobbufferfactory.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+// ZSTD
+#include <zdict.h>
+
+// TEST DRIVER
+#include <bmqtst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+namespace {
+
+/// Load into the specified `samples` the specified `numSamples` small JSON
+/// records sharing the same structure, as typically published to a domain.
+void generateSamples(bsl::vector<bsl::string>* samples, int numSamples)
+{
+    static const char* k_SIDES[]  = {"BUY", "SELL"};
+    static const char* k_VENUES[] = {"XNYS", "XNAS", "XLON", "XPAR", "XTKS"};
+
+    for (int i = 0; i < numSamples; ++i) {
+        char buffer[256];
+        bsl::snprintf(buffer,
+                      sizeof(buffer),
+                      "{\"orderId\":%d,\"account\":\"ACC%04d\","
+                      "\"side\":\"%s\",\"venue\":\"%s\",\"quantity\":%d,"
+                      "\"price\":%d.%02d,\"status\":\"NEW\","
+                      "\"timeInForce\":\"DAY\"}",
+                      100000 + i,
+                      bsl::rand() % 10000,
+                      k_SIDES[bsl::rand() % 2],
+                      k_VENUES[bsl::rand() % 5],
+                      (bsl::rand() % 100 + 1) * 100,
+                      bsl::rand() % 1000,
+                      bsl::rand() % 100);
+        samples->push_back(bsl::string(buffer,
+                                       bmqtst::TestHelperUtil::allocator()));
+    }
+}
+
+/// Load into the specified `dictionary` a zstd dictionary of at most the
+/// specified `capacity` bytes trained on the specified `samples`.
+void trainDictionary(bsl::vector<char>*              dictionary,
+                     const bsl::vector<bsl::string>& samples,
+                     bsl::size_t                     capacity)
+{
+    bsl::string              buffer(bmqtst::TestHelperUtil::allocator());
+    bsl::vector<bsl::size_t> sizes(bmqtst::TestHelperUtil::allocator());
+    for (bsl::size_t i = 0; i < samples.size(); ++i) {
+        buffer.append(samples[i]);
+        sizes.push_back(samples[i].size());
+    }
+
+    dictionary->resize(capacity);
+    const bsl::size_t size = ZDICT_trainFromBuffer(
+        dictionary->data(),
+        dictionary->size(),
+        buffer.data(),
+        sizes.data(),
+        static_cast<unsigned int>(sizes.size()));
+    BSLS_ASSERT_OPT(!ZDICT_isError(size));
+
+    dictionary->resize(size);
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   - A default constructed dictionary is empty.
+//   - Data which is not a trained zstd dictionary is rejected.
+//
+// Testing:
+//   CompressionDictionary(bslma::Allocator *allocator = 0);
+//   static unsigned int dictionaryId(const char *data, size_t length);
+//   int load(const char *, size_t, int, bsl::ostream *);
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("BREATHING TEST");
+
+    bmqp::CompressionDictionary obj(bmqtst::TestHelperUtil::allocator());
+    BMQTST_ASSERT(!obj.isValid());
+    BMQTST_ASSERT_EQ(obj.id(), 0u);
+    BMQTST_ASSERT(obj.data().empty());
+    BMQTST_ASSERT(obj.compressionDictionary() == 0);
+    BMQTST_ASSERT(obj.decompressionDictionary() == 0);
+
+    // A raw content dictionary has no id
+    const char k_RAW[] = "{\"orderId\":,\"account\":\"ACC\",\"side\":\"BUY\"}";
+    BMQTST_ASSERT_EQ(bmqp::CompressionDictionary::dictionaryId(k_RAW,
+                                                               sizeof(k_RAW)),
+                     0u);
+    BMQTST_ASSERT_EQ(bmqp::CompressionDictionary::dictionaryId(0, 0), 0u);
+
+    bmqu::MemOutStream error(bmqtst::TestHelperUtil::allocator());
+    BMQTST_ASSERT_NE(obj.load(k_RAW,
+                              sizeof(k_RAW),
+                              bmqp::CompressionDictionary::k_DEFAULT_LEVEL,
+                              &error),
+                     0);
+    BMQTST_ASSERT(!error.str().empty());
+    BMQTST_ASSERT(!obj.isValid());
+    BMQTST_ASSERT(obj.data().empty());
+}
+
+static void test2_load()
+// ------------------------------------------------------------------------
+// LOAD
+//
+// Concerns:
+//   - A trained dictionary is loaded and digested, and its id is the one
+//     recorded by the trainer.
+//
+// Testing:
+//   int load(const char *, size_t, int, bsl::ostream *);
+//   unsigned int id() const;
+//   const bsl::vector<char>& data() const;
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("LOAD");
+
+    bsl::vector<bsl::string> samples(bmqtst::TestHelperUtil::allocator());
+    bsl::vector<char>        data(bmqtst::TestHelperUtil::allocator());
+    generateSamples(&samples, 2000);
+    trainDictionary(&data, samples, 4 * 1024);
+
+    const unsigned int id = ZDICT_getDictID(data.data(), data.size());
+    BMQTST_ASSERT_NE(id, 0u);
+    BMQTST_ASSERT_EQ(
+        bmqp::CompressionDictionary::dictionaryId(data.data(), data.size()),
+        id);
+
+    bmqp::CompressionDictionary obj(bmqtst::TestHelperUtil::allocator());
+    bmqu::MemOutStream          error(bmqtst::TestHelperUtil::allocator());
+    BMQTST_ASSERT_EQ_D(error.str(),
+                       obj.load(data.data(),
+                                data.size(),
+                                bmqp::CompressionDictionary::k_DEFAULT_LEVEL,
+                                &error),
+                       0);
+    BMQTST_ASSERT(obj.isValid());
+    BMQTST_ASSERT_EQ(obj.id(), id);
+    BMQTST_ASSERT(obj.data() == data);
+    BMQTST_ASSERT(obj.compressionDictionary() != 0);
+    BMQTST_ASSERT(obj.decompressionDictionary() != 0);
+}
+
+static void test3_registry()
+// ------------------------------------------------------------------------
+// REGISTRY
+//
+// Concerns:
+//   - Registering a dictionary makes it available by its id.
+//   - Registering the same dictionary twice returns the same object.
+//   - Invalid dictionaries are not registered.
+//   - A dictionary whose id is registered with a different content is
+//     rejected.
+//   - 'clear' removes all dictionaries, but does not free them.
+//
+// Testing:
+//   const CompressionDictionary *registerDictionary(...);
+//   const CompressionDictionary *lookup(unsigned int id) const;
+//   void clear();
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("REGISTRY");
+
+    bsl::vector<bsl::string> samples(bmqtst::TestHelperUtil::allocator());
+    bsl::vector<char>        data(bmqtst::TestHelperUtil::allocator());
+    generateSamples(&samples, 2000);
+    trainDictionary(&data, samples, 4 * 1024);
+
+    bmqp::CompressionDictionaryRegistry obj(
+        bmqtst::TestHelperUtil::allocator());
+    const unsigned int id = bmqp::CompressionDictionary::dictionaryId(
+        data.data(),
+        data.size());
+
+    BMQTST_ASSERT(obj.lookup(id) == 0);
+
+    const bmqp::CompressionDictionary* dictionary =
+        obj.registerDictionary(data.data(), data.size());
+    BMQTST_ASSERT(dictionary != 0);
+    BMQTST_ASSERT_EQ(dictionary->id(), id);
+    BMQTST_ASSERT_EQ(obj.lookup(id), dictionary);
+    BMQTST_ASSERT_EQ(obj.registerDictionary(data.data(), data.size()),
+                     dictionary);
+
+    const char         k_RAW[] = "not a dictionary";
+    bmqu::MemOutStream error(bmqtst::TestHelperUtil::allocator());
+    BMQTST_ASSERT(obj.registerDictionary(k_RAW, sizeof(k_RAW), &error) == 0);
+    BMQTST_ASSERT(!error.str().empty());
+    BMQTST_ASSERT(obj.lookup(0) == 0);
+
+    // Same id, different content
+    bsl::vector<char> conflicting(data, bmqtst::TestHelperUtil::allocator());
+    conflicting.back() = static_cast<char>(~conflicting.back());
+    BMQTST_ASSERT_EQ(
+        bmqp::CompressionDictionary::dictionaryId(conflicting.data(),
+                                                  conflicting.size()),
+        id);
+    error.reset();
+    BMQTST_ASSERT(obj.registerDictionary(conflicting.data(),
+                                         conflicting.size(),
+                                         &error) == 0);
+    BMQTST_ASSERT(!error.str().empty());
+    BMQTST_ASSERT_EQ(obj.lookup(id), dictionary);
+
+    obj.clear();
+    BMQTST_ASSERT(obj.lookup(id) == 0);
+
+    // Dictionaries returned before 'clear' are still usable.
+    BMQTST_ASSERT(dictionary->isValid());
+    BMQTST_ASSERT_EQ(dictionary->id(), id);
+    BMQTST_ASSERT(dictionary->data() == data);
+
+    // After 'clear', a dictionary with a previously registered id, whatever
+    // its content, can be registered.
+    const bmqp::CompressionDictionary* other =
+        obj.registerDictionary(conflicting.data(), conflicting.size());
+    BMQTST_ASSERT(other != 0);
+    BMQTST_ASSERT(other != dictionary);
+    BMQTST_ASSERT_EQ(obj.lookup(id), other);
+}
+
+static void test4_compressDecompress()
+// ------------------------------------------------------------------------
+// COMPRESS DECOMPRESS
+//
+// Concerns:
+//   - Small messages compressed with a dictionary are decompressed using
+//     the dictionary registered in the default registry.
+//   - Small messages compress better with a dictionary than without.
+//   - Decompression fails if the dictionary is not registered, unless it
+//     is provided by the caller.
+//
+// Testing:
+//   Compression::compress(..., const CompressionDictionary *, ...);
+//   Compression::decompress(...);
+//   Compression::decompress(..., const CompressionDictionary *, ...);
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("COMPRESS DECOMPRESS");
+
+    bsl::vector<bsl::string> samples(bmqtst::TestHelperUtil::allocator());
+    bsl::vector<char>        data(bmqtst::TestHelperUtil::allocator());
+    generateSamples(&samples, 2100);
+    trainDictionary(&data, samples, 4 * 1024);
+
+    bmqp::CompressionDictionaryRegistry& registry =
+        bmqp::CompressionDictionaryRegistry::defaultRegistry();
+    const bmqp::CompressionDictionary* dictionary =
+        registry.registerDictionary(data.data(), data.size());
+    BMQTST_ASSERT(dictionary != 0);
+
+    bdlbb::PooledBlobBufferFactory factory(
+        1024,
+        bmqtst::TestHelperUtil::allocator());
+
+    int totalSize           = 0;
+    int totalPlainSize      = 0;
+    int totalDictionarySize = 0;
+
+    // Use samples not part of the training set.
+    for (bsl::size_t i = 2000; i < samples.size(); ++i) {
+        bdlbb::Blob input(&factory, bmqtst::TestHelperUtil::allocator());
+        bdlbb::BlobUtil::append(&input,
+                                samples[i].data(),
+                                static_cast<int>(samples[i].size()));
+
+        bdlbb::Blob plain(&factory, bmqtst::TestHelperUtil::allocator());
+        bdlbb::Blob compressed(&factory, bmqtst::TestHelperUtil::allocator());
+        bdlbb::Blob decompressed(&factory,
+                                 bmqtst::TestHelperUtil::allocator());
+        bmqu::MemOutStream error(bmqtst::TestHelperUtil::allocator());
+
+        int rc = bmqp::Compression::compress(
+            &plain,
+            &factory,
+            bmqt::CompressionAlgorithmType::e_ZSTD,
+            bmqp::Compression::k_DEFAULT_LEVEL,
+            input,
+            &error,
+            bmqtst::TestHelperUtil::allocator());
+        BMQTST_ASSERT_EQ_D(error.str(), rc, 0);
+
+        rc = bmqp::Compression::compress(
+            &compressed,
+            &factory,
+            bmqt::CompressionAlgorithmType::e_ZSTD,
+            bmqp::Compression::k_DEFAULT_LEVEL,
+            dictionary,
+            input,
+            &error,
+            bmqtst::TestHelperUtil::allocator());
+        BMQTST_ASSERT_EQ_D(error.str(), rc, 0);
+
+        rc = bmqp::Compression::decompress(
+            &decompressed,
+            &factory,
+            bmqt::CompressionAlgorithmType::e_ZSTD,
+            compressed,
+            &error,
+            bmqtst::TestHelperUtil::allocator());
+        BMQTST_ASSERT_EQ_D(error.str(), rc, 0);
+        BMQTST_ASSERT_EQ_D(i,
+                           bdlbb::BlobUtil::compare(decompressed, input),
+                           0);
+
+        totalSize += input.length();
+        totalPlainSize += plain.length();
+        totalDictionarySize += compressed.length();
+    }
+
+    PV("Input: " << totalSize << ", zstd: " << totalPlainSize
+                 << ", zstd with dictionary: " << totalDictionarySize);
+    BMQTST_ASSERT_LT(totalDictionarySize, totalPlainSize);
+    BMQTST_ASSERT_LT(totalDictionarySize, totalSize);
+
+    // Unknown dictionary
+    {
+        bdlbb::Blob input(&factory, bmqtst::TestHelperUtil::allocator());
+        bdlbb::BlobUtil::append(&input,
+                                samples[0].data(),
+                                static_cast<int>(samples[0].size()));
+
+        bdlbb::Blob compressed(&factory, bmqtst::TestHelperUtil::allocator());
+        bdlbb::Blob decompressed(&factory,
+                                 bmqtst::TestHelperUtil::allocator());
+        bmqu::MemOutStream error(bmqtst::TestHelperUtil::allocator());
+
+        int rc = bmqp::Compression::compress(
+            &compressed,
+            &factory,
+            bmqt::CompressionAlgorithmType::e_ZSTD,
+            bmqp::Compression::k_DEFAULT_LEVEL,
+            dictionary,
+            input,
+            &error,
+            bmqtst::TestHelperUtil::allocator());
+        BMQTST_ASSERT_EQ_D(error.str(), rc, 0);
+
+        registry.clear();
+
+        rc = bmqp::Compression::decompress(
+            &decompressed,
+            &factory,
+            bmqt::CompressionAlgorithmType::e_ZSTD,
+            compressed,
+            &error,
+            bmqtst::TestHelperUtil::allocator());
+        BMQTST_ASSERT_NE(rc, 0);
+        BMQTST_ASSERT(!error.str().empty());
+        PV("Error: " << error.str());
+
+        // The dictionary provided by the caller is used without consulting
+        // the registry.
+        error.reset();
+        decompressed.removeAll();
+        rc = bmqp::Compression::decompress(
+            &decompressed,
+            &factory,
+            bmqt::CompressionAlgorithmType::e_ZSTD,
+            dictionary,
+            compressed,
+            &error,
+            bmqtst::TestHelperUtil::allocator());
+        BMQTST_ASSERT_EQ_D(error.str(), rc, 0);
+        BMQTST_ASSERT_EQ(bdlbb::BlobUtil::compare(decompressed, input), 0);
+    }
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(bmqtst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 4: test4_compressDecompress(); break;
+    case 3: test3_registry(); break;
+    case 2: test2_load(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        bmqtst::TestHelperUtil::testStatus() = -1;
+    } break;
+    }
+
+    // The default registry allocates from the global allocator.
+    TEST_EPILOG(bmqtst::TestHelper::e_CHECK_DEF_ALLOC);
+}
@@ -21,8 +21,17 @@
 // BDE
 #include <ball_log.h>
 #include <bdlde_crc32c.h>
+#include <bsl_cstring.h>
 #include <bsla_maybeunused.h>
+#include <bsls_assert.h>
 #include <bsls_performancehint.h>
+#include <bsls_platform.h>
+
+#if defined(BSLS_PLATFORM_CPU_X86_64) &&                                      \
+    (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))
+#define BMQP_CRC32C_SSE42_KERNEL 1
+#include <nmmintrin.h>
+#endif
 
 namespace BloombergLP {
 namespace bmqp {
@@ -31,6 +40,263 @@ namespace {
 
 BSLA_MAYBE_UNUSED const char k_LOG_CATEGORY[] = "BMQP.CRC32C";
 
+/// Castagnoli polynomial, in reflected bit order.
+const unsigned int k_POLY = 0x82F63B78;
+
+/// Length (in bytes) of each of the three streams of a 'long' interleaved
+/// block.
+const unsigned int k_LONG_LANE = 8192;
+
+/// Length (in bytes) of each of the three streams of a 'short' interleaved
+/// block.
+const unsigned int k_SHORT_LANE = 256;
+
+/// Return the product of the specified `a` and `b` polynomials modulo the
+/// Castagnoli polynomial, all in reflected bit order.
+unsigned int multModP(unsigned int a, unsigned int b)
+{
+    unsigned int mask    = 1u << 31;
+    unsigned int product = 0;
+    while (mask) {
+        if (a & mask) {
+            product ^= b;
+            if ((a & (mask - 1)) == 0) {
+                break;  // BREAK
+            }
+        }
+        mask >>= 1;
+        b = (b & 1) ? (b >> 1) ^ k_POLY : b >> 1;
+    }
+    return product;
+}
+
+/// Return the polynomial `x^(8 * numBytes)` modulo the Castagnoli
+/// polynomial, in reflected bit order.  Multiplying a CRC register by this
+/// value is equivalent to feeding `numBytes` zero bytes to the register.
+unsigned int shiftOperator(bsls::Types::Uint64 numBytes)
+{
+    unsigned int result = 1u << 31;  // x^0
+    unsigned int x2k    = 1u << 30;  // x^1
+
+    // x^8
+    for (int i = 0; i < 3; ++i) {
+        x2k = multModP(x2k, x2k);
+    }
+
+    while (numBytes) {
+        if (numBytes & 1) {
+            result = multModP(x2k, result);
+        }
+        numBytes >>= 1;
+        x2k = multModP(x2k, x2k);
+    }
+    return result;
+}
+
+// =================
+// struct ShiftTable
+// =================
+
+/// Byte-indexed tables to multiply a CRC register by a fixed
+/// `shiftOperator`, i.e. to advance it over a fixed number of zero bytes
+/// with four table lookups.
+struct ShiftTable {
+    // DATA
+    unsigned int d_table[4][256];
+
+    // MANIPULATORS
+
+    /// Populate this table to shift by the specified `numBytes`.
+    void initialize(unsigned int numBytes)
+    {
+        const unsigned int op = shiftOperator(numBytes);
+        for (unsigned int i = 0; i < 4; ++i) {
+            for (unsigned int v = 0; v < 256; ++v) {
+                d_table[i][v] = multModP(op, v << (8 * i));
+            }
+        }
+    }
+
+    // ACCESSORS
+
+    /// Return the specified `crc` register advanced over the number of zero
+    /// bytes this table was initialized with.
+    unsigned int shift(unsigned int crc) const
+    {
+        return d_table[0][crc & 0xFF] ^ d_table[1][(crc >> 8) & 0xFF] ^
+               d_table[2][(crc >> 16) & 0xFF] ^ d_table[3][crc >> 24];
+    }
+};
+
+/// Signature of a function updating the specified raw (i.e. not
+/// pre/post-conditioned) CRC register with the specified `length` bytes
+/// from the specified `data`, and returning the new register value.
+typedef unsigned int (*UpdateFn)(unsigned int         reg,
+                                 const unsigned char* data,
+                                 unsigned int         length);
+
+/// Software implementation of `UpdateFn`.
+unsigned int updateSoftware(unsigned int         reg,
+                            const unsigned char* data,
+                            unsigned int         length)
+{
+    return ~bdlde::Crc32c_Impl::calculateSoftware(data, length, ~reg);
+}
+
+#ifdef BMQP_CRC32C_SSE42_KERNEL
+
+/// Return the 8 bytes at the specified `data` as an unsigned integer.
+inline bsls::Types::Uint64 load64(const unsigned char* data)
+{
+    bsls::Types::Uint64 value;
+    bsl::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+/// Return the specified `reg` updated with the specified `length` bytes
+/// from the specified `data`, processed as a single stream.
+__attribute__((target("sse4.2"))) unsigned int
+updateSerialSse42(unsigned int reg, const unsigned char* data, size_t length)
+{
+    while (length && (reinterpret_cast<bsls::Types::UintPtr>(data) & 7)) {
+        reg = _mm_crc32_u8(reg, *data++);
+        --length;
+    }
+
+    bsls::Types::Uint64 reg64 = reg;
+    while (length >= 8) {
+        reg64 = _mm_crc32_u64(reg64, load64(data));
+        data += 8;
+        length -= 8;
+    }
+    reg = static_cast<unsigned int>(reg64);
+
+    while (length--) {
+        reg = _mm_crc32_u8(reg, *data++);
+    }
+    return reg;
+}
+
+/// Return the specified `reg` updated with the `3 * laneLength` bytes from
+/// the specified `data`, processed as three interleaved streams of the
+/// specified `laneLength` bytes each, merged using the specified `table`.
+/// The behavior is undefined unless `laneLength` is a non-zero multiple of
+/// 8 and `table` shifts by `laneLength` bytes.
+__attribute__((target("sse4.2"))) inline unsigned int
+updateBlockSse42(unsigned int         reg,
+                 const unsigned char* data,
+                 unsigned int         laneLength,
+                 const ShiftTable&    table)
+{
+    bsls::Types::Uint64 crc0 = reg;
+    bsls::Types::Uint64 crc1 = 0;
+    bsls::Types::Uint64 crc2 = 0;
+
+    const unsigned char* lane1 = data + laneLength;
+    const unsigned char* lane2 = lane1 + laneLength;
+    const unsigned char* end   = lane1;
+    do {
+        crc0 = _mm_crc32_u64(crc0, load64(data));
+        crc1 = _mm_crc32_u64(crc1, load64(lane1));
+        crc2 = _mm_crc32_u64(crc2, load64(lane2));
+        data += 8;
+        lane1 += 8;
+        lane2 += 8;
+    } while (data < end);
+
+    // crc(A.B) == shift(crc(A), |B|) ^ crc0(B), where 'crc0' starts from a
+    // zero register.
+    reg = table.shift(static_cast<unsigned int>(crc0)) ^
+          static_cast<unsigned int>(crc1);
+    return table.shift(reg) ^ static_cast<unsigned int>(crc2);
+}
+
+#endif  // BMQP_CRC32C_SSE42_KERNEL
+
+// ===============
+// struct Dispatch
+// ===============
+
+/// Implementation selected for the running platform, together with the
+/// tables it requires.
+struct Dispatch {
+    // DATA
+    bool       d_interleaved;
+    UpdateFn   d_update;
+    ShiftTable d_longTable;
+    ShiftTable d_shortTable;
+
+    // CREATORS
+    Dispatch();
+
+    // CLASS METHODS
+
+    /// Return the process-wide instance, initializing it on first use.
+    static const Dispatch& instance();
+};
+
+#ifdef BMQP_CRC32C_SSE42_KERNEL
+
+/// Return the specified `reg` updated with the specified `length` bytes
+/// from the specified `data`, interleaving three streams for large enough
+/// inputs.
+__attribute__((target("sse4.2"))) unsigned int
+updateInterleavedSse42(unsigned int         reg,
+                       const unsigned char* data,
+                       unsigned int         length)
+{
+    if (length < 3 * k_SHORT_LANE) {
+        return updateSerialSse42(reg, data, length);  // RETURN
+    }
+
+    const Dispatch& dispatch = Dispatch::instance();
+
+    while (length && (reinterpret_cast<bsls::Types::UintPtr>(data) & 7)) {
+        reg = _mm_crc32_u8(reg, *data++);
+        --length;
+    }
+
+    while (length >= 3 * k_LONG_LANE) {
+        reg = updateBlockSse42(reg, data, k_LONG_LANE, dispatch.d_longTable);
+        data += 3 * k_LONG_LANE;
+        length -= 3 * k_LONG_LANE;
+    }
+
+    while (length >= 3 * k_SHORT_LANE) {
+        reg = updateBlockSse42(reg,
+                               data,
+                               k_SHORT_LANE,
+                               dispatch.d_shortTable);
+        data += 3 * k_SHORT_LANE;
+        length -= 3 * k_SHORT_LANE;
+    }
+
+    return updateSerialSse42(reg, data, length);
+}
+
+#endif  // BMQP_CRC32C_SSE42_KERNEL
+
+Dispatch::Dispatch()
+: d_interleaved(false)
+, d_update(&updateSoftware)
+{
+    d_longTable.initialize(k_LONG_LANE);
+    d_shortTable.initialize(k_SHORT_LANE);
+
+#ifdef BMQP_CRC32C_SSE42_KERNEL
+    if (__builtin_cpu_supports("sse4.2")) {
+        d_interleaved = true;
+        d_update      = &updateInterleavedSse42;
+    }
+#endif
+}
+
+const Dispatch& Dispatch::instance()
+{
+    static const Dispatch s_instance;
+    return s_instance;
+}
+
 }  // close unnamed namespace
 
 // -------------
@@ -42,7 +308,14 @@ const unsigned int Crc32c::k_NULL_CRC32C = bdlde::Crc32c::k_NULL_CRC32C;
 unsigned int
 Crc32c::calculate(const void* data, unsigned int length, unsigned int crc)
 {
-    return bdlde::Crc32c::calculate(data, length, crc);
+    const Dispatch& dispatch = Dispatch::instance();
+    if (!dispatch.d_interleaved) {
+        return bdlde::Crc32c::calculate(data, length, crc);  // RETURN
+    }
+
+    return ~dispatch.d_update(~crc,
+                              static_cast<const unsigned char*>(data),
+                              length);
 }
 
 unsigned int Crc32c::calculate(const bdlbb::Blob& blob, unsigned int crc)
@@ -53,18 +326,79 @@ unsigned int Crc32c::calculate(const bdlbb::Blob& blob, unsigned int crc)
         return crc;  // RETURN
     }
 
+    const Dispatch& dispatch = Dispatch::instance();
+    if (!dispatch.d_interleaved) {
+        for (int i = 0; i < (numBuffers - 1); ++i) {
+            const bdlbb::BlobBuffer& buffer = blob.buffer(i);
+            crc = bdlde::Crc32c::calculate(buffer.data(), buffer.size(), crc);
+        }
+
+        // Handle last data buffer
+        return bdlde::Crc32c::calculate(blob.buffer(numBuffers - 1).data(),
+                                        blob.lastDataBufferLength(),
+                                        crc);  // RETURN
+    }
+
+    // Keep the raw register across buffer boundaries, so that it is
+    // conditioned only once for the whole blob.
+    unsigned int reg = ~crc;
     for (int i = 0; i < (numBuffers - 1); ++i) {
         const bdlbb::BlobBuffer& buffer = blob.buffer(i);
-
-        crc = calculate(buffer.data(), buffer.size(), crc);
+        reg                             = dispatch.d_update(
+            reg,
+            reinterpret_cast<const unsigned char*>(buffer.data()),
+            buffer.size());
     }
 
     // Handle last data buffer
-    crc = calculate(blob.buffer(numBuffers - 1).data(),
-                    blob.lastDataBufferLength(),
-                    crc);
+    reg = dispatch.d_update(reg,
+                            reinterpret_cast<const unsigned char*>(
+                                blob.buffer(numBuffers - 1).data()),
+                            blob.lastDataBufferLength());
+
+    return ~reg;
+}
 
-    return crc;
+// ------------------
+// struct Crc32c_Impl
+// ------------------
+
+unsigned int Crc32c_Impl::calculateSoftware(const void*  data,
+                                            unsigned int length,
+                                            unsigned int crc)
+{
+    return bdlde::Crc32c_Impl::calculateSoftware(data, length, crc);
+}
+
+unsigned int Crc32c_Impl::calculateHardwareSerial(const void*  data,
+                                                  unsigned int length,
+                                                  unsigned int crc)
+{
+    return bdlde::Crc32c_Impl::calculateHardwareSerial(data, length, crc);
+}
+
+unsigned int Crc32c_Impl::calculateHardwareInterleaved(const void*  data,
+                                                       unsigned int length,
+                                                       unsigned int crc)
+{
+    return ~Dispatch::instance().d_update(
+        ~crc,
+        static_cast<const unsigned char*>(data),
+        length);
+}
+
+unsigned int Crc32c_Impl::combine(unsigned int        crcA,
+                                  unsigned int        crcB,
+                                  bsls::Types::Uint64 lengthB)
+{
+    // Pre/post-conditioning of 'crcA' and 'crcB' cancel out, so the
+    // identity on raw registers also holds on final CRC32-C values.
+    return multModP(shiftOperator(lengthB), crcA) ^ crcB;
+}
+
+bool Crc32c_Impl::isInterleavedSupported()
+{
+    return Dispatch::instance().d_interleaved;
 }
 
 }  // close package namespace
@@ -52,6 +52,21 @@
 //: o sparc: runtime check is detected by the 'is_sparc_crc32c_avail' system
 //:   call
 //
+// On x86-64, when SSE4.2 is available, 'bmqp::Crc32c' uses its own kernel
+// that processes three independent streams of the input in parallel (to hide
+// the latency of the 'crc32' instruction) and merges the three partial
+// checksums using precomputed shift tables.  The implementation is selected
+// once, on first use, by inspecting the running CPU.  Blobs are processed by
+// feeding each data buffer to the kernel without re-selecting the
+// implementation or re-conditioning the intermediate CRC between buffers.
+//
+/// Combining Checksums
+///-------------------
+// 'bmqp::Crc32c_Impl::combine' computes the CRC32-C of the concatenation of
+// two inputs from their individual CRC32-C values and the length of the
+// second input, without reading the inputs.  This allows checksums of
+// independently processed buffers to be merged.
+//
 /// Performance
 ///-----------
 // Below are performance comparisons of the hardware-accelerated and software
@@ -213,6 +228,7 @@
 #include <bdlbb_blob.h>
 #include <bsla_annotations.h>
 #include <bsla_deprecated.h>
+#include <bsls_types.h>
 
 namespace BloombergLP {
 namespace bmqp {
@@ -257,6 +273,60 @@ struct Crc32c {
                                   unsigned int       crc = k_NULL_CRC32C);
 };
 
+// ==================
+// struct Crc32c_Impl
+// ==================
+
+/// This class provides alternative implementations for calculating a
+/// CRC32-C checksum.  These are exposed for testing and benchmarking only,
+/// and `Crc32c` should be used instead.
+struct Crc32c_Impl {
+    // CLASS METHODS
+
+    /// Return the CRC32-C value calculated for the specified `data` over
+    /// the specified `length` number of bytes, using the optionally
+    /// specified `crc` value as the starting point for the calculation.
+    /// This utilizes a portable software-based implementation.  Note that
+    /// if `data` is 0, then `length` also must be 0.
+    static unsigned int calculateSoftware(const void*  data,
+                                          unsigned int length,
+                                          unsigned int crc = 0);
+
+    /// Return the CRC32-C value calculated for the specified `data` over
+    /// the specified `length` number of bytes, using the optionally
+    /// specified `crc` value as the starting point for the calculation.
+    /// This utilizes a hardware-accelerated implementation processing the
+    /// input as a single serial stream if supported, and a software
+    /// implementation otherwise.  Note that if `data` is 0, then `length`
+    /// also must be 0.
+    static unsigned int calculateHardwareSerial(const void*  data,
+                                                unsigned int length,
+                                                unsigned int crc = 0);
+
+    /// Return the CRC32-C value calculated for the specified `data` over
+    /// the specified `length` number of bytes, using the optionally
+    /// specified `crc` value as the starting point for the calculation.
+    /// This utilizes the hardware-accelerated implementation interleaving
+    /// three streams if supported (see `isInterleavedSupported`), and a
+    /// software implementation otherwise.  Note that if `data` is 0, then
+    /// `length` also must be 0.
+    static unsigned int calculateHardwareInterleaved(const void*  data,
+                                                     unsigned int length,
+                                                     unsigned int crc = 0);
+
+    /// Return the CRC32-C value of the concatenation of an input `A`
+    /// having the specified `crcA` CRC32-C value and an input `B` of the
+    /// specified `lengthB` bytes having the specified `crcB` CRC32-C value.
+    static unsigned int combine(unsigned int        crcA,
+                                unsigned int        crcB,
+                                bsls::Types::Uint64 lengthB);
+
+    /// Return `true` if the hardware-accelerated implementation
+    /// interleaving three streams is supported by the running platform,
+    /// and `false` otherwise.
+    static bool isInterleavedSupported();
+};
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -25,7 +25,9 @@
 
 // BDE
 #include <bdlbb_blobutil.h>
+#include <bdlbb_pooledblobbufferfactory.h>
 #include <bdlde_crc32.h>
+#include <bdlde_crc32c.h>
 #include <bdlf_bind.h>
 #include <bdlt_timeunitratio.h>
 #include <bsl_algorithm.h>
@@ -766,6 +768,97 @@ static void test5_multithreadedCrc32cDefault()
     }
 }
 
+static void test6_calculateImplementations()
+// ------------------------------------------------------------------------
+// CALCULATE CRC32-C IMPLEMENTATIONS
+//
+// Concerns:
+//   Verify that the software, hardware serial and hardware interleaved
+//   implementations yield the same CRC32-C as the default one, including
+//   for lengths around the boundaries of the interleaved blocks and at
+//   every alignment, and that 'combine' merges CRC32-C values correctly.
+//
+// Plan:
+//   - Calculate CRC32-C of random buffers of various lengths and offsets
+//     with each implementation and compare to the default.
+//   - Split each buffer in two, calculate the CRC32-C of each part and
+//     combine them, and compare to the CRC32-C of the whole buffer.
+//
+// Testing:
+//   - bmqp::Crc32c_Impl::calculateSoftware
+//   - bmqp::Crc32c_Impl::calculateHardwareSerial
+//   - bmqp::Crc32c_Impl::calculateHardwareInterleaved
+//   - bmqp::Crc32c_Impl::combine
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("CALCULATE CRC32-C IMPLEMENTATIONS");
+
+    PV("Interleaved supported: "
+       << bmqp::Crc32c_Impl::isInterleavedSupported());
+
+    const unsigned int k_MAX_OFFSET = 8;
+    const unsigned int k_LENGTHS[]  = {0,
+                                       1,
+                                       7,
+                                       8,
+                                       9,
+                                       767,
+                                       768,
+                                       769,
+                                       1029,
+                                       24575,
+                                       24576,
+                                       24577,
+                                       49999,
+                                       100000};
+    const size_t       k_NUM_LENGTHS = sizeof(k_LENGTHS) / sizeof(*k_LENGTHS);
+    const unsigned int k_MAX_LENGTH  = k_LENGTHS[k_NUM_LENGTHS - 1];
+
+    char* buffer = static_cast<char*>(bmqtst::TestHelperUtil::allocator()
+                                          ->allocate(k_MAX_LENGTH +
+                                                     k_MAX_OFFSET));
+    bsl::generate_n(buffer, k_MAX_LENGTH + k_MAX_OFFSET, bsl::rand);
+
+    for (size_t idx = 0; idx < k_NUM_LENGTHS; ++idx) {
+        const unsigned int length = k_LENGTHS[idx];
+
+        for (unsigned int offset = 0; offset < k_MAX_OFFSET; ++offset) {
+            const char* data = buffer + offset;
+
+            const unsigned int expected = bmqp::Crc32c::calculate(data,
+                                                                  length);
+
+            BMQTST_ASSERT_EQ_D(length << "@" << offset << " (Software)",
+                               bmqp::Crc32c_Impl::calculateSoftware(data,
+                                                                    length),
+                               expected);
+            BMQTST_ASSERT_EQ_D(
+                length << "@" << offset << " (HardwareSerial)",
+                bmqp::Crc32c_Impl::calculateHardwareSerial(data, length),
+                expected);
+            BMQTST_ASSERT_EQ_D(
+                length << "@" << offset << " (HardwareInterleaved)",
+                bmqp::Crc32c_Impl::calculateHardwareInterleaved(data,
+                                                                length),
+                expected);
+
+            // Combine
+            const unsigned int prefixLength = length / 3;
+            const unsigned int crcA = bmqp::Crc32c::calculate(data,
+                                                              prefixLength);
+            const unsigned int crcB = bmqp::Crc32c::calculate(
+                data + prefixLength,
+                length - prefixLength);
+            BMQTST_ASSERT_EQ_D(
+                length << "@" << offset << " (combine)",
+                bmqp::Crc32c_Impl::combine(crcA, crcB, length - prefixLength),
+                expected);
+        }
+    }
+
+    bmqtst::TestHelperUtil::allocator()->deallocate(buffer);
+}
+
 static void test7_calculateOnBlob()
 // ------------------------------------------------------------------------
 // CALCULATE CRC32-C ON BLOB w/o PREVIOUS CRC
@@ -1944,6 +2037,82 @@ testN6_bdldPerformanceDefault_GoogleBenchmark(benchmark::State& state)
     bmqtst::TestHelperUtil::allocator()->deallocate(buffer);
 }
 
+/// Populate the specified `b` with total blob sizes from 64 B to 4 Mi.
+static void populateBlobSizes_GoogleBenchmark(benchmark::internal::Benchmark* b)
+{
+    for (long int size = 64; size <= 4194304; size *= 4) {
+        b->Args({size});
+    }
+}
+
+/// Load into the specified `blob` the specified `size` bytes of random data.
+static void populateBlob(bdlbb::Blob* blob, int size)
+{
+    blob->setLength(size);
+    for (int i = 0; i < blob->numDataBuffers(); ++i) {
+        const bdlbb::BlobBuffer& buffer = blob->buffer(i);
+        bsl::generate_n(buffer.data(), buffer.size(), bsl::rand);
+    }
+}
+
+static void
+testN7_bmqpCalculateOnBlob_GoogleBenchmark(benchmark::State& state)
+// ------------------------------------------------------------------------
+// PERFORMANCE: CALCULATE CRC32-C ON BLOB
+//
+// Concerns:
+//   Test the performance of bmqp::Crc32c::calculate(const bdlbb::Blob&)
+//   for blobs of 64 B to 4 Mi made of 4 Ki buffers, and compare it to
+//   chaining 'bdlde::Crc32c::calculate' over the blob buffers (see the
+//   benchmark below).
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("GOOGLE BENCHMARK PERFORMANCE: "
+                                      "CALCULATE CRC32-C ON BLOB");
+
+    // 4 Ki buffers, as produced by the blob buffer pools
+    bdlbb::PooledBlobBufferFactory factory(
+        4096,
+        bmqtst::TestHelperUtil::allocator());
+    bdlbb::Blob blob(&factory, bmqtst::TestHelperUtil::allocator());
+    populateBlob(&blob, state.range(0));
+
+    // <time>
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(bmqp::Crc32c::calculate(blob));
+    }
+    // </time>
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+static void
+testN7_bdldCalculateOnBlob_GoogleBenchmark(benchmark::State& state)
+{
+    bmqtst::TestHelper::printTestName("GOOGLE BENCHMARK PERFORMANCE: "
+                                      "CALCULATE CRC32-C ON BLOB BDE");
+
+    // 4 Ki buffers, as produced by the blob buffer pools
+    bdlbb::PooledBlobBufferFactory factory(
+        4096,
+        bmqtst::TestHelperUtil::allocator());
+    bdlbb::Blob blob(&factory, bmqtst::TestHelperUtil::allocator());
+    populateBlob(&blob, state.range(0));
+
+    // <time>
+    for (auto _ : state) {
+        unsigned int crc = bdlde::Crc32c::k_NULL_CRC32C;
+        for (int i = 0; i < blob.numDataBuffers(); ++i) {
+            const int size = (i == blob.numDataBuffers() - 1)
+                                 ? blob.lastDataBufferLength()
+                                 : blob.buffer(i).size();
+            crc = bdlde::Crc32c::calculate(blob.buffer(i).data(), size, crc);
+        }
+        benchmark::DoNotOptimize(crc);
+    }
+    // </time>
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
 #endif  // BMQTST_BENCHMARK_ENABLED
 
 // ============================================================================
@@ -1966,7 +2135,7 @@ int main(int argc, char* argv[])
     case 0:
     case 8: test8_calculateOnBlobWithPreviousCrc(); break;
     case 7: test7_calculateOnBlob(); break;
-    case 6: break;
+    case 6: test6_calculateImplementations(); break;
     case 5: test5_multithreadedCrc32cDefault(); break;
     case 4: test4_calculateOnBufferWithPreviousCrc(); break;
     case 3: test3_calculateOnMisalignedBuffer(); break;
@@ -2002,6 +2171,14 @@ int main(int argc, char* argv[])
             testN6_bdldPerformanceDefault,
             Apply(populateBufferLengthsSorted_GoogleBenchmark_Large));
         break;
+#ifdef BMQTST_BENCHMARK_ENABLED
+    case -7:
+        BMQTST_BENCHMARK_WITH_ARGS(testN7_bmqpCalculateOnBlob,
+                                   Apply(populateBlobSizes_GoogleBenchmark));
+        BMQTST_BENCHMARK_WITH_ARGS(testN7_bdldCalculateOnBlob,
+                                   Apply(populateBlobSizes_GoogleBenchmark));
+        break;
+#endif
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         bmqtst::TestHelperUtil::testStatus() = -1;
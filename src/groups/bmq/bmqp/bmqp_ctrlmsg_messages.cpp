@@ -11393,14 +11393,19 @@ const bdlat_AttributeInfo OpenQueueResponse::ATTRIBUTE_INFO_ARRAY[] = {
      "deduplicationTimeMs",
      sizeof("deduplicationTimeMs") - 1,
      "",
-     bdlat_FormattingMode::e_DEC | bdlat_FormattingMode::e_DEFAULT_VALUE}};
+     bdlat_FormattingMode::e_DEC | bdlat_FormattingMode::e_DEFAULT_VALUE},
+    {ATTRIBUTE_ID_COMPRESSION_DICTIONARY,
+     "compressionDictionary",
+     sizeof("compressionDictionary") - 1,
+     "",
+     bdlat_FormattingMode::e_BASE64}};
 
 // CLASS METHODS
 
 const bdlat_AttributeInfo*
 OpenQueueResponse::lookupAttributeInfo(const char* name, int nameLength)
 {
-    for (int i = 0; i < 3; ++i) {
+    for (int i = 0; i < 4; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
             OpenQueueResponse::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -11422,6 +11427,8 @@ const bdlat_AttributeInfo* OpenQueueResponse::lookupAttributeInfo(int id)
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ROUTING_CONFIGURATION];
     case ATTRIBUTE_ID_DEDUPLICATION_TIME_MS:
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_DEDUPLICATION_TIME_MS];
+    case ATTRIBUTE_ID_COMPRESSION_DICTIONARY:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COMPRESSION_DICTIONARY];
     default: return 0;
     }
 }
@@ -11429,7 +11436,8 @@ const bdlat_AttributeInfo* OpenQueueResponse::lookupAttributeInfo(int id)
 // CREATORS
 
 OpenQueueResponse::OpenQueueResponse(bslma::Allocator* basicAllocator)
-: d_routingConfiguration()
+: d_compressionDictionary(basicAllocator)
+, d_routingConfiguration()
 , d_originalRequest(basicAllocator)
 , d_deduplicationTimeMs(DEFAULT_INITIALIZER_DEDUPLICATION_TIME_MS)
 {
@@ -11437,7 +11445,8 @@ OpenQueueResponse::OpenQueueResponse(bslma::Allocator* basicAllocator)
 
 OpenQueueResponse::OpenQueueResponse(const OpenQueueResponse& original,
                                      bslma::Allocator*        basicAllocator)
-: d_routingConfiguration(original.d_routingConfiguration)
+: d_compressionDictionary(original.d_compressionDictionary, basicAllocator)
+, d_routingConfiguration(original.d_routingConfiguration)
 , d_originalRequest(original.d_originalRequest, basicAllocator)
 , d_deduplicationTimeMs(original.d_deduplicationTimeMs)
 {
@@ -11446,7 +11455,8 @@ OpenQueueResponse::OpenQueueResponse(const OpenQueueResponse& original,
 #if defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES) &&               \
     defined(BSLS_COMPILERFEATURES_SUPPORT_NOEXCEPT)
 OpenQueueResponse::OpenQueueResponse(OpenQueueResponse&& original) noexcept
-: d_routingConfiguration(bsl::move(original.d_routingConfiguration)),
+: d_compressionDictionary(bsl::move(original.d_compressionDictionary)),
+  d_routingConfiguration(bsl::move(original.d_routingConfiguration)),
   d_originalRequest(bsl::move(original.d_originalRequest)),
   d_deduplicationTimeMs(bsl::move(original.d_deduplicationTimeMs))
 {
@@ -11454,7 +11464,9 @@ OpenQueueResponse::OpenQueueResponse(OpenQueueResponse&& original) noexcept
 
 OpenQueueResponse::OpenQueueResponse(OpenQueueResponse&& original,
                                      bslma::Allocator*   basicAllocator)
-: d_routingConfiguration(bsl::move(original.d_routingConfiguration))
+: d_compressionDictionary(bsl::move(original.d_compressionDictionary),
+                          basicAllocator)
+, d_routingConfiguration(bsl::move(original.d_routingConfiguration))
 , d_originalRequest(bsl::move(original.d_originalRequest), basicAllocator)
 , d_deduplicationTimeMs(bsl::move(original.d_deduplicationTimeMs))
 {
@@ -11470,9 +11482,10 @@ OpenQueueResponse::~OpenQueueResponse()
 OpenQueueResponse& OpenQueueResponse::operator=(const OpenQueueResponse& rhs)
 {
     if (this != &rhs) {
-        d_originalRequest      = rhs.d_originalRequest;
-        d_routingConfiguration = rhs.d_routingConfiguration;
-        d_deduplicationTimeMs  = rhs.d_deduplicationTimeMs;
+        d_originalRequest       = rhs.d_originalRequest;
+        d_routingConfiguration  = rhs.d_routingConfiguration;
+        d_deduplicationTimeMs   = rhs.d_deduplicationTimeMs;
+        d_compressionDictionary = rhs.d_compressionDictionary;
     }
 
     return *this;
@@ -11483,9 +11496,10 @@ OpenQueueResponse& OpenQueueResponse::operator=(const OpenQueueResponse& rhs)
 OpenQueueResponse& OpenQueueResponse::operator=(OpenQueueResponse&& rhs)
 {
     if (this != &rhs) {
-        d_originalRequest      = bsl::move(rhs.d_originalRequest);
-        d_routingConfiguration = bsl::move(rhs.d_routingConfiguration);
-        d_deduplicationTimeMs  = bsl::move(rhs.d_deduplicationTimeMs);
+        d_originalRequest       = bsl::move(rhs.d_originalRequest);
+        d_routingConfiguration  = bsl::move(rhs.d_routingConfiguration);
+        d_deduplicationTimeMs   = bsl::move(rhs.d_deduplicationTimeMs);
+        d_compressionDictionary = bsl::move(rhs.d_compressionDictionary);
     }
 
     return *this;
@@ -11497,6 +11511,7 @@ void OpenQueueResponse::reset()
     bdlat_ValueTypeFunctions::reset(&d_originalRequest);
     bdlat_ValueTypeFunctions::reset(&d_routingConfiguration);
     d_deduplicationTimeMs = DEFAULT_INITIALIZER_DEDUPLICATION_TIME_MS;
+    bdlat_ValueTypeFunctions::reset(&d_compressionDictionary);
 }
 
 // ACCESSORS
@@ -11511,6 +11526,8 @@ bsl::ostream& OpenQueueResponse::print(bsl::ostream& stream,
     printer.printAttribute("routingConfiguration",
                            this->routingConfiguration());
     printer.printAttribute("deduplicationTimeMs", this->deduplicationTimeMs());
+    printer.printAttribute("compressionDictionary",
+                           this->compressionDictionary());
     printer.end();
     return stream;
 }
@@ -19050,11 +19050,15 @@ class OpenQueueResponse {
     // downstream node to distribute messages to consumers attached to it
     // deduplicationTimeMs........: timeout, in milliseconds, to keep GUID of
     // PUT message for the purpose of detecting duplicate PUTs.
+    // compressionDictionary......: trained zstd dictionary configured for
+    // the domain of the queue, if any, to be used when compressing PUT
+    // messages with ZSTD.
 
     // INSTANCE DATA
-    RoutingConfiguration d_routingConfiguration;
-    OpenQueue            d_originalRequest;
-    int                  d_deduplicationTimeMs;
+    bdlb::NullableValue<bsl::vector<char> > d_compressionDictionary;
+    RoutingConfiguration                    d_routingConfiguration;
+    OpenQueue                               d_originalRequest;
+    int                                     d_deduplicationTimeMs;
 
     // PRIVATE ACCESSORS
     template <typename t_HASH_ALGORITHM>
@@ -19063,17 +19067,19 @@ class OpenQueueResponse {
   public:
     // TYPES
     enum {
-        ATTRIBUTE_ID_ORIGINAL_REQUEST      = 0,
-        ATTRIBUTE_ID_ROUTING_CONFIGURATION = 1,
-        ATTRIBUTE_ID_DEDUPLICATION_TIME_MS = 2
+        ATTRIBUTE_ID_ORIGINAL_REQUEST       = 0,
+        ATTRIBUTE_ID_ROUTING_CONFIGURATION  = 1,
+        ATTRIBUTE_ID_DEDUPLICATION_TIME_MS  = 2,
+        ATTRIBUTE_ID_COMPRESSION_DICTIONARY = 3
     };
 
-    enum { NUM_ATTRIBUTES = 3 };
+    enum { NUM_ATTRIBUTES = 4 };
 
     enum {
-        ATTRIBUTE_INDEX_ORIGINAL_REQUEST      = 0,
-        ATTRIBUTE_INDEX_ROUTING_CONFIGURATION = 1,
-        ATTRIBUTE_INDEX_DEDUPLICATION_TIME_MS = 2
+        ATTRIBUTE_INDEX_ORIGINAL_REQUEST       = 0,
+        ATTRIBUTE_INDEX_ROUTING_CONFIGURATION  = 1,
+        ATTRIBUTE_INDEX_DEDUPLICATION_TIME_MS  = 2,
+        ATTRIBUTE_INDEX_COMPRESSION_DICTIONARY = 3
     };
 
     // CONSTANTS
@@ -19186,6 +19192,10 @@ class OpenQueueResponse {
     // Return a reference to the modifiable "DeduplicationTimeMs" attribute
     // of this object.
 
+    bdlb::NullableValue<bsl::vector<char> >& compressionDictionary();
+    // Return a reference to the modifiable "CompressionDictionary"
+    // attribute of this object.
+
     // ACCESSORS
     bsl::ostream&
     print(bsl::ostream& stream, int level = 0, int spacesPerLevel = 4) const;
@@ -19241,6 +19251,11 @@ class OpenQueueResponse {
     // Return the value of the "DeduplicationTimeMs" attribute of this
     // object.
 
+    const bdlb::NullableValue<bsl::vector<char> >&
+    compressionDictionary() const;
+    // Return a reference offering non-modifiable access to the
+    // "CompressionDictionary" attribute of this object.
+
     // HIDDEN FRIENDS
     friend bool operator==(const OpenQueueResponse& lhs,
                            const OpenQueueResponse& rhs)
@@ -19250,7 +19265,8 @@ class OpenQueueResponse {
     {
         return lhs.originalRequest() == rhs.originalRequest() &&
                lhs.routingConfiguration() == rhs.routingConfiguration() &&
-               lhs.deduplicationTimeMs() == rhs.deduplicationTimeMs();
+               lhs.deduplicationTimeMs() == rhs.deduplicationTimeMs() &&
+               lhs.compressionDictionary() == rhs.compressionDictionary();
     }
 
     friend bool operator!=(const OpenQueueResponse& lhs,
@@ -35918,6 +35934,7 @@ void OpenQueueResponse::hashAppendImpl(t_HASH_ALGORITHM& hashAlgorithm) const
     hashAppend(hashAlgorithm, this->originalRequest());
     hashAppend(hashAlgorithm, this->routingConfiguration());
     hashAppend(hashAlgorithm, this->deduplicationTimeMs());
+    hashAppend(hashAlgorithm, this->compressionDictionary());
 }
 
 // CLASS METHODS
@@ -35947,6 +35964,13 @@ int OpenQueueResponse::manipulateAttributes(t_MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(
+        &d_compressionDictionary,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COMPRESSION_DICTIONARY]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -35971,6 +35995,11 @@ int OpenQueueResponse::manipulateAttribute(t_MANIPULATOR& manipulator, int id)
             &d_deduplicationTimeMs,
             ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_DEDUPLICATION_TIME_MS]);
     }
+    case ATTRIBUTE_ID_COMPRESSION_DICTIONARY: {
+        return manipulator(
+            &d_compressionDictionary,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COMPRESSION_DICTIONARY]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -36006,6 +36035,12 @@ inline int& OpenQueueResponse::deduplicationTimeMs()
     return d_deduplicationTimeMs;
 }
 
+inline bdlb::NullableValue<bsl::vector<char> >&
+OpenQueueResponse::compressionDictionary()
+{
+    return d_compressionDictionary;
+}
+
 // ACCESSORS
 template <typename t_ACCESSOR>
 int OpenQueueResponse::accessAttributes(t_ACCESSOR& accessor) const
@@ -36032,6 +36067,13 @@ int OpenQueueResponse::accessAttributes(t_ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(
+        d_compressionDictionary,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COMPRESSION_DICTIONARY]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -36056,6 +36098,11 @@ int OpenQueueResponse::accessAttribute(t_ACCESSOR& accessor, int id) const
             d_deduplicationTimeMs,
             ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_DEDUPLICATION_TIME_MS]);
     }
+    case ATTRIBUTE_ID_COMPRESSION_DICTIONARY: {
+        return accessor(
+            d_compressionDictionary,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COMPRESSION_DICTIONARY]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -36092,6 +36139,12 @@ inline int OpenQueueResponse::deduplicationTimeMs() const
     return d_deduplicationTimeMs;
 }
 
+inline const bdlb::NullableValue<bsl::vector<char> >&
+OpenQueueResponse::compressionDictionary() const
+{
+    return d_compressionDictionary;
+}
+
 // ----------------------
 // class PartitionMessage
 // ----------------------
@@ -0,0 +1,380 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// bmqp_messagepropertiesview.cpp                                     -*-C++-*-
+#include <bmqp_messagepropertiesview.h>
+
+#include <bmqscm_version.h>
+// BMQ
+#include <bmqp_protocol.h>
+#include <bmqp_protocolutil.h>
+#include <bmqu_blob.h>
+#include <bmqu_blobobjectproxy.h>
+
+// BDE
+#include <bdlb_bigendian.h>
+#include <bslma_default.h>
+#include <bsls_assert.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace bmqp {
+
+namespace {
+
+/// Return `true` if the specified `length` is valid for a value of the
+/// specified fixed size `type`, or if `type` is not of a fixed size.
+bool isValidLength(int length, bmqt::PropertyType::Enum type)
+{
+    switch (type) {
+    case bmqt::PropertyType::e_BOOL:
+    case bmqt::PropertyType::e_CHAR: return length == sizeof(char);
+    case bmqt::PropertyType::e_SHORT:
+        return length == sizeof(bdlb::BigEndianInt16);
+    case bmqt::PropertyType::e_INT32:
+        return length == sizeof(bdlb::BigEndianInt32);
+    case bmqt::PropertyType::e_INT64:
+        return length == sizeof(bdlb::BigEndianInt64);
+    case bmqt::PropertyType::e_STRING:
+    case bmqt::PropertyType::e_BINARY:
+        return length <= MessageProperties::k_MAX_PROPERTY_VALUE_LENGTH;
+    case bmqt::PropertyType::e_UNDEFINED:
+    default: return false;
+    }
+}
+
+}  // close unnamed namespace
+
+// ---------------------------
+// class MessagePropertiesView
+// ---------------------------
+
+// PRIVATE ACCESSORS
+int MessagePropertiesView::readHeader(int*                      nameOffset,
+                                      int*                      nameLength,
+                                      bmqt::PropertyType::Enum* type,
+                                      int                       index) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(nameOffset);
+    BSLS_ASSERT_SAFE(d_blob_p);
+    BSLS_ASSERT_SAFE(0 <= index && index < d_numProps);
+
+    bmqu::BlobPosition position;
+    if (bmqu::BlobUtil::findOffsetSafe(&position,
+                                       *d_blob_p,
+                                       d_mphOffset + index * d_mphSize)) {
+        return -1;  // RETURN
+    }
+
+    bmqu::BlobObjectProxy<MessagePropertyHeader> mpHeader(
+        d_blob_p,
+        position,
+        d_mphSize,
+        true,    // read flag
+        false);  // write flag
+    if (!mpHeader.isSet()) {
+        return -2;  // RETURN
+    }
+
+    // In the new style, 'propertyValueLength' is the offset to the name.
+    *nameOffset = d_dataOffset + mpHeader->propertyValueLength();
+
+    if (nameLength) {
+        *nameLength = mpHeader->propertyNameLength();
+    }
+    if (type) {
+        *type = static_cast<bmqt::PropertyType::Enum>(
+            mpHeader->propertyType());
+    }
+
+    return 0;
+}
+
+int MessagePropertiesView::loadProperty(int*                      offset,
+                                        int*                      length,
+                                        bmqt::PropertyType::Enum* type,
+                                        int                       index,
+                                        int nameLength) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(offset);
+    BSLS_ASSERT_SAFE(length);
+    BSLS_ASSERT_SAFE(type);
+
+    int nameOffset;
+    int actualNameLength;
+
+    if (readHeader(&nameOffset, &actualNameLength, type, index)) {
+        return -1;  // RETURN
+    }
+
+    if (actualNameLength != nameLength) {
+        // Inconsistent with the schema.
+        return -2;  // RETURN
+    }
+
+    // The value ends where the name of the next property starts, or where
+    // the properties end.
+
+    int end = d_totalSize;
+    if (index < d_numProps - 1) {
+        if (readHeader(&end, 0, 0, index + 1)) {
+            return -3;  // RETURN
+        }
+    }
+
+    *offset = nameOffset + nameLength;
+    *length = end - *offset;
+
+    if (*length < 0 || end > d_totalSize || !isValidLength(*length, *type)) {
+        return -4;  // RETURN
+    }
+
+    return 0;
+}
+
+// CREATORS
+MessagePropertiesView::MessagePropertiesView(bslma::Allocator* basicAllocator)
+: d_blob_p(0)
+, d_schema()
+, d_totalSize(0)
+, d_mphSize(0)
+, d_mphOffset(0)
+, d_numProps(0)
+, d_dataOffset(0)
+, d_buffers(bslma::Default::allocator(basicAllocator))
+{
+    // NOTHING
+}
+
+// MANIPULATORS
+int MessagePropertiesView::reset(const bdlbb::Blob& blob,
+                                 const SchemaPtr&   schema)
+{
+    clear();
+
+    if (!schema) {
+        return rc_NO_SCHEMA;  // RETURN
+    }
+
+    if (0 == blob.length()) {
+        // Empty blob implies no message properties.
+
+        return rc_SUCCESS;  // RETURN
+    }
+
+    bmqu::BlobObjectProxy<MessagePropertiesHeader> msgPropsHeader(
+        &blob,
+        -MessagePropertiesHeader::k_MIN_HEADER_SIZE,
+        true,    // read flag
+        false);  // write flag
+    if (!msgPropsHeader.isSet()) {
+        return rc_NO_MSG_PROPERTIES_HEADER;  // RETURN
+    }
+
+    msgPropsHeader.resize(msgPropsHeader->headerSize());
+    if (!msgPropsHeader.isSet()) {
+        return rc_INCOMPLETE_MSG_PROPERTIES_HEADER;  // RETURN
+    }
+
+    const int msgPropsAreaSize = msgPropsHeader->messagePropertiesAreaWords() *
+                                 Protocol::k_WORD_SIZE;
+
+    if (msgPropsAreaSize > blob.length()) {
+        return rc_INCORRECT_LENGTH;  // RETURN
+    }
+
+    const int mphSize  = msgPropsHeader->messagePropertyHeaderSize();
+    const int numProps = msgPropsHeader->numProperties();
+
+    if (0 >= mphSize) {
+        return rc_INVALID_MPH_SIZE;  // RETURN
+    }
+
+    if (0 >= numProps ||
+        MessageProperties::k_MAX_NUM_PROPERTIES < numProps) {
+        return rc_INVALID_NUM_PROPERTIES;  // RETURN
+    }
+
+    const int totalSize = ProtocolUtil::calcUnpaddedLength(blob,
+                                                           msgPropsAreaSize);
+    const int mphOffset  = msgPropsHeader->headerSize();
+    const int dataOffset = mphOffset + numProps * mphSize;
+
+    if (totalSize > blob.length() || dataOffset > totalSize) {
+        return rc_INCORRECT_LENGTH;  // RETURN
+    }
+
+    d_blob_p     = &blob;
+    d_schema     = schema;
+    d_totalSize  = totalSize;
+    d_mphSize    = mphSize;
+    d_mphOffset  = mphOffset;
+    d_numProps   = numProps;
+    d_dataOffset = dataOffset;
+
+    return rc_SUCCESS;
+}
+
+void MessagePropertiesView::clear()
+{
+    d_blob_p = 0;
+    d_schema.reset();
+    d_totalSize  = 0;
+    d_mphSize    = 0;
+    d_mphOffset  = 0;
+    d_numProps   = 0;
+    d_dataOffset = 0;
+
+    // Keep 'd_buffers' to reuse their capacity.
+}
+
+// ACCESSORS
+bdld::Datum
+MessagePropertiesView::getPropertyRef(const bsl::string& name,
+                                      bslma::Allocator*  basicAllocator) const
+{
+    int index;
+    if (d_numProps == 0 || !d_schema->loadIndex(&index, name)) {
+        return bdld::Datum::createError(-1);  // RETURN
+    }
+
+    return getPropertyRef(index, name, basicAllocator);
+}
+
+bdld::Datum
+MessagePropertiesView::getPropertyRef(int                index,
+                                      const bsl::string& name,
+                                      bslma::Allocator*  basicAllocator) const
+{
+    if (index < 0 || index >= d_numProps) {
+        return bdld::Datum::createError(-1);  // RETURN
+    }
+
+    int                      offset;
+    int                      length;
+    bmqt::PropertyType::Enum type;
+
+    if (loadProperty(&offset,
+                     &length,
+                     &type,
+                     index,
+                     static_cast<int>(name.length()))) {
+        return bdld::Datum::createError(-1);  // RETURN
+    }
+
+    bmqu::BlobPosition position;
+    if (bmqu::BlobUtil::findOffsetSafe(&position, *d_blob_p, offset)) {
+        return bdld::Datum::createError(-1);  // RETURN
+    }
+
+    int rc = 0;
+
+    switch (type) {
+    case bmqt::PropertyType::e_BOOL: {
+        char value;
+        rc = bmqu::BlobUtil::readNBytes(&value,
+                                        *d_blob_p,
+                                        position,
+                                        sizeof(value));
+        if (rc == 0) {
+            return bdld::Datum::createBoolean(value == 1);  // RETURN
+        }
+    } break;
+    case bmqt::PropertyType::e_CHAR: {
+        char value;
+        rc = bmqu::BlobUtil::readNBytes(&value,
+                                        *d_blob_p,
+                                        position,
+                                        sizeof(value));
+        if (rc == 0) {
+            return bdld::Datum::createInteger(value);  // RETURN
+        }
+    } break;
+    case bmqt::PropertyType::e_SHORT: {
+        bdlb::BigEndianInt16 nboValue;
+        rc = bmqu::BlobUtil::readNBytes(reinterpret_cast<char*>(&nboValue),
+                                        *d_blob_p,
+                                        position,
+                                        sizeof(nboValue));
+        if (rc == 0) {
+            return bdld::Datum::createInteger(
+                static_cast<short>(nboValue));  // RETURN
+        }
+    } break;
+    case bmqt::PropertyType::e_INT32: {
+        bdlb::BigEndianInt32 nboValue;
+        rc = bmqu::BlobUtil::readNBytes(reinterpret_cast<char*>(&nboValue),
+                                        *d_blob_p,
+                                        position,
+                                        sizeof(nboValue));
+        if (rc == 0) {
+            return bdld::Datum::createInteger(
+                static_cast<int>(nboValue));  // RETURN
+        }
+    } break;
+    case bmqt::PropertyType::e_INT64: {
+        bdlb::BigEndianInt64 nboValue;
+        rc = bmqu::BlobUtil::readNBytes(reinterpret_cast<char*>(&nboValue),
+                                        *d_blob_p,
+                                        position,
+                                        sizeof(nboValue));
+        if (rc == 0) {
+            return bdld::Datum::createInteger64(
+                static_cast<bsls::Types::Int64>(nboValue),
+                basicAllocator);  // RETURN
+        }
+    } break;
+    case bmqt::PropertyType::e_STRING: {
+        // Reference the value in the blob unless it spans multiple buffers.
+        bmqu::BlobPosition end;
+        if (bmqu::BlobUtil::findOffset(&end, *d_blob_p, position, length) ==
+                0 &&
+            bmqu::BlobUtil::isDataContinuous(position, end)) {
+            const char* start = d_blob_p->buffer(position.buffer()).data() +
+                                position.byte();
+            return bdld::Datum::createStringRef(start,
+                                                length,
+                                                basicAllocator);  // RETURN
+        }
+
+        if (d_buffers.size() <= static_cast<bsl::size_t>(index)) {
+            d_buffers.resize(d_numProps);
+        }
+        bsl::string& value = d_buffers[index];
+        value.resize(length);
+        rc = bmqu::BlobUtil::readNBytes(&value[0],
+                                        *d_blob_p,
+                                        position,
+                                        length);
+        if (rc == 0) {
+            return bdld::Datum::createStringRef(value.data(),
+                                                length,
+                                                basicAllocator);  // RETURN
+        }
+    } break;
+    case bmqt::PropertyType::e_BINARY:
+        // do not want to use binary
+        return bdld::Datum::createError(-2);  // RETURN
+    case bmqt::PropertyType::e_UNDEFINED:
+    default: return bdld::Datum::createError(-3);  // RETURN
+    }
+
+    return bdld::Datum::createError(-1);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
@@ -0,0 +1,226 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// bmqp_messagepropertiesview.h                                       -*-C++-*-
+#ifndef INCLUDED_BMQP_MESSAGEPROPERTIESVIEW
+#define INCLUDED_BMQP_MESSAGEPROPERTIESVIEW
+
+//@PURPOSE: Provide a read-only view on message properties with known schema.
+//
+//@CLASSES:
+//  bmqp::MessagePropertiesView: read-only view on message properties.
+//
+//@SEE ALSO: bmqp::MessageProperties, bmqp::SchemaLearner
+//
+//@DESCRIPTION: 'bmqp::MessagePropertiesView' is a mechanism providing
+// read-only random access to the properties of a message encoded in the new
+// (extended) style, given the schema of the properties previously learned by
+// 'bmqp::SchemaLearner'.  Unlike 'bmqp::MessageProperties', the view neither
+// copies nor parses the properties area up front: it keeps a reference to
+// the blob, locates a requested property by its schema index, and decodes
+// the value of that property only.  It does not allocate memory, except for
+// the rare string value which is not contiguous in the blob.
+//
+// The values returned by 'getPropertyRef' reference the blob and are valid
+// until the view is reset or cleared, and as long as the blob is not
+// modified or destroyed.
+//
+/// Thread Safety
+///-------------
+// NOT thread safe.
+//
+/// Usage
+///-----
+//..
+//  bmqp::MessagePropertiesView view(allocator);
+//
+//  if (0 == schemaLearner.read(context, &view, info, appData)) {
+//      const bdld::Datum value = view.getPropertyRef("name", allocator);
+//      // ...
+//  }
+//  else {
+//      // The schema is not known yet, read 'bmqp::MessageProperties'.
+//  }
+//..
+
+// BMQ
+#include <bmqp_messageproperties.h>
+
+// BDE
+#include <bdlbb_blob.h>
+#include <bdld_datum.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bsls_keyword.h>
+
+namespace BloombergLP {
+namespace bmqp {
+
+// ===========================
+// class MessagePropertiesView
+// ===========================
+
+/// A mechanism that provides read-only random access to message properties
+/// of a known schema without parsing all of them.
+class MessagePropertiesView BSLS_KEYWORD_FINAL {
+  public:
+    // PUBLIC TYPES
+    typedef MessageProperties::SchemaPtr SchemaPtr;
+
+  private:
+    // PRIVATE TYPES
+    enum RcEnum {
+        rc_SUCCESS                          = 0,
+        rc_NO_SCHEMA                        = -1,
+        rc_NO_MSG_PROPERTIES_HEADER         = -2,
+        rc_INCOMPLETE_MSG_PROPERTIES_HEADER = -3,
+        rc_INCORRECT_LENGTH                 = -4,
+        rc_INVALID_MPH_SIZE                 = -5,
+        rc_INVALID_NUM_PROPERTIES           = -6
+    };
+
+    // DATA
+    const bdlbb::Blob* d_blob_p;
+    // Wire representation, not owned.
+
+    SchemaPtr d_schema;
+    // Schema of the properties in 'd_blob_p'.
+
+    int d_totalSize;
+    // Length of the properties area excluding the
+    // padding.
+
+    int d_mphSize;
+    // Size of MessagePropertyHeader
+
+    int d_mphOffset;
+    // Offset to 1st MessagePropertyHeader
+
+    int d_numProps;
+
+    int d_dataOffset;
+    // start of names and values
+
+    mutable bsl::vector<bsl::string> d_buffers;
+    // Copies of the string values which are not
+    // contiguous in the blob, by property index.
+
+  private:
+    // NOT IMPLEMENTED
+    MessagePropertiesView(const MessagePropertiesView&) BSLS_KEYWORD_DELETED;
+    MessagePropertiesView&
+    operator=(const MessagePropertiesView&) BSLS_KEYWORD_DELETED;
+
+    // PRIVATE ACCESSORS
+
+    /// Load into the specified `offset`, `length`, and `type` the location
+    /// and the type of the value of the property at the specified `index`
+    /// which name has the specified `nameLength`.  Return 0 on success, and
+    /// non-zero if the blob is malformed or inconsistent with the schema.
+    int loadProperty(int*                      offset,
+                     int*                      length,
+                     bmqt::PropertyType::Enum* type,
+                     int                       index,
+                     int                       nameLength) const;
+
+    /// Read the `MessagePropertyHeader` of the property at the specified
+    /// `index` and load into the specified `nameOffset` the offset of its
+    /// name in the blob.  Also load its name length and type into the
+    /// specified `nameLength` and `type` unless they are `0`.  Return 0 on
+    /// success, and non-zero if the header cannot be read.
+    int readHeader(int*                      nameOffset,
+                   int*                      nameLength,
+                   bmqt::PropertyType::Enum* type,
+                   int                       index) const;
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(MessagePropertiesView,
+                                   bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create an empty view.  Use the optionally specified
+    /// `basicAllocator` to copy string values which are not contiguous in
+    /// the blob.
+    explicit MessagePropertiesView(bslma::Allocator* basicAllocator = 0);
+
+    // MANIPULATORS
+
+    /// Set up this view to access the properties in the specified `blob`
+    /// encoded in the new style according to the specified `schema`.  Read
+    /// and validate only the `MessagePropertiesHeader`.  Return 0 on
+    /// success, and non-zero otherwise in which case this view is empty.
+    /// The behavior is undefined unless `blob` outlives this view or its
+    /// next reset.
+    int reset(const bdlbb::Blob& blob, const SchemaPtr& schema);
+
+    /// Reset this view to the empty state.
+    void clear();
+
+    // ACCESSORS
+
+    /// Return the number of properties in this view.
+    int numProperties() const;
+
+    /// Return the schema of the properties in this view, or an empty
+    /// pointer if this view is empty.
+    const SchemaPtr& schema() const;
+
+    /// Return a reference to the value of the property with the specified
+    /// `name` in the same manner as `MessageProperties::getPropertyRef`:
+    /// return an error `bdld::Datum` if there is no such property, if the
+    /// value cannot be read, or if the value is binary.  Use the specified
+    /// `basicAllocator` for the `bdld::Datum`.
+    bdld::Datum getPropertyRef(const bsl::string& name,
+                               bslma::Allocator*  basicAllocator) const;
+
+    /// Return a reference to the value of the property at the specified
+    /// `index` in the schema, which has the specified `name`, in the same
+    /// manner as `getPropertyRef(name, basicAllocator)`.  This is to avoid
+    /// looking `name` up when `index` is known from a previous call to
+    /// `schema()->loadIndex`.
+    bdld::Datum getPropertyRef(int                index,
+                               const bsl::string& name,
+                               bslma::Allocator*  basicAllocator) const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// ---------------------------
+// class MessagePropertiesView
+// ---------------------------
+
+// ACCESSORS
+inline int MessagePropertiesView::numProperties() const
+{
+    return d_numProps;
+}
+
+inline const MessagePropertiesView::SchemaPtr&
+MessagePropertiesView::schema() const
+{
+    return d_schema;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
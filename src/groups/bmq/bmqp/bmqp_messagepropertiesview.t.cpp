@@ -0,0 +1,249 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// bmqp_messagepropertiesview.t.cpp                                   -*-C++-*-
+#include <bmqp_messagepropertiesview.h>
+
+// BMQ
+#include <bmqp_messageproperties.h>
+#include <bmqp_protocol.h>
+#include <bmqp_protocolutil.h>
+
+// BDE
+#include <bdlbb_blob.h>
+#include <bdlbb_pooledblobbufferfactory.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+#include <bslma_testallocator.h>
+#include <bsls_platform.h>
+
+// TEST DRIVER
+#include <bmqtst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+namespace {
+
+/// Populate the specified `properties` with one property of each type.
+void populateProperties(bmqp::MessageProperties* properties)
+{
+    const bsl::vector<char> binary(5,
+                                   'b',
+                                   bmqtst::TestHelperUtil::allocator());
+
+    BMQTST_ASSERT_EQ(0, properties->setPropertyAsBool("bool", true));
+    BMQTST_ASSERT_EQ(0, properties->setPropertyAsChar("char", 'c'));
+    BMQTST_ASSERT_EQ(0, properties->setPropertyAsShort("short", -17));
+    BMQTST_ASSERT_EQ(0, properties->setPropertyAsInt32("int", 1234567));
+    BMQTST_ASSERT_EQ(0,
+                     properties->setPropertyAsInt64("int64",
+                                                    -123456789012345LL));
+    BMQTST_ASSERT_EQ(0,
+                     properties->setPropertyAsString(
+                         "string",
+                         "a string value which is longer than 16 bytes"));
+    BMQTST_ASSERT_EQ(0, properties->setPropertyAsString("empty", ""));
+    BMQTST_ASSERT_EQ(0, properties->setPropertyAsBinary("binary", binary));
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+{
+    bmqtst::TestHelper::printTestName("BREATHING TEST");
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(
+        128,
+        bmqtst::TestHelperUtil::allocator());
+    bmqp::MessagePropertiesView view(bmqtst::TestHelperUtil::allocator());
+
+    BMQTST_ASSERT_EQ(0, view.numProperties());
+    BMQTST_ASSERT(
+        view.getPropertyRef("none", bmqtst::TestHelperUtil::allocator())
+            .isError());
+
+    bmqp::MessageProperties in(bmqtst::TestHelperUtil::allocator());
+    BMQTST_ASSERT_EQ(0, in.setPropertyAsInt32("x", 13));
+
+    const bmqp::MessagePropertiesInfo info(true, 1, false);
+    const bdlbb::Blob                 blob = in.streamOut(&bufferFactory,
+                                          info);
+
+    // No schema
+    BMQTST_ASSERT_NE(0,
+                     view.reset(blob, bmqp::MessageProperties::SchemaPtr()));
+    BMQTST_ASSERT_EQ(0, view.numProperties());
+
+    bmqp::MessageProperties out(bmqtst::TestHelperUtil::allocator());
+    BMQTST_ASSERT_EQ(0, out.streamIn(blob, info.isExtended()));
+
+    const bmqp::MessageProperties::SchemaPtr schema = out.makeSchema(
+        bmqtst::TestHelperUtil::allocator());
+
+    BMQTST_ASSERT_EQ(0, view.reset(blob, schema));
+    BMQTST_ASSERT_EQ(1, view.numProperties());
+    BMQTST_ASSERT_EQ(13,
+                     view.getPropertyRef("x",
+                                         bmqtst::TestHelperUtil::allocator())
+                         .theInteger());
+    BMQTST_ASSERT(
+        view.getPropertyRef("none", bmqtst::TestHelperUtil::allocator())
+            .isError());
+
+    // By index
+    BMQTST_ASSERT_EQ(
+        13,
+        view.getPropertyRef(0, "x", bmqtst::TestHelperUtil::allocator())
+            .theInteger());
+    BMQTST_ASSERT(
+        view.getPropertyRef(1, "x", bmqtst::TestHelperUtil::allocator())
+            .isError());
+
+    // Empty blob
+    const bdlbb::Blob empty(&bufferFactory,
+                            bmqtst::TestHelperUtil::allocator());
+    BMQTST_ASSERT_EQ(0, view.reset(empty, schema));
+    BMQTST_ASSERT_EQ(0, view.numProperties());
+    BMQTST_ASSERT(
+        view.getPropertyRef("x", bmqtst::TestHelperUtil::allocator())
+            .isError());
+
+    view.clear();
+    BMQTST_ASSERT_EQ(0, view.numProperties());
+}
+
+static void test2_getPropertyRef()
+{
+    // Ensure that 'getPropertyRef' returns the same values as
+    // 'bmqp::MessageProperties::getPropertyRef' for all property types, both
+    // when values are contiguous in the blob and when they span buffers.
+    bmqtst::TestHelper::printTestName("'getPropertyRef' TEST");
+
+    const int k_BUFFER_SIZES[] = {1024, 16, 7};
+
+    const char* k_NAMES[] =
+        {"bool", "char", "short", "int", "int64", "string", "empty", "binary"};
+
+    for (size_t i = 0; i < sizeof(k_BUFFER_SIZES) / sizeof(*k_BUFFER_SIZES);
+         ++i) {
+        PV("Buffer size: " << k_BUFFER_SIZES[i]);
+
+        bdlbb::PooledBlobBufferFactory bufferFactory(
+            k_BUFFER_SIZES[i],
+            bmqtst::TestHelperUtil::allocator());
+
+        bmqp::MessageProperties in(bmqtst::TestHelperUtil::allocator());
+        populateProperties(&in);
+
+        const bmqp::MessagePropertiesInfo info(true, 1, false);
+        const bdlbb::Blob blob = in.streamOut(&bufferFactory, info);
+
+        bmqp::MessageProperties out(bmqtst::TestHelperUtil::allocator());
+        BMQTST_ASSERT_EQ(0, out.streamIn(blob, info.isExtended()));
+
+        bmqp::MessagePropertiesView view(bmqtst::TestHelperUtil::allocator());
+        BMQTST_ASSERT_EQ(
+            0,
+            view.reset(blob,
+                       out.makeSchema(bmqtst::TestHelperUtil::allocator())));
+        BMQTST_ASSERT_EQ(out.numProperties(), view.numProperties());
+
+        for (size_t j = 0; j < sizeof(k_NAMES) / sizeof(*k_NAMES); ++j) {
+            const bsl::string name(k_NAMES[j],
+                                   bmqtst::TestHelperUtil::allocator());
+
+            BMQTST_ASSERT_EQ_D(
+                name,
+                view.getPropertyRef(name,
+                                    bmqtst::TestHelperUtil::allocator()),
+                out.getPropertyRef(name,
+                                   bmqtst::TestHelperUtil::allocator()));
+        }
+    }
+}
+
+static void test3_noAllocation()
+{
+    // Ensure that 'reset' and 'getPropertyRef' do not allocate when the
+    // values are contiguous in the blob.
+    bmqtst::TestHelper::printTestName("NO ALLOCATION TEST");
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(
+        1024,
+        bmqtst::TestHelperUtil::allocator());
+
+    bmqp::MessageProperties in(bmqtst::TestHelperUtil::allocator());
+    populateProperties(&in);
+
+    const bmqp::MessagePropertiesInfo info(true, 1, false);
+    const bdlbb::Blob blob = in.streamOut(&bufferFactory, info);
+
+    bmqp::MessageProperties out(bmqtst::TestHelperUtil::allocator());
+    BMQTST_ASSERT_EQ(0, out.streamIn(blob, info.isExtended()));
+
+    const bmqp::MessageProperties::SchemaPtr schema = out.makeSchema(
+        bmqtst::TestHelperUtil::allocator());
+
+    bslma::TestAllocator        ta("view");
+    bmqp::MessagePropertiesView view(&ta);
+
+    for (int i = 0; i < 3; ++i) {
+        BMQTST_ASSERT_EQ(0, view.reset(blob, schema));
+
+        BMQTST_ASSERT(view.getPropertyRef("int", &ta).isInteger());
+        BMQTST_ASSERT(view.getPropertyRef("string", &ta).isString());
+        BMQTST_ASSERT(view.getPropertyRef("none", &ta).isError());
+#ifdef BSLS_PLATFORM_CPU_64_BIT
+        BMQTST_ASSERT(view.getPropertyRef("int64", &ta).isInteger64());
+#endif
+    }
+
+    BMQTST_ASSERT_EQ(0, ta.numAllocations());
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(bmqtst::TestHelper::e_DEFAULT);
+
+    bmqp::ProtocolUtil::initialize(bmqtst::TestHelperUtil::allocator());
+
+    switch (_testCase) {
+    case 0:
+    case 3: test3_noAllocation(); break;
+    case 2: test2_getPropertyRef(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        bmqtst::TestHelperUtil::testStatus() = -1;
+    } break;
+    }
+
+    bmqp::ProtocolUtil::shutdown();
+
+    TEST_EPILOG(bmqtst::TestHelper::e_CHECK_GBL_ALLOC);
+}
@@ -386,6 +386,12 @@ struct Protocol {
     // will not be compressed regardless of the compression
     // algorithm type set to the PutEventBuilder.
 
+    static const int k_COMPRESSION_MIN_DICTIONARY_APPDATA_SIZE = 128;
+    // Threshold below which PUT's message application data
+    // will not be compressed when a compression dictionary is
+    // set to the PutEventBuilder.  Dictionary compression
+    // pays off on much smaller payloads than plain compression.
+
     static const int k_CONSUMER_PRIORITY_INVALID;
     // Constant representing the invalid consumer priority
     // (e.g. of a non-consumer client).
@@ -589,6 +589,7 @@ int ProtocolUtil::parse(bdlbb::Blob*              messagePropertiesOutput,
                         bool                      haveMessageProperties,
                         bool                      haveNewMessageProperties,
                         bmqt::CompressionAlgorithmType::Enum cat,
+                        const CompressionDictionary*         dictionary,
                         bdlbb::BlobBufferFactory*            blobBufferFactory,
                         bslma::Allocator*                    allocator)
 {
@@ -690,6 +691,7 @@ int ProtocolUtil::parse(bdlbb::Blob*              messagePropertiesOutput,
     rc = bmqp::Compression::decompress(decompressedBlob,
                                        blobBufferFactory,
                                        cat,
+                                       dictionary,
                                        bufferCompressed,
                                        &error,
                                        allocator);
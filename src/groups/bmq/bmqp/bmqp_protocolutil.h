@@ -78,6 +78,9 @@ namespace BloombergLP {
 
 namespace bmqp {
 
+// FORWARD DECLARATION
+class CompressionDictionary;
+
 // ===================
 // struct ProtocolUtil
 // ===================
@@ -424,9 +427,11 @@ struct ProtocolUtil {
     /// the specified `messagePropertiesOutput` is not `0`, output the
     /// MessageProperties blob into `messagePropertiesOutput` and the rest
     /// of input data into the specified `dataOutput`; otherwise, output
-    /// everything into `dataOutput`.  Return `0` on success, `1` if the
-    /// input is compressed and the specified `decompressFlag` is `false` in
-    /// which case parsing of MessageProperties succeeds only if
+    /// everything into `dataOutput`.  When decompressing, try the
+    /// specified `dictionary`, if not 0, before the process-wide dictionary
+    /// registry (see `Compression::decompress`).  Return `0` on success,
+    /// `1` if the input is compressed and the specified `decompressFlag` is
+    /// `false` in which case parsing of MessageProperties succeeds only if
     /// `haveNewMessageProperties` is `true` (un-compressed) and parsing of
     /// data does not succeed.  Return negative code on failure.
     static int parse(bdlbb::Blob*              messagePropertiesOutput,
@@ -439,6 +444,7 @@ struct ProtocolUtil {
                      bool                      haveMessageProperties,
                      bool                      haveNewMessageProperties,
                      bmqt::CompressionAlgorithmType::Enum cat,
+                     const CompressionDictionary*         dictionary,
                      bdlbb::BlobBufferFactory*            blobBufferFactory,
                      bslma::Allocator*                    allocator);
 
@@ -809,6 +809,7 @@ static void test10_parseMessageProperties()
                                        true,  // MPs
                                        true,  // new style
                                        peb.compressionAlgorithmType(),
+                                       0,  // no dictionary hint
                                        &bufferFactory,
                                        bmqtst::TestHelperUtil::allocator());
     BMQTST_ASSERT_EQ(0, rc);
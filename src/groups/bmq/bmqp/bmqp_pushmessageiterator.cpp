@@ -55,6 +55,7 @@ void PushMessageIterator::copyFrom(const PushMessageIterator& src)
     d_optionsPosition            = src.d_optionsPosition;
     d_decompressFlag             = src.d_decompressFlag;
     d_applicationData            = src.d_applicationData;
+    d_compressionDictionary_p    = src.d_compressionDictionary_p;
     d_header                     = src.d_header;
 
     d_optionsView.reset();
@@ -362,11 +363,47 @@ int PushMessageIterator::loadMessagePayload(bdlbb::Blob* blob) const
 
     enum RcEnum {
         rc_SUCCESS                = 0,
-        rc_IMPLICIT_APP_DATA      = -1,
-        rc_INVALID_PAYLOAD_OFFSET = -2,
         rc_INVALID_PAYLOAD_LENGTH = -3
     };
 
+    const bdlbb::Blob* payloadBlob = 0;
+    bmqu::BlobPosition payloadPos;
+
+    int rc = loadMessagePayloadView(&payloadBlob, &payloadPos);
+    if (rc != 0) {
+        return rc;  // RETURN
+    }
+
+    rc = bmqu::BlobUtil::appendToBlob(blob,
+                                      *payloadBlob,
+                                      payloadPos,
+                                      messagePayloadSize());
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(rc != 0)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        // This can only fail if the [payloadPos, payloadPos + msgPayloadSize]
+        // doesn't fall within the d_blobIter.blob().
+        return (rc * 10 + rc_INVALID_PAYLOAD_LENGTH);  // RETURN
+    }
+
+    return rc_SUCCESS;
+}
+
+int PushMessageIterator::loadMessagePayloadView(
+    const bdlbb::Blob** blob,
+    bmqu::BlobPosition* position) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(blob);
+    BSLS_ASSERT_SAFE(position);
+    BSLS_ASSERT_SAFE(isValid());
+    BSLS_ASSERT_SAFE(d_decompressFlag);
+
+    enum RcEnum {
+        rc_SUCCESS                = 0,
+        rc_IMPLICIT_APP_DATA      = -1,
+        rc_INVALID_PAYLOAD_OFFSET = -2
+    };
+
     if (isApplicationDataImplicit()) {
         return rc_IMPLICIT_APP_DATA;  // RETURN
     }
@@ -385,16 +422,8 @@ int PushMessageIterator::loadMessagePayload(bdlbb::Blob* blob) const
         BSLS_ASSERT_SAFE(d_lazyMessagePayloadPosition != bmqu::BlobPosition());
     }
 
-    int rc = bmqu::BlobUtil::appendToBlob(blob,
-                                          d_applicationData,
-                                          d_lazyMessagePayloadPosition,
-                                          messagePayloadSize());
-    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(rc != 0)) {
-        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-        // This can only fail if the [payloadPos, payloadPos + msgPayloadSize]
-        // doesn't fall within the d_blobIter.blob().
-        return (rc * 10 + rc_INVALID_PAYLOAD_LENGTH);  // RETURN
-    }
+    *blob     = &d_applicationData;
+    *position = d_lazyMessagePayloadPosition;
 
     return rc_SUCCESS;
 }
@@ -627,6 +656,7 @@ int PushMessageIterator::next()
                              haveMPs,
                              haveNewMPs,
                              d_header.compressionAlgorithmType(),
+                             d_compressionDictionary_p,
                              d_bufferFactory_p,
                              d_allocator_p);
 
@@ -74,6 +74,7 @@ namespace BloombergLP {
 namespace bmqp {
 
 // FORWARD DECLARATION
+class CompressionDictionary;
 class MessageProperties;
 
 // =========================
@@ -149,6 +150,11 @@ class PushMessageIterator {
     // Populated only if d_decompressFlag is
     // true (empty otherwise).
 
+    const CompressionDictionary* d_compressionDictionary_p;
+    // Dictionary tried first when
+    // decompressing application data, or 0.
+    // Held, not owned.
+
     bdlbb::BlobBufferFactory* d_bufferFactory_p;
     // Buffer factory used for decompressed
     // application data.
@@ -243,9 +249,17 @@ class PushMessageIterator {
     int reset(const bdlbb::Blob* blob, const PushMessageIterator& other);
 
     /// Set the internal state of this instance to be same as default
-    /// constructed, i.e., invalid.
+    /// constructed, i.e., invalid.  Note that the compression dictionary,
+    /// like the decompress flag, is not affected.
     void clear();
 
+    /// Set the dictionary tried first when decompressing application data
+    /// to the specified `dictionary`, which may be 0.  This avoids looking
+    /// up in the process-wide registry the dictionary of messages which
+    /// were compressed with `dictionary`.  The behavior is undefined unless
+    /// `dictionary`, if not 0, outlives this object.
+    void setCompressionDictionary(const CompressionDictionary* dictionary);
+
     /// Dump the beginning of the blob associated to this
     /// PushMessageIterator to the specified `stream`.
     void dumpBlob(bsl::ostream& stream);
@@ -256,6 +270,10 @@ class PushMessageIterator {
     /// can be called on this instance, or return false in all other cases.
     bool isValid() const;
 
+    /// Return the dictionary tried first when decompressing application
+    /// data, or 0 if none was set.
+    const CompressionDictionary* compressionDictionary() const;
+
     /// Return a const reference to the PushHeader currently pointed to by
     /// this iterator.  Behavior is undefined unless `isValid` returns true.
     const PushHeader& header() const;
@@ -353,6 +371,19 @@ class PushMessageIterator {
     /// `d_decompressFlag` is true.
     int loadMessagePayload(bdlbb::Blob* blob) const;
 
+    /// Load into the specified `blob` the address of the blob holding the
+    /// payload for the message currently pointed to by this iterator, and
+    /// into the specified `position` the position of the payload in that
+    /// blob, the payload being `messagePayloadSize()` bytes long.  Return
+    /// zero on success, and a non-zero value in case of failure or if
+    /// application data is implicit.  Behavior is undefined unless latest
+    /// call to `next()` returned 1 and `d_decompressFlag` is true.  Note
+    /// that, unlike `loadMessagePayload`, this method neither copies nor
+    /// allocates: the loaded `blob` belongs to this iterator and is valid
+    /// until the next call to `next()`, `reset()` or `clear()`.
+    int loadMessagePayloadView(const bdlbb::Blob** blob,
+                               bmqu::BlobPosition* position) const;
+
     /// Return the size (in bytes) of options for the message currently
     /// pointed to by this iterator.  Behavior is undefined unless latest
     /// call to `next()` returned 1.  Note that this length includes
@@ -408,6 +439,7 @@ inline PushMessageIterator::PushMessageIterator(
 , d_optionsView(allocator)
 , d_decompressFlag(false)
 , d_applicationData(bufferFactory, allocator)
+, d_compressionDictionary_p(0)
 , d_bufferFactory_p(bufferFactory)
 , d_allocator_p(allocator)
 {
@@ -424,6 +456,7 @@ inline PushMessageIterator::PushMessageIterator(
 , d_optionsView(allocator)
 , d_decompressFlag(decompressFlag)
 , d_applicationData(bufferFactory, allocator)
+, d_compressionDictionary_p(0)
 , d_bufferFactory_p(bufferFactory)
 , d_allocator_p(allocator)
 {
@@ -437,6 +470,7 @@ inline PushMessageIterator::PushMessageIterator(const PushMessageIterator& src,
              0,
              true)  // no def ctor - set in copyFrom
 , d_applicationData(src.d_bufferFactory_p, allocator)
+, d_compressionDictionary_p(0)
 , d_bufferFactory_p(src.d_bufferFactory_p)
 , d_allocator_p(allocator)
 {
@@ -470,12 +504,24 @@ inline void PushMessageIterator::clear()
     d_optionsView.reset();
 }
 
+inline void PushMessageIterator::setCompressionDictionary(
+    const CompressionDictionary* dictionary)
+{
+    d_compressionDictionary_p = dictionary;
+}
+
 // ACCESSORS
 inline bool PushMessageIterator::isValid() const
 {
     return (d_advanceLength != -1) && !d_blobIter.atEnd();
 }
 
+inline const CompressionDictionary*
+PushMessageIterator::compressionDictionary() const
+{
+    return d_compressionDictionary_p;
+}
+
 inline const PushHeader& PushMessageIterator::header() const
 {
     // PRECONDITIONS
@@ -778,6 +778,24 @@ void breathingTestHelper(
         BMQTST_ASSERT_EQ(0,
                          bdlbb::BlobUtil::compare(retrievedPayloadBlob,
                                                   expectedBlob));
+
+        // The view references the same payload
+        const bdlbb::Blob* payloadBlob = 0;
+        bmqu::BlobPosition payloadPos;
+        bdlbb::Blob        viewedPayloadBlob(
+            bmqtst::TestHelperUtil::allocator());
+        BMQTST_ASSERT_EQ(
+            0,
+            iter.loadMessagePayloadView(&payloadBlob, &payloadPos));
+        BMQTST_ASSERT_EQ(
+            0,
+            bmqu::BlobUtil::appendToBlob(&viewedPayloadBlob,
+                                         *payloadBlob,
+                                         payloadPos,
+                                         iter.messagePayloadSize()));
+        BMQTST_ASSERT_EQ(0,
+                         bdlbb::BlobUtil::compare(viewedPayloadBlob,
+                                                  expectedBlob));
     }
 
     bmqp::OptionsView emptyOptionsView(bmqtst::TestHelperUtil::allocator());
@@ -19,6 +19,7 @@
 #include <bmqscm_version.h>
 // BMQ
 #include <bmqp_compression.h>
+#include <bmqp_compressiondictionary.h>
 #include <bmqp_crc32c.h>
 #include <bmqp_optionutil.h>
 #include <bmqp_protocolutil.h>
@@ -78,14 +79,14 @@ void PutEventBuilder::resetFields()
 }
 
 bmqt::EventBuilderResult::Enum
-PutEventBuilder::packMessageInternal(const bdlbb::Blob& appData, int queueId)
+PutEventBuilder::packMessageHeader(int* numPaddingBytes,
+                                   int  appDataLength,
+                                   int  queueId)
 {
     typedef bmqt::EventBuilderResult Result;
     typedef OptionUtil::OptionMeta   OptionMeta;
 
-    int       appDataLength   = appData.length();
-    int       numPaddingBytes = 0;
-    const int numWords = ProtocolUtil::calcNumWordsAndPadding(&numPaddingBytes,
+    const int numWords = ProtocolUtil::calcNumWordsAndPadding(numPaddingBytes,
                                                               appDataLength);
 
     // Validate payload is not too big
@@ -96,7 +97,7 @@ PutEventBuilder::packMessageInternal(const bdlbb::Blob& appData, int queueId)
     }
 
     const int sizeNoOptions = eventSize() + sizeof(PutHeader) + appDataLength +
-                              numPaddingBytes;
+                              *numPaddingBytes;
 
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(sizeNoOptions >
                                               PutHeader::k_MAX_SIZE_SOFT)) {
@@ -162,7 +163,65 @@ PutEventBuilder::packMessageInternal(const bdlbb::Blob& appData, int queueId)
     // Just a sanity test.  Should still be word aligned.
     BSLS_ASSERT_SAFE(isWordAligned(*d_blob_sp));
 
-    bdlbb::BlobUtil::append(d_blob_sp.get(), appData);
+    return Result::e_SUCCESS;
+}
+
+bmqt::EventBuilderResult::Enum
+PutEventBuilder::packMessageInternal(const bdlbb::Blob* properties,
+                                     const bdlbb::Blob& payload,
+                                     int                queueId)
+{
+    typedef bmqt::EventBuilderResult Result;
+
+    const int appDataLength = (properties ? properties->length() : 0) +
+                              payload.length();
+
+    int                numPaddingBytes = 0;
+    const Result::Enum rc              = packMessageHeader(&numPaddingBytes,
+                                                           appDataLength,
+                                                           queueId);
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(rc != Result::e_SUCCESS)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return rc;  // RETURN
+    }
+
+    if (properties) {
+        bdlbb::BlobUtil::append(d_blob_sp.get(), *properties);
+    }
+    bdlbb::BlobUtil::append(d_blob_sp.get(), payload);
+
+    // Add padding
+    ProtocolUtil::appendPaddingRaw(d_blob_sp.get(), numPaddingBytes);
+
+    ++d_msgCount;
+
+    return Result::e_SUCCESS;
+}
+
+bmqt::EventBuilderResult::Enum
+PutEventBuilder::packMessageInternal(const bdlbb::Blob* properties,
+                                     const char*        data,
+                                     int                length,
+                                     int                queueId)
+{
+    typedef bmqt::EventBuilderResult Result;
+
+    const int appDataLength = (properties ? properties->length() : 0) +
+                              length;
+
+    int                numPaddingBytes = 0;
+    const Result::Enum rc              = packMessageHeader(&numPaddingBytes,
+                                                           appDataLength,
+                                                           queueId);
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(rc != Result::e_SUCCESS)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return rc;  // RETURN
+    }
+
+    if (properties) {
+        bdlbb::BlobUtil::append(d_blob_sp.get(), *properties);
+    }
+    bdlbb::BlobUtil::append(d_blob_sp.get(), data, length);
 
     // Add padding
     ProtocolUtil::appendPaddingRaw(d_blob_sp.get(), numPaddingBytes);
@@ -172,6 +231,16 @@ PutEventBuilder::packMessageInternal(const bdlbb::Blob& appData, int queueId)
     return Result::e_SUCCESS;
 }
 
+int PutEventBuilder::compressionThreshold() const
+{
+    if (d_compressionDictionary_p &&
+        d_compressionAlgorithmType == bmqt::CompressionAlgorithmType::e_ZSTD) {
+        return Protocol::k_COMPRESSION_MIN_DICTIONARY_APPDATA_SIZE;  // RETURN
+    }
+
+    return Protocol::k_COMPRESSION_MIN_APPDATA_SIZE;
+}
+
 PutEventBuilder::PutEventBuilder(BlobSpPool*       blobSpPool_p,
                                  bslma::Allocator* allocator)
 : d_allocator_p(bslma::Default::allocator(allocator))
@@ -188,6 +257,8 @@ PutEventBuilder::PutEventBuilder(BlobSpPool*       blobSpPool_p,
 , d_msgCount(0)
 , d_crc32c(0)
 , d_compressionAlgorithmType(bmqt::CompressionAlgorithmType::e_NONE)
+, d_compressionLevel(Compression::k_DEFAULT_LEVEL)
+, d_compressionDictionary_p(0)
 , d_lastPackedMessageCompressionRatio(-1)
 , d_messagePropertiesInfo()
 {
@@ -281,8 +352,7 @@ PutEventBuilder::packMessageInOldStyle(int queueId)
     }
 
     // Compress
-    if (applicationData_sp->length() >=
-            Protocol::k_COMPRESSION_MIN_APPDATA_SIZE &&
+    if (applicationData_sp->length() >= compressionThreshold() &&
         d_compressionAlgorithmType != bmqt::CompressionAlgorithmType::e_NONE) {
         bsl::shared_ptr<bdlbb::Blob> compressedApplicationData_sp =
             d_blobSpPool_p->getObject();
@@ -291,6 +361,8 @@ PutEventBuilder::packMessageInOldStyle(int queueId)
         int rc = Compression::compress(compressedApplicationData_sp.get(),
                                        d_blob_sp->factory(),
                                        d_compressionAlgorithmType,
+                                       d_compressionLevel,
+                                       d_compressionDictionary_p,
                                        *applicationData_sp,
                                        &error,
                                        d_allocator_p);
@@ -306,7 +378,8 @@ PutEventBuilder::packMessageInOldStyle(int queueId)
                 static_cast<double>(applicationData_sp->length()) /
                 compressedApplicationData_sp->length();
 
-            return packMessageInternal(*compressedApplicationData_sp,
+            return packMessageInternal(0,
+                                       *compressedApplicationData_sp,
                                        queueId);  // RETURN
         }
     }
@@ -320,7 +393,7 @@ PutEventBuilder::packMessageInOldStyle(int queueId)
     d_crc32c                   = Crc32c::calculate(*applicationData_sp);
     d_lastPackedMessageCompressionRatio = 1;
 
-    return packMessageInternal(*applicationData_sp, queueId);
+    return packMessageInternal(0, *applicationData_sp, queueId);
 }
 
 bmqt::EventBuilderResult::Enum PutEventBuilder::packMessage(int queueId)
@@ -334,11 +407,12 @@ bmqt::EventBuilderResult::Enum PutEventBuilder::packMessage(int queueId)
     // success or failure).  Create a proctor to auto reset them.
     const ResetGuard guard(*this);
 
-    // Calculate length of entire application data (includes payload, message
-    // properties and padding, if any).
-    bsl::shared_ptr<bdlbb::Blob> bufferBlob_sp = d_blobSpPool_p->getObject();
-    bsl::shared_ptr<bdlbb::Blob> resultBlob_sp = d_blobSpPool_p->getObject();
-    const bdlbb::Blob*           payloadBlob   = d_blobPayload_p;
+    // The application data is made of the message properties, if any,
+    // followed by the (possibly compressed) payload.  Both are appended to
+    // the event blob directly, and the CRC32-C is accumulated over them in
+    // that order, so that no intermediate blob has to be assembled.
+    const bdlbb::Blob* propertiesBlob = 0;
+    unsigned int       crc32c         = Crc32c::k_NULL_CRC32C;
 
     if (d_properties_p && 0 != d_properties_p->numProperties()) {
         // Note that '0 != d_properties_p->numProperties()' check is required
@@ -352,30 +426,32 @@ bmqt::EventBuilderResult::Enum PutEventBuilder::packMessage(int queueId)
         }
 
         // propertiesBlob include 6 byte mph along with properties
-        const bdlbb::Blob& propertiesBlob = d_properties_p->streamOut(
-            d_blob_sp->factory(),
-            d_messagePropertiesInfo);
-
-        bdlbb::BlobUtil::append(resultBlob_sp.get(), propertiesBlob);
+        propertiesBlob = &d_properties_p->streamOut(d_blob_sp->factory(),
+                                                    d_messagePropertiesInfo);
+        crc32c         = Crc32c::calculate(*propertiesBlob);
     }
     else {
         BSLS_ASSERT_SAFE(!d_messagePropertiesInfo.isPresent());
     }
 
-    // Add the payload
-    if (d_rawPayload_p) {
-        bdlbb::BlobUtil::append(bufferBlob_sp.get(),
-                                d_rawPayload_p,
-                                d_rawPayloadLength);
-        payloadBlob = bufferBlob_sp.get();
-    }
-    else {
-        payloadBlob = d_blobPayload_p;
-    }
+    const int payloadLength = d_rawPayload_p ? d_rawPayloadLength
+                                             : d_blobPayload_p->length();
 
     // Compress
-    if (payloadBlob->length() >= Protocol::k_COMPRESSION_MIN_APPDATA_SIZE &&
+    if (payloadLength >= compressionThreshold() &&
         d_compressionAlgorithmType != bmqt::CompressionAlgorithmType::e_NONE) {
+        // The raw payload is only copied into a blob when it has to be
+        // compressed.
+        bsl::shared_ptr<bdlbb::Blob> bufferBlob_sp;
+        const bdlbb::Blob*           payloadBlob = d_blobPayload_p;
+        if (d_rawPayload_p) {
+            bufferBlob_sp = d_blobSpPool_p->getObject();
+            bdlbb::BlobUtil::append(bufferBlob_sp.get(),
+                                    d_rawPayload_p,
+                                    d_rawPayloadLength);
+            payloadBlob = bufferBlob_sp.get();
+        }
+
         bsl::shared_ptr<bdlbb::Blob> compressedPayloadBlob_sp =
             d_blobSpPool_p->getObject();
         bmqu::MemOutStream error(d_allocator_p);
@@ -383,37 +459,50 @@ bmqt::EventBuilderResult::Enum PutEventBuilder::packMessage(int queueId)
         int rc = Compression::compress(compressedPayloadBlob_sp.get(),
                                        d_blob_sp->factory(),
                                        d_compressionAlgorithmType,
+                                       d_compressionLevel,
+                                       d_compressionDictionary_p,
                                        *payloadBlob,
                                        &error,
                                        d_allocator_p);
         if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
                 rc == Result::e_SUCCESS &&
-                compressedPayloadBlob_sp->length() < payloadBlob->length())) {
+                compressedPayloadBlob_sp->length() < payloadLength)) {
             // Compression is successful and is worth using!
 
             // Keep track of the compression ratio.
             d_lastPackedMessageCompressionRatio =
-                static_cast<double>(payloadBlob->length()) /
+                static_cast<double>(payloadLength) /
                 compressedPayloadBlob_sp->length();
-            bdlbb::BlobUtil::append(resultBlob_sp.get(),
-                                    *compressedPayloadBlob_sp);
-            d_crc32c = Crc32c::calculate(*resultBlob_sp);
+            d_crc32c = Crc32c::calculate(*compressedPayloadBlob_sp, crc32c);
 
-            return packMessageInternal(*resultBlob_sp, queueId);  // RETURN
+            return packMessageInternal(propertiesBlob,
+                                       *compressedPayloadBlob_sp,
+                                       queueId);  // RETURN
         }
     }
 
     // Either no compression, or the compression failed, or the resulting blob
     // was bigger and not worth using. In either way, we fall back to using the
-    // original blob. Explicitly set the 'd_compressionAlgorithmType' to
+    // original payload. Explicitly set the 'd_compressionAlgorithmType' to
     // 'NONE'.
-    bdlbb::BlobUtil::append(resultBlob_sp.get(), *payloadBlob);
-
     d_compressionAlgorithmType = bmqt::CompressionAlgorithmType::e_NONE;
-    d_crc32c                   = Crc32c::calculate(*resultBlob_sp);
     d_lastPackedMessageCompressionRatio = 1;
 
-    return packMessageInternal(*resultBlob_sp, queueId);
+    if (!d_rawPayload_p) {
+        d_crc32c = Crc32c::calculate(*d_blobPayload_p, crc32c);
+
+        return packMessageInternal(propertiesBlob,
+                                   *d_blobPayload_p,
+                                   queueId);  // RETURN
+    }
+
+    // The raw payload is copied only once, directly into the event blob.
+    d_crc32c = Crc32c::calculate(d_rawPayload_p, d_rawPayloadLength, crc32c);
+
+    return packMessageInternal(propertiesBlob,
+                               d_rawPayload_p,
+                               d_rawPayloadLength,
+                               queueId);
 }
 
 bmqt::EventBuilderResult::Enum PutEventBuilder::packMessageRaw(int queueId)
@@ -426,7 +515,7 @@ bmqt::EventBuilderResult::Enum PutEventBuilder::packMessageRaw(int queueId)
     const ResetGuard guard(*this);
 
     // Note that the 'd_blobPayload_p' has the entire application data.
-    return packMessageInternal(*d_blobPayload_p, queueId);
+    return packMessageInternal(0, *d_blobPayload_p, queueId);
 }
 
 const bsl::shared_ptr<bdlbb::Blob>& PutEventBuilder::blob() const
@@ -66,6 +66,7 @@
 
 // BMQ
 #include <bmqp_blobpoolutil.h>
+#include <bmqp_compression.h>
 #include <bmqp_messageproperties.h>
 #include <bmqp_protocol.h>
 #include <bmqt_compressionalgorithmtype.h>
@@ -170,6 +171,17 @@ class PutEventBuilder {
     // current message's payload (the
     // user sets it explicitly)
 
+    int d_compressionLevel;
+    // Compression level of the current
+    // message's payload, or
+    // 'Compression::k_DEFAULT_LEVEL' to
+    // use the algorithm's default.
+
+    const CompressionDictionary* d_compressionDictionary_p;
+    // Dictionary to compress the
+    // current message's payload with,
+    // or 0 if none (held, not owned).
+
     double d_lastPackedMessageCompressionRatio;
     // Compression ratio of the last
     // packed message, or -1 if no
@@ -191,8 +203,43 @@ class PutEventBuilder {
     /// Reset flags and message guid of this object.
     void resetFields();
 
+    /// Validate that a message having the specified `appDataLength` bytes
+    /// of application data fits in the event and, if so, append its
+    /// `PutHeader` and options for the specified `queueId` to the event,
+    /// and load into the specified `numPaddingBytes` the number of padding
+    /// bytes to append after the application data.  Return the result of
+    /// the operation.  Note that the event is left unchanged on failure,
+    /// unless the options did not fit.
+    bmqt::EventBuilderResult::Enum
+    packMessageHeader(int* numPaddingBytes, int appDataLength, int queueId);
+
+    /// Pack a message for the specified `queueId` whose application data
+    /// is made of the optionally specified `properties` (may be 0)
+    /// followed by the specified `payload`, and return the result of the
+    /// operation.  The buffers of `properties` and `payload` are appended
+    /// to the event without being copied.
     bmqt::EventBuilderResult::Enum
-    packMessageInternal(const bdlbb::Blob& appData, int queueId);
+    packMessageInternal(const bdlbb::Blob* properties,
+                        const bdlbb::Blob& payload,
+                        int                queueId);
+
+    /// Pack a message for the specified `queueId` whose application data
+    /// is made of the optionally specified `properties` (may be 0)
+    /// followed by the specified `length` bytes of payload at the
+    /// specified `data`, and return the result of the operation.  The
+    /// buffers of `properties` are appended to the event without being
+    /// copied, and the payload is copied directly into the event.
+    bmqt::EventBuilderResult::Enum
+    packMessageInternal(const bdlbb::Blob* properties,
+                        const char*        data,
+                        int                length,
+                        int                queueId);
+
+    // PRIVATE ACCESSORS
+
+    /// Return the minimum size of the application data of the current
+    /// message for it to be compressed.
+    int compressionThreshold() const;
 
   public:
     // TRAITS
@@ -262,6 +309,26 @@ class PutEventBuilder {
     PutEventBuilder&
     setCompressionAlgorithmType(bmqt::CompressionAlgorithmType::Enum value);
 
+    /// Set the compression level of the current message to the specified
+    /// `value` and return a reference offering modifiable access to this
+    /// object.  The meaning of `value` is specific to the compression
+    /// algorithm in use; `Compression::k_DEFAULT_LEVEL` selects the
+    /// algorithm's default level.
+    PutEventBuilder& setCompressionLevel(int value);
+
+    /// Set the trained dictionary to compress the current message with to
+    /// the specified `value` and return a reference offering modifiable
+    /// access to this object.  `value` is only used with the
+    /// `bmqt::CompressionAlgorithmType::e_ZSTD` algorithm, and lowers the
+    /// size threshold above which messages are compressed to
+    /// `Protocol::k_COMPRESSION_MIN_DICTIONARY_APPDATA_SIZE`.  The behavior
+    /// is undefined unless `value` is 0 or outlives the packing of the
+    /// current message, and is registered in
+    /// `CompressionDictionaryRegistry::defaultRegistry()` of the receiving
+    /// processes.
+    PutEventBuilder&
+    setCompressionDictionary(const CompressionDictionary* value);
+
     /// Set the knowledge about MessageProperties presence and their Schema
     /// Id in the current message to the specified `value` and return a
     /// reference offering modifiable access to this object.
@@ -338,6 +405,15 @@ class PutEventBuilder {
     /// bmqt::CompressionAlgorithmType::e_NONE will be returned.
     bmqt::CompressionAlgorithmType::Enum compressionAlgorithmType() const;
 
+    /// Return the compression level of the current message.  Note that if
+    /// `setCompressionLevel` has not been invoked, then
+    /// `Compression::k_DEFAULT_LEVEL` will be returned.
+    int compressionLevel() const;
+
+    /// Return the dictionary to compress the current message with, or 0 if
+    /// `setCompressionDictionary` has not been invoked.
+    const CompressionDictionary* compressionDictionary() const;
+
     /// Return the compression ratio of the last packed message, or -1 if no
     /// message was yet packed.  Note that compression ratio is computed by
     /// dividing the original message size, by its compressed one.  If the
@@ -455,6 +531,19 @@ inline PutEventBuilder& PutEventBuilder::setCompressionAlgorithmType(
     return *this;
 }
 
+inline PutEventBuilder& PutEventBuilder::setCompressionLevel(int value)
+{
+    d_compressionLevel = value;
+    return *this;
+}
+
+inline PutEventBuilder&
+PutEventBuilder::setCompressionDictionary(const CompressionDictionary* value)
+{
+    d_compressionDictionary_p = value;
+    return *this;
+}
+
 inline PutEventBuilder&
 PutEventBuilder::setMessagePropertiesInfo(const MessagePropertiesInfo& value)
 {
@@ -486,6 +575,8 @@ inline void PutEventBuilder::startMessage()
     d_properties_p             = 0;
     d_flags                    = 0;
     d_compressionAlgorithmType = bmqt::CompressionAlgorithmType::e_NONE;
+    d_compressionLevel         = Compression::k_DEFAULT_LEVEL;
+    d_compressionDictionary_p  = 0;
     d_messageGUID              = bmqt::MessageGUID();
     d_msgGroupId.reset();
     d_crc32c                = 0;
@@ -539,6 +630,17 @@ PutEventBuilder::compressionAlgorithmType() const
     return d_compressionAlgorithmType;
 }
 
+inline int PutEventBuilder::compressionLevel() const
+{
+    return d_compressionLevel;
+}
+
+inline const CompressionDictionary*
+PutEventBuilder::compressionDictionary() const
+{
+    return d_compressionDictionary_p;
+}
+
 inline double PutEventBuilder::lastPackedMesageCompressionRatio() const
 {
     return d_lastPackedMessageCompressionRatio;
@@ -54,8 +54,14 @@
 // TEST DRIVER
 #include <bmqtst_testhelper.h>
 #include <bsl_memory.h>
+#include <bsl_string.h>
 #include <bsl_vector.h>
 
+// BENCHMARKING LIBRARY
+#ifdef BMQTST_BENCHMARK_ENABLED
+#include <benchmark/benchmark.h>
+#endif
+
 // CONVENIENCE
 using namespace BloombergLP;
 using namespace bsl;
@@ -2691,6 +2697,174 @@ static void test8_compressionRatioAccessor()
     BMQTST_ASSERT_GT(ratio, 1.0);
 }
 
+static void test9_packMessageChangingProperties()
+// ------------------------------------------------------------------------
+// PACK MESSAGE CHANGING PROPERTIES
+//
+// Concerns:
+//   1. Packing several messages sharing the same 'MessageProperties'
+//      object, with only the values of the properties changing between
+//      messages, does not alter the messages previously packed.
+//   2. The CRC32-C of each message is calculated over its properties
+//      followed by its payload.
+//
+// Plan:
+//   1. Pack a few uncompressed messages having a raw payload, changing
+//      the value of a property before packing each of them.
+//   2. Iterate over the event and verify the properties, payload and
+//      CRC32-C of each message.
+//
+// Testing:
+//   packMessage(int queueId)
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("PACK MESSAGE CHANGING PROPERTIES");
+
+    const char* k_PAYLOAD     = "abcdefghijklmnopqrstuvwxyz";
+    const int   k_PAYLOAD_LEN = static_cast<int>(bsl::strlen(k_PAYLOAD));
+    const int   k_QID         = 9876;
+    const int   k_NUM_MSGS    = 3;
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(
+        128,
+        bmqtst::TestHelperUtil::allocator());
+    bmqp::BlobPoolUtil::BlobSpPoolSp blobSpPool(
+        bmqp::BlobPoolUtil::createBlobPool(
+            &bufferFactory,
+            bmqtst::TestHelperUtil::allocator()));
+
+    bmqp::MessageProperties msgProps(bmqtst::TestHelperUtil::allocator());
+    BMQTST_ASSERT_EQ(0, msgProps.setPropertyAsString("id", "myCoolId"));
+
+    bmqp::PutEventBuilder obj(blobSpPool.get(),
+                              bmqtst::TestHelperUtil::allocator());
+
+    unsigned int expectedCrc32[k_NUM_MSGS];
+    for (int i = 0; i < k_NUM_MSGS; ++i) {
+        BMQTST_ASSERT_EQ(0, msgProps.setPropertyAsInt32("sequence", i));
+
+        expectedCrc32[i] = findExpectedCrc32(
+            k_PAYLOAD,
+            k_PAYLOAD_LEN,
+            &msgProps,
+            true,  // has properties
+            &bufferFactory,
+            bmqtst::TestHelperUtil::allocator(),
+            bmqt::CompressionAlgorithmType::e_NONE);
+
+        obj.startMessage();
+        obj.setMessagePayload(k_PAYLOAD, k_PAYLOAD_LEN)
+            .setMessageProperties(&msgProps)
+            .setMessageGUID(bmqp::MessageGUIDGenerator::testGUID());
+
+        BMQTST_ASSERT_EQ(obj.packMessage(k_QID),
+                         bmqt::EventBuilderResult::e_SUCCESS);
+    }
+    BMQTST_ASSERT_EQ(obj.messageCount(), k_NUM_MSGS);
+
+    bmqp::Event rawEvent(obj.blob().get(),
+                         bmqtst::TestHelperUtil::allocator());
+    BMQTST_ASSERT(rawEvent.isPutEvent());
+
+    bmqp::PutMessageIterator putIter(&bufferFactory,
+                                     bmqtst::TestHelperUtil::allocator());
+    rawEvent.loadPutMessageIterator(&putIter, true);
+    BMQTST_ASSERT(putIter.isValid());
+
+    bdlbb::Blob payloadBlob(bmqtst::TestHelperUtil::allocator());
+    for (int i = 0; i < k_NUM_MSGS; ++i) {
+        BMQTST_ASSERT_EQ(1, putIter.next());
+        BMQTST_ASSERT_EQ(expectedCrc32[i], putIter.header().crc32c());
+
+        payloadBlob.removeAll();
+        BMQTST_ASSERT_EQ(0, putIter.loadMessagePayload(&payloadBlob));
+
+        int compareResult = 0;
+        BMQTST_ASSERT_EQ(0,
+                         bmqu::BlobUtil::compareSection(&compareResult,
+                                                        payloadBlob,
+                                                        bmqu::BlobPosition(),
+                                                        k_PAYLOAD,
+                                                        k_PAYLOAD_LEN));
+        BMQTST_ASSERT_EQ(0, compareResult);
+
+        bmqp::MessageProperties properties(
+            bmqtst::TestHelperUtil::allocator());
+        BMQTST_ASSERT_EQ(0, putIter.loadMessageProperties(&properties));
+        BMQTST_ASSERT_EQ(2, properties.numProperties());
+        BMQTST_ASSERT_EQ(i, properties.getPropertyAsInt32("sequence"));
+        BMQTST_ASSERT_EQ("myCoolId", properties.getPropertyAsString("id"));
+    }
+    BMQTST_ASSERT_EQ(0, putIter.next());
+}
+
+// ============================================================================
+//                              PERFORMANCE TESTS
+// ----------------------------------------------------------------------------
+
+#ifdef BMQTST_BENCHMARK_ENABLED
+static void testN2_packMessage_GoogleBenchmark(benchmark::State& state)
+{
+    // Pack uncompressed messages having a raw payload of 'state.range(0)'
+    // bytes and a few properties, only the value of one of the properties
+    // changing between messages, as a high-rate producer would do.  The
+    // builder is reset every 'k_MSGS_PER_EVENT' messages.
+
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+
+    const int k_QID            = 9876;
+    const int k_MSGS_PER_EVENT = 256;
+
+    const int         payloadSize = static_cast<int>(state.range(0));
+    const bsl::string payload(payloadSize,
+                              'x',
+                              bmqtst::TestHelperUtil::allocator());
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(
+        4 * 1024,
+        bmqtst::TestHelperUtil::allocator());
+    bmqp::BlobPoolUtil::BlobSpPoolSp blobSpPool(
+        bmqp::BlobPoolUtil::createBlobPool(
+            &bufferFactory,
+            bmqtst::TestHelperUtil::allocator()));
+
+    bmqp::MessageProperties msgProps(bmqtst::TestHelperUtil::allocator());
+    msgProps.setPropertyAsString("id", "myCoolId");
+    msgProps.setPropertyAsInt32("encoding", 3);
+
+    bmqp::PutEventBuilder obj(blobSpPool.get(),
+                              bmqtst::TestHelperUtil::allocator());
+
+    bsls::Types::Int64 sequence = 0;
+
+    // <time>
+    for (auto _ : state) {
+        msgProps.setPropertyAsInt64("sequence", ++sequence);
+
+        obj.startMessage();
+        obj.setMessagePayload(payload.data(), payloadSize)
+            .setMessageProperties(&msgProps)
+            .setMessageGUID(bmqp::MessageGUIDGenerator::testGUID());
+        obj.packMessage(k_QID);
+
+        if (obj.messageCount() == k_MSGS_PER_EVENT) {
+            benchmark::DoNotOptimize(obj.blob().get());
+            obj.reset();
+        }
+    }
+    // </time>
+
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * payloadSize);
+}
+#else
+static void testN2_packMessage()
+{
+    bmqtst::TestHelper::printTestName("GOOGLE BENCHMARK: packMessage");
+    PV("GoogleBenchmark is not supported on this platform, skipping...")
+}
+#endif
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -2719,6 +2893,7 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 9: test9_packMessageChangingProperties(); break;
     case 8: test8_compressionRatioAccessor(); break;
     case 7: test7_multiplePackMessage(); break;
     case 6: test6_emptyBuilder(); break;
@@ -2728,12 +2903,25 @@ int main(int argc, char* argv[])
     case 2: test2_manipulators_one(); break;
     case 1: test1_breathingTest(); break;
     case -1: testN1_decodeFromFile(); break;
+    case -2:
+        BMQTST_BENCHMARK_WITH_ARGS(testN2_packMessage,
+                                   Arg(64)
+                                       ->Arg(1024)
+                                       ->Unit(benchmark::kNanosecond));
+        break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         bmqtst::TestHelperUtil::testStatus() = -1;
     } break;
     }
 
+#ifdef BMQTST_BENCHMARK_ENABLED
+    if (_testCase < 0) {
+        benchmark::Initialize(&argc, argv);
+        benchmark::RunSpecifiedBenchmarks();
+    }
+#endif
+
     bmqp::ProtocolUtil::shutdown();
 
     TEST_EPILOG(bmqtst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
@@ -429,6 +429,32 @@ int PutMessageIterator::loadMessagePayload(bdlbb::Blob* blob) const
     return rc_SUCCESS;
 }
 
+int PutMessageIterator::loadMessagePayloadView(
+    const bdlbb::Blob** blob,
+    bmqu::BlobPosition* position) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(blob);
+    BSLS_ASSERT_SAFE(position);
+    BSLS_ASSERT_SAFE(isValid());
+    BSLS_ASSERT_SAFE(d_decompressFlag);
+
+    enum RcEnum {
+        rc_SUCCESS                = 0,
+        rc_INVALID_PAYLOAD_OFFSET = -1
+    };
+
+    const int rc = loadMessagePayloadPosition(position);
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(rc != 0)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return rc * 10 + rc_INVALID_PAYLOAD_OFFSET;  // RETURN
+    }
+
+    *blob = &d_applicationData;
+
+    return rc_SUCCESS;
+}
+
 bool PutMessageIterator::extractMsgGroupId(
     bmqp::Protocol::MsgGroupId* msgGroupId) const
 {
@@ -647,6 +673,7 @@ int PutMessageIterator::next()
                              haveMPs,
                              haveNewMPs,
                              cat,
+                             0,  // no dictionary hint
                              d_bufferFactory_p,
                              d_allocator_p);
 
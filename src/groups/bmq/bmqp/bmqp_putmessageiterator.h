@@ -397,6 +397,18 @@ class PutMessageIterator {
     /// `next()` returned 1.
     int loadMessagePayload(bdlbb::Blob* blob) const;
 
+    /// Load into the specified `blob` the address of the blob holding the
+    /// payload for the message currently pointed to by this iterator, and
+    /// into the specified `position` the position of the payload in that
+    /// blob, the payload being `messagePayloadSize()` bytes long.  Return
+    /// zero on success, and a non-zero value otherwise.  Behavior is
+    /// undefined unless latest call to `next()` returned 1.  Note that,
+    /// unlike `loadMessagePayload`, this method neither copies nor
+    /// allocates: the loaded `blob` belongs to this iterator and is valid
+    /// until the next call to `next()`, `reset()` or `clear()`.
+    int loadMessagePayloadView(const bdlbb::Blob** blob,
+                               bmqu::BlobPosition* position) const;
+
     /// Load into the specified `msgGroupId` the Group Id associated with
     /// the message currently pointed to by this iterator.  Return `true` if
     /// the load was successfully or `false` otherwise.  Behavior is
@@ -409,6 +409,48 @@ int SchemaLearner::read(Context&                     context,
     return rc;
 }
 
+int SchemaLearner::read(Context&                     context,
+                        MessagePropertiesView*       view,
+                        const MessagePropertiesInfo& messagePropertiesInfo,
+                        const bdlbb::Blob&           blob) const
+{
+    enum RcEnum {
+        rc_SUCCESS        = 0,
+        rc_NO_SCHEMA      = -1,
+        rc_UNKNOWN_SCHEMA = -2,
+        rc_PARSING_ERROR  = -3
+    };
+
+    BSLS_ASSERT_SAFE(view);
+
+    view->clear();
+
+    const SchemaIdType inputSchemaId = messagePropertiesInfo.schemaId();
+
+    if (!isPresentAndValid(inputSchemaId)) {
+        // Invalid schema or old style
+        return rc_NO_SCHEMA;  // RETURN
+    }
+
+    HandlesMap::const_iterator cit = context->d_handles.find(inputSchemaId);
+
+    if (cit == context->d_handles.end() || !cit->second->d_schema_sp) {
+        return rc_UNKNOWN_SCHEMA;  // RETURN
+    }
+
+    if (messagePropertiesInfo.isRecycled()) {
+        // Let the caller forget and learn the schema.
+        return rc_UNKNOWN_SCHEMA;  // RETURN
+    }
+
+    const int rc = view->reset(blob, cit->second->d_schema_sp);
+    if (rc != 0) {
+        return 10 * rc + rc_PARSING_ERROR;  // RETURN
+    }
+
+    return rc_SUCCESS;
+}
+
 // CLASS METHODS
 bool SchemaLearner::isPresentAndValid(SchemaIdType schemaId)
 {
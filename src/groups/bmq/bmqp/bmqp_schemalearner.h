@@ -87,6 +87,7 @@
 // BMQ
 
 #include <bmqp_messageproperties.h>
+#include <bmqp_messagepropertiesview.h>
 #include <bmqp_protocol.h>
 
 // BDE
@@ -213,6 +214,17 @@ class SchemaLearner {
              const MessagePropertiesInfo& messagePropertiesInfo,
              const bdlbb::Blob&           blob) const;
 
+    /// Set up the specified `view` to access Message Properties in the
+    /// specified `blob` if the Schema denoted by the specified
+    /// `messagePropertiesInfo` is already known within the specified
+    /// `context`.  Return 0 on success.  Otherwise, return non-zero and
+    /// leave it up to the caller to `read` `MessageProperties` instead,
+    /// which learns the Schema.  Do not allocate memory.
+    int read(Context&                     context,
+             MessagePropertiesView*       view,
+             const MessagePropertiesInfo& messagePropertiesInfo,
+             const bdlbb::Blob&           blob) const;
+
     /// If the specified `input` indicates recycling, reset previously learned
     /// schema accumulated in the specified `context` and associated with the
     /// id in `input`.  Return the address of the corresponding schema holder,
@@ -17,6 +17,7 @@
 
 // BMQ
 #include <bmqp_messageproperties.h>
+#include <bmqp_messagepropertiesview.h>
 #include <bmqp_protocolutil.h>
 #include <bmqp_schemalearner.h>
 
@@ -473,6 +474,60 @@ static void test7_removeBeforeRead()
     }
 }
 
+static void test8_readView()
+{
+    // Read into 'MessagePropertiesView' only once the schema is learned and
+    // until the schema is recycled.
+    bdlbb::PooledBlobBufferFactory bufferFactory(
+        128,
+        bmqtst::TestHelperUtil::allocator());
+    bmqp::SchemaLearner theLearner(bmqtst::TestHelperUtil::allocator());
+    bmqp::SchemaLearner::Context context(theLearner.createContext());
+
+    bmqp::MessageProperties     in(bmqtst::TestHelperUtil::allocator());
+    bmqp::MessagePropertiesInfo input(true, 1, false);
+    bmqp::MessagePropertiesInfo recycledInput(true, 1, true);
+
+    in.setPropertyAsString("x", "x");
+    in.setPropertyAsInt32("y", 13);
+
+    const bdlbb::Blob           blob = in.streamOut(&bufferFactory, input);
+    bmqp::MessagePropertiesView view(bmqtst::TestHelperUtil::allocator());
+    bmqp::MessageProperties     out(bmqtst::TestHelperUtil::allocator());
+
+    // Unknown schema
+    BMQTST_ASSERT_NE(0, theLearner.read(context, &view, input, blob));
+
+    // No schema
+    BMQTST_ASSERT_NE(
+        0,
+        theLearner.read(context,
+                        &view,
+                        bmqp::MessagePropertiesInfo::makeInvalidSchema(),
+                        blob));
+
+    // Learn the schema
+    BMQTST_ASSERT_EQ(0, theLearner.read(context, &out, input, blob));
+
+    BMQTST_ASSERT_EQ(0, theLearner.read(context, &view, input, blob));
+    BMQTST_ASSERT_EQ(2, view.numProperties());
+    BMQTST_ASSERT_EQ(
+        "x",
+        view.getPropertyRef("x", bmqtst::TestHelperUtil::allocator())
+            .theString());
+    BMQTST_ASSERT_EQ(
+        13,
+        view.getPropertyRef("y", bmqtst::TestHelperUtil::allocator())
+            .theInteger());
+
+    // Recycled schema
+    BMQTST_ASSERT_NE(0, theLearner.read(context, &view, recycledInput, blob));
+    BMQTST_ASSERT_EQ(0, view.numProperties());
+
+    BMQTST_ASSERT_EQ(0, theLearner.read(context, &out, recycledInput, blob));
+    BMQTST_ASSERT_EQ(0, theLearner.read(context, &view, input, blob));
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -484,6 +539,7 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 8: test8_readView(); break;
     case 7: test7_removeBeforeRead(); break;
     case 6: test6_partialRead(); break;
     case 5: test5_emptyMPs(); break;
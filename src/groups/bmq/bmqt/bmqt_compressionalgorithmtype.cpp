@@ -54,6 +54,8 @@ CompressionAlgorithmType::toAscii(CompressionAlgorithmType::Enum value)
         BMQT_CASE(UNKNOWN)
         BMQT_CASE(NONE)
         BMQT_CASE(ZLIB)
+        BMQT_CASE(ZSTD)
+        BMQT_CASE(LZ4)
     default: return "(* UNKNOWN *)";
     }
 
@@ -73,6 +75,8 @@ bool CompressionAlgorithmType::fromAscii(CompressionAlgorithmType::Enum* out,
 
     BMQT_CHECKVALUE(NONE);
     BMQT_CHECKVALUE(ZLIB);
+    BMQT_CHECKVALUE(ZSTD);
+    BMQT_CHECKVALUE(LZ4);
 
     // Invalid string
     return false;
@@ -88,7 +92,8 @@ bool CompressionAlgorithmType::isValid(const bsl::string* str,
         return true;  // RETURN
     }
 
-    stream << "Error: compressionAlgorithmType must be one of [NONE, ZLIB]\n";
+    stream << "Error: compressionAlgorithmType must be one of "
+           << "[NONE, ZLIB, ZSTD, LZ4]\n";
     return false;
 }
 
@@ -26,6 +26,13 @@
 ///
 ///   - *NONE*: No compression algorithm was specified
 ///   - *ZLIB*: The compression algorithm is ZLIB
+///   - *ZSTD*: The compression algorithm is Zstandard
+///   - *LZ4*: The compression algorithm is LZ4 (frame format)
+///
+/// Note that a message compressed with a given algorithm can only be
+/// consumed by a client library supporting that algorithm; older libraries
+/// reject messages whose compression algorithm type is above the highest
+/// type they know about.
 
 // BMQ
 
@@ -43,7 +50,13 @@ namespace bmqt {
 /// This struct defines various types of compression algorithms.
 struct CompressionAlgorithmType {
     // TYPES
-    enum Enum { e_UNKNOWN = -1, e_NONE = 0, e_ZLIB = 1 };
+    enum Enum {
+        e_UNKNOWN = -1,
+        e_NONE    = 0,
+        e_ZLIB    = 1,
+        e_ZSTD    = 2,
+        e_LZ4     = 3
+    };
 
     // CONSTANTS
 
@@ -55,7 +68,7 @@ struct CompressionAlgorithmType {
     /// NOTE: This value must always be equal to the highest type in the
     /// enum because it is being used as an upper bound to verify that a
     /// header's `CompressionAlgorithmType` field is a supported type.
-    static const int k_HIGHEST_SUPPORTED_TYPE = e_ZLIB;
+    static const int k_HIGHEST_SUPPORTED_TYPE = e_LZ4;
 
     // CLASS METHODS
 
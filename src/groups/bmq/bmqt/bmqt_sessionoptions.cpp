@@ -50,6 +50,9 @@ SessionOptions::SessionOptions(bslma::Allocator* allocator)
 , d_dtTracer_sp(NULL)
 , d_userAgentPrefix(allocator)
 , d_channelWriteTimeout(k_CHANNEL_WRITE_DEFAULT_TIMEOUT_SEC)
+, d_putBatchingMaxDelay()
+, d_putBatchingMaxMessages(k_PUT_BATCHING_DEFAULT_MAX_MESSAGES)
+, d_putBatchingMaxBytes(k_PUT_BATCHING_DEFAULT_MAX_BYTES)
 {
     // NOTHING
 }
@@ -75,6 +78,9 @@ SessionOptions::SessionOptions(const SessionOptions& other,
 , d_dtTracer_sp(other.tracer())
 , d_userAgentPrefix(other.userAgentPrefix(), allocator)
 , d_channelWriteTimeout(other.d_channelWriteTimeout)
+, d_putBatchingMaxDelay(other.putBatchingMaxDelay())
+, d_putBatchingMaxMessages(other.putBatchingMaxMessages())
+, d_putBatchingMaxBytes(other.putBatchingMaxBytes())
 {
     // NOTHING
 }
@@ -113,6 +119,10 @@ bsl::ostream& SessionOptions::print(bsl::ostream& stream,
                            d_hostHealthMonitor_sp != NULL);
     printer.printAttribute("hasDistributedTracing", d_dtTracer_sp != NULL);
     printer.printAttribute("userAgentPrefix", d_userAgentPrefix);
+    printer.printAttribute("putBatchingMaxDelay",
+                           d_putBatchingMaxDelay.totalSecondsAsDouble());
+    printer.printAttribute("putBatchingMaxMessages", d_putBatchingMaxMessages);
+    printer.printAttribute("putBatchingMaxBytes", d_putBatchingMaxBytes);
     printer.end();
 
     return stream;
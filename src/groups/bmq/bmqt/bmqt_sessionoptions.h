@@ -128,6 +128,20 @@
 ///     characters long.  This is provided for libraries that are wrapping this
 ///     SDK.  Applications directly using the SDK are encouraged *NOT* to set
 ///     this value.
+///
+///   - *putBatchingMaxDelay*,
+///     *putBatchingMaxMessages*,
+///     *putBatchingMaxBytes*:
+///     Parameters to configure the batching of the PUT messages posted to the
+///     session.  When batching is enabled, the messages of the events posted
+///     by the application are coalesced into a single event, which is written
+///     to the broker once it holds `putBatchingMaxMessages` messages or
+///     `putBatchingMaxBytes` bytes, and at the latest `putBatchingMaxDelay`
+///     after the first of its messages was posted.  This reduces the number
+///     of writes to the channel for applications posting one small message
+///     per event, at the cost of up to `putBatchingMaxDelay` of additional
+///     latency.  Batching is disabled by default (`putBatchingMaxDelay` of
+///     0).
 
 // BMQ
 
@@ -184,6 +198,12 @@ class SessionOptions {
 
     static const unsigned int k_CHANNEL_WRITE_DEFAULT_TIMEOUT_SEC = 5;
 
+    /// The default maximum number of messages in a batch of PUT messages.
+    static const int k_PUT_BATCHING_DEFAULT_MAX_MESSAGES = 256;
+
+    /// The default maximum size (in bytes) of a batch of PUT messages.
+    static const int k_PUT_BATCHING_DEFAULT_MAX_BYTES = 64 * 1024;
+
   private:
     // DATA
 
@@ -242,6 +262,15 @@ class SessionOptions {
     /// buffered data.
     bsls::TimeInterval d_channelWriteTimeout;
 
+    /// Maximum time a posted PUT message is held in a batch before being
+    /// written to the channel, or 0 if PUT messages are not batched.
+    bsls::TimeInterval d_putBatchingMaxDelay;
+
+    /// Number of PUT messages, respectively bytes, in a batch at which it is
+    /// written to the channel.
+    int d_putBatchingMaxMessages;
+    int d_putBatchingMaxBytes;
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(SessionOptions, bslma::UsesBslmaAllocator)
@@ -338,6 +367,17 @@ class SessionOptions {
     /// Zero means no blocking.
     SessionOptions& setChannelWriteTimeout(const bsls::TimeInterval& value);
 
+    /// Configure the batching of the PUT messages posted to the session
+    /// with the specified `maxDelay`, `maxMessages` and `maxBytes` values.
+    /// A `maxDelay` of 0 disables batching.  Refer to the component level
+    /// documentation for explanation of those parameters.  The behavior is
+    /// undefined unless `0 <= maxDelay`, `0 < maxMessages` and
+    /// `0 < maxBytes`.
+    SessionOptions&
+    configurePutBatching(const bsls::TimeInterval& maxDelay,
+                         int maxMessages = k_PUT_BATCHING_DEFAULT_MAX_MESSAGES,
+                         int maxBytes    = k_PUT_BATCHING_DEFAULT_MAX_BYTES);
+
     // ACCESSORS
 
     /// Get the broker URI.
@@ -394,6 +434,16 @@ class SessionOptions {
     /// Get the timeout to block `post` when at high watermark.
     const bsls::TimeInterval& channelWriteTimeout() const;
 
+    /// Get the maximum delay of a PUT message in a batch, 0 if PUT messages
+    /// are not batched.
+    const bsls::TimeInterval& putBatchingMaxDelay() const;
+
+    /// Get the number of PUT messages at which a batch is written.
+    int putBatchingMaxMessages() const;
+
+    /// Get the size (in bytes) at which a batch of PUT messages is written.
+    int putBatchingMaxBytes() const;
+
     /// Format this object to the specified output `stream` at the (absolute
     /// value of) the optionally specified indentation `level` and return a
     /// reference to `stream`.  If `level` is specified, optionally specify
@@ -578,6 +628,23 @@ SessionOptions::setChannelWriteTimeout(const bsls::TimeInterval& value)
     return *this;
 }
 
+inline SessionOptions&
+SessionOptions::configurePutBatching(const bsls::TimeInterval& maxDelay,
+                                     int                       maxMessages,
+                                     int                       maxBytes)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_OPT(maxDelay >= bsls::TimeInterval());
+    BSLS_ASSERT_OPT(0 < maxMessages);
+    BSLS_ASSERT_OPT(0 < maxBytes);
+
+    d_putBatchingMaxDelay    = maxDelay;
+    d_putBatchingMaxMessages = maxMessages;
+    d_putBatchingMaxBytes    = maxBytes;
+
+    return *this;
+}
+
 // ACCESSORS
 inline const bsl::string& SessionOptions::brokerUri() const
 {
@@ -676,6 +743,21 @@ inline const bsls::TimeInterval& SessionOptions::channelWriteTimeout() const
     return d_channelWriteTimeout;
 }
 
+inline const bsls::TimeInterval& SessionOptions::putBatchingMaxDelay() const
+{
+    return d_putBatchingMaxDelay;
+}
+
+inline int SessionOptions::putBatchingMaxMessages() const
+{
+    return d_putBatchingMaxMessages;
+}
+
+inline int SessionOptions::putBatchingMaxBytes() const
+{
+    return d_putBatchingMaxBytes;
+}
+
 }  // close package namespace
 
 // --------------------
@@ -699,7 +781,10 @@ inline bool bmqt::operator==(const bmqt::SessionOptions& lhs,
            lhs.hostHealthMonitor() == rhs.hostHealthMonitor() &&
            lhs.traceContext() == rhs.traceContext() &&
            lhs.tracer() == rhs.tracer() &&
-           lhs.userAgentPrefix() == rhs.userAgentPrefix();
+           lhs.userAgentPrefix() == rhs.userAgentPrefix() &&
+           lhs.putBatchingMaxDelay() == rhs.putBatchingMaxDelay() &&
+           lhs.putBatchingMaxMessages() == rhs.putBatchingMaxMessages() &&
+           lhs.putBatchingMaxBytes() == rhs.putBatchingMaxBytes();
 }
 
 inline bool bmqt::operator!=(const bmqt::SessionOptions& lhs,
@@ -719,7 +804,10 @@ inline bool bmqt::operator!=(const bmqt::SessionOptions& lhs,
            lhs.hostHealthMonitor() != rhs.hostHealthMonitor() ||
            lhs.traceContext() != rhs.traceContext() ||
            lhs.tracer() != rhs.tracer() ||
-           lhs.userAgentPrefix() != rhs.userAgentPrefix();
+           lhs.userAgentPrefix() != rhs.userAgentPrefix() ||
+           lhs.putBatchingMaxDelay() != rhs.putBatchingMaxDelay() ||
+           lhs.putBatchingMaxMessages() != rhs.putBatchingMaxMessages() ||
+           lhs.putBatchingMaxBytes() != rhs.putBatchingMaxBytes();
 }
 
 inline bsl::ostream& bmqt::operator<<(bsl::ostream&               stream,
@@ -65,7 +65,9 @@ static void test2_printTest()
         "openQueueTimeout = 300 configureQueueTimeout = 300 "
         "closeQueueTimeout = 300 eventQueueLowWatermark = 50 "
         "eventQueueHighWatermark = 2000 hasHostHealthMonitor = false "
-        "hasDistributedTracing = false userAgentPrefix = \"\" ]";
+        "hasDistributedTracing = false userAgentPrefix = \"\" "
+        "putBatchingMaxDelay = 0 putBatchingMaxMessages = 256 "
+        "putBatchingMaxBytes = 65536 ]";
     bmqtst::TestHelper::printTestName("PRINT");
     PV("Testing print");
     bmqu::MemOutStream stream(bmqtst::TestHelperUtil::allocator());
@@ -170,6 +172,21 @@ static void test3_setterGetterAndCopyTest()
     obj.setUserAgentPrefix(userAgentPrefix);
     BMQTST_ASSERT_EQ(obj.userAgentPrefix(), userAgentPrefix);
 
+    PVV("Checking setter and getter for putBatchingMaxDelay, "
+        "putBatchingMaxMessages, putBatchingMaxBytes");
+    const bsls::TimeInterval putBatchingMaxDelay(0, 500 * 1000);  // 500us
+    const int                putBatchingMaxMessages = 32;
+    const int                putBatchingMaxBytes    = 16 * 1024;
+    BMQTST_ASSERT_EQ(obj.putBatchingMaxDelay(), bsls::TimeInterval());
+    BMQTST_ASSERT_NE(obj.putBatchingMaxMessages(), putBatchingMaxMessages);
+    BMQTST_ASSERT_NE(obj.putBatchingMaxBytes(), putBatchingMaxBytes);
+    obj.configurePutBatching(putBatchingMaxDelay,
+                             putBatchingMaxMessages,
+                             putBatchingMaxBytes);
+    BMQTST_ASSERT_EQ(obj.putBatchingMaxDelay(), putBatchingMaxDelay);
+    BMQTST_ASSERT_EQ(obj.putBatchingMaxMessages(), putBatchingMaxMessages);
+    BMQTST_ASSERT_EQ(obj.putBatchingMaxBytes(), putBatchingMaxBytes);
+
     PVV("Copy constructor test");
     bmqt::SessionOptions objCopy(obj, bmqtst::TestHelperUtil::allocator());
     BMQTST_ASSERT_EQ(objCopy.brokerUri(), brokerUri);
@@ -185,6 +202,9 @@ static void test3_setterGetterAndCopyTest()
     BMQTST_ASSERT_EQ(objCopy.eventQueueHighWatermark(),
                      eventQueueHighWatermark);
     BMQTST_ASSERT_EQ(objCopy.userAgentPrefix(), userAgentPrefix);
+    BMQTST_ASSERT_EQ(objCopy.putBatchingMaxDelay(), putBatchingMaxDelay);
+    BMQTST_ASSERT_EQ(objCopy.putBatchingMaxMessages(), putBatchingMaxMessages);
+    BMQTST_ASSERT_EQ(objCopy.putBatchingMaxBytes(), putBatchingMaxBytes);
 }
 // ============================================================================
 //                                 MAIN PROGRAM
@@ -1529,7 +1529,8 @@ void ClientSession::onConfirmEvent(const mqbi::DispatcherConfirmEvent& event)
 
             queueHandle->confirmMessage(getEventSource().get(),
                                         confIt.message().messageGUID(),
-                                        subId);
+                                        subId,
+                                        &d_dispatchBatch);
         }
         else {
             BMQ_LOGTHROTTLE_WARN
@@ -1543,6 +1544,9 @@ void ClientSession::onConfirmEvent(const mqbi::DispatcherConfirmEvent& event)
         }
     }
 
+    // Dispatch the CONFIRMs accumulated for the last queue
+    d_dispatchBatch.flush();
+
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(rc < 0)) {
         BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
 
@@ -2160,11 +2164,16 @@ void ClientSession::onPutEvent(const mqbi::DispatcherPutEvent& event)
                        << "]:\n"
                        << bmqu::BlobStartHexDumper(appDataSp.get(), 64);
 
+        // Consecutive PUTs for the same queue are dispatched together
         queueStatePtr->d_handle_p->postMessage(putIt.header(),
                                                appDataSp,
-                                               optionsSp);
+                                               optionsSp,
+                                               &d_dispatchBatch);
     }
 
+    // Dispatch the PUTs accumulated for the last queue
+    d_dispatchBatch.flush();
+
     // Check if the PUT event was valid
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(rc < 0)) {
         BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
@@ -2436,6 +2445,7 @@ ClientSession::ClientSession(
 , d_scheduler_p(scheduler)
 , d_periodicUnconfirmedCheckHandler()
 , d_shutdownChain(allocator)
+, d_dispatchBatch(allocator)
 {
     // Register this client to the dispatcher
     mqbi::Dispatcher::ProcessorHandle processor = dispatcher->registerClient(
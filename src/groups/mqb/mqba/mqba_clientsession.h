@@ -353,6 +353,12 @@ class ClientSession : public mqbnet::Session,
     /// execution of the queue handle deconfigure callbacks.
     bmqu::OperationChain d_shutdownChain;
 
+    /// Events posted to queues while processing an inbound PUT or CONFIRM
+    /// event, so that consecutive messages for the same queue are
+    /// dispatched with a single enqueue.  Flushed once the inbound event
+    /// has been processed.
+    mqbi::DispatcherEventBatch d_dispatchBatch;
+
   private:
     // NOT IMPLEMENTED
 
@@ -498,6 +498,9 @@ class MyMockQueueHandle : public mqbmock::QueueHandle {
 
     // MANIPULATORS
 
+    // Do not hide the batched overload, which forwards to the one below.
+    using mqbmock::QueueHandle::postMessage;
+
     /// Called by the framework when a new message with the specified
     /// `putHeader`, `appData` and `options` is sent upstream.  We capture
     /// the message.
@@ -26,6 +26,7 @@
 #include <bdlf_bind.h>
 #include <bdlf_placeholder.h>
 #include <bdlmt_eventscheduler.h>
+#include <bsl_algorithm.h>
 #include <bsl_cstddef.h>
 #include <bsl_functional.h>
 #include <bsl_iostream.h>
@@ -43,6 +44,10 @@ namespace mqba {
 namespace {
 const double k_QUEUE_STUCK_INTERVAL = 3 * 60.0;
 const int    k_POOL_GROW_BY         = 1024;
+
+/// Minimum size of the ring buffer of a lock-free processor queue, so that
+/// a low watermark of 0 doesn't make every event go through its overflow.
+const int k_MIN_RING_BUFFER_SIZE = 1024;
 }  // close unnamed namespace
 
 // -------------------------
@@ -267,8 +272,18 @@ Dispatcher::queueCreator(mqbi::DispatcherClientType::Enum             type,
     os << "ProcessorQueue " << processorId << " for '" << type << "'";
     bsl::string queueName(os.str().data(), os.str().length());
 
-    ProcessorPool::Queue* queue = new (*allocator)
-        ProcessorPool::Queue(config.queueSizeLowWatermark(), allocator);
+    // The low watermark is used as the initial capacity of the queue or, in
+    // lock-free mode, as the size of its ring buffer, past which events
+    // spill over to a mutex-protected list.
+    const int capacity = config.lockFreeQueue()
+                             ? bsl::max(config.queueSizeLowWatermark(),
+                                        k_MIN_RING_BUFFER_SIZE)
+                             : config.queueSizeLowWatermark();
+
+    ProcessorPool::Queue* queue = new (*allocator) ProcessorPool::Queue(
+        bmqc::MultiQueueThreadPoolQueueOptions(capacity,
+                                               config.lockFreeQueue()),
+        allocator);
 
     queue->setWatermarks(config.queueSizeLowWatermark(),
                          config.queueSizeHighWatermark());
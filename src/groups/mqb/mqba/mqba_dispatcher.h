@@ -409,6 +409,13 @@ class Dispatcher BSLS_KEYWORD_FINAL : public mqbi::Dispatcher {
                        mqbi::Dispatcher::ProcessorHandle      handle)
         BSLS_KEYWORD_OVERRIDE;
 
+    /// Dispatch all the specified `events`, in order, to the specified
+    /// `destination` with a single enqueue to the processor in charge of
+    /// `destination`, and clear `events`.
+    void
+    dispatchEvents(bsl::vector<mqbi::Dispatcher::DispatcherEventSp>* events,
+                   mqbi::DispatcherClient* destination) BSLS_KEYWORD_OVERRIDE;
+
     /// Execute the specified `functor` in the processors in charge of
     /// clients of the specified `type`, and invoke the optionally specified
     /// `doneCallback` (if any) when all the relevant processors are done
@@ -549,6 +556,44 @@ Dispatcher::dispatchEvent(mqbi::Dispatcher::DispatcherEventRvRef event,
     }
 }
 
+inline void Dispatcher::dispatchEvents(
+    bsl::vector<mqbi::Dispatcher::DispatcherEventSp>* events,
+    mqbi::DispatcherClient*                           destination)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(events);
+    BSLS_ASSERT_SAFE(destination);
+
+    const mqbi::DispatcherClientType::Enum type =
+        destination->dispatcherClientData().clientType();
+    const mqbi::Dispatcher::ProcessorHandle handle =
+        destination->dispatcherClientData().processorHandle();
+    BSLS_ASSERT_SAFE(handle != mqbi::Dispatcher::k_INVALID_PROCESSOR_HANDLE);
+
+    BALL_LOG_TRACE << "Enqueuing " << events->size() << " Events to '"
+                   << destination->description() << "'";
+
+    for (size_t i = 0; i < events->size(); ++i) {
+        (*events)[i]->setDestination(destination);
+    }
+
+    switch (type) {
+    case mqbi::DispatcherClientType::e_SESSION:
+    case mqbi::DispatcherClientType::e_QUEUE:
+    case mqbi::DispatcherClientType::e_CLUSTER: {
+        d_contexts[type]->d_processorPool_mp->enqueueEvents(events, handle);
+    } break;
+    case mqbi::DispatcherClientType::e_UNDEFINED:
+    default: {
+        BSLS_ASSERT_OPT(false && "Invalid destination type");
+    }
+    }
+
+    // Events which could not be enqueued (i.e. the processor is stopping)
+    // are dropped, as with 'dispatchEvent'.
+    events->clear();
+}
+
 inline void Dispatcher::execute(const mqbi::Dispatcher::VoidFunctor& functor,
                                 mqbi::DispatcherClient*              client,
                                 mqbi::DispatcherEventType::Enum      type)
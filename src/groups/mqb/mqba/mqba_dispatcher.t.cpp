@@ -30,6 +30,8 @@
 #include <bdlf_bind.h>
 #include <bdlmt_eventscheduler.h>
 #include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
 #include <bslmt_semaphore.h>
 #include <bslmt_threadutil.h>
 #include <bsls_assert.h>
@@ -83,6 +85,26 @@ static mqbcfg::DispatcherConfig makeConfig()
     return config;
 }
 
+/// Return a configuration having one processor of each type, with queues
+/// large enough not to reach their watermarks during benchmarks, and which
+/// are lock-free if the specified `lockFreeQueue` is `true`.
+static mqbcfg::DispatcherConfig makeBenchmarkConfig(bool lockFreeQueue)
+{
+    mqbcfg::DispatcherConfig config = makeConfig();
+
+    mqbcfg::DispatcherProcessorParameters params;
+    params.queueSize()              = 10000000;
+    params.queueSizeLowWatermark()  = 100000;
+    params.queueSizeHighWatermark() = 5000000;
+    params.lockFreeQueue()          = lockFreeQueue;
+
+    config.sessions().processorConfig() = params;
+    config.queues().processorConfig()   = params;
+    config.clusters().processorConfig() = params;
+
+    return config;
+}
+
 // ==================
 // struct Synchronize
 // ==================
@@ -561,6 +583,144 @@ static void test4_eventSource()
     eventScheduler.stop();
 }
 
+static void test5_dispatchEvents()
+// ------------------------------------------------------------------------
+// DISPATCH EVENTS
+//
+// Concerns:
+//   1. mqba::Dispatcher::dispatchEvents delivers all the events, in order,
+//      to the destination, and clears the input vector.
+//   2. mqbi::DispatcherEventBatch dispatches the events added to it, in
+//      order, when flushed, when the destination changes and when it
+//      reaches its maximum size.
+//   3. Both hold with the default and with the lock-free processor queues.
+//
+// Testing:
+//   mqba::Dispatcher::dispatchEvents
+//   mqbi::DispatcherEventBatch
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("DISPATCH EVENTS");
+
+    bslma::Allocator* alloc = bmqtst::TestHelperUtil::allocator();
+
+    struct Local {
+        static void callbackFn(bsl::vector<int>* values_p, int value)
+        {
+            // PRECONDITIONS
+            BSLS_ASSERT(values_p);
+            values_p->push_back(value);
+        }
+
+        static bsl::shared_ptr<mqbi::DispatcherEvent>
+        makeEvent(mqbi::DispatcherClient* client,
+                  bsl::vector<int>*       values_p,
+                  int                     value,
+                  bslma::Allocator*       allocator)
+        {
+            bsl::shared_ptr<mqbi::DispatcherEvent> event = client->getEvent();
+            event->setType(mqbi::DispatcherEventType::e_CALLBACK);
+            event->setCallback(bdlf::BindUtil::bindS(allocator,
+                                                     &Local::callbackFn,
+                                                     values_p,
+                                                     value));
+            return event;
+        }
+    };
+
+    // Create and start scheduler
+    bdlmt::EventScheduler eventScheduler(bsls::SystemClockType::e_MONOTONIC,
+                                         alloc);
+    eventScheduler.start();
+
+    for (int lockFree = 0; lockFree < 2; ++lockFree) {
+        PVV("Lock-free queues: " << lockFree);
+
+        mqbcfg::DispatcherConfig dispatcherConfig = makeBenchmarkConfig(
+            lockFree != 0);
+        mqba::Dispatcher dispatcher(dispatcherConfig, &eventScheduler, alloc);
+
+        bsl::stringstream startErr(alloc);
+        BMQTST_ASSERT_EQ(dispatcher.start(startErr), 0);
+
+        mqbmock::DispatcherClient client1(alloc);
+        mqbmock::DispatcherClient client2(alloc);
+        dispatcher.registerClient(&client1,
+                                  mqbi::DispatcherClientType::e_QUEUE);
+        dispatcher.registerClient(&client2,
+                                  mqbi::DispatcherClientType::e_QUEUE);
+
+        // 1.
+        {
+            const int k_NUM_EVENTS = 100;
+
+            bsl::vector<int>                                    values(alloc);
+            bsl::vector<bsl::shared_ptr<mqbi::DispatcherEvent> > events(
+                alloc);
+            for (int i = 0; i < k_NUM_EVENTS; ++i) {
+                events.push_back(
+                    Local::makeEvent(&client1, &values, i, alloc));
+            }
+
+            dispatcher.dispatchEvents(&events, &client1);
+            BMQTST_ASSERT(events.empty());
+
+            dispatcher.synchronize(&client1);
+            BMQTST_ASSERT_EQ(values.size(),
+                             static_cast<size_t>(k_NUM_EVENTS));
+            for (int i = 0; i < static_cast<int>(values.size()); ++i) {
+                BMQTST_ASSERT_EQ_D(i, values[i], i);
+            }
+        }
+
+        // 2.
+        {
+            const int k_NUM_EVENTS =
+                3 * mqbi::DispatcherEventBatch::k_MAX_NUM_EVENTS + 1;
+
+            bsl::vector<int>           values1(alloc);
+            bsl::vector<int>           values2(alloc);
+            mqbi::DispatcherEventBatch batch(alloc);
+
+            for (int i = 0; i < k_NUM_EVENTS; ++i) {
+                // Switch destination every 50 events
+                const bool first = (i / 50) % 2 == 0;
+
+                mqbi::DispatcherClient* client = first ? &client1 : &client2;
+                bsl::shared_ptr<mqbi::DispatcherEvent> event =
+                    Local::makeEvent(client,
+                                     first ? &values1 : &values2,
+                                     i,
+                                     alloc);
+                batch.add(bslmf::MovableRefUtil::move(event), client);
+                BMQTST_ASSERT_LT(batch.numEvents(),
+                                 mqbi::DispatcherEventBatch::k_MAX_NUM_EVENTS);
+            }
+            BMQTST_ASSERT_GT(batch.numEvents(), 0);
+
+            batch.flush();
+            BMQTST_ASSERT_EQ(batch.numEvents(), 0);
+
+            dispatcher.synchronize(&client1);
+            dispatcher.synchronize(&client2);
+            BMQTST_ASSERT_EQ(values1.size() + values2.size(),
+                             static_cast<size_t>(k_NUM_EVENTS));
+            for (size_t i = 1; i < values1.size(); ++i) {
+                BMQTST_ASSERT_LT_D(i, values1[i - 1], values1[i]);
+            }
+            for (size_t i = 1; i < values2.size(); ++i) {
+                BMQTST_ASSERT_LT_D(i, values2[i - 1], values2[i]);
+            }
+        }
+
+        dispatcher.unregisterClient(&client1);
+        dispatcher.unregisterClient(&client2);
+        dispatcher.stop();
+    }
+
+    eventScheduler.stop();
+}
+
 static void testN1_inDispatcherThread()
 {
     const size_t k_ITERS_NUM = 10000000;
@@ -629,6 +789,169 @@ static void testN1_inDispatcherThread()
     eventScheduler.stop();
 }
 
+static void testN2_dispatchEventBenchmark()
+// ------------------------------------------------------------------------
+// DISPATCH EVENT BENCHMARK
+//
+// Concerns:
+//   Compare the mutex-based and the lock-free processor queues on:
+//   a) the throughput of 'dispatchEvent' with several concurrent producers
+//      targeting the same processor.
+//   b) the latency of waking up an idle processor, measured from the call
+//      to 'dispatchEvent' to the execution of the event's callback.
+//
+// Plan:
+//   For each queue implementation:
+//   a) Start 'k_NUM_PRODUCERS' threads, each dispatching 'k_NUM_EVENTS'
+//      callback events to the same client, and measure the time until all
+//      events have been processed.
+//   b) 'k_NUM_ROUNDS' times, let the processor go idle, dispatch a single
+//      event and measure the time until its callback is invoked.
+//
+// Testing:
+//   Performance
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("DISPATCH EVENT BENCHMARK");
+
+    bslma::Allocator* alloc = bmqtst::TestHelperUtil::allocator();
+
+    const int k_NUM_PRODUCERS = 4;
+    const int k_NUM_EVENTS    = 1000000;
+    const int k_NUM_ROUNDS    = 1000;
+
+    struct Local {
+        static void countFn(int* count, int total, bslmt::Semaphore* done_p)
+        {
+            // executed by the *DISPATCHER* thread
+            if (++(*count) == total) {
+                done_p->post();
+            }
+        }
+
+        static void wakeUpFn(bsls::Types::Int64* wakeUpTime,
+                             bslmt::Semaphore*   done_p)
+        {
+            // executed by the *DISPATCHER* thread
+            *wakeUpTime = bsls::TimeUtil::getTimer();
+            done_p->post();
+        }
+
+        static void
+        dispatchCallback(mqba::Dispatcher*                    obj,
+                         mqbi::DispatcherClient*              client,
+                         const mqbi::Dispatcher::VoidFunctor& cb)
+        {
+            bsl::shared_ptr<mqbi::DispatcherEvent> event =
+                obj->getDefaultEventSource()->getEvent();
+            event->setType(mqbi::DispatcherEventType::e_CALLBACK);
+            event->setCallback(cb);
+            obj->dispatchEvent(bslmf::MovableRefUtil::move(event), client);
+        }
+
+        static void producerFn(mqba::Dispatcher*                    obj,
+                               mqbi::DispatcherClient*              client,
+                               int                                  numEvents,
+                               const mqbi::Dispatcher::VoidFunctor& cb)
+        {
+            for (int i = 0; i < numEvents; ++i) {
+                dispatchCallback(obj, client, cb);
+            }
+        }
+    };
+
+    bdlmt::EventScheduler eventScheduler(bsls::SystemClockType::e_MONOTONIC,
+                                         alloc);
+    eventScheduler.start();
+
+    for (int lockFree = 0; lockFree < 2; ++lockFree) {
+        const char* mode = lockFree ? " (lock-free queue)"
+                                    : " (mutex-based queue)";
+
+        mqbcfg::DispatcherConfig dispatcherConfig = makeBenchmarkConfig(
+            lockFree);
+        mqba::Dispatcher obj(dispatcherConfig, &eventScheduler, alloc);
+
+        bsl::stringstream startErr(alloc);
+        const int         rc = obj.start(startErr);
+        BMQTST_ASSERT(rc == 0);
+
+        TestDispatcherClient cli(&obj);
+        obj.registerClient(&cli, mqbi::DispatcherClientType::e_SESSION);
+
+        // a) Throughput
+        {
+            int              count = 0;
+            bslmt::Semaphore done;
+
+            const mqbi::Dispatcher::VoidFunctor cb = bdlf::BindUtil::bindS(
+                alloc,
+                &Local::countFn,
+                &count,
+                k_NUM_PRODUCERS * k_NUM_EVENTS,
+                &done);
+
+            bsl::vector<bslmt::ThreadUtil::Handle> handles(k_NUM_PRODUCERS,
+                                                           alloc);
+            const bsls::Types::Int64 begin = bsls::TimeUtil::getTimer();
+            for (int i = 0; i < k_NUM_PRODUCERS; ++i) {
+                bslmt::ThreadUtil::createWithAllocator(
+                    &handles[i],
+                    bdlf::BindUtil::bindS(alloc,
+                                          &Local::producerFn,
+                                          &obj,
+                                          &cli,
+                                          k_NUM_EVENTS,
+                                          cb),
+                    alloc);
+            }
+            done.wait();
+            const bsls::Types::Int64 end = bsls::TimeUtil::getTimer();
+
+            for (int i = 0; i < k_NUM_PRODUCERS; ++i) {
+                bslmt::ThreadUtil::join(handles[i]);
+            }
+
+            printSummary(bsl::string("dispatchEvent() throughput", alloc) +
+                             mode,
+                         end - begin,
+                         k_NUM_PRODUCERS * k_NUM_EVENTS);
+        }
+
+        // b) Wake up latency
+        {
+            bsls::Types::Int64 totalLatency = 0;
+            bsls::Types::Int64 wakeUpTime   = 0;
+            bslmt::Semaphore   done;
+
+            const mqbi::Dispatcher::VoidFunctor cb = bdlf::BindUtil::bindS(
+                alloc,
+                &Local::wakeUpFn,
+                &wakeUpTime,
+                &done);
+
+            for (int i = 0; i < k_NUM_ROUNDS; ++i) {
+                // Let the processor go idle (and park, in lock-free mode)
+                bslmt::ThreadUtil::microSleep(1000);
+
+                const bsls::Types::Int64 begin = bsls::TimeUtil::getTimer();
+                Local::dispatchCallback(&obj, &cli, cb);
+                done.wait();
+                totalLatency += wakeUpTime - begin;
+            }
+
+            printSummary(bsl::string("wake up latency", alloc) + mode,
+                         totalLatency,
+                         k_NUM_ROUNDS);
+        }
+
+        obj.unregisterClient(&cli);
+        obj.stop();
+    }
+
+    eventScheduler.stop();
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -641,11 +964,13 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 5: test5_dispatchEvents(); break;
     case 4: test4_eventSource(); break;
     case 3: test3_executorsSupport(); break;
     case 2: test2_clientTypeEnumValues(); break;
     case 1: test1_breathingTest(); break;
     case -1: testN1_inDispatcherThread(); break;
+    case -2: testN2_dispatchEventBenchmark(); break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         bmqtst::TestHelperUtil::testStatus() = -1;
@@ -421,6 +421,7 @@ void ClusterProxy::onPushEvent(const mqbi::DispatcherPushEvent& event)
             BSLS_ASSERT_SAFE(0 == rc);
         }
 
+        // Consecutive PUSHes for the same queue are dispatched together
         bmqp::MessagePropertiesInfo logic(iter.header());
         queue->onPushMessage(iter.header().messageGUID(),
                              appDataSp,
@@ -429,8 +430,12 @@ void ClusterProxy::onPushEvent(const mqbi::DispatcherPushEvent& event)
                              iter.header().compressionAlgorithmType(),
                              bmqp::PushHeaderFlagUtil::isSet(
                                  iter.header().flags(),
-                                 bmqp::PushHeaderFlags::e_OUT_OF_ORDER));
+                                 bmqp::PushHeaderFlags::e_OUT_OF_ORDER),
+                             &d_dispatchBatch);
     }
+
+    // Dispatch the PUSHes accumulated for the last queue
+    d_dispatchBatch.flush();
 }
 
 void ClusterProxy::onAckEvent(const mqbi::DispatcherAckEvent& event)
@@ -899,6 +904,7 @@ ClusterProxy::ClusterProxy(
 , d_queueHelper(&d_clusterData, &d_state, 0, allocator)
 , d_nodeStatsMap(allocator)
 , d_throttledFailedAckMessages(5000, 1)  // 1 log per 5s interval
+, d_dispatchBatch(allocator)
 , d_clusterMonitor(&d_clusterData, &d_state, d_allocator_p)
 , d_activeNodeLookupEventHandle()
 , d_shutdownChain(d_allocator_p)
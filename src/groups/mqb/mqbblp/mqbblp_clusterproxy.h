@@ -223,6 +223,11 @@ class ClusterProxy : public mqbc::ClusterStateObserver,
     /// Throttling parameters for failed ACK messages.
     bmqu::ThrottledActionParams d_throttledFailedAckMessages;
 
+    /// Events pushed to queues while processing an inbound PUSH event, so
+    /// that consecutive messages for the same queue are dispatched with a
+    /// single enqueue.  Flushed once the inbound event has been processed.
+    mqbi::DispatcherEventBatch d_dispatchBatch;
+
     /// Cluster state monitor.
     ClusterStateMonitor d_clusterMonitor;
 
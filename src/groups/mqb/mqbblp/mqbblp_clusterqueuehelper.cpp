@@ -1039,6 +1039,8 @@ void ClusterQueueHelper::processOpenQueueRequest(
 
             openQueueResp.deduplicationTimeMs() =
                 context->d_domain_p->config().deduplicationTimeMs();
+            openQueueResp.compressionDictionary() =
+                context->d_domain_p->config().compressionDictionary();
             openQueueResp.originalRequest().handleParameters() =
                 context->d_handleParameters;
             openQueueResp.originalRequest().handleParameters().qId() =
@@ -27,6 +27,7 @@
 #include <mqbu_storagekey.h>
 
 // BMQ
+#include <bmqp_compressiondictionary.h>
 #include <bmqp_queueid.h>
 #include <bmqp_queueutil.h>
 #include <bmqp_routingconfigurationutils.h>
@@ -108,11 +109,12 @@ int validateConfig(bsl::ostream& errorDescription,
 {
     enum RcEnum {
         // Value for the various RC error categories
-        rc_SUCCESS               = 0,
-        rc_WRONG_WATERMARK_RATIO = -1,
-        rc_CHANGED_DOMAIN_MODE   = -2,
-        rc_CHANGED_STORAGE_TYPE  = -3,
-        rc_INVALID_SUBSCRIPTION  = -4
+        rc_SUCCESS                        = 0,
+        rc_WRONG_WATERMARK_RATIO          = -1,
+        rc_CHANGED_DOMAIN_MODE            = -2,
+        rc_CHANGED_STORAGE_TYPE           = -3,
+        rc_INVALID_SUBSCRIPTION           = -4,
+        rc_INVALID_COMPRESSION_DICTIONARY = -5
     };
 
     // 1. Validate new configuration only
@@ -162,6 +164,22 @@ int validateConfig(bsl::ostream& errorDescription,
         return rc_INVALID_SUBSCRIPTION;  // RETURN
     }
 
+    // Validate newConfig.compressionDictionary().  Only trained dictionaries
+    // are supported, since compressed messages refer to their dictionary by
+    // the id recorded in it.
+    if (!newConfig.compressionDictionary().isNull()) {
+        const bsl::vector<char>& dictionary =
+            newConfig.compressionDictionary().value();
+        if (bmqp::CompressionDictionary::dictionaryId(dictionary.data(),
+                                                      dictionary.size()) ==
+            0) {
+            errorDescription << "'compressionDictionary' is not a trained "
+                             << "zstd dictionary (size: " << dictionary.size()
+                             << ")";
+            return rc_INVALID_COMPRESSION_DICTIONARY;  // RETURN
+        }
+    }
+
     // 2. Check compatibility between old/new configurations,
     // if old configuration exists
     if (previousDefn.isNull()) {
@@ -341,6 +359,23 @@ int Domain::configure(bsl::ostream&           errorDescription,
     // Adopt the updated domain configuration.
     d_config.makeValue(finalConfig);
 
+    // Register the compression dictionary, if any, so that messages
+    // compressed with it can be decompressed when evaluating subscriptions.
+    if (!d_config.value().compressionDictionary().isNull()) {
+        const bsl::vector<char>& dictionary =
+            d_config.value().compressionDictionary().value();
+        bmqu::MemOutStream errorStream(d_allocator_p);
+        if (!bmqp::CompressionDictionaryRegistry::defaultRegistry()
+                 .registerDictionary(dictionary.data(),
+                                     dictionary.size(),
+                                     &errorStream)) {
+            BMQTSK_ALARMLOG_ALARM("DOMAIN")
+                << "Domain '" << d_name << "' failed to register its "
+                << "compression dictionary: " << errorStream.str()
+                << BMQTSK_ALARMLOG_END;
+        }
+    }
+
     // Configure domain limits.
     const mqbconfm::Limits& limits = d_config.value().storage().domainLimits();
     d_capacityMeter.setLimits(limits.messages(), limits.bytes())
@@ -486,6 +486,29 @@ void Queue::loadInternals(mqbcmd::QueueInternals* out)
     }
 }
 
+mqbi::Dispatcher::DispatcherEventSp Queue::makePushEvent(
+    const bmqt::MessageGUID&             msgGUID,
+    const bsl::shared_ptr<bdlbb::Blob>&  appData,
+    const bsl::shared_ptr<bdlbb::Blob>&  options,
+    const bmqp::MessagePropertiesInfo&   messagePropertiesInfo,
+    bmqt::CompressionAlgorithmType::Enum compressionAlgorithmType,
+    bool                                 isOutOfOrder)
+{
+    mqbi::Dispatcher::DispatcherEventSp dispEvent =
+        domain()->cluster()->getEvent();
+    (*dispEvent)
+        .setType(mqbi::DispatcherEventType::e_PUSH)
+        .setSource(this)
+        .setBlob(appData)
+        .setOptions(options)
+        .setGuid(msgGUID)
+        .setMessagePropertiesInfo(messagePropertiesInfo)
+        .setCompressionAlgorithmType(compressionAlgorithmType)
+        .setOutOfOrderPush(isOutOfOrder);
+
+    return dispEvent;
+}
+
 Queue::Queue(const bmqt::Uri&                          uri,
              unsigned int                              id,
              const mqbu::StorageKey&                   key,
@@ -792,21 +815,43 @@ void Queue::onPushMessage(
     //       LocalQueue dispatcherEvent method to event warn on that invalid
     //       usage.
 
-    mqbi::Dispatcher::DispatcherEventSp dispEvent =
-        domain()->cluster()->getEvent();
-    (*dispEvent)
-        .setType(mqbi::DispatcherEventType::e_PUSH)
-        .setSource(this)
-        .setBlob(appData)
-        .setOptions(options)
-        .setGuid(msgGUID)
-        .setMessagePropertiesInfo(messagePropertiesInfo)
-        .setCompressionAlgorithmType(compressionAlgorithmType)
-        .setOutOfOrderPush(isOutOfOrder);
+    mqbi::Dispatcher::DispatcherEventSp dispEvent = makePushEvent(
+        msgGUID,
+        appData,
+        options,
+        messagePropertiesInfo,
+        compressionAlgorithmType,
+        isOutOfOrder);
 
     dispatcher()->dispatchEvent(bslmf::MovableRefUtil::move(dispEvent), this);
 }
 
+void Queue::onPushMessage(
+    const bmqt::MessageGUID&             msgGUID,
+    const bsl::shared_ptr<bdlbb::Blob>&  appData,
+    const bsl::shared_ptr<bdlbb::Blob>&  options,
+    const bmqp::MessagePropertiesInfo&   messagePropertiesInfo,
+    bmqt::CompressionAlgorithmType::Enum compressionAlgorithmType,
+    bool                                 isOutOfOrder,
+    mqbi::DispatcherEventBatch*          batch)
+{
+    // executed by the *CLUSTER* dispatcher thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(domain()->cluster()->inDispatcherThread());
+    BSLS_ASSERT_SAFE(batch);
+
+    mqbi::Dispatcher::DispatcherEventSp dispEvent = makePushEvent(
+        msgGUID,
+        appData,
+        options,
+        messagePropertiesInfo,
+        compressionAlgorithmType,
+        isOutOfOrder);
+
+    batch->add(bslmf::MovableRefUtil::move(dispEvent), this);
+}
+
 void Queue::confirmMessage(const bmqt::MessageGUID& msgGUID,
                            unsigned int             upstreamSubQueueId,
                            mqbi::QueueHandle*       source)
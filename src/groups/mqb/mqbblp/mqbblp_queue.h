@@ -159,6 +159,18 @@ class Queue BSLS_CPP11_FINAL : public mqbi::Queue {
     /// queue.
     void loadInternals(mqbcmd::QueueInternals* out);
 
+    /// Return a new PUSH event, to be dispatched to this queue, for the
+    /// message with the specified `msgGUID`, `appData`, `options`,
+    /// `messagePropertiesInfo`, `compressionAlgorithmType` and
+    /// `isOutOfOrder` flag.
+    mqbi::Dispatcher::DispatcherEventSp makePushEvent(
+        const bmqt::MessageGUID&             msgGUID,
+        const bsl::shared_ptr<bdlbb::Blob>&  appData,
+        const bsl::shared_ptr<bdlbb::Blob>&  options,
+        const bmqp::MessagePropertiesInfo&   messagePropertiesInfo,
+        bmqt::CompressionAlgorithmType::Enum compressionAlgorithmType,
+        bool                                 isOutOfOrder);
+
   public:
     // CREATORS
     Queue(const bmqt::Uri&                          uri,
@@ -278,6 +290,17 @@ class Queue BSLS_CPP11_FINAL : public mqbi::Queue {
         bmqt::CompressionAlgorithmType::Enum compressionAlgorithmType,
         bool isOutOfOrder) BSLS_KEYWORD_OVERRIDE;
 
+    /// Equivalent to the `onPushMessage` overload above, except that the
+    /// event carrying the message is appended to the specified `batch`.
+    void onPushMessage(
+        const bmqt::MessageGUID&             msgGUID,
+        const bsl::shared_ptr<bdlbb::Blob>&  appData,
+        const bsl::shared_ptr<bdlbb::Blob>&  options,
+        const bmqp::MessagePropertiesInfo&   messagePropertiesInfo,
+        bmqt::CompressionAlgorithmType::Enum compressionAlgorithmType,
+        bool                                 isOutOfOrder,
+        mqbi::DispatcherEventBatch*          batch) BSLS_KEYWORD_OVERRIDE;
+
     /// Confirm the message with the specified `msgGUID` for the specified
     /// `upstreamSubQueueId` stream of the queue on behalf of the client
     /// identified by the specified `source`.  Also note that since there
@@ -32,6 +32,7 @@
 #include <mqbcfg_brokerconfig.h>
 #include <mqbi_domain.h>
 #include <mqbi_queue.h>
+#include <mqbi_storage.h>
 #include <mqbs_storageutil.h>
 #include <mqbstat_queuestats.h>
 
@@ -48,6 +49,7 @@
 #include <bsl_fstream.h>
 #include <bsl_string.h>
 #include <bsla_annotations.h>
+#include <bslma_managedptr.h>
 #include <bsls_assert.h>
 #include <bsls_performancehint.h>
 #include <bsls_timeinterval.h>
@@ -340,6 +342,7 @@ void QueueEngineUtil::logRejectMessage(
         attributes.messagePropertiesInfo().isPresent(),
         attributes.messagePropertiesInfo().isExtended(),
         attributes.compressionAlgorithmType(),
+        0,  // no dictionary hint
         queueState->blobBufferFactory(),
         allocator);
 
@@ -937,6 +940,20 @@ size_t QueueEngineUtil_AppState::catchUp(
             broadcastOneMessage(current);
         }
         else {
+            if (d_routing_sp->d_queue.needsEvaluation(*current)) {
+                // Evaluate the subscriptions against the backlog ahead in
+                // batches rather than one message at a time.  Note that no
+                // message needs evaluation unless some expression can be
+                // evaluated in batches, so the lookahead is never wasted.
+                bslma::ManagedPtr<mqbi::StorageIterator> ahead;
+                if (d_queue_p->storage()->getIterator(&ahead,
+                                                      d_appKey,
+                                                      current->guid()) ==
+                    mqbi::StorageResult::e_SUCCESS) {
+                    d_routing_sp->d_queue.evaluateBatch(ahead.get());
+                }
+            }
+
             result = tryDeliverOneMessage(delay, current);
 
             if (result == Routers::e_SUCCESS) {
@@ -1122,9 +1139,14 @@ QueueEngineUtil_AppState::processDeliveryList(bsls::TimeInterval*    delay,
 
     // For each reader in the pending redelivery list
     RedeliveryList::iterator it          = list.begin();
-    bmqt::MessageGUID        firstGuid   = *it;
+    bmqt::MessageGUID        firstGuid;
     size_t                   numMessages = 0;
 
+    if (!list.isEnd(it)) {
+        // All items can be disabled.
+        firstGuid = *it;
+    }
+
     while (!list.isEnd(it)) {
         Routers::Result result = Routers::e_INVALID;
 
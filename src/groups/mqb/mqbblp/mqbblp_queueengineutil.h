@@ -26,6 +26,7 @@
 /// different @bbref{mqbblp::QueueEngine}s.
 
 // MQB
+#include <mqbblp_redeliverylist.h>
 #include <mqbblp_routers.h>
 #include <mqbcfg_messages.h>
 #include <mqbconfm_messages.h>
@@ -244,85 +245,6 @@ struct QueueEngineUtil_ReleaseHandleProctor {
 // struct QueueEngineUtil_AppState
 // ===============================
 
-class RedeliveryList {
-  private:
-    struct Item {
-        unsigned int d_stamp;
-
-        Item();
-    };
-
-    typedef bmqc::OrderedHashMap<bmqt::MessageGUID,
-                                 Item,
-                                 bslh::Hash<bmqt::MessageGUIDHashAlgo> >
-        Map;
-
-  public:
-    struct iterator {
-        Map::iterator d_cit;
-
-        iterator(const Map::iterator& cit);
-        const bmqt::MessageGUID& operator*();
-    };
-
-  private:
-    Map          d_map;
-    unsigned int d_stamp;
-
-  private:
-    void trim(iterator* cit) const;
-
-  public:
-    // PUBLIC CREATORS
-    RedeliveryList(bslma::Allocator* allocator);
-
-    // PUBLIC MANIPULATORS
-
-    /// Add the specified `guid` to the list.
-    void add(const bmqt::MessageGUID& guid);
-
-    /// Empty the list.
-    void clear();
-
-    /// Erase the item referenced by specified `cit` from the list.
-    iterator erase(const iterator& cit);
-
-    /// Erase the specified `guid` from the list.
-    void erase(const bmqt::MessageGUID& guid);
-
-    /// Load into the specified `cit` an iterator to next enabled (not
-    /// disabled) item.  If there are no such items, load the iterator
-    /// referencing the end of the list (for which `isEnd` returns `true`).
-    void next(iterator* cit) const;
-
-    /// Mark the item referenced by specified `cit` as disabled.
-    void disable(iterator* cit) const;
-
-    /// Change the state of the list so it ignores all previous marks
-    /// (logically re-enable all items).
-    void touch();
-
-    /// Return iterator to the first available (not disabled) item or the
-    /// iterator referencing the end of the list (for which `isEnd` returns
-    /// `true`).
-    iterator begin();
-
-    // PUBLIC ACCESSORS
-
-    /// Return iterator to the first item regardless of its mark (the item
-    /// can be disabled) or the iterator referencing the end of the list.
-    const bmqt::MessageGUID& first() const;
-
-    /// Return iterator referencing the end of the list.
-    bool isEnd(const iterator& cit) const;
-
-    /// Return total number of items in the list including disabled ones.
-    size_t size() const;
-
-    /// Return `true` if there are no (including disabled) items.
-    bool empty() const;
-};
-
 /// Mechanism managing state of a group of consumers supporting priorities.
 struct QueueEngineUtil_AppState {
   public:
@@ -709,120 +631,6 @@ inline bool QueueEngineUtil::isBroadcastMode(const mqbi::Queue* queue)
     return queue->isDeliverAll() && queue->isAtMostOnce();
 }
 
-// -----------------------------------------------
-// struct QueueEngineUtil_AppState::RedeliveryList
-// -----------------------------------------------
-
-inline RedeliveryList::Item::Item()
-: d_stamp(0)
-{
-    // NOTHING
-}
-
-inline RedeliveryList::iterator::iterator(const Map::iterator& cit)
-: d_cit(cit)
-{
-    // NOTHING
-}
-
-inline const bmqt::MessageGUID& RedeliveryList::iterator::operator*()
-{
-    return d_cit->first;
-}
-
-inline RedeliveryList::RedeliveryList(bslma::Allocator* allocator)
-: d_map(allocator)
-, d_stamp(1)
-{
-    // NOTHING
-}
-
-inline void RedeliveryList::add(const bmqt::MessageGUID& guid)
-{
-    d_map.insert(bsl::make_pair(guid, Item()));
-}
-
-inline void RedeliveryList::clear()
-{
-    d_map.clear();
-}
-
-inline RedeliveryList::iterator RedeliveryList::erase(const iterator& cit)
-{
-    iterator result(d_map.erase(cit.d_cit));
-
-    trim(&result);
-
-    return result;
-}
-
-inline void RedeliveryList::erase(const bmqt::MessageGUID& guid)
-{
-    d_map.erase(guid);
-}
-
-inline RedeliveryList::iterator RedeliveryList::begin()
-{
-    iterator result(d_map.begin());
-
-    trim(&result);
-
-    return result;
-}
-
-inline const bmqt::MessageGUID& RedeliveryList::first() const
-{
-    return d_map.begin()->first;
-}
-
-inline void RedeliveryList::next(iterator* cit) const
-{
-    ++cit->d_cit;
-    trim(cit);
-}
-
-inline void RedeliveryList::disable(iterator* cit) const
-{
-    cit->d_cit->second.d_stamp = d_stamp;
-}
-
-inline void RedeliveryList::touch()
-{
-    if (++d_stamp == 0) {
-        d_stamp = 1;
-    }
-}
-
-inline bool RedeliveryList::isEnd(const iterator& cit) const
-{
-    return cit.d_cit == d_map.end();
-}
-
-inline size_t RedeliveryList::size() const
-{
-    return d_map.size();
-}
-
-inline bool RedeliveryList::empty() const
-{
-    return d_map.empty();
-}
-
-inline void RedeliveryList::trim(iterator* cit) const
-{
-    // Skip those which did not have subscription last time (after config)
-    while (!isEnd(*cit)) {
-        if (cit->d_cit->second.d_stamp != d_stamp) {
-            // 'Item::d_stamp' is not valid anymore
-            // This assumes that before 'RedeliveryList::d_stamp' wraps around
-            // the 'cit->d_cit->second.d_stamp', this code resets the latter.
-            cit->d_cit->second.d_stamp = 0;
-            break;
-        }
-        ++cit->d_cit;
-    }
-}
-
 // -------------------------------
 // struct QueueEngineUtil_AppState
 // -------------------------------
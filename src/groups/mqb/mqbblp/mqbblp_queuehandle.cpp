@@ -149,6 +149,46 @@ QueueHandle::ConfirmFunctor::~ConfirmFunctor()
 // class QueueHandle
 // -----------------
 
+mqbi::Dispatcher::DispatcherEventSp
+QueueHandle::makePutEvent(const bmqp::PutHeader&              putHeader,
+                          const bsl::shared_ptr<bdlbb::Blob>& appData,
+                          const bsl::shared_ptr<bdlbb::Blob>& options)
+{
+    mqbi::Dispatcher::DispatcherEventSp event =
+        d_clientContext_sp->client()->getEvent();
+    (*event)
+        .setType(mqbi::DispatcherEventType::e_PUT)
+        .setSource(d_clientContext_sp->client())
+        .setBlob(appData)
+        .setOptions(options)
+        .setPutHeader(putHeader)
+        .setQueueHandle(this);
+
+    return event;
+}
+
+mqbi::Dispatcher::DispatcherEventSp
+QueueHandle::makeConfirmEvent(mqbi::DispatcherEventSource* eventSource_p,
+                              const bmqt::MessageGUID&     msgGUID,
+                              unsigned int downstreamSubQueueId)
+{
+    // REVISIT: THis is based on the assumption that `bslstl::function` will
+    // NOT allocate memory (its sizeof(InplaceBuffer) is 48).  Otherwise, this
+    // becomes performance bottleneck.
+
+    // A more generic approach would be to maintain a queue of CONFIRMs per
+    // queue (outside of the dispatcher) and process it separately (on idle?).
+
+    mqbi::Dispatcher::DispatcherEventSp event_sp = eventSource_p->getEvent();
+    event_sp->setType(mqbi::DispatcherEventType::e_CALLBACK);
+    event_sp->callback().createInplace<QueueHandle::ConfirmFunctor>(
+        this,
+        msgGUID,
+        downstreamSubQueueId);
+
+    return event_sp;
+}
+
 void QueueHandle::confirmMessageDispatched(const bmqt::MessageGUID& msgGUID,
                                            unsigned int downstreamSubQueueId)
 {
@@ -886,27 +926,31 @@ void QueueHandle::confirmMessage(mqbi::DispatcherEventSource* eventSource_p,
     //       refer to 'confirmMessageDispatched'.
 
     // Enqueue an event to process the confirm on the queue thread
-
-    // REVISIT: THis is based on the assumption that `bslstl::function` will
-    // NOT allocate memory (its sizeof(InplaceBuffer) is 48).  Otherwise, this
-    // becomes performance bottleneck.
-
-    // A more generic approach would be to maintain a queue of CONFIRMs per
-    // queue (outside of the dispatcher) and process it separately (on idle?).
-
     mqbi::DispatcherEventSource::DispatcherEventSp event_sp =
-        eventSource_p->getEvent();
-    event_sp->setType(mqbi::DispatcherEventType::e_CALLBACK);
-    event_sp->callback().createInplace<QueueHandle::ConfirmFunctor>(
-        this,
-        msgGUID,
-        downstreamSubQueueId);
+        makeConfirmEvent(eventSource_p, msgGUID, downstreamSubQueueId);
 
     d_queue_sp->dispatcher()->dispatchEvent(
         bslmf::MovableRefUtil::move(event_sp),
         d_queue_sp.get());
 }
 
+void QueueHandle::confirmMessage(mqbi::DispatcherEventSource* eventSource_p,
+                                 const bmqt::MessageGUID&     msgGUID,
+                                 unsigned int downstreamSubQueueId,
+                                 mqbi::DispatcherEventBatch* batch)
+{
+    // executed by the thread owning 'batch'
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(eventSource_p);
+    BSLS_ASSERT_SAFE(batch);
+
+    mqbi::DispatcherEventSource::DispatcherEventSp event_sp =
+        makeConfirmEvent(eventSource_p, msgGUID, downstreamSubQueueId);
+
+    batch->add(bslmf::MovableRefUtil::move(event_sp), d_queue_sp.get());
+}
+
 void QueueHandle::rejectMessage(const bmqt::MessageGUID& msgGUID,
                                 unsigned int             downstreamSubQueueId)
 {
@@ -1065,20 +1109,32 @@ void QueueHandle::postMessage(const bmqp::PutHeader&              putHeader,
 
     // cannot check 'd_subscriptions' unless in the QUEUE dispatcher thread
 
-    mqbi::Dispatcher::DispatcherEventSp event =
-        d_clientContext_sp->client()->getEvent();
-    (*event)
-        .setType(mqbi::DispatcherEventType::e_PUT)
-        .setSource(d_clientContext_sp->client())
-        .setBlob(appData)
-        .setOptions(options)
-        .setPutHeader(putHeader)
-        .setQueueHandle(this);
+    mqbi::Dispatcher::DispatcherEventSp event = makePutEvent(putHeader,
+                                                             appData,
+                                                             options);
 
     d_queue_sp->dispatcher()->dispatchEvent(bslmf::MovableRefUtil::move(event),
                                             d_queue_sp.get());
 }
 
+void QueueHandle::postMessage(const bmqp::PutHeader&              putHeader,
+                              const bsl::shared_ptr<bdlbb::Blob>& appData,
+                              const bsl::shared_ptr<bdlbb::Blob>& options,
+                              mqbi::DispatcherEventBatch*         batch)
+{
+    // executed by the *CLUSTER_DISPATCHER* or *CLIENT_DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_clientContext_sp->client()->inDispatcherThread());
+    BSLS_ASSERT_SAFE(batch);
+
+    mqbi::Dispatcher::DispatcherEventSp event = makePutEvent(putHeader,
+                                                             appData,
+                                                             options);
+
+    batch->add(bslmf::MovableRefUtil::move(event), d_queue_sp.get());
+}
+
 void QueueHandle::configure(
     const bmqp_ctrlmsg::StreamParameters&              streamParameters,
     const mqbi::QueueHandle::HandleConfiguredCallback& configuredCb)
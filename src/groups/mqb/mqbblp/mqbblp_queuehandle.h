@@ -200,6 +200,22 @@ class QueueHandle : public mqbi::QueueHandle {
 
   private:
     // PRIVATE MANIPULATORS
+
+    /// Return a new PUT event, to be dispatched to the queue, for the
+    /// message with the specified PUT `header`, `appData` and `options`.
+    mqbi::Dispatcher::DispatcherEventSp
+    makePutEvent(const bmqp::PutHeader&              header,
+                 const bsl::shared_ptr<bdlbb::Blob>& appData,
+                 const bsl::shared_ptr<bdlbb::Blob>& options);
+
+    /// Return a new event allocated from the specified `eventSource_p`, to
+    /// be dispatched to the queue, confirming the message with the
+    /// specified `msgGUID` for the specified `downstreamSubQueueId`.
+    mqbi::Dispatcher::DispatcherEventSp
+    makeConfirmEvent(mqbi::DispatcherEventSource* eventSource_p,
+                     const bmqt::MessageGUID&     msgGUID,
+                     unsigned int                 downstreamSubQueueId);
+
     void confirmMessageDispatched(const bmqt::MessageGUID& msgGUID,
                                   unsigned int downstreamSubQueueId);
 
@@ -394,6 +410,16 @@ class QueueHandle : public mqbi::QueueHandle {
                      const bsl::shared_ptr<bdlbb::Blob>& options)
         BSLS_KEYWORD_OVERRIDE;
 
+    /// Post the message with the specified PUT `header`, `appData` and
+    /// `options` to the queue, by appending the corresponding event to the
+    /// specified `batch`.
+    ///
+    /// THREAD: this method must be called from the thread owning `batch`.
+    void postMessage(const bmqp::PutHeader&              header,
+                     const bsl::shared_ptr<bdlbb::Blob>& appData,
+                     const bsl::shared_ptr<bdlbb::Blob>& options,
+                     mqbi::DispatcherEventBatch* batch) BSLS_KEYWORD_OVERRIDE;
+
     /// Used by the client to configure a given queue handle with the
     /// specified `streamParameters`.  Invoke the specified `configuredCb`
     /// when done.
@@ -478,6 +504,18 @@ class QueueHandle : public mqbi::QueueHandle {
                    const bmqt::MessageGUID&     msgGUID,
                    unsigned int downstreamSubQueueId) BSLS_KEYWORD_OVERRIDE;
 
+    /// Confirm the message with the specified `msgGUID` for the specified
+    /// `downstreamSubQueueId` stream of the queue, by appending the
+    /// corresponding event, allocated from the specified `eventSource_p`,
+    /// to the specified `batch`.
+    ///
+    /// THREAD: this method must be called from the thread owning `batch`.
+    void confirmMessage(mqbi::DispatcherEventSource* eventSource_p,
+                        const bmqt::MessageGUID&     msgGUID,
+                        unsigned int                 downstreamSubQueueId,
+                        mqbi::DispatcherEventBatch*  batch)
+        BSLS_KEYWORD_OVERRIDE;
+
     /// Reject the message with the specified `msgGUID` for the specified
     /// `subscriptionId` subscription of the queue.
     ///
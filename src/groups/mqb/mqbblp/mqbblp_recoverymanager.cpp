@@ -1238,7 +1238,8 @@ void RecoveryManager::onStorageSyncResponseDispatched(
             &recoveryCtx.journalFd(),
             &recoveryCtx.dataFd(),
             &recoveryCtx.qlistFd(),
-            d_dataStoreConfig.hasPrefaultPages());
+            d_dataStoreConfig.hasPrefaultPages(),
+            d_dataStoreConfig.hasHugePages());
         if (0 != rc) {
             BMQTSK_ALARMLOG_ALARM("RECOVERY")
                 << d_clusterData_p->identity().description()
@@ -1353,7 +1354,8 @@ void RecoveryManager::onStorageSyncResponseDispatched(
             &recoveryCtx.journalFd(),
             &recoveryCtx.dataFd(),
             &recoveryCtx.qlistFd(),
-            d_dataStoreConfig.hasPrefaultPages());
+            d_dataStoreConfig.hasPrefaultPages(),
+            d_dataStoreConfig.hasHugePages());
         if (0 != rc) {
             BMQTSK_ALARMLOG_ALARM("RECOVERY")
                 << d_clusterData_p->identity().description()
@@ -0,0 +1,186 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbblp_redeliverylist.cpp                                          -*-C++-*-
+#include <mqbblp_redeliverylist.h>
+
+#include <mqbscm_version.h>
+
+// BDE
+#include <bsl_algorithm.h>
+
+namespace BloombergLP {
+namespace mqbblp {
+
+// --------------------
+// class RedeliveryList
+// --------------------
+
+// PRIVATE MANIPULATORS
+void RedeliveryList::insertSlot(size_t position)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(position < d_items.size());
+    BSLS_ASSERT_SAFE(!d_index.empty());
+
+    const size_t mask = d_index.size() - 1;
+    size_t       slot = Hasher()(d_items[position].d_guid) & mask;
+
+    // Reuse erased slots.
+    while (d_index[slot] > k_ERASED_SLOT) {
+        slot = (slot + 1) & mask;
+    }
+
+    d_index[slot] = static_cast<unsigned int>(position + k_SLOT_OFFSET);
+}
+
+void RedeliveryList::rehash(size_t size)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(size >= k_MIN_INDEX_SIZE);
+    BSLS_ASSERT_SAFE((size & (size - 1)) == 0);
+    BSLS_ASSERT_SAFE(d_numItems * 2 < size);
+
+    d_index.assign(size, k_EMPTY_SLOT);
+
+    for (size_t position = d_begin; position < d_items.size(); ++position) {
+        if (!d_items[position].d_isErased) {
+            insertSlot(position);
+        }
+    }
+}
+
+void RedeliveryList::remove(size_t position)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(position < d_items.size());
+
+    Item& item = d_items[position];
+
+    BSLS_ASSERT_SAFE(!item.d_isErased);
+
+    const size_t slot = findSlot(item.d_guid);
+
+    BSLS_ASSERT_SAFE(slot < d_index.size());
+
+    d_index[slot]   = k_ERASED_SLOT;
+    item.d_isErased = true;
+    --d_numItems;
+
+    // Keep 'd_begin' referencing the first not erased item.
+    while (d_begin < d_items.size() && d_items[d_begin].d_isErased) {
+        ++d_begin;
+    }
+}
+
+size_t RedeliveryList::compact(size_t position)
+{
+    if (d_numItems == 0) {
+        clear();
+
+        return 0;  // RETURN
+    }
+
+    const size_t numErased = d_items.size() - d_numItems;
+
+    if (numErased < k_MIN_NUM_ERASED || numErased <= d_numItems) {
+        return position;  // RETURN
+    }
+
+    size_t result = position < d_items.size() ? 0 : d_numItems;
+    size_t to     = 0;
+
+    for (size_t from = d_begin; from < d_items.size(); ++from) {
+        if (from == position) {
+            result = to;
+        }
+        if (!d_items[from].d_isErased) {
+            if (to != from) {
+                d_items[to] = d_items[from];
+            }
+            ++to;
+        }
+    }
+
+    BSLS_ASSERT_SAFE(to == d_numItems);
+
+    d_items.erase(d_items.begin() + to, d_items.end());
+    d_begin = 0;
+
+    // Also discard erased slots.
+    rehash(d_index.size());
+
+    return result;
+}
+
+// PRIVATE ACCESSORS
+size_t RedeliveryList::findSlot(const bmqt::MessageGUID& guid) const
+{
+    if (d_index.empty()) {
+        return 0;  // RETURN
+    }
+
+    const size_t mask = d_index.size() - 1;
+
+    // The load factor is at most 0.5; there are always empty slots.
+    for (size_t slot = Hasher()(guid) & mask;; slot = (slot + 1) & mask) {
+        const unsigned int value = d_index[slot];
+
+        if (value == k_EMPTY_SLOT) {
+            return d_index.size();  // RETURN
+        }
+        if (value != k_ERASED_SLOT &&
+            d_items[value - k_SLOT_OFFSET].d_guid == guid) {
+            return slot;  // RETURN
+        }
+    }
+}
+
+// MANIPULATORS
+void RedeliveryList::add(const bmqt::MessageGUID& guid)
+{
+    if (findSlot(guid) != d_index.size()) {
+        // Already in the list.
+        return;  // RETURN
+    }
+
+    // Both occupied and erased slots are bounded by 'd_items.size()'.
+    if ((d_items.size() + 1) * 2 > d_index.size()) {
+        rehash(bsl::max(static_cast<size_t>(k_MIN_INDEX_SIZE),
+                        d_index.size() * 2));
+    }
+
+    d_items.push_back(Item(guid));
+    ++d_numItems;
+
+    insertSlot(d_items.size() - 1);
+}
+
+void RedeliveryList::erase(const bmqt::MessageGUID& guid)
+{
+    const size_t slot = findSlot(guid);
+
+    if (slot == d_index.size()) {
+        return;  // RETURN
+    }
+
+    const size_t position = d_index[slot] - k_SLOT_OFFSET;
+
+    remove(position);
+    compact(position);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
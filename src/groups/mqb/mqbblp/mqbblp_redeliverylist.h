@@ -0,0 +1,352 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbblp_redeliverylist.h                                            -*-C++-*-
+#ifndef INCLUDED_MQBBLP_REDELIVERYLIST
+#define INCLUDED_MQBBLP_REDELIVERYLIST
+
+/// @file mqbblp_redeliverylist.h
+///
+/// @brief Provide an ordered list of GUIDs pending (re)delivery.
+///
+/// @bbref{mqbblp::RedeliveryList} keeps, in the order of insertion, the GUIDs
+/// of messages which need to be (re)delivered by an App, for example, the
+/// unconfirmed messages of a consumer which went away.  While iterating, an
+/// item which cannot be delivered can be disabled, in which case the
+/// iteration skips it until the next `touch` (configuration change).
+///
+/// The list can grow to a large number of GUIDs at once (all unconfirmed
+/// messages of a consumer) and is then drained sequentially.  To keep both
+/// operations cache friendly, the GUIDs are stored contiguously, in the order
+/// of insertion, and located by an open addressing (linear probing) index of
+/// their positions.  Erased items are marked and skipped by the iteration;
+/// the storage is compacted once erased items outnumber the remaining ones.
+///
+/// Thread Safety
+/// -------------
+///
+/// NOT thread safe.
+
+// BMQ
+#include <bmqt_messageguid.h>
+
+// BDE
+#include <bsl_cstddef.h>
+#include <bsl_vector.h>
+#include <bslh_hash.h>
+#include <bslma_allocator.h>
+#include <bsls_assert.h>
+
+namespace BloombergLP {
+namespace mqbblp {
+
+// ====================
+// class RedeliveryList
+// ====================
+
+/// Ordered list of GUIDs pending (re)delivery.
+class RedeliveryList {
+  private:
+    // PRIVATE TYPES
+    struct Item {
+        bmqt::MessageGUID d_guid;
+
+        /// The value of `RedeliveryList::d_stamp` when this item was
+        /// disabled, or 0.
+        unsigned int d_stamp;
+
+        bool d_isErased;
+
+        explicit Item(const bmqt::MessageGUID& guid);
+    };
+
+    typedef bsl::vector<Item> Items;
+
+    /// Open addressing table of positions in `Items` shifted by
+    /// `k_SLOT_OFFSET` to reserve values for empty and erased slots.
+    typedef bsl::vector<unsigned int> Index;
+
+    typedef bslh::Hash<bmqt::MessageGUIDHashAlgo> Hasher;
+
+    enum {
+        k_EMPTY_SLOT  = 0,
+        k_ERASED_SLOT = 1,
+        k_SLOT_OFFSET = 2,
+
+        /// The minimal number of slots in `Index`.
+        k_MIN_INDEX_SIZE = 16,
+
+        /// The minimal number of erased items to compact `Items`.
+        k_MIN_NUM_ERASED = 64
+    };
+
+  public:
+    // PUBLIC TYPES
+    struct iterator {
+        const RedeliveryList* d_list_p;
+
+        size_t d_position;
+
+        iterator(const RedeliveryList* list, size_t position);
+        const bmqt::MessageGUID& operator*();
+    };
+
+  private:
+    // DATA
+
+    /// Items in the order of insertion, including erased ones.  Mutable to
+    /// update stamps of the items while iterating.
+    mutable Items d_items;
+
+    /// Slots of the items in `d_items`, including erased ones unless
+    /// `d_items` has been compacted since.  Load factor is at most 0.5.
+    Index d_index;
+
+    /// The position of the first not erased item in `d_items`.
+    size_t d_begin;
+
+    /// The number of not erased items in `d_items`.
+    size_t d_numItems;
+
+    unsigned int d_stamp;
+
+  private:
+    // PRIVATE MANIPULATORS
+
+    /// Store the specified `position` in `d_items` in a free slot of
+    /// `d_index`.  The behavior is undefined unless `d_index` has an empty
+    /// slot.
+    void insertSlot(size_t position);
+
+    /// Rebuild `d_index` having the specified `size` slots for all not
+    /// erased items.  The behavior is undefined unless `size` is a power of
+    /// 2.
+    void rehash(size_t size);
+
+    /// Mark the item at the specified `position` as erased.
+    void remove(size_t position);
+
+    /// Compact `d_items` if erased items outnumber the remaining ones and
+    /// return the new position of the item at the specified `position` (or
+    /// of the first not erased item following it).
+    size_t compact(size_t position);
+
+    // PRIVATE ACCESSORS
+
+    /// Return the slot in `d_index` of the specified `guid`, or
+    /// `d_index.size()` if the `guid` is not in the list.
+    size_t findSlot(const bmqt::MessageGUID& guid) const;
+
+    void trim(iterator* cit) const;
+
+  public:
+    // PUBLIC CREATORS
+    RedeliveryList(bslma::Allocator* allocator);
+
+    // PUBLIC MANIPULATORS
+
+    /// Add the specified `guid` to the end of the list unless the list
+    /// already contains the `guid`.
+    void add(const bmqt::MessageGUID& guid);
+
+    /// Empty the list.
+    void clear();
+
+    /// Erase the item referenced by specified `cit` from the list and return
+    /// an iterator to the next enabled (not disabled) item.  This
+    /// invalidates all other iterators.
+    iterator erase(const iterator& cit);
+
+    /// Erase the specified `guid` from the list.  This invalidates all
+    /// iterators.
+    void erase(const bmqt::MessageGUID& guid);
+
+    /// Load into the specified `cit` an iterator to next enabled (not
+    /// disabled) item.  If there are no such items, load the iterator
+    /// referencing the end of the list (for which `isEnd` returns `true`).
+    void next(iterator* cit) const;
+
+    /// Mark the item referenced by specified `cit` as disabled.
+    void disable(iterator* cit) const;
+
+    /// Change the state of the list so it ignores all previous marks
+    /// (logically re-enable all items).
+    void touch();
+
+    /// Return iterator to the first available (not disabled) item or the
+    /// iterator referencing the end of the list (for which `isEnd` returns
+    /// `true`).
+    iterator begin();
+
+    // PUBLIC ACCESSORS
+
+    /// Return iterator to the first item regardless of its mark (the item
+    /// can be disabled) or the iterator referencing the end of the list.
+    const bmqt::MessageGUID& first() const;
+
+    /// Return iterator referencing the end of the list.
+    bool isEnd(const iterator& cit) const;
+
+    /// Return total number of items in the list including disabled ones.
+    size_t size() const;
+
+    /// Return `true` if there are no (including disabled) items.
+    bool empty() const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// --------------------------
+// class RedeliveryList::Item
+// --------------------------
+
+inline RedeliveryList::Item::Item(const bmqt::MessageGUID& guid)
+: d_guid(guid)
+, d_stamp(0)
+, d_isErased(false)
+{
+    // NOTHING
+}
+
+// ------------------------------
+// class RedeliveryList::iterator
+// ------------------------------
+
+inline RedeliveryList::iterator::iterator(const RedeliveryList* list,
+                                          size_t                position)
+: d_list_p(list)
+, d_position(position)
+{
+    // NOTHING
+}
+
+inline const bmqt::MessageGUID& RedeliveryList::iterator::operator*()
+{
+    BSLS_ASSERT_SAFE(d_position < d_list_p->d_items.size());
+
+    return d_list_p->d_items[d_position].d_guid;
+}
+
+// --------------------
+// class RedeliveryList
+// --------------------
+
+inline RedeliveryList::RedeliveryList(bslma::Allocator* allocator)
+: d_items(allocator)
+, d_index(allocator)
+, d_begin(0)
+, d_numItems(0)
+, d_stamp(1)
+{
+    // NOTHING
+}
+
+inline void RedeliveryList::clear()
+{
+    // Keep the capacity for the next burst of redeliveries.
+    d_items.clear();
+    d_index.clear();
+    d_begin    = 0;
+    d_numItems = 0;
+}
+
+inline RedeliveryList::iterator RedeliveryList::erase(const iterator& cit)
+{
+    BSLS_ASSERT_SAFE(!isEnd(cit));
+
+    remove(cit.d_position);
+
+    iterator result(this, compact(cit.d_position));
+
+    trim(&result);
+
+    return result;
+}
+
+inline RedeliveryList::iterator RedeliveryList::begin()
+{
+    iterator result(this, d_begin);
+
+    trim(&result);
+
+    return result;
+}
+
+inline const bmqt::MessageGUID& RedeliveryList::first() const
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return d_items[d_begin].d_guid;
+}
+
+inline void RedeliveryList::next(iterator* cit) const
+{
+    ++cit->d_position;
+    trim(cit);
+}
+
+inline void RedeliveryList::disable(iterator* cit) const
+{
+    BSLS_ASSERT_SAFE(!isEnd(*cit));
+
+    d_items[cit->d_position].d_stamp = d_stamp;
+}
+
+inline void RedeliveryList::touch()
+{
+    if (++d_stamp == 0) {
+        d_stamp = 1;
+    }
+}
+
+inline bool RedeliveryList::isEnd(const iterator& cit) const
+{
+    return cit.d_position >= d_items.size();
+}
+
+inline size_t RedeliveryList::size() const
+{
+    return d_numItems;
+}
+
+inline bool RedeliveryList::empty() const
+{
+    return d_numItems == 0;
+}
+
+inline void RedeliveryList::trim(iterator* cit) const
+{
+    // Skip erased items and those which did not have subscription last time
+    // (after config)
+    while (!isEnd(*cit)) {
+        Item& item = d_items[cit->d_position];
+
+        if (!item.d_isErased && item.d_stamp != d_stamp) {
+            // 'Item::d_stamp' is not valid anymore
+            // This assumes that before 'RedeliveryList::d_stamp' wraps around
+            // the 'item.d_stamp', this code resets the latter.
+            item.d_stamp = 0;
+            break;
+        }
+        ++cit->d_position;
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
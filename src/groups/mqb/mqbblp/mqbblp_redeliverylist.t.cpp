@@ -0,0 +1,374 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbblp_redeliverylist.t.cpp                                        -*-C++-*-
+#include <mqbblp_redeliverylist.h>
+
+// BMQ
+#include <bmqc_orderedhashmap.h>
+#include <bmqp_messageguidgenerator.h>
+#include <bmqp_protocolutil.h>
+#include <bmqt_messageguid.h>
+
+// BDE
+#include <bsl_vector.h>
+#include <bslh_hash.h>
+
+// TEST DRIVER
+#include <bmqtst_testhelper.h>
+
+// BENCHMARKING LIBRARY
+#ifdef BMQTST_BENCHMARK_ENABLED
+#include <benchmark/benchmark.h>
+#endif
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+namespace {
+
+/// Load into the specified `guids` the specified `numGuids` new GUIDs.
+void generateGuids(bsl::vector<bmqt::MessageGUID>* guids, size_t numGuids)
+{
+    bmqp::MessageGUIDGenerator guidGenerator(0, false);
+
+    guids->resize(numGuids);
+
+    for (size_t i = 0; i < numGuids; ++i) {
+        guidGenerator.generateGUID(&(*guids)[i]);
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   Exercise basic functionality before beginning testing in earnest.
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("BREATHING TEST");
+
+    bsl::vector<bmqt::MessageGUID> guids(bmqtst::TestHelperUtil::allocator());
+    generateGuids(&guids, 3);
+
+    mqbblp::RedeliveryList list(bmqtst::TestHelperUtil::allocator());
+
+    BMQTST_ASSERT(list.empty());
+    BMQTST_ASSERT(list.isEnd(list.begin()));
+
+    for (size_t i = 0; i < guids.size(); ++i) {
+        list.add(guids[i]);
+    }
+    // Duplicates are ignored
+    list.add(guids[1]);
+
+    BMQTST_ASSERT_EQ(list.size(), guids.size());
+    BMQTST_ASSERT_EQ(list.first(), guids[0]);
+
+    mqbblp::RedeliveryList::iterator it = list.begin();
+    for (size_t i = 0; i < guids.size(); ++i) {
+        BMQTST_ASSERT(!list.isEnd(it));
+        BMQTST_ASSERT_EQ(*it, guids[i]);
+        list.next(&it);
+    }
+    BMQTST_ASSERT(list.isEnd(it));
+
+    // Erase in the middle
+    list.erase(guids[1]);
+    BMQTST_ASSERT_EQ(list.size(), size_t(2));
+
+    it = list.begin();
+    BMQTST_ASSERT_EQ(*it, guids[0]);
+    it = list.erase(it);
+    BMQTST_ASSERT_EQ(*it, guids[2]);
+    BMQTST_ASSERT_EQ(list.first(), guids[2]);
+    it = list.erase(it);
+    BMQTST_ASSERT(list.isEnd(it));
+    BMQTST_ASSERT(list.empty());
+
+    // Can add erased GUIDs again
+    list.add(guids[1]);
+    BMQTST_ASSERT_EQ(list.size(), size_t(1));
+    BMQTST_ASSERT_EQ(*list.begin(), guids[1]);
+
+    list.clear();
+    BMQTST_ASSERT(list.empty());
+    BMQTST_ASSERT(list.isEnd(list.begin()));
+}
+
+static void test2_disable()
+// ------------------------------------------------------------------------
+// DISABLE
+//
+// Concerns:
+//   Disabled items are skipped by the iteration until 'touch'.
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("DISABLE");
+
+    bsl::vector<bmqt::MessageGUID> guids(bmqtst::TestHelperUtil::allocator());
+    generateGuids(&guids, 4);
+
+    mqbblp::RedeliveryList list(bmqtst::TestHelperUtil::allocator());
+
+    for (size_t i = 0; i < guids.size(); ++i) {
+        list.add(guids[i]);
+    }
+
+    // Disable even items
+    mqbblp::RedeliveryList::iterator it = list.begin();
+    while (!list.isEnd(it)) {
+        if (*it == guids[0] || *it == guids[2]) {
+            list.disable(&it);
+        }
+        list.next(&it);
+    }
+
+    it = list.begin();
+    BMQTST_ASSERT_EQ(*it, guids[1]);
+    list.next(&it);
+    BMQTST_ASSERT_EQ(*it, guids[3]);
+    list.next(&it);
+    BMQTST_ASSERT(list.isEnd(it));
+
+    // Disabled items are still in the list
+    BMQTST_ASSERT_EQ(list.size(), guids.size());
+    BMQTST_ASSERT_EQ(list.first(), guids[0]);
+
+    // Erasing skips to the next enabled item
+    it = list.begin();
+    it = list.erase(it);
+    BMQTST_ASSERT_EQ(*it, guids[3]);
+
+    list.touch();
+
+    it = list.begin();
+    BMQTST_ASSERT_EQ(*it, guids[0]);
+    list.next(&it);
+    BMQTST_ASSERT_EQ(*it, guids[2]);
+    list.next(&it);
+    BMQTST_ASSERT_EQ(*it, guids[3]);
+    list.next(&it);
+    BMQTST_ASSERT(list.isEnd(it));
+}
+
+static void test3_compaction()
+// ------------------------------------------------------------------------
+// COMPACTION
+//
+// Concerns:
+//   Erasing most of a large list while iterating it keeps the order of the
+//   remaining items and the ability to find them.
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("COMPACTION");
+
+    const size_t k_NUM_GUIDS = 10000;
+
+    bsl::vector<bmqt::MessageGUID> guids(bmqtst::TestHelperUtil::allocator());
+    generateGuids(&guids, k_NUM_GUIDS);
+
+    mqbblp::RedeliveryList list(bmqtst::TestHelperUtil::allocator());
+
+    for (size_t i = 0; i < k_NUM_GUIDS; ++i) {
+        list.add(guids[i]);
+    }
+
+    // Erase all but every 10th item, in the order of iteration
+    size_t                           i  = 0;
+    mqbblp::RedeliveryList::iterator it = list.begin();
+    while (!list.isEnd(it)) {
+        BMQTST_ASSERT_EQ_D(i, *it, guids[i]);
+        if (i % 10) {
+            it = list.erase(it);
+        }
+        else {
+            list.next(&it);
+        }
+        ++i;
+    }
+    BMQTST_ASSERT_EQ(i, k_NUM_GUIDS);
+    BMQTST_ASSERT_EQ(list.size(), k_NUM_GUIDS / 10);
+
+    // The remaining items are in order and can be found
+    i  = 0;
+    it = list.begin();
+    while (!list.isEnd(it)) {
+        BMQTST_ASSERT_EQ_D(i, *it, guids[i]);
+        list.add(guids[i]);  // no-op
+        list.next(&it);
+        i += 10;
+    }
+    BMQTST_ASSERT_EQ(i, k_NUM_GUIDS);
+    BMQTST_ASSERT_EQ(list.size(), k_NUM_GUIDS / 10);
+
+    for (i = 0; i < k_NUM_GUIDS; i += 10) {
+        list.erase(guids[i]);
+    }
+    BMQTST_ASSERT(list.empty());
+    BMQTST_ASSERT(list.isEnd(list.begin()));
+}
+
+// ============================================================================
+//                              PERFORMANCE TESTS
+// ----------------------------------------------------------------------------
+
+#ifdef BMQTST_BENCHMARK_ENABLED
+static void testN1_redelivery_GoogleBenchmark(benchmark::State& state)
+{
+    // Redeliver 'state.range(0)' messages of a disconnected consumer: add
+    // all of them to the list and drain it, skipping every 10th message as
+    // if there was no matching subscription.
+
+    const size_t numGuids = static_cast<size_t>(state.range(0));
+
+    bsl::vector<bmqt::MessageGUID> guids(bmqtst::TestHelperUtil::allocator());
+    generateGuids(&guids, numGuids);
+
+    mqbblp::RedeliveryList list(bmqtst::TestHelperUtil::allocator());
+
+    // <time>
+    for (auto _ : state) {
+        for (size_t i = 0; i < numGuids; ++i) {
+            list.add(guids[i]);
+        }
+
+        size_t                           i  = 0;
+        mqbblp::RedeliveryList::iterator it = list.begin();
+        while (!list.isEnd(it)) {
+            if (++i % 10) {
+                it = list.erase(it);
+            }
+            else {
+                list.disable(&it);
+                list.next(&it);
+            }
+        }
+
+        list.clear();
+        list.touch();
+    }
+    // </time>
+
+    state.SetItemsProcessed(state.iterations() * numGuids);
+}
+
+static void testN2_redeliveryOrderedHashMap_GoogleBenchmark(
+    benchmark::State& state)
+{
+    // The same as 'testN1_redelivery' using 'bmqc::OrderedHashMap' which
+    // implemented 'RedeliveryList' before, for comparison.
+
+    typedef bmqc::OrderedHashMap<bmqt::MessageGUID,
+                                 unsigned int,
+                                 bslh::Hash<bmqt::MessageGUIDHashAlgo> >
+        Map;
+
+    const size_t numGuids = static_cast<size_t>(state.range(0));
+
+    bsl::vector<bmqt::MessageGUID> guids(bmqtst::TestHelperUtil::allocator());
+    generateGuids(&guids, numGuids);
+
+    Map map(bmqtst::TestHelperUtil::allocator());
+
+    // <time>
+    for (auto _ : state) {
+        for (size_t i = 0; i < numGuids; ++i) {
+            map.insert(bsl::make_pair(guids[i], 0U));
+        }
+
+        size_t        i  = 0;
+        Map::iterator it = map.begin();
+        while (it != map.end()) {
+            if (++i % 10) {
+                it = map.erase(it);
+            }
+            else {
+                it->second = 1;
+                ++it;
+            }
+        }
+
+        map.clear();
+    }
+    // </time>
+
+    state.SetItemsProcessed(state.iterations() * numGuids);
+}
+#else
+static void testN1_redelivery()
+{
+    bmqtst::TestHelper::printTestName("GOOGLE BENCHMARK: Redelivery");
+    PV("GoogleBenchmark is not supported on this platform, skipping...")
+}
+
+static void testN2_redeliveryOrderedHashMap()
+{
+    bmqtst::TestHelper::printTestName(
+        "GOOGLE BENCHMARK: Redelivery with OrderedHashMap");
+    PV("GoogleBenchmark is not supported on this platform, skipping...")
+}
+#endif
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(bmqtst::TestHelper::e_DEFAULT);
+
+    bmqp::ProtocolUtil::initialize(bmqtst::TestHelperUtil::allocator());
+
+    switch (_testCase) {
+    case 0:
+    case 3: test3_compaction(); break;
+    case 2: test2_disable(); break;
+    case 1: test1_breathingTest(); break;
+    case -1:
+        BMQTST_BENCHMARK_WITH_ARGS(testN1_redelivery, Arg(100000));
+        break;
+    case -2:
+        BMQTST_BENCHMARK_WITH_ARGS(testN2_redeliveryOrderedHashMap,
+                                   Arg(100000));
+        break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        bmqtst::TestHelperUtil::testStatus() = -1;
+    } break;
+    }
+
+#ifdef BMQTST_BENCHMARK_ENABLED
+    if (_testCase < 0) {
+        benchmark::Initialize(&argc, argv);
+        benchmark::RunSpecifiedBenchmarks();
+    }
+#endif
+
+    bmqp::ProtocolUtil::shutdown();
+
+    TEST_EPILOG(bmqtst::TestHelper::e_CHECK_GBL_ALLOC);
+}
@@ -1008,36 +1008,38 @@ void RootQueueEngine::configureHandle(
     // prepare the App for rebuilding consumers
     affectedApp->undoRouting();
 
-    // Rebuild the highest priority state for all affected apps.
+    // Rebuild the highest priority state for the affected app.  Only the
+    // configured handle has changed, so replace its results of parsing
+    // instead of parsing the parameters of all consumers again.
 
     BSLS_ASSERT_SAFE(
         bmqt::QueueFlagsUtil::isReader(handle->handleParameters().flags()));
 
-    const bsl::shared_ptr<Routers::AppContext> previous =
+    const bsl::shared_ptr<Routers::AppContext>& routing =
         affectedApp->routing();
 
-    affectedApp->routing().reset(new (*d_allocator_p) Routers::AppContext(
-                                     d_queueState_p->routingContext(),
-                                     d_allocator_p),
-                                 d_allocator_p);
+    {
+        // Keep the groups of the previous configuration of the 'handle' while
+        // loading the new one, so that reused expressions keep their
+        // subscription ids.
+        Routers::Priority::PriorityGroupList previousGroups(d_allocator_p);
+
+        routing->unload(handle, &previousGroups);
 
-    d_queueState_p->handleCatalog().iterateConsumers(
-        bdlf::BindUtil::bind(&RootQueueEngine::rebuildSelectedApp,
-                             this,
-                             bdlf::PlaceHolders::_1,  // handle
-                             bdlf::PlaceHolders::_2,  // info
-                             iter,
-                             previous.get()));
+        if (!it->second.d_streamParameters.subscriptions().empty()) {
+            rebuildSelectedApp(handle, it->second, iter, 0);
+        }
+    }
 
-    affectedApp->routing()->finalize();
-    affectedApp->routing()->apply();
-    affectedApp->routing()->registerSubscriptions();
+    routing->finalize();
+    routing->apply();
+    routing->registerSubscriptions();
 
     BALL_LOG_INFO << "Rebuilt active consumers of the highest "
                   << "priority for queue '"
                   << d_queueState_p->queue()->description() << "', appId = '"
                   << iter->first << "'. Now there are "
-                  << affectedApp->routing()->priorityCount() << " consumers.";
+                  << routing->priorityCount() << " consumers.";
 
     // Inform the requester of the success before attempting to deliver new
     // messages.
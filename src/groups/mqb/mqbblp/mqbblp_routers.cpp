@@ -33,9 +33,13 @@
 #include <bmqu_printutil.h>
 
 // BDE
+#include <bdlb_bitutil.h>
+#include <bsl_algorithm.h>
+#include <bsl_cstdint.h>
 #include <bsl_iostream.h>
 #include <bsl_memory.h>
 #include <bsl_string.h>
+#include <bsls_atomic.h>
 #include <bsls_performancehint.h>
 
 namespace BloombergLP {
@@ -43,6 +47,12 @@ namespace mqbblp {
 
 namespace {
 
+/// The last epoch of expression ids assigned by any
+/// `Routers::DecisionIndex`.  Epochs are unique across all the queues so
+/// that results cached with a message never outlive the ids they are keyed
+/// by.
+bsls::AtomicUint64 s_lastEpoch(0);
+
 /// VST to control the scope of Resolver
 class ScopeExit {
     mqbblp::Routers::QueueRoutingContext& d_queue;
@@ -98,6 +108,10 @@ Routers::MessagePropertiesReader::MessagePropertiesReader(
 , d_properties(allocator)
 , d_currentMessage_p(0)
 , d_isDirty(false)
+, d_view(allocator)
+, d_isView(false)
+, d_slots(allocator)
+, d_generation(1)
 {
     d_properties.setDeepCopy(false);
 }
@@ -111,10 +125,11 @@ void Routers::MessagePropertiesReader::_set(
     bmqp::MessageProperties& properties)
 {
     d_properties = properties;
+    d_isView     = false;
+    ++d_generation;
 }
 
-bdld::Datum Routers::MessagePropertiesReader::get(const bsl::string& name,
-                                                  bslma::Allocator*  allocator)
+void Routers::MessagePropertiesReader::load()
 {
     if (d_isDirty) {
         if (!d_appData) {
@@ -125,21 +140,76 @@ bdld::Datum Routers::MessagePropertiesReader::get(const bsl::string& name,
             }
         }
         if (d_appData) {
-            int rc = d_schemaLearner.read(d_schemaLearnerContext,
-                                          &d_properties,
-                                          d_messagePropertiesInfo,
-                                          *d_appData);
-            if (rc != 0) {
-                BALL_LOG_TRACE << "Failed to read message schema [rc: " << rc
-                               << "]";
+            // Avoid parsing (and allocating) all the properties if the
+            // schema is known.
+            d_isView = 0 == d_schemaLearner.read(d_schemaLearnerContext,
+                                                 &d_view,
+                                                 d_messagePropertiesInfo,
+                                                 *d_appData);
+            if (!d_isView) {
+                int rc = d_schemaLearner.read(d_schemaLearnerContext,
+                                              &d_properties,
+                                              d_messagePropertiesInfo,
+                                              *d_appData);
+                if (rc != 0) {
+                    BALL_LOG_TRACE << "Failed to read message schema [rc: "
+                                   << rc << "]";
+                }
             }
         }
         d_isDirty = false;
     }
+}
+
+bdld::Datum Routers::MessagePropertiesReader::get(const bsl::string& name,
+                                                  bslma::Allocator*  allocator)
+{
+    load();
+
+    if (d_isView) {
+        return d_view.getPropertyRef(name, allocator);  // RETURN
+    }
 
     return d_properties.getPropertyRef(name, allocator);
 }
 
+bdld::Datum
+Routers::MessagePropertiesReader::getBySlot(int                slot,
+                                            const bsl::string& name,
+                                            bslma::Allocator*  allocator)
+{
+    BSLS_ASSERT_SAFE(slot >= 0);
+
+    load();
+
+    if (!d_isView) {
+        return d_properties.getPropertyRef(name, allocator);  // RETURN
+    }
+
+    const bmqp::MessagePropertiesView::SchemaPtr& schema = d_view.schema();
+    if (!schema) {
+        // No properties.
+        return d_view.getPropertyRef(name, allocator);  // RETURN
+    }
+
+    if (d_slots.size() <= static_cast<size_t>(slot)) {
+        d_slots.resize(slot + 1);
+    }
+
+    // Look the name up only once per slot per schema, and again when the
+    // slot is assigned to another property.
+    Slot& cached = d_slots[slot];
+    if (cached.d_schema != schema || cached.d_name != name) {
+        cached.d_schema = schema;
+        cached.d_name   = name;
+        if (!schema->loadIndex(&cached.d_index, name)) {
+            cached.d_index = -1;
+        }
+    }
+
+    return d_view.getPropertyRef(cached.d_index, name, allocator);
+}
+
 void Routers::MessagePropertiesReader::next(
     const mqbi::StorageIterator* currentMessage)
 {
@@ -156,10 +226,13 @@ void Routers::MessagePropertiesReader::next(
 void Routers::MessagePropertiesReader::clear()
 {
     d_properties.clear();
+    d_view.clear();
+    d_isView = false;
 
     d_currentMessage_p = 0;
     d_appData.reset();
     d_isDirty = true;
+    ++d_generation;
 }
 
 void Routers::MessagePropertiesReader::next(
@@ -187,18 +260,342 @@ bool Routers::Expression::evaluate()
     /// | true       | true    | d_evaluator.evaluate() |
     /// |============|=========|========================|
 
-    if (d_evaluator.isValid()) {
-        /// 1. If there are no errors during evaluation, evaluator returns
-        ///    the expression evaluation result (a bool).
-        /// 2. If there are any errors during evaluation, evaluator returns
-        ///    `false`.  Possible error types are:
-        /// - Result type is not a boolean
-        /// - Property used in the expression is not found in the message
-        /// - Unexpected type for expression operand
+    if (!d_evaluator.isValid()) {
+        return true;  // RETURN
+    }
+
+    /// 1. If there are no errors during evaluation, evaluator returns
+    ///    the expression evaluation result (a bool).
+    /// 2. If there are any errors during evaluation, evaluator returns
+    ///    `false`.  Possible error types are:
+    /// - Result type is not a boolean
+    /// - Property used in the expression is not found in the message
+    /// - Unexpected type for expression operand
+
+    if (!d_index_p) {
         return d_evaluator.evaluate(*d_evaluationContext_p);  // RETURN
     }
 
-    return true;
+    // The result does not change until the reader moves to another message.
+    const bsls::Types::Uint64 generation = d_index_p->generation();
+    if (d_resultGeneration == generation) {
+        return d_result;  // RETURN
+    }
+
+    // Nor does it change for other Apps or redelivery of the same message.
+    mqbi::SubscriptionResults* results =
+        d_id < mqbi::SubscriptionResults::k_CAPACITY
+            ? d_index_p->subscriptionResults()
+            : 0;
+    if (results && results->load(&d_result, d_id, d_index_p->d_epoch)) {
+        d_resultGeneration = generation;
+
+        return d_result;  // RETURN
+    }
+
+    if (!d_isIndexed) {
+        d_result = d_evaluator.evaluate(*d_evaluationContext_p);
+    }
+    else {
+        d_index_p->update();
+
+        if (d_guardGeneration != generation) {
+            // The guard does not hold, hence the whole expression is 'false'.
+            d_result = false;
+        }
+        else if (d_guard.d_isExact) {
+            // The guard is the whole expression.
+            d_result = true;
+        }
+        else {
+            d_result = d_evaluator.evaluate(*d_evaluationContext_p);
+        }
+    }
+    d_resultGeneration = generation;
+
+    if (results) {
+        results->store(d_id, d_result, d_index_p->d_epoch);
+    }
+
+    return d_result;
+}
+
+// =============================
+// struct Routers::DecisionIndex
+// =============================
+
+Routers::DecisionIndex::DecisionIndex(MessagePropertiesReader* reader,
+                                      bslma::Allocator*        allocator)
+: d_properties(allocator)
+, d_expressions(allocator)
+, d_reader_p(reader)
+, d_generation(0)
+, d_key(allocator)
+, d_ids(0)
+, d_batchIds(0)
+, d_epoch(++s_lastEpoch)
+, d_allocator_p(allocator)
+{
+    BSLS_ASSERT_SAFE(reader);
+}
+
+Routers::DecisionIndex::~DecisionIndex()
+{
+    for (bsl::unordered_set<Expression*>::const_iterator cit =
+             d_expressions.begin();
+         cit != d_expressions.end();
+         ++cit) {
+        (*cit)->d_index_p   = 0;
+        (*cit)->d_isIndexed = false;
+        (*cit)->d_id        = mqbi::SubscriptionResults::k_CAPACITY;
+    }
+}
+
+void Routers::DecisionIndex::add(Expression* expression)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(expression);
+    BSLS_ASSERT_SAFE(expression->d_index_p == 0);
+
+    if (!d_expressions.insert(expression).second) {
+        return;  // RETURN
+    }
+
+    expression->d_index_p          = this;
+    expression->d_isIndexed        = false;
+    expression->d_guardGeneration  = 0;
+    expression->d_resultGeneration = 0;
+
+    if (~d_ids != 0) {
+        // Assign the lowest free id.
+        expression->d_id = bdlb::BitUtil::numTrailingUnsetBits(
+            static_cast<bsl::uint64_t>(~d_ids));
+        d_ids |= 1ULL << expression->d_id;
+        if (expression->d_evaluator.isValid()) {
+            d_batchIds |= 1ULL << expression->d_id;
+        }
+    }
+
+    bmqeval::SimpleEvaluator::Guard& guard = expression->d_guard;
+
+    if (!expression->d_evaluator.loadGuard(&guard)) {
+        return;  // RETURN
+    }
+
+    typedef bmqeval::SimpleEvaluator::Guard Guard;
+
+    if (guard.d_operator == Guard::e_NE ||
+        (guard.d_isString && guard.d_operator != Guard::e_EQ)) {
+        // Not indexed.  Such guards typically hold for most of the messages.
+        return;  // RETURN
+    }
+
+    PropertyIndex& index =
+        d_properties
+            .insert(bsl::make_pair(bsl::string(guard.d_property,
+                                               d_allocator_p),
+                                   PropertyIndex(d_allocator_p)))
+            .first->second;
+    index.d_slot = guard.d_slot;
+
+    if (guard.d_operator == Guard::e_EQ) {
+        if (guard.d_isString) {
+            index.d_strings[bsl::string(guard.d_string, d_allocator_p)]
+                .push_back(expression);
+        }
+        else {
+            index.d_integers[guard.d_integer].push_back(expression);
+        }
+    }
+    else {
+        Bound bound;
+        bound.d_value        = guard.d_integer;
+        bound.d_expression_p = expression;
+
+        if (guard.d_operator == Guard::e_GT ||
+            guard.d_operator == Guard::e_GE) {
+            bound.d_isInclusive = guard.d_operator == Guard::e_GE;
+
+            Bounds::iterator it = index.d_lowerBounds.begin();
+            while (it != index.d_lowerBounds.end() &&
+                   it->d_value <= bound.d_value) {
+                ++it;
+            }
+            index.d_lowerBounds.insert(it, bound);
+        }
+        else {
+            bound.d_isInclusive = guard.d_operator == Guard::e_LE;
+
+            Bounds::iterator it = index.d_upperBounds.begin();
+            while (it != index.d_upperBounds.end() &&
+                   it->d_value >= bound.d_value) {
+                ++it;
+            }
+            index.d_upperBounds.insert(it, bound);
+        }
+    }
+
+    expression->d_isIndexed = true;
+
+    // Force 'update' to account for the new guard.
+    d_generation = 0;
+}
+
+void Routers::DecisionIndex::remove(Expression* expression)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(expression);
+    BSLS_ASSERT_SAFE(expression->d_index_p == this);
+
+    d_expressions.erase(expression);
+    expression->d_index_p = 0;
+
+    if (expression->d_id < mqbi::SubscriptionResults::k_CAPACITY) {
+        // The id may be assigned to another expression, hence invalidate
+        // the results cached for this one.
+        d_ids &= ~(1ULL << expression->d_id);
+        d_batchIds &= ~(1ULL << expression->d_id);
+        d_epoch          = ++s_lastEpoch;
+        expression->d_id = mqbi::SubscriptionResults::k_CAPACITY;
+    }
+
+    if (!expression->d_isIndexed) {
+        return;  // RETURN
+    }
+    expression->d_isIndexed = false;
+
+    const bmqeval::SimpleEvaluator::Guard& guard = expression->d_guard;
+
+    Properties::iterator itProperty = d_properties.find(
+        bsl::string(guard.d_property, d_allocator_p));
+    BSLS_ASSERT_SAFE(itProperty != d_properties.end());
+
+    PropertyIndex& index = itProperty->second;
+
+    if (guard.d_operator == bmqeval::SimpleEvaluator::Guard::e_EQ) {
+        ExpressionList* list;
+
+        if (guard.d_isString) {
+            bsl::unordered_map<bsl::string, ExpressionList>::iterator it =
+                index.d_strings.find(
+                    bsl::string(guard.d_string, d_allocator_p));
+            BSLS_ASSERT_SAFE(it != index.d_strings.end());
+
+            list = &it->second;
+            list->erase(bsl::find(list->begin(), list->end(), expression));
+            if (list->empty()) {
+                index.d_strings.erase(it);
+            }
+        }
+        else {
+            bsl::unordered_map<bsls::Types::Int64, ExpressionList>::iterator
+                it = index.d_integers.find(guard.d_integer);
+            BSLS_ASSERT_SAFE(it != index.d_integers.end());
+
+            list = &it->second;
+            list->erase(bsl::find(list->begin(), list->end(), expression));
+            if (list->empty()) {
+                index.d_integers.erase(it);
+            }
+        }
+    }
+    else {
+        Bounds& bounds = (guard.d_operator ==
+                              bmqeval::SimpleEvaluator::Guard::e_GT ||
+                          guard.d_operator ==
+                              bmqeval::SimpleEvaluator::Guard::e_GE)
+                             ? index.d_lowerBounds
+                             : index.d_upperBounds;
+
+        for (Bounds::iterator it = bounds.begin(); it != bounds.end(); ++it) {
+            if (it->d_expression_p == expression) {
+                bounds.erase(it);
+                break;  // BREAK
+            }
+        }
+    }
+
+    if (index.empty()) {
+        d_properties.erase(itProperty);
+    }
+}
+
+void Routers::DecisionIndex::update()
+{
+    const bsls::Types::Uint64 generation = d_reader_p->generation();
+
+    if (d_generation == generation) {
+        return;  // RETURN
+    }
+    d_generation = generation;
+
+    for (Properties::const_iterator citProperty = d_properties.begin();
+         citProperty != d_properties.end();
+         ++citProperty) {
+        const PropertyIndex& index = citProperty->second;
+        const bdld::Datum    value = d_reader_p->getBySlot(index.d_slot,
+                                                        citProperty->first,
+                                                        d_allocator_p);
+
+        if (value.isString()) {
+            if (index.d_strings.empty()) {
+                continue;  // CONTINUE
+            }
+            const bslstl::StringRef property = value.theString();
+            d_key.assign(property.data(), property.length());
+
+            bsl::unordered_map<bsl::string, ExpressionList>::const_iterator
+                cit = index.d_strings.find(d_key);
+            if (cit != index.d_strings.end()) {
+                for (ExpressionList::const_iterator it = cit->second.begin();
+                     it != cit->second.end();
+                     ++it) {
+                    (*it)->d_guardGeneration = generation;
+                }
+            }
+            continue;  // CONTINUE
+        }
+
+        bsls::Types::Int64 integer;
+        if (value.isInteger64()) {
+            integer = value.theInteger64();
+        }
+        else if (value.isInteger()) {
+            integer = value.theInteger();
+        }
+        else {
+            // Missing property or a type no indexed guard can hold for.
+            continue;  // CONTINUE
+        }
+
+        bsl::unordered_map<bsls::Types::Int64, ExpressionList>::const_iterator
+            cit = index.d_integers.find(integer);
+        if (cit != index.d_integers.end()) {
+            for (ExpressionList::const_iterator it = cit->second.begin();
+                 it != cit->second.end();
+                 ++it) {
+                (*it)->d_guardGeneration = generation;
+            }
+        }
+
+        // Lower bounds are ascending; stop at the first one above the value.
+        for (Bounds::const_iterator it = index.d_lowerBounds.begin();
+             it != index.d_lowerBounds.end() && it->d_value <= integer;
+             ++it) {
+            if (it->d_value < integer || it->d_isInclusive) {
+                it->d_expression_p->d_guardGeneration = generation;
+            }
+        }
+
+        // Upper bounds are descending; stop at the first one below the value.
+        for (Bounds::const_iterator it = index.d_upperBounds.begin();
+             it != index.d_upperBounds.end() && it->d_value >= integer;
+             ++it) {
+            if (it->d_value > integer || it->d_isInclusive) {
+                it->d_expression_p->d_guardGeneration = generation;
+            }
+        }
+    }
 }
 
 bool Routers::PriorityGroup::evaluate()
@@ -296,7 +693,10 @@ void Routers::AppContext::load(
                     int rc = expression.d_evaluator.compile(
                         expr.text(),
                         d_compilationContext);
-                    if (rc != 0 && errorStream != 0) {
+                    if (rc == 0) {
+                        d_queue.d_index.add(&expression);
+                    }
+                    else if (errorStream != 0) {
                         bmqeval::ErrorType::Enum errorType =
                             static_cast<bmqeval::ErrorType::Enum>(rc);
                         if (loggedErrors) {
@@ -393,6 +793,54 @@ void Routers::AppContext::load(
     }
 }
 
+void Routers::AppContext::unload(mqbi::QueueHandle*           handle,
+                                 Priority::PriorityGroupList* groups)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(handle && "Must provide 'handle'");
+    BSLS_ASSERT_SAFE(groups);
+
+    // Round-robin lists reference 'Subscription's about to be removed.
+    clean();
+
+    // Break circular dependency - Subscriber <-> Subscription
+    Subscriber::Subscriptions temp(d_allocator_p);
+
+    for (Priorities::iterator itPriority = d_priorities.begin();
+         itPriority != d_priorities.end();
+         ++itPriority) {
+        Subscribers::SharedItem itSubscriber =
+            itPriority->second.d_subscribers.find(handle);
+
+        if (!itSubscriber) {
+            continue;  // CONTINUE
+        }
+
+        Subscriber::Subscriptions& subscriptions =
+            itSubscriber->value().d_subscriptions;
+
+        for (Subscriber::Subscriptions::const_iterator itSubscription =
+                 subscriptions.begin();
+             itSubscription != subscriptions.end();
+             ++itSubscription) {
+            groups->emplace_back(itSubscription->d_itGroup);
+        }
+
+        temp.splice(temp.end(), subscriptions);
+    }
+
+    // Removing the 'Subscription's releases the 'Subscriber's of the 'handle'
+    // and, in turn, its 'Consumer'.
+    temp.clear();
+
+    // The 'Consumer' is recorded with the stream parameters of 'load'; make
+    // sure the next 'load' records a new one.
+    Consumers::SharedItem itConsumer = d_consumers.find(handle);
+    if (itConsumer) {
+        itConsumer->invalidate();
+    }
+}
+
 unsigned int Routers::AppContext::finalize()
 {
     d_priorityCount = 0;
@@ -513,6 +961,13 @@ void Routers::AppContext::clean()
         Consumer& consumer = d_consumers.value(itConsumer);
         consumer.d_highestSubscriptions.clear();
     }
+    for (Priorities::iterator itPriority = d_priorities.begin();
+         itPriority != d_priorities.end();
+         ++itPriority) {
+        Priority& level = itPriority->second;
+        level.d_highestGroups.clear();
+        level.d_count = 0;
+    }
 }
 
 unsigned int Routers::QueueRoutingContext::nextSubscriptionId()
@@ -520,6 +975,87 @@ unsigned int Routers::QueueRoutingContext::nextSubscriptionId()
     return ++d_nextSubscriptionId;
 }
 
+int Routers::QueueRoutingContext::evaluateBatch(mqbi::StorageIterator* start)
+{
+    // executed by the *QUEUE DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(start);
+
+    typedef bmqeval::EvaluationBatch Batch;
+
+    Expression* expressions[mqbi::SubscriptionResults::k_CAPACITY];
+    int         numExpressions = 0;
+
+    for (bsl::unordered_set<Expression*>::const_iterator cit =
+             d_index.d_expressions.begin();
+         cit != d_index.d_expressions.end();
+         ++cit) {
+        Expression* expression = *cit;
+        if (expression->d_id < mqbi::SubscriptionResults::k_CAPACITY &&
+            (d_index.d_batchIds & (1ULL << expression->d_id))) {
+            expressions[numExpressions++] = expression;
+        }
+    }
+
+    // Note that 'needsEvaluation' is 'false' unless there is any such
+    // expression, so that callers do not look ahead in vain.
+    if (numExpressions == 0) {
+        return 0;  // RETURN
+    }
+
+    // Load the properties of the messages, reading them once per message
+    // for all the expressions.
+
+    mqbi::SubscriptionResults* results[Batch::k_MAX_SIZE];
+
+    d_batch.reset();
+
+    for (; d_batch.size() < Batch::k_MAX_SIZE && !start->atEnd();
+         start->advance()) {
+        mqbi::SubscriptionResults* messageResults =
+            start->subscriptionResults();
+        if (!messageResults || messageResults->d_epoch == d_index.d_epoch) {
+            continue;  // CONTINUE
+        }
+
+        ScopeExit scope(*this, start);
+        const int index = d_batch.add();
+        d_batch.load(index, *d_preader, d_compilationContext);
+        results[index] = messageResults;
+    }
+
+    // Evaluate each expression against all the messages, then transpose the
+    // results into per message masks of expression ids.
+
+    Batch::Mask ids[Batch::k_MAX_SIZE]     = {0};
+    Batch::Mask matched[Batch::k_MAX_SIZE] = {0};
+
+    for (int i = 0; i < numExpressions; ++i) {
+        const Expression&         expression = *expressions[i];
+        const bsls::Types::Uint64 bit        = 1ULL << expression.d_id;
+        Batch::Mask               result;
+
+        if (expression.d_evaluator.evaluate(&result, d_batch) != 0) {
+            // Not supported in batches, evaluate one message at a time.
+            continue;  // CONTINUE
+        }
+
+        for (int j = 0; j < d_batch.size(); ++j) {
+            ids[j] |= bit;
+            if ((result >> j) & 1) {
+                matched[j] |= bit;
+            }
+        }
+    }
+
+    for (int j = 0; j < d_batch.size(); ++j) {
+        results[j]->storeAll(ids[j], matched[j], d_index.d_epoch);
+    }
+
+    return d_batch.size();
+}
+
 void Routers::QueueRoutingContext::loadInternals(mqbcmd::Routing* out) const
 {
     // executed by the *QUEUE DISPATCHER* thread
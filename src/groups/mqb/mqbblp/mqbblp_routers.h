@@ -161,6 +161,9 @@
 
 // BMQ
 #include <bmqeval_simpleevaluator.h>
+#include <bmqp_messageproperties.h>
+#include <bmqp_messagepropertiesview.h>
+#include <bmqp_schemalearner.h>
 #include <bmqt_messageguid.h>
 
 // BDE
@@ -173,6 +176,7 @@
 #include <bsl_memory.h>
 #include <bsl_ostream.h>
 #include <bsl_unordered_map.h>
+#include <bsl_unordered_set.h>
 #include <bsl_utility.h>
 #include <bsl_vector.h>
 #include <bsla_annotations.h>
@@ -391,6 +395,7 @@ class Routers {
     };
 
     struct MessagePropertiesReader;
+    struct DecisionIndex;
 
     /// VST to store context for optimization of `Subscription`s evaluation.
     /// One per Queue.
@@ -400,10 +405,37 @@ class Routers {
 
         bmqeval::EvaluationContext* d_evaluationContext_p;
 
+        /// The index this expression is registered with, if any.  Not
+        /// copied.
+        DecisionIndex* d_index_p;
+
+        /// The guard of `d_evaluator`, if `d_isIndexed` is `true`.
+        bmqeval::SimpleEvaluator::Guard d_guard;
+
+        /// `true` if this expression is indexed by `d_guard` in `d_index_p`.
+        bool d_isIndexed;
+
+        /// The generation of the last message for which `d_guard` holds.
+        bsls::Types::Uint64 d_guardGeneration;
+
+        /// The generation of the last evaluated message, and the result of
+        /// that evaluation.
+        bsls::Types::Uint64 d_resultGeneration;
+        bool                d_result;
+
+        /// The id of this expression in `d_index_p` keying its results in
+        /// `mqbi::SubscriptionResults` of messages, or
+        /// `mqbi::SubscriptionResults::k_CAPACITY` if the results are not
+        /// cached.  Not copied.
+        unsigned int d_id;
+
         Expression();
 
         Expression(const Expression& other);
 
+        /// Remove this expression from `d_index_p`, if any.
+        ~Expression();
+
         bool evaluate();
     };
 
@@ -563,6 +595,26 @@ class Routers {
         // CLASS-SCOPE CATEGORY
         BALL_LOG_SET_CLASS_CATEGORY("MQBBLP.MESSAGEPROPERTIESREADER");
 
+        // PRIVATE TYPES
+
+        /// The index in `d_schema` of the property named `d_name` assigned
+        /// a slot by `bmqeval::CompilationContext`, or -1 if there is no
+        /// such property.  The name is kept because the slot of a property
+        /// no longer used by any expression is assigned to another one.
+        struct Slot {
+            // TRAITS
+            BSLMF_NESTED_TRAIT_DECLARATION(Slot, bslma::UsesBslmaAllocator)
+
+            // DATA
+            bmqp::MessagePropertiesView::SchemaPtr d_schema;
+            bsl::string                            d_name;
+            int                                    d_index;
+
+            // CREATORS
+            explicit Slot(bslma::Allocator* allocator = 0);
+            Slot(const Slot& other, bslma::Allocator* allocator = 0);
+        };
+
         // DATA
 
         /// Use own context;
@@ -576,6 +628,25 @@ class Routers {
         bmqp::MessagePropertiesInfo  d_messagePropertiesInfo;
         bool                         d_isDirty;
 
+        /// Read-only view on the properties of the current message, used
+        /// instead of `d_properties` when the schema is already learned.
+        bmqp::MessagePropertiesView d_view;
+
+        /// `true` if `d_view` holds the properties of the current message.
+        bool d_isView;
+
+        /// Indices of properties by slot, valid as long as the schema of the
+        /// current message is the same as the one of a `Slot`.
+        bsl::vector<Slot> d_slots;
+
+        /// Changes every time the properties may change.
+        bsls::Types::Uint64 d_generation;
+
+        // PRIVATE MANIPULATORS
+
+        /// Read the properties of the current message, unless already done.
+        void load();
+
       public:
         MessagePropertiesReader(bmqp::SchemaLearner& schemaLearner,
                                 bslma::Allocator*    allocator);
@@ -587,6 +658,18 @@ class Routers {
         bdld::Datum get(const bsl::string& name,
                         bslma::Allocator*  allocator) BSLS_KEYWORD_OVERRIDE;
 
+        /// Return the same as `get(name, allocator)` but, once the schema
+        /// of the current message is learned, find the property by its
+        /// index in the schema cached for the specified `slot` rather than
+        /// by the specified `name`, as long as `slot` is assigned to
+        /// `name`.  The behavior is undefined unless all the expressions
+        /// evaluated by this reader are compiled by the same
+        /// `bmqeval::CompilationContext`.
+        bdld::Datum getBySlot(int                slot,
+                              const bsl::string& name,
+                              bslma::Allocator*  allocator)
+            BSLS_KEYWORD_OVERRIDE;
+
         /// Prepare the reader for the next message given the specified
         /// `currentMessage`.
         void next(const mqbi::StorageIterator* currentMessage);
@@ -598,6 +681,137 @@ class Routers {
 
         /// Reset the reader to the state of empty properties.
         void clear();
+
+        /// Return a value which changes every time the properties returned
+        /// by `get` may change, i.e. every time the reader moves to another
+        /// message.
+        bsls::Types::Uint64 generation() const BSLS_KEYWORD_OVERRIDE;
+
+        /// Return the current message if the reader is prepared for it by
+        /// `next(currentMessage)`, or 0 otherwise.
+        const mqbi::StorageIterator* currentMessage() const;
+    };
+
+    /// Index of the `Expression`s of a queue by their guards (see
+    /// `bmqeval::SimpleEvaluator::Guard`).  For each message, read once each
+    /// property which a guard compares, and mark the expressions which guard
+    /// holds, looking equality guards up by the value of the property and
+    /// scanning range guards sorted by their bound, so that the cost grows
+    /// with the number of expressions which may match rather than with the
+    /// total number of expressions.  An indexed `Expression` which guard
+    /// does not hold evaluates to `false` without running its evaluator.
+    /// Also, any registered `Expression` evaluates at most once per message:
+    /// the index assigns the first `mqbi::SubscriptionResults::k_CAPACITY`
+    /// registered expressions ids, and their results are kept with the
+    /// message in storage for other Apps and for redelivery.  Ids are reused
+    /// in a new epoch, so that results cached before are ignored.
+    /// One per Queue.
+    struct DecisionIndex {
+        // TYPES
+        typedef bsl::vector<Expression*> ExpressionList;
+
+        /// A range guard comparing an integer property with `d_value`.
+        struct Bound {
+            bsls::Types::Int64 d_value;
+            bool               d_isInclusive;
+            Expression*        d_expression_p;
+        };
+
+        typedef bsl::vector<Bound> Bounds;
+
+        /// All the guards comparing the same property.
+        struct PropertyIndex {
+            // TRAITS
+            BSLMF_NESTED_TRAIT_DECLARATION(PropertyIndex,
+                                           bslma::UsesBslmaAllocator)
+
+            // DATA
+
+            /// Equality guards, by integer value.
+            bsl::unordered_map<bsls::Types::Int64, ExpressionList>
+                d_integers;
+
+            /// Equality guards, by string value.
+            bsl::unordered_map<bsl::string, ExpressionList> d_strings;
+
+            /// `>` and `>=` guards in ascending order of their bound.
+            Bounds d_lowerBounds;
+
+            /// `<` and `<=` guards in descending order of their bound.
+            Bounds d_upperBounds;
+
+            /// The slot of the property (see
+            /// `bmqeval::PropertiesReader::getBySlot`).
+            int d_slot;
+
+            // CREATORS
+            explicit PropertyIndex(bslma::Allocator* allocator = 0);
+            PropertyIndex(const PropertyIndex& other,
+                          bslma::Allocator*    allocator = 0);
+
+            // ACCESSORS
+            bool empty() const;
+        };
+
+        typedef bsl::unordered_map<bsl::string, PropertyIndex> Properties;
+
+        // DATA
+
+        /// Guards by the name of the property they compare.
+        Properties d_properties;
+
+        /// All the registered expressions.
+        bsl::unordered_set<Expression*> d_expressions;
+
+        MessagePropertiesReader* d_reader_p;
+
+        /// The generation of the message the guards have been checked for.
+        bsls::Types::Uint64 d_generation;
+
+        /// Buffer for looking string values up.
+        bsl::string d_key;
+
+        /// Bit per assigned expression id.
+        bsls::Types::Uint64 d_ids;
+
+        /// Bit per assigned expression id whose expression can be evaluated
+        /// against batches of messages (see `QueueRoutingContext`).
+        bsls::Types::Uint64 d_batchIds;
+
+        /// The epoch of the expression ids, unique across all the indices.
+        bsls::Types::Uint64 d_epoch;
+
+        bslma::Allocator* d_allocator_p;
+
+        // CREATORS
+        DecisionIndex(MessagePropertiesReader* reader,
+                      bslma::Allocator*        allocator);
+
+        /// Unregister all the registered expressions.
+        ~DecisionIndex();
+
+        // MANIPULATORS
+
+        /// Register the specified compiled `expression`, and index it if its
+        /// evaluator has a supported guard: equality with an integer or a
+        /// string, or integer range.
+        void add(Expression* expression);
+
+        /// Unregister the specified `expression`.
+        void remove(Expression* expression);
+
+        /// Unless already done for the current message, mark the indexed
+        /// expressions which guard holds for it.
+        void update();
+
+        // ACCESSORS
+
+        /// Return the generation of the current message.
+        bsls::Types::Uint64 generation() const;
+
+        /// Return the cached results of expressions for the current
+        /// message, or 0 if the current message has no such cache.
+        mqbi::SubscriptionResults* subscriptionResults() const;
     };
 
     /// Mechanism to assist `Expression`s evaluation optimization to avoid
@@ -624,6 +838,17 @@ class Routers {
 
         bmqeval::EvaluationContext d_evaluationContext;
 
+        /// Index of the expressions in `d_expressions`.
+        DecisionIndex d_index;
+
+        /// Compiles all the expressions of this queue, so that they agree on
+        /// property slots (see `bmqeval::CompilationContext::propertySlot`).
+        bmqeval::CompilationContext d_compilationContext;
+
+        /// Workspace to evaluate the expressions against batches of
+        /// messages.
+        bmqeval::EvaluationBatch d_batch;
+
         bslma::Allocator* d_allocator_p;
 
         QueueRoutingContext(bmqp::SchemaLearner& schemaLearner,
@@ -633,6 +858,21 @@ class Routers {
         /// Generate `Subscription`s Id for upstream.
         unsigned int nextSubscriptionId();
 
+        /// Evaluate the expressions which results are cached with messages
+        /// (see `mqbi::SubscriptionResults`) against the messages starting
+        /// at the one pointed to by the specified `start`, up to
+        /// `bmqeval::EvaluationBatch::k_MAX_SIZE` of them at once, and cache
+        /// the results.  Skip the messages which results are already cached
+        /// or which do not keep such cache.  Advance `start` past the last
+        /// examined message.  Return the number of evaluated messages.
+        int evaluateBatch(mqbi::StorageIterator* start);
+
+        /// Return `true` if the results of the expressions are to be
+        /// evaluated for the message pointed to by the specified `message`
+        /// and cached with it, and `false` otherwise, including when none
+        /// of the expressions can be evaluated by `evaluateBatch`.
+        bool needsEvaluation(const mqbi::StorageIterator& message) const;
+
         bool onUsable(unsigned int* upstreamSubQueueId,
                       unsigned int  upstreamSubscriptionId);
 
@@ -715,7 +955,8 @@ class Routers {
         /// Round-robin routing policy.
         RoundRobin d_router;
 
-        bmqeval::CompilationContext d_compilationContext;
+        /// The compilation context of `d_queue`.
+        bmqeval::CompilationContext& d_compilationContext;
 
         unsigned int d_priorityCount;
 
@@ -743,6 +984,16 @@ class Routers {
                   const bmqp_ctrlmsg::StreamParameters& streamParameters,
                   const AppContext*                     previous);
 
+        /// Remove the results of parsing associated with the specified
+        /// `handle` (undo `load` for the `handle`), leaving the results for
+        /// all other handles intact.  Load into the specified `groups` the
+        /// `PriorityGroup`s referenced by the removed `Subscription`s so
+        /// that the caller can keep them, and their subscription ids, while
+        /// loading new parameters for the same `handle`.  Note that this
+        /// also undoes `finalize` which must be called again.
+        void unload(mqbi::QueueHandle*           handle,
+                    Priority::PriorityGroupList* groups);
+
         /// Make a pass on results of previous parsing and build round-robin
         /// lists of highest priority `Subscription`s.
         unsigned int finalize();
@@ -855,7 +1106,7 @@ inline Routers::AppContext::AppContext(QueueRoutingContext& queue,
 , d_consumers(allocator)
 , d_queue(queue)
 , d_router(d_priorities)
-, d_compilationContext(allocator)
+, d_compilationContext(queue.d_compilationContext)
 , d_priorityCount(0)
 , d_allocator_p(allocator)
 {
@@ -891,6 +1142,9 @@ inline Routers::QueueRoutingContext::QueueRoutingContext(
 , d_preader(new(*allocator) MessagePropertiesReader(schemaLearner, allocator),
             allocator)
 , d_evaluationContext(0, allocator)
+, d_index(d_preader.get(), allocator)
+, d_compilationContext(allocator)
+, d_batch(allocator)
 , d_allocator_p(allocator)
 {
     d_evaluationContext.setPropertiesReader(d_preader.get());
@@ -926,6 +1180,15 @@ Routers::QueueRoutingContext::onUsable(unsigned int* upstreamSubQueueId,
     return false;
 }
 
+inline bool Routers::QueueRoutingContext::needsEvaluation(
+    const mqbi::StorageIterator& message) const
+{
+    const mqbi::SubscriptionResults* results = message.subscriptionResults();
+
+    return d_index.d_batchIds != 0 && results &&
+           results->d_epoch != d_index.d_epoch;
+}
+
 // -----------------------------
 // struct Routers::Expression
 // -----------------------------
@@ -934,15 +1197,118 @@ Routers::QueueRoutingContext::onUsable(unsigned int* upstreamSubQueueId,
 inline Routers::Expression::Expression()
 : d_evaluator()
 , d_evaluationContext_p(0)
+, d_index_p(0)
+, d_guard()
+, d_isIndexed(false)
+, d_guardGeneration(0)
+, d_resultGeneration(0)
+, d_result(false)
+, d_id(mqbi::SubscriptionResults::k_CAPACITY)
 {
 }
 
 inline Routers::Expression::Expression(const Expression& other)
 : d_evaluator(other.d_evaluator)
 , d_evaluationContext_p(other.d_evaluationContext_p)
+, d_index_p(0)
+, d_guard()
+, d_isIndexed(false)
+, d_guardGeneration(0)
+, d_resultGeneration(0)
+, d_result(false)
+, d_id(mqbi::SubscriptionResults::k_CAPACITY)
+{
+    // NOTHING
+}
+
+inline Routers::Expression::~Expression()
+{
+    if (d_index_p) {
+        d_index_p->remove(this);
+    }
+}
+
+// ---------------------------------------
+// struct Routers::MessagePropertiesReader
+// ---------------------------------------
+
+inline Routers::MessagePropertiesReader::Slot::Slot(
+    bslma::Allocator* allocator)
+: d_schema()
+, d_name(allocator)
+, d_index(-1)
+{
+    // NOTHING
+}
+
+inline Routers::MessagePropertiesReader::Slot::Slot(
+    const Slot&       other,
+    bslma::Allocator* allocator)
+: d_schema(other.d_schema)
+, d_name(other.d_name, allocator)
+, d_index(other.d_index)
+{
+    // NOTHING
+}
+
+inline bsls::Types::Uint64
+Routers::MessagePropertiesReader::generation() const
+{
+    return d_generation;
+}
+
+inline const mqbi::StorageIterator*
+Routers::MessagePropertiesReader::currentMessage() const
+{
+    return d_currentMessage_p;
+}
+
+// -----------------------------
+// struct Routers::DecisionIndex
+// -----------------------------
+
+inline Routers::DecisionIndex::PropertyIndex::PropertyIndex(
+    bslma::Allocator* allocator)
+: d_integers(allocator)
+, d_strings(allocator)
+, d_lowerBounds(allocator)
+, d_upperBounds(allocator)
+, d_slot(0)
+{
+    // NOTHING
+}
+
+inline Routers::DecisionIndex::PropertyIndex::PropertyIndex(
+    const PropertyIndex& other,
+    bslma::Allocator*    allocator)
+: d_integers(other.d_integers, allocator)
+, d_strings(other.d_strings, allocator)
+, d_lowerBounds(other.d_lowerBounds, allocator)
+, d_upperBounds(other.d_upperBounds, allocator)
+, d_slot(other.d_slot)
 {
     // NOTHING
 }
+
+inline bool Routers::DecisionIndex::PropertyIndex::empty() const
+{
+    return d_integers.empty() && d_strings.empty() &&
+           d_lowerBounds.empty() && d_upperBounds.empty();
+}
+
+inline bsls::Types::Uint64 Routers::DecisionIndex::generation() const
+{
+    return d_reader_p->generation();
+}
+
+inline mqbi::SubscriptionResults*
+Routers::DecisionIndex::subscriptionResults() const
+{
+    const mqbi::StorageIterator* message = d_reader_p->currentMessage();
+
+    return message ? message->subscriptionResults() : 0;
+}
+
 // -----------------------------
 // struct Routers::Subscription
 // -----------------------------
@@ -19,6 +19,7 @@
 // BMQ
 #include <bmqp_crc32c.h>
 #include <bmqp_event.h>
+#include <bmqp_messageproperties.h>
 #include <bmqp_messageguidgenerator.h>
 #include <bmqp_protocol.h>
 #include <bmqp_protocolutil.h>
@@ -44,6 +45,12 @@
 // TEST DRIVER
 #include <bmqtst_testhelper.h>
 #include <bsl_memory.h>
+#include <bsl_vector.h>
+
+// BENCHMARKING LIBRARY
+#ifdef BMQTST_BENCHMARK_ENABLED
+#include <benchmark/benchmark.h>
+#endif
 
 // CONVENIENCE
 using namespace BloombergLP;
@@ -120,8 +127,47 @@ struct TestStorage {
                                     handleParameters,
                                     d_allocator_p);
     }
+
+    bsl::shared_ptr<mqbmock::QueueHandle> createHandle()
+    {
+        bsl::shared_ptr<mqbi::QueueHandleRequesterContext> clientContext =
+            bsl::allocate_shared<mqbi::QueueHandleRequesterContext>(
+                d_allocator_p);
+        bmqp_ctrlmsg::QueueHandleParameters handleParameters(d_allocator_p);
+
+        return bsl::allocate_shared<mqbmock::QueueHandle>(
+            d_allocator_p,
+            d_queue_sp,
+            clientContext,
+            static_cast<mqbstat::QueueStatsDomain*>(0),
+            handleParameters);
+    }
 };
 
+/// Load into the specified `streamParams` one subscription with the
+/// specified `expression` and one consumer with the specified `priority`.
+void makeStreamParameters(bmqp_ctrlmsg::StreamParameters* streamParams,
+                          const bsl::string&              expression,
+                          int                             priority)
+{
+    streamParams->subscriptions().resize(1);
+
+    bmqp_ctrlmsg::Subscription& subscription =
+        streamParams->subscriptions()[0];
+
+    subscription.expression().version() =
+        bmqp_ctrlmsg::ExpressionVersion::E_VERSION_1;
+    subscription.expression().text() = expression;
+    subscription.consumers().resize(1);
+
+    bmqp_ctrlmsg::ConsumerInfo& ci = subscription.consumers()[0];
+
+    ci.consumerPriority()       = priority;
+    ci.consumerPriorityCount()  = 1;
+    ci.maxUnconfirmedMessages() = 1024;
+    ci.maxUnconfirmedBytes()    = 1024;
+}
+
 struct Visitor {
     mqbi::QueueHandle*         d_handle;
     unsigned int               d_subQueueId;
@@ -545,6 +591,632 @@ static void test4_generate()
     }
 }
 
+static void test5_decisionIndex()
+// ------------------------------------------------------------------------
+// Testing mqbblp::Routers::DecisionIndex and mqbblp::Routers::Expression
+// evaluation through it.
+//
+//  1. Indexed and non-indexed expressions yield the same results as their
+//     evaluators.
+//  2. Results follow the reader when it moves to another message.
+//  3. Released expressions are removed from the index.
+// ------------------------------------------------------------------------
+{
+    bmqp::SchemaLearner schemaLearner(bmqtst::TestHelperUtil::allocator());
+    mqbblp::Routers::QueueRoutingContext queueContext(
+        schemaLearner,
+        bmqtst::TestHelperUtil::allocator());
+
+    struct Test {
+        int         d_line;
+        const char* d_expression;
+        bool        d_first;
+        bool        d_second;
+    } k_DATA[] = {
+        {L_, "region == \"east\"", true, false},
+        {L_, "region == \"east\" && priority > 5", false, false},
+        {L_, "priority > 5", false, true},
+        {L_, "priority >= 5", true, true},
+        {L_, "priority < 5", false, false},
+        {L_, "priority <= 7 && region != \"east\"", false, true},
+        {L_, "5 < priority", false, true},
+        {L_, "priority != 5", false, true},
+        {L_, "priority == 5 || region == \"east\"", true, false},
+        {L_, "missing == 1", false, false},
+    };
+    const size_t k_NUM_DATA = sizeof(k_DATA) / sizeof(*k_DATA);
+
+    bsl::vector<mqbblp::Routers::Expressions::SharedItem> items(
+        bmqtst::TestHelperUtil::allocator());
+
+    for (size_t i = 0; i < k_NUM_DATA; ++i) {
+        bmqp_ctrlmsg::Expression expr(bmqtst::TestHelperUtil::allocator());
+        expr.version() = bmqp_ctrlmsg::ExpressionVersion::E_VERSION_1;
+        expr.text()    = k_DATA[i].d_expression;
+
+        items.push_back(
+            queueContext.d_expressions.record(expr,
+                                              mqbblp::Routers::Expression()));
+
+        mqbblp::Routers::Expression& expression = items.back()->value();
+
+        BMQTST_ASSERT_EQ_D(
+            k_DATA[i].d_line,
+            expression.d_evaluator.compile(expr.text(),
+                                           queueContext.d_compilationContext),
+            0);
+        expression.d_evaluationContext_p = &queueContext.d_evaluationContext;
+        queueContext.d_index.add(&expression);
+    }
+    BMQTST_ASSERT_EQ(queueContext.d_index.d_expressions.size(), k_NUM_DATA);
+
+    bmqp::MessageProperties properties(bmqtst::TestHelperUtil::allocator());
+
+    properties.setPropertyAsString("region", "east");
+    properties.setPropertyAsInt32("priority", 5);
+    queueContext.d_preader->_set(properties);
+
+    for (size_t i = 0; i < k_NUM_DATA; ++i) {
+        mqbblp::Routers::Expression& expression = items[i]->value();
+
+        BMQTST_ASSERT_EQ_D(
+            k_DATA[i].d_line,
+            expression.d_evaluator.evaluate(queueContext.d_evaluationContext),
+            k_DATA[i].d_first);
+        BMQTST_ASSERT_EQ_D(k_DATA[i].d_line,
+                           expression.evaluate(),
+                           k_DATA[i].d_first);
+        BMQTST_ASSERT_EQ_D(k_DATA[i].d_line,
+                           expression.evaluate(),
+                           k_DATA[i].d_first);
+    }
+
+    properties.setPropertyAsString("region", "west");
+    properties.setPropertyAsInt64("priority", 7);
+    queueContext.d_preader->_set(properties);
+
+    for (size_t i = 0; i < k_NUM_DATA; ++i) {
+        mqbblp::Routers::Expression& expression = items[i]->value();
+
+        BMQTST_ASSERT_EQ_D(
+            k_DATA[i].d_line,
+            expression.d_evaluator.evaluate(queueContext.d_evaluationContext),
+            k_DATA[i].d_second);
+        BMQTST_ASSERT_EQ_D(k_DATA[i].d_line,
+                           expression.evaluate(),
+                           k_DATA[i].d_second);
+    }
+
+    // Release all but the first expression.
+    items.resize(1);
+
+    BMQTST_ASSERT_EQ(queueContext.d_index.d_expressions.size(), size_t(1));
+    BMQTST_ASSERT_EQ(queueContext.d_index.d_properties.size(), size_t(1));
+
+    properties.setPropertyAsString("region", "east");
+    queueContext.d_preader->_set(properties);
+
+    BMQTST_ASSERT(items[0]->value().evaluate());
+}
+
+static void test6_subscriptionResults()
+// ------------------------------------------------------------------------
+// Testing caching of mqbblp::Routers::Expression results with the message
+// in storage (mqbi::SubscriptionResults).
+//
+//  1. Evaluating an expression against a message caches the result.
+//  2. Evaluating the expression against the same message again, as for
+//     another App or for redelivery, uses the cached result.
+//  3. Releasing an expression invalidates all cached results.
+// ------------------------------------------------------------------------
+{
+    TestStorage storage(1, bmqtst::TestHelperUtil::allocator());
+
+    bmqp::MessageProperties properties(bmqtst::TestHelperUtil::allocator());
+    properties.setPropertyAsInt32("priority", 7);
+
+    const bmqp::MessagePropertiesInfo  info(true, 1, false);
+    const bsl::shared_ptr<bdlbb::Blob> appData =
+        bsl::allocate_shared<bdlbb::Blob>(
+            bmqtst::TestHelperUtil::allocator(),
+            properties.streamOut(&storage.d_bufferFactory, info));
+    const bsl::shared_ptr<bdlbb::Blob> options =
+        bsl::allocate_shared<bdlbb::Blob>(bmqtst::TestHelperUtil::allocator(),
+                                          &storage.d_bufferFactory);
+
+    bmqt::MessageGUID guid;
+    guid.fromHex("00000000000000000000000000000002");
+
+    mqbi::StorageMessageAttributes attributes;
+    attributes.setAppDataLen(appData->length());
+    attributes.setMessagePropertiesInfo(info);
+
+    BMQTST_ASSERT_EQ(
+        storage.d_storage.put(&attributes, guid, appData, options),
+        mqbi::StorageResult::e_SUCCESS);
+
+    storage.d_iterator->reset(guid);
+    const mqbi::StorageIterator* message = storage.d_iterator.get();
+
+    mqbi::SubscriptionResults* results = message->subscriptionResults();
+    BMQTST_ASSERT(results);
+
+    bmqp::SchemaLearner schemaLearner(bmqtst::TestHelperUtil::allocator());
+    mqbblp::Routers::QueueRoutingContext queueContext(
+        schemaLearner,
+        bmqtst::TestHelperUtil::allocator());
+
+    const char* k_EXPRESSIONS[] = {"priority > 5", "priority < 5"};
+
+    bsl::vector<mqbblp::Routers::Expressions::SharedItem> items(
+        bmqtst::TestHelperUtil::allocator());
+
+    for (unsigned int i = 0; i < 2; ++i) {
+        bmqp_ctrlmsg::Expression expr(bmqtst::TestHelperUtil::allocator());
+        expr.version() = bmqp_ctrlmsg::ExpressionVersion::E_VERSION_1;
+        expr.text()    = k_EXPRESSIONS[i];
+
+        items.push_back(
+            queueContext.d_expressions.record(expr,
+                                              mqbblp::Routers::Expression()));
+
+        mqbblp::Routers::Expression& expression = items.back()->value();
+
+        BMQTST_ASSERT_EQ(
+            expression.d_evaluator.compile(expr.text(),
+                                           queueContext.d_compilationContext),
+            0);
+        expression.d_evaluationContext_p = &queueContext.d_evaluationContext;
+        queueContext.d_index.add(&expression);
+
+        BMQTST_ASSERT_EQ(expression.d_id, i);
+    }
+
+    const bsls::Types::Uint64 epoch = queueContext.d_index.d_epoch;
+    bool                      result;
+
+    // 1. Evaluate and cache
+    queueContext.d_preader->next(message);
+
+    BMQTST_ASSERT(items[0]->value().evaluate());
+    BMQTST_ASSERT(!items[1]->value().evaluate());
+
+    BMQTST_ASSERT(results->load(&result, 0, epoch));
+    BMQTST_ASSERT(result);
+    BMQTST_ASSERT(results->load(&result, 1, epoch));
+    BMQTST_ASSERT(!result);
+
+    queueContext.d_preader->next(0);
+
+    // 2. Alter the cache to tell cached results from evaluated ones
+    results->store(0, false, epoch);
+
+    queueContext.d_preader->next(message);
+
+    BMQTST_ASSERT(!items[0]->value().evaluate());
+
+    queueContext.d_preader->next(0);
+
+    // 3. Release the second expression
+    items.resize(1);
+
+    BMQTST_ASSERT_NE(queueContext.d_index.d_epoch, epoch);
+
+    queueContext.d_preader->next(message);
+
+    BMQTST_ASSERT(items[0]->value().evaluate());
+    BMQTST_ASSERT(results->load(&result, 0, queueContext.d_index.d_epoch));
+    BMQTST_ASSERT(result);
+    BMQTST_ASSERT(!results->load(&result, 1, queueContext.d_index.d_epoch));
+
+    queueContext.d_preader->next(0);
+}
+
+static void test7_evaluateBatch()
+// ------------------------------------------------------------------------
+// Testing mqbblp::Routers::QueueRoutingContext::evaluateBatch.
+//
+//  1. Evaluating a batch caches the results of all the expressions with
+//     up to 'bmqeval::EvaluationBatch::k_MAX_SIZE' messages at once.
+//  2. The cached results are those of evaluating each message alone.
+//  3. Messages which results are already cached are skipped.
+//  4. Without any expression to evaluate, no message needs evaluation, so
+//     that the queue engine does not look ahead for a batch.
+// ------------------------------------------------------------------------
+{
+    const int k_NUM_MESSAGES = bmqeval::EvaluationBatch::k_MAX_SIZE + 6;
+
+    TestStorage storage(1, bmqtst::TestHelperUtil::allocator());
+
+    const bmqp::MessagePropertiesInfo info(true, 1, false);
+    bmqp::MessageGUIDGenerator        guidGenerator(0, false);
+
+    // The first message, put by 'TestStorage', has no properties.
+    bsl::vector<bmqt::MessageGUID> guids(bmqtst::TestHelperUtil::allocator());
+    guids.resize(1);
+    guids[0].fromHex("00000000000000000000000000000001");
+
+    for (int i = 1; i < k_NUM_MESSAGES; ++i) {
+        bmqp::MessageProperties properties(
+            bmqtst::TestHelperUtil::allocator());
+        properties.setPropertyAsInt32("priority", i);
+
+        const bsl::shared_ptr<bdlbb::Blob> appData =
+            bsl::allocate_shared<bdlbb::Blob>(
+                bmqtst::TestHelperUtil::allocator(),
+                properties.streamOut(&storage.d_bufferFactory, info));
+        const bsl::shared_ptr<bdlbb::Blob> options =
+            bsl::allocate_shared<bdlbb::Blob>(
+                bmqtst::TestHelperUtil::allocator(),
+                &storage.d_bufferFactory);
+
+        bmqt::MessageGUID guid;
+        guidGenerator.generateGUID(&guid);
+
+        mqbi::StorageMessageAttributes attributes;
+        attributes.setAppDataLen(appData->length());
+        attributes.setMessagePropertiesInfo(info);
+
+        BMQTST_ASSERT_EQ(
+            storage.d_storage.put(&attributes, guid, appData, options),
+            mqbi::StorageResult::e_SUCCESS);
+
+        guids.push_back(guid);
+    }
+
+    bmqp::SchemaLearner schemaLearner(bmqtst::TestHelperUtil::allocator());
+    mqbblp::Routers::QueueRoutingContext queueContext(
+        schemaLearner,
+        bmqtst::TestHelperUtil::allocator());
+
+    const char* k_EXPRESSIONS[] = {"priority > 5", "priority % 2 == 0"};
+
+    bsl::vector<mqbblp::Routers::Expressions::SharedItem> items(
+        bmqtst::TestHelperUtil::allocator());
+
+    for (unsigned int i = 0; i < 2; ++i) {
+        bmqp_ctrlmsg::Expression expr(bmqtst::TestHelperUtil::allocator());
+        expr.version() = bmqp_ctrlmsg::ExpressionVersion::E_VERSION_1;
+        expr.text()    = k_EXPRESSIONS[i];
+
+        items.push_back(
+            queueContext.d_expressions.record(expr,
+                                              mqbblp::Routers::Expression()));
+
+        mqbblp::Routers::Expression& expression = items.back()->value();
+
+        BMQTST_ASSERT_EQ(
+            expression.d_evaluator.compile(expr.text(),
+                                           queueContext.d_compilationContext),
+            0);
+        expression.d_evaluationContext_p = &queueContext.d_evaluationContext;
+        queueContext.d_index.add(&expression);
+    }
+
+    const bsls::Types::Uint64 epoch = queueContext.d_index.d_epoch;
+
+    // 1. Evaluate in batches
+    storage.d_iterator->reset(guids[0]);
+    BMQTST_ASSERT(queueContext.needsEvaluation(*storage.d_iterator));
+
+    BMQTST_ASSERT_EQ(queueContext.evaluateBatch(storage.d_iterator.get()),
+                     bmqeval::EvaluationBatch::k_MAX_SIZE);
+    BMQTST_ASSERT_EQ(queueContext.evaluateBatch(storage.d_iterator.get()),
+                     k_NUM_MESSAGES - bmqeval::EvaluationBatch::k_MAX_SIZE);
+    BMQTST_ASSERT(storage.d_iterator->atEnd());
+
+    // 2. Compare with the results of evaluating one message at a time
+    for (int i = 0; i < k_NUM_MESSAGES; ++i) {
+        storage.d_iterator->reset(guids[i]);
+
+        BMQTST_ASSERT_D(i, !queueContext.needsEvaluation(*storage.d_iterator));
+
+        mqbi::SubscriptionResults* results =
+            storage.d_iterator->subscriptionResults();
+
+        for (unsigned int j = 0; j < items.size(); ++j) {
+            mqbblp::Routers::Expression& expression = items[j]->value();
+            bool                         cached;
+
+            BMQTST_ASSERT_D(i,
+                            results->load(&cached, expression.d_id, epoch));
+
+            // Evaluate without the cache
+            mqbi::SubscriptionResults saved = *results;
+            results->d_epoch                = 0;
+
+            queueContext.d_preader->next(storage.d_iterator.get());
+            BMQTST_ASSERT_EQ_D(i << ", " << k_EXPRESSIONS[j],
+                               cached,
+                               expression.evaluate());
+            queueContext.d_preader->next(0);
+
+            *results = saved;
+        }
+    }
+
+    // 3. Skip cached results
+    storage.d_iterator->reset(guids[0]);
+    BMQTST_ASSERT_EQ(queueContext.evaluateBatch(storage.d_iterator.get()), 0);
+
+    // 4. No expression to evaluate
+    for (unsigned int j = 0; j < items.size(); ++j) {
+        queueContext.d_index.remove(&items[j]->value());
+    }
+    BMQTST_ASSERT_EQ(queueContext.d_index.d_batchIds, 0u);
+
+    storage.d_iterator->reset(guids[0]);
+    BMQTST_ASSERT(!queueContext.needsEvaluation(*storage.d_iterator));
+    BMQTST_ASSERT_EQ(queueContext.evaluateBatch(storage.d_iterator.get()), 0);
+}
+
+static void test8_unload()
+// ------------------------------------------------------------------------
+// Testing mqbblp::Routers::AppContext::unload method
+//
+//  1. Two handles each with one subscription with the same expression.
+//  2. Reconfigure one handle in place: the subscription id is kept and the
+//     other handle is intact.
+//  3. Unload the other handle: only the reconfigured one remains.
+//  4. Unload the last handle: nothing remains.
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("UNLOAD");
+
+    bmqp::SchemaLearner schemaLearner(bmqtst::TestHelperUtil::allocator());
+    mqbblp::Routers::QueueRoutingContext queueContext(
+        schemaLearner,
+        bmqtst::TestHelperUtil::allocator());
+    mqbblp::Routers::AppContext appContext(
+        queueContext,
+        bmqtst::TestHelperUtil::allocator());
+    bmqu::MemOutStream errorStream(bmqtst::TestHelperUtil::allocator());
+    unsigned int       subQueueId         = 13;
+    unsigned int       upstreamSubQueueId = 1;
+    const bsl::string  expression("x > 0",
+                                 bmqtst::TestHelperUtil::allocator());
+
+    TestStorage storage(subQueueId, bmqtst::TestHelperUtil::allocator());
+
+    mqbmock::QueueHandle handle1 = storage.getHandle();
+    mqbmock::QueueHandle handle2 = storage.getHandle();
+
+    bmqp_ctrlmsg::StreamParameters in(bmqtst::TestHelperUtil::allocator());
+    makeStreamParameters(&in, expression, 2);
+
+    appContext
+        .load(&handle1, &errorStream, subQueueId, upstreamSubQueueId, in, 0);
+    appContext.load(&handle2,
+                    &errorStream,
+                    subQueueId + 1,
+                    upstreamSubQueueId,
+                    in,
+                    0);
+    BMQTST_ASSERT_EQ(errorStream.str(), "");
+    BMQTST_ASSERT_EQ(appContext.finalize(), size_t(2));
+    appContext.apply();
+
+    bmqp_ctrlmsg::StreamParameters out(bmqtst::TestHelperUtil::allocator());
+    appContext.generate(&out);
+    BMQTST_ASSERT_EQ(out.subscriptions().size(), size_t(1));
+
+    const unsigned int sId = out.subscriptions()[0].sId();
+
+    // 2. Reconfigure 'handle1' with a lower priority
+    {
+        mqbblp::Routers::Priority::PriorityGroupList groups(
+            bmqtst::TestHelperUtil::allocator());
+
+        appContext.unload(&handle1, &groups);
+        BMQTST_ASSERT_EQ(groups.size(), size_t(1));
+        BMQTST_ASSERT(!appContext.hasHandle(&handle1));
+        BMQTST_ASSERT(appContext.hasHandle(&handle2));
+
+        makeStreamParameters(&in, expression, 1);
+        appContext.load(&handle1,
+                        &errorStream,
+                        subQueueId,
+                        upstreamSubQueueId,
+                        in,
+                        0);
+        BMQTST_ASSERT_EQ(errorStream.str(), "");
+    }
+    BMQTST_ASSERT_EQ(appContext.finalize(), size_t(1));
+    appContext.apply();
+
+    BMQTST_ASSERT_EQ(appContext.d_consumers.size(), size_t(2));
+    BMQTST_ASSERT_EQ(appContext.d_priorities.size(), size_t(2));
+
+    appContext.generate(&out);
+    BMQTST_ASSERT_EQ(out.subscriptions().size(), size_t(1));
+    BMQTST_ASSERT_EQ(out.subscriptions()[0].sId(), sId);
+    BMQTST_ASSERT_EQ(out.subscriptions()[0].consumers().size(), size_t(2));
+
+    Visitor                     visitor;
+    mqbblp::Routers::RoundRobin router(appContext.d_priorities);
+
+    BMQTST_ASSERT_EQ(router.iterateGroups(
+                         bdlf::BindUtil::bind(&Visitor::visit,
+                                              &visitor,
+                                              bdlf::PlaceHolders::_1,
+                                              bdlf::PlaceHolders::_2,
+                                              bdlf::PlaceHolders::_3)),
+                     mqbblp::Routers::e_SUCCESS);
+    BMQTST_ASSERT_EQ(visitor.d_handle, &handle2);
+
+    // 3. Unload 'handle2'
+    {
+        mqbblp::Routers::Priority::PriorityGroupList groups(
+            bmqtst::TestHelperUtil::allocator());
+
+        appContext.unload(&handle2, &groups);
+    }
+    BMQTST_ASSERT_EQ(appContext.finalize(), size_t(1));
+    appContext.apply();
+
+    BMQTST_ASSERT_EQ(appContext.d_consumers.size(), size_t(1));
+    BMQTST_ASSERT_EQ(appContext.d_priorities.size(), size_t(1));
+
+    BMQTST_ASSERT_EQ(router.iterateGroups(
+                         bdlf::BindUtil::bind(&Visitor::visit,
+                                              &visitor,
+                                              bdlf::PlaceHolders::_1,
+                                              bdlf::PlaceHolders::_2,
+                                              bdlf::PlaceHolders::_3)),
+                     mqbblp::Routers::e_SUCCESS);
+    BMQTST_ASSERT_EQ(visitor.d_handle, &handle1);
+
+    // 4. Unload 'handle1'
+    {
+        mqbblp::Routers::Priority::PriorityGroupList groups(
+            bmqtst::TestHelperUtil::allocator());
+
+        appContext.unload(&handle1, &groups);
+    }
+    BMQTST_ASSERT_EQ(appContext.finalize(), size_t(0));
+
+    BMQTST_ASSERT(appContext.d_consumers.empty());
+    BMQTST_ASSERT(appContext.d_priorities.empty());
+    BMQTST_ASSERT(appContext.d_groups.empty());
+    BMQTST_ASSERT(queueContext.d_groupIds.empty());
+}
+
+#ifdef BMQTST_BENCHMARK_ENABLED
+/// Load into the specified `handles` and `parameters` the specified
+/// `numConsumers` consumers each having one subscription with a distinct
+/// expression, and load them all into the specified `appContext`.
+static void
+loadConsumers(bsl::vector<bsl::shared_ptr<mqbmock::QueueHandle> >* handles,
+              bsl::vector<bmqp_ctrlmsg::StreamParameters>*         parameters,
+              mqbblp::Routers::AppContext*                         appContext,
+              TestStorage*                                         storage,
+              int numConsumers)
+{
+    bslma::Allocator* allocator = bmqtst::TestHelperUtil::allocator();
+
+    parameters->resize(numConsumers);
+
+    for (int i = 0; i < numConsumers; ++i) {
+        bmqu::MemOutStream expression(allocator);
+        expression << "x == " << i;
+
+        makeStreamParameters(&(*parameters)[i], expression.str(), 1 + i % 4);
+        handles->push_back(storage->createHandle());
+
+        appContext->load(handles->back().get(),
+                         0,
+                         i,
+                         1,
+                         (*parameters)[i],
+                         0);
+    }
+    appContext->finalize();
+    appContext->apply();
+}
+
+static void
+testN1_ConfigureFullRebuild_GoogleBenchmark(benchmark::State& state)
+{
+    // Configure one consumer out of 'state.range(0)' by rebuilding the
+    // routing of all consumers, as 'RootQueueEngine::configureHandle' used
+    // to do.
+
+    const int         numConsumers = static_cast<int>(state.range(0));
+    bslma::Allocator* allocator    = bmqtst::TestHelperUtil::allocator();
+
+    bmqp::SchemaLearner                  schemaLearner(allocator);
+    mqbblp::Routers::QueueRoutingContext queueContext(schemaLearner,
+                                                      allocator);
+    TestStorage                          storage(13, allocator);
+
+    bsl::vector<bsl::shared_ptr<mqbmock::QueueHandle> > handles(allocator);
+    bsl::vector<bmqp_ctrlmsg::StreamParameters>         parameters(allocator);
+
+    bsl::shared_ptr<mqbblp::Routers::AppContext> current =
+        bsl::allocate_shared<mqbblp::Routers::AppContext>(allocator,
+                                                          queueContext);
+    loadConsumers(&handles,
+                  &parameters,
+                  current.get(),
+                  &storage,
+                  numConsumers);
+
+    // <time>
+    for (auto _ : state) {
+        bsl::shared_ptr<mqbblp::Routers::AppContext> replacement =
+            bsl::allocate_shared<mqbblp::Routers::AppContext>(allocator,
+                                                              queueContext);
+        for (int i = 0; i < numConsumers; ++i) {
+            replacement->load(handles[i].get(),
+                              0,
+                              i,
+                              1,
+                              parameters[i],
+                              current.get());
+        }
+        replacement->finalize();
+        replacement->apply();
+        replacement->registerSubscriptions();
+
+        current = replacement;
+    }
+    // </time>
+}
+
+static void
+testN2_ConfigureIncremental_GoogleBenchmark(benchmark::State& state)
+{
+    // Configure one consumer out of 'state.range(0)' by replacing its
+    // results of parsing only.
+
+    const int         numConsumers = static_cast<int>(state.range(0));
+    bslma::Allocator* allocator    = bmqtst::TestHelperUtil::allocator();
+
+    bmqp::SchemaLearner                  schemaLearner(allocator);
+    mqbblp::Routers::QueueRoutingContext queueContext(schemaLearner,
+                                                      allocator);
+    TestStorage                          storage(13, allocator);
+    mqbblp::Routers::AppContext          appContext(queueContext, allocator);
+
+    bsl::vector<bsl::shared_ptr<mqbmock::QueueHandle> > handles(allocator);
+    bsl::vector<bmqp_ctrlmsg::StreamParameters>         parameters(allocator);
+
+    loadConsumers(&handles, &parameters, &appContext, &storage, numConsumers);
+
+    int i = 0;
+
+    // <time>
+    for (auto _ : state) {
+        {
+            mqbblp::Routers::Priority::PriorityGroupList groups(allocator);
+
+            appContext.unload(handles[i].get(), &groups);
+            appContext.load(handles[i].get(), 0, i, 1, parameters[i], 0);
+        }
+        appContext.finalize();
+        appContext.apply();
+        appContext.registerSubscriptions();
+
+        i = (i + 1) % numConsumers;
+    }
+    // </time>
+}
+#else
+static void testN1_ConfigureFullRebuild()
+{
+    bmqtst::TestHelper::printTestName(
+        "GOOGLE BENCHMARK: Configure with full rebuild");
+    PV("GoogleBenchmark is not supported on this platform, skipping...")
+}
+
+static void testN2_ConfigureIncremental()
+{
+    bmqtst::TestHelper::printTestName(
+        "GOOGLE BENCHMARK: Configure incrementally");
+    PV("GoogleBenchmark is not supported on this platform, skipping...")
+}
+#endif
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -564,12 +1236,31 @@ int main(int argc, char* argv[])
     case 2: test2_priority(); break;
     case 3: test3_parse(); break;
     case 4: test4_generate(); break;
+    case 5: test5_decisionIndex(); break;
+    case 6: test6_subscriptionResults(); break;
+    case 7: test7_evaluateBatch(); break;
+    case 8: test8_unload(); break;
+    case -1:
+        BMQTST_BENCHMARK_WITH_ARGS(testN1_ConfigureFullRebuild,
+                                   Arg(10)->Arg(100)->Arg(1000));
+        break;
+    case -2:
+        BMQTST_BENCHMARK_WITH_ARGS(testN2_ConfigureIncremental,
+                                   Arg(10)->Arg(100)->Arg(1000));
+        break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         bmqtst::TestHelperUtil::testStatus() = -1;
     } break;
     }
 
+#ifdef BMQTST_BENCHMARK_ENABLED
+    if (_testCase < 0) {
+        benchmark::Initialize(&argc, argv);
+        benchmark::RunSpecifiedBenchmarks();
+    }
+#endif
+
     bmqp::ProtocolUtil::shutdown();
 
     TEST_EPILOG(bmqtst::TestHelper::e_CHECK_GBL_ALLOC);
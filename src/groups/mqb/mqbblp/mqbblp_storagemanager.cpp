@@ -580,8 +580,10 @@ void StorageManager::setPrimaryForPartitionDispatched(
 
     BSLS_ASSERT_SAFE(!d_recoveryManager_mp->isRecoveryInProgress(partitionId));
 
-    // Inform recovery manager to initiate partition sync.
+    // Inform recovery manager to initiate partition sync, which reads the
+    // files of the active file set directly.
 
+    fs->completeRollover();
     d_recoveryManager_mp->startPartitionPrimarySync(
         fs,
         peers,
@@ -839,6 +841,7 @@ void StorageManager::processStorageSyncRequestDispatched(
         d_fileStores[static_cast<unsigned int>(partitionId)].get();
     BSLS_ASSERT_SAFE(fs);
 
+    fs->completeRollover();
     d_recoveryManager_mp->processStorageSyncRequest(message, source, fs);
 }
 
@@ -881,10 +884,11 @@ void StorageManager::processPartitionSyncStateRequestDispatched(
     //      recover though?  Close fs and initiate recovery?  Keep fs open,
     //      start buffering and then same as recovery?
 
-    d_recoveryManager_mp->processPartitionSyncStateRequest(
-        message,
-        source,
-        d_fileStores[partitionId].get());
+    mqbs::FileStore* fs = d_fileStores[partitionId].get();
+    fs->completeRollover();
+    d_recoveryManager_mp->processPartitionSyncStateRequest(message,
+                                                           source,
+                                                           fs);
 }
 
 void StorageManager::processPartitionSyncDataRequestDispatched(
@@ -894,10 +898,11 @@ void StorageManager::processPartitionSyncDataRequestDispatched(
 {
     // executed by *DISPATCHER* thread
 
-    d_recoveryManager_mp->processPartitionSyncDataRequest(
-        message,
-        source,
-        d_fileStores[partitionId].get());
+    mqbs::FileStore* fs = d_fileStores[partitionId].get();
+    fs->completeRollover();
+    d_recoveryManager_mp->processPartitionSyncDataRequest(message,
+                                                          source,
+                                                          fs);
 }
 
 void StorageManager::processPartitionSyncDataRequestStatusDispatched(
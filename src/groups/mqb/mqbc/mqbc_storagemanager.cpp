@@ -2537,9 +2537,11 @@ void StorageManager::do_startSendDataChunks(const EventWithData& event)
             !d_recoveryManager_mp->expectedDataChunks(partitionId));
     }
     // If self is not expecting data chunks, then self must be ready to serve
-    // data, hence the file store must be open.
-    const mqbs::FileStore& fs = fileStore(partitionId);
+    // data, hence the file store must be open.  Data chunks are read from
+    // the files of the active file set directly, which must be complete.
+    mqbs::FileStore& fs = fileStore(partitionId);
     BSLS_ASSERT_SAFE(fs.isOpen());
+    fs.completeRollover();
 
     // Note that 'eventData.partitionSeqNumDataRange()' is only used when this
     // action is performed by the replica.  If self is primary, we use
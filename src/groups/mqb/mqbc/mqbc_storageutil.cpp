@@ -1325,6 +1325,11 @@ int StorageUtil::assignPartitionDispatcherThreads(
             .setMaxJournalFileSize(config.maxJournalFileSize())
             .setMaxQlistFileSize(config.maxQlistFileSize())
             .setMaxArchivedFileSets(config.maxArchivedFileSets())
+            .setGroupCommitIntervalMs(config.groupCommitIntervalMs())
+            .setGroupCommitMaxBytes(config.groupCommitMaxBytes())
+            .setPrecreateFileSet(config.precreateFileSet())
+            .setRolloverBatchSize(config.rolloverBatchSize())
+            .setHugePages(config.hugePages())
             .setRecoveredQueuesCb(recoveredQueuesCb);
 
         if (!queueCreationCb.isNull()) {
@@ -602,6 +602,9 @@ bsl::ostream& Disallow::print(bsl::ostream& stream, int, int) const
 const char DispatcherProcessorParameters::CLASS_NAME[] =
     "DispatcherProcessorParameters";
 
+const bool DispatcherProcessorParameters::DEFAULT_INITIALIZER_LOCK_FREE_QUEUE =
+    false;
+
 const bdlat_AttributeInfo
     DispatcherProcessorParameters::ATTRIBUTE_INFO_ARRAY[] = {
         {ATTRIBUTE_ID_QUEUE_SIZE,
@@ -618,7 +621,13 @@ const bdlat_AttributeInfo
          "queueSizeHighWatermark",
          sizeof("queueSizeHighWatermark") - 1,
          "",
-         bdlat_FormattingMode::e_DEC}};
+         bdlat_FormattingMode::e_DEC},
+        {ATTRIBUTE_ID_LOCK_FREE_QUEUE,
+         "lockFreeQueue",
+         sizeof("lockFreeQueue") - 1,
+         "",
+         bdlat_FormattingMode::e_TEXT |
+             bdlat_FormattingMode::e_DEFAULT_VALUE}};
 
 // CLASS METHODS
 
@@ -626,7 +635,7 @@ const bdlat_AttributeInfo*
 DispatcherProcessorParameters::lookupAttributeInfo(const char* name,
                                                    int         nameLength)
 {
-    for (int i = 0; i < 3; ++i) {
+    for (int i = 0; i < 4; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
             DispatcherProcessorParameters::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -650,6 +659,8 @@ DispatcherProcessorParameters::lookupAttributeInfo(int id)
     case ATTRIBUTE_ID_QUEUE_SIZE_HIGH_WATERMARK:
         return &ATTRIBUTE_INFO_ARRAY
             [ATTRIBUTE_INDEX_QUEUE_SIZE_HIGH_WATERMARK];
+    case ATTRIBUTE_ID_LOCK_FREE_QUEUE:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_LOCK_FREE_QUEUE];
     default: return 0;
     }
 }
@@ -660,6 +671,7 @@ DispatcherProcessorParameters::DispatcherProcessorParameters()
 : d_queueSize()
 , d_queueSizeLowWatermark()
 , d_queueSizeHighWatermark()
+, d_lockFreeQueue(DEFAULT_INITIALIZER_LOCK_FREE_QUEUE)
 {
 }
 
@@ -670,6 +682,7 @@ void DispatcherProcessorParameters::reset()
     bdlat_ValueTypeFunctions::reset(&d_queueSize);
     bdlat_ValueTypeFunctions::reset(&d_queueSizeLowWatermark);
     bdlat_ValueTypeFunctions::reset(&d_queueSizeHighWatermark);
+    d_lockFreeQueue = DEFAULT_INITIALIZER_LOCK_FREE_QUEUE;
 }
 
 // ACCESSORS
@@ -685,6 +698,7 @@ bsl::ostream& DispatcherProcessorParameters::print(bsl::ostream& stream,
                            this->queueSizeLowWatermark());
     printer.printAttribute("queueSizeHighWatermark",
                            this->queueSizeHighWatermark());
+    printer.printAttribute("lockFreeQueue", this->lockFreeQueue());
     printer.end();
     return stream;
 }
@@ -4302,6 +4316,17 @@ const bool PartitionConfig::DEFAULT_INITIALIZER_PREFAULT_PAGES = false;
 
 const bool PartitionConfig::DEFAULT_INITIALIZER_FLUSH_AT_SHUTDOWN = true;
 
+const int PartitionConfig::DEFAULT_INITIALIZER_GROUP_COMMIT_INTERVAL_MS = 0;
+
+const bsls::Types::Uint64
+    PartitionConfig::DEFAULT_INITIALIZER_GROUP_COMMIT_MAX_BYTES = 1048576;
+
+const bool PartitionConfig::DEFAULT_INITIALIZER_PRECREATE_FILE_SET = false;
+
+const int PartitionConfig::DEFAULT_INITIALIZER_ROLLOVER_BATCH_SIZE = 0;
+
+const bool PartitionConfig::DEFAULT_INITIALIZER_HUGE_PAGES = false;
+
 const bdlat_AttributeInfo PartitionConfig::ATTRIBUTE_INFO_ARRAY[] = {
     {ATTRIBUTE_ID_NUM_PARTITIONS,
      "numPartitions",
@@ -4362,14 +4387,39 @@ const bdlat_AttributeInfo PartitionConfig::ATTRIBUTE_INFO_ARRAY[] = {
      "syncConfig",
      sizeof("syncConfig") - 1,
      "",
-     bdlat_FormattingMode::e_DEFAULT}};
+     bdlat_FormattingMode::e_DEFAULT},
+    {ATTRIBUTE_ID_GROUP_COMMIT_INTERVAL_MS,
+     "groupCommitIntervalMs",
+     sizeof("groupCommitIntervalMs") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC | bdlat_FormattingMode::e_DEFAULT_VALUE},
+    {ATTRIBUTE_ID_GROUP_COMMIT_MAX_BYTES,
+     "groupCommitMaxBytes",
+     sizeof("groupCommitMaxBytes") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC | bdlat_FormattingMode::e_DEFAULT_VALUE},
+    {ATTRIBUTE_ID_PRECREATE_FILE_SET,
+     "precreateFileSet",
+     sizeof("precreateFileSet") - 1,
+     "",
+     bdlat_FormattingMode::e_TEXT | bdlat_FormattingMode::e_DEFAULT_VALUE},
+    {ATTRIBUTE_ID_ROLLOVER_BATCH_SIZE,
+     "rolloverBatchSize",
+     sizeof("rolloverBatchSize") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC | bdlat_FormattingMode::e_DEFAULT_VALUE},
+    {ATTRIBUTE_ID_HUGE_PAGES,
+     "hugePages",
+     sizeof("hugePages") - 1,
+     "",
+     bdlat_FormattingMode::e_TEXT | bdlat_FormattingMode::e_DEFAULT_VALUE}};
 
 // CLASS METHODS
 
 const bdlat_AttributeInfo*
 PartitionConfig::lookupAttributeInfo(const char* name, int nameLength)
 {
-    for (int i = 0; i < 12; ++i) {
+    for (int i = 0; i < 17; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
             PartitionConfig::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -4409,6 +4459,16 @@ const bdlat_AttributeInfo* PartitionConfig::lookupAttributeInfo(int id)
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_FLUSH_AT_SHUTDOWN];
     case ATTRIBUTE_ID_SYNC_CONFIG:
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SYNC_CONFIG];
+    case ATTRIBUTE_ID_GROUP_COMMIT_INTERVAL_MS:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_COMMIT_INTERVAL_MS];
+    case ATTRIBUTE_ID_GROUP_COMMIT_MAX_BYTES:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_COMMIT_MAX_BYTES];
+    case ATTRIBUTE_ID_PRECREATE_FILE_SET:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PRECREATE_FILE_SET];
+    case ATTRIBUTE_ID_ROLLOVER_BATCH_SIZE:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ROLLOVER_BATCH_SIZE];
+    case ATTRIBUTE_ID_HUGE_PAGES:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_HUGE_PAGES];
     default: return 0;
     }
 }
@@ -4420,14 +4480,19 @@ PartitionConfig::PartitionConfig(bslma::Allocator* basicAllocator)
 , d_maxJournalFileSize()
 , d_maxQlistFileSize()
 , d_maxCSLFileSize(DEFAULT_INITIALIZER_MAX_C_S_L_FILE_SIZE)
+, d_groupCommitMaxBytes(DEFAULT_INITIALIZER_GROUP_COMMIT_MAX_BYTES)
 , d_location(basicAllocator)
 , d_archiveLocation(basicAllocator)
 , d_syncConfig()
 , d_numPartitions()
 , d_maxArchivedFileSets()
+, d_groupCommitIntervalMs(DEFAULT_INITIALIZER_GROUP_COMMIT_INTERVAL_MS)
+, d_rolloverBatchSize(DEFAULT_INITIALIZER_ROLLOVER_BATCH_SIZE)
 , d_preallocate(DEFAULT_INITIALIZER_PREALLOCATE)
 , d_prefaultPages(DEFAULT_INITIALIZER_PREFAULT_PAGES)
 , d_flushAtShutdown(DEFAULT_INITIALIZER_FLUSH_AT_SHUTDOWN)
+, d_precreateFileSet(DEFAULT_INITIALIZER_PRECREATE_FILE_SET)
+, d_hugePages(DEFAULT_INITIALIZER_HUGE_PAGES)
 {
 }
 
@@ -4437,14 +4502,19 @@ PartitionConfig::PartitionConfig(const PartitionConfig& original,
 , d_maxJournalFileSize(original.d_maxJournalFileSize)
 , d_maxQlistFileSize(original.d_maxQlistFileSize)
 , d_maxCSLFileSize(original.d_maxCSLFileSize)
+, d_groupCommitMaxBytes(original.d_groupCommitMaxBytes)
 , d_location(original.d_location, basicAllocator)
 , d_archiveLocation(original.d_archiveLocation, basicAllocator)
 , d_syncConfig(original.d_syncConfig)
 , d_numPartitions(original.d_numPartitions)
 , d_maxArchivedFileSets(original.d_maxArchivedFileSets)
+, d_groupCommitIntervalMs(original.d_groupCommitIntervalMs)
+, d_rolloverBatchSize(original.d_rolloverBatchSize)
 , d_preallocate(original.d_preallocate)
 , d_prefaultPages(original.d_prefaultPages)
 , d_flushAtShutdown(original.d_flushAtShutdown)
+, d_precreateFileSet(original.d_precreateFileSet)
+, d_hugePages(original.d_hugePages)
 {
 }
 
@@ -4455,14 +4525,19 @@ PartitionConfig::PartitionConfig(PartitionConfig&& original) noexcept
   d_maxJournalFileSize(bsl::move(original.d_maxJournalFileSize)),
   d_maxQlistFileSize(bsl::move(original.d_maxQlistFileSize)),
   d_maxCSLFileSize(bsl::move(original.d_maxCSLFileSize)),
+  d_groupCommitMaxBytes(bsl::move(original.d_groupCommitMaxBytes)),
   d_location(bsl::move(original.d_location)),
   d_archiveLocation(bsl::move(original.d_archiveLocation)),
   d_syncConfig(bsl::move(original.d_syncConfig)),
   d_numPartitions(bsl::move(original.d_numPartitions)),
   d_maxArchivedFileSets(bsl::move(original.d_maxArchivedFileSets)),
+  d_groupCommitIntervalMs(bsl::move(original.d_groupCommitIntervalMs)),
+  d_rolloverBatchSize(bsl::move(original.d_rolloverBatchSize)),
   d_preallocate(bsl::move(original.d_preallocate)),
   d_prefaultPages(bsl::move(original.d_prefaultPages)),
-  d_flushAtShutdown(bsl::move(original.d_flushAtShutdown))
+  d_flushAtShutdown(bsl::move(original.d_flushAtShutdown)),
+  d_precreateFileSet(bsl::move(original.d_precreateFileSet)),
+  d_hugePages(bsl::move(original.d_hugePages))
 {
 }
 
@@ -4472,14 +4547,19 @@ PartitionConfig::PartitionConfig(PartitionConfig&& original,
 , d_maxJournalFileSize(bsl::move(original.d_maxJournalFileSize))
 , d_maxQlistFileSize(bsl::move(original.d_maxQlistFileSize))
 , d_maxCSLFileSize(bsl::move(original.d_maxCSLFileSize))
+, d_groupCommitMaxBytes(bsl::move(original.d_groupCommitMaxBytes))
 , d_location(bsl::move(original.d_location), basicAllocator)
 , d_archiveLocation(bsl::move(original.d_archiveLocation), basicAllocator)
 , d_syncConfig(bsl::move(original.d_syncConfig))
 , d_numPartitions(bsl::move(original.d_numPartitions))
 , d_maxArchivedFileSets(bsl::move(original.d_maxArchivedFileSets))
+, d_groupCommitIntervalMs(bsl::move(original.d_groupCommitIntervalMs))
+, d_rolloverBatchSize(bsl::move(original.d_rolloverBatchSize))
 , d_preallocate(bsl::move(original.d_preallocate))
 , d_prefaultPages(bsl::move(original.d_prefaultPages))
 , d_flushAtShutdown(bsl::move(original.d_flushAtShutdown))
+, d_precreateFileSet(bsl::move(original.d_precreateFileSet))
+, d_hugePages(bsl::move(original.d_hugePages))
 {
 }
 #endif
@@ -4493,18 +4573,23 @@ PartitionConfig::~PartitionConfig()
 PartitionConfig& PartitionConfig::operator=(const PartitionConfig& rhs)
 {
     if (this != &rhs) {
-        d_numPartitions       = rhs.d_numPartitions;
-        d_location            = rhs.d_location;
-        d_archiveLocation     = rhs.d_archiveLocation;
-        d_maxDataFileSize     = rhs.d_maxDataFileSize;
-        d_maxJournalFileSize  = rhs.d_maxJournalFileSize;
-        d_maxQlistFileSize    = rhs.d_maxQlistFileSize;
-        d_maxCSLFileSize      = rhs.d_maxCSLFileSize;
-        d_preallocate         = rhs.d_preallocate;
-        d_maxArchivedFileSets = rhs.d_maxArchivedFileSets;
-        d_prefaultPages       = rhs.d_prefaultPages;
-        d_flushAtShutdown     = rhs.d_flushAtShutdown;
-        d_syncConfig          = rhs.d_syncConfig;
+        d_numPartitions         = rhs.d_numPartitions;
+        d_location              = rhs.d_location;
+        d_archiveLocation       = rhs.d_archiveLocation;
+        d_maxDataFileSize       = rhs.d_maxDataFileSize;
+        d_maxJournalFileSize    = rhs.d_maxJournalFileSize;
+        d_maxQlistFileSize      = rhs.d_maxQlistFileSize;
+        d_maxCSLFileSize        = rhs.d_maxCSLFileSize;
+        d_preallocate           = rhs.d_preallocate;
+        d_maxArchivedFileSets   = rhs.d_maxArchivedFileSets;
+        d_prefaultPages         = rhs.d_prefaultPages;
+        d_flushAtShutdown       = rhs.d_flushAtShutdown;
+        d_syncConfig            = rhs.d_syncConfig;
+        d_groupCommitIntervalMs = rhs.d_groupCommitIntervalMs;
+        d_groupCommitMaxBytes   = rhs.d_groupCommitMaxBytes;
+        d_precreateFileSet      = rhs.d_precreateFileSet;
+        d_rolloverBatchSize     = rhs.d_rolloverBatchSize;
+        d_hugePages             = rhs.d_hugePages;
     }
 
     return *this;
@@ -4515,18 +4600,23 @@ PartitionConfig& PartitionConfig::operator=(const PartitionConfig& rhs)
 PartitionConfig& PartitionConfig::operator=(PartitionConfig&& rhs)
 {
     if (this != &rhs) {
-        d_numPartitions       = bsl::move(rhs.d_numPartitions);
-        d_location            = bsl::move(rhs.d_location);
-        d_archiveLocation     = bsl::move(rhs.d_archiveLocation);
-        d_maxDataFileSize     = bsl::move(rhs.d_maxDataFileSize);
-        d_maxJournalFileSize  = bsl::move(rhs.d_maxJournalFileSize);
-        d_maxQlistFileSize    = bsl::move(rhs.d_maxQlistFileSize);
-        d_maxCSLFileSize      = bsl::move(rhs.d_maxCSLFileSize);
-        d_preallocate         = bsl::move(rhs.d_preallocate);
-        d_maxArchivedFileSets = bsl::move(rhs.d_maxArchivedFileSets);
-        d_prefaultPages       = bsl::move(rhs.d_prefaultPages);
-        d_flushAtShutdown     = bsl::move(rhs.d_flushAtShutdown);
-        d_syncConfig          = bsl::move(rhs.d_syncConfig);
+        d_numPartitions         = bsl::move(rhs.d_numPartitions);
+        d_location              = bsl::move(rhs.d_location);
+        d_archiveLocation       = bsl::move(rhs.d_archiveLocation);
+        d_maxDataFileSize       = bsl::move(rhs.d_maxDataFileSize);
+        d_maxJournalFileSize    = bsl::move(rhs.d_maxJournalFileSize);
+        d_maxQlistFileSize      = bsl::move(rhs.d_maxQlistFileSize);
+        d_maxCSLFileSize        = bsl::move(rhs.d_maxCSLFileSize);
+        d_preallocate           = bsl::move(rhs.d_preallocate);
+        d_maxArchivedFileSets   = bsl::move(rhs.d_maxArchivedFileSets);
+        d_prefaultPages         = bsl::move(rhs.d_prefaultPages);
+        d_flushAtShutdown       = bsl::move(rhs.d_flushAtShutdown);
+        d_syncConfig            = bsl::move(rhs.d_syncConfig);
+        d_groupCommitIntervalMs = bsl::move(rhs.d_groupCommitIntervalMs);
+        d_groupCommitMaxBytes   = bsl::move(rhs.d_groupCommitMaxBytes);
+        d_precreateFileSet      = bsl::move(rhs.d_precreateFileSet);
+        d_rolloverBatchSize     = bsl::move(rhs.d_rolloverBatchSize);
+        d_hugePages             = bsl::move(rhs.d_hugePages);
     }
 
     return *this;
@@ -4547,6 +4637,11 @@ void PartitionConfig::reset()
     d_prefaultPages   = DEFAULT_INITIALIZER_PREFAULT_PAGES;
     d_flushAtShutdown = DEFAULT_INITIALIZER_FLUSH_AT_SHUTDOWN;
     bdlat_ValueTypeFunctions::reset(&d_syncConfig);
+    d_groupCommitIntervalMs = DEFAULT_INITIALIZER_GROUP_COMMIT_INTERVAL_MS;
+    d_groupCommitMaxBytes   = DEFAULT_INITIALIZER_GROUP_COMMIT_MAX_BYTES;
+    d_precreateFileSet      = DEFAULT_INITIALIZER_PRECREATE_FILE_SET;
+    d_rolloverBatchSize     = DEFAULT_INITIALIZER_ROLLOVER_BATCH_SIZE;
+    d_hugePages             = DEFAULT_INITIALIZER_HUGE_PAGES;
 }
 
 // ACCESSORS
@@ -4569,6 +4664,12 @@ bsl::ostream& PartitionConfig::print(bsl::ostream& stream,
     printer.printAttribute("prefaultPages", this->prefaultPages());
     printer.printAttribute("flushAtShutdown", this->flushAtShutdown());
     printer.printAttribute("syncConfig", this->syncConfig());
+    printer.printAttribute("groupCommitIntervalMs",
+                           this->groupCommitIntervalMs());
+    printer.printAttribute("groupCommitMaxBytes", this->groupCommitMaxBytes());
+    printer.printAttribute("precreateFileSet", this->precreateFileSet());
+    printer.printAttribute("rolloverBatchSize", this->rolloverBatchSize());
+    printer.printAttribute("hugePages", this->hugePages());
     printer.end();
     return stream;
 }
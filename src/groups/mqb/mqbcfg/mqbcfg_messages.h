@@ -1293,10 +1293,21 @@ namespace mqbcfg {
 // ===================================
 
 class DispatcherProcessorParameters {
+    // Type representing the configuration of the queue of a processor of the
+    // dispatcher.
+    //
+    // queueSize..............: size of the queue past which it is considered
+    // full queueSizeLowWatermark..: low watermark of the queue, also used as
+    // its initial capacity queueSizeHighWatermark.: high watermark of the
+    // queue lockFreeQueue..........: flag to indicate whether the queue should
+    // be a lock-free ring buffer, whose processor spins for a while before
+    // parking when the queue is empty, instead of a mutex-based queue
+
     // INSTANCE DATA
-    int d_queueSize;
-    int d_queueSizeLowWatermark;
-    int d_queueSizeHighWatermark;
+    int  d_queueSize;
+    int  d_queueSizeLowWatermark;
+    int  d_queueSizeHighWatermark;
+    bool d_lockFreeQueue;
 
     // PRIVATE ACCESSORS
     template <typename t_HASH_ALGORITHM>
@@ -1307,20 +1318,24 @@ class DispatcherProcessorParameters {
     enum {
         ATTRIBUTE_ID_QUEUE_SIZE                = 0,
         ATTRIBUTE_ID_QUEUE_SIZE_LOW_WATERMARK  = 1,
-        ATTRIBUTE_ID_QUEUE_SIZE_HIGH_WATERMARK = 2
+        ATTRIBUTE_ID_QUEUE_SIZE_HIGH_WATERMARK = 2,
+        ATTRIBUTE_ID_LOCK_FREE_QUEUE           = 3
     };
 
-    enum { NUM_ATTRIBUTES = 3 };
+    enum { NUM_ATTRIBUTES = 4 };
 
     enum {
         ATTRIBUTE_INDEX_QUEUE_SIZE                = 0,
         ATTRIBUTE_INDEX_QUEUE_SIZE_LOW_WATERMARK  = 1,
-        ATTRIBUTE_INDEX_QUEUE_SIZE_HIGH_WATERMARK = 2
+        ATTRIBUTE_INDEX_QUEUE_SIZE_HIGH_WATERMARK = 2,
+        ATTRIBUTE_INDEX_LOCK_FREE_QUEUE           = 3
     };
 
     // CONSTANTS
     static const char CLASS_NAME[];
 
+    static const bool DEFAULT_INITIALIZER_LOCK_FREE_QUEUE;
+
     static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
 
   public:
@@ -1386,6 +1401,10 @@ class DispatcherProcessorParameters {
     // Return a reference to the modifiable "QueueSizeHighWatermark"
     // attribute of this object.
 
+    bool& lockFreeQueue();
+    // Return a reference to the modifiable "LockFreeQueue" attribute of this
+    // object.
+
     // ACCESSORS
     bsl::ostream&
     print(bsl::ostream& stream, int level = 0, int spacesPerLevel = 4) const;
@@ -1440,6 +1459,9 @@ class DispatcherProcessorParameters {
     // Return the value of the "QueueSizeHighWatermark" attribute of this
     // object.
 
+    bool lockFreeQueue() const;
+    // Return the value of the "LockFreeQueue" attribute of this object.
+
     // HIDDEN FRIENDS
     friend bool operator==(const DispatcherProcessorParameters& lhs,
                            const DispatcherProcessorParameters& rhs)
@@ -1449,7 +1471,8 @@ class DispatcherProcessorParameters {
     {
         return lhs.queueSize() == rhs.queueSize() &&
                lhs.queueSizeLowWatermark() == rhs.queueSizeLowWatermark() &&
-               lhs.queueSizeHighWatermark() == rhs.queueSizeHighWatermark();
+               lhs.queueSizeHighWatermark() == rhs.queueSizeHighWatermark() &&
+               lhs.lockFreeQueue() == rhs.lockFreeQueue();
     }
 
     friend bool operator!=(const DispatcherProcessorParameters& lhs,
@@ -6530,21 +6553,41 @@ class PartitionConfig {
     // whether to populate (prefault) page tables for a mapping.
     // flushAtShutdown......: flag to indicate whether broker should flush
     // storage files to disk at shutdown syncConfig...........: configuration
-    // for storage synchronization and recovery
+    // for storage synchronization and recovery groupCommitIntervalMs:
+    // maximum time, in milliseconds, between a write to a partition and the
+    // sync of the partition's files to disk, after which the write is
+    // acknowledged; 0 disables group commit, in which case writes are
+    // acknowledged without syncing files groupCommitMaxBytes..: number of
+    // bytes written to a partition triggering the sync of its files to
+    // disk before 'groupCommitIntervalMs' elapses, when group commit is
+    // enabled precreateFileSet.....: flag to indicate whether the next file
+    // set of a partition should be created, grown and prefaulted in the
+    // background ahead of its rollover rolloverBatchSize....: maximum number
+    // of records copied at a time by an incremental rollover of a
+    // partition, between which other work of the partition is processed; 0
+    // disables incremental rollover, in which case all records are copied at
+    // once hugePages............: flag to indicate whether the files of a
+    // partition should be mapped with huge pages, either because they
+    // reside on a hugetlbfs mount or via transparent huge pages
 
     // INSTANCE DATA
     bsls::Types::Uint64 d_maxDataFileSize;
     bsls::Types::Uint64 d_maxJournalFileSize;
     bsls::Types::Uint64 d_maxQlistFileSize;
     bsls::Types::Uint64 d_maxCSLFileSize;
+    bsls::Types::Uint64 d_groupCommitMaxBytes;
     bsl::string         d_location;
     bsl::string         d_archiveLocation;
     StorageSyncConfig   d_syncConfig;
     int                 d_numPartitions;
     int                 d_maxArchivedFileSets;
+    int                 d_groupCommitIntervalMs;
+    int                 d_rolloverBatchSize;
     bool                d_preallocate;
     bool                d_prefaultPages;
     bool                d_flushAtShutdown;
+    bool                d_precreateFileSet;
+    bool                d_hugePages;
 
     // PRIVATE ACCESSORS
     template <typename t_HASH_ALGORITHM>
@@ -6555,35 +6598,45 @@ class PartitionConfig {
   public:
     // TYPES
     enum {
-        ATTRIBUTE_ID_NUM_PARTITIONS         = 0,
-        ATTRIBUTE_ID_LOCATION               = 1,
-        ATTRIBUTE_ID_ARCHIVE_LOCATION       = 2,
-        ATTRIBUTE_ID_MAX_DATA_FILE_SIZE     = 3,
-        ATTRIBUTE_ID_MAX_JOURNAL_FILE_SIZE  = 4,
-        ATTRIBUTE_ID_MAX_QLIST_FILE_SIZE    = 5,
-        ATTRIBUTE_ID_MAX_C_S_L_FILE_SIZE    = 6,
-        ATTRIBUTE_ID_PREALLOCATE            = 7,
-        ATTRIBUTE_ID_MAX_ARCHIVED_FILE_SETS = 8,
-        ATTRIBUTE_ID_PREFAULT_PAGES         = 9,
-        ATTRIBUTE_ID_FLUSH_AT_SHUTDOWN      = 10,
-        ATTRIBUTE_ID_SYNC_CONFIG            = 11
+        ATTRIBUTE_ID_NUM_PARTITIONS           = 0,
+        ATTRIBUTE_ID_LOCATION                 = 1,
+        ATTRIBUTE_ID_ARCHIVE_LOCATION         = 2,
+        ATTRIBUTE_ID_MAX_DATA_FILE_SIZE       = 3,
+        ATTRIBUTE_ID_MAX_JOURNAL_FILE_SIZE    = 4,
+        ATTRIBUTE_ID_MAX_QLIST_FILE_SIZE      = 5,
+        ATTRIBUTE_ID_MAX_C_S_L_FILE_SIZE      = 6,
+        ATTRIBUTE_ID_PREALLOCATE              = 7,
+        ATTRIBUTE_ID_MAX_ARCHIVED_FILE_SETS   = 8,
+        ATTRIBUTE_ID_PREFAULT_PAGES           = 9,
+        ATTRIBUTE_ID_FLUSH_AT_SHUTDOWN        = 10,
+        ATTRIBUTE_ID_SYNC_CONFIG              = 11,
+        ATTRIBUTE_ID_GROUP_COMMIT_INTERVAL_MS = 12,
+        ATTRIBUTE_ID_GROUP_COMMIT_MAX_BYTES   = 13,
+        ATTRIBUTE_ID_PRECREATE_FILE_SET       = 14,
+        ATTRIBUTE_ID_ROLLOVER_BATCH_SIZE      = 15,
+        ATTRIBUTE_ID_HUGE_PAGES               = 16
     };
 
-    enum { NUM_ATTRIBUTES = 12 };
+    enum { NUM_ATTRIBUTES = 17 };
 
     enum {
-        ATTRIBUTE_INDEX_NUM_PARTITIONS         = 0,
-        ATTRIBUTE_INDEX_LOCATION               = 1,
-        ATTRIBUTE_INDEX_ARCHIVE_LOCATION       = 2,
-        ATTRIBUTE_INDEX_MAX_DATA_FILE_SIZE     = 3,
-        ATTRIBUTE_INDEX_MAX_JOURNAL_FILE_SIZE  = 4,
-        ATTRIBUTE_INDEX_MAX_QLIST_FILE_SIZE    = 5,
-        ATTRIBUTE_INDEX_MAX_C_S_L_FILE_SIZE    = 6,
-        ATTRIBUTE_INDEX_PREALLOCATE            = 7,
-        ATTRIBUTE_INDEX_MAX_ARCHIVED_FILE_SETS = 8,
-        ATTRIBUTE_INDEX_PREFAULT_PAGES         = 9,
-        ATTRIBUTE_INDEX_FLUSH_AT_SHUTDOWN      = 10,
-        ATTRIBUTE_INDEX_SYNC_CONFIG            = 11
+        ATTRIBUTE_INDEX_NUM_PARTITIONS           = 0,
+        ATTRIBUTE_INDEX_LOCATION                 = 1,
+        ATTRIBUTE_INDEX_ARCHIVE_LOCATION         = 2,
+        ATTRIBUTE_INDEX_MAX_DATA_FILE_SIZE       = 3,
+        ATTRIBUTE_INDEX_MAX_JOURNAL_FILE_SIZE    = 4,
+        ATTRIBUTE_INDEX_MAX_QLIST_FILE_SIZE      = 5,
+        ATTRIBUTE_INDEX_MAX_C_S_L_FILE_SIZE      = 6,
+        ATTRIBUTE_INDEX_PREALLOCATE              = 7,
+        ATTRIBUTE_INDEX_MAX_ARCHIVED_FILE_SETS   = 8,
+        ATTRIBUTE_INDEX_PREFAULT_PAGES           = 9,
+        ATTRIBUTE_INDEX_FLUSH_AT_SHUTDOWN        = 10,
+        ATTRIBUTE_INDEX_SYNC_CONFIG              = 11,
+        ATTRIBUTE_INDEX_GROUP_COMMIT_INTERVAL_MS = 12,
+        ATTRIBUTE_INDEX_GROUP_COMMIT_MAX_BYTES   = 13,
+        ATTRIBUTE_INDEX_PRECREATE_FILE_SET       = 14,
+        ATTRIBUTE_INDEX_ROLLOVER_BATCH_SIZE      = 15,
+        ATTRIBUTE_INDEX_HUGE_PAGES               = 16
     };
 
     // CONSTANTS
@@ -6597,6 +6650,17 @@ class PartitionConfig {
 
     static const bool DEFAULT_INITIALIZER_FLUSH_AT_SHUTDOWN;
 
+    static const int DEFAULT_INITIALIZER_GROUP_COMMIT_INTERVAL_MS;
+
+    static const bsls::Types::Uint64
+        DEFAULT_INITIALIZER_GROUP_COMMIT_MAX_BYTES;
+
+    static const bool DEFAULT_INITIALIZER_PRECREATE_FILE_SET;
+
+    static const int DEFAULT_INITIALIZER_ROLLOVER_BATCH_SIZE;
+
+    static const bool DEFAULT_INITIALIZER_HUGE_PAGES;
+
     static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
 
   public:
@@ -6738,6 +6802,26 @@ class PartitionConfig {
     // Return a reference to the modifiable "SyncConfig" attribute of this
     // object.
 
+    int& groupCommitIntervalMs();
+    // Return a reference to the modifiable "GroupCommitIntervalMs"
+    // attribute of this object.
+
+    bsls::Types::Uint64& groupCommitMaxBytes();
+    // Return a reference to the modifiable "GroupCommitMaxBytes" attribute
+    // of this object.
+
+    bool& precreateFileSet();
+    // Return a reference to the modifiable "PrecreateFileSet" attribute of
+    // this object.
+
+    int& rolloverBatchSize();
+    // Return a reference to the modifiable "RolloverBatchSize" attribute of
+    // this object.
+
+    bool& hugePages();
+    // Return a reference to the modifiable "HugePages" attribute of this
+    // object.
+
     // ACCESSORS
     bsl::ostream&
     print(bsl::ostream& stream, int level = 0, int spacesPerLevel = 4) const;
@@ -6822,6 +6906,23 @@ class PartitionConfig {
     // Return a reference offering non-modifiable access to the
     // "SyncConfig" attribute of this object.
 
+    int groupCommitIntervalMs() const;
+    // Return the value of the "GroupCommitIntervalMs" attribute of this
+    // object.
+
+    bsls::Types::Uint64 groupCommitMaxBytes() const;
+    // Return the value of the "GroupCommitMaxBytes" attribute of this
+    // object.
+
+    bool precreateFileSet() const;
+    // Return the value of the "PrecreateFileSet" attribute of this object.
+
+    int rolloverBatchSize() const;
+    // Return the value of the "RolloverBatchSize" attribute of this object.
+
+    bool hugePages() const;
+    // Return the value of the "HugePages" attribute of this object.
+
     // HIDDEN FRIENDS
     friend bool operator==(const PartitionConfig& lhs,
                            const PartitionConfig& rhs)
@@ -12051,6 +12152,7 @@ void DispatcherProcessorParameters::hashAppendImpl(
     hashAppend(hashAlgorithm, this->queueSize());
     hashAppend(hashAlgorithm, this->queueSizeLowWatermark());
     hashAppend(hashAlgorithm, this->queueSizeHighWatermark());
+    hashAppend(hashAlgorithm, this->lockFreeQueue());
 }
 
 // CLASS METHODS
@@ -12081,6 +12183,12 @@ int DispatcherProcessorParameters::manipulateAttributes(
         return ret;
     }
 
+    ret = manipulator(&d_lockFreeQueue,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_LOCK_FREE_QUEUE]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -12106,6 +12214,11 @@ int DispatcherProcessorParameters::manipulateAttribute(
             &d_queueSizeHighWatermark,
             ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_QUEUE_SIZE_HIGH_WATERMARK]);
     }
+    case ATTRIBUTE_ID_LOCK_FREE_QUEUE: {
+        return manipulator(
+            &d_lockFreeQueue,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_LOCK_FREE_QUEUE]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -12142,6 +12255,11 @@ inline int& DispatcherProcessorParameters::queueSizeHighWatermark()
     return d_queueSizeHighWatermark;
 }
 
+inline bool& DispatcherProcessorParameters::lockFreeQueue()
+{
+    return d_lockFreeQueue;
+}
+
 // ACCESSORS
 template <typename t_ACCESSOR>
 int DispatcherProcessorParameters::accessAttributes(t_ACCESSOR& accessor) const
@@ -12168,6 +12286,12 @@ int DispatcherProcessorParameters::accessAttributes(t_ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(d_lockFreeQueue,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_LOCK_FREE_QUEUE]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -12192,6 +12316,10 @@ int DispatcherProcessorParameters::accessAttribute(t_ACCESSOR& accessor,
             d_queueSizeHighWatermark,
             ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_QUEUE_SIZE_HIGH_WATERMARK]);
     }
+    case ATTRIBUTE_ID_LOCK_FREE_QUEUE: {
+        return accessor(d_lockFreeQueue,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_LOCK_FREE_QUEUE]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -12227,6 +12355,11 @@ inline int DispatcherProcessorParameters::queueSizeHighWatermark() const
     return d_queueSizeHighWatermark;
 }
 
+inline bool DispatcherProcessorParameters::lockFreeQueue() const
+{
+    return d_lockFreeQueue;
+}
+
 // -------------------
 // class ElectorConfig
 // -------------------
@@ -16597,6 +16730,11 @@ void PartitionConfig::hashAppendImpl(t_HASH_ALGORITHM& hashAlgorithm) const
     hashAppend(hashAlgorithm, this->prefaultPages());
     hashAppend(hashAlgorithm, this->flushAtShutdown());
     hashAppend(hashAlgorithm, this->syncConfig());
+    hashAppend(hashAlgorithm, this->groupCommitIntervalMs());
+    hashAppend(hashAlgorithm, this->groupCommitMaxBytes());
+    hashAppend(hashAlgorithm, this->precreateFileSet());
+    hashAppend(hashAlgorithm, this->rolloverBatchSize());
+    hashAppend(hashAlgorithm, this->hugePages());
 }
 
 inline bool PartitionConfig::isEqualTo(const PartitionConfig& rhs) const
@@ -16612,7 +16750,12 @@ inline bool PartitionConfig::isEqualTo(const PartitionConfig& rhs) const
            this->maxArchivedFileSets() == rhs.maxArchivedFileSets() &&
            this->prefaultPages() == rhs.prefaultPages() &&
            this->flushAtShutdown() == rhs.flushAtShutdown() &&
-           this->syncConfig() == rhs.syncConfig();
+           this->syncConfig() == rhs.syncConfig() &&
+           this->groupCommitIntervalMs() == rhs.groupCommitIntervalMs() &&
+           this->groupCommitMaxBytes() == rhs.groupCommitMaxBytes() &&
+           this->precreateFileSet() == rhs.precreateFileSet() &&
+           this->rolloverBatchSize() == rhs.rolloverBatchSize() &&
+           this->hugePages() == rhs.hugePages();
 }
 
 // CLASS METHODS
@@ -16699,6 +16842,40 @@ int PartitionConfig::manipulateAttributes(t_MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(
+        &d_groupCommitIntervalMs,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_COMMIT_INTERVAL_MS]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(
+        &d_groupCommitMaxBytes,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_COMMIT_MAX_BYTES]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(
+        &d_precreateFileSet,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PRECREATE_FILE_SET]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(
+        &d_rolloverBatchSize,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ROLLOVER_BATCH_SIZE]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(&d_hugePages,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_HUGE_PAGES]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -16765,6 +16942,30 @@ int PartitionConfig::manipulateAttribute(t_MANIPULATOR& manipulator, int id)
         return manipulator(&d_syncConfig,
                            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SYNC_CONFIG]);
     }
+    case ATTRIBUTE_ID_GROUP_COMMIT_INTERVAL_MS: {
+        return manipulator(
+            &d_groupCommitIntervalMs,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_COMMIT_INTERVAL_MS]);
+    }
+    case ATTRIBUTE_ID_GROUP_COMMIT_MAX_BYTES: {
+        return manipulator(
+            &d_groupCommitMaxBytes,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_COMMIT_MAX_BYTES]);
+    }
+    case ATTRIBUTE_ID_PRECREATE_FILE_SET: {
+        return manipulator(
+            &d_precreateFileSet,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PRECREATE_FILE_SET]);
+    }
+    case ATTRIBUTE_ID_ROLLOVER_BATCH_SIZE: {
+        return manipulator(
+            &d_rolloverBatchSize,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ROLLOVER_BATCH_SIZE]);
+    }
+    case ATTRIBUTE_ID_HUGE_PAGES: {
+        return manipulator(&d_hugePages,
+                           ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_HUGE_PAGES]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -16845,6 +17046,31 @@ inline StorageSyncConfig& PartitionConfig::syncConfig()
     return d_syncConfig;
 }
 
+inline int& PartitionConfig::groupCommitIntervalMs()
+{
+    return d_groupCommitIntervalMs;
+}
+
+inline bsls::Types::Uint64& PartitionConfig::groupCommitMaxBytes()
+{
+    return d_groupCommitMaxBytes;
+}
+
+inline bool& PartitionConfig::precreateFileSet()
+{
+    return d_precreateFileSet;
+}
+
+inline int& PartitionConfig::rolloverBatchSize()
+{
+    return d_rolloverBatchSize;
+}
+
+inline bool& PartitionConfig::hugePages()
+{
+    return d_hugePages;
+}
+
 // ACCESSORS
 template <typename t_ACCESSOR>
 int PartitionConfig::accessAttributes(t_ACCESSOR& accessor) const
@@ -16924,6 +17150,38 @@ int PartitionConfig::accessAttributes(t_ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(
+        d_groupCommitIntervalMs,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_COMMIT_INTERVAL_MS]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(
+        d_groupCommitMaxBytes,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_COMMIT_MAX_BYTES]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_precreateFileSet,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PRECREATE_FILE_SET]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_rolloverBatchSize,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ROLLOVER_BATCH_SIZE]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_hugePages,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_HUGE_PAGES]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -16988,6 +17246,30 @@ int PartitionConfig::accessAttribute(t_ACCESSOR& accessor, int id) const
         return accessor(d_syncConfig,
                         ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SYNC_CONFIG]);
     }
+    case ATTRIBUTE_ID_GROUP_COMMIT_INTERVAL_MS: {
+        return accessor(
+            d_groupCommitIntervalMs,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_COMMIT_INTERVAL_MS]);
+    }
+    case ATTRIBUTE_ID_GROUP_COMMIT_MAX_BYTES: {
+        return accessor(
+            d_groupCommitMaxBytes,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_COMMIT_MAX_BYTES]);
+    }
+    case ATTRIBUTE_ID_PRECREATE_FILE_SET: {
+        return accessor(
+            d_precreateFileSet,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PRECREATE_FILE_SET]);
+    }
+    case ATTRIBUTE_ID_ROLLOVER_BATCH_SIZE: {
+        return accessor(
+            d_rolloverBatchSize,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ROLLOVER_BATCH_SIZE]);
+    }
+    case ATTRIBUTE_ID_HUGE_PAGES: {
+        return accessor(d_hugePages,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_HUGE_PAGES]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -17068,6 +17350,31 @@ inline const StorageSyncConfig& PartitionConfig::syncConfig() const
     return d_syncConfig;
 }
 
+inline int PartitionConfig::groupCommitIntervalMs() const
+{
+    return d_groupCommitIntervalMs;
+}
+
+inline bsls::Types::Uint64 PartitionConfig::groupCommitMaxBytes() const
+{
+    return d_groupCommitMaxBytes;
+}
+
+inline bool PartitionConfig::precreateFileSet() const
+{
+    return d_precreateFileSet;
+}
+
+inline int PartitionConfig::rolloverBatchSize() const
+{
+    return d_rolloverBatchSize;
+}
+
+inline bool PartitionConfig::hugePages() const
+{
+    return d_hugePages;
+}
+
 // ---------------------------
 // class PluginSettingKeyValue
 // ---------------------------
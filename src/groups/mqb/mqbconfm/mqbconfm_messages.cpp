@@ -2099,14 +2099,19 @@ const bdlat_AttributeInfo Domain::ATTRIBUTE_INFO_ARRAY[] = {
      "subscriptions",
      sizeof("subscriptions") - 1,
      "",
-     bdlat_FormattingMode::e_DEFAULT}};
+     bdlat_FormattingMode::e_DEFAULT},
+    {ATTRIBUTE_ID_COMPRESSION_DICTIONARY,
+     "compressionDictionary",
+     sizeof("compressionDictionary") - 1,
+     "",
+     bdlat_FormattingMode::e_BASE64}};
 
 // CLASS METHODS
 
 const bdlat_AttributeInfo* Domain::lookupAttributeInfo(const char* name,
                                                        int         nameLength)
 {
-    for (int i = 0; i < 13; ++i) {
+    for (int i = 0; i < 14; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
             Domain::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -2146,6 +2151,8 @@ const bdlat_AttributeInfo* Domain::lookupAttributeInfo(int id)
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CONSISTENCY];
     case ATTRIBUTE_ID_SUBSCRIPTIONS:
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SUBSCRIPTIONS];
+    case ATTRIBUTE_ID_COMPRESSION_DICTIONARY:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COMPRESSION_DICTIONARY];
     default: return 0;
     }
 }
@@ -2155,6 +2162,7 @@ const bdlat_AttributeInfo* Domain::lookupAttributeInfo(int id)
 Domain::Domain(bslma::Allocator* basicAllocator)
 : d_messageTtl()
 , d_subscriptions(basicAllocator)
+, d_compressionDictionary(basicAllocator)
 , d_name(basicAllocator)
 , d_msgGroupIdConfig()
 , d_storage()
@@ -2172,6 +2180,7 @@ Domain::Domain(bslma::Allocator* basicAllocator)
 Domain::Domain(const Domain& original, bslma::Allocator* basicAllocator)
 : d_messageTtl(original.d_messageTtl)
 , d_subscriptions(original.d_subscriptions, basicAllocator)
+, d_compressionDictionary(original.d_compressionDictionary, basicAllocator)
 , d_name(original.d_name, basicAllocator)
 , d_msgGroupIdConfig(original.d_msgGroupIdConfig)
 , d_storage(original.d_storage)
@@ -2191,6 +2200,7 @@ Domain::Domain(const Domain& original, bslma::Allocator* basicAllocator)
 Domain::Domain(Domain&& original) noexcept
 : d_messageTtl(bsl::move(original.d_messageTtl)),
   d_subscriptions(bsl::move(original.d_subscriptions)),
+  d_compressionDictionary(bsl::move(original.d_compressionDictionary)),
   d_name(bsl::move(original.d_name)),
   d_msgGroupIdConfig(bsl::move(original.d_msgGroupIdConfig)),
   d_storage(bsl::move(original.d_storage)),
@@ -2208,6 +2218,8 @@ Domain::Domain(Domain&& original) noexcept
 Domain::Domain(Domain&& original, bslma::Allocator* basicAllocator)
 : d_messageTtl(bsl::move(original.d_messageTtl))
 , d_subscriptions(bsl::move(original.d_subscriptions), basicAllocator)
+, d_compressionDictionary(bsl::move(original.d_compressionDictionary),
+                          basicAllocator)
 , d_name(bsl::move(original.d_name), basicAllocator)
 , d_msgGroupIdConfig(bsl::move(original.d_msgGroupIdConfig))
 , d_storage(bsl::move(original.d_storage))
@@ -2232,19 +2244,20 @@ Domain::~Domain()
 Domain& Domain::operator=(const Domain& rhs)
 {
     if (this != &rhs) {
-        d_name                = rhs.d_name;
-        d_mode                = rhs.d_mode;
-        d_storage             = rhs.d_storage;
-        d_maxConsumers        = rhs.d_maxConsumers;
-        d_maxProducers        = rhs.d_maxProducers;
-        d_maxQueues           = rhs.d_maxQueues;
-        d_msgGroupIdConfig    = rhs.d_msgGroupIdConfig;
-        d_maxIdleTime         = rhs.d_maxIdleTime;
-        d_messageTtl          = rhs.d_messageTtl;
-        d_maxDeliveryAttempts = rhs.d_maxDeliveryAttempts;
-        d_deduplicationTimeMs = rhs.d_deduplicationTimeMs;
-        d_consistency         = rhs.d_consistency;
-        d_subscriptions       = rhs.d_subscriptions;
+        d_name                  = rhs.d_name;
+        d_mode                  = rhs.d_mode;
+        d_storage               = rhs.d_storage;
+        d_maxConsumers          = rhs.d_maxConsumers;
+        d_maxProducers          = rhs.d_maxProducers;
+        d_maxQueues             = rhs.d_maxQueues;
+        d_msgGroupIdConfig      = rhs.d_msgGroupIdConfig;
+        d_maxIdleTime           = rhs.d_maxIdleTime;
+        d_messageTtl            = rhs.d_messageTtl;
+        d_maxDeliveryAttempts   = rhs.d_maxDeliveryAttempts;
+        d_deduplicationTimeMs   = rhs.d_deduplicationTimeMs;
+        d_consistency           = rhs.d_consistency;
+        d_subscriptions         = rhs.d_subscriptions;
+        d_compressionDictionary = rhs.d_compressionDictionary;
     }
 
     return *this;
@@ -2255,19 +2268,20 @@ Domain& Domain::operator=(const Domain& rhs)
 Domain& Domain::operator=(Domain&& rhs)
 {
     if (this != &rhs) {
-        d_name                = bsl::move(rhs.d_name);
-        d_mode                = bsl::move(rhs.d_mode);
-        d_storage             = bsl::move(rhs.d_storage);
-        d_maxConsumers        = bsl::move(rhs.d_maxConsumers);
-        d_maxProducers        = bsl::move(rhs.d_maxProducers);
-        d_maxQueues           = bsl::move(rhs.d_maxQueues);
-        d_msgGroupIdConfig    = bsl::move(rhs.d_msgGroupIdConfig);
-        d_maxIdleTime         = bsl::move(rhs.d_maxIdleTime);
-        d_messageTtl          = bsl::move(rhs.d_messageTtl);
-        d_maxDeliveryAttempts = bsl::move(rhs.d_maxDeliveryAttempts);
-        d_deduplicationTimeMs = bsl::move(rhs.d_deduplicationTimeMs);
-        d_consistency         = bsl::move(rhs.d_consistency);
-        d_subscriptions       = bsl::move(rhs.d_subscriptions);
+        d_name                  = bsl::move(rhs.d_name);
+        d_mode                  = bsl::move(rhs.d_mode);
+        d_storage               = bsl::move(rhs.d_storage);
+        d_maxConsumers          = bsl::move(rhs.d_maxConsumers);
+        d_maxProducers          = bsl::move(rhs.d_maxProducers);
+        d_maxQueues             = bsl::move(rhs.d_maxQueues);
+        d_msgGroupIdConfig      = bsl::move(rhs.d_msgGroupIdConfig);
+        d_maxIdleTime           = bsl::move(rhs.d_maxIdleTime);
+        d_messageTtl            = bsl::move(rhs.d_messageTtl);
+        d_maxDeliveryAttempts   = bsl::move(rhs.d_maxDeliveryAttempts);
+        d_deduplicationTimeMs   = bsl::move(rhs.d_deduplicationTimeMs);
+        d_consistency           = bsl::move(rhs.d_consistency);
+        d_subscriptions         = bsl::move(rhs.d_subscriptions);
+        d_compressionDictionary = bsl::move(rhs.d_compressionDictionary);
     }
 
     return *this;
@@ -2289,6 +2303,7 @@ void Domain::reset()
     d_deduplicationTimeMs = DEFAULT_INITIALIZER_DEDUPLICATION_TIME_MS;
     bdlat_ValueTypeFunctions::reset(&d_consistency);
     bdlat_ValueTypeFunctions::reset(&d_subscriptions);
+    bdlat_ValueTypeFunctions::reset(&d_compressionDictionary);
 }
 
 // ACCESSORS
@@ -2311,6 +2326,8 @@ Domain::print(bsl::ostream& stream, int level, int spacesPerLevel) const
     printer.printAttribute("deduplicationTimeMs", this->deduplicationTimeMs());
     printer.printAttribute("consistency", this->consistency());
     printer.printAttribute("subscriptions", this->subscriptions());
+    printer.printAttribute("compressionDictionary",
+                           this->compressionDictionary());
     printer.end();
     return stream;
 }
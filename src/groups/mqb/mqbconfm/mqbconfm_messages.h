@@ -3182,21 +3182,25 @@ class Domain {
     // timeout, in milliseconds, to keep GUID of PUT message for the purpose of
     // detecting duplicate PUTs.  consistency.........: optional consistency
     // mode.  subscriptions.......: optional application subscriptions
+    // compressionDictionary: optional trained zstd dictionary (base64
+    // encoded) advertised to clients opening queues in this domain, used to
+    // compress small messages with ZSTD
 
     // INSTANCE DATA
-    bsls::Types::Int64                    d_messageTtl;
-    bsl::vector<Subscription>             d_subscriptions;
-    bsl::string                           d_name;
-    bdlb::NullableValue<MsgGroupIdConfig> d_msgGroupIdConfig;
-    StorageDefinition                     d_storage;
-    QueueMode                             d_mode;
-    Consistency                           d_consistency;
-    int                                   d_maxConsumers;
-    int                                   d_maxProducers;
-    int                                   d_maxQueues;
-    int                                   d_maxIdleTime;
-    int                                   d_maxDeliveryAttempts;
-    int                                   d_deduplicationTimeMs;
+    bsls::Types::Int64                      d_messageTtl;
+    bsl::vector<Subscription>               d_subscriptions;
+    bdlb::NullableValue<bsl::vector<char> > d_compressionDictionary;
+    bsl::string                             d_name;
+    bdlb::NullableValue<MsgGroupIdConfig>   d_msgGroupIdConfig;
+    StorageDefinition                       d_storage;
+    QueueMode                               d_mode;
+    Consistency                             d_consistency;
+    int                                     d_maxConsumers;
+    int                                     d_maxProducers;
+    int                                     d_maxQueues;
+    int                                     d_maxIdleTime;
+    int                                     d_maxDeliveryAttempts;
+    int                                     d_deduplicationTimeMs;
 
     // PRIVATE ACCESSORS
     template <typename t_HASH_ALGORITHM>
@@ -3207,37 +3211,39 @@ class Domain {
   public:
     // TYPES
     enum {
-        ATTRIBUTE_ID_NAME                  = 0,
-        ATTRIBUTE_ID_MODE                  = 1,
-        ATTRIBUTE_ID_STORAGE               = 2,
-        ATTRIBUTE_ID_MAX_CONSUMERS         = 3,
-        ATTRIBUTE_ID_MAX_PRODUCERS         = 4,
-        ATTRIBUTE_ID_MAX_QUEUES            = 5,
-        ATTRIBUTE_ID_MSG_GROUP_ID_CONFIG   = 6,
-        ATTRIBUTE_ID_MAX_IDLE_TIME         = 7,
-        ATTRIBUTE_ID_MESSAGE_TTL           = 8,
-        ATTRIBUTE_ID_MAX_DELIVERY_ATTEMPTS = 9,
-        ATTRIBUTE_ID_DEDUPLICATION_TIME_MS = 10,
-        ATTRIBUTE_ID_CONSISTENCY           = 11,
-        ATTRIBUTE_ID_SUBSCRIPTIONS         = 12
+        ATTRIBUTE_ID_NAME                   = 0,
+        ATTRIBUTE_ID_MODE                   = 1,
+        ATTRIBUTE_ID_STORAGE                = 2,
+        ATTRIBUTE_ID_MAX_CONSUMERS          = 3,
+        ATTRIBUTE_ID_MAX_PRODUCERS          = 4,
+        ATTRIBUTE_ID_MAX_QUEUES             = 5,
+        ATTRIBUTE_ID_MSG_GROUP_ID_CONFIG    = 6,
+        ATTRIBUTE_ID_MAX_IDLE_TIME          = 7,
+        ATTRIBUTE_ID_MESSAGE_TTL            = 8,
+        ATTRIBUTE_ID_MAX_DELIVERY_ATTEMPTS  = 9,
+        ATTRIBUTE_ID_DEDUPLICATION_TIME_MS  = 10,
+        ATTRIBUTE_ID_CONSISTENCY            = 11,
+        ATTRIBUTE_ID_SUBSCRIPTIONS          = 12,
+        ATTRIBUTE_ID_COMPRESSION_DICTIONARY = 13
     };
 
-    enum { NUM_ATTRIBUTES = 13 };
+    enum { NUM_ATTRIBUTES = 14 };
 
     enum {
-        ATTRIBUTE_INDEX_NAME                  = 0,
-        ATTRIBUTE_INDEX_MODE                  = 1,
-        ATTRIBUTE_INDEX_STORAGE               = 2,
-        ATTRIBUTE_INDEX_MAX_CONSUMERS         = 3,
-        ATTRIBUTE_INDEX_MAX_PRODUCERS         = 4,
-        ATTRIBUTE_INDEX_MAX_QUEUES            = 5,
-        ATTRIBUTE_INDEX_MSG_GROUP_ID_CONFIG   = 6,
-        ATTRIBUTE_INDEX_MAX_IDLE_TIME         = 7,
-        ATTRIBUTE_INDEX_MESSAGE_TTL           = 8,
-        ATTRIBUTE_INDEX_MAX_DELIVERY_ATTEMPTS = 9,
-        ATTRIBUTE_INDEX_DEDUPLICATION_TIME_MS = 10,
-        ATTRIBUTE_INDEX_CONSISTENCY           = 11,
-        ATTRIBUTE_INDEX_SUBSCRIPTIONS         = 12
+        ATTRIBUTE_INDEX_NAME                   = 0,
+        ATTRIBUTE_INDEX_MODE                   = 1,
+        ATTRIBUTE_INDEX_STORAGE                = 2,
+        ATTRIBUTE_INDEX_MAX_CONSUMERS          = 3,
+        ATTRIBUTE_INDEX_MAX_PRODUCERS          = 4,
+        ATTRIBUTE_INDEX_MAX_QUEUES             = 5,
+        ATTRIBUTE_INDEX_MSG_GROUP_ID_CONFIG    = 6,
+        ATTRIBUTE_INDEX_MAX_IDLE_TIME          = 7,
+        ATTRIBUTE_INDEX_MESSAGE_TTL            = 8,
+        ATTRIBUTE_INDEX_MAX_DELIVERY_ATTEMPTS  = 9,
+        ATTRIBUTE_INDEX_DEDUPLICATION_TIME_MS  = 10,
+        ATTRIBUTE_INDEX_CONSISTENCY            = 11,
+        ATTRIBUTE_INDEX_SUBSCRIPTIONS          = 12,
+        ATTRIBUTE_INDEX_COMPRESSION_DICTIONARY = 13
     };
 
     // CONSTANTS
@@ -3398,6 +3404,10 @@ class Domain {
     // Return a reference to the modifiable "Subscriptions" attribute of
     // this object.
 
+    bdlb::NullableValue<bsl::vector<char> >& compressionDictionary();
+    // Return a reference to the modifiable "CompressionDictionary"
+    // attribute of this object.
+
     // ACCESSORS
     bsl::ostream&
     print(bsl::ostream& stream, int level = 0, int spacesPerLevel = 4) const;
@@ -3488,6 +3498,11 @@ class Domain {
     // Return a reference offering non-modifiable access to the
     // "Subscriptions" attribute of this object.
 
+    const bdlb::NullableValue<bsl::vector<char> >&
+    compressionDictionary() const;
+    // Return a reference offering non-modifiable access to the
+    // "CompressionDictionary" attribute of this object.
+
     // HIDDEN FRIENDS
     friend bool operator==(const Domain& lhs, const Domain& rhs)
     // Return 'true' if the specified 'lhs' and 'rhs' attribute objects
@@ -5889,6 +5904,7 @@ void Domain::hashAppendImpl(t_HASH_ALGORITHM& hashAlgorithm) const
     hashAppend(hashAlgorithm, this->deduplicationTimeMs());
     hashAppend(hashAlgorithm, this->consistency());
     hashAppend(hashAlgorithm, this->subscriptions());
+    hashAppend(hashAlgorithm, this->compressionDictionary());
 }
 
 inline bool Domain::isEqualTo(const Domain& rhs) const
@@ -5904,7 +5920,8 @@ inline bool Domain::isEqualTo(const Domain& rhs) const
            this->maxDeliveryAttempts() == rhs.maxDeliveryAttempts() &&
            this->deduplicationTimeMs() == rhs.deduplicationTimeMs() &&
            this->consistency() == rhs.consistency() &&
-           this->subscriptions() == rhs.subscriptions();
+           this->subscriptions() == rhs.subscriptions() &&
+           this->compressionDictionary() == rhs.compressionDictionary();
 }
 
 // CLASS METHODS
@@ -5993,6 +6010,13 @@ int Domain::manipulateAttributes(t_MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(
+        &d_compressionDictionary,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COMPRESSION_DICTIONARY]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -6061,6 +6085,11 @@ int Domain::manipulateAttribute(t_MANIPULATOR& manipulator, int id)
             &d_subscriptions,
             ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SUBSCRIPTIONS]);
     }
+    case ATTRIBUTE_ID_COMPRESSION_DICTIONARY: {
+        return manipulator(
+            &d_compressionDictionary,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COMPRESSION_DICTIONARY]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -6146,6 +6175,12 @@ inline bsl::vector<Subscription>& Domain::subscriptions()
     return d_subscriptions;
 }
 
+inline bdlb::NullableValue<bsl::vector<char> >&
+Domain::compressionDictionary()
+{
+    return d_compressionDictionary;
+}
+
 // ACCESSORS
 template <typename t_ACCESSOR>
 int Domain::accessAttributes(t_ACCESSOR& accessor) const
@@ -6229,6 +6264,13 @@ int Domain::accessAttributes(t_ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(
+        d_compressionDictionary,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COMPRESSION_DICTIONARY]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -6291,6 +6333,11 @@ int Domain::accessAttribute(t_ACCESSOR& accessor, int id) const
         return accessor(d_subscriptions,
                         ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SUBSCRIPTIONS]);
     }
+    case ATTRIBUTE_ID_COMPRESSION_DICTIONARY: {
+        return accessor(
+            d_compressionDictionary,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COMPRESSION_DICTIONARY]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -6377,6 +6424,12 @@ inline const bsl::vector<Subscription>& Domain::subscriptions() const
     return d_subscriptions;
 }
 
+inline const bdlb::NullableValue<bsl::vector<char> >&
+Domain::compressionDictionary() const
+{
+    return d_compressionDictionary;
+}
+
 // ----------------------
 // class DomainDefinition
 // ----------------------
@@ -573,5 +573,21 @@ DispatcherClient::~DispatcherClient()
     // NOTHING
 }
 
+// --------------------------
+// class DispatcherEventBatch
+// --------------------------
+
+DispatcherEventBatch::DispatcherEventBatch(bslma::Allocator* allocator)
+: d_destination_p(0)
+, d_events(allocator)
+{
+    d_events.reserve(k_MAX_NUM_EVENTS);
+}
+
+DispatcherEventBatch::~DispatcherEventBatch()
+{
+    flush();
+}
+
 }  // close package namespace
 }  // close enterprise namespace
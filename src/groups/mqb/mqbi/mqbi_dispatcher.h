@@ -25,6 +25,7 @@
 //  mqbi::DispatcherClientData: VST for dispatcher client data
 //  mqbi::DispatcherClientType: Enum for identifying the type of a client
 //  mqbi::DispatcherEvent:      Context for an event dispatched
+//  mqbi::DispatcherEventBatch: Mechanism to dispatch events in batches
 //  mqbi::DispatcherEventType:  Enum for the type of a dispatcher event
 //
 //@DESCRIPTION: 'mqbi::Dispatcher' is a protocol to dispatch events of type
@@ -34,10 +35,20 @@
 // struct represents a state associated to a 'DispatcherClient' and used by the
 // 'Dispatcher'.
 //
+// 'mqbi::DispatcherEventBatch' accumulates consecutive events destined to the
+// same 'mqbi::DispatcherClient' and hands them over to the dispatcher with a
+// single call to 'mqbi::Dispatcher::dispatchEvents', so that a component
+// decoding many messages for the same destination out of one inbound event
+// pays for a single enqueue and a single wake up of the destination's
+// processor instead of one per message.
+//
 /// Thread Safety
 ///-------------
 //  mqbi::Dispatcher is thread safe
 //
+//  mqbi::DispatcherEventBatch is *not* thread safe, and is meant to be used
+//  from a single thread.
+//
 //
 /// TODO: Design
 ///------------
@@ -121,12 +132,16 @@
 #include <bsl_iostream.h>
 #include <bsl_memory.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 #include <bslma_allocator.h>
 #include <bslma_usesbslmaallocator.h>
+#include <bslmf_movableref.h>
 #include <bslmf_nestedtraitdeclaration.h>
 #include <bslmt_threadutil.h>
 #include <bsls_assert.h>
+#include <bsls_keyword.h>
 #include <bsls_nullptr.h>
+#include <bsls_performancehint.h>
 
 namespace BloombergLP {
 
@@ -394,6 +409,15 @@ class Dispatcher {
                                DispatcherClientType::Enum type,
                                ProcessorHandle            handle) = 0;
 
+    /// Dispatch all the specified `events`, in order, to the specified
+    /// `destination`, and clear `events`.  The events are enqueued to the
+    /// processor in charge of `destination` with a single operation, which
+    /// wakes up that processor at most once.  The behavior is undefined
+    /// unless each event was obtained by a call to `getEvent` with a type
+    /// matching the one of `destination`.
+    virtual void dispatchEvents(bsl::vector<DispatcherEventSp>* events,
+                                DispatcherClient* destination) = 0;
+
     /// Execute the specified `functor`, using the optionally specified
     /// dispatcher `type`, in the processor associated to the specified
     /// `client`.  The behavior is undefined unless `type` is `e_DISPATCHER`
@@ -1290,6 +1314,71 @@ class DispatcherClient {
 /// return a reference to the modifiable `stream`.
 bsl::ostream& operator<<(bsl::ostream& stream, const DispatcherClient& client);
 
+// ==========================
+// class DispatcherEventBatch
+// ==========================
+
+/// Mechanism accumulating consecutive events destined to the same
+/// `DispatcherClient`, and dispatching them with a single call to
+/// `Dispatcher::dispatchEvents` when the destination changes, when the
+/// batch is full, or when explicitly flushed.
+class DispatcherEventBatch {
+  public:
+    // PUBLIC CONSTANTS
+
+    /// Maximum number of events accumulated before the batch is flushed,
+    /// bounding the latency added to the first event of a batch.
+    static const int k_MAX_NUM_EVENTS = 128;
+
+  private:
+    // DATA
+
+    /// Destination of the events in `d_events`, or 0 if there are none.
+    DispatcherClient* d_destination_p;
+
+    /// Events pending dispatch, in order.
+    bsl::vector<Dispatcher::DispatcherEventSp> d_events;
+
+  private:
+    // NOT IMPLEMENTED
+    DispatcherEventBatch(const DispatcherEventBatch&) BSLS_KEYWORD_DELETED;
+    DispatcherEventBatch&
+    operator=(const DispatcherEventBatch&) BSLS_KEYWORD_DELETED;
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(DispatcherEventBatch,
+                                   bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create an empty batch, using the optionally specified `allocator`
+    /// to supply memory.
+    explicit DispatcherEventBatch(bslma::Allocator* allocator = 0);
+
+    /// Flush and destroy this object.
+    ~DispatcherEventBatch();
+
+    // MANIPULATORS
+
+    /// Append the specified `event` to this batch, to be dispatched to the
+    /// specified `destination`.  If `destination` differs from the
+    /// destination of the events already in this batch, flush these events
+    /// first.  The behavior is undefined unless `event` was obtained by a
+    /// call to `getEvent` with a type matching the one of `destination`.
+    void add(Dispatcher::DispatcherEventRvRef event,
+             DispatcherClient*                destination);
+
+    /// Dispatch all the events of this batch to their destination, and
+    /// clear this batch.  This method has no effect if this batch is empty.
+    void flush();
+
+    // ACCESSORS
+
+    /// Return the number of events pending dispatch in this batch.
+    int numEvents() const;
+};
+
 // ============================================================================
 //                             INLINE DEFINITIONS
 // ============================================================================
@@ -1784,6 +1873,49 @@ inline const Dispatcher* DispatcherClientData::dispatcher() const
     return d_dispatcher_p;
 }
 
+// --------------------------
+// class DispatcherEventBatch
+// --------------------------
+
+// MANIPULATORS
+inline void
+DispatcherEventBatch::add(Dispatcher::DispatcherEventRvRef event,
+                          DispatcherClient*                destination)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(destination);
+
+    if (destination != d_destination_p) {
+        flush();
+        d_destination_p = destination;
+    }
+
+    d_events.push_back(bslmf::MovableRefUtil::move(event));
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+            d_events.size() >= static_cast<size_t>(k_MAX_NUM_EVENTS))) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        flush();
+    }
+}
+
+inline void DispatcherEventBatch::flush()
+{
+    if (!d_events.empty()) {
+        d_destination_p->dispatcher()->dispatchEvents(&d_events,
+                                                      d_destination_p);
+        BSLS_ASSERT_SAFE(d_events.empty());
+    }
+
+    d_destination_p = 0;
+}
+
+// ACCESSORS
+inline int DispatcherEventBatch::numEvents() const
+{
+    return static_cast<int>(d_events.size());
+}
+
 }  // close package namespace
 
 // ---------------------------
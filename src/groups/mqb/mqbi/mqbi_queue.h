@@ -621,6 +621,17 @@ class QueueHandle {
                              const bsl::shared_ptr<bdlbb::Blob>& appData,
                              const bsl::shared_ptr<bdlbb::Blob>& options) = 0;
 
+    /// Post the message with the specified PUT `header`, `appData` and
+    /// `options` to the queue, by appending the corresponding event to the
+    /// specified `batch` rather than dispatching it immediately.  The event
+    /// reaches the queue when `batch` is flushed.
+    ///
+    /// THREAD: this method must be called from the thread owning `batch`.
+    virtual void postMessage(const bmqp::PutHeader&              header,
+                             const bsl::shared_ptr<bdlbb::Blob>& appData,
+                             const bsl::shared_ptr<bdlbb::Blob>& options,
+                             DispatcherEventBatch*               batch) = 0;
+
     /// Confirm the message with the specified `msgGUID` for the specified
     /// `downstreamSubQueueId` stream of the queue.
     /// Use the specified `eventSource_p` for event allocations.
@@ -632,6 +643,18 @@ class QueueHandle {
                                 const bmqt::MessageGUID&     msgGUID,
                                 unsigned int downstreamSubQueueId) = 0;
 
+    /// Confirm the message with the specified `msgGUID` for the specified
+    /// `downstreamSubQueueId` stream of the queue, by appending the
+    /// corresponding event, allocated from the specified `eventSource_p`,
+    /// to the specified `batch` rather than dispatching it immediately.
+    /// The confirmation reaches the queue when `batch` is flushed.
+    ///
+    /// THREAD: this method must be called from the thread owning `batch`.
+    virtual void confirmMessage(mqbi::DispatcherEventSource* eventSource_p,
+                                const bmqt::MessageGUID&     msgGUID,
+                                unsigned int          downstreamSubQueueId,
+                                DispatcherEventBatch* batch) = 0;
+
     /// Reject the message with the specified `msgGUID` for the specified
     /// `subQueueId` stream of the queue.
     ///
@@ -917,6 +940,19 @@ class Queue : public DispatcherClient {
         bmqt::CompressionAlgorithmType::Enum compressionAlgorithmType,
         bool                                 isOutOfOrder) = 0;
 
+    /// Equivalent to the `onPushMessage` overload above, except that the
+    /// event carrying the message is appended to the specified `batch`
+    /// rather than dispatched immediately, and reaches this queue when
+    /// `batch` is flushed.
+    virtual void onPushMessage(
+        const bmqt::MessageGUID&             msgGUID,
+        const bsl::shared_ptr<bdlbb::Blob>&  appData,
+        const bsl::shared_ptr<bdlbb::Blob>&  options,
+        const bmqp::MessagePropertiesInfo&   messagePropertiesInfo,
+        bmqt::CompressionAlgorithmType::Enum compressionAlgorithmType,
+        bool                                 isOutOfOrder,
+        DispatcherEventBatch*                batch) = 0;
+
     /// Confirm the message with the specified `msgGUID` for the specified
     /// `upstreamSubQueueId` stream of the queue on behalf of the client
     /// identified by the specified `source`.  Also note that since there
@@ -159,6 +159,12 @@ StorageIterator::~StorageIterator()
     // NOTHING
 }
 
+// ACCESSORS
+SubscriptionResults* StorageIterator::subscriptionResults() const
+{
+    return 0;
+}
+
 // -------------
 // class Storage
 // -------------
@@ -58,6 +58,7 @@
 #include <bsl_utility.h>
 #include <bsl_vector.h>
 #include <bslma_managedptr.h>
+#include <bsls_assert.h>
 #include <bsls_types.h>
 
 namespace BloombergLP {
@@ -299,6 +300,50 @@ struct AppMessage {
     bool isPushing() const;
 };
 
+struct SubscriptionResults {
+    // VST to cache the results of evaluating subscription expressions against
+    // a message, so that (re)delivering the message to any App does not
+    // evaluate the same expression again.  Results are keyed by the id of an
+    // expression which is less than 'k_CAPACITY' and are valid only within
+    // the epoch the ids are assigned in.
+
+    // PUBLIC CONSTANTS
+    static const unsigned int k_CAPACITY = 64;
+
+    bsls::Types::Uint64 d_epoch;
+    // The epoch of the cached results, or 0 if there are none
+
+    bsls::Types::Uint64 d_evaluated;
+    // Bit per id, set if the expression is evaluated
+
+    bsls::Types::Uint64 d_matched;
+    // Bit per id, set if the expression is evaluated to 'true'
+
+    SubscriptionResults();
+
+    /// Record the specified `result` of evaluating the expression with the
+    /// specified `id` in the specified `epoch`.  Discard any results of
+    /// another epoch.  The behavior is undefined unless `id < k_CAPACITY`
+    /// and `epoch != 0`.
+    void store(unsigned int id, bool result, bsls::Types::Uint64 epoch);
+
+    /// Record the results of evaluating the expressions which ids have
+    /// their bit set in the specified `ids`: `true` if the bit is also set
+    /// in the specified `matched`, and `false` otherwise, in the specified
+    /// `epoch`.  Discard any results of another epoch.  The behavior is
+    /// undefined unless `epoch != 0`.
+    void storeAll(bsls::Types::Uint64 ids,
+                  bsls::Types::Uint64 matched,
+                  bsls::Types::Uint64 epoch);
+
+    /// Load into the specified `result` the result of evaluating the
+    /// expression with the specified `id` in the specified `epoch`, and
+    /// return `true` if it is cached.  Return `false` otherwise.  The
+    /// behavior is undefined unless `id < k_CAPACITY`.
+    bool
+    load(bool* result, unsigned int id, bsls::Types::Uint64 epoch) const;
+};
+
 struct DataStreamMessage {
     // VST to track the state associated with a GUID (for all Apps).
 
@@ -311,6 +356,9 @@ struct DataStreamMessage {
     bsl::vector<mqbi::AppMessage> d_apps;
     // App states for the message
 
+    SubscriptionResults d_subscriptionResults;
+    // Subscription expressions evaluated for the message (for all Apps)
+
     DataStreamMessage(int numApps, int size, bslma::Allocator* allocator);
 
     /// Return reference to the modifiable state of the App corresponding
@@ -400,6 +448,13 @@ class StorageIterator {
     /// `items` collection and the message currently pointed at by this
     /// iterator has received replication factor Receipts.
     virtual bool hasReceipt() const = 0;
+
+    /// Return a pointer to the modifiable cache of the results of
+    /// evaluating subscription expressions against the message currently
+    /// pointed at by this iterator, or 0 if this iterator does not keep
+    /// such cache.  The behavior is undefined unless `atEnd` returns
+    /// `false`.  Note that the default implementation returns 0.
+    virtual SubscriptionResults* subscriptionResults() const;
 };
 
 // =============
@@ -749,6 +804,76 @@ inline bool AppMessage::isPushing() const
     return d_state == e_PUSH;
 }
 
+// -------------------------
+// class SubscriptionResults
+// -------------------------
+
+inline SubscriptionResults::SubscriptionResults()
+: d_epoch(0)
+, d_evaluated(0)
+, d_matched(0)
+{
+    // NOTHING
+}
+
+inline void SubscriptionResults::store(unsigned int        id,
+                                       bool                result,
+                                       bsls::Types::Uint64 epoch)
+{
+    BSLS_ASSERT_SAFE(id < k_CAPACITY);
+    BSLS_ASSERT_SAFE(epoch != 0);
+
+    if (d_epoch != epoch) {
+        d_epoch     = epoch;
+        d_evaluated = 0;
+        d_matched   = 0;
+    }
+
+    const bsls::Types::Uint64 bit = 1ULL << id;
+
+    d_evaluated |= bit;
+    if (result) {
+        d_matched |= bit;
+    }
+    else {
+        d_matched &= ~bit;
+    }
+}
+
+inline void SubscriptionResults::storeAll(bsls::Types::Uint64 ids,
+                                          bsls::Types::Uint64 matched,
+                                          bsls::Types::Uint64 epoch)
+{
+    BSLS_ASSERT_SAFE(epoch != 0);
+
+    if (d_epoch != epoch) {
+        d_epoch     = epoch;
+        d_evaluated = 0;
+        d_matched   = 0;
+    }
+
+    d_evaluated |= ids;
+    d_matched = (d_matched & ~ids) | (matched & ids);
+}
+
+inline bool SubscriptionResults::load(bool*               result,
+                                      unsigned int        id,
+                                      bsls::Types::Uint64 epoch) const
+{
+    BSLS_ASSERT_SAFE(result);
+    BSLS_ASSERT_SAFE(id < k_CAPACITY);
+
+    const bsls::Types::Uint64 bit = 1ULL << id;
+
+    if (d_epoch != epoch || (d_evaluated & bit) == 0) {
+        return false;  // RETURN
+    }
+
+    *result = (d_matched & bit) != 0;
+
+    return true;
+}
+
 // -----------------------
 // class DataStreamMessage
 // -----------------------
@@ -759,6 +884,7 @@ inline DataStreamMessage::DataStreamMessage(int               numApps,
 : d_numApps(numApps)
 , d_size(size)
 , d_apps(allocator)
+, d_subscriptionResults()
 {
     // NOTHING
 }
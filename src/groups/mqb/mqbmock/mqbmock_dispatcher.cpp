@@ -105,6 +105,16 @@ void Dispatcher::dispatchEvent(
     // NOTHING
 }
 
+void Dispatcher::dispatchEvents(
+    bsl::vector<mqbi::Dispatcher::DispatcherEventSp>* events,
+    mqbi::DispatcherClient*                           destination)
+{
+    for (size_t i = 0; i < events->size(); ++i) {
+        destination->onDispatcherEvent(*(*events)[i]);
+    }
+    events->clear();
+}
+
 void Dispatcher::execute(const mqbi::Dispatcher::VoidFunctor& functor,
                          BSLA_UNUSED mqbi::DispatcherClient* client,
                          BSLA_UNUSED mqbi::DispatcherEventType::Enum type)
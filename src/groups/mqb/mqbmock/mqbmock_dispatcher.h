@@ -48,6 +48,7 @@
 #include <bsl_memory.h>
 #include <bsl_queue.h>
 #include <bsl_unordered_map.h>
+#include <bsl_vector.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
 #include <bslmt_mutex.h>
@@ -205,6 +206,12 @@ class Dispatcher BSLS_KEYWORD_FINAL : public mqbi::Dispatcher {
                        mqbi::Dispatcher::ProcessorHandle      handle)
         BSLS_KEYWORD_OVERRIDE;
 
+    /// Deliver, in order, all the specified `events` to the specified
+    /// `destination`, and clear `events`.
+    void
+    dispatchEvents(bsl::vector<mqbi::Dispatcher::DispatcherEventSp>* events,
+                   mqbi::DispatcherClient* destination) BSLS_KEYWORD_OVERRIDE;
+
     /// Execute the specified `functor`, using the optionally specified
     /// dispatcher `type`, in the processor associated to the specified
     /// `client`.  The behavior is undefined unless `type` is `e_DISPATCHER`
@@ -269,6 +269,23 @@ void Queue::onPushMessage(
     // NOTHING
 }
 
+void Queue::onPushMessage(
+    const bmqt::MessageGUID&             msgGUID,
+    const bsl::shared_ptr<bdlbb::Blob>&  appData,
+    const bsl::shared_ptr<bdlbb::Blob>&  options,
+    const bmqp::MessagePropertiesInfo&   messagePropertiesInfo,
+    bmqt::CompressionAlgorithmType::Enum compressionAlgorithmType,
+    bool                                 isOutOfOrder,
+    BSLA_UNUSED mqbi::DispatcherEventBatch* batch)
+{
+    onPushMessage(msgGUID,
+                  appData,
+                  options,
+                  messagePropertiesInfo,
+                  compressionAlgorithmType,
+                  isOutOfOrder);
+}
+
 void Queue::confirmMessage(const bmqt::MessageGUID& msgGUID,
                            unsigned int             upstreamSubQueueId,
                            mqbi::QueueHandle*       source)
@@ -266,6 +266,17 @@ class Queue : public mqbi::Queue {
         bmqt::CompressionAlgorithmType::Enum compressionAlgorithmType,
         bool isOutOfOrder) BSLS_KEYWORD_OVERRIDE;
 
+    /// Forward to the `onPushMessage` overload above, ignoring the
+    /// specified `batch`.
+    void onPushMessage(
+        const bmqt::MessageGUID&             msgGUID,
+        const bsl::shared_ptr<bdlbb::Blob>&  appData,
+        const bsl::shared_ptr<bdlbb::Blob>&  options,
+        const bmqp::MessagePropertiesInfo&   messagePropertiesInfo,
+        bmqt::CompressionAlgorithmType::Enum compressionAlgorithmType,
+        bool                                 isOutOfOrder,
+        mqbi::DispatcherEventBatch*          batch) BSLS_KEYWORD_OVERRIDE;
+
     /// Confirm the message with the specified `msgGUID` for the specified
     /// `upstreamSubQueueId` stream of the queue on behalf of the client
     /// identified by the specified `source`.  Also note that since there
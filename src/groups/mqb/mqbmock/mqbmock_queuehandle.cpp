@@ -216,6 +216,14 @@ void QueueHandle::postMessage(
     // NOTHING
 }
 
+void QueueHandle::postMessage(const bmqp::PutHeader&              putHeader,
+                              const bsl::shared_ptr<bdlbb::Blob>& appData,
+                              const bsl::shared_ptr<bdlbb::Blob>& options,
+                              BSLA_UNUSED mqbi::DispatcherEventBatch* batch)
+{
+    postMessage(putHeader, appData, options);
+}
+
 void QueueHandle::confirmMessage(
     BSLA_MAYBE_UNUSED mqbi::DispatcherEventSource* eventSource_p,
     const bmqt::MessageGUID&                       msgGUID,
@@ -241,6 +249,14 @@ void QueueHandle::confirmMessage(
     // end up having two threads working on the same redelivery list.
 }
 
+void QueueHandle::confirmMessage(mqbi::DispatcherEventSource* eventSource_p,
+                                 const bmqt::MessageGUID&     msgGUID,
+                                 unsigned int downstreamSubQueueId,
+                                 BSLA_UNUSED mqbi::DispatcherEventBatch* batch)
+{
+    confirmMessage(eventSource_p, msgGUID, downstreamSubQueueId);
+}
+
 void QueueHandle::rejectMessage(const bmqt::MessageGUID& msgGUID,
                                 unsigned int             downstreamSubQueueId)
 {
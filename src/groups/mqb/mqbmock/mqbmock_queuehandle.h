@@ -277,6 +277,13 @@ class QueueHandle : public mqbi::QueueHandle {
                      const bsl::shared_ptr<bdlbb::Blob>& options)
         BSLS_KEYWORD_OVERRIDE;
 
+    /// Forward to the `postMessage` overload above, ignoring the specified
+    /// `batch`, so that classes overriding that overload observe both.
+    void postMessage(const bmqp::PutHeader&              header,
+                     const bsl::shared_ptr<bdlbb::Blob>& appData,
+                     const bsl::shared_ptr<bdlbb::Blob>& options,
+                     mqbi::DispatcherEventBatch* batch) BSLS_KEYWORD_OVERRIDE;
+
     /// Confirm the message with the specified `msgGUID` for the specified
     /// `downstreamSubQueueId` stream of the queue.
     /// Use the specified `eventSource_p` for event allocations.
@@ -289,6 +296,14 @@ class QueueHandle : public mqbi::QueueHandle {
                    const bmqt::MessageGUID&     msgGUID,
                    unsigned int downstreamSubQueueId) BSLS_KEYWORD_OVERRIDE;
 
+    /// Forward to the `confirmMessage` overload above, ignoring the
+    /// specified `batch`.
+    void confirmMessage(mqbi::DispatcherEventSource* eventSource_p,
+                        const bmqt::MessageGUID&     msgGUID,
+                        unsigned int                 downstreamSubQueueId,
+                        mqbi::DispatcherEventBatch*  batch)
+        BSLS_KEYWORD_OVERRIDE;
+
     /// Reject the message with the specified `msgGUID` for the specified
     /// `downstreamSubQueueId` stream of the queue.
     ///
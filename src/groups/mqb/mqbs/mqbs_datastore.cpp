@@ -122,6 +122,11 @@ DataStoreConfig::DataStoreConfig()
 , d_maxJournalFileSize(0)
 , d_maxQlistFileSize(0)
 , d_maxArchivedFileSets(0)
+, d_groupCommitIntervalMs(0)
+, d_groupCommitMaxBytes(0)
+, d_precreateFileSet(false)
+, d_rolloverBatchSize(0)
+, d_hugePages(false)
 {
     // NOTHING
 }
@@ -153,6 +158,12 @@ bsl::ostream& DataStoreConfig::print(bsl::ostream& stream,
     printer.printAttribute("hasRecoveredQueuesCb",
                            (recoveredQueuesCb() ? "yes" : "no"));
     printer.printAttribute("maxArchiveFileSets", maxArchivedFileSets());
+    printer.printAttribute("groupCommitIntervalMs", groupCommitIntervalMs());
+    printer.printAttribute("groupCommitMaxBytes", groupCommitMaxBytes());
+    printer.printAttribute("precreateFileSet",
+                           (hasPrecreateFileSet() ? "true" : "false"));
+    printer.printAttribute("rolloverBatchSize", rolloverBatchSize());
+    printer.printAttribute("hugePages", (hasHugePages() ? "true" : "false"));
     printer.end();
     return stream;
 }
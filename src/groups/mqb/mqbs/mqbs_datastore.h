@@ -105,6 +105,13 @@ struct DataStoreRecord {
     bool d_hasReceipt;
     // Strong consistency receipt.
 
+    unsigned char d_fileSetGeneration;
+    // Generation of the file set holding
+    // the record, as maintained by the
+    // data store.  Used to tell the
+    // records not yet copied by an
+    // incremental rollover in progress.
+
     bsls::Types::Uint64 d_recordOffset;  // Offset of record in journal
 
     bsls::Types::Uint64 d_messageOffset;
@@ -430,6 +437,33 @@ class DataStoreConfig {
 
     int d_maxArchivedFileSets;
 
+    int d_groupCommitIntervalMs;
+    // Maximum time, in milliseconds,
+    // between a write and the sync of the
+    // files to disk covering it, or 0 if
+    // group commit is disabled.
+
+    bsls::Types::Uint64 d_groupCommitMaxBytes;
+    // Number of bytes written triggering
+    // the sync of the files to disk before
+    // 'd_groupCommitIntervalMs' elapses.
+
+    bool d_precreateFileSet;
+    // Flag to indicate whether the next
+    // file set should be created in the
+    // background ahead of rollover.
+
+    int d_rolloverBatchSize;
+    // Maximum number of records copied at
+    // a time by an incremental rollover,
+    // or 0 if incremental rollover is
+    // disabled.
+
+    bool d_hugePages;
+    // Flag to indicate whether to back
+    // the mappings of the files with huge
+    // pages.
+
   public:
     // CREATORS
     DataStoreConfig();
@@ -454,6 +488,35 @@ class DataStoreConfig {
     /// reference offering modifiable access to this object.
     DataStoreConfig& setMaxArchivedFileSets(int value);
 
+    /// Set the maximum time, in milliseconds, between a write and the sync
+    /// of the files to disk covering it to the specified `value`, and
+    /// return a reference offering modifiable access to this object.  A
+    /// `value` of 0 disables group commit, in which case writes are
+    /// acknowledged without syncing files.
+    DataStoreConfig& setGroupCommitIntervalMs(int value);
+
+    /// Set the number of bytes written triggering the sync of the files to
+    /// disk before the group commit interval elapses to the specified
+    /// `value`, and return a reference offering modifiable access to this
+    /// object.
+    DataStoreConfig& setGroupCommitMaxBytes(bsls::Types::Uint64 value);
+
+    /// Set whether the next file set is created, grown and prefaulted in the
+    /// background ahead of rollover to the specified `value`, and return a
+    /// reference offering modifiable access to this object.
+    DataStoreConfig& setPrecreateFileSet(bool value);
+
+    /// Set the maximum number of records copied at a time by an incremental
+    /// rollover to the specified `value`, and return a reference offering
+    /// modifiable access to this object.  A `value` of 0 disables
+    /// incremental rollover, in which case all records are copied at once.
+    DataStoreConfig& setRolloverBatchSize(int value);
+
+    /// Set whether the mappings of the files are backed with huge pages to
+    /// the specified `value`, and return a reference offering modifiable
+    /// access to this object.
+    DataStoreConfig& setHugePages(bool value);
+
     // ACCESSORS
     bdlbb::BlobBufferFactory* bufferFactory() const;
     bdlmt::EventScheduler*    scheduler() const;
@@ -473,6 +536,18 @@ class DataStoreConfig {
     /// Return the value of the corresponding member.
     int maxArchivedFileSets() const;
 
+    /// Return true if group commit is enabled, i.e. if writes are
+    /// acknowledged only after the files are synced to disk, and false
+    /// otherwise.
+    bool isGroupCommitEnabled() const;
+
+    /// Return the value of the corresponding member.
+    int                 groupCommitIntervalMs() const;
+    bsls::Types::Uint64 groupCommitMaxBytes() const;
+    bool                hasPrecreateFileSet() const;
+    int                 rolloverBatchSize() const;
+    bool                hasHugePages() const;
+
     /// Format this object to the specified output `stream` at the (absolute
     /// value of) the optionally specified indentation `level` and return a
     /// reference to `stream`.  If `level` is specified, optionally specify
@@ -766,6 +841,7 @@ class DataStore : public mqbi::DispatcherClient {
 inline DataStoreRecord::DataStoreRecord()
 : d_recordType(RecordType::e_UNDEFINED)
 , d_hasReceipt(true)
+, d_fileSetGeneration(0)
 , d_recordOffset(0)
 , d_messageOffset(0)
 , d_appDataUnpaddedLen(0)
@@ -781,6 +857,7 @@ inline DataStoreRecord::DataStoreRecord(RecordType::Enum    recordType,
                                         bsls::Types::Uint64 recordOffset)
 : d_recordType(recordType)
 , d_hasReceipt(true)
+, d_fileSetGeneration(0)
 , d_recordOffset(recordOffset)
 , d_messageOffset(0)
 , d_appDataUnpaddedLen(0)
@@ -798,6 +875,7 @@ inline DataStoreRecord::DataStoreRecord(
     unsigned int        dataOrQlistRecordPaddedLen)
 : d_recordType(recordType)
 , d_hasReceipt(true)
+, d_fileSetGeneration(0)
 , d_recordOffset(recordOffset)
 , d_messageOffset(0)
 , d_appDataUnpaddedLen(0)
@@ -1038,6 +1116,37 @@ inline DataStoreConfig& DataStoreConfig::setMaxArchivedFileSets(int value)
     return *this;
 }
 
+inline DataStoreConfig& DataStoreConfig::setGroupCommitIntervalMs(int value)
+{
+    d_groupCommitIntervalMs = value;
+    return *this;
+}
+
+inline DataStoreConfig&
+DataStoreConfig::setGroupCommitMaxBytes(bsls::Types::Uint64 value)
+{
+    d_groupCommitMaxBytes = value;
+    return *this;
+}
+
+inline DataStoreConfig& DataStoreConfig::setPrecreateFileSet(bool value)
+{
+    d_precreateFileSet = value;
+    return *this;
+}
+
+inline DataStoreConfig& DataStoreConfig::setRolloverBatchSize(int value)
+{
+    d_rolloverBatchSize = value;
+    return *this;
+}
+
+inline DataStoreConfig& DataStoreConfig::setHugePages(bool value)
+{
+    d_hugePages = value;
+    return *this;
+}
+
 // ACCESSORS
 inline bdlbb::BlobBufferFactory* DataStoreConfig::bufferFactory() const
 {
@@ -1116,6 +1225,36 @@ inline int DataStoreConfig::maxArchivedFileSets() const
     return d_maxArchivedFileSets;
 }
 
+inline bool DataStoreConfig::isGroupCommitEnabled() const
+{
+    return d_groupCommitIntervalMs > 0;
+}
+
+inline int DataStoreConfig::groupCommitIntervalMs() const
+{
+    return d_groupCommitIntervalMs;
+}
+
+inline bsls::Types::Uint64 DataStoreConfig::groupCommitMaxBytes() const
+{
+    return d_groupCommitMaxBytes;
+}
+
+inline bool DataStoreConfig::hasPrecreateFileSet() const
+{
+    return d_precreateFileSet;
+}
+
+inline int DataStoreConfig::rolloverBatchSize() const
+{
+    return d_rolloverBatchSize;
+}
+
+inline bool DataStoreConfig::hasHugePages() const
+{
+    return d_hugePages;
+}
+
 // ---------------------------
 // class DataStoreRecordHandle
 // ---------------------------
@@ -66,6 +66,7 @@
 #include <bdlf_placeholder.h>
 #include <bdlma_localsequentialallocator.h>
 #include <bdls_filesystemutil.h>
+#include <bdls_memoryutil.h>
 #include <bdlt_currenttime.h>
 #include <bdlt_datetime.h>
 #include <bdlt_epochutil.h>
@@ -81,6 +82,7 @@
 #include <bsl_utility.h>
 #include <bsla_annotations.h>
 #include <bslim_printer.h>
+#include <bslmt_lockguard.h>
 #include <bsls_timeinterval.h>
 
 // SYS
@@ -99,6 +101,15 @@ typedef bsl::pair<unsigned int, bsls::Types::Uint64> MessageByteCounter;
 /// alarm
 const bsls::Types::Uint64 k_SPACE_USED_PERCENT_SOFT = 60;
 
+/// Percentage of the capacity of any file of the active file set which, once
+/// written, triggers the creation of the spare file set, if enabled.
+const bsls::Types::Uint64 k_SPARE_FILE_SET_TRIGGER_PERCENT = 50;
+
+/// Number of bytes to prefault in each file of the spare file set beyond the
+/// outstanding bytes of the active file set, which are copied at rollover.
+const bsls::Types::Uint64 k_SPARE_FILE_SET_PREFAULT_HEADROOM = 64 * 1024 *
+                                                               1024;
+
 /// Interval, in seconds, to perform a check of available space in the
 /// partition.
 const double k_PARTITION_AVAILABLESPACE_SECS = 20;
@@ -128,6 +139,26 @@ bsls::Types::Uint64 computePercentage(bsls::Types::Uint64 inUse,
     return percent;
 }
 
+/// Sync to disk the range [`from`, `to`) of the specified `file`, extended
+/// down to a page boundary as required by `msync`.  Return 0 on success, and
+/// a non-zero value otherwise, in which case details are recorded in the
+/// specified `errorDescription`.
+int syncFileRange(const MappedFileDescriptor& file,
+                  bsls::Types::Uint64         from,
+                  bsls::Types::Uint64         to,
+                  bsl::ostream&               errorDescription)
+{
+    if (from >= to) {
+        return 0;  // RETURN
+    }
+
+    const bsls::Types::Uint64 pageSize = bdls::MemoryUtil::pageSize();
+    const bsls::Types::Uint64 begin    = from - from % pageSize;
+    return FileSystemUtil::flush(file.mapping() + begin,
+                                 to - begin,
+                                 errorDescription);
+}
+
 /// Print to the specified `out` a capture of used space in the partition
 /// file represented by the specified `prefix` and having the specified
 /// `inUse`, `capacity`, and `inUsePercent` metrics.
@@ -276,6 +307,20 @@ void printNextEventRecord(bsl::ostream&                       stream,
     allocator->deallocate(p);
 }
 
+/// Record the specified `syncPointOffset` as the offset of the first sync
+/// point after rollover in the JournalFileHeader of the specified `journal`.
+void setFirstSyncPointOffset(MappedFileDescriptor* journal,
+                             bsls::Types::Uint64   syncPointOffset)
+{
+    OffsetPtr<const FileHeader>  fhJ(journal->block(), 0);
+    OffsetPtr<JournalFileHeader> jfh(journal->block(),
+                                     fhJ->headerWords() *
+                                         bmqp::Protocol::k_WORD_SIZE);
+
+    jfh->setFirstSyncPointAfterRolloverOffsetWords(
+        syncPointOffset / bmqp::Protocol::k_WORD_SIZE);
+}
+
 }  // close unnamed namespace
 
 // -------------------------------------
@@ -376,7 +421,8 @@ int FileStore::openInRecoveryMode(bsl::ostream&          errorDescription,
         rc_CONFIGURATION_ERROR                 = -7,
         rc_PARTITION_FULL                      = -8,
         rc_OPEN_FAILURE                        = -9,
-        rc_SYNC_POINT_FAILURE                  = -10
+        rc_SYNC_POINT_FAILURE                  = -10,
+        rc_UNFINISHED_ROLLOVER_FAILURE         = -11
     };
 
     MappedFileDescriptor journalFd;
@@ -394,19 +440,28 @@ int FileStore::openInRecoveryMode(bsl::ostream&          errorDescription,
     bsls::Types::Uint64 dataFilePos;
     bsls::Types::Uint64 qlistFilePos;
 
-    int rc = FileStoreUtil::openRecoveryFileSet(errorDescription,
-                                                &journalFd,
-                                                &dataFd,
-                                                &recoveryFileSet,
-                                                &journalFilePos,
-                                                &dataFilePos,
-                                                d_config.partitionId(),
-                                                k_MAX_NUM_FILE_SETS_TO_CHECK,
-                                                d_config,
-                                                true,  // readOnly
-                                                d_qListAware ? &qlistFd : 0,
-                                                d_qListAware ? &qlistFilePos
-                                                             : 0);
+    // An incremental rollover which did not complete left the newest file
+    // set without a valid first sync point, while it holds the records
+    // written after the rollover.  Complete it first, so that the newest
+    // file set is the one retrieved for recovery below.
+
+    int rc = recoverUnfinishedRollover(errorDescription, queueKeyInfoMap);
+    if (0 != rc) {
+        return 100 * rc + rc_UNFINISHED_ROLLOVER_FAILURE;  // RETURN
+    }
+
+    rc = FileStoreUtil::openRecoveryFileSet(errorDescription,
+                                            &journalFd,
+                                            &dataFd,
+                                            &recoveryFileSet,
+                                            &journalFilePos,
+                                            &dataFilePos,
+                                            d_config.partitionId(),
+                                            k_MAX_NUM_FILE_SETS_TO_CHECK,
+                                            d_config,
+                                            true,  // readOnly
+                                            d_qListAware ? &qlistFd : 0,
+                                            d_qListAware ? &qlistFilePos : 0);
 
     if (1 == rc) {
         // Special 'rc' implying no file sets present.
@@ -976,7 +1031,8 @@ int FileStore::openInRecoveryMode(bsl::ostream&          errorDescription,
         &fileSetSp->d_journalFile,
         &fileSetSp->d_dataFile,
         d_qListAware ? &fileSetSp->d_qlistFile : 0,
-        d_config.hasPrefaultPages());
+        d_config.hasPrefaultPages(),
+        d_config.hasHugePages());
 
     if (0 != rc) {
         BALL_LOG_ERROR << partitionDesc() << "Failed to open file set in write"
@@ -1076,6 +1132,343 @@ int FileStore::openInRecoveryMode(bsl::ostream&          errorDescription,
     return rc_SUCCESS;
 }
 
+int FileStore::recoverUnfinishedRollover(
+    bsl::ostream&          errorDescription,
+    const QueueKeyInfoMap& queueKeyInfoMap)
+{
+    // executed by the *DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(inDispatcherThread());
+    BSLS_ASSERT_SAFE(d_fileSets.empty());
+
+    enum {
+        rc_SUCCESS                    = 0,
+        rc_FILE_SET_RETRIEVAL_FAILURE = -1,
+        rc_OPEN_FAILURE               = -2,
+        rc_ROLLOVER_FAILURE           = -3
+    };
+
+    bsl::vector<FileStoreSet> fileSets(d_allocator_p);
+    int rc = FileStoreUtil::findFileSets(&fileSets,
+                                         d_config.location(),
+                                         d_config.partitionId(),
+                                         false,  // withSize
+                                         d_qListAware);
+    if (0 != rc) {
+        errorDescription << "Failed to retrieve file sets, rc: " << rc;
+        return 100 * rc + rc_FILE_SET_RETRIEVAL_FAILURE;  // RETURN
+    }
+
+    if (2 > fileSets.size()) {
+        // No file set was rolled over.
+
+        return rc_SUCCESS;  // RETURN
+    }
+
+    // The records written after an incremental rollover follow the space
+    // reserved in the new file set for the outstanding records of the old
+    // one, starting with a sync point, while the offset of that sync point is
+    // recorded in the JournalFileHeader only once the outstanding records
+    // have been copied.  A newest file set having a sync point but no such
+    // offset is therefore the target of a rollover which did not complete.
+    // Any other newest file set is left to 'openRecoveryFileSet'.
+
+    const FileStoreSet&  newFileSet = fileSets.back();
+    MappedFileDescriptor journalFd;
+    bmqu::MemOutStream   errorDesc;
+    rc = FileStoreUtil::openFileSetReadMode(errorDesc,
+                                            newFileSet,
+                                            &journalFd);
+    if (0 != rc) {
+        return rc_SUCCESS;  // RETURN
+    }
+
+    bool isUnfinished = false;
+    if (0 == FileStoreUtil::validateFileSet(journalFd,
+                                            MappedFileDescriptor(),
+                                            MappedFileDescriptor())) {
+        const FileHeader& fileHeader = FileStoreProtocolUtil::bmqHeader(
+            journalFd);
+        OffsetPtr<const JournalFileHeader> journalHeader(
+            journalFd.block(),
+            fileHeader.headerWords() * bmqp::Protocol::k_WORD_SIZE);
+
+        isUnfinished =
+            0 == journalHeader->firstSyncPointAfterRollloverOffsetWords() &&
+            0 != FileStoreProtocolUtil::lastJournalSyncPoint(journalFd,
+                                                             fileHeader,
+                                                             *journalHeader);
+    }
+    FileSystemUtil::close(&journalFd);
+
+    if (!isUnfinished) {
+        return rc_SUCCESS;  // RETURN
+    }
+
+    // The old file set is left untouched until the rollover completes, so its
+    // outstanding records can be recovered from it and copied again.
+
+    const FileStoreSet& oldFileSet = fileSets[fileSets.size() - 2];
+
+    BALL_LOG_WARN << partitionDesc() << "File set [" << newFileSet
+                  << "] is the target of a rollover which did not complete. "
+                  << "Completing it from file set [" << oldFileSet << "].";
+
+    FileSetSp oldFileSetSp;
+    oldFileSetSp.createInplace(d_allocator_p, this, d_allocator_p);
+    rc = FileStoreUtil::openFileSetReadMode(
+        errorDescription,
+        oldFileSet,
+        &oldFileSetSp->d_journalFile,
+        &oldFileSetSp->d_dataFile,
+        d_qListAware ? &oldFileSetSp->d_qlistFile : 0);
+    if (0 != rc) {
+        return 100 * rc + rc_OPEN_FAILURE;  // RETURN
+    }
+
+    oldFileSetSp->d_journalFileName = oldFileSet.journalFile();
+    oldFileSetSp->d_dataFileName    = oldFileSet.dataFile();
+    if (d_qListAware) {
+        oldFileSetSp->d_qlistFileName = oldFileSet.qlistFile();
+    }
+    d_fileSets.insert(d_fileSets.begin(), oldFileSetSp);
+
+    rc = completeUnfinishedRollover(errorDescription,
+                                    queueKeyInfoMap,
+                                    oldFileSet,
+                                    newFileSet);
+
+    // Discard the state recovered from the old file set.  It is recovered
+    // again from the new file set, along with the records written after the
+    // rollover.
+
+    d_records.clear();
+    d_syncPoints.clear();
+    d_fileSets.clear();
+    close(*oldFileSetSp, false);  // flush
+
+    if (0 != rc) {
+        return 100 * rc + rc_ROLLOVER_FAILURE;  // RETURN
+    }
+
+    archive(oldFileSetSp.get());
+
+    return rc_SUCCESS;
+}
+
+int FileStore::completeUnfinishedRollover(
+    bsl::ostream&          errorDescription,
+    const QueueKeyInfoMap& queueKeyInfoMap,
+    const FileStoreSet&    oldFileSet,
+    const FileStoreSet&    newFileSet)
+{
+    // executed by the *DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(inDispatcherThread());
+    BSLS_ASSERT_SAFE(1 == d_fileSets.size());
+
+    enum {
+        rc_SUCCESS               = 0,
+        rc_FILE_ITERATOR_FAILURE = -1,
+        rc_RECOVERY_FAILURE      = -2,
+        rc_OPEN_FAILURE          = -3,
+        rc_RESERVATION_MISMATCH  = -4
+    };
+
+    FileSet* activeFileSet = d_fileSets[0].get();
+
+    JournalFileIterator jit;
+    QlistFileIterator   qit;
+    DataFileIterator    dit;
+    int                 rc = FileStoreUtil::loadIterators(
+        errorDescription,
+        oldFileSet,
+        &jit,
+        activeFileSet->d_journalFile,
+        &dit,
+        activeFileSet->d_dataFile,
+        d_qListAware ? &qit : 0,
+        activeFileSet->d_qlistFile);
+    if (0 != rc) {
+        return 100 * rc + rc_FILE_ITERATOR_FAILURE;  // RETURN
+    }
+
+    // Recover the outstanding records up to the last record of the old file
+    // set, which is the sync point initiating the rollover.  Note that
+    // 'recoverMessages' expects the (leaseId, seqNum) of that record, and
+    // that the queues are handed over to the storage manager only once
+    // recovered from the new file set.
+
+    const unsigned int        primaryLeaseId = d_primaryLeaseId;
+    const bsls::Types::Uint64 sequenceNum    = d_sequenceNum;
+
+    d_primaryLeaseId = 0;
+    d_sequenceNum    = 0;
+    if (0 != jit.lastRecordPosition()) {
+        const RecordHeader& recHeader = jit.lastRecordHeader();
+        d_primaryLeaseId              = recHeader.primaryLeaseId();
+        d_sequenceNum                 = recHeader.sequenceNumber();
+    }
+
+    QueueKeyInfoMap queueKeyInfos(d_allocator_p);
+    if (d_isFSMWorkflow) {
+        queueKeyInfos = queueKeyInfoMap;
+    }
+
+    bsls::Types::Uint64 journalOffset = 0;
+    bsls::Types::Uint64 qlistOffset   = 0;
+    bsls::Types::Uint64 dataOffset    = 0;
+
+    rc = recoverMessages(&queueKeyInfos,
+                         &journalOffset,
+                         &qlistOffset,
+                         &dataOffset,
+                         &jit,
+                         &qit,
+                         &dit);
+
+    d_primaryLeaseId = primaryLeaseId;
+    d_sequenceNum    = sequenceNum;
+
+    if (0 != rc) {
+        errorDescription << "Failed to recover messages from file set ["
+                         << oldFileSet << "], rc: " << rc;
+        return 100 * rc + rc_RECOVERY_FAILURE;  // RETURN
+    }
+
+    bsls::Types::Uint64 journalLength = 0;
+    bsls::Types::Uint64 dataLength    = 0;
+    bsls::Types::Uint64 qlistLength   = 0;
+    loadRolledOverLengths(&journalLength, &dataLength, &qlistLength);
+
+    // Open the new file set as 'rolloverImpl' created it.
+
+    FileStoreSet fileSet(newFileSet, d_allocator_p);
+    fileSet.setJournalFileSize(d_config.maxJournalFileSize())
+        .setDataFileSize(d_config.maxDataFileSize())
+        .setQlistFileSize(d_qListAware ? d_config.maxQlistFileSize() : 0);
+
+    FileSet rolloverFileSet(this, d_allocator_p);
+    rc = FileStoreUtil::openFileSetWriteMode(
+        errorDescription,
+        fileSet,
+        d_config.hasPreallocate(),
+        false,  // deleteOnFailure
+        &rolloverFileSet.d_journalFile,
+        &rolloverFileSet.d_dataFile,
+        d_qListAware ? &rolloverFileSet.d_qlistFile : 0,
+        d_config.hasPrefaultPages(),
+        d_config.hasHugePages());
+    if (0 != rc) {
+        return 100 * rc + rc_OPEN_FAILURE;  // RETURN
+    }
+
+    rolloverFileSet.d_journalFileName = fileSet.journalFile();
+    rolloverFileSet.d_dataFileName    = fileSet.dataFile();
+    if (d_qListAware) {
+        rolloverFileSet.d_qlistFileName = fileSet.qlistFile();
+    }
+
+    JournalFileIterator newJit;
+    QlistFileIterator   newQit;
+    DataFileIterator    newDit;
+    rc = FileStoreUtil::loadIterators(errorDescription,
+                                      fileSet,
+                                      &newJit,
+                                      rolloverFileSet.d_journalFile,
+                                      &newDit,
+                                      rolloverFileSet.d_dataFile,
+                                      d_qListAware ? &newQit : 0,
+                                      rolloverFileSet.d_qlistFile);
+    if (0 != rc) {
+        close(rolloverFileSet, false);  // flush
+        return 100 * rc + rc_FILE_ITERATOR_FAILURE;  // RETURN
+    }
+
+    FileStoreUtil::setFileHeaderOffsets(&rolloverFileSet.d_journalFilePosition,
+                                        &rolloverFileSet.d_dataFilePosition,
+                                        newJit,
+                                        newDit,
+                                        d_qListAware,
+                                        &rolloverFileSet.d_qlistFilePosition,
+                                        newQit);
+
+    // The reserved space is followed by the first sync point written after
+    // the rollover, which refers to the end of the reserved space in the
+    // DATA and QLIST files.  Make sure that the recovered records fill it
+    // exactly before writing anything.
+
+    const bsls::Types::Uint64 syncPointOffset =
+        rolloverFileSet.d_journalFilePosition + journalLength;
+
+    bool isReserved = syncPointOffset +
+                          FileStoreProtocol::k_JOURNAL_RECORD_SIZE <=
+                      rolloverFileSet.d_journalFile.fileSize();
+    if (isReserved) {
+        OffsetPtr<const JournalOpRecord> syncPoint(
+            rolloverFileSet.d_journalFile.block(),
+            syncPointOffset);
+
+        isReserved =
+            RecordType::e_JOURNAL_OP == syncPoint->header().type() &&
+            JournalOpType::e_SYNCPOINT == syncPoint->type() &&
+            RecordHeader::k_MAGIC == syncPoint->magic() &&
+            static_cast<bsls::Types::Uint64>(
+                syncPoint->dataFileOffsetDwords()) *
+                    bmqp::Protocol::k_DWORD_SIZE ==
+                rolloverFileSet.d_dataFilePosition + dataLength &&
+            (!d_qListAware ||
+             static_cast<bsls::Types::Uint64>(
+                 syncPoint->qlistFileOffsetWords()) *
+                     bmqp::Protocol::k_WORD_SIZE ==
+                 rolloverFileSet.d_qlistFilePosition + qlistLength);
+    }
+
+    if (!isReserved) {
+        BMQTSK_ALARMLOG_ALARM("RECOVERY")
+            << partitionDesc() << "Outstanding records of file set ["
+            << oldFileSet << "] do not match the space reserved for them in "
+            << "file set [" << newFileSet << "] by the rollover which did "
+            << "not complete. Expected first sync point after rollover at "
+            << "JOURNAL offset " << syncPointOffset << ", with DATA and QLIST"
+            << " offsets " << (rolloverFileSet.d_dataFilePosition + dataLength)
+            << " and "
+            << (rolloverFileSet.d_qlistFilePosition + qlistLength)
+            << " respectively." << BMQTSK_ALARMLOG_END;
+        errorDescription << "Outstanding records of file set [" << oldFileSet
+                         << "] do not match the space reserved for them";
+        close(rolloverFileSet, false);  // flush
+        return rc_RESERVATION_MISMATCH;  // RETURN
+    }
+
+    for (RecordIterator recordIt = d_records.begin();
+         recordIt != d_records.end();
+         ++recordIt) {
+        writeRolledOverRecord(&recordIt->second,
+                              0,  // queueKeyCounterMap
+                              activeFileSet,
+                              &rolloverFileSet,
+                              &rolloverFileSet.d_journalFilePosition,
+                              &rolloverFileSet.d_dataFilePosition,
+                              &rolloverFileSet.d_qlistFilePosition);
+    }
+
+    BSLS_ASSERT_SAFE(syncPointOffset == rolloverFileSet.d_journalFilePosition);
+
+    setFirstSyncPointOffset(&rolloverFileSet.d_journalFile, syncPointOffset);
+
+    BALL_LOG_INFO << partitionDesc() << "Copied " << d_records.size()
+                  << " outstanding records from file set [" << oldFileSet
+                  << "] into file set [" << newFileSet
+                  << "], completing the rollover.";
+
+    close(rolloverFileSet, true);  // flush
+
+    return rc_SUCCESS;
+}
+
 int FileStore::recoverMessages(QueueKeyInfoMap*     queueKeyInfoMap,
                                bsls::Types::Uint64* journalOffset,
                                bsls::Types::Uint64* qlistOffset,
@@ -1122,7 +1515,8 @@ int FileStore::recoverMessages(QueueKeyInfoMap*     queueKeyInfoMap,
         rc_INVALID_CONFIRM_RECORD   = -16,
         rc_INVALID_MESSAGE_RECORD   = -17,
         rc_INVALID_DATA_RECORD      = -18,
-        rc_INVALID_PARTITION_ID     = -19
+        rc_INVALID_PARTITION_ID     = -19,
+        rc_INVALID_JOURNAL_ITERATOR = -20
     };
 
     FileSet*                    activeFileSet = d_fileSets[0].get();
@@ -1491,6 +1885,17 @@ int FileStore::recoverMessages(QueueKeyInfoMap*     queueKeyInfoMap,
                   << ". Offset of 1st sync point: " << firstSyncPtOffset
                   << ".";
 
+    if (0 > rc) {
+        // The iteration stopped at an invalid record instead of reaching the
+        // beginning of the journal, so the records preceding it would be
+        // missed.
+
+        BALL_LOG_ERROR << partitionDesc() << "Encountered invalid JOURNAL "
+                       << "record while reverse-iterating JOURNAL during "
+                       << "recovery, rc: " << rc;
+        return rc_INVALID_JOURNAL_ITERATOR;  // RETURN
+    }
+
     typedef bsl::unordered_set<bmqt::MessageGUID,
                                bslh::Hash<bmqt::MessageGUIDHashAlgo> >
                                   Guids;
@@ -2649,6 +3054,13 @@ int FileStore::recoverMessages(QueueKeyInfoMap*     queueKeyInfoMap,
     BALL_LOG_INFO << partitionDesc() << "Completed second pass over the "
                   << "journal with rc: " << rc;
 
+    if (0 > rc) {
+        BALL_LOG_ERROR << partitionDesc() << "Encountered invalid JOURNAL "
+                       << "record during second pass over the journal, rc: "
+                       << rc;
+        return rc_INVALID_JOURNAL_ITERATOR;  // RETURN
+    }
+
     return rc_SUCCESS;
 }
 
@@ -2673,6 +3085,9 @@ int FileStore::rolloverImpl(bsls::Types::Uint64 timestamp)
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(0 < d_fileSets.size());
 
+    // The active file set must be complete before it is rolled over.
+    completeRollover();
+
     FileSet* activeFileSet = d_fileSets[0].get();
     BSLS_ASSERT_SAFE(activeFileSet);
 
@@ -2693,59 +3108,103 @@ int FileStore::rolloverImpl(bsls::Types::Uint64 timestamp)
     bmqsys::StatMonitorSnapshotRecorder statRecorder(partitionDesc(),
                                                      d_allocator_p);
 
-    // Create new files, add header etc.
+    // Use the spare file set if one has been created ahead of time, or create
+    // new files, add header etc.
     FileSetSp newActiveFileSetSp;
-    int       rc = create(&newActiveFileSetSp);
+    int       rc = -1;
+    if (d_spareFileSetSp) {
+        newActiveFileSetSp.swap(d_spareFileSetSp);
+
+        bmqu::MemOutStream errorDesc;
+        rc = FileStoreUtil::activateSpare(errorDesc,
+                                          newActiveFileSetSp.get(),
+                                          d_config.partitionId(),
+                                          d_config.location(),
+                                          d_qListAware);
+        if (0 != rc) {
+            BALL_LOG_WARN << partitionDesc() << "Failed to activate spare "
+                          << "file set, rc: " << rc
+                          << ", reason: " << errorDesc.str()
+                          << ". Creating a new file set instead.";
+            discardSpareFileSet(newActiveFileSetSp);
+            newActiveFileSetSp.reset();
+        }
+    }
+
     if (0 != rc) {
-        // 'create' will log error
-        return rc;  // RETURN
+        rc = create(&newActiveFileSetSp);
+        if (0 != rc) {
+            // 'create' will log error
+            return rc;  // RETURN
+        }
     }
 
-    // Iterate over outstanding records in the active set, and copy them to the
-    // rollover set.
+    // Bump up the generation of the active file set.  Records carrying the
+    // previous generation are the ones still held by the old file set.
 
-    QueueKeyCounterMap queueKeyCounterMap;
-    for (RecordIterator recordIt = d_records.begin();
-         recordIt != d_records.end();
-         ++recordIt) {
-        writeRolledOverRecord(&(recordIt->second),
-                              &queueKeyCounterMap,
-                              activeFileSet,
-                              newActiveFileSetSp.get());
-    }
+    ++d_fileSetGeneration;
 
-    // Print summary of rolled over queues.
-    bmqu::MemOutStream outStream;
-    outStream << partitionDesc() << "Queue rollover summary:"
-              << "\n      QueueKey    NumMsgs   NumBytes      QueueUri";
+    const bool isIncremental = 0 < d_config.rolloverBatchSize() &&
+                               !d_records.empty();
+    if (isIncremental) {
+        // Only reserve the space of the outstanding records in the rollover
+        // set for now.  They are copied later on, in batches.
 
-    QueueKeyCounterList queueKeyCounters;
-    queueKeyCounters.reserve(queueKeyCounterMap.size());
-    for (QueueKeyCounterMapCIter queueKeyCounterCIter =
-             queueKeyCounterMap.cbegin();
-         queueKeyCounterCIter != queueKeyCounterMap.cend();
-         ++queueKeyCounterCIter) {
-        queueKeyCounters.push_back(*queueKeyCounterCIter);
+        startIncrementalRollover(d_fileSets[0], newActiveFileSetSp.get());
     }
-    bsl::sort(queueKeyCounters.begin(), queueKeyCounters.end(), compareByByte);
-
-    for (QueueKeyCounterListCIter queueCountersCIter =
-             queueKeyCounters.cbegin();
-         queueCountersCIter != queueKeyCounters.cend();
-         ++queueCountersCIter) {
-        StorageMapConstIter sit = d_storages.find(queueCountersCIter->first);
-        BSLS_ASSERT_SAFE(sit != d_storages.cend());
+    else {
+        // Iterate over outstanding records in the active set, and copy them
+        // to the rollover set.
+
+        QueueKeyCounterMap queueKeyCounterMap;
+        for (RecordIterator recordIt = d_records.begin();
+             recordIt != d_records.end();
+             ++recordIt) {
+            writeRolledOverRecord(&(recordIt->second),
+                                  &queueKeyCounterMap,
+                                  activeFileSet,
+                                  newActiveFileSetSp.get(),
+                                  &newActiveFileSetSp->d_journalFilePosition,
+                                  &newActiveFileSetSp->d_dataFilePosition,
+                                  &newActiveFileSetSp->d_qlistFilePosition);
+        }
 
-        outStream << "\n    [" << queueCountersCIter->first << "] "
-                  << bsl::setw(8)
-                  << bmqu::PrintUtil::prettyNumber(
-                         static_cast<int>(queueCountersCIter->second.first))
-                  << " " << bsl::setw(10)
-                  << bmqu::PrintUtil::prettyBytes(
-                         queueCountersCIter->second.second)
-                  << " " << sit->second->queueUri();
+        // Print summary of rolled over queues.
+        bmqu::MemOutStream outStream;
+        outStream << partitionDesc() << "Queue rollover summary:"
+                  << "\n      QueueKey    NumMsgs   NumBytes      QueueUri";
+
+        QueueKeyCounterList queueKeyCounters;
+        queueKeyCounters.reserve(queueKeyCounterMap.size());
+        for (QueueKeyCounterMapCIter queueKeyCounterCIter =
+                 queueKeyCounterMap.cbegin();
+             queueKeyCounterCIter != queueKeyCounterMap.cend();
+             ++queueKeyCounterCIter) {
+            queueKeyCounters.push_back(*queueKeyCounterCIter);
+        }
+        bsl::sort(queueKeyCounters.begin(),
+                  queueKeyCounters.end(),
+                  compareByByte);
+
+        for (QueueKeyCounterListCIter queueCountersCIter =
+                 queueKeyCounters.cbegin();
+             queueCountersCIter != queueKeyCounters.cend();
+             ++queueCountersCIter) {
+            StorageMapConstIter sit = d_storages.find(
+                queueCountersCIter->first);
+            BSLS_ASSERT_SAFE(sit != d_storages.cend());
+
+            outStream << "\n    [" << queueCountersCIter->first << "] "
+                      << bsl::setw(8)
+                      << bmqu::PrintUtil::prettyNumber(static_cast<int>(
+                             queueCountersCIter->second.first))
+                      << " " << bsl::setw(10)
+                      << bmqu::PrintUtil::prettyBytes(
+                             queueCountersCIter->second.second)
+                      << " " << sit->second->queueUri();
+        }
+        BALL_LOG_INFO << outStream.str();
     }
-    BALL_LOG_INFO << outStream.str();
 
     // Local refs for convenience.
 
@@ -2833,15 +3292,15 @@ int FileStore::rolloverImpl(bsls::Types::Uint64 timestamp)
     // rollover was successfully finished (this may help during recovery after
     // crash) ** NOTE ** Updating
     // JournalFileHeader.d_firstSyncPointAfterRolloverOffset must be the last
-    // operation to occur in rolling over file store.
-
-    OffsetPtr<const FileHeader>  fhJ(rJournalFile.block(), 0);
-    OffsetPtr<JournalFileHeader> jfh(rJournalFile.block(),
-                                     fhJ->headerWords() *
-                                         bmqp::Protocol::k_WORD_SIZE);
+    // operation to occur in rolling over file store.  In case of incremental
+    // rollover, this is done once all outstanding records have been copied.
 
-    jfh->setFirstSyncPointAfterRolloverOffsetWords(
-        spoPair.offset() / bmqp::Protocol::k_WORD_SIZE);
+    if (isIncremental) {
+        d_rolloverContext.d_syncPointOffset = spoPair.offset();
+    }
+    else {
+        setFirstSyncPointOffset(&rJournalFile, spoPair.offset());
+    }
 
     // Initialize first sync point after rollover sequence number.
     d_firstSyncPointAfterRolloverSeqNum.primaryLeaseId() =
@@ -2900,13 +3359,7 @@ int FileStore::rolloverImpl(bsls::Types::Uint64 timestamp)
                            "ROLLOVER - STEP 1 (COMPACTION)");
     }
 
-    // Decrement the old file set's aliased blob buffer count by 1 to obtain
-    // the 'real' value.  Note that count was initialized with a value of 1
-    // instead of 0 when file set was created.  If count is 0 (ie, if no
-    // payload blob buffers are referring to the old data file), close it out
-    // too.  Old file set can be archived as well after that.
-
-    // Irrespective of the aliased blob buffer counter, file set can be
+    // Irrespective of the aliased blob buffer counter, old file set can be
     // truncated because nothing else will be written to the file.
 
     truncate(activeFileSet);
@@ -2916,48 +3369,27 @@ int FileStore::rolloverImpl(bsls::Types::Uint64 timestamp)
                            "ROLLOVER - STEP 2 (TRUNCATE)");
     }
 
-    if (0 == --activeFileSet->d_aliasedBlobBufferCount) {
-        BALL_LOG_INFO_BLOCK
-        {
-            BALL_LOG_OUTPUT_STREAM << partitionDesc()
-                                   << "During rollover, closing old file set ["
-                                   << activeFileSet->d_dataFileName << "], ["
-                                   << activeFileSet->d_journalFileName << "]";
-            if (d_qListAware) {
-                BALL_LOG_OUTPUT_STREAM
-                    << ", [" << activeFileSet->d_qlistFileName << "]";
-            }
-            BALL_LOG_OUTPUT_STREAM << " as it can be gc'd.";
-        }
-
-        // Garbage-collect 'activeFileSet' from 'd_fileSets'.  We know that it
-        // is the first element.
-        BSLS_ASSERT_SAFE(d_fileSets.begin()->get() == activeFileSet);
-
-        // Make a copy of the target fileSetSp before erasing it from
-        // 'd_fileSets'.
-        bsl::shared_ptr<FileSet> activeFileSetSp(*d_fileSets.begin());
-        d_fileSets.erase(d_fileSets.begin());
-
-        rc = d_miscWorkThreadPool_p->enqueueJob(
-            bdlf::BindUtil::bind(&FileStore::gcWorkerDispatched,
-                                 this,
-                                 activeFileSetSp));
-        BSLS_ASSERT_SAFE(rc == 0);
-    }
-    else {
-        BALL_LOG_INFO << partitionDesc() << "Rollover: number of references to"
-                      << " old file set: "
-                      << activeFileSet->d_aliasedBlobBufferCount;
-        BSLS_ASSERT_SAFE(activeFileSet->d_dataFile.isValid());
-        BSLS_ASSERT_SAFE(activeFileSet->d_journalFile.isValid());
-        if (d_qListAware) {
-            BSLS_ASSERT_SAFE(activeFileSet->d_qlistFile.isValid());
-        }
-    }
+    // Add 'newActiveFileSetSp' as the first element of 'd_fileSets'.  The
+    // old file set is released right away, unless its records are still
+    // being copied.
 
-    // Add 'newActiveFileSetSp' as the first element of 'd_fileSets'.
     d_fileSets.insert(d_fileSets.begin(), newActiveFileSetSp);
+    if (!isIncremental) {
+        releaseFileSet(activeFileSet);
+    }
+
+    // In group commit mode, the next sync covers the new active file set in
+    // its entirety, including the rolled over records still pending sync.
+    // Bumping the generation prevents a sync of the old file set still in
+    // progress from acknowledging any record.  With an incremental rollover,
+    // no sync starts until all the records have been copied.
+    d_groupCommitDataOffset    = 0;
+    d_groupCommitQlistOffset   = 0;
+    d_groupCommitJournalOffset = 0;
+    d_groupCommitPendingBytes  = newActiveFileSetSp->d_dataFilePosition +
+                                newActiveFileSetSp->d_qlistFilePosition +
+                                newActiveFileSetSp->d_journalFilePosition;
+    ++d_groupCommitGeneration;
 
     BALL_LOG_INFO_BLOCK
     {
@@ -2991,6 +3423,15 @@ int FileStore::rolloverImpl(bsls::Types::Uint64 timestamp)
 
     d_partitionStats_sp->setRoloverTime(statRecorder.totalElapsed());
 
+    if (isIncremental) {
+        // Copy the outstanding records in batches, now that the new file set
+        // is the active one.
+
+        execute(bdlf::BindUtil::bind(&FileStore::rolloverBatchDispatched,
+                                     this,
+                                     d_fileSetGeneration));
+    }
+
     return 0;
 }
 
@@ -3021,9 +3462,15 @@ int FileStore::rolloverIfNeeded(FileType::Enum              fileType,
     }
 
     if (!needRollover(file, currentSize, requestedSpace)) {
+        precreateFileSetIfNeeded();
         return rc_SUCCESS;  // RETURN
     }
 
+    // The rollover criteria are checked against the outstanding bytes of the
+    // active file set, which must account for all its records.
+
+    completeRollover();
+
     // TBD: make the ratio configurable
     static const bsls::Types::Uint64 k_MIN_AVAILABLE_SPACE_PERCENT = 20;
 
@@ -3286,6 +3733,20 @@ int FileStore::rollover()
     return rc_SUCCESS;
 }
 
+void FileStore::completeRollover()
+{
+    // executed by the *DISPATCHER* thread
+
+    if (!isRolloverInProgress()) {
+        return;  // RETURN
+    }
+
+    BALL_LOG_INFO << partitionDesc() << "Completing rollover in progress.";
+
+    copyRolledOverRecords(bsl::numeric_limits<bsls::Types::Uint64>::max());
+    BSLS_ASSERT_SAFE(!isRolloverInProgress());
+}
+
 void FileStore::truncate(FileSet* fileSet)
 {
     bmqu::MemOutStream errorDesc;
@@ -3524,9 +3985,193 @@ void FileStore::gcDispatched(BSLA_MAYBE_UNUSED int partitionId,
     // file set.
     d_fileSets.erase(it);
 
-    BSLA_MAYBE_UNUSED const int rc = d_miscWorkThreadPool_p->enqueueJob(
-        bdlf::BindUtil::bind(&FileStore::gcWorkerDispatched, this, fileSetSp));
-    BSLS_ASSERT_SAFE(rc == 0);
+    BSLA_MAYBE_UNUSED const int rc = d_miscWorkThreadPool_p->enqueueJob(
+        bdlf::BindUtil::bind(&FileStore::gcWorkerDispatched, this, fileSetSp));
+    BSLS_ASSERT_SAFE(rc == 0);
+}
+
+void FileStore::precreateFileSetIfNeeded()
+{
+    // executed by the *DISPATCHER* thread
+
+    if (!d_config.hasPrecreateFileSet() || !d_isOpen || d_spareFileSetSp ||
+        d_isSpareFileSetPending) {
+        return;  // RETURN
+    }
+
+    const FileSet* activeFileSet = d_fileSets[0].get();
+    BSLS_ASSERT_SAFE(activeFileSet);
+
+    const bool needSpare =
+        computePercentage(activeFileSet->d_dataFilePosition,
+                          d_config.maxDataFileSize()) >=
+            k_SPARE_FILE_SET_TRIGGER_PERCENT ||
+        computePercentage(activeFileSet->d_journalFilePosition,
+                          d_config.maxJournalFileSize()) >=
+            k_SPARE_FILE_SET_TRIGGER_PERCENT ||
+        (d_qListAware &&
+         computePercentage(activeFileSet->d_qlistFilePosition,
+                           d_config.maxQlistFileSize()) >=
+             k_SPARE_FILE_SET_TRIGGER_PERCENT);
+    if (!needSpare) {
+        return;  // RETURN
+    }
+
+    // Only the region receiving the rolled over records and the writes
+    // immediately following the rollover is prefaulted: faulting in the
+    // entire files would commit their full size in the page cache.
+
+    const bsls::Types::Uint64 dataPrefaultBytes = bsl::min(
+        activeFileSet->d_outstandingBytesData +
+            k_SPARE_FILE_SET_PREFAULT_HEADROOM,
+        d_config.maxDataFileSize());
+    const bsls::Types::Uint64 journalPrefaultBytes = bsl::min(
+        activeFileSet->d_outstandingBytesJournal +
+            k_SPARE_FILE_SET_PREFAULT_HEADROOM,
+        d_config.maxJournalFileSize());
+    const bsls::Types::Uint64 qlistPrefaultBytes =
+        d_qListAware ? bsl::min(activeFileSet->d_outstandingBytesQlist +
+                                    k_SPARE_FILE_SET_PREFAULT_HEADROOM,
+                                d_config.maxQlistFileSize())
+                     : 0;
+
+    BALL_LOG_INFO << partitionDesc() << "Creating spare file set ahead of "
+                  << "rollover, prefaulting "
+                  << bmqu::PrintUtil::prettyBytes(dataPrefaultBytes)
+                  << " of DATA, "
+                  << bmqu::PrintUtil::prettyBytes(journalPrefaultBytes)
+                  << " of JOURNAL and "
+                  << bmqu::PrintUtil::prettyBytes(qlistPrefaultBytes)
+                  << " of QLIST.";
+
+    d_isSpareFileSetPending = true;
+
+    const int rc = d_miscWorkThreadPool_p->enqueueJob(
+        bdlf::BindUtil::bind(&FileStore::precreateFileSetWorkerDispatched,
+                             this,
+                             dataPrefaultBytes,
+                             journalPrefaultBytes,
+                             qlistPrefaultBytes));
+    if (0 != rc) {
+        BALL_LOG_WARN << partitionDesc() << "Failed to enqueue creation of "
+                      << "spare file set, rc: " << rc;
+        d_isSpareFileSetPending = false;
+    }
+}
+
+void FileStore::precreateFileSetWorkerDispatched(
+    bsls::Types::Uint64 dataPrefaultBytes,
+    bsls::Types::Uint64 journalPrefaultBytes,
+    bsls::Types::Uint64 qlistPrefaultBytes)
+{
+    // executed by a *WORKER* thread
+
+    const bsls::Types::Int64 startTime = bmqsys::Time::highResolutionTimer();
+
+    FileSetSp          fileSetSp;
+    bmqu::MemOutStream errorDesc;
+    int                rc = FileStoreUtil::createSpare(errorDesc,
+                                        &fileSetSp,
+                                        this,
+                                        d_config.partitionId(),
+                                        d_config,
+                                        partitionDesc(),
+                                        d_qListAware,
+                                        d_allocator_p);
+    if (0 != rc) {
+        BALL_LOG_WARN << partitionDesc() << "Failed to create spare file "
+                      << "set, rc: " << rc << ", reason: " << errorDesc.str();
+        fileSetSp.reset();
+    }
+    else {
+        rc = FileSystemUtil::prefaultForWrite(
+            fileSetSp->d_dataFile.mapping(),
+            bsl::min(dataPrefaultBytes, fileSetSp->d_dataFile.fileSize()),
+            errorDesc);
+        if (0 == rc) {
+            rc = FileSystemUtil::prefaultForWrite(
+                fileSetSp->d_journalFile.mapping(),
+                bsl::min(journalPrefaultBytes,
+                         fileSetSp->d_journalFile.fileSize()),
+                errorDesc);
+        }
+        if (0 == rc && d_qListAware) {
+            rc = FileSystemUtil::prefaultForWrite(
+                fileSetSp->d_qlistFile.mapping(),
+                bsl::min(qlistPrefaultBytes,
+                         fileSetSp->d_qlistFile.fileSize()),
+                errorDesc);
+        }
+        if (0 != rc) {
+            // Not fatal: the pages will be faulted in upon first write.
+
+            BALL_LOG_WARN << partitionDesc() << "Failed to prefault spare "
+                          << "file set, rc: " << rc
+                          << ", reason: " << errorDesc.str();
+        }
+    }
+
+    const bsls::Types::Int64 prepareTime =
+        bmqsys::Time::highResolutionTimer() - startTime;
+
+    execute(bdlf::BindUtil::bind(&FileStore::precreateFileSetDispatched,
+                                 this,
+                                 fileSetSp,
+                                 prepareTime));
+}
+
+void FileStore::precreateFileSetDispatched(const FileSetSp&   fileSet,
+                                           bsls::Types::Int64 prepareTime)
+{
+    // executed by the *DISPATCHER* thread
+
+    d_isSpareFileSetPending = false;
+
+    if (!fileSet) {
+        return;  // RETURN
+    }
+
+    if (!d_isOpen || d_spareFileSetSp) {
+        // Partition was closed while the spare file set was being created.
+
+        BSLA_MAYBE_UNUSED const int rc = d_miscWorkThreadPool_p->enqueueJob(
+            bdlf::BindUtil::bind(&FileStore::discardSpareFileSet,
+                                 this,
+                                 fileSet));
+        BSLS_ASSERT_SAFE(rc == 0);
+        return;  // RETURN
+    }
+
+    BALL_LOG_INFO << partitionDesc() << "Spare file set ["
+                  << fileSet->d_dataFileName << "], ["
+                  << fileSet->d_journalFileName << "] is ready. Time taken: "
+                  << bmqu::PrintUtil::prettyTimeInterval(prepareTime);
+
+    d_spareFileSetSp = fileSet;
+    d_partitionStats_sp->setRolloverPrepareTime(prepareTime);
+}
+
+void FileStore::discardSpareFileSet(const FileSetSp& fileSet)
+{
+    // executed by *ANY* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(fileSet);
+
+    // The spare file set holds no record: its files are neither flushed nor
+    // archived.
+
+    FileSystemUtil::close(&fileSet->d_dataFile);
+    FileSystemUtil::close(&fileSet->d_journalFile);
+    if (d_qListAware) {
+        FileSystemUtil::close(&fileSet->d_qlistFile);
+    }
+
+    bdls::FilesystemUtil::remove(fileSet->d_dataFileName);
+    bdls::FilesystemUtil::remove(fileSet->d_journalFileName);
+    if (d_qListAware) {
+        bdls::FilesystemUtil::remove(fileSet->d_qlistFileName);
+    }
 }
 
 void FileStore::gcWorkerDispatched(const bsl::shared_ptr<FileSet>& fileSet)
@@ -3551,6 +4196,11 @@ void FileStore::gcWorkerDispatched(const bsl::shared_ptr<FileSet>& fileSet)
 
     bsls::Types::Int64 startTime = bmqsys::Time::highResolutionTimer();
 
+    // A group commit sync started before the rollover may still be syncing
+    // this file set.  Note that such a sync has been enqueued before this
+    // job, so waiting for it cannot deadlock the thread pool.
+    waitForGroupCommitSync(fileSet.get());
+
     close(*fileSet, false);
     bsls::Types::Int64 closeTime = bmqsys::Time::highResolutionTimer();
     BALL_LOG_INFO << partitionDesc() << "File set closed. Time taken: "
@@ -3651,23 +4301,29 @@ int FileStore::writeQueueOpRecord(DataStoreRecordHandle*  handle,
     return rc_SUCCESS;
 }
 
-void FileStore::writeRolledOverRecord(DataStoreRecord*    record,
-                                      QueueKeyCounterMap* queueKeyCounterMap,
-                                      FileSet*            oldFileSet,
-                                      FileSet*            newFileSet)
+void FileStore::writeRolledOverRecord(DataStoreRecord*     record,
+                                      QueueKeyCounterMap*  queueKeyCounterMap,
+                                      FileSet*             oldFileSet,
+                                      FileSet*             newFileSet,
+                                      bsls::Types::Uint64* journalPosition,
+                                      bsls::Types::Uint64* dataPosition,
+                                      bsls::Types::Uint64* qlistPosition)
 {
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(0 != record->d_recordOffset);
     BSLS_ASSERT_SAFE(RecordType::e_UNDEFINED != record->d_recordType &&
                      RecordType::e_JOURNAL_OP != record->d_recordType);
+    BSLS_ASSERT_SAFE(journalPosition);
+    BSLS_ASSERT_SAFE(dataPosition);
+    BSLS_ASSERT_SAFE(qlistPosition);
 
     // Local refs for convenience
     MappedFileDescriptor& rDataFile     = newFileSet->d_dataFile;
-    bsls::Types::Uint64&  rDataFilePos  = newFileSet->d_dataFilePosition;
+    bsls::Types::Uint64&  rDataFilePos  = *dataPosition;
     MappedFileDescriptor& rJournal      = newFileSet->d_journalFile;
-    bsls::Types::Uint64&  rJournalPos   = newFileSet->d_journalFilePosition;
+    bsls::Types::Uint64&  rJournalPos   = *journalPosition;
     MappedFileDescriptor& rQlistFile    = newFileSet->d_qlistFile;
-    bsls::Types::Uint64&  rQlistFilePos = newFileSet->d_qlistFilePosition;
+    bsls::Types::Uint64&  rQlistFilePos = *qlistPosition;
 
     const MappedFileDescriptor& aJournal   = oldFileSet->d_journalFile;
     const MappedFileDescriptor& aDataFile  = oldFileSet->d_dataFile;
@@ -3715,18 +4371,21 @@ void FileStore::writeRolledOverRecord(DataStoreRecord*    record,
 
         // Increase the message and byte counter for this queue.
 
-        QueueKeyCounterMapIter qit = queueKeyCounterMap->find(
-            toRec->queueKey());
+        if (queueKeyCounterMap) {
+            QueueKeyCounterMapIter qit = queueKeyCounterMap->find(
+                toRec->queueKey());
 
-        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(queueKeyCounterMap->end() ==
-                                                  qit)) {
-            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-            BALL_LOG_ERROR << "Message with unexpected queueKey: " << *toRec;
-            BSLS_ASSERT_OPT(false && "Message with unexpected queueKey");
-        }
+            if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                    queueKeyCounterMap->end() == qit)) {
+                BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+                BALL_LOG_ERROR << "Message with unexpected queueKey: "
+                               << *toRec;
+                BSLS_ASSERT_OPT(false && "Message with unexpected queueKey");
+            }
 
-        ++(qit->second.first);
-        qit->second.second += dataMsgSize;
+            ++(qit->second.first);
+            qit->second.second += dataMsgSize;
+        }
 
         newFileSet->d_outstandingBytesData += dataMsgSize;
     }
@@ -3776,7 +4435,8 @@ void FileStore::writeRolledOverRecord(DataStoreRecord*    record,
             toRec->setQueueUriRecordOffsetWords(newQlistOffset /
                                                 bmqp::Protocol::k_WORD_SIZE);
 
-            if (QueueOpType::e_CREATION == fromRec->type()) {
+            if (queueKeyCounterMap &&
+                QueueOpType::e_CREATION == fromRec->type()) {
                 // Create an entry of this queueKey if its a queue creation
                 // record.  No need to this it in case of addition record.
 
@@ -3790,8 +4450,9 @@ void FileStore::writeRolledOverRecord(DataStoreRecord*    record,
                              QueueOpType::e_DELETION == fromRec->type());
 
             if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                    queueKeyCounterMap &&
                     queueKeyCounterMap->end() ==
-                    queueKeyCounterMap->find(fromRec->queueKey()))) {
+                        queueKeyCounterMap->find(fromRec->queueKey()))) {
                 BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
                 BALL_LOG_ERROR << "Message with unexpected queueKey: "
                                << *fromRec;
@@ -3814,13 +4475,264 @@ void FileStore::writeRolledOverRecord(DataStoreRecord*    record,
     // Irrespective of the type of record, rollover journal's position is
     // bumped up, and record's offset in-memory is updated.
 
-    record->d_recordOffset = rJournalPos;
+    record->d_recordOffset      = rJournalPos;
+    record->d_fileSetGeneration = d_fileSetGeneration;
     rJournalPos += FileStoreProtocol::k_JOURNAL_RECORD_SIZE;
 
     newFileSet->d_outstandingBytesJournal +=
         FileStoreProtocol::k_JOURNAL_RECORD_SIZE;
 }
 
+void FileStore::startIncrementalRollover(const FileSetSp& oldFileSetSp,
+                                         FileSet*         newFileSet)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(oldFileSetSp);
+    BSLS_ASSERT_SAFE(newFileSet);
+    BSLS_ASSERT_SAFE(!isRolloverInProgress());
+
+    // Compute the space taken by the outstanding records once rolled over.
+    // Reserving it up front lays out the rest of the new file set exactly as
+    // if the records were copied at once, so that the offsets of the records
+    // written from now on (starting with the first sync point) are identical
+    // across the nodes of the cluster.
+
+    bsls::Types::Uint64 journalLength = 0;
+    bsls::Types::Uint64 dataLength    = 0;
+    bsls::Types::Uint64 qlistLength   = 0;
+    loadRolledOverLengths(&journalLength, &dataLength, &qlistLength);
+
+    RolloverContext& context  = d_rolloverContext;
+    context.d_sourceFileSetSp = oldFileSetSp;
+    context.d_nextRecord      = d_records.begin();
+    context.d_journalPosition = newFileSet->d_journalFilePosition;
+    context.d_dataPosition    = newFileSet->d_dataFilePosition;
+    context.d_qlistPosition   = newFileSet->d_qlistFilePosition;
+    context.d_numRecords      = 0;
+    context.d_startTime       = bmqsys::Time::highResolutionTimer();
+
+    newFileSet->d_journalFilePosition += journalLength;
+    newFileSet->d_dataFilePosition += dataLength;
+    newFileSet->d_qlistFilePosition += qlistLength;
+
+    context.d_journalEndPosition = newFileSet->d_journalFilePosition;
+    context.d_dataEndPosition    = newFileSet->d_dataFilePosition;
+    context.d_qlistEndPosition   = newFileSet->d_qlistFilePosition;
+
+    BALL_LOG_INFO_BLOCK
+    {
+        BALL_LOG_OUTPUT_STREAM
+            << partitionDesc() << "Rolling over "
+            << bmqu::PrintUtil::prettyNumber(
+                   static_cast<bsls::Types::Int64>(d_records.size()))
+            << " outstanding records in batches of "
+            << d_config.rolloverBatchSize() << " records. Reserved JOURNAL: "
+            << bmqu::PrintUtil::prettyBytes(journalLength)
+            << ", DATA: " << bmqu::PrintUtil::prettyBytes(dataLength);
+        if (d_qListAware) {
+            BALL_LOG_OUTPUT_STREAM
+                << ", QLIST: " << bmqu::PrintUtil::prettyBytes(qlistLength);
+        }
+    }
+}
+
+void FileStore::rolloverBatchDispatched(unsigned char fileSetGeneration)
+{
+    // executed by the *DISPATCHER* thread
+
+    if (!isRolloverInProgress() || fileSetGeneration != d_fileSetGeneration) {
+        // The rollover this batch belongs to has been completed in the
+        // meantime.
+
+        return;  // RETURN
+    }
+
+    copyRolledOverRecords(d_config.rolloverBatchSize());
+
+    if (isRolloverInProgress()) {
+        execute(bdlf::BindUtil::bind(&FileStore::rolloverBatchDispatched,
+                                     this,
+                                     d_fileSetGeneration));
+    }
+}
+
+void FileStore::copyRolledOverRecords(bsls::Types::Uint64 maxNumRecords)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(isRolloverInProgress());
+
+    RolloverContext& context = d_rolloverContext;
+
+    // Records inserted since the rollover started are of the current
+    // generation, and have been appended after all the records to copy.
+    // Records removed since then have been copied before being erased.
+
+    bsls::Types::Uint64 numRecords = 0;
+    while (numRecords < maxNumRecords &&
+           context.d_nextRecord != d_records.end() &&
+           context.d_nextRecord->second.d_fileSetGeneration !=
+               d_fileSetGeneration) {
+        writeRolledOverRecord(&(context.d_nextRecord->second),
+                              0,  // queueKeyCounterMap
+                              context.d_sourceFileSetSp.get(),
+                              d_fileSets[0].get(),
+                              &context.d_journalPosition,
+                              &context.d_dataPosition,
+                              &context.d_qlistPosition);
+        ++context.d_nextRecord;
+        ++numRecords;
+    }
+
+    context.d_numRecords += numRecords;
+
+    if (context.d_nextRecord == d_records.end() ||
+        context.d_nextRecord->second.d_fileSetGeneration ==
+            d_fileSetGeneration) {
+        finishIncrementalRollover();
+    }
+}
+
+void FileStore::copyRolledOverRecord(const RecordIterator& recordIt)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(isRolloverInProgress());
+    BSLS_ASSERT_SAFE(recordIt->second.d_fileSetGeneration !=
+                     d_fileSetGeneration);
+
+    RolloverContext& context = d_rolloverContext;
+    if (recordIt == context.d_nextRecord) {
+        ++context.d_nextRecord;
+    }
+
+    writeRolledOverRecord(&(recordIt->second),
+                          0,  // queueKeyCounterMap
+                          context.d_sourceFileSetSp.get(),
+                          d_fileSets[0].get(),
+                          &context.d_journalPosition,
+                          &context.d_dataPosition,
+                          &context.d_qlistPosition);
+    ++context.d_numRecords;
+}
+
+void FileStore::finishIncrementalRollover()
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(isRolloverInProgress());
+
+    RolloverContext& context       = d_rolloverContext;
+    FileSet*         activeFileSet = d_fileSets[0].get();
+
+    if (context.d_journalPosition != context.d_journalEndPosition ||
+        context.d_dataPosition != context.d_dataEndPosition ||
+        context.d_qlistPosition != context.d_qlistEndPosition) {
+        BMQTSK_ALARMLOG_ALARM("FILE_IO")
+            << partitionDesc() << "Rolled over records do not fill the "
+            << "space reserved for them in the active file set. JOURNAL: "
+            << context.d_journalPosition << "/"
+            << context.d_journalEndPosition
+            << ", DATA: " << context.d_dataPosition << "/"
+            << context.d_dataEndPosition
+            << ", QLIST: " << context.d_qlistPosition << "/"
+            << context.d_qlistEndPosition << BMQTSK_ALARMLOG_END;
+        BSLS_ASSERT_SAFE(false && "Rolled over records mismatch reservation");
+    }
+
+    // The active file set now holds all the outstanding records, so the
+    // rollover can be marked as finished in the JournalFileHeader.
+
+    setFirstSyncPointOffset(&activeFileSet->d_journalFile,
+                            context.d_syncPointOffset);
+
+    // In group commit mode, the records copied since the rollover started
+    // may lie below the offsets synced so far, and none of them has been
+    // synced yet, so the next sync covers the active file set in its
+    // entirety.
+
+    d_groupCommitDataOffset    = 0;
+    d_groupCommitQlistOffset   = 0;
+    d_groupCommitJournalOffset = 0;
+    d_groupCommitPendingBytes  = activeFileSet->d_dataFilePosition +
+                                activeFileSet->d_qlistFilePosition +
+                                activeFileSet->d_journalFilePosition;
+    ++d_groupCommitGeneration;
+
+    BALL_LOG_INFO << partitionDesc() << "Rollover complete: copied "
+                  << bmqu::PrintUtil::prettyNumber(
+                         static_cast<bsls::Types::Int64>(context.d_numRecords))
+                  << " outstanding records in "
+                  << bmqu::PrintUtil::prettyTimeInterval(
+                         bmqsys::Time::highResolutionTimer() -
+                         context.d_startTime)
+                  << ".";
+
+    FileSetSp sourceFileSetSp(context.d_sourceFileSetSp);
+    d_rolloverContext = RolloverContext();
+
+    releaseFileSet(sourceFileSetSp.get());
+
+    if (d_config.isGroupCommitEnabled()) {
+        // Acknowledge the messages held back during the rollover without
+        // waiting for the next scheduled sync.
+        execute(bdlf::BindUtil::bind(&FileStore::groupCommitDispatched,
+                                     this));
+    }
+}
+
+void FileStore::releaseFileSet(FileSet* fileSet)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(fileSet);
+    BSLS_ASSERT_SAFE(fileSet != d_fileSets[0].get());
+
+    // Decrement the file set's aliased blob buffer count by 1 to obtain the
+    // 'real' value.  Note that count was initialized with a value of 1
+    // instead of 0 when file set was created.  If count is 0 (ie, if no
+    // payload blob buffers are referring to the data file), close it out.
+
+    if (0 == --fileSet->d_aliasedBlobBufferCount) {
+        BALL_LOG_INFO_BLOCK
+        {
+            BALL_LOG_OUTPUT_STREAM << partitionDesc()
+                                   << "During rollover, closing old file set ["
+                                   << fileSet->d_dataFileName << "], ["
+                                   << fileSet->d_journalFileName << "]";
+            if (d_qListAware) {
+                BALL_LOG_OUTPUT_STREAM << ", [" << fileSet->d_qlistFileName
+                                       << "]";
+            }
+            BALL_LOG_OUTPUT_STREAM << " as it can be gc'd.";
+        }
+
+        // Garbage-collect 'fileSet' from 'd_fileSets'.  Make a copy of the
+        // target fileSetSp before erasing it from 'd_fileSets'.
+
+        FileSets::iterator it = d_fileSets.begin();
+        while (it != d_fileSets.end() && it->get() != fileSet) {
+            ++it;
+        }
+        BSLS_ASSERT_SAFE(it != d_fileSets.end());
+
+        FileSetSp fileSetSp(*it);
+        d_fileSets.erase(it);
+
+        BSLA_MAYBE_UNUSED const int rc = d_miscWorkThreadPool_p->enqueueJob(
+            bdlf::BindUtil::bind(&FileStore::gcWorkerDispatched,
+                                 this,
+                                 fileSetSp));
+        BSLS_ASSERT_SAFE(rc == 0);
+    }
+    else {
+        BALL_LOG_INFO << partitionDesc() << "Rollover: number of references to"
+                      << " old file set: "
+                      << fileSet->d_aliasedBlobBufferCount;
+        BSLS_ASSERT_SAFE(fileSet->d_dataFile.isValid());
+        BSLS_ASSERT_SAFE(fileSet->d_journalFile.isValid());
+        if (d_qListAware) {
+            BSLS_ASSERT_SAFE(fileSet->d_qlistFile.isValid());
+        }
+    }
+}
+
 void FileStore::issueSyncPointCb()
 {
     // executed by the *SCHEDULER* thread
@@ -3934,6 +4846,261 @@ void FileStore::alarmHighwatermarkIfNeededDispatched()
     }
 }
 
+void FileStore::groupCommitCb()
+{
+    // executed by the *SCHEDULER* thread
+
+    // This routine is invoked *only* by the scheduled recurring event.
+
+    if (!d_isOpen) {
+        return;  // RETURN
+    }
+
+    execute(bdlf::BindUtil::bind(&FileStore::groupCommitDispatched, this));
+}
+
+void FileStore::groupCommitDispatched()
+{
+    // executed by the *DISPATCHER* thread
+
+    if (!d_isOpen || 0 == d_groupCommitPendingBytes) {
+        return;  // RETURN
+    }
+
+    syncGroupCommit();
+}
+
+void FileStore::syncGroupCommit()
+{
+    // executed by the *DISPATCHER* thread
+
+    if (!d_config.isGroupCommitEnabled() || !d_isPrimary ||
+        d_isGroupCommitSyncInProgress) {
+        // A sync in progress dispatches the next one upon completion, if
+        // needed.
+        return;  // RETURN
+    }
+
+    if (isRolloverInProgress()) {
+        // Records not copied yet are only in the old file set, which is not
+        // synced anymore, so no record can be acknowledged until the copy is
+        // complete.  'finishIncrementalRollover' dispatches the next sync.
+        return;  // RETURN
+    }
+
+    const FileSetSp& activeFileSetSp = d_fileSets[0];
+    BSLS_ASSERT_SAFE(activeFileSetSp);
+
+    // Sync in a worker thread, so that the partition keeps on processing
+    // events while waiting for the disk.  The records written meanwhile are
+    // covered by the next sync.
+
+    GroupCommitSync sync;
+    sync.d_fileSetSp    = activeFileSetSp;
+    sync.d_dataBegin    = d_groupCommitDataOffset;
+    sync.d_dataEnd      = activeFileSetSp->d_dataFilePosition;
+    sync.d_qlistBegin   = d_groupCommitQlistOffset;
+    sync.d_qlistEnd     = activeFileSetSp->d_qlistFilePosition;
+    sync.d_journalBegin = d_groupCommitJournalOffset;
+    sync.d_journalEnd   = activeFileSetSp->d_journalFilePosition;
+    sync.d_lastKey      = DataStoreRecordKey(d_sequenceNum, d_primaryLeaseId);
+    sync.d_generation   = d_groupCommitGeneration;
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_groupCommitSyncMutex);  // LOCK
+        d_groupCommitSyncFileSets.push_back(activeFileSetSp.get());
+    }  // UNLOCK
+
+    const int rc = d_miscWorkThreadPool_p->enqueueJob(
+        bdlf::BindUtil::bind(&FileStore::syncGroupCommitWorkerDispatched,
+                             this,
+                             sync));
+    if (0 != rc) {
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(
+                &d_groupCommitSyncMutex);  // LOCK
+            d_groupCommitSyncFileSets.pop_back();
+        }  // UNLOCK
+
+        // Keep the messages pending acknowledgement; the next sync will cover
+        // them.
+        BALL_LOG_WARN << partitionDesc() << "Failed to enqueue group commit "
+                      << "sync, rc: " << rc;
+        return;  // RETURN
+    }
+
+    d_isGroupCommitSyncInProgress = true;
+    d_groupCommitPendingBytes     = 0;
+}
+
+void FileStore::syncGroupCommitWorkerDispatched(const GroupCommitSync& sync)
+{
+    // executed by a *WORKER* thread
+
+    const FileSet& fileSet = *sync.d_fileSetSp;
+
+    // Sync DATA and QLIST files before the JOURNAL, so that no synced JOURNAL
+    // record refers to a message which is not on disk.
+
+    bmqu::MemOutStream errorDesc;
+    int                rc = syncFileRange(fileSet.d_dataFile,
+                                          sync.d_dataBegin,
+                                          sync.d_dataEnd,
+                                          errorDesc);
+    if (0 == rc && d_qListAware) {
+        rc = syncFileRange(fileSet.d_qlistFile,
+                           sync.d_qlistBegin,
+                           sync.d_qlistEnd,
+                           errorDesc);
+    }
+    if (0 == rc) {
+        rc = syncFileRange(fileSet.d_journalFile,
+                           sync.d_journalBegin,
+                           sync.d_journalEnd,
+                           errorDesc);
+    }
+
+    execute(bdlf::BindUtil::bind(&FileStore::syncGroupCommitDispatched,
+                                 this,
+                                 sync,
+                                 rc,
+                                 bsl::string(errorDesc.str())));
+
+    // Let 'close' truncate and unmap the files.  Note that this object must
+    // not be accessed once the mutex is released.
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_groupCommitSyncMutex);  // LOCK
+    bsl::vector<const FileSet*>::iterator it = bsl::find(
+        d_groupCommitSyncFileSets.begin(),
+        d_groupCommitSyncFileSets.end(),
+        &fileSet);
+    BSLS_ASSERT_SAFE(it != d_groupCommitSyncFileSets.end());
+    d_groupCommitSyncFileSets.erase(it);
+    d_groupCommitSyncCondition.broadcast();
+}
+
+void FileStore::syncGroupCommitDispatched(const GroupCommitSync& sync,
+                                          int                    rc,
+                                          const bsl::string& errorDescription)
+{
+    // executed by the *DISPATCHER* thread
+
+    d_isGroupCommitSyncInProgress = false;
+
+    if (!d_isOpen || !d_isPrimary) {
+        return;  // RETURN
+    }
+
+    if (sync.d_generation != d_groupCommitGeneration) {
+        // The file set has been rolled over since this sync started, so the
+        // records it covered may now be held, unsynced, by the new active
+        // file set.  The pending bytes account for the whole active file set,
+        // so sync it again before acknowledging anything.
+        syncGroupCommit();
+        return;  // RETURN
+    }
+
+    if (0 != rc) {
+        // Keep the messages pending acknowledgement; the next sync will cover
+        // them again.
+        BMQTSK_ALARMLOG_ALARM("FILE_IO")
+            << partitionDesc() << "Failed to sync file set ["
+            << sync.d_fileSetSp->d_journalFileName
+            << "] for group commit, rc: " << rc
+            << ", error: " << errorDescription << BMQTSK_ALARMLOG_END;
+
+        d_groupCommitPendingBytes += (sync.d_dataEnd - sync.d_dataBegin) +
+                                     (sync.d_qlistEnd - sync.d_qlistBegin) +
+                                     (sync.d_journalEnd - sync.d_journalBegin);
+        return;  // RETURN
+    }
+
+    d_groupCommitDataOffset    = sync.d_dataEnd;
+    d_groupCommitQlistOffset   = sync.d_qlistEnd;
+    d_groupCommitJournalOffset = sync.d_journalEnd;
+    if (d_groupCommitSyncedKey < sync.d_lastKey) {
+        d_groupCommitSyncedKey = sync.d_lastKey;
+    }
+
+    // Acknowledge the records which were only waiting for this sync.  The
+    // other records pending Receipt are acknowledged upon their last Receipt.
+
+    bsl::unordered_set<mqbi::Queue*> affectedQueues(d_allocator_p);
+    mqbu::StorageKey                 lastKey;
+    mqbi::Queue*                     lastQueue = 0;
+
+    bsl::vector<DataStoreRecordKey>::iterator kit =
+        d_groupCommitReceipted.begin();
+    bsl::vector<DataStoreRecordKey>::iterator keepIt = kit;
+    for (; kit != d_groupCommitReceipted.end(); ++kit) {
+        Unreceipted::iterator it = d_unreceipted.find(*kit);
+        if (it == d_unreceipted.end() ||
+            it->second.d_count < d_replicationFactor) {
+            // Already acknowledged, or waiting for Receipts again because the
+            // replication factor has been raised.
+            continue;  // CONTINUE
+        }
+        if (!isGroupCommitSynced(*kit)) {
+            // Written after this sync started.
+            *keepIt++ = *kit;
+            continue;  // CONTINUE
+        }
+
+        it->second.d_handle->second.d_hasReceipt = true;
+
+        // Calculate time it took for the message to be stored and synced.
+        const bsls::Types::Int64 timeDelta =
+            bmqsys::Time::highResolutionTimer() -
+            it->second.d_handle->second.d_arrivalTimepoint;
+        d_partitionStats_sp->setReplicationTime(timeDelta);
+
+        // notify the queue
+        const mqbu::StorageKey& queueKey  = it->second.d_queueKey;
+        bool                    haveQueue = (queueKey == lastKey);
+        if (!haveQueue) {
+            StorageMapIter sit = d_storages.find(queueKey);
+            if (sit != d_storages.end()) {
+                haveQueue = true;
+                lastKey   = queueKey;
+                lastQueue = sit->second->queue();
+                BSLS_ASSERT_SAFE(lastQueue);
+                affectedQueues.insert(lastQueue);
+            }
+            // else the queue and its storage are gone; ignore the receipt
+        }
+        if (haveQueue) {
+            lastQueue->onReceipt(it->second.d_guid, it->second.d_qH);
+        }  // else the queue is gone
+        d_unreceipted.erase(it);
+    }
+    d_groupCommitReceipted.erase(keepIt, d_groupCommitReceipted.end());
+
+    for (bsl::unordered_set<mqbi::Queue*>::iterator qit =
+             affectedQueues.begin();
+         qit != affectedQueues.end();
+         ++qit) {
+        (*qit)->onReplicatedBatch();
+    }
+
+    if (d_groupCommitPendingBytes >= d_config.groupCommitMaxBytes()) {
+        // Enough bytes have been written while syncing to sync again without
+        // waiting for the next scheduled sync.
+        syncGroupCommit();
+    }
+}
+
+void FileStore::waitForGroupCommitSync(const FileSet* fileSet)
+{
+    // executed by *ANY* thread
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_groupCommitSyncMutex);  // LOCK
+    while (fileSet ? bsl::find(d_groupCommitSyncFileSets.begin(),
+                               d_groupCommitSyncFileSets.end(),
+                               fileSet) != d_groupCommitSyncFileSets.end()
+                   : !d_groupCommitSyncFileSets.empty()) {
+        d_groupCommitSyncCondition.wait(&d_groupCommitSyncMutex);
+    }
+}
+
 void FileStore::issueSyncPointDispatched(BSLA_UNUSED int partitionId)
 {
     // executed by the *DISPATCHER* thread
@@ -4117,7 +5284,9 @@ void FileStore::processReceiptEvent(unsigned int         primaryLeaseId,
             // This is the last in the range
             isEndOfRange = true;
         }
-        if (++(from->second.d_count) >= d_replicationFactor) {
+        const bool isReceipted = ++(from->second.d_count) >=
+                                 d_replicationFactor;
+        if (isReceipted && isGroupCommitSynced(from->first)) {
             from->second.d_handle->second.d_hasReceipt = true;
 
             // Calculate time it took for the message to be stored and
@@ -4147,6 +5316,11 @@ void FileStore::processReceiptEvent(unsigned int         primaryLeaseId,
             from = d_unreceipted.erase(from);
         }
         else {
+            if (isReceipted &&
+                from->second.d_count == d_replicationFactor) {
+                // Acknowledged once a group commit sync has covered it.
+                d_groupCommitReceipted.push_back(from->first);
+            }
             ++from;
         }
     }
@@ -4715,6 +5889,7 @@ int FileStore::writeJournalRecord(const bmqp::StorageHeader& header,
             }
 
             d_syncPoints.push_back(spoPair);
+            precreateFileSetIfNeeded();
             if (SyncPointType::e_ROLLOVER == jOpRec->syncPointType()) {
                 BALL_LOG_INFO
                     << partitionDesc()
@@ -5095,10 +6270,10 @@ void FileStore::aliasMessage(bsl::shared_ptr<bdlbb::Blob>* appData,
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(0 < d_fileSets.size());
 
-    FileSet* activeFileSet = d_fileSets[0].get();
-    BSLS_ASSERT_SAFE(activeFileSet);
+    FileSet* fileSet = recordFileSet(record);
+    BSLS_ASSERT_SAFE(fileSet);
 
-    OffsetPtr<const DataHeader> dataHeader(activeFileSet->d_dataFile.block(),
+    OffsetPtr<const DataHeader> dataHeader(fileSet->d_dataFile.block(),
                                            record.d_messageOffset);
     const unsigned int          dataHdrSize = dataHeader->headerWords() *
                                      bmqp::Protocol::k_WORD_SIZE;
@@ -5110,12 +6285,12 @@ void FileStore::aliasMessage(bsl::shared_ptr<bdlbb::Blob>* appData,
     const bsls::Types::Uint64 appDataOffset = record.d_messageOffset +
                                               dataHdrSize + optionsSize;
     AliasedBufferDeleterSp deleter = d_aliasedBufferDeleterSpPool.getObject();
-    deleter->setFileSet(activeFileSet);
+    deleter->setFileSet(fileSet);
 
     if (0 != optionsSize) {
         bsl::shared_ptr<char> optionsBufferSp(
             deleter,
-            activeFileSet->d_dataFile.block().base() + optionsOffset);
+            fileSet->d_dataFile.block().base() + optionsOffset);
 
         bdlbb::BlobBuffer optionsBlobBuffer(optionsBufferSp, optionsSize);
 
@@ -5125,7 +6300,7 @@ void FileStore::aliasMessage(bsl::shared_ptr<bdlbb::Blob>* appData,
 
     bsl::shared_ptr<char> appDataBufferSp(
         deleter,
-        activeFileSet->d_dataFile.block().base() + appDataOffset);
+        fileSet->d_dataFile.block().base() + appDataOffset);
 
     bdlbb::BlobBuffer appDataBlobBuffer(appDataBufferSp,
                                         record.d_appDataUnpaddedLen);
@@ -5134,6 +6309,34 @@ void FileStore::aliasMessage(bsl::shared_ptr<bdlbb::Blob>* appData,
     (*appData)->appendDataBuffer(appDataBlobBuffer);
 }
 
+void FileStore::loadRolledOverLengths(bsls::Types::Uint64* journalLength,
+                                      bsls::Types::Uint64* dataLength,
+                                      bsls::Types::Uint64* qlistLength) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(journalLength);
+    BSLS_ASSERT_SAFE(dataLength);
+    BSLS_ASSERT_SAFE(qlistLength);
+
+    *journalLength = 0;
+    *dataLength    = 0;
+    *qlistLength   = 0;
+    for (RecordConstIterator recordCit = d_records.cbegin();
+         recordCit != d_records.cend();
+         ++recordCit) {
+        const DataStoreRecord& record = recordCit->second;
+
+        *journalLength += FileStoreProtocol::k_JOURNAL_RECORD_SIZE;
+        if (RecordType::e_MESSAGE == record.d_recordType) {
+            *dataLength += record.d_dataOrQlistRecordPaddedLen;
+        }
+        else if (d_qListAware &&
+                 RecordType::e_QUEUE_OP == record.d_recordType) {
+            *qlistLength += record.d_dataOrQlistRecordPaddedLen;
+        }
+    }
+}
+
 void FileStore::flushIfNeeded(bool immediateFlush)
 {
     if (immediateFlush ||
@@ -5180,10 +6383,26 @@ FileStore::FileStore(
 , d_nodes(allocator)
 , d_lastRecoveredStrongConsistency()
 , d_fileSets(allocator)
+, d_spareFileSetSp()
+, d_isSpareFileSetPending(false)
+, d_rolloverContext()
+, d_fileSetGeneration(0)
 , d_cluster_p(cluster)
 , d_miscWorkThreadPool_p(miscWorkThreadPool)
 , d_syncPointEventHandle()
 , d_partitionHighwatermarkEventHandle()
+, d_groupCommitEventHandle()
+, d_groupCommitPendingBytes(0)
+, d_groupCommitDataOffset(0)
+, d_groupCommitJournalOffset(0)
+, d_groupCommitQlistOffset(0)
+, d_isGroupCommitSyncInProgress(false)
+, d_groupCommitGeneration(0)
+, d_groupCommitSyncedKey()
+, d_groupCommitReceipted(allocator)
+, d_groupCommitSyncMutex()
+, d_groupCommitSyncCondition()
+, d_groupCommitSyncFileSets(allocator)
 , d_isPrimary(false)
 , d_primaryNode_p(0)
 , d_primaryLeaseId(0)
@@ -5308,6 +6527,13 @@ void FileStore::close(bool flush)
         return;  // RETURN
     }
 
+    // Complete the files of the active file set before closing them.
+    completeRollover();
+
+    // The files of the active file set cannot be truncated and unmapped while
+    // a worker thread syncs them.
+    waitForGroupCommitSync();
+
     d_isOpen             = false;
     d_isStopping         = false;
     d_flushWhenClosing   = flush;
@@ -5315,12 +6541,24 @@ void FileStore::close(bool flush)
 
     BALL_LOG_INFO << partitionDesc() << "Closing partition. ";
 
+    if (d_spareFileSetSp) {
+        discardSpareFileSet(d_spareFileSetSp);
+        d_spareFileSetSp.reset();
+    }
+
+    // A spare file set still being created is discarded upon completion,
+    // unless the partition has been reopened and has no spare file set yet.
+    d_isSpareFileSetPending = false;
+
     // Clear 'd_records' so that gc logic is invoked on all mapped data files.
     // Note that logic will be invoked in this thread.  Note that data file of
     // active file set will not be gc'd because its alias blob buffer count
     // will not go to 0 as its initialized with 1.
     d_unreceipted.clear();
+    d_groupCommitReceipted.clear();
     d_records.clear();
+    d_fileSetGeneration = 0;
+    ++d_groupCommitGeneration;
 
     // After mapped data files have been gc'd, there should be only 1 file set
     // remaining in 'd_fileSets' (the active one).  Truncate and close it out.
@@ -5494,6 +6732,15 @@ int FileStore::writeMessageRecord(mqbi::StorageMessageAttributes* attributes,
         attributes->setReceipt(true);
     }
 
+    // In group commit mode, the message is acknowledged only once synced to
+    // disk, regardless of its consistency.  Receipts from replicas are still
+    // requested only if 'attributes' says so.
+    const bool isReceiptRequired = !attributes->hasReceipt();
+    const bool isGroupCommitted  = d_config.isGroupCommitEnabled();
+    if (isGroupCommitted) {
+        attributes->setReceipt(false);
+    }
+
     // Update 'activeFileSet' as it may have rolled over above.
     activeFileSet = d_fileSets[0].get();
 
@@ -5583,14 +6830,21 @@ int FileStore::writeMessageRecord(mqbi::StorageMessageAttributes* attributes,
     int flags = 0;
     // If this requires Receipt
     if (!attributes->hasReceipt()) {
-        d_unreceipted.insert(
-            bsl::make_pair(key,
-                           ReceiptContext(queueKey,
-                                          guid,
-                                          recordIt,
-                                          1,  // receipt count
-                                          attributes->queueHandle())));
-        flags = bmqp::StorageHeaderFlags::e_RECEIPT_REQUESTED;
+        const int count = isReceiptRequired ? 1 : d_replicationFactor;
+        d_unreceipted.insert(bsl::make_pair(
+            key,
+            ReceiptContext(queueKey,
+                           guid,
+                           recordIt,
+                           count,
+                           attributes->queueHandle())));
+        if (isGroupCommitted && count >= d_replicationFactor) {
+            // Acknowledged once a group commit sync has covered it.
+            d_groupCommitReceipted.push_back(key);
+        }
+        if (isReceiptRequired) {
+            flags = bmqp::StorageHeaderFlags::e_RECEIPT_REQUESTED;
+        }
     }
     else {
         if (d_replicationNotifications.find(queueKey) ==
@@ -5611,6 +6865,21 @@ int FileStore::writeMessageRecord(mqbi::StorageMessageAttributes* attributes,
         FileStoreProtocol::k_JOURNAL_RECORD_SIZE;
     activeFileSet->d_outstandingBytesData += totalLength;
 
+    if (isGroupCommitted) {
+        // Sync once enough bytes are pending, without waiting for the next
+        // scheduled sync.  Note that the sync is dispatched, so that queues
+        // are not notified of receipts while posting this message.
+        const bsls::Types::Uint64 maxBytes = d_config.groupCommitMaxBytes();
+        const bool wasBelowMax = d_groupCommitPendingBytes < maxBytes;
+
+        d_groupCommitPendingBytes += totalLength +
+                                     FileStoreProtocol::k_JOURNAL_RECORD_SIZE;
+        if (wasBelowMax && d_groupCommitPendingBytes >= maxBytes) {
+            execute(bdlf::BindUtil::bind(&FileStore::groupCommitDispatched,
+                                         this));
+        }
+    }
+
     return rc_SUCCESS;
 }
 
@@ -6137,6 +7406,17 @@ void FileStore::removeRecordRaw(const DataStoreRecordHandle& handle)
     FileSet*               activeFileSet = d_fileSets[0].get();
     const DataStoreRecord& record        = recordIt->second;
 
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(record.d_fileSetGeneration !=
+                                              d_fileSetGeneration)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        // The record has not been copied yet by the rollover in progress.
+        // Copy it now, out of order, so that the space reserved for it in the
+        // active file set is filled.
+
+        copyRolledOverRecord(recordIt);
+    }
+
     activeFileSet->d_outstandingBytesJournal -=
         FileStoreProtocol::k_JOURNAL_RECORD_SIZE;
 
@@ -6715,6 +7995,25 @@ void FileStore::setActivePrimary(mqbnet::ClusterNode* primaryNode,
         bsls::TimeInterval(k_PARTITION_AVAILABLESPACE_SECS),
         bdlf::BindUtil::bind(&FileStore::alarmHighwatermarkIfNeededCb, this));
 
+    if (d_config.isGroupCommitEnabled()) {
+        // Records written while being a replica have not been synced.
+        d_groupCommitDataOffset    = 0;
+        d_groupCommitQlistOffset   = 0;
+        d_groupCommitJournalOffset = 0;
+        d_groupCommitPendingBytes  = 0;
+        d_groupCommitSyncedKey     = DataStoreRecordKey();
+        ++d_groupCommitGeneration;
+
+        // Schedule a group commit sync recurring event, bounding the time a
+        // message waits to be synced to disk when the byte threshold is not
+        // reached.
+        d_config.scheduler()->scheduleRecurringEvent(
+            &d_groupCommitEventHandle,
+            bsls::TimeInterval(0, 0).addMilliseconds(
+                d_config.groupCommitIntervalMs()),
+            bdlf::BindUtil::bind(&FileStore::groupCommitCb, this));
+    }
+
     // New primary needs to issue a sync point with old leaseId, if previous
     // primary disappeared w/o issuing a sync point (crash, etc).  It is
     // necessary that JOURNAL record at the primary-switch boundary is always a
@@ -7132,6 +8431,7 @@ void FileStore::cancelTimersAndWait()
     d_config.scheduler()->cancelEventAndWait(&d_syncPointEventHandle);
     d_config.scheduler()->cancelEventAndWait(
         &d_partitionHighwatermarkEventHandle);
+    d_config.scheduler()->cancelEventAndWait(&d_groupCommitEventHandle);
 }
 
 void FileStore::processShutdownEvent()
@@ -7251,7 +8551,14 @@ void FileStore::setReplicationFactor(int value)
     mqbu::StorageKey      lastKey;
     mqbi::Queue*          lastQueue = 0;
     while (it != d_unreceipted.end()) {
-        if (it->second.d_count >= d_replicationFactor) {
+        if (it->second.d_count >= d_replicationFactor &&
+            !isGroupCommitSynced(it->first)) {
+            // Acknowledged once a group commit sync has covered it.  Note
+            // that the key may already be listed.
+            d_groupCommitReceipted.push_back(it->first);
+            ++it;
+        }
+        else if (it->second.d_count >= d_replicationFactor) {
             it->second.d_handle->second.d_hasReceipt = true;
 
             // Calculate time it took for the message to be stored and
@@ -7346,18 +8653,18 @@ void FileStore::loadMessageRecordRaw(MessageRecord*               buffer,
                                      const DataStoreRecordHandle& handle) const
 {
     BSLS_ASSERT_SAFE(handle.isValid());
-    FileSet* activeFileSet = d_fileSets[0].get();
-    BSLS_ASSERT_SAFE(activeFileSet);
-
     const RecordIterator& recordIt = *reinterpret_cast<const RecordIterator*>(
         &handle);
     const DataStoreRecord& record = recordIt->second;
+
+    FileSet* fileSet = recordFileSet(record);
+    BSLS_ASSERT_SAFE(fileSet);
     BSLS_ASSERT_SAFE(RecordType::e_MESSAGE == record.d_recordType);
     BSLS_ASSERT_SAFE(0 != record.d_recordOffset);
     BSLS_ASSERT_SAFE(0 != record.d_messageOffset);
     BSLS_ASSERT_SAFE(0 != record.d_appDataUnpaddedLen);
 
-    OffsetPtr<const MessageRecord> rec(activeFileSet->d_journalFile.block(),
+    OffsetPtr<const MessageRecord> rec(fileSet->d_journalFile.block(),
                                        record.d_recordOffset);
     *buffer = *rec;
 }
@@ -7366,15 +8673,15 @@ void FileStore::loadConfirmRecordRaw(ConfirmRecord*               buffer,
                                      const DataStoreRecordHandle& handle) const
 {
     BSLS_ASSERT_SAFE(handle.isValid());
-    FileSet* activeFileSet = d_fileSets[0].get();
-    BSLS_ASSERT_SAFE(activeFileSet);
-
     const RecordIterator& recordIt = *reinterpret_cast<const RecordIterator*>(
         &handle);
     const DataStoreRecord& record = recordIt->second;
+
+    FileSet* fileSet = recordFileSet(record);
+    BSLS_ASSERT_SAFE(fileSet);
     BSLS_ASSERT_SAFE(RecordType::e_CONFIRM == record.d_recordType);
     BSLS_ASSERT_SAFE(0 != record.d_recordOffset);
-    OffsetPtr<const ConfirmRecord> rec(activeFileSet->d_journalFile.block(),
+    OffsetPtr<const ConfirmRecord> rec(fileSet->d_journalFile.block(),
                                        record.d_recordOffset);
     *buffer = *rec;
 }
@@ -7384,15 +8691,15 @@ void FileStore::loadDeletionRecordRaw(
     const DataStoreRecordHandle& handle) const
 {
     BSLS_ASSERT_SAFE(handle.isValid());
-    FileSet* activeFileSet = d_fileSets[0].get();
-    BSLS_ASSERT_SAFE(activeFileSet);
-
     const RecordIterator& recordIt = *reinterpret_cast<const RecordIterator*>(
         &handle);
     const DataStoreRecord& record = recordIt->second;
+
+    FileSet* fileSet = recordFileSet(record);
+    BSLS_ASSERT_SAFE(fileSet);
     BSLS_ASSERT_SAFE(RecordType::e_DELETION == record.d_recordType);
     BSLS_ASSERT_SAFE(0 != record.d_recordOffset);
-    OffsetPtr<const DeletionRecord> rec(activeFileSet->d_journalFile.block(),
+    OffsetPtr<const DeletionRecord> rec(fileSet->d_journalFile.block(),
                                         record.d_recordOffset);
     *buffer = *rec;
 }
@@ -7401,15 +8708,15 @@ void FileStore::loadQueueOpRecordRaw(QueueOpRecord*               buffer,
                                      const DataStoreRecordHandle& handle) const
 {
     BSLS_ASSERT_SAFE(handle.isValid());
-    FileSet* activeFileSet = d_fileSets[0].get();
-    BSLS_ASSERT_SAFE(activeFileSet);
-
     const RecordIterator& recordIt = *reinterpret_cast<const RecordIterator*>(
         &handle);
     const DataStoreRecord& record = recordIt->second;
+
+    FileSet* fileSet = recordFileSet(record);
+    BSLS_ASSERT_SAFE(fileSet);
     BSLS_ASSERT_SAFE(RecordType::e_QUEUE_OP == record.d_recordType);
     BSLS_ASSERT_SAFE(0 != record.d_recordOffset);
-    OffsetPtr<const QueueOpRecord> rec(activeFileSet->d_journalFile.block(),
+    OffsetPtr<const QueueOpRecord> rec(fileSet->d_journalFile.block(),
                                        record.d_recordOffset);
     *buffer = *rec;
 }
@@ -7428,8 +8735,9 @@ void FileStore::loadMessageAttributesRaw(
     BSLS_ASSERT_SAFE(0 != record.d_messageOffset);
     BSLS_ASSERT_SAFE(0 != record.d_appDataUnpaddedLen);
 
-    OffsetPtr<const MessageRecord> rec(d_fileSets[0]->d_journalFile.block(),
-                                       record.d_recordOffset);
+    OffsetPtr<const MessageRecord> rec(
+        recordFileSet(record)->d_journalFile.block(),
+        record.d_recordOffset);
 
     *buffer = mqbi::StorageMessageAttributes(rec->header().timestamp(),
                                              rec->refCount(),
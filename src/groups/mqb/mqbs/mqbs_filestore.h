@@ -76,9 +76,12 @@
 #include <bslma_allocator.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
+#include <bslmt_condition.h>
+#include <bslmt_mutex.h>
 #include <bsls_assert.h>
 #include <bsls_atomic.h>
 #include <bsls_cpp11.h>
+#include <bsls_performancehint.h>
 #include <bsls_types.h>
 
 namespace BloombergLP {
@@ -255,6 +258,66 @@ class FileStore BSLS_KEYWORD_FINAL : public DataStore {
     /// Map of NodeId -> NodeContext to assist in Receipt processing
     typedef bsl::unordered_map<int, NodeContext> NodeReceiptContexts;
 
+    /// State of an incremental rollover in progress.  The outstanding
+    /// records of the previous active file set are copied in batches into
+    /// regions reserved at the beginning of the files of the new active file
+    /// set.
+    struct RolloverContext {
+        /// File set being rolled over.  Empty unless an incremental rollover
+        /// is in progress.
+        FileSetSp d_sourceFileSetSp;
+
+        /// Next record to copy, in the order of `d_records`.
+        RecordIterator d_nextRecord;
+
+        /// Positions in the JOURNAL, DATA and QLIST files of the new active
+        /// file set at which the next record is copied.
+        bsls::Types::Uint64 d_journalPosition;
+        bsls::Types::Uint64 d_dataPosition;
+        bsls::Types::Uint64 d_qlistPosition;
+
+        /// Ends of the regions reserved in the JOURNAL, DATA and QLIST files
+        /// of the new active file set.
+        bsls::Types::Uint64 d_journalEndPosition;
+        bsls::Types::Uint64 d_dataEndPosition;
+        bsls::Types::Uint64 d_qlistEndPosition;
+
+        /// Offset of the first sync point in the JOURNAL of the new active
+        /// file set, recorded in its header once all records are copied.
+        bsls::Types::Uint64 d_syncPointOffset;
+
+        /// Number of records copied so far.
+        bsls::Types::Uint64 d_numRecords;
+
+        /// High resolution timer value when the rollover started.
+        bsls::Types::Int64 d_startTime;
+
+        RolloverContext();
+    };
+
+    /// Ranges of the files of a file set synced to disk by a worker thread
+    /// in group commit mode.
+    struct GroupCommitSync {
+        /// File set to sync.
+        FileSetSp d_fileSetSp;
+
+        /// Ranges [begin, end) of the DATA, QLIST and JOURNAL files to sync.
+        bsls::Types::Uint64 d_dataBegin;
+        bsls::Types::Uint64 d_dataEnd;
+        bsls::Types::Uint64 d_qlistBegin;
+        bsls::Types::Uint64 d_qlistEnd;
+        bsls::Types::Uint64 d_journalBegin;
+        bsls::Types::Uint64 d_journalEnd;
+
+        /// Key of the last record written when the sync started.
+        DataStoreRecordKey d_lastKey;
+
+        /// Value of `d_groupCommitGeneration` when the sync started.
+        bsls::Types::Uint64 d_generation;
+
+        GroupCommitSync();
+    };
+
   private:
     // DATA
     bslma::Allocator* d_allocator_p;
@@ -348,6 +411,28 @@ class FileStore BSLS_KEYWORD_FINAL : public DataStore {
     // rollover file set, which is then
     // inserted to the front of the list.
 
+    FileSetSp d_spareFileSetSp;
+    // File set created and prefaulted
+    // ahead of the next rollover, if
+    // any.  Becomes the new active file
+    // set upon rollover.
+
+    bool d_isSpareFileSetPending;
+    // Whether a spare file set is being
+    // created in a worker thread.
+
+    RolloverContext d_rolloverContext;
+    // State of the incremental rollover
+    // in progress, if any.
+
+    unsigned char d_fileSetGeneration;
+    // Generation of the active file set,
+    // incremented upon each rollover.
+    // Records which have not been copied
+    // yet by an incremental rollover in
+    // progress carry the previous
+    // generation.
+
     mqbnet::Cluster* d_cluster_p;
 
     bdlmt::FixedThreadPool* d_miscWorkThreadPool_p;
@@ -359,6 +444,71 @@ class FileStore BSLS_KEYWORD_FINAL : public DataStore {
 
     RecurringEventHandle d_partitionHighwatermarkEventHandle;
 
+    RecurringEventHandle d_groupCommitEventHandle;
+    // Handle to the recurring event
+    // syncing the active file set in
+    // group commit mode.
+
+    bsls::Types::Uint64 d_groupCommitPendingBytes;
+    // Number of bytes appended to the
+    // active file set since the last
+    // group commit sync.
+
+    bsls::Types::Uint64 d_groupCommitDataOffset;
+    // Offset in the DATA file of the
+    // active file set up to which it has
+    // been synced in group commit mode.
+
+    bsls::Types::Uint64 d_groupCommitJournalOffset;
+    // Offset in the JOURNAL file of the
+    // active file set up to which it has
+    // been synced in group commit mode.
+
+    bsls::Types::Uint64 d_groupCommitQlistOffset;
+    // Offset in the QLIST file of the
+    // active file set up to which it has
+    // been synced in group commit mode.
+
+    bool d_isGroupCommitSyncInProgress;
+    // Whether a group commit sync is
+    // being performed by a worker thread.
+
+    bsls::Types::Uint64 d_groupCommitGeneration;
+    // Incremented whenever the group
+    // commit offsets are reset, so that a
+    // sync started before, possibly of an
+    // older file set, does not move them
+    // nor acknowledge any message.
+
+    DataStoreRecordKey d_groupCommitSyncedKey;
+    // Key of the last record known to be
+    // synced to disk in group commit mode.
+
+    bsl::vector<DataStoreRecordKey> d_groupCommitReceipted;
+    // Keys of the records pending Receipt
+    // which have all their Receipts, but
+    // are waiting for a group commit sync
+    // to be acknowledged.
+
+    bslmt::Mutex d_groupCommitSyncMutex;
+    // Mutex protecting
+    // 'd_groupCommitSyncFileSets'.
+
+    bslmt::Condition d_groupCommitSyncCondition;
+    // Condition signaled when a worker
+    // thread is done with a group commit
+    // sync.
+
+    bsl::vector<const FileSet*> d_groupCommitSyncFileSets;
+    // File sets of the group commit syncs
+    // for which a worker thread may still
+    // access the file set being synced or
+    // this object.  Unlike
+    // 'd_isGroupCommitSyncInProgress', an
+    // entry is removed by the worker
+    // thread, after the result is
+    // dispatched.
+
     bool d_isPrimary;
 
     mqbnet::ClusterNode* d_primaryNode_p;
@@ -470,6 +620,41 @@ class FileStore BSLS_KEYWORD_FINAL : public DataStore {
     /// *worker* thread pool.
     void gcWorkerDispatched(const bsl::shared_ptr<FileSet>& fileSet);
 
+    /// If file set pre-creation is enabled and any file of the active file
+    /// set is filled beyond a threshold, initiate the creation of a spare
+    /// file set in a worker thread, which becomes the new active file set
+    /// at the next rollover, unless one already exists or is being created.
+    ///
+    /// THREAD: This method should only be invoked by the partition
+    /// *dispatcher* thread.
+    void precreateFileSetIfNeeded();
+
+    /// Create a spare file set and prefault its first specified
+    /// `dataPrefaultBytes`, `journalPrefaultBytes` and `qlistPrefaultBytes`
+    /// of the DATA, JOURNAL and QLIST files respectively, and hand it over
+    /// to the dispatcher thread.
+    ///
+    /// THREAD: This method is invoked in a thread from the miscellaneous
+    /// *worker* thread pool.
+    void precreateFileSetWorkerDispatched(
+        bsls::Types::Uint64 dataPrefaultBytes,
+        bsls::Types::Uint64 journalPrefaultBytes,
+        bsls::Types::Uint64 qlistPrefaultBytes);
+
+    /// Keep the specified `fileSet`, which was created in the specified
+    /// `prepareTime` nanoseconds, as the spare file set, or discard it if
+    /// it is null or if this instance has been closed in the meantime.
+    ///
+    /// THREAD: This method should only be invoked by the partition
+    /// *dispatcher* thread.
+    void precreateFileSetDispatched(const FileSetSp&   fileSet,
+                                    bsls::Types::Int64 prepareTime);
+
+    /// Close the specified spare `fileSet` and remove its files.
+    ///
+    /// THREAD: This method can be invoked by any thread.
+    void discardSpareFileSet(const FileSetSp& fileSet);
+
     /// Open this instance in non-recovery mode.  Return zero on success and
     /// a non-zero value otherwise.  Note that this routine can be used in
     /// recovery mode when there are no files to recover messages from.
@@ -485,6 +670,34 @@ class FileStore BSLS_KEYWORD_FINAL : public DataStore {
     int openInRecoveryMode(bsl::ostream&          errorDescription,
                            const QueueKeyInfoMap& queueKeyInfoMap);
 
+    /// If the newest file set found at the location indicated by the
+    /// configuration of this instance is the target of an incremental
+    /// rollover which did not complete before the broker stopped, copy into
+    /// it the outstanding records of the file set it was rolled over from,
+    /// using the specified `queueKeyInfoMap` to recover them, mark the
+    /// rollover as finished and archive the old file set, so that the
+    /// records written after the rollover are recovered along with them.
+    /// Return zero on success or if there is no such rollover, and a
+    /// non-zero value otherwise, along with populating the specified
+    /// `errorDescription` with a brief reason for logging purposes.
+    int recoverUnfinishedRollover(bsl::ostream&          errorDescription,
+                                  const QueueKeyInfoMap& queueKeyInfoMap);
+
+    /// Copy the outstanding records of the active file set, opened from the
+    /// specified `oldFileSet` and recovered from it using the specified
+    /// `queueKeyInfoMap`, into the space reserved for them in the files of
+    /// the specified `newFileSet` by the incremental rollover which did not
+    /// complete, and mark the rollover as finished in its
+    /// JournalFileHeader.  Return zero on success, and a non-zero value
+    /// otherwise, along with populating the specified `errorDescription`
+    /// with a brief reason for logging purposes.  Note that `newFileSet` is
+    /// left untouched unless the recovered records fill exactly the
+    /// reserved space.
+    int completeUnfinishedRollover(bsl::ostream&          errorDescription,
+                                   const QueueKeyInfoMap& queueKeyInfoMap,
+                                   const FileStoreSet&    oldFileSet,
+                                   const FileStoreSet&    newFileSet);
+
     /// Make two passes over the journal file iterator `jit` in reverse
     /// iteration.
     ///
@@ -546,11 +759,51 @@ class FileStore BSLS_KEYWORD_FINAL : public DataStore {
     /// Rollover over the specified `record` from `oldFileSet` to the
     /// `newFileSet`, and if it is a message record, update the counter of
     /// the corresponding queue by one in the specified
-    /// `queueKeyCounterMap`.
-    void writeRolledOverRecord(DataStoreRecord*    record,
-                               QueueKeyCounterMap* queueKeyCounterMap,
-                               FileSet*            oldFileSet,
-                               FileSet*            newFileSet);
+    /// `queueKeyCounterMap`, unless it is null.  Write the record at the
+    /// specified `journalPosition`, `dataPosition` and `qlistPosition` in
+    /// the respective files of `newFileSet`, and advance them past it.
+    void writeRolledOverRecord(DataStoreRecord*     record,
+                               QueueKeyCounterMap*  queueKeyCounterMap,
+                               FileSet*             oldFileSet,
+                               FileSet*             newFileSet,
+                               bsls::Types::Uint64* journalPosition,
+                               bsls::Types::Uint64* dataPosition,
+                               bsls::Types::Uint64* qlistPosition);
+
+    /// Reserve, at the current positions of the files of the specified
+    /// `newFileSet`, the space needed to hold all outstanding records, to be
+    /// copied there from the specified `oldFileSetSp` in batches of
+    /// `d_config.rolloverBatchSize()` records, interleaved with the other
+    /// work of the dispatcher thread.
+    void startIncrementalRollover(const FileSetSp& oldFileSetSp,
+                                  FileSet*         newFileSet);
+
+    /// Copy the next batch of outstanding records of the incremental
+    /// rollover in progress, if it is the one which rolled over the file set
+    /// to the specified `fileSetGeneration`, and schedule the next batch
+    /// until all records have been copied.
+    ///
+    /// THREAD: Executed by the dispatcher thread.
+    void rolloverBatchDispatched(unsigned char fileSetGeneration);
+
+    /// Copy up to the specified `maxNumRecords` outstanding records of the
+    /// incremental rollover in progress, and finish it if there are no more
+    /// records to copy.  The behavior is undefined unless an incremental
+    /// rollover is in progress.
+    void copyRolledOverRecords(bsls::Types::Uint64 maxNumRecords);
+
+    /// Copy the record at the specified `recordIt`, which has not been
+    /// copied yet by the incremental rollover in progress.
+    void copyRolledOverRecord(const RecordIterator& recordIt);
+
+    /// Finish the incremental rollover in progress, once all outstanding
+    /// records have been copied.
+    void finishIncrementalRollover();
+
+    /// Release the reference of this file store to the specified
+    /// `fileSet`, which is not the active file set anymore, and
+    /// garbage-collect it if no message is aliasing its DATA file.
+    void releaseFileSet(FileSet* fileSet);
 
     /// Issue a sync point.
     ///
@@ -570,6 +823,58 @@ class FileStore BSLS_KEYWORD_FINAL : public DataStore {
     /// THREAD: This method is called from the partition thread.
     void alarmHighwatermarkIfNeededDispatched();
 
+    /// Callback invoked to dispatch a group commit sync of the active file
+    /// set.
+    ///
+    /// THREAD: This method is called from the scheduler thread.
+    void groupCommitCb();
+
+    /// Sync the active file set, if any record has been written to it since
+    /// the last sync.
+    ///
+    /// THREAD: This method is called from the partition thread.
+    void groupCommitDispatched();
+
+    /// Start syncing to disk, in a worker thread, the DATA, JOURNAL and
+    /// QLIST files of the active file set up to their current positions.
+    /// The messages written so far which are no longer waiting for Receipts
+    /// from replicas are acknowledged once the sync completes.  This method
+    /// has no effect unless group commit is enabled and this node is the
+    /// primary for this partition, or if a sync or a rollover is already in
+    /// progress.
+    ///
+    /// THREAD: This method is called from the partition thread.
+    void syncGroupCommit();
+
+    /// Sync to disk the ranges of the files described by the specified
+    /// `sync`, and dispatch the result to `syncGroupCommitDispatched`.
+    ///
+    /// THREAD: This method is called from a worker thread.
+    void syncGroupCommitWorkerDispatched(const GroupCommitSync& sync);
+
+    /// Complete the specified `sync`, which completed with the specified
+    /// `rc` and, if it failed, the specified `errorDescription`: on success,
+    /// acknowledge the messages synced which are no longer waiting for
+    /// Receipts from replicas.  Nothing is acknowledged, and the active file
+    /// set is synced again, if the file set has been rolled over since
+    /// `sync` started.
+    ///
+    /// THREAD: This method is called from the partition thread.
+    void syncGroupCommitDispatched(const GroupCommitSync& sync,
+                                   int                    rc,
+                                   const bsl::string&     errorDescription);
+
+    /// Block until the worker threads are done with the group commit syncs
+    /// in progress of the optionally specified `fileSet`, or of any file set
+    /// if `fileSet` is 0, so that the files they sync can be truncated and
+    /// unmapped.  Note that the result of a sync may still be pending in the
+    /// dispatcher queue, and is ignored if this object has been closed
+    /// meanwhile.
+    ///
+    /// THREAD: This method is called from the partition thread or from a
+    ///         worker thread.
+    void waitForGroupCommitSync(const FileSet* fileSet = 0);
+
     /// Issue a sync point.
     ///
     /// THREAD: This method executes in the partition dispatcher thread.
@@ -689,6 +994,24 @@ class FileStore BSLS_KEYWORD_FINAL : public DataStore {
                       bsl::shared_ptr<bdlbb::Blob>* options,
                       const DataStoreRecord&        record) const;
 
+    /// Return the file set holding the specified `record`, which is the
+    /// file set being rolled over if `record` has not been copied yet by an
+    /// incremental rollover in progress, and the active file set otherwise.
+    FileSet* recordFileSet(const DataStoreRecord& record) const;
+
+    /// Load into the specified `journalLength`, `dataLength` and
+    /// `qlistLength` the space taken by the outstanding records once rolled
+    /// over into the respective files of a new file set.
+    void loadRolledOverLengths(bsls::Types::Uint64* journalLength,
+                               bsls::Types::Uint64* dataLength,
+                               bsls::Types::Uint64* qlistLength) const;
+
+    /// Return true if the record having the specified `key` does not need
+    /// to be synced to disk anymore before being acknowledged, that is if
+    /// group commit is disabled or a completed group commit sync has
+    /// covered the record, and false otherwise.
+    bool isGroupCommitSynced(const DataStoreRecordKey& key) const;
+
     /// Attempt to garbage-collect messages for which TTL has expired.
     /// Note that this routine is no-op unless at the primary node.
     void gcExpiredMessages();
@@ -922,6 +1245,12 @@ class FileStore BSLS_KEYWORD_FINAL : public DataStore {
     /// points.
     int rollover();
 
+    /// Copy, at once, all outstanding records not copied yet by the
+    /// incremental rollover in progress, if any, so that the files of the
+    /// active file set are complete.  This must be invoked before reading
+    /// the active files directly, e.g. to synchronize a peer.
+    void completeRollover();
+
     void registerStorage(ReplicatedStorage* storage);
 
     void unregisterStorage(const ReplicatedStorage* storage);
@@ -1003,6 +1332,10 @@ class FileStore BSLS_KEYWORD_FINAL : public DataStore {
     // ACCESSORS
     int processorId() const;
 
+    /// Return true if an incremental rollover is in progress, false
+    /// otherwise.
+    bool isRolloverInProgress() const;
+
     //   (virtual: mqbi::DispatcherClient)
 
     /// Return a pointer to the dispatcher this client is associated with.
@@ -1148,6 +1481,44 @@ inline FileStore::NodeContext::NodeContext(BlobSpPool* blobSpPool_p,
     // NOTHING
 }
 
+// --------------------------------
+// class FileStore::RolloverContext
+// --------------------------------
+
+inline FileStore::RolloverContext::RolloverContext()
+: d_sourceFileSetSp()
+, d_nextRecord()
+, d_journalPosition(0)
+, d_dataPosition(0)
+, d_qlistPosition(0)
+, d_journalEndPosition(0)
+, d_dataEndPosition(0)
+, d_qlistEndPosition(0)
+, d_syncPointOffset(0)
+, d_numRecords(0)
+, d_startTime(0)
+{
+    // NOTHING
+}
+
+// --------------------------------
+// class FileStore::GroupCommitSync
+// --------------------------------
+
+inline FileStore::GroupCommitSync::GroupCommitSync()
+: d_fileSetSp()
+, d_dataBegin(0)
+, d_dataEnd(0)
+, d_qlistBegin(0)
+, d_qlistEnd(0)
+, d_journalBegin(0)
+, d_journalEnd(0)
+, d_lastKey()
+, d_generation(0)
+{
+    // NOTHING
+}
+
 // ---------------
 // class FileStore
 // ---------------
@@ -1163,7 +1534,8 @@ inline void FileStore::insertDataStoreRecord(RecordIterator* recordIt,
     InsertRc insertRc = d_records.insert(bsl::make_pair(key, record));
     BSLS_ASSERT_SAFE(insertRc.second);
 
-    *recordIt = insertRc.first;
+    insertRc.first->second.d_fileSetGeneration = d_fileSetGeneration;
+    *recordIt                                  = insertRc.first;
 }
 
 inline void FileStore::insertDataStoreRecord(DataStoreRecordHandle*    handle,
@@ -1202,6 +1574,25 @@ inline bool FileStore::needRollover(const MappedFileDescriptor& file,
     return file.fileSize() < (position + length);
 }
 
+inline FileSet*
+FileStore::recordFileSet(const DataStoreRecord& record) const
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(record.d_fileSetGeneration !=
+                                              d_fileSetGeneration)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BSLS_ASSERT_SAFE(d_rolloverContext.d_sourceFileSetSp);
+        return d_rolloverContext.d_sourceFileSetSp.get();  // RETURN
+    }
+
+    return d_fileSets[0].get();
+}
+
+inline bool
+FileStore::isGroupCommitSynced(const DataStoreRecordKey& key) const
+{
+    return !d_config.isGroupCommitEnabled() || !(d_groupCommitSyncedKey < key);
+}
+
 inline void
 FileStore::dispatchEvent(mqbi::Dispatcher::DispatcherEventRvRef event)
 {
@@ -1281,6 +1672,11 @@ inline int FileStore::processorId() const
     return d_dispatcherClientData.processorHandle();
 }
 
+inline bool FileStore::isRolloverInProgress() const
+{
+    return 0 != d_rolloverContext.d_sourceFileSetSp.get();
+}
+
 inline const FileStore::SyncPointOffsetPairs& FileStore::syncPoints() const
 {
     return d_syncPoints;
@@ -26,6 +26,7 @@
 #include <mqbs_filestoreprotocol.h>
 #include <mqbs_filestoreset.h>
 #include <mqbs_filestoretestutil.h>
+#include <mqbs_filestoreutil.h>
 #include <mqbstat_clusterstats.h>
 #include <mqbu_messageguidutil.h>
 #include <mqbu_storagekey.h>
@@ -53,8 +54,11 @@
 #include <bdlmt_fixedthreadpool.h>
 #include <bdlpcre_regex.h>
 #include <bdls_filesystemutil.h>
+#include <bdls_pathutil.h>
 #include <bdlt_currenttime.h>
 #include <bdlt_epochutil.h>
+#include <bsl_algorithm.h>
+#include <bsl_fstream.h>
 #include <bsl_iostream.h>
 #include <bsl_map.h>
 #include <bsl_memory.h>
@@ -63,6 +67,9 @@
 #include <bslma_managedptr.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
+#include <bslmt_semaphore.h>
+#include <bslmt_threadutil.h>
+#include <bsls_atomic.h>
 #include <bsls_platform.h>
 #include <bsls_systemclocktype.h>
 #include <bsls_types.h>
@@ -102,6 +109,113 @@ void recoveredQueuesCb(
     static_cast<void>(queueKeyInfoMap);
 }
 
+/// Post on the specified `started` semaphore, and wait on the specified
+/// `release` one.
+void blockWorker(bslmt::Semaphore* started, bslmt::Semaphore* release)
+{
+    started->post();
+    release->wait();
+}
+
+/// Sleep for a while, then set the specified `released` flag and post on
+/// the specified `release` semaphore.
+void delayedRelease(bsls::AtomicBool* released, bslmt::Semaphore* release)
+{
+    bslmt::ThreadUtil::microSleep(100 * 1000);  // 100ms
+    released->store(true);
+    release->post();
+}
+
+/// Write to the specified `fs` a message having the specified `payload`
+/// for the specified `queueKey`, using the specified `bufferFactory`.
+/// Return the value returned by `writeMessageRecord`.
+int writeMessage(mqbs::FileStore*          fs,
+                 bdlbb::BlobBufferFactory* bufferFactory,
+                 const mqbu::StorageKey&   queueKey,
+                 const bsl::string&        payload)
+{
+    bsl::shared_ptr<bdlbb::Blob> appData;
+    appData.createInplace(bmqtst::TestHelperUtil::allocator(),
+                          bufferFactory,
+                          bmqtst::TestHelperUtil::allocator());
+    bdlbb::BlobUtil::append(appData.get(), payload.c_str(), payload.length());
+
+    bmqt::MessageGUID guid;
+    mqbu::MessageGUIDUtil::generateGUID(&guid);
+
+    mqbi::StorageMessageAttributes attributes(
+        bdlt::EpochUtil::convertToTimeT64(bdlt::CurrentTime::utc()),
+        1,  // refCount
+        static_cast<unsigned int>(payload.length()),
+        bmqp::MessagePropertiesInfo(),
+        bmqt::CompressionAlgorithmType::e_NONE,
+        false);  // hasReceipt
+
+    mqbs::DataStoreRecordHandle handle;
+    return fs->writeMessageRecord(&attributes,
+                                  &handle,
+                                  guid,
+                                  appData,
+                                  bsl::shared_ptr<bdlbb::Blob>(),
+                                  queueKey);
+}
+
+/// Copy the file having the specified `path` to the specified `location`.
+void copyFile(const bsl::string& path, const char* location)
+{
+    bsl::string leaf(bmqtst::TestHelperUtil::allocator());
+    BMQTST_ASSERT_EQ(0, bdls::PathUtil::getLeaf(&leaf, path));
+
+    bsl::string target(location, bmqtst::TestHelperUtil::allocator());
+    bdls::PathUtil::appendRaw(&target, leaf.c_str());
+
+    bsl::ifstream in(path.c_str(), bsl::ios::binary);
+    bsl::ofstream out(target.c_str(), bsl::ios::binary);
+    out << in.rdbuf();
+    BMQTST_ASSERT_D(target, out.good());
+}
+
+/// Roll over the specified `fs` and write to it, while the outstanding
+/// records are being copied to the new file set, messages having the
+/// specified `payloads` for the specified `queueKey` using the specified
+/// `bufferFactory`.  Then copy the file sets located at the specified
+/// `location` to the specified `copyLocation`, as they would be left by a
+/// broker stopping at this point.  Note that this function is meant to be
+/// executed by the dispatcher of `fs`, which executes the batches copying
+/// the outstanding records only once it returns.
+void rolloverAndCopyFileSets(mqbs::FileStore*                fs,
+                             bdlbb::BlobBufferFactory*       bufferFactory,
+                             const mqbu::StorageKey&         queueKey,
+                             const bsl::vector<bsl::string>* payloads,
+                             const char*                     location,
+                             const char*                     copyLocation)
+{
+    BMQTST_ASSERT_EQ(0, fs->rollover());
+    BMQTST_ASSERT(fs->isRolloverInProgress());
+
+    for (size_t i = 0; i < payloads->size(); ++i) {
+        BMQTST_ASSERT_EQ_D(
+            i,
+            0,
+            writeMessage(fs, bufferFactory, queueKey, (*payloads)[i]));
+    }
+    BMQTST_ASSERT(fs->isRolloverInProgress());
+
+    bsl::vector<mqbs::FileStoreSet> fileSets(
+        bmqtst::TestHelperUtil::allocator());
+    BMQTST_ASSERT_EQ(0,
+                     mqbs::FileStoreUtil::findFileSets(&fileSets,
+                                                       location,
+                                                       0));  // partitionId
+    BMQTST_ASSERT_EQ(2u, fileSets.size());
+
+    for (size_t i = 0; i < fileSets.size(); ++i) {
+        copyFile(fileSets[i].journalFile(), copyLocation);
+        copyFile(fileSets[i].dataFile(), copyLocation);
+        copyFile(fileSets[i].qlistFile(), copyLocation);
+    }
+}
+
 // CLASSES
 // =============
 // struct Tester
@@ -131,7 +245,10 @@ struct Tester {
 
   public:
     // CREATORS
-    Tester(const char* location)
+    Tester(const char*         location,
+           int                 groupCommitIntervalMs = 0,
+           bsls::Types::Uint64 groupCommitMaxBytes   = 0,
+           int                 rolloverBatchSize     = 0)
     : d_scheduler(bsls::SystemClockType::e_MONOTONIC,
                   bmqtst::TestHelperUtil::allocator())
     , d_bufferFactory(1024, bmqtst::TestHelperUtil::allocator())
@@ -149,7 +266,7 @@ struct Tester {
               2,
               bmqtst::TestHelperUtil::allocator()))
     , d_clusterStats(bmqtst::TestHelperUtil::allocator())
-    , d_miscWorkThreadPool(1, 1, bmqtst::TestHelperUtil::allocator())
+    , d_miscWorkThreadPool(1, 16, bmqtst::TestHelperUtil::allocator())
     , d_dispatcher(bmqtst::TestHelperUtil::allocator())
     , d_statePool(1024, bmqtst::TestHelperUtil::allocator())
     {
@@ -204,6 +321,9 @@ struct Tester {
             .setMaxDataFileSize(d_partitionCfg.maxDataFileSize())
             .setMaxJournalFileSize(d_partitionCfg.maxJournalFileSize())
             .setMaxQlistFileSize(d_partitionCfg.maxQlistFileSize())
+            .setGroupCommitIntervalMs(groupCommitIntervalMs)
+            .setGroupCommitMaxBytes(groupCommitMaxBytes)
+            .setRolloverBatchSize(rolloverBatchSize)
             .setRecoveredQueuesCb(bdlf::BindUtil::bind(
                 &recoveredQueuesCb,
                 bdlf::PlaceHolders::_1,    // partitionId
@@ -232,10 +352,14 @@ struct Tester {
 
         // To pass `inDispatcherThread` checks:
         d_fs_mp->setThreadId(bslmt::ThreadUtil::selfId());
+
+        BMQTST_ASSERT_EQ(0, d_miscWorkThreadPool.start());
     }
 
     ~Tester()
     {
+        d_miscWorkThreadPool.stop();
+
         bdls::FilesystemUtil::remove(d_clusterLocation, true);
         bdls::FilesystemUtil::remove(d_clusterArchiveLocation, true);
     }
@@ -705,6 +829,25 @@ struct Tester {
         return true;
     }
 
+    bdlbb::BlobBufferFactory* bufferFactory() { return &d_bufferFactory; }
+
+    /// Wait until the jobs enqueued by the FileStore in its worker thread
+    /// pool, and the callbacks they dispatch, have completed.
+    void drainMiscWorkThreadPool() { d_miscWorkThreadPool.drain(); }
+
+    /// Enqueue in the worker thread pool of the FileStore a job posting on
+    /// the specified `started` semaphore once it runs, and then blocking the
+    /// worker thread until the specified `release` semaphore is posted.
+    void blockMiscWorkThreadPool(bslmt::Semaphore* started,
+                                 bslmt::Semaphore* release)
+    {
+        BMQTST_ASSERT_EQ(0,
+                         d_miscWorkThreadPool.enqueueJob(bdlf::BindUtil::bind(
+                             &blockWorker,
+                             started,
+                             release)));
+    }
+
     // ACCESSORS
     mqbs::FileStore& fileStore() const { return *(d_fs_mp); }
 
@@ -941,6 +1084,543 @@ static void test2_printTest()
     fs.close();
 }
 
+static void test3_groupCommit()
+// ------------------------------------------------------------------------
+// GROUP COMMIT
+//
+// Concerns:
+//   1. In group commit mode, a message is not receipted when written, even
+//      if it does not require Receipts from replicas.
+//   2. Once the messages pending sync reach the configured number of
+//      bytes, the active file set is synced by a worker thread and all of
+//      them are receipted once the sync has completed.
+//   3. Group commit mode does not affect messages if disabled.
+//
+// Testing:
+//   Group commit
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+
+    const char                k_FILE_STORE_LOCATION[] = "./test-cluster123-3";
+    const int                 k_INTERVAL_MS           = 60 * 1000;
+    const bsls::Types::Uint64 k_MAX_BYTES             = 4 * 1024;
+    const int                 k_PAYLOAD_SIZE          = 1024;
+
+    const mqbu::StorageKey queueKey(mqbu::StorageKey::BinaryRepresentation(),
+                                    "abcde");
+
+    for (int enabled = 0; enabled < 2; ++enabled) {
+        PVV("Group commit " << (enabled ? "enabled" : "disabled"));
+
+        Tester tester(k_FILE_STORE_LOCATION,
+                      enabled ? k_INTERVAL_MS : 0,
+                      k_MAX_BYTES);
+        mqbs::FileStore& fs = tester.fileStore();
+
+        int rc = fs.open();
+        BMQTST_ASSERT_EQ(0, rc);
+        if (rc) {
+            return;  // RETURN
+        }
+
+        fs.setActivePrimary(tester.node(), 1);
+
+        bsl::shared_ptr<bdlbb::Blob> appData;
+        appData.createInplace(bmqtst::TestHelperUtil::allocator(),
+                              tester.bufferFactory(),
+                              bmqtst::TestHelperUtil::allocator());
+        bsl::string payload(k_PAYLOAD_SIZE,
+                            'x',
+                            bmqtst::TestHelperUtil::allocator());
+        bdlbb::BlobUtil::append(appData.get(),
+                                payload.c_str(),
+                                payload.length());
+
+        // Write messages until just before the byte threshold is reached.
+
+        const size_t k_NUM_MESSAGES = k_MAX_BYTES / k_PAYLOAD_SIZE;
+        bsl::vector<mqbs::DataStoreRecordHandle> handles(
+            k_NUM_MESSAGES,
+            bmqtst::TestHelperUtil::allocator());
+
+        for (size_t i = 0; i < k_NUM_MESSAGES; ++i) {
+            bmqt::MessageGUID guid;
+            mqbu::MessageGUIDUtil::generateGUID(&guid);
+
+            mqbi::StorageMessageAttributes attributes(
+                bdlt::EpochUtil::convertToTimeT64(bdlt::CurrentTime::utc()),
+                1,  // refCount
+                k_PAYLOAD_SIZE,
+                bmqp::MessagePropertiesInfo(),
+                bmqt::CompressionAlgorithmType::e_NONE,
+                true);  // hasReceipt
+
+            rc = fs.writeMessageRecord(&attributes,
+                                       &handles[i],
+                                       guid,
+                                       appData,
+                                       bsl::shared_ptr<bdlbb::Blob>(),
+                                       queueKey);
+            BMQTST_ASSERT_EQ_D(i, 0, rc);
+            BMQTST_ASSERT_EQ_D(i, !enabled, attributes.hasReceipt());
+
+            if (i + 1 < k_NUM_MESSAGES) {
+                // Last message has crossed the threshold and triggered a
+                // sync.
+
+                BMQTST_ASSERT_EQ_D(i, !enabled, fs.hasReceipt(handles[i]));
+            }
+        }
+
+        tester.drainMiscWorkThreadPool();
+
+        for (size_t i = 0; i < k_NUM_MESSAGES; ++i) {
+            BMQTST_ASSERT_EQ_D(i, true, fs.hasReceipt(handles[i]));
+        }
+
+        fs.close();
+    }
+}
+
+static void test4_incrementalRollover()
+// ------------------------------------------------------------------------
+// INCREMENTAL ROLLOVER
+//
+// Concerns:
+//   1. Once a rollover copying the outstanding records in batches has
+//      completed, all of them are readable from the new active file set.
+//   2. Records written after the rollover are readable as well.
+//   3. Incremental and non-incremental rollovers lay out the messages
+//      written after the rollover at the same offsets.
+//
+// Testing:
+//   rollover()
+//   completeRollover()
+//   isRolloverInProgress()
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+
+    const char k_FILE_STORE_LOCATION[] = "./test-cluster123-4";
+    const int  k_NUM_MESSAGES          = 20;
+    const int  k_BATCH_SIZE            = 3;
+
+    const mqbu::StorageKey queueKey(mqbu::StorageKey::BinaryRepresentation(),
+                                    "abcde");
+
+    unsigned int dataOffsetsDwords[2] = {0, 0};
+
+    for (int incremental = 0; incremental < 2; ++incremental) {
+        PVV("Incremental rollover " << (incremental ? "enabled" : "disabled"));
+
+        Tester tester(k_FILE_STORE_LOCATION,
+                      0,  // groupCommitIntervalMs
+                      0,  // groupCommitMaxBytes
+                      incremental ? k_BATCH_SIZE : 0);
+        mqbs::FileStore& fs = tester.fileStore();
+
+        int rc = fs.open();
+        BMQTST_ASSERT_EQ(0, rc);
+        if (rc) {
+            return;  // RETURN
+        }
+
+        fs.setActivePrimary(tester.node(), 1);
+
+        bsl::vector<mqbs::DataStoreRecordHandle> handles(
+            bmqtst::TestHelperUtil::allocator());
+        bsl::vector<bsl::string> payloads(bmqtst::TestHelperUtil::allocator());
+
+        for (int i = 0; i < 2 * k_NUM_MESSAGES; ++i) {
+            if (k_NUM_MESSAGES == i) {
+                // Roll over half-way.  The mock dispatcher executes the
+                // batches inline, so the rollover is complete on return.
+
+                BMQTST_ASSERT_EQ(0, fs.rollover());
+                BMQTST_ASSERT(!fs.isRolloverInProgress());
+                BMQTST_ASSERT_EQ(static_cast<bsls::Types::Uint64>(i),
+                                 fs.numRecords());
+            }
+
+            bsl::string payload(static_cast<size_t>(64 + i),
+                                static_cast<char>('a' + i % 26),
+                                bmqtst::TestHelperUtil::allocator());
+
+            bsl::shared_ptr<bdlbb::Blob> appData;
+            appData.createInplace(bmqtst::TestHelperUtil::allocator(),
+                                  tester.bufferFactory(),
+                                  bmqtst::TestHelperUtil::allocator());
+            bdlbb::BlobUtil::append(appData.get(),
+                                    payload.c_str(),
+                                    payload.length());
+
+            bmqt::MessageGUID guid;
+            mqbu::MessageGUIDUtil::generateGUID(&guid);
+
+            mqbi::StorageMessageAttributes attributes(
+                bdlt::EpochUtil::convertToTimeT64(bdlt::CurrentTime::utc()),
+                1,  // refCount
+                static_cast<unsigned int>(payload.length()),
+                bmqp::MessagePropertiesInfo(),
+                bmqt::CompressionAlgorithmType::e_NONE,
+                false);  // hasReceipt
+
+            mqbs::DataStoreRecordHandle handle;
+            rc = fs.writeMessageRecord(&attributes,
+                                       &handle,
+                                       guid,
+                                       appData,
+                                       bsl::shared_ptr<bdlbb::Blob>(),
+                                       queueKey);
+            BMQTST_ASSERT_EQ_D(i, 0, rc);
+
+            handles.push_back(handle);
+            payloads.push_back(payload);
+        }
+
+        for (size_t i = 0; i < handles.size(); ++i) {
+            bsl::shared_ptr<bdlbb::Blob>   appData;
+            bsl::shared_ptr<bdlbb::Blob>   options;
+            mqbi::StorageMessageAttributes attributes;
+
+            fs.loadMessageRaw(&appData, &options, &attributes, handles[i]);
+            BMQTST_ASSERT_EQ_D(i,
+                               static_cast<unsigned int>(payloads[i].length()),
+                               attributes.appDataLen());
+
+            bsl::string loaded(static_cast<size_t>(appData->length()),
+                               '\0',
+                               bmqtst::TestHelperUtil::allocator());
+            bdlbb::BlobUtil::copy(&loaded[0], *appData, 0, appData->length());
+            BMQTST_ASSERT_EQ_D(i, payloads[i], loaded);
+        }
+
+        mqbs::MessageRecord lastRecord;
+        fs.loadMessageRecordRaw(&lastRecord, handles.back());
+        dataOffsetsDwords[incremental] = lastRecord.messageOffsetDwords();
+
+        fs.close();
+    }
+
+    BMQTST_ASSERT_EQ(dataOffsetsDwords[0], dataOffsetsDwords[1]);
+}
+
+static void test5_groupCommitRollover()
+// ------------------------------------------------------------------------
+// GROUP COMMIT ROLLOVER
+//
+// Concerns:
+//   1. A group commit sync of the old file set completing after a rollover
+//      does not receipt any message, since the copies of the messages in
+//      the new active file set have not been synced.
+//   2. The messages are receipted once the new active file set has been
+//      synced.
+//
+// Testing:
+//   Group commit with rollover()
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+
+    const char                k_FILE_STORE_LOCATION[] = "./test-cluster123-5";
+    const int                 k_INTERVAL_MS           = 60 * 1000;
+    const bsls::Types::Uint64 k_MAX_BYTES             = 4 * 1024;
+    const int                 k_PAYLOAD_SIZE          = 1024;
+    const int                 k_BATCH_SIZE            = 2;
+
+    const mqbu::StorageKey queueKey(mqbu::StorageKey::BinaryRepresentation(),
+                                    "abcde");
+
+    Tester tester(k_FILE_STORE_LOCATION,
+                  k_INTERVAL_MS,
+                  k_MAX_BYTES,
+                  k_BATCH_SIZE);
+    mqbs::FileStore& fs = tester.fileStore();
+
+    int rc = fs.open();
+    BMQTST_ASSERT_EQ(0, rc);
+    if (rc) {
+        return;  // RETURN
+    }
+
+    fs.setActivePrimary(tester.node(), 1);
+
+    bsl::shared_ptr<bdlbb::Blob> appData;
+    appData.createInplace(bmqtst::TestHelperUtil::allocator(),
+                          tester.bufferFactory(),
+                          bmqtst::TestHelperUtil::allocator());
+    bsl::string payload(k_PAYLOAD_SIZE,
+                        'x',
+                        bmqtst::TestHelperUtil::allocator());
+    bdlbb::BlobUtil::append(appData.get(), payload.c_str(), payload.length());
+
+    // Hold the worker thread, so that the sync triggered by the messages
+    // below is still pending when rolling over.
+
+    bslmt::Semaphore started;
+    bslmt::Semaphore release;
+    tester.blockMiscWorkThreadPool(&started, &release);
+    started.wait();
+
+    const size_t k_NUM_MESSAGES = k_MAX_BYTES / k_PAYLOAD_SIZE;
+    bsl::vector<mqbs::DataStoreRecordHandle> handles(
+        k_NUM_MESSAGES,
+        bmqtst::TestHelperUtil::allocator());
+
+    for (size_t i = 0; i < k_NUM_MESSAGES; ++i) {
+        bmqt::MessageGUID guid;
+        mqbu::MessageGUIDUtil::generateGUID(&guid);
+
+        mqbi::StorageMessageAttributes attributes(
+            bdlt::EpochUtil::convertToTimeT64(bdlt::CurrentTime::utc()),
+            1,  // refCount
+            k_PAYLOAD_SIZE,
+            bmqp::MessagePropertiesInfo(),
+            bmqt::CompressionAlgorithmType::e_NONE,
+            true);  // hasReceipt
+
+        rc = fs.writeMessageRecord(&attributes,
+                                   &handles[i],
+                                   guid,
+                                   appData,
+                                   bsl::shared_ptr<bdlbb::Blob>(),
+                                   queueKey);
+        BMQTST_ASSERT_EQ_D(i, 0, rc);
+    }
+
+    // Roll over while the sync of the old file set is pending.  The mock
+    // dispatcher executes the batches inline, so the rollover is complete on
+    // return.
+
+    BMQTST_ASSERT_EQ(0, fs.rollover());
+    BMQTST_ASSERT(!fs.isRolloverInProgress());
+
+    // Let the pending sync complete, and hold the worker thread again, so
+    // that the sync of the new active file set it triggers stays pending.
+
+    bslmt::Semaphore startedAgain;
+    bslmt::Semaphore releaseAgain;
+    tester.blockMiscWorkThreadPool(&startedAgain, &releaseAgain);
+    release.post();
+    startedAgain.wait();
+
+    for (size_t i = 0; i < k_NUM_MESSAGES; ++i) {
+        BMQTST_ASSERT_EQ_D(i, false, fs.hasReceipt(handles[i]));
+    }
+
+    releaseAgain.post();
+    tester.drainMiscWorkThreadPool();
+
+    for (size_t i = 0; i < k_NUM_MESSAGES; ++i) {
+        BMQTST_ASSERT_EQ_D(i, true, fs.hasReceipt(handles[i]));
+    }
+
+    fs.close();
+}
+
+static void test6_groupCommitClose()
+// ------------------------------------------------------------------------
+// GROUP COMMIT CLOSE
+//
+// Concerns:
+//   1. Closing the FileStore waits for the group commit sync in progress
+//      in a worker thread before truncating and unmapping the files of
+//      the active file set.
+//
+// Testing:
+//   Group commit with close()
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+
+    const char                k_FILE_STORE_LOCATION[] = "./test-cluster123-6";
+    const int                 k_INTERVAL_MS           = 60 * 1000;
+    const bsls::Types::Uint64 k_MAX_BYTES             = 4 * 1024;
+    const int                 k_PAYLOAD_SIZE          = 1024;
+
+    const mqbu::StorageKey queueKey(mqbu::StorageKey::BinaryRepresentation(),
+                                    "abcde");
+
+    Tester           tester(k_FILE_STORE_LOCATION, k_INTERVAL_MS, k_MAX_BYTES);
+    mqbs::FileStore& fs = tester.fileStore();
+
+    int rc = fs.open();
+    BMQTST_ASSERT_EQ(0, rc);
+    if (rc) {
+        return;  // RETURN
+    }
+
+    fs.setActivePrimary(tester.node(), 1);
+
+    bsl::shared_ptr<bdlbb::Blob> appData;
+    appData.createInplace(bmqtst::TestHelperUtil::allocator(),
+                          tester.bufferFactory(),
+                          bmqtst::TestHelperUtil::allocator());
+    bsl::string payload(k_PAYLOAD_SIZE,
+                        'x',
+                        bmqtst::TestHelperUtil::allocator());
+    bdlbb::BlobUtil::append(appData.get(), payload.c_str(), payload.length());
+
+    // Hold the worker thread, so that the sync triggered by the messages
+    // below is still pending when closing.
+
+    bslmt::Semaphore started;
+    bslmt::Semaphore release;
+    tester.blockMiscWorkThreadPool(&started, &release);
+    started.wait();
+
+    const size_t k_NUM_MESSAGES = k_MAX_BYTES / k_PAYLOAD_SIZE;
+    for (size_t i = 0; i < k_NUM_MESSAGES; ++i) {
+        bmqt::MessageGUID guid;
+        mqbu::MessageGUIDUtil::generateGUID(&guid);
+
+        mqbi::StorageMessageAttributes attributes(
+            bdlt::EpochUtil::convertToTimeT64(bdlt::CurrentTime::utc()),
+            1,  // refCount
+            k_PAYLOAD_SIZE,
+            bmqp::MessagePropertiesInfo(),
+            bmqt::CompressionAlgorithmType::e_NONE,
+            true);  // hasReceipt
+
+        mqbs::DataStoreRecordHandle handle;
+        rc = fs.writeMessageRecord(&attributes,
+                                   &handle,
+                                   guid,
+                                   appData,
+                                   bsl::shared_ptr<bdlbb::Blob>(),
+                                   queueKey);
+        BMQTST_ASSERT_EQ_D(i, 0, rc);
+    }
+
+    // Release the worker thread from another thread, after a delay, and
+    // close meanwhile: 'close' must not return before the sync has run.
+
+    bsls::AtomicBool          released(false);
+    bslmt::ThreadUtil::Handle threadHandle;
+    rc = bslmt::ThreadUtil::create(
+        &threadHandle,
+        bdlf::BindUtil::bind(&delayedRelease, &released, &release));
+    BMQTST_ASSERT_EQ(0, rc);
+
+    fs.close();
+    BMQTST_ASSERT(released.load());
+
+    bslmt::ThreadUtil::join(threadHandle);
+    tester.drainMiscWorkThreadPool();
+}
+
+static void test7_unfinishedIncrementalRollover()
+// ------------------------------------------------------------------------
+// UNFINISHED INCREMENTAL ROLLOVER
+//
+// Concerns:
+//   1. Opening the file sets left by a broker which stopped while the
+//      outstanding records were being copied in batches to the new file
+//      set recovers both these records and the records written after the
+//      rollover.
+//
+// Testing:
+//   open() after a rollover which did not complete
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+
+    const char k_FILE_STORE_LOCATION[] = "./test-cluster123-7";
+    const char k_RECOVERY_LOCATION[]   = "./test-cluster123-7-recovery";
+    const int  k_NUM_MESSAGES          = 20;
+    const int  k_BATCH_SIZE            = 3;
+
+    const mqbu::StorageKey queueKey(mqbu::StorageKey::BinaryRepresentation(),
+                                    "abcde");
+
+    bsl::vector<bsl::string> payloads(bmqtst::TestHelperUtil::allocator());
+    for (int i = 0; i < 2 * k_NUM_MESSAGES; ++i) {
+        payloads.push_back(bsl::string(static_cast<size_t>(64 + i),
+                                       static_cast<char>('a' + i % 26),
+                                       bmqtst::TestHelperUtil::allocator()));
+    }
+    const bsl::vector<bsl::string> tailPayloads(
+        payloads.begin() + k_NUM_MESSAGES,
+        payloads.end(),
+        bmqtst::TestHelperUtil::allocator());
+
+    Tester tester(k_FILE_STORE_LOCATION,
+                  0,  // groupCommitIntervalMs
+                  0,  // groupCommitMaxBytes
+                  k_BATCH_SIZE);
+    Tester recoveryTester(k_RECOVERY_LOCATION);
+
+    mqbs::FileStore& fs = tester.fileStore();
+
+    int rc = fs.open();
+    BMQTST_ASSERT_EQ(0, rc);
+    if (rc) {
+        return;  // RETURN
+    }
+
+    fs.setActivePrimary(tester.node(), 1);
+
+    for (int i = 0; i < k_NUM_MESSAGES; ++i) {
+        BMQTST_ASSERT_EQ_D(
+            i,
+            0,
+            writeMessage(&fs, tester.bufferFactory(), queueKey, payloads[i]));
+    }
+
+    PVV("Copy the file sets while the rollover is in progress");
+    fs.execute(bdlf::BindUtil::bind(&rolloverAndCopyFileSets,
+                                    &fs,
+                                    tester.bufferFactory(),
+                                    queueKey,
+                                    &tailPayloads,
+                                    k_FILE_STORE_LOCATION,
+                                    k_RECOVERY_LOCATION));
+    BMQTST_ASSERT(!fs.isRolloverInProgress());
+    fs.close();
+
+    PVV("Recover from the copied file sets");
+    mqbs::FileStore& recoveredFs = recoveryTester.fileStore();
+
+    rc = recoveredFs.open();
+    BMQTST_ASSERT_EQ(0, rc);
+    if (rc) {
+        return;  // RETURN
+    }
+
+    BMQTST_ASSERT_EQ(static_cast<bsls::Types::Uint64>(payloads.size()),
+                     recoveredFs.numRecords());
+
+    bsl::vector<bsl::string> loadedPayloads(
+        bmqtst::TestHelperUtil::allocator());
+    mqbs::FileStoreIterator  fsIt(&recoveredFs);
+    while (fsIt.next()) {
+        BMQTST_ASSERT_EQ(mqbs::RecordType::e_MESSAGE, fsIt.type());
+
+        bsl::shared_ptr<bdlbb::Blob>   appData;
+        bsl::shared_ptr<bdlbb::Blob>   options;
+        mqbi::StorageMessageAttributes attributes;
+        recoveredFs.loadMessageRaw(&appData,
+                                   &options,
+                                   &attributes,
+                                   fsIt.handle());
+
+        bsl::string loaded(static_cast<size_t>(appData->length()),
+                           '\0',
+                           bmqtst::TestHelperUtil::allocator());
+        bdlbb::BlobUtil::copy(&loaded[0], *appData, 0, appData->length());
+        loadedPayloads.push_back(loaded);
+    }
+
+    // Records are not necessarily iterated in the order they were written.
+
+    bsl::sort(loadedPayloads.begin(), loadedPayloads.end());
+    bsl::sort(payloads.begin(), payloads.end());
+    BMQTST_ASSERT(payloads == loadedPayloads);
+
+    recoveredFs.close();
+}
+
 }  // close unnamed namespace
 
 // ============================================================================
@@ -957,6 +1637,11 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 7: test7_unfinishedIncrementalRollover(); break;
+    case 6: test6_groupCommitClose(); break;
+    case 5: test5_groupCommitRollover(); break;
+    case 4: test4_incrementalRollover(); break;
+    case 3: test3_groupCommit(); break;
     case 2: test2_printTest(); break;
     case 1: test1_breathingTest(); break;
     default: {
@@ -105,10 +105,78 @@ void createFileName(bsl::string*             filename,
     filename->append(extension);
 }
 
+/// Populate the specified `filename` with the name of the file having the
+/// specified `extension` of the spare file set of the specified
+/// `partitionId` located at the specified `basePath`.  Note that the format
+/// is:
+///
+///     `/basePath/bmq_G.spare.extension`
+///
+/// where `G` is partitionId, which is deliberately not matched by the
+/// patterns used to look up file sets.
+void createSpareFileName(bsl::string*             filename,
+                         const bslstl::StringRef& basePath,
+                         int                      partitionId,
+                         const char*              extension)
+{
+    filename->clear();
+    filename->append(basePath);
+    if (*(filename->rbegin()) != '/') {
+        filename->append(1, '/');
+    }
+
+    filename->append(FileStoreProtocol::k_COMMON_FILE_PREFIX);
+    bmqu::MemOutStream osstr;
+    osstr << partitionId;
+    filename->append(osstr.str().data(), osstr.str().length());
+    filename->append(".spare");
+    filename->append(extension);
+}
+
+/// Load into the specified `dataFileName`, `journalFileName` and, unless it
+/// is null, the specified `qlistFileName` the names of the files of a new
+/// file set of the specified `partitionId` located at the specified
+/// `location`, none of which clashes with an existing file.
+void loadNewFileNames(bsl::string*             dataFileName,
+                      bsl::string*             journalFileName,
+                      bsl::string*             qlistFileName,
+                      const bslstl::StringRef& location,
+                      int                      partitionId)
+{
+    bdlt::Datetime now       = bdlt::CurrentTime::utc();
+    int            increment = 0;
+
+    do {
+        // Increment 'now' by 1 second everytime there is a clash of at least
+        // 1 file name.
+
+        now.addSeconds(increment++);
+        FileStoreUtil::createDataFileName(dataFileName,
+                                          location,
+                                          partitionId,
+                                          now);
+
+        FileStoreUtil::createJournalFileName(journalFileName,
+                                             location,
+                                             partitionId,
+                                             now);
+
+        if (qlistFileName) {
+            FileStoreUtil::createQlistFileName(qlistFileName,
+                                               location,
+                                               partitionId,
+                                               now);
+        }
+    } while (bdls::FilesystemUtil::exists(*dataFileName) ||
+             bdls::FilesystemUtil::exists(*journalFileName) ||
+             (qlistFileName && bdls::FilesystemUtil::exists(*qlistFileName)));
+}
+
 int openFileSet(bsl::ostream&         errorDescription,
                 const FileStoreSet&   fileSet,
                 bool                  readOnly,
                 bool                  prefaultPages,
+                bool                  useHugePages,
                 MappedFileDescriptor* journalFd = 0,
                 MappedFileDescriptor* dataFd    = 0,
                 MappedFileDescriptor* qlistFd   = 0)
@@ -145,7 +213,8 @@ int openFileSet(bsl::ostream&         errorDescription,
                                   fileSet.journalFileSize(),
                                   readOnly,
                                   errorDescription,
-                                  prefaultPages);
+                                  prefaultPages,
+                                  useHugePages);
         if (0 != rc) {
             return 10 * rc + rc_JOURNAL_OPEN_FAILURE;  // RETURN
         }
@@ -157,7 +226,8 @@ int openFileSet(bsl::ostream&         errorDescription,
                                   fileSet.dataFileSize(),
                                   readOnly,
                                   errorDescription,
-                                  prefaultPages);
+                                  prefaultPages,
+                                  useHugePages);
 
         if (0 != rc) {
             if (journalFd) {
@@ -173,7 +243,8 @@ int openFileSet(bsl::ostream&         errorDescription,
                                   fileSet.qlistFileSize(),
                                   readOnly,
                                   errorDescription,
-                                  prefaultPages);
+                                  prefaultPages,
+                                  useHugePages);
 
         if (0 != rc) {
             if (journalFd) {
@@ -511,50 +582,181 @@ int FileStoreUtil::create(bsl::ostream&            errorDescription,
     FileSetSp result;
     result.createInplace(allocator, fileStore, allocator);
 
-    bdlt::Datetime now       = bdlt::CurrentTime::utc();
-    int            increment = 0;
+    loadNewFileNames(&result->d_dataFileName,
+                     &result->d_journalFileName,
+                     needQList ? &result->d_qlistFileName : 0,
+                     dataStoreConfig.location(),
+                     partitionId);
 
-    do {
-        // Increment 'now' by 1 second everytime there is a clash of at least
-        // 1 file name.
+    BSLS_ASSERT_SAFE(!bdls::FilesystemUtil::exists(result->d_dataFileName));
+    BSLS_ASSERT_SAFE(!bdls::FilesystemUtil::exists(result->d_journalFileName));
+    if (needQList) {
+        BSLS_ASSERT_SAFE(
+            !bdls::FilesystemUtil::exists(result->d_qlistFileName));
+    }
 
-        now.addSeconds(increment++);
-        createDataFileName(&result->d_dataFileName,
-                           dataStoreConfig.location(),
-                           partitionId,
-                           now);
+    const int rc = initializeFileSet(errorDescription,
+                                     result.get(),
+                                     partitionId,
+                                     dataStoreConfig,
+                                     partitionDesc,
+                                     needQList);
+    if (0 != rc) {
+        return rc;  // RETURN
+    }
 
-        createJournalFileName(&result->d_journalFileName,
-                              dataStoreConfig.location(),
-                              partitionId,
-                              now);
+    *fileSetSp = result;
+
+    return 0;
+}
+
+int FileStoreUtil::createSpare(bsl::ostream&            errorDescription,
+                               FileSetSp*               fileSetSp,
+                               FileStore*               fileStore,
+                               int                      partitionId,
+                               const DataStoreConfig&   dataStoreConfig,
+                               const bslstl::StringRef& partitionDesc,
+                               bool                     needQList,
+                               bslma::Allocator*        allocator)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(fileSetSp);
+    BSLS_ASSERT_SAFE(partitionId >= 0);
 
+    FileSetSp result;
+    result.createInplace(allocator, fileStore, allocator);
+
+    createSpareFileName(&result->d_dataFileName,
+                        dataStoreConfig.location(),
+                        partitionId,
+                        FileStoreProtocol::k_DATA_FILE_EXTENSION);
+    createSpareFileName(&result->d_journalFileName,
+                        dataStoreConfig.location(),
+                        partitionId,
+                        FileStoreProtocol::k_JOURNAL_FILE_EXTENSION);
+    if (needQList) {
+        createSpareFileName(&result->d_qlistFileName,
+                            dataStoreConfig.location(),
+                            partitionId,
+                            FileStoreProtocol::k_QLIST_FILE_EXTENSION);
+    }
+
+    // A spare file set is never recovered, so any leftover one is stale.
+
+    bdls::FilesystemUtil::remove(result->d_dataFileName);
+    bdls::FilesystemUtil::remove(result->d_journalFileName);
+    if (needQList) {
+        bdls::FilesystemUtil::remove(result->d_qlistFileName);
+    }
+
+    const int rc = initializeFileSet(errorDescription,
+                                     result.get(),
+                                     partitionId,
+                                     dataStoreConfig,
+                                     partitionDesc,
+                                     needQList);
+    if (0 != rc) {
+        return rc;  // RETURN
+    }
+
+    *fileSetSp = result;
+
+    return 0;
+}
+
+int FileStoreUtil::activateSpare(bsl::ostream&            errorDescription,
+                                 FileSet*                 fileSet,
+                                 int                      partitionId,
+                                 const bslstl::StringRef& location,
+                                 bool                     needQList)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(fileSet);
+    BSLS_ASSERT_SAFE(partitionId >= 0);
+
+    enum {
+        rc_SUCCESS                = 0,
+        rc_DATA_RENAME_FAILURE    = -1,
+        rc_JOURNAL_RENAME_FAILURE = -2,
+        rc_QLIST_RENAME_FAILURE   = -3
+    };
+
+    bsl::string dataFileName(fileSet->d_allocator_p);
+    bsl::string journalFileName(fileSet->d_allocator_p);
+    bsl::string qlistFileName(fileSet->d_allocator_p);
+    loadNewFileNames(&dataFileName,
+                     &journalFileName,
+                     needQList ? &qlistFileName : 0,
+                     location,
+                     partitionId);
+
+    // Rename the JOURNAL last, so that a crash in between leaves no file set
+    // which recovery could pick up: an incomplete set is ignored by it.
+
+    int rc = bdls::FilesystemUtil::move(fileSet->d_dataFileName.c_str(),
+                                        dataFileName.c_str());
+    if (0 != rc) {
+        errorDescription << "Failed to rename data file ["
+                         << fileSet->d_dataFileName << "] to ["
+                         << dataFileName << "], rc: " << rc;
+        return rc_DATA_RENAME_FAILURE;  // RETURN
+    }
+
+    if (needQList) {
+        rc = bdls::FilesystemUtil::move(fileSet->d_qlistFileName.c_str(),
+                                        qlistFileName.c_str());
+        if (0 != rc) {
+            errorDescription << "Failed to rename qlist file ["
+                             << fileSet->d_qlistFileName << "] to ["
+                             << qlistFileName << "], rc: " << rc;
+            bdls::FilesystemUtil::move(dataFileName.c_str(),
+                                       fileSet->d_dataFileName.c_str());
+            return rc_QLIST_RENAME_FAILURE;  // RETURN
+        }
+    }
+
+    rc = bdls::FilesystemUtil::move(fileSet->d_journalFileName.c_str(),
+                                    journalFileName.c_str());
+    if (0 != rc) {
+        errorDescription << "Failed to rename journal file ["
+                         << fileSet->d_journalFileName << "] to ["
+                         << journalFileName << "], rc: " << rc;
+        bdls::FilesystemUtil::move(dataFileName.c_str(),
+                                   fileSet->d_dataFileName.c_str());
         if (needQList) {
-            createQlistFileName(&result->d_qlistFileName,
-                                dataStoreConfig.location(),
-                                partitionId,
-                                now);
+            bdls::FilesystemUtil::move(qlistFileName.c_str(),
+                                       fileSet->d_qlistFileName.c_str());
         }
-    } while (
-        bdls::FilesystemUtil::exists(result->d_dataFileName) ||
-        bdls::FilesystemUtil::exists(result->d_journalFileName) ||
-        (needQList && bdls::FilesystemUtil::exists(result->d_qlistFileName)));
+        return rc_JOURNAL_RENAME_FAILURE;  // RETURN
+    }
 
-    BSLS_ASSERT_SAFE(!bdls::FilesystemUtil::exists(result->d_dataFileName));
-    BSLS_ASSERT_SAFE(!bdls::FilesystemUtil::exists(result->d_journalFileName));
+    fileSet->d_dataFileName.swap(dataFileName);
+    fileSet->d_journalFileName.swap(journalFileName);
     if (needQList) {
-        BSLS_ASSERT_SAFE(
-            !bdls::FilesystemUtil::exists(result->d_qlistFileName));
+        fileSet->d_qlistFileName.swap(qlistFileName);
     }
 
+    return rc_SUCCESS;
+}
+
+int FileStoreUtil::initializeFileSet(bsl::ostream&            errorDescription,
+                                     FileSet*                 fileSet,
+                                     int                      partitionId,
+                                     const DataStoreConfig&   dataStoreConfig,
+                                     const bslstl::StringRef& partitionDesc,
+                                     bool                     needQList)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(fileSet);
+
     // Open, mmap and grow files (delete created files on failure)
     FileStoreSet fs;
-    fs.setDataFile(result->d_dataFileName)
+    fs.setDataFile(fileSet->d_dataFileName)
         .setDataFileSize(dataStoreConfig.maxDataFileSize())
-        .setJournalFile(result->d_journalFileName)
+        .setJournalFile(fileSet->d_journalFileName)
         .setJournalFileSize(dataStoreConfig.maxJournalFileSize());
     if (needQList) {
-        fs.setQlistFile(result->d_qlistFileName)
+        fs.setQlistFile(fileSet->d_qlistFileName)
             .setQlistFileSize(dataStoreConfig.maxQlistFileSize());
     }
 
@@ -563,10 +765,11 @@ int FileStoreUtil::create(bsl::ostream&            errorDescription,
                                   fs,
                                   dataStoreConfig.hasPreallocate(),
                                   true,  // delete on failure
-                                  &result->d_journalFile,
-                                  &result->d_dataFile,
-                                  needQList ? &result->d_qlistFile : 0,
-                                  dataStoreConfig.hasPrefaultPages());
+                                  &fileSet->d_journalFile,
+                                  &fileSet->d_dataFile,
+                                  needQList ? &fileSet->d_qlistFile : 0,
+                                  dataStoreConfig.hasPrefaultPages(),
+                                  dataStoreConfig.hasHugePages());
 
     if (0 != rc) {
         errorDescription << partitionDesc << " Failed to open file set in "
@@ -575,26 +778,26 @@ int FileStoreUtil::create(bsl::ostream&            errorDescription,
     }
 
     // Local refs for convenience
-    MappedFileDescriptor& dataFile    = result->d_dataFile;
-    bsls::Types::Uint64&  dataFilePos = result->d_dataFilePosition;
+    MappedFileDescriptor& dataFile    = fileSet->d_dataFile;
+    bsls::Types::Uint64&  dataFilePos = fileSet->d_dataFilePosition;
 
-    MappedFileDescriptor& journal    = result->d_journalFile;
-    bsls::Types::Uint64&  journalPos = result->d_journalFilePosition;
+    MappedFileDescriptor& journal    = fileSet->d_journalFile;
+    bsls::Types::Uint64&  journalPos = fileSet->d_journalFilePosition;
 
-    MappedFileDescriptor& qlistFile    = result->d_qlistFile;
-    bsls::Types::Uint64&  qlistFilePos = result->d_qlistFilePosition;
+    MappedFileDescriptor& qlistFile    = fileSet->d_qlistFile;
+    bsls::Types::Uint64&  qlistFilePos = fileSet->d_qlistFilePosition;
 
     BALL_LOG_INFO_BLOCK
     {
         BALL_LOG_OUTPUT_STREAM
-            << partitionDesc << "Created data file [" << result->d_dataFileName
-            << "] (size = " << dataFile.fileSize()
+            << partitionDesc << "Created data file ["
+            << fileSet->d_dataFileName << "] (size = " << dataFile.fileSize()
             << ", filePos = " << dataFilePos << "), journal file ["
-            << result->d_journalFileName << "] (size = " << journal.fileSize()
+            << fileSet->d_journalFileName << "] (size = " << journal.fileSize()
             << ", filePos = " << journalPos << ")";
         if (needQList) {
             BALL_LOG_OUTPUT_STREAM << ", qlist file ["
-                                   << result->d_qlistFileName
+                                   << fileSet->d_qlistFileName
                                    << "] (size = " << qlistFile.fileSize()
                                    << ", filePos = " << qlistFilePos << ")";
         }
@@ -611,15 +814,15 @@ int FileStoreUtil::create(bsl::ostream&            errorDescription,
 
     // Data file -- append DataFileHeader
 
-    result->d_dataFileKey = mqbu::StorageKey::k_NULL_KEY;
+    fileSet->d_dataFileKey = mqbu::StorageKey::k_NULL_KEY;
     // explicitly initialize to null since this field is unused for now.
 
     OffsetPtr<DataFileHeader> dfh(dataFile.block(), dataFilePos);
     new (dfh.get()) DataFileHeader();
-    dfh->setFileKey(result->d_dataFileKey);
+    dfh->setFileKey(fileSet->d_dataFileKey);
     dataFilePos += sizeof(DataFileHeader);
 
-    result->d_outstandingBytesData += dataFilePos;
+    fileSet->d_outstandingBytesData += dataFilePos;
 
     // Journal file -- append BlazingMQ header
     fh.reset(journal.block(), journalPos);
@@ -632,7 +835,7 @@ int FileStoreUtil::create(bsl::ostream&            errorDescription,
     new (jfh.get()) JournalFileHeader();  // Default values are fine
     journalPos += sizeof(JournalFileHeader);
 
-    result->d_outstandingBytesJournal += journalPos;
+    fileSet->d_outstandingBytesJournal += journalPos;
 
     if (needQList) {
         // Qlist file -- append BlazingMQ header
@@ -647,11 +850,9 @@ int FileStoreUtil::create(bsl::ostream&            errorDescription,
         new (qfh.get()) QlistFileHeader();
         qlistFilePos += sizeof(QlistFileHeader);
 
-        result->d_outstandingBytesQlist += qlistFilePos;
+        fileSet->d_outstandingBytesQlist += qlistFilePos;
     }
 
-    *fileSetSp = result;
-
     return 0;
 }
 
@@ -916,6 +1117,7 @@ int FileStoreUtil::openFileSetReadMode(bsl::ostream&         errorDescription,
                        fileSet,
                        true,   // readOnly
                        false,  // prefaultPages
+                       false,  // useHugePages
                        journalFd,
                        dataFd,
                        qlistFd);
@@ -928,7 +1130,8 @@ int FileStoreUtil::openFileSetWriteMode(bsl::ostream&         errorDescription,
                                         MappedFileDescriptor* journalFd,
                                         MappedFileDescriptor* dataFd,
                                         MappedFileDescriptor* qlistFd,
-                                        bool                  prefaultPages)
+                                        bool                  prefaultPages,
+                                        bool                  useHugePages)
 {
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(journalFd || dataFd || qlistFd);
@@ -952,6 +1155,7 @@ int FileStoreUtil::openFileSetWriteMode(bsl::ostream&         errorDescription,
                          fileSet,
                          false,  // readOnly
                          prefaultPages,
+                         useHugePages,
                          journalFd,
                          dataFd,
                          qlistFd);
@@ -1131,7 +1335,8 @@ int FileStoreUtil::openRecoveryFileSet(bsl::ostream&         errorDescription,
                                       journalFd,
                                       dataFd,
                                       qlistFd,
-                                      config.hasPrefaultPages());
+                                      config.hasPrefaultPages(),
+                                      config.hasHugePages());
         }
 
         if (rc != 0) {
@@ -101,6 +101,22 @@ struct FileStoreUtil {
                                const bsl::vector<bsl::string>& files,
                                bool                            withSize);
 
+    /// Open for writing the files named in the specified `fileSet`, grow
+    /// them and write the BlazingMQ header and file-specific header to them
+    /// for the specified `partitionId`, using the specified
+    /// `dataStoreConfig`.  The specified `partitionDesc` is used for
+    /// logging purposes.  The specified `needQList` determines whether to
+    /// create and open the QList file.  Return zero on success, non-zero
+    /// value otherwise along with populating the specified
+    /// `errorDescription` with a brief reason for logging purposes, in
+    /// which case the files are deleted.
+    static int initializeFileSet(bsl::ostream&            errorDescription,
+                                 FileSet*                 fileSet,
+                                 int                      partitionId,
+                                 const DataStoreConfig&   dataStoreConfig,
+                                 const bslstl::StringRef& partitionDesc,
+                                 bool                     needQList);
+
   public:
     // CLASS METHODS
 
@@ -174,6 +190,43 @@ struct FileStoreUtil {
                       bool                     needQList,
                       bslma::Allocator*        allocator);
 
+    /// Create the files of a spare file set, open them for writing and
+    /// populate the specified `fileSetSp` for the specified `partitionId`
+    /// with relevant information, using the specified `fileStore` and
+    /// `dataStoreConfig`, exactly as `create` does, except that the files
+    /// are given names which are not recognized as those of a file set, so
+    /// that they are ignored by recovery until `activateSpare` is invoked.
+    /// Any spare file set left over for `partitionId`, e.g. by a crash, is
+    /// deleted first.  The specified `partitionDesc` is used for logging
+    /// purposes.  The specified `needQList` determines whether to create
+    /// and open the QList file.  Use the specified `allocator` for memory
+    /// allocations.  Return zero on success, non-zero value otherwise along
+    /// with populating the specified `errorDescription` with a brief reason
+    /// for logging purposes.
+    static int createSpare(bsl::ostream&            errorDescription,
+                           FileSetSp*               fileSetSp,
+                           FileStore*               fileStore,
+                           int                      partitionId,
+                           const DataStoreConfig&   dataStoreConfig,
+                           const bslstl::StringRef& partitionDesc,
+                           bool                     needQList,
+                           bslma::Allocator*        allocator);
+
+    /// Rename the files of the specified spare `fileSet`, created with
+    /// `createSpare` for the specified `partitionId`, to the names of a new
+    /// file set located in the specified `location`, and update the names
+    /// in `fileSet` accordingly.  The specified `needQList` determines
+    /// whether `fileSet` has a QList file.  Return zero on success, non-zero
+    /// value otherwise along with populating the specified
+    /// `errorDescription` with a brief reason for logging purposes, in which
+    /// case the files keep their spare names.  Note that the files remain
+    /// open and mapped.
+    static int activateSpare(bsl::ostream&            errorDescription,
+                             FileSet*                 fileSet,
+                             int                      partitionId,
+                             const bslstl::StringRef& location,
+                             bool                     needQList);
+
     /// Populate the specified `timestamp` with the `YYYYMMDD_HHMMSS`
     /// pattern extracted from the specified BlazingMQ `filename`.  Return
     /// zero on success, non-zero value otherwise.
@@ -246,7 +299,11 @@ struct FileStoreUtil {
     /// for logging purposes.  If the specified `preallocate` flag is true,
     /// reserve the space for the files on disk.  If the specified
     /// `deleteOnFailure` flag is true, delete the files on disk on failure.
-    /// Note that in case of errors, this method closes any files it opened.
+    /// If the optionally specified `prefaultPages` flag is true, populate
+    /// the page tables of the mappings.  If the optionally specified
+    /// `useHugePages` flag is true, back the mappings with huge pages if
+    /// possible (see `FileSystemUtil::open`).  Note that in case of errors,
+    /// this method closes any files it opened.
     static int openFileSetWriteMode(bsl::ostream&         errorDescription,
                                     const FileStoreSet&   fileSet,
                                     bool                  preallocate,
@@ -254,7 +311,8 @@ struct FileStoreUtil {
                                     MappedFileDescriptor* journalFd = 0,
                                     MappedFileDescriptor* dataFd    = 0,
                                     MappedFileDescriptor* qlistFd   = 0,
-                                    bool prefaultPages              = false);
+                                    bool prefaultPages              = false,
+                                    bool useHugePages               = false);
 
     /// Validate the journal, qlist and data files represented by the
     /// specified `journalFd`, `qlistFd` and `dataFd` respectively.
@@ -173,6 +173,7 @@
 #include <sys/mount.h>
 #include <sys/param.h>  // for statfs
 #endif
+#include <bsl_cerrno.h>
 #include <bsl_cstring.h>
 #include <bsl_ios.h>
 
@@ -193,12 +194,13 @@ const char k_OTHER_FS_NAME[] = "OTHER";
 // Following magic constants have been copied from <linux/magic.h> which is not
 // available on all of our linux environments at build time.
 
-const long k_MAGIC_EXT   = 0xEF53;  // EXT2, EXT3 & EXT4 use same magic value
-const long k_MAGIC_XFS   = 0x58465342;
-const long k_MAGIC_NFS   = 0x6969;
-const long k_MAGIC_TMPFS = 0x01021994;
-const long k_MAGIC_RAMFS = 0x858458F6;
-const long k_MAGIC_BTRFS = 0x9123683E;
+const long k_MAGIC_EXT       = 0xEF53;  // EXT2, EXT3 & EXT4 share this value
+const long k_MAGIC_XFS       = 0x58465342;
+const long k_MAGIC_NFS       = 0x6969;
+const long k_MAGIC_TMPFS     = 0x01021994;
+const long k_MAGIC_RAMFS     = 0x858458F6;
+const long k_MAGIC_BTRFS     = 0x9123683E;
+const long k_MAGIC_HUGETLBFS = 0x958458F6;
 
 void loadNameFromFsType(bsl::string* buffer, long ftype)
 {
@@ -215,6 +217,8 @@ void loadNameFromFsType(bsl::string* buffer, long ftype)
 
     case k_MAGIC_BTRFS: buffer->assign("BTRFS"); return;  // RETURN
 
+    case k_MAGIC_HUGETLBFS: buffer->assign("HUGETLBFS"); return;  // RETURN
+
     default: {
         // Include the hex numeric value of 'ftype', which can be looked up in
         // <linux/magic.h> header during troubleshooting.
@@ -228,6 +232,29 @@ void loadNameFromFsType(bsl::string* buffer, long ftype)
 
 #endif
 
+/// Return the huge page size of the hugetlbfs mount on which the file
+/// represented by the specified `fd` resides, or zero if the file does not
+/// reside on a hugetlbfs mount (or on a non-Linux platform).
+bsls::Types::Uint64 hugeTlbPageSize(BSLA_MAYBE_UNUSED int fd)
+{
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    struct ::statfs buf;
+    if (0 == ::fstatfs(fd, &buf) && k_MAGIC_HUGETLBFS == buf.f_type) {
+        return static_cast<bsls::Types::Uint64>(buf.f_bsize);  // RETURN
+    }
+#endif
+
+    return 0;
+}
+
+/// Return the specified `size` rounded up to a multiple of the specified
+/// `pageSize`.
+bsls::Types::Uint64 roundUpToPageSize(bsls::Types::Uint64 size,
+                                      bsls::Types::Uint64 pageSize)
+{
+    return ((size + pageSize - 1) / pageSize) * pageSize;
+}
+
 }  // close unnamed namespace
 
 // ---------------------
@@ -327,7 +354,8 @@ int FileSystemUtil::open(MappedFileDescriptor* mfd,
                          bsls::Types::Uint64   fileSize,
                          bool                  readOnly,
                          bsl::ostream&         errorDescription,
-                         bool                  prefaultPages)
+                         bool                  prefaultPages,
+                         bool                  useHugePages)
 {
     enum { rc_SUCCESS = 0, rc_OPEN_FAILURE = -1, rc_MMAP_FAILURE = -2 };
 
@@ -342,12 +370,26 @@ int FileSystemUtil::open(MappedFileDescriptor* mfd,
         return rc_OPEN_FAILURE;  // RETURN
     }
 
-    bsls::Types::Uint64 mappingSize = fileSize;
-    size_t              pageSize    = ::sysconf(_SC_PAGESIZE);
-    if (0 != fileSize % pageSize) {
-        mappingSize = (fileSize / pageSize + 1) * pageSize;
+    bsls::Types::Uint64 pageSize     = ::sysconf(_SC_PAGESIZE);
+    bsls::Types::Uint64 hugePageSize = 0;
+    if (useHugePages) {
+        // A file residing on a hugetlbfs mount is always backed by huge pages,
+        // but its size and mapping must be a multiple of the huge page size.
+        // Round up the file size in write mode, so that the subsequent
+        // 'grow()' and 'mmap()' do not fail with EINVAL.
+
+        hugePageSize = hugeTlbPageSize(fd);
+        if (0 != hugePageSize) {
+            pageSize = hugePageSize;
+            if (!readOnly) {
+                fileSize = roundUpToPageSize(fileSize, pageSize);
+            }
+        }
     }
 
+    const bsls::Types::Uint64 mappingSize = roundUpToPageSize(fileSize,
+                                                              pageSize);
+
     // mmap the file
     int protFlag = readOnly ? PROT_READ : (PROT_READ | PROT_WRITE);
 
@@ -384,6 +426,24 @@ int FileSystemUtil::open(MappedFileDescriptor* mfd,
         return rc_MMAP_FAILURE;  // RETURN
     }
 
+    if (useHugePages && 0 == hugePageSize) {
+        // Not on hugetlbfs: ask for transparent huge pages instead.  Note that
+        // the kernel honors this advice for file mappings only on tmpfs/shmem
+        // or on file systems supporting large folios in the page cache, and
+        // silently falls back to regular pages otherwise.
+
+#if defined(BSLS_PLATFORM_OS_LINUX) && defined(MADV_HUGEPAGE)
+        if (0 != ::madvise(base, mappingSize, MADV_HUGEPAGE)) {
+            BALL_LOG_WARN << "madvise(MADV_HUGEPAGE) failure for file ["
+                          << filename << "], errno: " << errno << " ["
+                          << bsl::strerror(errno) << "]. Using regular "
+                          << "pages.";
+        }
+#else
+        BALL_LOG_WARN << "Huge pages not supported on this platform.";
+#endif
+    }
+
     mfd->setFd(fd);
     mfd->setFileSize(fileSize);
     mfd->setMapping(base);
@@ -504,6 +564,14 @@ int FileSystemUtil::truncate(MappedFileDescriptor* mfd,
 {
     enum { rc_SUCCESS = 0, rc_FAILURE = -1 };
 
+    // Files on a hugetlbfs mount can only be sized in multiples of the huge
+    // page size.
+
+    const bsls::Types::Uint64 hugePageSize = hugeTlbPageSize(mfd->fd());
+    if (0 != hugePageSize) {
+        size = roundUpToPageSize(size, hugePageSize);
+    }
+
     int rc = ::ftruncate(mfd->fd(), size);
     if (0 != rc) {
         errorDescription << "ftruncate() failed for file fd [" << mfd->fd()
@@ -645,6 +713,45 @@ void FileSystemUtil::madvise(void*               mapping,
     ::madvise(static_cast<char*>(mapping), size, advice);
 }
 
+int FileSystemUtil::prefaultForWrite(void*               mapping,
+                                     bsls::Types::Uint64 size,
+                                     bsl::ostream&       errorDescription)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(mapping);
+
+    enum { rc_SUCCESS = 0, rc_MADVISE_FAILURE = -1 };
+
+#if defined(BSLS_PLATFORM_OS_LINUX) && defined(MADV_POPULATE_WRITE)
+    // Available since Linux 5.14.  Unlike 'MAP_POPULATE', which only
+    // read-faults a shared file mapping, this also takes the write faults
+    // marking the pages dirty, in a single call.
+
+    if (0 == ::madvise(mapping, size, MADV_POPULATE_WRITE)) {
+        return rc_SUCCESS;  // RETURN
+    }
+
+    if (EINVAL != errno) {
+        errorDescription << "madvise(MADV_POPULATE_WRITE) failure for memory "
+                         << "segment [" << mapping << "] of size [" << size
+                         << "] bytes, errno: " << errno << " ["
+                         << bsl::strerror(errno) << "]";
+        return rc_MADVISE_FAILURE;  // RETURN
+    }
+
+    // EINVAL: the running kernel predates 'MADV_POPULATE_WRITE', fall back to
+    // touching the pages.
+#endif
+
+    const bsls::Types::Uint64 pageSize = ::sysconf(_SC_PAGESIZE);
+    volatile char*            begin    = static_cast<volatile char*>(mapping);
+    for (bsls::Types::Uint64 offset = 0; offset < size; offset += pageSize) {
+        begin[offset] = begin[offset];
+    }
+
+    return rc_SUCCESS;
+}
+
 int FileSystemUtil::flush(void*               mapping,
                           bsls::Types::Uint64 size,
                           bsl::ostream&       errorDescription)
@@ -75,15 +75,22 @@ struct FileSystemUtil {
     /// of the file, and populate the specified `mfd` to represent the
     /// mapped file respecting the specified `readOnly` flag.  Return zero
     /// on success, non-zero otherwise with the specified `errorDescription`
-    /// containing a detailed error.  Note that the mapped region may be
-    /// greater than `fileSize` if `fileSize` is not a multiple of page
-    /// size.
+    /// containing a detailed error.  Optionally specify `prefaultPages` to
+    /// populate the page tables of the mapping.  Optionally specify
+    /// `useHugePages` to back the mapping with huge pages: if the file
+    /// resides on a hugetlbfs mount, `fileSize` is rounded up to a multiple
+    /// of the huge page size in write mode, otherwise transparent huge pages
+    /// are requested with `madvise(MADV_HUGEPAGE)`.  Note that the mapped
+    /// region may be greater than `fileSize` if `fileSize` is not a multiple
+    /// of page size.  Also note that failure to obtain huge pages is not an
+    /// error, and the mapping silently uses regular pages in that case.
     static int open(MappedFileDescriptor* mfd,
                     const char*           filename,
                     bsls::Types::Uint64   fileSize,
                     bool                  readOnly,
                     bsl::ostream&         errorDescription,
-                    bool                  prefaultPages = false);
+                    bool                  prefaultPages = false,
+                    bool                  useHugePages  = false);
 
     /// Unmap and close the file represented by the specified `mfd`.  Return
     /// zero on success, non-zero value otherwise.  The `mfd` is reset
@@ -117,7 +124,9 @@ struct FileSystemUtil {
 
     /// Truncate the specified file `mfd` to the specified `size`.  Return
     /// zero on success, non-zero value otherwise with the specified
-    /// `errorDescription` containing a detailed error.
+    /// `errorDescription` containing a detailed error.  Note that if `mfd`
+    /// resides on a hugetlbfs mount, `size` is rounded up to a multiple of
+    /// the huge page size.
     static int truncate(MappedFileDescriptor* mfd,
                         bsls::Types::Uint64   size,
                         bsl::ostream&         errorDescription);
@@ -145,6 +154,18 @@ struct FileSystemUtil {
     /// `size`, and `advice`.
     static void madvise(void* mapping, bsls::Types::Uint64 size, int advice);
 
+    /// Populate the page tables of the first specified `size` bytes of the
+    /// memory-mapped `mapping` segment for writing, so that subsequent
+    /// writes to that range are not blocked by page faults.  Return zero on
+    /// success, a non-zero value otherwise with the specified
+    /// `errorDescription` containing a detailed error.  Note that this
+    /// method uses `madvise(MADV_POPULATE_WRITE)` if supported, and touches
+    /// every page of the range otherwise.  The behavior is undefined unless
+    /// `mapping` is writable and no other thread accesses the range.
+    static int prefaultForWrite(void*               mapping,
+                                bsls::Types::Uint64 size,
+                                bsl::ostream&       errorDescription);
+
     /// Flush the memory-mapped `mapping` segment up to the specified
     /// `size`.  Return zero on success, a non-zero value otherwise with
     /// specified `errorDescription` containing a detailed error.
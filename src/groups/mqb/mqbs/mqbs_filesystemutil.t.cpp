@@ -0,0 +1,369 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// mqbs_filesystemutil.t.cpp                                          -*-C++-*-
+#include <mqbs_filesystemutil.h>
+
+// MQB
+#include <mqbs_mappedfiledescriptor.h>
+
+#include <bmqu_memoutstream.h>
+#include <bmqu_printutil.h>
+#include <bmqu_tempdirectory.h>
+
+// BDE
+#include <bdls_filesystemutil.h>
+#include <bsl_cstring.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+#include <bsla_annotations.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+// TEST DRIVER
+#include <bmqtst_testhelper.h>
+
+// BENCHMARKING LIBRARY
+#ifdef BMQTST_BENCHMARK_ENABLED
+#include <benchmark/benchmark.h>
+#endif
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+
+namespace {
+
+// CONSTANTS
+const bsls::Types::Uint64 k_BENCHMARK_FILE_SIZE = 16ULL * 1024 * 1024 * 1024;
+// Size of the partition file mapped by the benchmarks (16GB).  Lower it
+// to fit the memory and disk space available on the host, if needed.
+
+const int k_BENCHMARK_NUM_READS = 10000000;  // 10M
+// Number of random reads performed by the benchmarks.
+
+const bsls::Types::Uint64 k_READ_SIZE = 64;
+// Number of bytes read at each random offset, i.e. the size of a small
+// message.
+
+/// Create and map in write mode the file with the specified `filename` and
+/// the specified `fileSize` into the specified `mfd`, backing the mapping
+/// with huge pages if the specified `useHugePages` is true, and write to
+/// every page of the mapping so that it is resident.  Return zero on
+/// success, and a non-zero value otherwise.
+int createPartitionFile(mqbs::MappedFileDescriptor* mfd,
+                        const bsl::string&          filename,
+                        bsls::Types::Uint64         fileSize,
+                        bool                        useHugePages)
+{
+    bmqu::MemOutStream errorDesc(bmqtst::TestHelperUtil::allocator());
+    int                rc = mqbs::FileSystemUtil::open(mfd,
+                                        filename.c_str(),
+                                        fileSize,
+                                        false,  // readOnly
+                                        errorDesc,
+                                        false,  // prefaultPages
+                                        useHugePages);
+    if (0 != rc) {
+        cout << "Failed to open [" << filename << "], rc: " << rc
+             << ", error: " << errorDesc.str() << endl;
+        return rc;  // RETURN
+    }
+
+    rc = mqbs::FileSystemUtil::grow(mfd,
+                                    false,  // reserveOnDisk
+                                    errorDesc);
+    if (0 != rc) {
+        cout << "Failed to grow [" << filename << "], rc: " << rc
+             << ", error: " << errorDesc.str() << endl;
+        mqbs::FileSystemUtil::close(mfd);
+        return rc;  // RETURN
+    }
+
+    rc = mqbs::FileSystemUtil::prefaultForWrite(mfd->mapping(),
+                                                mfd->fileSize(),
+                                                errorDesc);
+    if (0 != rc) {
+        cout << "Failed to prefault [" << filename << "], rc: " << rc
+             << ", error: " << errorDesc.str() << endl;
+        mqbs::FileSystemUtil::close(mfd);
+        return rc;  // RETURN
+    }
+
+    return 0;
+}
+
+/// Load into the specified `offsets` the specified `numReads` pseudo-random
+/// offsets, aligned to `k_READ_SIZE`, of reads within a file of the
+/// specified `fileSize`.
+void generateReadOffsets(bsl::vector<bsls::Types::Uint64>* offsets,
+                         int                               numReads,
+                         bsls::Types::Uint64               fileSize)
+{
+    const bsls::Types::Uint64 numSlots = fileSize / k_READ_SIZE;
+    bsls::Types::Uint64       state    = 0x9E3779B97F4A7C15ULL;
+
+    offsets->resize(numReads);
+    for (int i = 0; i < numReads; ++i) {
+        // xorshift64
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        (*offsets)[i] = (state % numSlots) * k_READ_SIZE;
+    }
+}
+
+/// Read `k_READ_SIZE` bytes at each of the specified `offsets` in the
+/// specified `mapping`, and return a checksum of the bytes read.
+bsls::Types::Uint64
+readAtOffsets(const char*                             mapping,
+              const bsl::vector<bsls::Types::Uint64>& offsets)
+{
+    char                buffer[k_READ_SIZE];
+    bsls::Types::Uint64 checksum = 0;
+    for (size_t i = 0; i < offsets.size(); ++i) {
+        bsl::memcpy(buffer, mapping + offsets[i], k_READ_SIZE);
+        checksum += static_cast<unsigned char>(buffer[i % k_READ_SIZE]);
+    }
+
+    return checksum;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   Exercise the basic functionality of the component.
+//
+// Testing:
+//   open
+//   grow
+//   truncate
+//   close
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("BREATHING TEST");
+
+    const bsls::Types::Uint64 k_FILE_SIZE = 4 * 1024 * 1024 + 100;
+    const char                k_DATA[]    = "abcdefghijklmnopqrstuvwxyz";
+
+    bmqu::TempDirectory tempDir(bmqtst::TestHelperUtil::allocator());
+
+    for (int useHugePages = 0; useHugePages < 2; ++useHugePages) {
+        PVV("useHugePages: " << useHugePages);
+
+        bsl::string filename(tempDir.path(),
+                             bmqtst::TestHelperUtil::allocator());
+        filename.append(useHugePages ? "/huge.bmq" : "/regular.bmq");
+
+        mqbs::MappedFileDescriptor mfd;
+        bmqu::MemOutStream         errorDesc(
+            bmqtst::TestHelperUtil::allocator());
+
+        int rc = mqbs::FileSystemUtil::open(&mfd,
+                                            filename.c_str(),
+                                            k_FILE_SIZE,
+                                            false,  // readOnly
+                                            errorDesc,
+                                            false,  // prefaultPages
+                                            useHugePages);
+        BMQTST_ASSERT_EQ_D(errorDesc.str(), rc, 0);
+        BMQTST_ASSERT(mfd.isValid());
+
+        // The mapping covers at least the requested size, in whole pages.
+        BMQTST_ASSERT_GE(mfd.fileSize(), k_FILE_SIZE);
+        BMQTST_ASSERT_GE(mfd.mappingSize(), mfd.fileSize());
+
+        rc = mqbs::FileSystemUtil::grow(&mfd,
+                                        false,  // reserveOnDisk
+                                        errorDesc);
+        BMQTST_ASSERT_EQ_D(errorDesc.str(), rc, 0);
+
+        // Write at both ends of the mapping and read back.
+        bsl::memcpy(mfd.mapping(), k_DATA, sizeof(k_DATA));
+        bsl::memcpy(mfd.mapping() + k_FILE_SIZE - sizeof(k_DATA),
+                    k_DATA,
+                    sizeof(k_DATA));
+        BMQTST_ASSERT_EQ(0,
+                         bsl::memcmp(mfd.mapping(), k_DATA, sizeof(k_DATA)));
+        BMQTST_ASSERT_EQ(0,
+                         bsl::memcmp(mfd.mapping() + k_FILE_SIZE -
+                                         sizeof(k_DATA),
+                                     k_DATA,
+                                     sizeof(k_DATA)));
+
+        rc = mqbs::FileSystemUtil::truncate(&mfd, sizeof(k_DATA), errorDesc);
+        BMQTST_ASSERT_EQ_D(errorDesc.str(), rc, 0);
+        BMQTST_ASSERT_GE(mfd.fileSize(), sizeof(k_DATA));
+        BMQTST_ASSERT_EQ(0,
+                         bsl::memcmp(mfd.mapping(), k_DATA, sizeof(k_DATA)));
+
+        BMQTST_ASSERT_EQ(mqbs::FileSystemUtil::close(&mfd), 0);
+        BMQTST_ASSERT(!mfd.isValid());
+    }
+}
+
+BSLA_MAYBE_UNUSED
+static void testN1_randomReadBenchmark()
+// ------------------------------------------------------------------------
+// RANDOM READ BENCHMARK
+//
+// Concerns:
+//   Measure the latency of reads at random offsets of a large, resident,
+//   partition file, as done when delivering messages from a partition,
+//   with the file mapped with and without huge pages.  Huge pages reduce
+//   the number of TLB misses of such reads.
+//
+// Plan:
+//   - Create and prefault a 'k_BENCHMARK_FILE_SIZE' bytes file, mapped
+//     with regular pages, then with huge pages.
+//   - Read 'k_READ_SIZE' bytes at pseudo-random offsets in a timed loop.
+//
+// Note that huge pages are only obtained if the temporary directory
+// resides on a hugetlbfs mount, or if transparent huge pages are enabled
+// and supported for the file system of the temporary directory (e.g.
+// tmpfs with 'shmem_enabled' set to 'advise').
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("RANDOM READ BENCHMARK");
+
+    bmqu::TempDirectory tempDir(bmqtst::TestHelperUtil::allocator());
+
+    bsl::vector<bsls::Types::Uint64> offsets(
+        bmqtst::TestHelperUtil::allocator());
+    generateReadOffsets(&offsets,
+                        k_BENCHMARK_NUM_READS,
+                        k_BENCHMARK_FILE_SIZE);
+
+    for (int useHugePages = 0; useHugePages < 2; ++useHugePages) {
+        bsl::string filename(tempDir.path(),
+                             bmqtst::TestHelperUtil::allocator());
+        filename.append("/partition.bmq");
+
+        mqbs::MappedFileDescriptor mfd;
+        int                        rc = createPartitionFile(&mfd,
+                                     filename,
+                                     k_BENCHMARK_FILE_SIZE,
+                                     useHugePages);
+        BMQTST_ASSERT_EQ(rc, 0);
+        if (0 != rc) {
+            return;  // RETURN
+        }
+
+        // Warmup
+        readAtOffsets(mfd.mapping(), offsets);
+
+        bsls::Types::Int64  begin    = bsls::TimeUtil::getTimer();
+        bsls::Types::Uint64 checksum = readAtOffsets(mfd.mapping(), offsets);
+        bsls::Types::Int64  end      = bsls::TimeUtil::getTimer();
+
+        cout << "[" << (useHugePages ? "huge pages" : "regular pages")
+             << "] Performed " << k_BENCHMARK_NUM_READS << " random reads of "
+             << k_READ_SIZE << " bytes across "
+             << bmqu::PrintUtil::prettyBytes(k_BENCHMARK_FILE_SIZE) << " in "
+             << bmqu::PrintUtil::prettyTimeInterval(end - begin) << " ("
+             << (end - begin) / k_BENCHMARK_NUM_READS
+             << " nano seconds per read, checksum: " << checksum << ").\n";
+
+        mqbs::FileSystemUtil::close(&mfd);
+        bdls::FilesystemUtil::remove(filename);
+    }
+}
+
+#ifdef BMQTST_BENCHMARK_ENABLED
+static void
+testN1_randomReadBenchmark_GoogleBenchmark(benchmark::State& state)
+// ------------------------------------------------------------------------
+// RANDOM READ BENCHMARK
+//
+// Concerns:
+//   Measure the latency of reads at random offsets of a large, resident,
+//   partition file, with the file mapped with huge pages if
+//   'state.range(0)' is non-zero.
+//
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("GOOGLE BENCHMARK RANDOM READ");
+
+    const bool useHugePages = state.range(0) != 0;
+
+    bmqu::TempDirectory tempDir(bmqtst::TestHelperUtil::allocator());
+    bsl::string filename(tempDir.path(), bmqtst::TestHelperUtil::allocator());
+    filename.append("/partition.bmq");
+
+    bsl::vector<bsls::Types::Uint64> offsets(
+        bmqtst::TestHelperUtil::allocator());
+    generateReadOffsets(&offsets,
+                        k_BENCHMARK_NUM_READS,
+                        k_BENCHMARK_FILE_SIZE);
+
+    mqbs::MappedFileDescriptor mfd;
+    if (0 != createPartitionFile(&mfd,
+                                 filename,
+                                 k_BENCHMARK_FILE_SIZE,
+                                 useHugePages)) {
+        state.SkipWithError("Failed to create partition file");
+        return;  // RETURN
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(readAtOffsets(mfd.mapping(), offsets));
+    }
+
+    mqbs::FileSystemUtil::close(&mfd);
+}
+#endif  // BMQTST_BENCHMARK_ENABLED
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(bmqtst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 1: test1_breathingTest(); break;
+    case -1:
+        BMQTST_BENCHMARK_WITH_ARGS(testN1_randomReadBenchmark,
+                                   Arg(0)->Arg(1)->Unit(
+                                       benchmark::kMillisecond));
+        break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        bmqtst::TestHelperUtil::testStatus() = -1;
+    } break;
+    }
+#ifdef BMQTST_BENCHMARK_ENABLED
+    if (_testCase < 0) {
+        benchmark::Initialize(&argc, argv);
+        benchmark::RunSpecifiedBenchmarks();
+    }
+#endif
+
+    TEST_EPILOG(bmqtst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
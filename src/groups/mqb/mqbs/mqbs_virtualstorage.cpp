@@ -326,6 +326,14 @@ bool StorageIterator::hasReceipt() const
     return d_haveReceipt;
 }
 
+mqbi::SubscriptionResults* StorageIterator::subscriptionResults() const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(!atEnd());
+
+    return &d_iterator->second.d_subscriptionResults;
+}
+
 // CREATORS
 VirtualStorageIterator::VirtualStorageIterator(
     VirtualStorage*                             virtualStorage,
@@ -44,7 +44,7 @@
 // BMQ
 #include <bmqt_messageguid.h>
 
-#include <bmqc_orderedhashmap.h>
+#include <bmqc_flatorderedhashmap.h>
 
 // BDE
 #include <bdlbb_blob.h>
@@ -73,10 +73,11 @@ class VirtualStorage {
   public:
     /// msgGUID -> MessageContext
     /// Must be a container in which iteration order is same as insertion
-    /// order.
-    typedef bmqc::OrderedHashMap<bmqt::MessageGUID,
-                                 mqbi::DataStreamMessage,
-                                 bslh::Hash<bmqt::MessageGUIDHashAlgo> >
+    /// order.  Messages are mostly appended and removed in order, which the
+    /// flat (open addressing) map handles without a node per message.
+    typedef bmqc::FlatOrderedHashMap<bmqt::MessageGUID,
+                                     mqbi::DataStreamMessage,
+                                     bslh::Hash<bmqt::MessageGUIDHashAlgo> >
         DataStream;
 
     typedef DataStream::iterator DataStreamIterator;
@@ -309,6 +310,13 @@ class StorageIterator : public mqbi::StorageIterator {
     /// `items` collection and the message currently pointed at by this
     /// iterator has received replication factor Receipts.
     bool hasReceipt() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return a pointer to the modifiable cache of the results of
+    /// evaluating subscription expressions against the message currently
+    /// pointed at by this iterator, shared by all Apps.  The behavior is
+    /// undefined unless `atEnd` returns `false`.
+    mqbi::SubscriptionResults*
+    subscriptionResults() const BSLS_KEYWORD_OVERRIDE;
 };
 
 // ============================
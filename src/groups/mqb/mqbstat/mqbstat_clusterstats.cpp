@@ -144,6 +144,12 @@ bsls::Types::Int64 ClusterStats::getValue(const bmqst::StatContext& context,
         return value == bsl::numeric_limits<bsls::Types::Int64>::min() ? 0
                                                                        : value;
     }
+    case Stat::e_PARTITION_ROLLOVER_PREPARE_TIME: {
+        const bsls::Types::Int64 value =
+            STAT_RANGE(rangeMax, e_PARTITION_ROLLOVER_PREPARE_TIME);
+        return value == bsl::numeric_limits<bsls::Types::Int64>::min() ? 0
+                                                                       : value;
+    }
     case Stat::e_PARTITION_DATA_CONTENT: {
         const bsls::Types::Int64 value = STAT_RANGE(rangeMax,
                                                     e_PARTITION_DATA_BYTES);
@@ -400,6 +406,8 @@ ClusterStatsUtil::initializeStatContextCluster(int               historySize,
         .value("cluster.partition.cfg_journal_bytes")
         .value("partition_status")
         .value("partition.rollover_time", bmqst::StatValue::e_DISCRETE)
+        .value("partition.rollover_prepare_time",
+               bmqst::StatValue::e_DISCRETE)
         .value("partition.data_bytes", bmqst::StatValue::e_DISCRETE)
         .value("partition.journal_bytes", bmqst::StatValue::e_DISCRETE)
         .value("partition.data_offset_bytes")
@@ -104,6 +104,11 @@ class ClusterStats {
             /// happened during the report interval, then the maximum time is
             /// returned.
             e_PARTITION_ROLLOVER_TIME,
+            /// Time in nanoseconds it took to create and prefault the file
+            /// set of the partition ahead of its rollover.  Note that in case
+            /// when more than one such operations happened during the report
+            /// interval, then the maximum time is returned.
+            e_PARTITION_ROLLOVER_PREPARE_TIME,
             /// Maximum observed outstanding bytes in the data file of the
             /// partition.
             e_PARTITION_DATA_CONTENT,
@@ -213,6 +218,9 @@ class ClusterStats {
             e_PRIMARY_STATUS,
             /// Value: Nanoseconds time it took for rolling over the partition.
             e_PARTITION_ROLLOVER_TIME,
+            /// Value: Nanoseconds time it took for creating and prefaulting
+            ///        the file set of the partition ahead of its rollover.
+            e_PARTITION_ROLLOVER_PREPARE_TIME,
             /// Value: Outstanding bytes in the data file of the partition.
             e_PARTITION_DATA_BYTES,
             /// Value: Outstanding bytes in the journal file of the partition.
@@ -372,6 +380,10 @@ class PartitionStats {
     /// specified `value`.
     void setRoloverTime(bsls::Types::Int64 value);
 
+    /// Set the time in nanoseconds it took for creating and prefaulting the
+    /// file set ahead of the rollover operation to the specified `value`.
+    void setRolloverPrepareTime(bsls::Types::Int64 value);
+
     /// Set the time in nanoseconds it took for the replication of a new entry
     /// in journal file to the specified `value`.
     void setReplicationTime(bsls::Types::Int64 value);
@@ -473,6 +485,13 @@ inline void PartitionStats::setRoloverTime(bsls::Types::Int64 value)
         value);
 }
 
+inline void PartitionStats::setRolloverPrepareTime(bsls::Types::Int64 value)
+{
+    d_statContext_sp->reportValue(
+        ClusterStats::ClusterStatsIndex::e_PARTITION_ROLLOVER_PREPARE_TIME,
+        value);
+}
+
 inline void PartitionStats::setReplicationTime(bsls::Types::Int64 value)
 {
     d_statContext_sp->reportValue(
@@ -19,6 +19,8 @@ payload in various scenarios as listed below:
     - cluster gets restarted after sending ack to producer.
 """
 
+import pytest
+
 import blazingmq.dev.it.testconstants as tc
 from blazingmq.dev.it.fixtures import (
     Cluster,
@@ -30,7 +32,10 @@ from blazingmq.dev.it.util import random_string
 pytestmark = order(10)
 
 
-def test_compression_restart(cluster: Cluster, domain_urls: tc.DomainUrls):
+@pytest.mark.parametrize("algorithm", ["ZLIB", "ZSTD", "LZ4"])
+def test_compression_restart(
+    cluster: Cluster, domain_urls: tc.DomainUrls, algorithm: str
+):
     # Start a producer and post a message.
     uri_priority = domain_urls.uri_priority
     proxies = cluster.proxy_cycle()
@@ -48,7 +53,7 @@ def test_compression_restart(cluster: Cluster, domain_urls: tc.DomainUrls):
         payload=[payload],
         wait_ack=True,
         succeed=True,
-        compression_algorithm_type="ZLIB",
+        compression_algorithm_type=algorithm,
     )
 
     # Use strong consistency (SC) to ensure that majority nodes in the
@@ -721,6 +721,8 @@ void PrometheusStatConsumer::captureClusterPartitionsStats()
             // 'cluster_partition1_rollover_time')
             const bsl::string prefix = "cluster_" + partitionIt->name() + "_";
             const bsl::string rollover_time        = prefix + "rollover_time";
+            const bsl::string rollover_prepare_time = prefix +
+                                                      "rollover_prepare_time";
             const bsl::string journal_offset_bytes = prefix +
                                                      "journal_offset_bytes";
             const bsl::string journal_outstanding_bytes =
@@ -740,6 +742,8 @@ void PrometheusStatConsumer::captureClusterPartitionsStats()
 
             const DatapointDef defs[] = {
                 {rollover_time.c_str(), Stat::e_PARTITION_ROLLOVER_TIME},
+                {rollover_prepare_time.c_str(),
+                 Stat::e_PARTITION_ROLLOVER_PREPARE_TIME},
                 {journal_offset_bytes.c_str(),
                  Stat::e_PARTITION_JOURNAL_OFFSET},
                 {journal_outstanding_bytes.c_str(),
@@ -267,6 +267,11 @@ class TweakFactory:
 
                         queue_size_high_watermark = QueueSizeHighWatermark()
 
+                        class LockFreeQueue(metaclass=TweakMetaclass):
+                            def __call__(self, value: bool) -> Callable: ...
+
+                        lock_free_queue = LockFreeQueue()
+
                         def __call__(
                             self,
                             value: typing.Union[
@@ -316,6 +321,11 @@ class TweakFactory:
 
                         queue_size_high_watermark = QueueSizeHighWatermark()
 
+                        class LockFreeQueue(metaclass=TweakMetaclass):
+                            def __call__(self, value: bool) -> Callable: ...
+
+                        lock_free_queue = LockFreeQueue()
+
                         def __call__(
                             self,
                             value: typing.Union[
@@ -365,6 +375,11 @@ class TweakFactory:
 
                         queue_size_high_watermark = QueueSizeHighWatermark()
 
+                        class LockFreeQueue(metaclass=TweakMetaclass):
+                            def __call__(self, value: bool) -> Callable: ...
+
+                        lock_free_queue = LockFreeQueue()
+
                         def __call__(
                             self,
                             value: typing.Union[
@@ -1296,6 +1311,31 @@ class TweakFactory:
 
             sync_config = SyncConfig()
 
+            class GroupCommitIntervalMs(metaclass=TweakMetaclass):
+                def __call__(self, value: int) -> Callable: ...
+
+            group_commit_interval_ms = GroupCommitIntervalMs()
+
+            class GroupCommitMaxBytes(metaclass=TweakMetaclass):
+                def __call__(self, value: int) -> Callable: ...
+
+            group_commit_max_bytes = GroupCommitMaxBytes()
+
+            class PrecreateFileSet(metaclass=TweakMetaclass):
+                def __call__(self, value: bool) -> Callable: ...
+
+            precreate_file_set = PrecreateFileSet()
+
+            class RolloverBatchSize(metaclass=TweakMetaclass):
+                def __call__(self, value: int) -> Callable: ...
+
+            rollover_batch_size = RolloverBatchSize()
+
+            class HugePages(metaclass=TweakMetaclass):
+                def __call__(self, value: bool) -> Callable: ...
+
+            huge_pages = HugePages()
+
             def __call__(
                 self,
                 value: typing.Union[blazingmq.schemas.mqbcfg.PartitionConfig, NoneType],
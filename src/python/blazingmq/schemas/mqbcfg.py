@@ -232,6 +232,21 @@ class Disallow:
 
 @dataclass
 class DispatcherProcessorParameters:
+    """Type representing the configuration of the queue of a processor of
+    the dispatcher.
+
+    queueSize..............: size of the queue past which it is
+    considered full
+    queueSizeLowWatermark..: low watermark of the queue, also used as its
+    initial capacity
+    queueSizeHighWatermark.: high watermark of the queue
+    lockFreeQueue..........: flag to indicate whether the queue should be
+    a lock-free ring buffer, whose processor
+    spins for a while before parking when the
+    queue is empty, instead of a mutex-based
+    queue
+    """
+
     queue_size: Optional[int] = field(
         default=None,
         metadata={
@@ -259,6 +274,15 @@ class DispatcherProcessorParameters:
             "required": True,
         },
     )
+    lock_free_queue: bool = field(
+        default=False,
+        metadata={
+            "name": "lockFreeQueue",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
 
 
 @dataclass
@@ -1344,6 +1368,29 @@ class PartitionConfig:
     storage files to disk at shutdown
     syncConfig...........: configuration for storage synchronization and
     recovery
+    groupCommitIntervalMs: maximum time, in milliseconds, between a write
+    to a partition and the sync of the partition's
+    files to disk, after which the write is
+    acknowledged; 0 disables group commit, in which
+    case writes are acknowledged without syncing
+    files
+    groupCommitMaxBytes..: number of bytes written to a partition
+    triggering the sync of its files to disk before
+    'groupCommitIntervalMs' elapses, when group
+    commit is enabled
+    precreateFileSet.....: flag to indicate whether the next file set of a
+    partition should be created, grown and
+    prefaulted in the background ahead of its
+    rollover
+    rolloverBatchSize....: maximum number of records copied at a time by an
+    incremental rollover of a partition, between
+    which other work of the partition is
+    processed; 0 disables incremental rollover, in
+    which case all records are copied at once
+    hugePages............: flag to indicate whether the files of a
+    partition should be mapped with huge pages,
+    either because they reside on a hugetlbfs
+    mount or via transparent huge pages
     """
 
     num_partitions: Optional[int] = field(
@@ -1452,6 +1499,51 @@ class PartitionConfig:
             "required": True,
         },
     )
+    group_commit_interval_ms: int = field(
+        default=0,
+        metadata={
+            "name": "groupCommitIntervalMs",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
+    group_commit_max_bytes: int = field(
+        default=1048576,
+        metadata={
+            "name": "groupCommitMaxBytes",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
+    precreate_file_set: bool = field(
+        default=False,
+        metadata={
+            "name": "precreateFileSet",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
+    rollover_batch_size: int = field(
+        default=0,
+        metadata={
+            "name": "rolloverBatchSize",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
+    huge_pages: bool = field(
+        default=False,
+        metadata={
+            "name": "hugePages",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
 
 
 @dataclass
@@ -408,6 +408,10 @@ class Domain:
     PUTs.
     consistency.........: optional consistency mode.
     subscriptions.......: optional application subscriptions
+    compressionDictionary: optional trained zstd dictionary (base64
+    encoded) advertised to clients opening queues
+    in this domain, used to compress small
+    messages with ZSTD
     """
 
     name: Optional[str] = field(
@@ -521,6 +525,15 @@ class Domain:
             "min_occurs": 1,
         },
     )
+    compression_dictionary: Optional[bytes] = field(
+        default=None,
+        metadata={
+            "name": "compressionDictionary",
+            "type": "Element",
+            "namespace": "urn:x-bloomberg-com:mqbconfm",
+            "format": "base64",
+        },
+    )
 
 
 @dataclass